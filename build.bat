@@ -1,6 +1,6 @@
 @REM call vcvars64.bat
 
-set CFLAGS=/I ./include /I ./OpenCL/include /D nPROFILING /W0 /Od /D CL_TARGET_OPENCL_VERSION=300 /D CL_USE_DEPRECATED_OPENCL_1_2_APIS /Zi
+set CFLAGS=/I ./include /I ./OpenCL/include /std:c11 /experimental:c11atomics /D nPROFILING /W0 /Od /D CL_TARGET_OPENCL_VERSION=300 /D CL_USE_DEPRECATED_OPENCL_1_2_APIS /Zi
 
 set FILES=.\src\*.c .\src\platform_specific\render_windows.c
 
@@ -5,7 +5,13 @@ set -xe
 COMMON_CFLAGS="-ggdb -DnPROFILING -O3 -I ./include -DCL_TARGET_OPENCL_VERSION=300 -DCL_USE_DEPRECATED_OPENCL_1_2_APIS"
 FILES="`find ./src -maxdepth 1 -type f -name "*.c"` ./src/platform_specific/render_linux_x11.c"
 CC="gcc"
-LIBS="-lm `pkg-config --cflags --static --libs OpenCL x11`"
+LIBS="-lm -lpthread `pkg-config --cflags --static --libs OpenCL x11`"
+
+#ATOMISTIC_MPI=1 ./build.sh builds integrate_mpi and the MPI main, run with mpirun -np N ./main
+if [ "$ATOMISTIC_MPI" = "1" ]; then
+    CC="mpicc"
+    COMMON_CFLAGS="$COMMON_CFLAGS -DUSE_MPI"
+fi
 
 if [ "`pkg-config --libs xext`" > /dev/null ]; then
     LIBS="$LIBS `pkg-config --static --libs xext`"
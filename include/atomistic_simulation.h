@@ -3,10 +3,12 @@
 
 #include "constants.h"
 #include "gpu.h"
+#include "gpu_tuner.h"
 #include "grid_funcs.h"
 #include "grid_types.h"
 #include "grid_render.h"
 #include "integrate.h"
+#include "integrate_mpi.h"
 #include "gradient_descent.h"
 #include "render.h"
 #include "string_builder.h"
@@ -3,6 +3,7 @@
 
 #include <stdint.h>
 #include <stdarg.h>
+#include <stdbool.h>
 #include <stdio.h>
 #include <CL/cl.h>
 #include <string.h>
@@ -11,6 +12,8 @@
 #include "string_builder.h"
 #include "constants.h"
 #include "logging.h"
+#include "gpu_profiler.h"
+#include "gpu_pool.h"
 
 #ifdef PROFILING
 #define gpu_cl_enqueue_nd(gpu, kernel, n_dim, local, global, offset) gpu_cl_enqueue_nd_profiling(gpu, kernel, n_dim, local, global, offset)
@@ -23,35 +26,86 @@
 
 #define gpu_cl_read_gpu(gpu, size, offset, host, device) gpu_cl_read_gpu_base(gpu, size, offset, host, device, #device " -> " #host, __FILE__, __LINE__)
 #define gpu_cl_write_gpu(gpu, size, offset, host, device) gpu_cl_write_gpu_base(gpu, size, offset, host, device, #device " <- " #host, __FILE__, __LINE__)
+#define gpu_cl_read_gpu_async(gpu, size, offset, host, device, ev) gpu_cl_read_gpu_async_base(gpu, size, offset, host, device, ev, #device " -> " #host, __FILE__, __LINE__)
+#define gpu_cl_write_gpu_async(gpu, size, offset, host, device, ev) gpu_cl_write_gpu_async_base(gpu, size, offset, host, device, ev, #device " <- " #host, __FILE__, __LINE__)
+//the read starts once the wait events completed, usually on another queue
+#define gpu_cl_read_gpu_after(gpu, size, offset, host, device, n_wait, wait, ev) gpu_cl_read_gpu_after_base(gpu, size, offset, host, device, n_wait, wait, ev, #device " -> " #host, __FILE__, __LINE__)
+//host views of a buffer, the device must not touch it between the map and the unmap
+#define gpu_cl_map_gpu(gpu, size, offset, device, flags, n_wait, wait, ev) gpu_cl_map_gpu_base(gpu, size, offset, device, flags, n_wait, wait, ev, #device, __FILE__, __LINE__)
+#define gpu_cl_unmap_gpu(gpu, device, host) gpu_cl_unmap_gpu_base(gpu, device, host, #device, __FILE__, __LINE__)
+#define gpu_cl_copy_gpu(gpu, size, src, dst) gpu_cl_copy_gpu_offset_base(gpu, size, src, 0, dst, 0, #src " -> " #dst, __FILE__, __LINE__)
+#define gpu_cl_copy_gpu_offset(gpu, size, src, src_offset, dst, dst_offset) gpu_cl_copy_gpu_offset_base(gpu, size, src, src_offset, dst, dst_offset, #src " -> " #dst, __FILE__, __LINE__)
+//width and x in bytes, height and y in rows of pitch bytes, the host side is packed
+#define gpu_cl_read_gpu_rect(gpu, width, height, x, y, pitch, host, device) gpu_cl_read_gpu_rect_base(gpu, width, height, x, y, pitch, host, device, #device " -> " #host, __FILE__, __LINE__)
+#define gpu_cl_write_gpu_rect(gpu, width, height, x, y, pitch, host, device) gpu_cl_write_gpu_rect_base(gpu, width, height, x, y, pitch, host, device, #device " <- " #host, __FILE__, __LINE__)
 
 
 extern uint64_t p_id;
 extern uint64_t d_id;
 extern uint64_t gpu_optimal_wg;
+extern uint64_t gpu_optimal_tile[2];
+extern uint64_t gpu_cpu_subdevices;
 
 typedef struct {
     cl_kernel kernel;
     const char *name;
+
+    //2D launch shape picked by gpu_cl_tune_kernel for tuned_items, {cols, rows}
+    uint64_t local[2];
+    uint64_t global[2];
+    uint64_t tuned_items[2];
 } kernel_t;
 
+typedef struct gpu_session gpu_session;
+
 typedef struct {
     cl_platform_id *platforms;
     uint64_t n_platforms;
 
     cl_device_id *devices;
     uint64_t n_devices;
+    //devices from n_root_devices on are sub-devices of gpu_cpu_subdevices, released with the context
+    uint64_t n_root_devices;
 
     cl_context ctx;
     cl_command_queue queue;
+    //device the queue runs on, copies of the struct with another queue change both
+    cl_device_id queue_device;
 
     cl_program program;
     //Store kernels here?
     kernel_t *kernels;
     uint64_t n_kernels;
+    //hash of the source and compile options, keys the work-group cache
+    uint64_t program_hash;
+    //program compiled with INCLUDE_DIPOLAR, nothing reads the dipolar table otherwise
+    bool dipolar;
+
+    //only allocated with PROFILING, shared by every copy of the struct
+    gpu_profiler *profiler;
+    //set when borrowed from a session, which owns everything but the kernels and the profiler
+    gpu_session *session;
 } gpu_cl;
 
+//platforms, devices, context and queue opened once and the programs compiled so far, keyed by program_hash.
+//gpu_cl borrowed from it skip both the device setup and the compile of a program it already has, and their
+//gpu_cl_create_gpu / gpu_cl_release_memory go through the buffer pool
+struct gpu_session {
+    gpu_cl base;
+    cl_program *programs;
+    uint64_t *program_hashes;
+    uint64_t n_programs;
+    uint64_t borrowed;
+    gpu_pool *pool;
+};
+
 gpu_cl gpu_cl_init(const char *current_function, const char *field_func, const char *temperature_func, const char *kernel_augment, const char *compile_augment);
+gpu_cl gpu_cl_init_terms(const char *current_function, const char *field_func, const char *temperature_func, const char *kernel_augment, const char *compile_augment, uint64_t grid_terms);
 void gpu_cl_close(gpu_cl *gpu);
+gpu_session gpu_session_open(void);
+void gpu_session_close(gpu_session *session);
+//a NULL session falls back to gpu_cl_init_terms, gpu_cl_close gives the gpu_cl back either way
+gpu_cl gpu_session_borrow(gpu_session *session, const char *current_function, const char *field_func, const char *temperature_func, const char *kernel_augment, const char *compile_augment, uint64_t grid_terms);
 uint64_t gpu_cl_append_kernel(gpu_cl *gpu, const char *kernel);
 void gpu_cl_fill_kernel_args(gpu_cl *gpu, uint64_t kernel, uint64_t offset, uint64_t nargs, ...);
 void gpu_cl_enqueue_nd_profiling(gpu_cl *gpu, uint64_t kernel, uint64_t n_dim, uint64_t *local, uint64_t *global, uint64_t *offset);
@@ -62,7 +116,26 @@ cl_mem gpu_cl_create_gpu_base(gpu_cl *gpu, uint64_t size, cl_mem_flags flags, co
 void gpu_cl_write_gpu_base(gpu_cl *gpu, uint64_t size, uint64_t offset, void *host, cl_mem device, const char *name, const char *file, int line);
 void gpu_cl_read_gpu_base(gpu_cl *gpu, uint64_t size, uint64_t offset, void *host, cl_mem device, const char *name, const char *file, int line);
 
+void gpu_cl_read_gpu_async_base(gpu_cl *gpu, uint64_t size, uint64_t offset, void *host, cl_mem device, cl_event *ev, const char *name, const char *file, int line);
+void gpu_cl_write_gpu_async_base(gpu_cl *gpu, uint64_t size, uint64_t offset, void *host, cl_mem device, cl_event *ev, const char *name, const char *file, int line);
+void gpu_cl_read_gpu_after_base(gpu_cl *gpu, uint64_t size, uint64_t offset, void *host, cl_mem device, uint64_t n_wait, cl_event *wait, cl_event *ev, const char *name, const char *file, int line);
+void *gpu_cl_map_gpu_base(gpu_cl *gpu, uint64_t size, uint64_t offset, cl_mem device, cl_map_flags flags, uint64_t n_wait, cl_event *wait, cl_event *ev, const char *name, const char *file, int line);
+void gpu_cl_unmap_gpu_base(gpu_cl *gpu, cl_mem device, void *host, const char *name, const char *file, int line);
+bool gpu_cl_unified_memory(gpu_cl *gpu);
+void gpu_cl_copy_gpu_offset_base(gpu_cl *gpu, uint64_t size, cl_mem src, uint64_t src_offset, cl_mem dst, uint64_t dst_offset, const char *name, const char *file, int line);
+void gpu_cl_read_gpu_rect_base(gpu_cl *gpu, uint64_t width, uint64_t height, uint64_t x, uint64_t y, uint64_t pitch, void *host, cl_mem device, const char *name, const char *file, int line);
+void gpu_cl_write_gpu_rect_base(gpu_cl *gpu, uint64_t width, uint64_t height, uint64_t x, uint64_t y, uint64_t pitch, void *host, cl_mem device, const char *name, const char *file, int line);
+void gpu_cl_enqueue_nd_wait(gpu_cl *gpu, uint64_t kernel, uint64_t n_dim, uint64_t *local, uint64_t *global, uint64_t *offset, uint64_t n_wait, cl_event *wait);
+void gpu_cl_wait_events(uint64_t n, cl_event *events);
+//completes once everything enqueued before it did
+void gpu_cl_enqueue_marker(gpu_cl *gpu, cl_event *ev);
+
 void gpu_cl_set_kernel_arg(gpu_cl *gpu, uint64_t kernel, uint64_t index, uint64_t size, void *data);
+void gpu_cl_finish(gpu_cl *gpu);
+void gpu_cl_flush(gpu_cl *gpu);
+void gpu_cl_release_event(cl_event ev);
+cl_command_queue gpu_cl_create_queue(gpu_cl *gpu, cl_device_id device);
+void gpu_cl_release_queue(cl_command_queue queue);
 void gpu_cl_release_memory_base(cl_mem mem, const char *name, const char *file, int line);
 uint64_t gpu_cl_gcd(uint64_t a, uint64_t b);
 
@@ -0,0 +1,57 @@
+#ifndef __GPU_POOL_H
+#define __GPU_POOL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <CL/cl.h>
+
+//smallest size class, everything below shares it
+#define GPU_POOL_MIN_CLASS 256
+//quarter steps between powers of two, so a buffer is at most 25% bigger than asked
+#define GPU_POOL_CLASS_STEPS 4
+
+//fills released buffers with 0xff bytes (NaN for doubles and v3d) so reads of stale data stand out
+extern bool gpu_pool_poison;
+
+typedef struct {
+    cl_mem mem;
+    uint64_t size;
+    cl_mem_flags flags;
+} gpu_pool_buffer;
+
+typedef struct {
+    uint64_t requests;
+    uint64_t reuses;
+    uint64_t created;
+    uint64_t bytes_in_use;
+    uint64_t peak_bytes_in_use;
+    //in use plus waiting in the pool
+    uint64_t bytes_held;
+    uint64_t peak_bytes_held;
+} gpu_pool_stats;
+
+typedef struct {
+    cl_context ctx;
+    //only used to poison
+    cl_command_queue queue;
+
+    gpu_pool_buffer *free;
+    uint64_t n_free;
+    gpu_pool_buffer *used;
+    uint64_t n_used;
+
+    gpu_pool_stats stats;
+} gpu_pool;
+
+uint64_t gpu_pool_size_class(uint64_t size);
+gpu_pool *gpu_pool_init(cl_context ctx, cl_command_queue queue);
+//buffers still in use are released too, with a warning
+void gpu_pool_free(gpu_pool *pool);
+cl_mem gpu_pool_acquire(gpu_pool *pool, uint64_t size, cl_mem_flags flags, const char *file, int line);
+//false when no pool handed out mem, the caller releases it then
+bool gpu_pool_release(cl_mem mem, const char *name, const char *file, int line);
+//releases the buffers waiting in the pool
+void gpu_pool_trim(gpu_pool *pool);
+void gpu_pool_log_stats(gpu_pool *pool);
+
+#endif
@@ -0,0 +1,47 @@
+#ifndef __GPU_PROFILER_H
+#define __GPU_PROFILER_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <CL/cl.h>
+
+//events waiting to be resolved, the oldest half is resolved when the ring fills up
+#define GPU_PROFILER_RING 4096
+//per kernel reservoir used for the percentiles
+#define GPU_PROFILER_SAMPLES 1024
+
+typedef struct {
+    const char *name;
+    uint64_t count;
+    double total;
+    double min;
+    double max;
+    double samples[GPU_PROFILER_SAMPLES];
+} gpu_profiler_stats;
+
+typedef struct {
+    cl_event events[GPU_PROFILER_RING];
+    const char *names[GPU_PROFILER_RING];
+    uint64_t head;
+    uint64_t len;
+
+    gpu_profiler_stats *stats;
+    uint64_t n_stats;
+    uint64_t seed;
+
+    FILE *trace;
+    bool trace_empty;
+    bool has_origin;
+    cl_ulong origin;
+} gpu_profiler;
+
+gpu_profiler *gpu_profiler_init(void);
+void gpu_profiler_push(gpu_profiler *p, cl_event ev, const char *name);
+void gpu_profiler_flush(gpu_profiler *p);
+bool gpu_profiler_trace_open(gpu_profiler *p, const char *path);
+void gpu_profiler_trace_close(gpu_profiler *p);
+void gpu_profiler_summary(gpu_profiler *p, FILE *f);
+void gpu_profiler_free(gpu_profiler *p);
+
+#endif
@@ -0,0 +1,23 @@
+#ifndef __GPU_TUNER_H
+#define __GPU_TUNER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "gpu.h"
+
+//timed launches per candidate tile, the fastest one counts
+#define GPU_TUNER_REPEATS 5
+
+//when false every tuned kernel uses gpu_optimal_tile
+extern bool gpu_autotune;
+//results keyed by device name, driver version, program hash, kernel and domain size
+extern const char *gpu_autotune_cache;
+
+//2D launches over cols x rows items, dimension 0 is the column
+void gpu_cl_tune_kernel(gpu_cl *gpu, uint64_t kernel, uint64_t cols, uint64_t rows);
+void gpu_cl_enqueue_tuned(gpu_cl *gpu, uint64_t kernel, uint64_t cols, uint64_t rows);
+//biggest work group the device runs kernel with, local arrays sized by the group have to hold that many items for tuning
+uint64_t gpu_cl_kernel_max_group(gpu_cl *gpu, uint64_t kernel);
+
+#endif
@@ -15,6 +15,8 @@ typedef struct {
     double T_factor;
     const char *field_func;
     const char *compile_augment;
+    //NULL opens a device and compiles for this run only, see gpu_session_open
+    gpu_session *session;
 } gradient_descent_params;
 
 typedef struct {
@@ -50,6 +50,7 @@ typedef struct {
 
     cl_mem gp_gpu;
     cl_mem m_gpu;
+    cl_mem dipolar_gpu;
 
     bool on_gpu;
 
@@ -100,6 +101,7 @@ void grid_uniform(grid *g, v3d dir);
 bool grid_free(grid *g);
 bool grid_release_from_gpu(grid *g);
 
+uint64_t grid_kernel_terms(grid *g);
 void grid_to_gpu(grid *g, gpu_cl gpu);
 void grid_from_gpu(grid *g, gpu_cl gpu);
 void v3d_from_gpu(v3d *g, cl_mem buffer, unsigned int rows, unsigned int cols, gpu_cl gpu);
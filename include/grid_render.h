@@ -9,18 +9,26 @@
 #include "gradient_descent.h"
 #include "integrate.h"
 #include "gsa.h"
+#include "video.h"
 
 typedef struct {
     grid *g;
     gpu_cl *gpu;
 
+    //image_width x image_height, the lattice clamped to the window, stretched over the window on the host
     cl_mem rgba_gpu;
+    //window sized for the cluster views, the image goes through it without zero_copy
     RGBA32 *rgba_cpu;
+    bool zero_copy;
     unsigned int width, height;
+    unsigned int image_width, image_height;
+    //bilinear instead of nearest pixel when stretching
+    bool linear_filter;
 
-    uint64_t r_global;
-    uint64_t g_global;
-    uint64_t local;
+    //lattices bigger than the window are coloured one pixel per site into site_rgba_gpu, then averaged down
+    //into rgba_gpu, NULL otherwise
+    cl_mem site_rgba_gpu;
+    uint64_t downsample_id;
 
     uint64_t grid_hsl_id;
     uint64_t grid_bwr_id;
@@ -32,17 +40,37 @@ typedef struct {
     uint64_t calc_charge_id;
     uint64_t calc_electric_id;
 
-    double *buffer_cpu;
     cl_mem buffer_gpu;
-
-    v3d *v3d_buffer_cpu;
     cl_mem v3d_buffer_gpu;
+
+    //min and max of buffer_gpu (or of the lengths in v3d_buffer_gpu) for the colour kernels, found by a single
+    //work group of range_local items
+    cl_mem range_gpu;
+    uint64_t range_id;
+    uint64_t range_norm_id;
+    uint64_t range_local;
+
+    //frames go there instead of the window when set, video_frames numbers them
+    video_writer *video;
+    uint64_t video_frames;
 } grid_renderer;
 
+//steps the viewers simulate between two published frames, only the starting value when target_fps is set
 extern unsigned int steps_per_frame;
+//display rate of the viewers, the simulation sizes its batches so one lands per displayed frame. 0 draws as fast as
+//possible with a fixed steps_per_frame
+extern double target_fps;
 extern double print_time;
+//the viewers write record_view frames into record_path instead of opening a window, one every steps_per_frame steps
+//until the run ends (duration of integrate, outer_steps of gsa and gradient descent). NULL opens the window
+extern const char *record_path;
+extern video_params record_video;
+extern int record_view;
 
+//as big as the window
 grid_renderer grid_renderer_init(grid *g, gpu_cl *gpu);
+//images of at most width x height pixels, without a window
+grid_renderer grid_renderer_init_size(grid *g, gpu_cl *gpu, unsigned int width, unsigned int height);
 void grid_renderer_close(grid_renderer *gr);
 void grid_renderer_hsl(grid_renderer *gr);
 void grid_renderer_bwr(grid_renderer *gr);
@@ -50,10 +78,14 @@ void grid_renderer_pinning(grid_renderer *gr);
 void grid_renderer_energy(grid_renderer *gr, double time);
 void grid_renderer_charge(grid_renderer *gr);
 void grid_renderer_electric_field(grid_renderer *gr);
-void grid_renderer_clustering(grid_renderer *gr);
+//points and clusters as grid_cluster left them in a grid
+void grid_renderer_clustering(grid_renderer *gr, const cluster_point *points, const cluster_centers *clusters);
 void grid_renderer_gsa(grid *g, gsa_params params, unsigned int width, unsigned int height);
 void grid_renderer_gradient_descent(grid *g, gradient_descent_params params, unsigned int width, unsigned int height);
 void grid_renderer_integrate(grid *g, integrate_params params, unsigned int width, unsigned int height);
+//plays back the integrate_evolution.dat at path, params are the ones of the run. space pauses, ',' and '.' step a frame,
+//'[' and ']' halve and double the speed, 'r' reverses, 'j' and 'l' seek a twentieth, '0'-'9' jump to tenths
+void grid_renderer_replay(const char *path, integrate_params params, unsigned int width, unsigned int height);
 
 /*void grid_renderer_exchange_energy(grid_renderer *gr);
   void grid_renderer_electric_field(grid_renderer *gr);
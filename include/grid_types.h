@@ -17,6 +17,11 @@ typedef enum {
     CUR_BOTH = CUR_STT | CUR_SHE //=3
 } current_type;
 
+typedef enum {
+    INTEGRATE_RK4 = 0,
+    INTEGRATE_MIDPOINT = 1, //semi-implicit midpoint with Cayley rotation, keeps |m| = 1
+} integrate_method;
+
 typedef struct {
     v3d m;
     int pbc_x;
@@ -71,6 +76,23 @@ typedef struct {
     v3d left, right, up, down;
 } neighbors_set;
 
+//in-plane dipolar tensor (3 r r - I) / |r|^3 for an integer (dr, dc) offset, in units of the lattice
+//xz and yz vanish because every site lies on the same plane
+typedef struct {
+    double xx, xy, yy, zz;
+} dipolar_tensor;
+
+#define DIPOLAR_TILE 256
+
+//cell of the Barnes-Hut pyramid, level l groups 2^l x 2^l sites
+typedef struct {
+    v3d moment; //sum of mu * m
+    double x, y; //|mu| weighted center, in lattice units
+    double weight; //sum of |mu|, empty cells are skipped
+} dipolar_node;
+
+#define DIPOLAR_TREE_MAX_LEVELS 24
+
 typedef struct {
     v3d magnetic_field_finite;
     v3d magnetic_field_lattice;
@@ -97,9 +119,67 @@ typedef struct {
     double dipolar_energy;
     double energy;
 
+    //squared error of the reused dipolar field against a fresh one, and the squared fresh field
+    double dipolar_cache_error;
+    double dipolar_field_norm;
+
     double D_xx;
     double D_yy;
     double D_xy; //=D_yx
 } information_packed;
 
+//observables of information_packed, integrate_params.observables picks them. The kernels are built with
+//INFO_OBSERVABLES set to the same mask, so the others are neither computed nor transferred
+#define INFO_ENERGY (1 << 0) //every energy term and the total
+#define INFO_CHARGE (1 << 1) //finite and lattice topological charge
+#define INFO_AVG_M (1 << 2)
+#define INFO_ELECTRIC_FIELD (1 << 3) //emergent electric field
+#define INFO_MAGNETIC_FIELD (1 << 4) //emergent magnetic field, lattice and finite
+#define INFO_CHARGE_CENTER (1 << 5) //centres of the charge and of its absolute value
+#define INFO_D_TENSOR (1 << 6)
+#define INFO_DIPOLAR_ERROR (1 << 7) //error of the reused dipolar field, only multirate runs have one
+#define INFO_ALL ((1 << 8) - 1)
+
+#ifdef OPENCL_COMPILATION
+#ifndef INFO_OBSERVABLES
+#define INFO_OBSERVABLES INFO_ALL
+#endif
+#endif
+
+//fields of information_packed that each observable needs, in the order they are packed on the device.
+//The centres are divided by the charges when printed, so they bring those along
+#define INFO_FIELDS(X) \
+    X(INFO_ENERGY, energy) \
+    X(INFO_ENERGY, exchange_energy) \
+    X(INFO_ENERGY, dm_energy) \
+    X(INFO_ENERGY, field_energy) \
+    X(INFO_ENERGY, anisotropy_energy) \
+    X(INFO_ENERGY, cubic_energy) \
+    X(INFO_ENERGY, dipolar_energy) \
+    X(INFO_CHARGE | INFO_CHARGE_CENTER, charge_finite) \
+    X(INFO_CHARGE, charge_lattice) \
+    X(INFO_CHARGE_CENTER, abs_charge_finite) \
+    X(INFO_CHARGE, abs_charge_lattice) \
+    X(INFO_AVG_M, avg_m.x) \
+    X(INFO_AVG_M, avg_m.y) \
+    X(INFO_AVG_M, avg_m.z) \
+    X(INFO_ELECTRIC_FIELD, electric_field.x) \
+    X(INFO_ELECTRIC_FIELD, electric_field.y) \
+    X(INFO_ELECTRIC_FIELD, electric_field.z) \
+    X(INFO_MAGNETIC_FIELD, magnetic_field_lattice.x) \
+    X(INFO_MAGNETIC_FIELD, magnetic_field_lattice.y) \
+    X(INFO_MAGNETIC_FIELD, magnetic_field_lattice.z) \
+    X(INFO_MAGNETIC_FIELD, magnetic_field_finite.x) \
+    X(INFO_MAGNETIC_FIELD, magnetic_field_finite.y) \
+    X(INFO_MAGNETIC_FIELD, magnetic_field_finite.z) \
+    X(INFO_CHARGE_CENTER, charge_center_x) \
+    X(INFO_CHARGE_CENTER, charge_center_y) \
+    X(INFO_CHARGE_CENTER, abs_charge_center_x) \
+    X(INFO_CHARGE_CENTER, abs_charge_center_y) \
+    X(INFO_D_TENSOR, D_xx) \
+    X(INFO_D_TENSOR, D_yy) \
+    X(INFO_D_TENSOR, D_xy) \
+    X(INFO_DIPOLAR_ERROR, dipolar_cache_error) \
+    X(INFO_DIPOLAR_ERROR, dipolar_field_norm)
+
 #endif
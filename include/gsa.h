@@ -14,6 +14,8 @@ typedef struct {
 
     const char *field_func;
     const char *compile_augment;
+    //NULL opens a device and compiles for this run only, see gpu_session_open
+    gpu_session *session;
 } gsa_params;
 
 typedef struct {
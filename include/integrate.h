@@ -9,21 +9,62 @@
 #include "constants.h"
 #include "complete_kernel.h"
 #include "colors.h"
+#include "video.h"
+
+//integrate_run_steps waits for the queue after this many steps so it never grows unbounded
+#define INTEGRATE_BATCH_SYNC 1024
+//output frames in flight on the transfer queue, the oldest one is written out before its slot is reused
+#define INTEGRATE_SNAPSHOTS 2
+//raw frames are copied into a device bank and read back in one transfer once it is full, while the other bank fills
+#define INTEGRATE_RAW_BANKS 2
+//the banks together stay under this, whatever raw_ring_frames asks
+#define INTEGRATE_RAW_RING_MAX_BYTES (512ull * 1024 * 1024)
+
+typedef enum {
+    DIPOLAR_DIRECT = 0,
+    DIPOLAR_BARNES_HUT = 1,
+} dipolar_method;
 
 typedef struct {
     double dt;
     double duration;
+    integrate_method method;
+
+    //only used with INCLUDE_DIPOLAR: the long range field is recomputed every dipolar_refresh_steps steps
+    //or once some spin moved more than dipolar_refresh_threshold since the last refresh (0 disables the check,
+    //which otherwise costs a device reduction and a small read every step)
+    uint64_t dipolar_refresh_steps;
+    double dipolar_refresh_threshold;
+    //DIPOLAR_BARNES_HUT always goes through the refreshed field, smaller dipolar_theta is more accurate
+    dipolar_method dipolar;
+    double dipolar_theta;
+
+    //row slabs on several devices of the context, each with its own queue. slab_devices holds one device index per
+    //slab (NULL takes devices 0..n_slabs-1). halos are slab_halo rows wide and exchanged every slab_halo steps.
+    //n_slabs <= 1 keeps the single queue, runs with the dipolar field always do
+    uint64_t n_slabs;
+    const uint64_t *slab_devices;
+    uint64_t slab_halo;
 
     unsigned int interval_for_information;
+    //INFO_* mask of what integrate_info.dat holds, the kernels are compiled for it by integrate_compile_augment
+    uint64_t observables;
     unsigned int interval_for_raw_grid;
+    //raw frames per bank, one device copy each and one read back (and fwrite) per bank
+    uint64_t raw_ring_frames;
     unsigned int interval_for_rgb_grid;
     unsigned int interval_for_cluster;
+    //how the rgb frames are written under output_path, video_file_name(rgb_video.format)
+    video_params rgb_video;
 
     const char *current_func;
     const char *field_func;
     const char *temperature_func;
     const char *compile_augment;
+    //NULL opens a device and compiles for this run only, see gpu_session_open
+    gpu_session *session;
     const char *output_path;
+    bool profile_trace; //only with PROFILING, writes output_path/trace.json for chrome://tracing
 
     bool do_cluster;
     double(*cluster_metric)(grid*, uint64_t, uint64_t, uint64_t, uint64_t, void*);
@@ -36,17 +77,80 @@ typedef struct {
     uint64_t cluster_min_pts;
 } integrate_params;
 
+//interior rows [row0, row0 + rows) of the lattice plus halo rows on the sides that have a neighbour
 typedef struct {
+    //copies of the context's gpu_cl with the slab queues, kernels are synced from the context before use
+    gpu_cl gpu;
+    gpu_cl transfer;
+
+    uint64_t row0;
+    uint64_t rows;
+    //0 at an open edge of the lattice, apply_pbc handles those rows like on a single device
+    uint64_t halo_low;
+    uint64_t halo_high;
+    grid_info gi;
+    uint64_t global;
+
+    cl_mem gp_gpu;
+    cl_mem m_gpu;
+    cl_mem swap_gpu;
+    cl_mem step_gpu;
+    cl_mem info_gpu;
+    uint64_t step_id;
+    uint64_t advance_id;
+    uint64_t info_id;
+
+    //first and last halo rows of the interior, sent to the neighbours
+    v3d *band_low;
+    v3d *band_high;
+    cl_event reads[2];
+    cl_event writes[2];
+    uint64_t n_writes;
+} integrate_slab;
+
+struct integrate_context;
+typedef struct integrate_snapshot integrate_snapshot;
+//runs on the host once the snapshot reached it, in the order the snapshots were taken
+typedef void (*integrate_snapshot_consumer)(struct integrate_context *ctx, integrate_snapshot *s);
+
+//lattice for the clusters (and its hsl render) copied on the device at an output step, then read back on the
+//transfer queue while the following steps run
+struct integrate_snapshot {
+    cl_mem m_gpu;
+    cl_mem rgb_gpu;
+    v3d *m;
+    RGBA32 *rgb;
+    //last read of the snapshot, NULL while the slot is free
+    cl_event done;
+    uint64_t step;
+    double time;
+    integrate_snapshot_consumer consumers[3];
+    uint64_t n_consumers;
+};
+
+//frames lattices of m captured on the device at raw output steps
+typedef struct {
+    cl_mem m_gpu;
+    //a view of m_gpu with zero_copy while the read is pending
+    v3d *m;
+    uint64_t frames;
+    //read of the bank, NULL while it fills
+    cl_event done;
+} integrate_raw_bank;
+
+typedef struct integrate_context {
     grid *g;
     gpu_cl *gpu;
 
     integrate_params params;
     double time;
+    double time0;
     uint64_t integrate_step;
 
     cl_mem swap_gpu;
+    cl_mem step_gpu;
     uint64_t step_id;
-    uint64_t exchange_id;
+    uint64_t advance_id;
     uint64_t global;
     uint64_t local;
 
@@ -54,24 +158,74 @@ typedef struct {
     FILE *integrate_evolution;
     FILE *clusters;
 
-    information_packed *info;
+    //info_doubles per site, the fields of params.observables packed in INFO_FIELDS order
+    double *info;
+    uint64_t info_doubles;
     cl_mem info_gpu;
     uint64_t info_id;
+    //gpu_step plus the information of the step summed per work group into info_gpu, single device runs without
+    //multirate dipolar use it on information steps instead of gpu_step and extract_info
+    uint64_t step_info_id;
 
-    RGBA32 *rgb;
-    cl_mem rgb_gpu;
     uint64_t render_id;
+    //the device shares the host memory, info and snapshots are mapped instead of read
+    bool zero_copy;
+    //copy of gpu with its own queue, only reads go there
+    gpu_cl transfer;
+    integrate_snapshot snapshots[INTEGRATE_SNAPSHOTS];
+    uint64_t snapshot_next;
+    //the rgb frames are encoded on its threads
+    video_writer *rgb_video;
+    integrate_raw_bank raw_banks[INTEGRATE_RAW_BANKS];
+    uint64_t raw_bank;
+    uint64_t raw_ring_frames;
+
+    bool dipolar_multirate;
+    uint64_t dipolar_last_refresh;
+    uint64_t dipolar_refreshes;
+    cl_mem dipolar_cache_gpu;
+    cl_mem dipolar_reference_gpu;
+    cl_mem dipolar_drift_gpu;
+    double *dipolar_drift;
+    uint64_t dipolar_refresh_id;
+    uint64_t dipolar_drift_id;
+
+    cl_mem dipolar_nodes_gpu;
+    int dipolar_top_level;
+    uint64_t dipolar_level_cells[DIPOLAR_TREE_MAX_LEVELS];
+    uint64_t dipolar_leaves_id;
+    uint64_t dipolar_level_id;
+    uint64_t dipolar_tree_id;
+
+    integrate_slab *slabs;
+    uint64_t n_slabs;
+    uint64_t slab_halo;
+    //steps since the halos were filled, the valid rows of each slab shrink by one per step
+    uint64_t slab_phase;
 } integrate_context;
 
 integrate_context integrate_context_init(grid *grid, gpu_cl *gpu, integrate_params dt);
 void integrate_context_close(integrate_context *ctx);
 void integrate_context_read_grid(integrate_context *ctx);
+void integrate_context_sync_grid(integrate_context *ctx);
+//waits for the snapshots in flight and runs their consumers
+void integrate_context_flush_output(integrate_context *ctx);
 
 integrate_params integrate_params_init(void);
 void integrate(grid *g, integrate_params params);
 
 void integrate_step(integrate_context *ctx);
+void integrate_run_steps(integrate_context *ctx, uint64_t n);
 void integrate_exchange_grids(integrate_context *ctx);
 information_packed integrate_get_info(integrate_context *ctx);
+information_packed integrate_sum_info(const double *packed, uint64_t n, uint64_t observables, uint64_t sites);
+information_packed integrate_unpack_info(const double *packed, uint64_t observables);
+uint64_t integrate_info_doubles(uint64_t observables);
+void integrate_print_info_header(FILE *f, uint64_t observables);
+void integrate_print_info(FILE *f, uint64_t observables, double time, information_packed info);
+//params.compile_augment plus the INFO_OBSERVABLES of params.observables, free it with mfree
+char *integrate_compile_augment(integrate_params params);
+//the observables the program of gpu was compiled for, a mismatch with wanted is logged
+uint64_t integrate_kernel_observables(gpu_cl *gpu, uint64_t wanted);
 
 #endif
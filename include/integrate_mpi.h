@@ -0,0 +1,99 @@
+#ifndef __INTEGRATE_MPI_H
+#define __INTEGRATE_MPI_H
+
+#include <stdint.h>
+
+//rows x cols of ranks with the shortest block boundaries for a rows x cols lattice, dims[0] splits the rows
+void integrate_mpi_split(uint64_t n_ranks, unsigned int rows, unsigned int cols, int *dims);
+
+//only with -DUSE_MPI (ATOMISTIC_MPI=1 ./build.sh), the program calls MPI_Init before and MPI_Finalize after
+#ifdef USE_MPI
+
+#include <mpi.h>
+#include <stdio.h>
+
+#include "integrate.h"
+
+//block [row0, row0 + rows) x [col0, col0 + cols) of the global lattice, owned by this rank
+typedef struct {
+    MPI_Comm comm;
+    int rank;
+    int n_ranks;
+    //rank among the ones on this node, picks the device
+    int local_rank;
+    int dims[2];
+    int coords[2];
+
+    grid_info global;
+    uint64_t row0;
+    uint64_t col0;
+    uint64_t rows;
+    uint64_t cols;
+} integrate_mpi_layout;
+
+typedef struct {
+    grid *g;
+    gpu_cl *gpu;
+    integrate_mpi_layout layout;
+    integrate_params params;
+
+    //block plus halos, a side without a neighbour (open edge) has none
+    grid_info gi;
+    uint64_t halo;
+    uint64_t halo_rows[2];
+    uint64_t halo_cols[2];
+    //low and high neighbour along the rows, then along the cols
+    int neighbours[4];
+    //steps since the halos were filled
+    uint64_t phase;
+    //queue of the session when this rank moved to another device of it
+    cl_command_queue session_queue;
+    cl_device_id session_device;
+
+    cl_mem gp_gpu;
+    cl_mem m_gpu;
+    cl_mem swap_gpu;
+    cl_mem step_gpu;
+    cl_mem info_gpu;
+    cl_mem placeholder_gpu;
+    uint64_t step_id;
+    uint64_t advance_id;
+    uint64_t info_id;
+    uint64_t global;
+    uint64_t local;
+
+    void *send[2];
+    void *recv[2];
+    //info_doubles per site, see integrate_context
+    double *info;
+    uint64_t info_doubles;
+
+    double time;
+    double time0;
+    uint64_t integrate_step;
+
+    //only rank 0 writes the information
+    FILE *integrate_info;
+    MPI_File evolution;
+    MPI_Offset evolution_offset;
+    MPI_Datatype site_v3d;
+    MPI_Datatype block_v3d;
+    MPI_Datatype site_gp;
+    MPI_Datatype block_gp;
+} integrate_mpi_context;
+
+integrate_mpi_layout integrate_mpi_layout_init(unsigned int rows, unsigned int cols, pbc_rules pbc);
+void integrate_mpi_layout_free(integrate_mpi_layout *layout);
+
+//g is this rank's block, layout.rows x layout.cols, with the sites in local coordinates
+integrate_mpi_context integrate_mpi_context_init(grid *g, gpu_cl *gpu, integrate_mpi_layout layout, integrate_params params);
+void integrate_mpi_context_close(integrate_mpi_context *ctx);
+void integrate_mpi_run_steps(integrate_mpi_context *ctx, uint64_t n);
+information_packed integrate_mpi_get_info(integrate_mpi_context *ctx);
+void integrate_mpi_read_grid(integrate_mpi_context *ctx);
+
+void integrate_mpi(grid *g, integrate_mpi_layout layout, integrate_params params);
+
+#endif
+
+#endif
@@ -1,8 +1,18 @@
 #ifndef __KERNEL_FUNCS_H
 #define __KERNEL_FUNCS_H
+#include <stdint.h>
 #include "v3d.h"
 
-char *fill_functions_on_kernel(const char *current_augment, const char *field_augment, const char *temperature_augment, const char *kernel_augment);
+//Physics terms that are compiled into the kernel. Terms that are not set are elided with #ifdef
+typedef enum {
+    KERNEL_TERM_TEMPERATURE = 1 << 0, //HAS_TEMPERATURE
+    KERNEL_TERM_STT = 1 << 1, //HAS_STT
+    KERNEL_TERM_SHE = 1 << 2, //HAS_SHE
+    KERNEL_TERM_CUBIC = 1 << 3, //HAS_CUBIC
+} kernel_term;
+
+uint64_t kernel_terms_from_functions(const char *current_augment, const char *temperature_augment);
+char *fill_functions_on_kernel(const char *current_augment, const char *field_augment, const char *temperature_augment, const char *kernel_augment, uint64_t grid_terms);
 char *fill_compilation_params(const char *compilation, const char *compilation_augment);
 
 char *create_current_stt_dc(double jx, double jy, double beta);
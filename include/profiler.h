@@ -12,6 +12,7 @@ typedef struct PROFILER(elem) {
     char *name;
     double time_start, time_end;
     double interval;
+    double min, max;
     struct PROFILER(elem)* next;
     uint64_t count;
 } PROFILER(elem);
@@ -20,6 +21,15 @@ bool profiler_start_measure(const char* name);
 void profiler_end_measure(const char* name);
 void profiler_print_measures(FILE *file);
 double profiler_get_sec();
+
+//host phases of the simulation loop, compiled out unless PROFILING is defined
+#ifdef PROFILING
+#define PROFILER_PHASE_START(name) profiler_start_measure(name)
+#define PROFILER_PHASE_END(name) profiler_end_measure(name)
+#else
+#define PROFILER_PHASE_START(name)
+#define PROFILER_PHASE_END(name)
+#endif
 #endif //__PROFILER_H
 
 
@@ -156,7 +166,12 @@ void profiler_end_measure(const char* name) {
     while (head) {
       if (strcmp(head->name, name) == 0) {
           head->time_end = profiler_get_sec();
-          head->interval += head->time_end - head->time_start;
+          double interval = head->time_end - head->time_start;
+          head->interval += interval;
+          if (head->count == 1 || interval < head->min)
+              head->min = interval;
+          if (interval > head->max)
+              head->max = interval;
           break;
       }
           head = head->next;
@@ -177,7 +192,8 @@ void profiler_print_measures(FILE *file) {
         if (!head->name) continue;
 
         while (head) {
-            fprintf(file, "[ %s ] -> %.9e sec\n", head->name, head->interval / head->count);
+            fprintf(file, "[ %s ] -> %.9e sec (count %llu, total %.9e sec, min %.9e sec, max %.9e sec)\n", head->name, head->interval / head->count,
+                    (unsigned long long)head->count, head->interval, head->min, head->max);
             head = head->next;
         }
 
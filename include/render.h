@@ -2,6 +2,7 @@
 #define __RENDER_H
 #include <stdint.h>
 #include <stdbool.h>
+#include <stdatomic.h>
 #include "colors.h"
 
 
@@ -18,7 +19,25 @@ void window_poll(void);
 bool window_key_pressed(char c);
 void window_render(void);
 void window_draw_from_bytes(RGBA32 *bytes, int x, int y, int width, int height);
+//stretches a width x height image over the whole window, nearest pixel or bilinear when linear
+void window_draw_scaled(RGBA32 *bytes, int width, int height, bool linear);
 int window_width(void);
 int window_height(void);
 
+typedef struct render_thread render_thread;
+//runs f(data) on a new thread, the window stays with the thread that opened it
+render_thread *render_thread_start(void *(*f)(void *), void *data);
+void render_thread_join(render_thread *t);
+void render_sleep(double seconds);
+
+//lock usable as a static, RENDER_LOCK_INIT. waiters yield and then sleep, so it can be held for long
+typedef atomic_flag render_lock;
+#define RENDER_LOCK_INIT ATOMIC_FLAG_INIT
+void render_lock_acquire(render_lock *l);
+void render_lock_release(render_lock *l);
+
+//read only view of the whole file, NULL when it can not be mapped
+const void *render_map_file(const char *path, uint64_t *size);
+void render_unmap_file(const void *data, uint64_t size);
+
 #endif
@@ -0,0 +1,39 @@
+#ifndef __VIDEO_H
+#define __VIDEO_H
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "colors.h"
+
+typedef enum {
+    //one png per frame, path_<number>.png, what integrate always wrote
+    VIDEO_PNG_FRAMES = 0,
+    //every frame in a single file of concatenated pngs, ffmpeg -f image2pipe -i path reads it
+    VIDEO_PNG = 1,
+    //uncompressed YUV4MPEG2 4:4:4, nothing to compress so the cheapest to write but the biggest
+    VIDEO_Y4M = 2,
+} video_format;
+
+typedef struct {
+    video_format format;
+    //only written in the y4m header
+    unsigned int fps;
+    //zlib level of the pngs, 1 is the fastest, stb's default is 8
+    int png_level;
+    //frames encoded at once, each on its own thread, while the caller fills the next as many
+    unsigned int threads;
+} video_params;
+
+typedef struct video_writer video_writer;
+
+video_params video_params_init(void);
+//file name of the format under a directory, the prefix with VIDEO_PNG_FRAMES
+const char *video_file_name(video_format format);
+//width x height frames into path, the prefix of the files with VIDEO_PNG_FRAMES
+video_writer *video_writer_open(const char *path, unsigned int width, unsigned int height, video_params params);
+//copies the frame, it is encoded and written in order on background threads. number only names VIDEO_PNG_FRAMES files
+void video_writer_push(video_writer *v, const RGBA32 *rgba, uint64_t number);
+//waits for the frames left and closes the file
+void video_writer_close(video_writer *v);
+
+#endif
@@ -3,106 +3,77 @@
 #include "grid_types.h"
 #include "simulation_funcs.h"
 
-kernel void gpu_step(GLOBAL grid_site_params *gs, GLOBAL v3d *input, GLOBAL v3d *out, double dt, double time, grid_info gi) {
-    const size_t id = get_global_id(0);
-
-    if (id >= (gi.rows * gi.cols))
-        return;
-
-    int col = id % gi.cols;
-    int row = id / gi.cols;
-
-    parameters param = (parameters){};
-    param.rows = gi.rows;
-    param.cols = gi.cols;
-    param.gs = gs[id];
-    param.m = apply_pbc(input, gi.pbc, row, col, gi.rows, gi.cols);
-    param.neigh.left = apply_pbc(input, gi.pbc, row, col - 1, gi.rows, gi.cols);
-    param.neigh.right = apply_pbc(input, gi.pbc, row, col + 1, gi.rows, gi.cols);
-    param.neigh.up = apply_pbc(input, gi.pbc, row + 1, col, gi.rows, gi.cols);
-    param.neigh.down = apply_pbc(input, gi.pbc, row - 1, col, gi.rows, gi.cols);
-    param.time = time;
+//lattice and render kernels run on a 2D range: dimension 0 walks the columns, so a row stays contiguous in memory
+//and a tile of rows keeps the up/down neighbours inside the work group
+
+//next value of the site at row, col. param comes in with the dipolar field set and leaves holding the site and
+//its neighbours, which is all gpu_step_info needs for the information of the step
+v3d step_site(GLOBAL grid_site_params *gs, GLOBAL v3d *input, double dt, double time, grid_info gi, int method, int row, int col, parameters *param) {
+    const size_t id = (size_t)row * gi.cols + col;
+    param->rows = gi.rows;
+    param->cols = gi.cols;
+    param->gs = gs[id];
+    param->m = apply_pbc(input, gi.pbc, row, col, gi.rows, gi.cols);
+    param->neigh.left = apply_pbc(input, gi.pbc, row, col - 1, gi.rows, gi.cols);
+    param->neigh.right = apply_pbc(input, gi.pbc, row, col + 1, gi.rows, gi.cols);
+    param->neigh.up = apply_pbc(input, gi.pbc, row + 1, col, gi.rows, gi.cols);
+    param->neigh.down = apply_pbc(input, gi.pbc, row - 1, col, gi.rows, gi.cols);
+    param->time = time;
     tyche_i_state state;
     int seed = *((int*)(&time));
     seed = seed << 16;
-    tyche_i_seed(&state, seed + id);
-    param.state = &state;
+    //seeded by the lattice position, not by id, otherwise sites at the same place of two slabs draw the same noise
+    tyche_i_seed(&state, seed + param->gs.row * gi.cols + param->gs.col);
+    param->state = &state;
 
-#ifdef INCLUDE_DIPOLAR
-    param.dipolar_field = v3d_s(0.0);
-    for (int dr = -param.rows / 2; dr < param.rows / 2; ++dr) {
-        double dy = dr * param.gs.lattice;
-        for (int dc = -param.cols / 2; dc < param.cols / 2; ++dc) {
-            if (dr == 0 && dc == 0)
-                continue;
-            double dx = dc * param.gs.lattice;
-            double r_ij_ = sqrt(dx * dx + dy * dy);
-            v3d r_ij = v3d_normalize(v3d_c(dx, dy, 0));
-            v3d mj;
-            grid_site_params gj;
-            apply_pbc_complete(gs, input, &mj, &gj, gi.pbc, row + dr, col + dc, param.rows, param.cols);
-            double factor = -MU_0 * param.gs.mu * gj.mu / (4.0 * M_PI);
-            v3d interaction = v3d_scalar(r_ij, 3.0 * v3d_dot(mj, r_ij));
-            interaction = v3d_sub(interaction, mj);
-            interaction = v3d_scalar(interaction, factor / (r_ij_ * r_ij_ * r_ij_));
-            param.dipolar_field = v3d_sum(param.dipolar_field, interaction);
-        }
+#ifdef HAS_TEMPERATURE
+    double temperature = generate_temperature(param->gs, param->time);
+    if (!CLOSE_ENOUGH(temperature, 0.0, EPS)) {
+        param->temperature_effect = v3d_scalar(v3d_normalize(normal_distribution_v3d(param->state)),
+                sqrt(2.0 * param->gs.alpha * KB * temperature / (param->gs.gamma * param->gs.mu * dt)));
     }
 #endif
 
-    double temperature = generate_temperature(param.gs, param.time);
-    if (!CLOSE_ENOUGH(temperature, 0.0, EPS)) {
-        param.temperature_effect = v3d_scalar(v3d_normalize(v3d_c(normal_distribution(param.state), normal_distribution(param.state), normal_distribution(param.state))),
-                sqrt(2.0 * param.gs.alpha * KB * temperature / (param.gs.gamma * param.gs.mu * dt)));
+    v3d ret;
+    switch (method) {
+        case INTEGRATE_MIDPOINT:
+            ret = param->gs.pin.pinned? param->gs.pin.dir: step_llg_midpoint(*param, dt);
+            break;
+        case INTEGRATE_RK4:
+        default:
+            ret = v3d_normalize(param->gs.pin.pinned? param->gs.pin.dir: v3d_sum(param->m, step_llg(*param, dt)));
+            break;
     }
-
-    out[id] = v3d_normalize(param.gs.pin.pinned? param.gs.pin.dir: v3d_sum(param.m, step_llg(param, dt)));
+    param->state = NULL;
+    return ret;
 }
 
-kernel void extract_info(GLOBAL grid_site_params *gs, GLOBAL v3d *m0, GLOBAL v3d *m1, GLOBAL information_packed *info, double dt, double time, grid_info gi) {
-    size_t id = get_global_id(0);
-
-    if (id >= (gi.rows * gi.cols))
-        return;
-
-    int col = id % gi.cols;
-    int row = id / gi.cols;
-
-    parameters param;
-    param.rows = gi.rows;
-    param.cols = gi.cols;
-    param.gs = gs[id];
-    param.m = m0[id];
-    v3d dm = v3d_sub(m1[id], param.m);
-    param.neigh.left = apply_pbc(m0, gi.pbc, row, col - 1, gi.rows, gi.cols);
-    param.neigh.right = apply_pbc(m0, gi.pbc, row, col + 1, gi.rows, gi.cols);
-    param.neigh.up = apply_pbc(m0, gi.pbc, row + 1, col, gi.rows, gi.cols);
-    param.neigh.down = apply_pbc(m0, gi.pbc, row - 1, col, gi.rows, gi.cols);
-    param.time = time;
-#ifdef INCLUDE_DIPOLAR
-    param.dipolar_energy = 0.0;
-    for (int dr = -param.rows / 2; dr < param.rows / 2; ++dr) {
-        double dy = dr * param.gs.lattice;
-        for (int dc = -param.cols / 2; dc < param.cols / 2; ++dc) {
-            if (dr == 0 && dc == 0)
-                continue;
-            double dx = dc * param.gs.lattice;
-            double r_ij_ = sqrt(dx * dx + dy * dy);
-            v3d r_ij = v3d_normalize(v3d_c(dx, dy, 0));
+//selected fields of information_packed per site or per work group, INFO_FIELDS gives the order
+#define INFO_KERNEL_COUNT(bits, field) + ((INFO_OBSERVABLES & (bits))? 1: 0)
+#define INFO_PACKED_DOUBLES (0 INFO_FIELDS(INFO_KERNEL_COUNT))
 
-            v3d mj;
-            grid_site_params gj;
-            apply_pbc_complete(gs, m0, &mj, &gj, gi.pbc, row + dr, col + dc, param.rows, param.cols);
+void info_pack(information_packed info, GLOBAL double *out) {
+    int n = 0;
+#define INFO_PACK(bits, field) if (INFO_OBSERVABLES & (bits)) out[n++] = info.field;
+    INFO_FIELDS(INFO_PACK)
+#undef INFO_PACK
+    UNUSED(n);
+}
 
-            double interaction = -MU_0 * param.gs.mu * gj.mu / (4.0 * M_PI);
-            interaction *= (3.0 * v3d_dot(param.m, r_ij) - v3d_dot(param.m, mj)) / (r_ij_ * r_ij_ * r_ij_);
-            param.dipolar_energy += interaction;
-        }
-    }
-#endif
+//what the host reads to know which observables the program computes
+kernel void info_observables(GLOBAL ulong *out) {
+    if (get_global_id(0) == 0)
+        out[0] = INFO_OBSERVABLES;
+}
 
+//everything of information_packed but the dipolar cache error, param.dipolar_energy has to be set already.
+//only the observables of INFO_OBSERVABLES are computed
+information_packed site_info(parameters param, v3d m1, double dt) {
     information_packed local_info = (information_packed){};
+    UNUSED(m1);
+    UNUSED(dt);
 
+#if INFO_OBSERVABLES & INFO_ENERGY
     local_info.exchange_energy = exchange_energy(param);
     local_info.dm_energy = dm_energy(param);
     local_info.field_energy = field_energy(param);
@@ -112,24 +83,179 @@ kernel void extract_info(GLOBAL grid_site_params *gs, GLOBAL v3d *m0, GLOBAL v3d
     local_info.dipolar_energy = param.dipolar_energy;
 #endif
     local_info.energy = 0.5 * local_info.exchange_energy + 0.5 * local_info.dm_energy + local_info.field_energy + local_info.anisotropy_energy + local_info.cubic_energy + 0.5 * local_info.dipolar_energy;
+#endif
+#if INFO_OBSERVABLES & (INFO_CHARGE | INFO_CHARGE_CENTER)
     local_info.charge_finite = charge_finite(param.m, param.neigh.left, param.neigh.right, param.neigh.up, param.neigh.down);
-    local_info.charge_lattice = charge_lattice(param.m, param.neigh.left, param.neigh.right, param.neigh.up, param.neigh.down);
     local_info.abs_charge_finite = fabs(local_info.charge_finite);
+#endif
+#if INFO_OBSERVABLES & INFO_CHARGE
+    local_info.charge_lattice = charge_lattice(param.m, param.neigh.left, param.neigh.right, param.neigh.up, param.neigh.down);
     local_info.abs_charge_lattice = fabs(local_info.charge_lattice);
+#endif
+#if INFO_OBSERVABLES & INFO_AVG_M
     local_info.avg_m = param.m;
+#endif
+#if INFO_OBSERVABLES & INFO_ELECTRIC_FIELD
+    v3d dm = v3d_sub(m1, param.m);
     local_info.electric_field = v3d_scalar(emergent_electric_field(param.m, param.neigh.left, param.neigh.right, param.neigh.up, param.neigh.down, v3d_scalar(dm, 1.0 / dt), param.gs.lattice, param.gs.lattice), param.gs.lattice * param.gs.lattice);
+#endif
+#if INFO_OBSERVABLES & INFO_MAGNETIC_FIELD
     local_info.magnetic_field_finite = emergent_magnetic_field_finite(param.m, param.neigh.left, param.neigh.right, param.neigh.up, param.neigh.down);
     local_info.magnetic_field_lattice = emergent_magnetic_field_lattice(param.m, param.neigh.left, param.neigh.right, param.neigh.up, param.neigh.down);
-    local_info.charge_center_x = col * param.gs.lattice * local_info.charge_finite;
-    local_info.charge_center_y = row * param.gs.lattice * local_info.charge_finite;
-    local_info.abs_charge_center_x = col * param.gs.lattice * local_info.abs_charge_finite;
-    local_info.abs_charge_center_y = row * param.gs.lattice * local_info.abs_charge_finite;
+#endif
+#if INFO_OBSERVABLES & INFO_CHARGE_CENTER
+    local_info.charge_center_x = param.gs.col * param.gs.lattice * local_info.charge_finite;
+    local_info.charge_center_y = param.gs.row * param.gs.lattice * local_info.charge_finite;
+    local_info.abs_charge_center_x = param.gs.col * param.gs.lattice * local_info.abs_charge_finite;
+    local_info.abs_charge_center_y = param.gs.row * param.gs.lattice * local_info.abs_charge_finite;
+#endif
+#if INFO_OBSERVABLES & INFO_D_TENSOR
     v3d dm_dx = v3d_scalar(v3d_sub(param.neigh.right, param.neigh.left), 0.5);
     v3d dm_dy = v3d_scalar(v3d_sub(param.neigh.up, param.neigh.down), 0.5);
     local_info.D_xx = v3d_dot(dm_dx, dm_dx);
     local_info.D_yy = v3d_dot(dm_dy, dm_dy);
     local_info.D_xy = v3d_dot(dm_dx, dm_dy);
-    info[id] = local_info;
+#endif
+    return local_info;
+}
+
+//sum of v over the work group, every item of it has to call it
+double group_sum(LOCAL double *scratch, double v, size_t lid, size_t group_size) {
+    size_t top = 1;
+    while (top < group_size)
+        top *= 2;
+
+    scratch[lid] = v;
+    for (size_t stride = top / 2; stride > 0; stride /= 2) {
+        barrier(CLK_LOCAL_MEM_FENCE);
+        if (lid < stride && lid + stride < group_size)
+            scratch[lid] += scratch[lid + stride];
+    }
+    barrier(CLK_LOCAL_MEM_FENCE);
+    double ret = scratch[0];
+    barrier(CLK_LOCAL_MEM_FENCE);
+    return ret;
+}
+
+//time is t0 + step * dt with the step counter advanced on the device by advance_step, so steps can be queued without touching arguments
+kernel void gpu_step(GLOBAL grid_site_params *gs, GLOBAL v3d *input, GLOBAL v3d *out, double dt, double t0, grid_info gi, int method,
+                     GLOBAL dipolar_tensor *dipolar_table, GLOBAL v3d *dipolar_cache, int dipolar_cached, GLOBAL ulong *step) {
+    const int col = get_global_id(0);
+    const int row = get_global_id(1);
+    const int active = row < gi.rows && col < gi.cols;
+    const size_t id = (size_t)row * gi.cols + col;
+    const double time = t0 + step[0] * dt;
+
+#ifdef INCLUDE_DIPOLAR
+    LOCAL dipolar_tensor dipolar_tile[DIPOLAR_TILE];
+    v3d dipolar;
+    //dipolar_cached is uniform across the launch, so the barriers inside dipolar_sum are still reached by the whole group
+    if (dipolar_cached)
+        dipolar = active? dipolar_cache[id]: v3d_s(0.0);
+    else
+        dipolar = dipolar_sum(gs, input, dipolar_table, dipolar_tile, gi, row, col, active);
+#else
+    UNUSED(dipolar_table);
+    UNUSED(dipolar_cache);
+    UNUSED(dipolar_cached);
+#endif
+
+    if (!active)
+        return;
+
+    parameters param = (parameters){};
+#ifdef INCLUDE_DIPOLAR
+    param.dipolar_field = dipolar_field_from_sum(dipolar, gs[id]);
+#endif
+    out[id] = step_site(gs, input, dt, time, gi, method, row, col, &param);
+}
+
+//gpu_step that also sums the information of the step over each work group into the packed partial[group], for the price of
+//one reduction instead of an extract_info launch that reloads everything and writes a struct per site.
+//scratch holds a double per work item of the largest group the kernel allows, since the host tunes its own tile for it.
+//it is only run without a dipolar cache
+kernel void gpu_step_info(GLOBAL grid_site_params *gs, GLOBAL v3d *input, GLOBAL v3d *out, double dt, double t0, grid_info gi, int method,
+                          GLOBAL dipolar_tensor *dipolar_table, GLOBAL ulong *step, LOCAL double *scratch, GLOBAL double *partial) {
+    const int col = get_global_id(0);
+    const int row = get_global_id(1);
+    const int active = row < gi.rows && col < gi.cols;
+    const size_t id = (size_t)row * gi.cols + col;
+    const double time = t0 + step[0] * dt;
+    const size_t lid = get_local_id(1) * get_local_size(0) + get_local_id(0);
+    const size_t group_size = get_local_size(0) * get_local_size(1);
+
+#ifdef INCLUDE_DIPOLAR
+    LOCAL dipolar_tensor dipolar_tile[DIPOLAR_TILE];
+    v3d dipolar = dipolar_sum(gs, input, dipolar_table, dipolar_tile, gi, row, col, active);
+#else
+    UNUSED(dipolar_table);
+#endif
+
+    //no early return, every item takes part in the reduction
+    information_packed info = (information_packed){};
+    if (active) {
+        parameters param = (parameters){};
+#ifdef INCLUDE_DIPOLAR
+        param.dipolar_field = dipolar_field_from_sum(dipolar, gs[id]);
+        param.dipolar_energy = v3d_dot(apply_pbc(input, gi.pbc, row, col, gi.rows, gi.cols), param.dipolar_field);
+#endif
+        v3d next = step_site(gs, input, dt, time, gi, method, row, col, &param);
+        out[id] = next;
+        info = site_info(param, next, dt);
+    }
+
+    //field by field through one double per item, the whole struct per item would not fit local memory
+#define INFO_REDUCE(bits, field) if (INFO_OBSERVABLES & (bits)) info.field = group_sum(scratch, info.field, lid, group_size);
+    INFO_FIELDS(INFO_REDUCE)
+#undef INFO_REDUCE
+
+    if (lid == 0)
+        info_pack(info, partial + (get_group_id(1) * get_num_groups(0) + get_group_id(0)) * INFO_PACKED_DOUBLES);
+}
+
+kernel void extract_info(GLOBAL grid_site_params *gs, GLOBAL v3d *m0, GLOBAL v3d *m1, GLOBAL double *info, double dt, double time, grid_info gi,
+                         GLOBAL dipolar_tensor *dipolar_table, GLOBAL v3d *dipolar_cache, int dipolar_cached) {
+    const int col = get_global_id(0);
+    const int row = get_global_id(1);
+    const int active = row < gi.rows && col < gi.cols;
+    const size_t id = (size_t)row * gi.cols + col;
+
+#ifdef INCLUDE_DIPOLAR
+    LOCAL dipolar_tensor dipolar_tile[DIPOLAR_TILE];
+    v3d dipolar = dipolar_sum(gs, m0, dipolar_table, dipolar_tile, gi, row, col, active);
+#else
+    UNUSED(dipolar_table);
+    UNUSED(dipolar_cache);
+    UNUSED(dipolar_cached);
+#endif
+
+    if (!active)
+        return;
+
+    parameters param = (parameters){};
+    param.rows = gi.rows;
+    param.cols = gi.cols;
+    param.gs = gs[id];
+    param.m = m0[id];
+    param.neigh.left = apply_pbc(m0, gi.pbc, row, col - 1, gi.rows, gi.cols);
+    param.neigh.right = apply_pbc(m0, gi.pbc, row, col + 1, gi.rows, gi.cols);
+    param.neigh.up = apply_pbc(m0, gi.pbc, row + 1, col, gi.rows, gi.cols);
+    param.neigh.down = apply_pbc(m0, gi.pbc, row - 1, col, gi.rows, gi.cols);
+    param.time = time;
+#ifdef INCLUDE_DIPOLAR
+    param.dipolar_energy = v3d_dot(param.m, dipolar_field_from_sum(dipolar, param.gs));
+#endif
+
+    information_packed local_info = site_info(param, m1[id], dt);
+#ifdef INCLUDE_DIPOLAR
+    if ((INFO_OBSERVABLES & INFO_DIPOLAR_ERROR) && dipolar_cached) {
+        v3d fresh = dipolar_field_from_sum(dipolar, param.gs);
+        v3d error = v3d_sub(dipolar_field_from_sum(dipolar_cache[id], param.gs), fresh);
+        local_info.dipolar_cache_error = v3d_dot(error, error);
+        local_info.dipolar_field_norm = v3d_dot(fresh, fresh);
+    }
+#endif
+    info_pack(local_info, info + id * INFO_PACKED_DOUBLES);
 }
 
 kernel void exchange_grid(GLOBAL v3d *to, GLOBAL v3d *from, unsigned int rows, unsigned int cols) {
@@ -138,17 +264,180 @@ kernel void exchange_grid(GLOBAL v3d *to, GLOBAL v3d *from, unsigned int rows, u
         to[id] = from[id];
 }
 
+//exchange_grid that also moves the step counter read by gpu_step, launches on the queue are ordered so no atomics are needed
+kernel void advance_step(GLOBAL v3d *to, GLOBAL v3d *from, GLOBAL ulong *step, unsigned int rows, unsigned int cols) {
+    size_t id = get_global_id(0);
+    if (id == 0)
+        step[0] += 1;
+    if (id < (rows * cols))
+        to[id] = from[id];
+}
+
+//stores the dipolar sum of v for gpu_step to reuse and keeps v as the reference for dipolar_drift
+kernel void dipolar_refresh(GLOBAL grid_site_params *gs, GLOBAL v3d *v, GLOBAL dipolar_tensor *dipolar_table, GLOBAL v3d *cache, GLOBAL v3d *reference, grid_info gi) {
+    const int col = get_global_id(0);
+    const int row = get_global_id(1);
+    const int active = row < gi.rows && col < gi.cols;
+    const size_t id = (size_t)row * gi.cols + col;
+
+#ifdef INCLUDE_DIPOLAR
+    LOCAL dipolar_tensor dipolar_tile[DIPOLAR_TILE];
+    v3d dipolar = dipolar_sum(gs, v, dipolar_table, dipolar_tile, gi, row, col, active);
+#else
+    UNUSED(gs);
+    UNUSED(dipolar_table);
+    UNUSED(row);
+    UNUSED(col);
+    v3d dipolar = v3d_s(0.0);
+#endif
+
+    if (!active)
+        return;
+
+    cache[id] = dipolar;
+    reference[id] = v[id];
+}
+
+//Barnes-Hut: leaves are the sites themselves, the sample is treated as isolated (no images, no boundary spins)
+kernel void dipolar_tree_leaves(GLOBAL grid_site_params *gs, GLOBAL v3d *v, GLOBAL dipolar_node *nodes, GLOBAL v3d *reference, grid_info gi) {
+    size_t id = get_global_id(0);
+
+    if (id >= (gi.rows * gi.cols))
+        return;
+
+    double mu = gs[id].mu;
+    v3d m = v[id];
+    nodes[id] = (dipolar_node){.moment = v3d_scalar(m, mu), .x = id % gi.cols, .y = id / gi.cols, .weight = fabs(mu)};
+    reference[id] = m;
+}
+
+kernel void dipolar_tree_level(GLOBAL dipolar_node *nodes, grid_info gi, int level) {
+    size_t id = get_global_id(0);
+
+    int offsets[DIPOLAR_TREE_MAX_LEVELS], rows[DIPOLAR_TREE_MAX_LEVELS], cols[DIPOLAR_TREE_MAX_LEVELS];
+    dipolar_tree_levels(gi, offsets, rows, cols);
+
+    if (id >= (rows[level] * cols[level]))
+        return;
+
+    int col = id % cols[level];
+    int row = id / cols[level];
+
+    dipolar_node cell = (dipolar_node){};
+    for (int dr = 0; dr < 2; ++dr) {
+        for (int dc = 0; dc < 2; ++dc) {
+            int crow = 2 * row + dr;
+            int ccol = 2 * col + dc;
+            if (crow >= rows[level - 1] || ccol >= cols[level - 1])
+                continue;
+            dipolar_node child = nodes[offsets[level - 1] + crow * cols[level - 1] + ccol];
+            cell.moment = v3d_sum(cell.moment, child.moment);
+            cell.x += child.weight * child.x;
+            cell.y += child.weight * child.y;
+            cell.weight += child.weight;
+        }
+    }
+
+    if (cell.weight > 0.0) {
+        cell.x /= cell.weight;
+        cell.y /= cell.weight;
+    }
+    nodes[offsets[level] + id] = cell;
+}
+
+//a cell of side s seen at distance d is used as a single dipole when s < theta * d, otherwise its children are visited
+kernel void dipolar_tree_field(GLOBAL dipolar_node *nodes, GLOBAL v3d *cache, grid_info gi, double theta) {
+    size_t id = get_global_id(0);
+
+    if (id >= (gi.rows * gi.cols))
+        return;
+
+    int col = id % gi.cols;
+    int row = id / gi.cols;
+
+    int offsets[DIPOLAR_TREE_MAX_LEVELS], rows[DIPOLAR_TREE_MAX_LEVELS], cols[DIPOLAR_TREE_MAX_LEVELS];
+    int top = dipolar_tree_levels(gi, offsets, rows, cols);
+
+    //depth first, each visit pops one cell and pushes at most four
+    int stack[4 * DIPOLAR_TREE_MAX_LEVELS];
+    int sp = 0;
+    stack[sp++] = offsets[top];
+
+    v3d ret = v3d_s(0.0);
+    while (sp > 0) {
+        int index = stack[--sp];
+        int level = top;
+        while (level > 0 && index < offsets[level])
+            level--;
+
+        dipolar_node cell = nodes[index];
+        if (cell.weight <= 0.0)
+            continue;
+
+        int crow = (index - offsets[level]) / cols[level];
+        int ccol = (index - offsets[level]) % cols[level];
+        double dx = cell.x - col;
+        double dy = cell.y - row;
+
+        if (level == 0) {
+            if (crow != row || ccol != col)
+                ret = v3d_sum(ret, dipolar_tensor_apply(dx, dy, cell.moment));
+            continue;
+        }
+
+        double side = 1 << level;
+        int contains = (row >> level) == crow && (col >> level) == ccol;
+        if (!contains && side * side < theta * theta * (dx * dx + dy * dy)) {
+            ret = v3d_sum(ret, dipolar_tensor_apply(dx, dy, cell.moment));
+            continue;
+        }
+
+        for (int dr = 0; dr < 2; ++dr) {
+            for (int dc = 0; dc < 2; ++dc) {
+                int r = 2 * crow + dr;
+                int c = 2 * ccol + dc;
+                if (r < rows[level - 1] && c < cols[level - 1])
+                    stack[sp++] = offsets[level - 1] + r * cols[level - 1] + c;
+            }
+        }
+    }
+
+    cache[id] = ret;
+}
+
+//largest |v - reference| of each work group, the host takes the max over groups (local size must be a power of two)
+kernel void dipolar_drift(GLOBAL v3d *v, GLOBAL v3d *reference, LOCAL double *scratch, GLOBAL double *out, unsigned int rows, unsigned int cols) {
+    size_t id = get_global_id(0);
+    size_t lid = get_local_id(0);
+
+    double drift = 0.0;
+    if (id < (rows * cols)) {
+        v3d d = v3d_sub(v[id], reference[id]);
+        drift = v3d_dot(d, d);
+    }
+    scratch[lid] = drift;
+
+    for (size_t stride = get_local_size(0) / 2; stride > 0; stride /= 2) {
+        barrier(CLK_LOCAL_MEM_FENCE);
+        if (lid < stride && scratch[lid + stride] > scratch[lid])
+            scratch[lid] = scratch[lid + stride];
+    }
+
+    if (lid == 0)
+        out[get_group_id(0)] = sqrt(scratch[0]);
+}
+
 kernel void render_grid_bwr(GLOBAL v3d *v, grid_info gi,
                             GLOBAL RGBA32* rgba, unsigned int width, unsigned int height) {
-    size_t id = get_global_id(0);
+    const int icol = get_global_id(0);
+    const int irow = get_global_id(1);
 
-    if (id >= (width * height))
+    if (icol >= width || irow >= height)
         return;
 
-    int icol = id % width;
-    int irow = id / width;
-    int vcol = (float)icol / width * gi.cols;
-    int vrow = (float)irow / height * gi.rows;
+    const size_t id = (size_t)irow * width + icol;
+    int vcol = (size_t)icol * gi.cols / width;
+    int vrow = (size_t)irow * gi.rows / height;
 
     //rendering inverts the grid, need to invert back
     vrow = gi.rows - 1 - vrow;
@@ -163,15 +452,15 @@ kernel void render_grid_bwr(GLOBAL v3d *v, grid_info gi,
 
 kernel void render_grid_hsl(GLOBAL v3d *v, grid_info gi,
                             GLOBAL RGBA32 *rgba, unsigned int width, unsigned int height) {
-    size_t id = get_global_id(0);
+    const int icol = get_global_id(0);
+    const int irow = get_global_id(1);
 
-    if (id >= (width * height))
+    if (icol >= width || irow >= height)
         return;
 
-    int icol = id % width;
-    int irow = id / width;
-    int vcol = (float)icol / width * gi.cols;
-    int vrow = (float)irow / height * gi.rows;
+    const size_t id = (size_t)irow * width + icol;
+    int vcol = (size_t)icol * gi.cols / width;
+    int vrow = (size_t)irow * gi.rows / height;
 
     //rendering inverts the grid, need to invert back
     vrow = gi.rows - 1 - vrow;
@@ -184,14 +473,43 @@ kernel void render_grid_hsl(GLOBAL v3d *v, grid_info gi,
     rgba[id] = m_to_hsl(m);
 }
 
-kernel void calculate_charge_to_render(GLOBAL v3d *v, grid_info gi, GLOBAL double *out) {
-    size_t id = get_global_id(0);
+//averages the sites of the rows x cols image (one pixel per site) that fall in each of the width x height pixels,
+//for lattices bigger than the window
+kernel void render_downsample(GLOBAL RGBA32 *sites, unsigned int rows, unsigned int cols,
+                              GLOBAL RGBA32 *rgba, unsigned int width, unsigned int height) {
+    const int icol = get_global_id(0);
+    const int irow = get_global_id(1);
 
-    if (id >= (gi.rows * gi.cols))
+    if (icol >= width || irow >= height)
         return;
 
-    int col = id % gi.cols;
-    int row = id / gi.cols;
+    const size_t col0 = (size_t)icol * cols / width;
+    const size_t col1 = ((size_t)icol + 1) * cols / width;
+    const size_t row0 = (size_t)irow * rows / height;
+    const size_t row1 = ((size_t)irow + 1) * rows / height;
+
+    uint r = 0, g = 0, b = 0, a = 0;
+    for (size_t row = row0; row < row1; ++row) {
+        for (size_t col = col0; col < col1; ++col) {
+            RGBA32 c = sites[row * cols + col];
+            r += c.r;
+            g += c.g;
+            b += c.b;
+            a += c.a;
+        }
+    }
+    const uint n = (row1 - row0) * (col1 - col0);
+    rgba[(size_t)irow * width + icol] = (RGBA32){.r = r / n, .g = g / n, .b = b / n, .a = a / n};
+}
+
+kernel void calculate_charge_to_render(GLOBAL v3d *v, grid_info gi, GLOBAL double *out) {
+    const int col = get_global_id(0);
+    const int row = get_global_id(1);
+    const int active = row < gi.rows && col < gi.cols;
+    const size_t id = (size_t)row * gi.cols + col;
+
+    if (!active)
+        return;
 
     v3d m = v[id];
     v3d left = apply_pbc(v, gi.pbc, row, col - 1, gi.rows, gi.cols);
@@ -202,17 +520,65 @@ kernel void calculate_charge_to_render(GLOBAL v3d *v, grid_info gi, GLOBAL doubl
     out[id] = charge_lattice(m, left, right, up, down);
 }
 
-kernel void render_charge(GLOBAL double *input, unsigned int rows, unsigned int cols, double charge_min, double charge_max,
+//the lowest and highest of min_value and max_value over the work group into range[0] and range[1]
+void render_range_group(LOCAL double *lo, LOCAL double *hi, double min_value, double max_value, GLOBAL double *range) {
+    const size_t lid = get_local_id(0);
+    const size_t n = get_local_size(0);
+    size_t top = 1;
+    while (top < n)
+        top *= 2;
+
+    lo[lid] = min_value;
+    hi[lid] = max_value;
+    for (size_t stride = top / 2; stride > 0; stride /= 2) {
+        barrier(CLK_LOCAL_MEM_FENCE);
+        if (lid < stride && lid + stride < n) {
+            lo[lid] = fmin(lo[lid], lo[lid + stride]);
+            hi[lid] = fmax(hi[lid], hi[lid + stride]);
+        }
+    }
+
+    if (lid == 0) {
+        range[0] = lo[0];
+        range[1] = hi[0];
+    }
+}
+
+//colour scale of render_charge and render_energy, a single work group walks the n values so the range never
+//leaves the device
+kernel void render_range(GLOBAL double *values, unsigned int n, LOCAL double *lo, LOCAL double *hi, GLOBAL double *range) {
+    double min_value = INFINITY;
+    double max_value = -INFINITY;
+    for (size_t i = get_local_id(0); i < n; i += get_local_size(0)) {
+        min_value = fmin(min_value, values[i]);
+        max_value = fmax(max_value, values[i]);
+    }
+    render_range_group(lo, hi, min_value, max_value, range);
+}
+
+//same over the lengths of the vectors, for render_electric
+kernel void render_range_norm(GLOBAL v3d *values, unsigned int n, LOCAL double *lo, LOCAL double *hi, GLOBAL double *range) {
+    double min_value = INFINITY;
+    double max_value = -INFINITY;
+    for (size_t i = get_local_id(0); i < n; i += get_local_size(0)) {
+        double d = v3d_dot(values[i], values[i]);
+        min_value = fmin(min_value, d);
+        max_value = fmax(max_value, d);
+    }
+    render_range_group(lo, hi, sqrt(min_value), sqrt(max_value), range);
+}
+
+kernel void render_charge(GLOBAL double *input, unsigned int rows, unsigned int cols, GLOBAL double *range,
                           GLOBAL RGBA32 *rgba, unsigned int width, unsigned int height) {
-    size_t id = get_global_id(0);
+    const int icol = get_global_id(0);
+    const int irow = get_global_id(1);
 
-    if (id >= (width * height))
+    if (icol >= width || irow >= height)
         return;
 
-    int icol = id % width;
-    int irow = id / width;
-    int vcol = (float)icol / width * cols;
-    int vrow = (float)irow / height * rows;
+    const size_t id = (size_t)irow * width + icol;
+    int vcol = (size_t)icol * cols / width;
+    int vrow = (size_t)irow * rows / height;
 
     //rendering inverts the grid, need to invert back
     vrow = rows - 1 - vrow;
@@ -225,21 +591,21 @@ kernel void render_charge(GLOBAL double *input, unsigned int rows, unsigned int
     v3d end = v3d_c(1, 1, 1);
 
     double charge = input[vrow * cols + vcol];
-    charge = (charge - charge_min) / (charge_max - charge_min);
+    charge = (charge - range[0]) / (range[1] - range[0]);
     rgba[id] = linear_mapping(clamp(charge, 0.0, 1.0), start, middle, end);
 }
 
 kernel void render_pinning(GLOBAL grid_site_params *input, unsigned int rows, unsigned int cols,
                           GLOBAL RGBA32 *rgba, unsigned int width, unsigned int height) {
-    size_t id = get_global_id(0);
+    const int icol = get_global_id(0);
+    const int irow = get_global_id(1);
 
-    if (id >= (width * height))
+    if (icol >= width || irow >= height)
         return;
 
-    int icol = id % width;
-    int irow = id / width;
-    int vcol = (float)icol / width * cols;
-    int vrow = (float)irow / height * rows;
+    const size_t id = (size_t)irow * width + icol;
+    int vcol = (size_t)icol * cols / width;
+    int vrow = (size_t)irow * rows / height;
 
     //rendering inverts the grid, need to invert back
     vrow = rows - 1 - vrow;
@@ -251,14 +617,21 @@ kernel void render_pinning(GLOBAL grid_site_params *input, unsigned int rows, un
         rgba[id] = (RGBA32){.a = 0xff, .b = 0, .g = 0xff, .r = 0xff};
 }
 
-kernel void calculate_energy(GLOBAL grid_site_params *gs, GLOBAL v3d *v, grid_info gi, GLOBAL double *out, double time) {
-    size_t id = get_global_id(0);
+kernel void calculate_energy(GLOBAL grid_site_params *gs, GLOBAL v3d *v, grid_info gi, GLOBAL double *out, double time, GLOBAL dipolar_tensor *dipolar_table) {
+    const int col = get_global_id(0);
+    const int row = get_global_id(1);
+    const int active = row < gi.rows && col < gi.cols;
+    const size_t id = (size_t)row * gi.cols + col;
 
-    if (id >= (gi.rows * gi.cols))
-        return;
+#ifdef INCLUDE_DIPOLAR
+    LOCAL dipolar_tensor dipolar_tile[DIPOLAR_TILE];
+    v3d dipolar = dipolar_sum(gs, v, dipolar_table, dipolar_tile, gi, row, col, active);
+#else
+    UNUSED(dipolar_table);
+#endif
 
-    int col = id % gi.cols;
-    int row = id / gi.cols;
+    if (!active)
+        return;
 
     parameters param;
     param.rows = gi.rows;
@@ -272,41 +645,23 @@ kernel void calculate_energy(GLOBAL grid_site_params *gs, GLOBAL v3d *v, grid_in
     param.time = time;
 
 #ifdef INCLUDE_DIPOLAR
-    param.dipolar_energy = 0.0;
-    for (int dr = -param.rows / 2; dr < param.rows / 2; ++dr) {
-        double dy = dr * param.gs.lattice;
-        for (int dc = -param.cols / 2; dc < param.cols / 2; ++dc) {
-            if (dr == 0 && dc == 0)
-                continue;
-            double dx = dc * param.gs.lattice;
-            double r_ij_ = sqrt(dx * dx + dy * dy);
-            v3d r_ij = v3d_normalize(v3d_c(dx, dy, 0));
-
-            v3d mj;
-            grid_site_params gj;
-            apply_pbc_complete(gs, v, &mj, &gj, gi.pbc, row + dr, col + dc, param.rows, param.cols);
-
-            double interaction = -MU_0 * param.gs.mu * gj.mu / (4.0 * M_PI);
-            interaction *= (3.0 * v3d_dot(param.m, r_ij) - v3d_dot(param.m, mj)) / (r_ij_ * r_ij_ * r_ij_);
-            param.dipolar_energy += interaction;
-        }
-    }
+    param.dipolar_energy = v3d_dot(param.m, dipolar_field_from_sum(dipolar, param.gs));
 #endif
 
     out[id] = energy(param);
 }
 
-kernel void render_energy(GLOBAL double *ene, unsigned int rows, unsigned int cols, double energy_min, double energy_max,
+kernel void render_energy(GLOBAL double *ene, unsigned int rows, unsigned int cols, GLOBAL double *range,
                                  GLOBAL RGBA32 *rgba, unsigned int width, unsigned int height) {
-    size_t id = get_global_id(0);
+    const int icol = get_global_id(0);
+    const int irow = get_global_id(1);
 
-    if (id >= (width * height))
+    if (icol >= width || irow >= height)
         return;
 
-    int icol = id % width;
-    int irow = id / width;
-    int vcol = (float)icol / width * cols;
-    int vrow = (float)irow / height * rows;
+    const size_t id = (size_t)irow * width + icol;
+    int vcol = (size_t)icol * cols / width;
+    int vrow = (size_t)irow * rows / height;
 
     //rendering inverts the grid, need to invert back
     vrow = rows - 1 - vrow;
@@ -319,7 +674,7 @@ kernel void render_energy(GLOBAL double *ene, unsigned int rows, unsigned int co
     v3d end = v3d_c(1, 1, 1);
 
     double energy = ene[vrow * cols + vcol];
-    energy = (energy - energy_min) / (energy_max - energy_min);
+    energy = (energy - range[0]) / (range[1] - range[0]);
     rgba[id] = linear_mapping(clamp(energy, 0.0, 1.0), start, middle, end);
 }
 
@@ -349,14 +704,21 @@ kernel void thermal_step_gsa(GLOBAL grid_site_params *gs, GLOBAL v3d *v0, GLOBAL
 //1 -> current
 //2 -> new
 kernel void gradient_descent_step(GLOBAL grid_site_params *gs, GLOBAL v3d *v0, GLOBAL v3d *v1, GLOBAL v3d *v2, grid_info gi,
-                                  double mass, double T, double damping, double restoring, double dt, int seed) {
-    size_t id = get_global_id(0);
+                                  double mass, double T, double damping, double restoring, double dt, int seed, GLOBAL dipolar_tensor *dipolar_table) {
+    const int col = get_global_id(0);
+    const int row = get_global_id(1);
+    const int active = row < gi.rows && col < gi.cols;
+    const size_t id = (size_t)row * gi.cols + col;
 
-    if (id >= (gi.rows * gi.cols))
-        return;
+#ifdef INCLUDE_DIPOLAR
+    LOCAL dipolar_tensor dipolar_tile[DIPOLAR_TILE];
+    v3d dipolar = dipolar_sum(gs, v1, dipolar_table, dipolar_tile, gi, row, col, active);
+#else
+    UNUSED(dipolar_table);
+#endif
 
-    int col = id % gi.cols;
-    int row = id / gi.cols;
+    if (!active)
+        return;
 
     parameters param1 = (parameters){};
     param1.rows = gi.rows;
@@ -370,25 +732,7 @@ kernel void gradient_descent_step(GLOBAL grid_site_params *gs, GLOBAL v3d *v0, G
     param1.neigh.left = apply_pbc(v1, gi.pbc, row, col - 1, gi.rows, gi.cols);
 
 #ifdef INCLUDE_DIPOLAR
-    param1.dipolar_field = v3d_s(0.0);
-    for (int dr = -param1.rows / 2; dr < param1.rows / 2; ++dr) {
-        double dy = dr * param1.gs.lattice;
-        for (int dc = -param1.cols / 2; dc < param1.cols / 2; ++dc) {
-            if (dr == 0 && dc == 0)
-                continue;
-            double dx = dc * param1.gs.lattice;
-            double r_ij_ = sqrt(dx * dx + dy * dy);
-            v3d r_ij = v3d_normalize(v3d_c(dx, dy, 0));
-            v3d mj;
-            grid_site_params gj;
-            apply_pbc_complete(gs, v1, &mj, &gj, gi.pbc, row + dr, col + dc, param1.rows, param1.cols);
-            double factor = -MU_0 * param1.gs.mu * gj.mu / (4.0 * M_PI);
-            v3d interaction = v3d_scalar(r_ij, 3.0 * v3d_dot(mj, r_ij));
-            interaction = v3d_sub(interaction, mj);
-            interaction = v3d_scalar(interaction, factor / (r_ij_ * r_ij_ * r_ij_));
-            param1.dipolar_field = v3d_sum(param1.dipolar_field, interaction);
-        }
-    }
+    param1.dipolar_field = dipolar_field_from_sum(dipolar, param1.gs);
 #endif
 
     v3d v0l = v0[id];
@@ -401,9 +745,7 @@ kernel void gradient_descent_step(GLOBAL grid_site_params *gs, GLOBAL v3d *v0, G
     if (!CLOSE_ENOUGH(T, 0.0, EPS)) {
         tyche_i_state state;
         tyche_i_seed(&state, seed + id);
-        v3d temp = v3d_c(sqrt(T) * normal_distribution(&state),
-                         sqrt(T) * normal_distribution(&state),
-                         sqrt(T) * normal_distribution(&state));
+        v3d temp = v3d_scalar(normal_distribution_v3d(&state), sqrt(T));
         accel = v3d_sum(accel, temp);
     }
     accel = v3d_scalar(accel, 1.0 / mass);
@@ -411,14 +753,14 @@ kernel void gradient_descent_step(GLOBAL grid_site_params *gs, GLOBAL v3d *v0, G
 }
 
 kernel void calculate_electric(GLOBAL grid_site_params *gs, GLOBAL v3d *m0, GLOBAL v3d *m1, GLOBAL v3d *out, double dt, grid_info gi) {
-    size_t id = get_global_id(0);
+    const int col = get_global_id(0);
+    const int row = get_global_id(1);
+    const int active = row < gi.rows && col < gi.cols;
+    const size_t id = (size_t)row * gi.cols + col;
 
-    if (id >= (gi.rows * gi.cols))
+    if (!active)
         return;
 
-    int col = id % gi.cols;
-    int row = id / gi.cols;
-
     parameters param;
     param.rows = gi.rows;
     param.cols = gi.cols;
@@ -433,17 +775,17 @@ kernel void calculate_electric(GLOBAL grid_site_params *gs, GLOBAL v3d *m0, GLOB
     out[id] = v3d_scalar(emergent_electric_field(param.m, param.neigh.left, param.neigh.right, param.neigh.up, param.neigh.down, v3d_scalar(dm, 1.0 / dt), param.gs.lattice, param.gs.lattice), param.gs.lattice * param.gs.lattice);
 }
 
-kernel void render_electric(GLOBAL v3d *field, unsigned int rows, unsigned int cols, double max_mod,
+kernel void render_electric(GLOBAL v3d *field, unsigned int rows, unsigned int cols, GLOBAL double *range,
                             GLOBAL RGBA32 *rgba, unsigned int width, unsigned int height) {
-    size_t id = get_global_id(0);
-    
-    if (id >= (width * height))
+    const int icol = get_global_id(0);
+    const int irow = get_global_id(1);
+
+    if (icol >= width || irow >= height)
         return;
 
-    int icol = id % width;
-    int irow = id / width;
-    int vcol = (float)icol / width * cols;
-    int vrow = (float)irow / height * rows;
+    const size_t id = (size_t)irow * width + icol;
+    int vcol = (size_t)icol * cols / width;
+    int vrow = (size_t)irow * rows / height;
 
     //rendering inverts the grid, need to invert back
     vrow = rows - 1 - vrow;
@@ -454,7 +796,7 @@ kernel void render_electric(GLOBAL v3d *field, unsigned int rows, unsigned int c
     v3d f = field[vrow * cols + vcol];
     double angle = atan2(f.y, f.x) / M_PI;
     angle = (angle + 1.0) / 2.0;
-    RGBA32 color = hsl_to_rgb(angle, sqrt(v3d_dot(f, f)) / max_mod, 0.5);
+    RGBA32 color = hsl_to_rgb(angle, sqrt(v3d_dot(f, f)) / range[1], 0.5);
 
     rgba[id] = color;
 }
@@ -4,25 +4,33 @@ double nsrandom(tyche_i_state *state, double start, double end) {
     return tyche_i_double((*state)) * (end - start) + start;
 }
 
+//All normal samplers below consume a fixed number of uniforms and have no rejection loop,
+//so work-items never diverge on them. 1 - u is in (0, 1], which keeps log finite
 double normal_distribution_box_muller(tyche_i_state *state) {
-    double u1 = nsrandom(state, 0, 1);
+    double u1 = 1.0 - nsrandom(state, 0, 1);
     double u2 = nsrandom(state, 0, 1);
     return sqrt(-2.0 * log(u1)) * cos(2.0 * M_PI * u2);
 }
 
+void normal_distribution_pair(tyche_i_state *state, double *n0, double *n1) {
+    double u1 = 1.0 - nsrandom(state, 0, 1);
+    double u2 = nsrandom(state, 0, 1);
+    double r = sqrt(-2.0 * log(u1));
+    double theta = 2.0 * M_PI * u2;
+    *n0 = r * cos(theta);
+    *n1 = r * sin(theta);
+}
+
+//4 uniforms -> 3 normals, the fourth one is dropped
+v3d normal_distribution_v3d(tyche_i_state *state) {
+    double x, y, z, unused;
+    normal_distribution_pair(state, &x, &y);
+    normal_distribution_pair(state, &z, &unused);
+    return v3d_c(x, y, z);
+}
+
 double normal_distribution(tyche_i_state *state) {
-    for (;;) {
-        double U = nsrandom(state, 0, 1);
-        double V = nsrandom(state, 0, 1);
-        double X = sqrt(8.0 / M_E) * (V - 0.5) / U;
-        double X2 = X * X;
-        if (X2 <= (5.0 - 4.0 * exp(0.25) * U))
-            return X;
-        else if (X2 >= (4.0 * exp(-1.35) / U + 1.4))
-            continue;
-        else if (X2 <= (-4.0 * log(U)))
-            return X;
-    }
+    return normal_distribution_box_muller(state);
 }
 
 //Assume D=1
@@ -41,8 +49,9 @@ double get_random_gsa(tyche_i_state *state, double qV, double T, double _gamma)
     double f5 = 1.0 / (qV - 1.0) - 0.5;
     double f6 = M_PI * (1.0 - f5) / sin(M_PI * (1.0 - f5)) / tgamma(2.0 - f5);
     double sigmax = exp(-(qV - 1.0) * log(f6 / f4) / (3.0 - qV));
-    double x = sigmax * normal_distribution(state);
-    double y = normal_distribution(state);
+    double x, y;
+    normal_distribution_pair(state, &x, &y);
+    x *= sigmax;
     double den = exp((qV - 1.0) * log(fabs(y)) / (3.0 - qV));
     return x / den;
 }
@@ -42,6 +42,75 @@ void apply_pbc_complete(GLOBAL grid_site_params *gs, GLOBAL v3d *v, v3d *out, gr
     *gsout = gs[row * cols + col];
 }
 
+//(3 r r - I) m / |r|^3 for an in-plane separation given in lattice units
+v3d dipolar_tensor_apply(double dx, double dy, v3d m) {
+    double r2 = dx * dx + dy * dy;
+    double r3 = r2 * sqrt(r2);
+    double rm = 3.0 * (dx * m.x + dy * m.y) / r2;
+    return v3d_scalar(v3d_c(dx * rm - m.x, dy * rm - m.y, -m.z), 1.0 / r3);
+}
+
+//fills the node offset and shape of every pyramid level, returns the index of the 1x1 top level
+int dipolar_tree_levels(grid_info gi, int *offsets, int *rows, int *cols) {
+    int level = 0;
+    offsets[0] = 0;
+    rows[0] = gi.rows;
+    cols[0] = gi.cols;
+    while ((rows[level] > 1 || cols[level] > 1) && level < DIPOLAR_TREE_MAX_LEVELS - 1) {
+        offsets[level + 1] = offsets[level] + rows[level] * cols[level];
+        rows[level + 1] = (rows[level] + 1) / 2;
+        cols[level + 1] = (cols[level] + 1) / 2;
+        level++;
+    }
+    return level;
+}
+
+#ifdef INCLUDE_DIPOLAR
+//sum of mu_j * D(r_ij) * m_j over the same offset window the direct sum always used
+//the tensor table is walked in tiles staged in local memory, every work item of the group must call this
+v3d dipolar_sum(GLOBAL grid_site_params *gs, GLOBAL v3d *v, GLOBAL dipolar_tensor *table, LOCAL dipolar_tensor *tile, grid_info gi, int row, int col, int active) {
+    const int half_rows = gi.rows / 2;
+    const int half_cols = gi.cols / 2;
+    const int window_cols = 2 * half_cols;
+    const int total = 2 * half_rows * window_cols;
+    //the lattice kernels run on 2D tiles, the whole group shares the table loads
+    const int lid = get_local_id(1) * get_local_size(0) + get_local_id(0);
+    const int lsize = get_local_size(0) * get_local_size(1);
+
+    v3d ret = v3d_s(0.0);
+    for (int start = 0; start < total; start += DIPOLAR_TILE) {
+        int len = total - start < DIPOLAR_TILE? total - start: DIPOLAR_TILE;
+
+        barrier(CLK_LOCAL_MEM_FENCE);
+        for (int k = lid; k < len; k += lsize)
+            tile[k] = table[start + k];
+        barrier(CLK_LOCAL_MEM_FENCE);
+
+        if (!active)
+            continue;
+
+        for (int k = 0; k < len; ++k) {
+            int dr = (start + k) / window_cols - half_rows;
+            int dc = (start + k) % window_cols - half_cols;
+            v3d mj;
+            grid_site_params gj;
+            apply_pbc_complete(gs, v, &mj, &gj, gi.pbc, row + dr, col + dc, gi.rows, gi.cols);
+            mj = v3d_scalar(mj, gj.mu);
+            dipolar_tensor d = tile[k];
+            ret.x += d.xx * mj.x + d.xy * mj.y;
+            ret.y += d.xy * mj.x + d.yy * mj.y;
+            ret.z += d.zz * mj.z;
+        }
+    }
+    return ret;
+}
+
+//gradient of the dipolar energy with respect to m_i, ready to be stored in parameters.dipolar_field
+v3d dipolar_field_from_sum(v3d sum, grid_site_params gs) {
+    return v3d_scalar(sum, -MU_0 * gs.mu / (4.0 * M_PI * gs.lattice * gs.lattice * gs.lattice));
+}
+#endif
+
 double exchange_energy(parameters param) {
     return -(v3d_dot(param.m, param.neigh.left) + v3d_dot(param.m, param.neigh.right) +
              v3d_dot(param.m, param.neigh.up) + v3d_dot(param.m, param.neigh.down)) * param.gs.exchange;
@@ -62,9 +131,13 @@ double anisotropy_energy(parameters param) {
 }
 
 double cubic_anisotropy_energy(parameters param) {
+#ifdef HAS_CUBIC
     return -(param.m.x * param.m.x * param.m.x * param.m.x + 
              param.m.y * param.m.y * param.m.y * param.m.y +
              param.m.z * param.m.z * param.m.z * param.m.z) * param.gs.cubic_ani;
+#else
+    return 0.0;
+#endif
 }
 
 double field_energy(parameters param) {
@@ -72,7 +145,10 @@ double field_energy(parameters param) {
 }
 
 double energy(parameters param) {
-    double e = 0.5 * exchange_energy(param) + 0.5 * dm_energy(param) + anisotropy_energy(param) + field_energy(param) + cubic_anisotropy_energy(param);
+    double e = 0.5 * exchange_energy(param) + 0.5 * dm_energy(param) + anisotropy_energy(param) + field_energy(param);
+#ifdef HAS_CUBIC
+    e += cubic_anisotropy_energy(param);
+#endif
 #ifdef INCLUDE_DIPOLAR
     e += 0.5 * param.dipolar_energy;
 #endif
@@ -100,9 +176,11 @@ v3d effective_field(parameters param) {
 
     ret = v3d_sub(ret, v3d_scalar(param.gs.ani.dir, 2.0 * param.gs.ani.ani * v3d_dot(param.m, param.gs.ani.dir)));
 
+#ifdef HAS_CUBIC
     ret = v3d_sub(ret, v3d_scalar(v3d_c(param.m.x * param.m.x * param.m.x,
                                         param.m.y * param.m.y * param.m.y,
                                         param.m.z * param.m.z * param.m.z), 4.0 * param.gs.cubic_ani));
+#endif
 
 #ifdef INCLUDE_DIPOLAR
     ret = v3d_sum(ret, param.dipolar_field);
@@ -130,36 +208,26 @@ v3d dm_dt(parameters param, double dt) {
     v3d H_eff = effective_field(param);
     H_eff = v3d_sum(H_eff, param.temperature_effect);
     v3d v = v3d_scalar(v3d_cross(param.m, H_eff), -param.gs.gamma);
+#if defined(HAS_STT) || defined(HAS_SHE)
     current cur = generate_current(param.gs, param.time);
-    switch (cur.type) {
-        case CUR_STT: {
-            v3d common = v3d_dot_grad(cur.stt.j, param.neigh, param.gs.lattice, param.gs.lattice);
-            common = v3d_scalar(common, cur.stt.polarization * param.gs.lattice * param.gs.lattice * param.gs.lattice / (2.0 * QE));
-            v3d beta = v3d_scalar(v3d_cross(param.m, common), cur.stt.beta);
-            v = v3d_sum(v, v3d_sub(common, beta));
-        }
-        break;
-        case CUR_SHE: {
-            v3d common = v3d_scalar(v3d_cross(param.m, cur.she.p), HBAR * param.gs.gamma * cur.she.theta_sh * param.gs.lattice * param.gs.lattice / (2.0 * QE * param.gs.mu));
-            v3d beta = v3d_scalar(common, cur.stt.beta);
-            v = v3d_sum(v, v3d_sub(v3d_cross(common, param.m), beta));
-        }
-        break;
-        case CUR_BOTH: {
-            v3d stt_common = v3d_dot_grad(cur.stt.j, param.neigh, param.gs.lattice, param.gs.lattice);
-            stt_common = v3d_scalar(stt_common, cur.stt.polarization * param.gs.lattice * param.gs.lattice * param.gs.lattice / (2.0 * QE));
-            v3d stt_beta = v3d_scalar(v3d_cross(param.m, stt_common), cur.stt.beta);
-            v = v3d_sum(v, v3d_sub(stt_common, stt_beta));
+#endif
 
+#ifdef HAS_STT
+    if (cur.type & CUR_STT) {
+        v3d common = v3d_dot_grad(cur.stt.j, param.neigh, param.gs.lattice, param.gs.lattice);
+        common = v3d_scalar(common, cur.stt.polarization * param.gs.lattice * param.gs.lattice * param.gs.lattice / (2.0 * QE));
+        v3d beta = v3d_scalar(v3d_cross(param.m, common), cur.stt.beta);
+        v = v3d_sum(v, v3d_sub(common, beta));
+    }
+#endif
 
-            v3d she_common = v3d_scalar(v3d_cross(param.m, cur.she.p), HBAR * param.gs.gamma * cur.she.theta_sh * param.gs.lattice * param.gs.lattice / (2.0 * QE * param.gs.mu));
-            v3d she_beta = v3d_scalar(she_common, cur.stt.beta);
-            v = v3d_sum(v, v3d_sub(v3d_cross(she_common, param.m), she_beta));
-        }
-        break;
-        case CUR_NONE:
-        break;
+#ifdef HAS_SHE
+    if (cur.type & CUR_SHE) {
+        v3d common = v3d_scalar(v3d_cross(param.m, cur.she.p), HBAR * param.gs.gamma * cur.she.theta_sh * param.gs.lattice * param.gs.lattice / (2.0 * QE * param.gs.mu));
+        v3d beta = v3d_scalar(common, cur.stt.beta);
+        v = v3d_sum(v, v3d_sub(v3d_cross(common, param.m), beta));
     }
+#endif
 
     return v3d_scalar(v3d_sum(v, v3d_scalar(v3d_cross(param.m, v), param.gs.alpha)), 1.0 / (1.0 + param.gs.alpha * param.gs.alpha) * dt);
 }
@@ -186,6 +254,34 @@ v3d step_llg(parameters param, double dt) {
     return v3d_scalar(v3d_sum(v3d_sum(rk1, v3d_scalar(rk2, 2.0)), v3d_sum(v3d_scalar(rk3, 2.0), rk4)), 1.0 / 6.0);
 }
 
+//rotates m by the Cayley transform of the rotation vector omega (already multiplied by dt)
+//m' = m + omega x (m + m') / 2, solved explicitly. Exact rotation, so |m'| = |m|
+v3d cayley_rotate(v3d m, v3d omega) {
+    v3d a = v3d_scalar(omega, 0.5);
+    double a2 = v3d_dot(a, a);
+    v3d ret = v3d_scalar(m, 1.0 - a2);
+    ret = v3d_sum(ret, v3d_scalar(v3d_cross(a, m), 2.0));
+    ret = v3d_sum(ret, v3d_scalar(a, 2.0 * v3d_dot(a, m)));
+    return v3d_scalar(ret, 1.0 / (1.0 + a2));
+}
+
+//Semi-implicit midpoint (Mentink et al. 2010). Neighbors are kept fixed during the step, same as step_llg.
+//The torque T = dm_dt is written as a rotation omega = m x T around the point where it was evaluated
+//Returns the new spin, not the increment
+v3d step_llg_midpoint(parameters param, double dt) {
+    v3d m0 = param.m;
+    double time_ori = param.time;
+
+    v3d omega = v3d_cross(m0, dm_dt(param, dt));
+    v3d predictor = cayley_rotate(m0, omega);
+
+    param.m = v3d_normalize(v3d_sum(m0, predictor));
+    param.time = time_ori + dt / 2.0;
+    omega = v3d_cross(param.m, dm_dt(param, dt));
+
+    return cayley_rotate(m0, omega);
+}
+
 double charge_finite(v3d m, v3d left, v3d right, v3d up, v3d down) {
     return v3d_dot(m, v3d_cross(
                 v3d_scalar(v3d_sub(right, left), 0.5), //x finite scaled by lattice
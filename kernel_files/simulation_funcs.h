@@ -24,6 +24,12 @@ typedef struct {
 
 v3d apply_pbc(GLOBAL v3d *v, pbc_rules pbc, int row, int col, int rows, int cols);
 void apply_pbc_complete(GLOBAL grid_site_params *gs, GLOBAL v3d *v, v3d *out, grid_site_params *gsout, pbc_rules pbc, int row, int col, int rows, int cols);
+v3d dipolar_tensor_apply(double dx, double dy, v3d m);
+int dipolar_tree_levels(grid_info gi, int *offsets, int *rows, int *cols);
+#ifdef INCLUDE_DIPOLAR
+v3d dipolar_sum(GLOBAL grid_site_params *gs, GLOBAL v3d *v, GLOBAL dipolar_tensor *table, LOCAL dipolar_tensor *tile, grid_info gi, int row, int col, int active);
+v3d dipolar_field_from_sum(v3d sum, grid_site_params gs);
+#endif
 v3d generate_magnetic_field(grid_site_params gs, double time);
 current generate_current(grid_site_params gs, double time);
 double generate_temperature(grid_site_params gs, double time);
@@ -45,6 +51,8 @@ v3d effective_field(parameters param);
 v3d dm_dt(parameters param, double dt);
 v3d v3d_dot_grad(v3d v, neighbors_set neigh, double dx, double dy);
 v3d step_llg(parameters param, double dt);
+v3d cayley_rotate(v3d m, v3d omega);
+v3d step_llg_midpoint(parameters param, double dt);
 
 double charge_finite(v3d m, v3d left, v3d right, v3d up, v3d down);
 double charge_lattice(v3d m, v3d left, v3d right, v3d up, v3d down);
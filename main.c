@@ -40,6 +40,45 @@ void apply_current(double cur, int n_defects) {
     grid_free(&g);
 }
 
+#ifdef USE_MPI
+//ATOMISTIC_MPI=1 ./build.sh, then mpirun -np N ./main. every rank integrates its block of the same lattice
+int main(int argc, char **argv) {
+    MPI_Init(&argc, &argv);
+    p_id = 1;
+    unsigned int rows = 64, cols = 64;
+    integrate_mpi_layout layout = integrate_mpi_layout_init(rows, cols, (pbc_rules){.pbc_x = true, .pbc_y = true});
+    grid g = grid_init(layout.rows, layout.cols);
+
+    double J = g.gp->exchange;
+    double dm = 0.2 * J;
+    double mu = g.gp->mu;
+
+    grid_set_mu(&g, mu);
+    grid_set_exchange(&g, J);
+    grid_set_dm(&g, dm_interfacial(dm));
+    grid_set_anisotropy(&g, anisotropy_z_axis(0.01 * J));
+
+    //the skyrmion wraps around the grid it is drawn on, so it is drawn on the whole lattice and the block copied out
+    v3d *m = mmalloc(rows * cols * sizeof(*m));
+    v3d_uniform(m, rows, cols, v3d_c(0, 0, 1));
+    v3d_create_skyrmion_at(m, rows, cols, 12, 5, cols / 2, rows / 2, -1, 1, M_PI);
+    for (uint64_t r = 0; r < layout.rows; ++r)
+        memcpy(&g.m[r * layout.cols], &m[(layout.row0 + r) * cols + layout.col0], layout.cols * sizeof(*m));
+    mfree(m);
+
+    integrate_params ip = integrate_params_init();
+    ip.field_func = create_field_D2_over_J(v3d_c(0, 0, 0.5), J, dm, mu);
+    ip.dt = 0.01 * HBAR / J;
+    ip.interval_for_rgb_grid = 0;
+    ip.do_cluster = false;
+    integrate_mpi(&g, layout, ip);
+
+    grid_free(&g);
+    integrate_mpi_layout_free(&layout);
+    MPI_Finalize();
+    return 0;
+}
+#else
 int main(void) {
     p_id = 1;
     grid g = grid_init(64, 64);
@@ -56,7 +95,10 @@ int main(void) {
     grid_uniform(&g, v3d_c(0, 0, 1));
     grid_create_skyrmion_at(&g, 12, 5, g.gi.cols / 2, g.gi.rows / 2, -1, 1, M_PI);
 
+    //both runs share the device and the second one only compiles its new current
+    gpu_session session = gpu_session_open();
     integrate_params ip = integrate_params_init();
+    ip.session = &session;
     ip.field_func = create_field_D2_over_J(v3d_c(0, 0, 0.5), J, dm, mu);
     ip.dt = 0.01 * HBAR / J;
     grid_renderer_integrate(&g, ip, 1000, 1000);
@@ -64,5 +106,7 @@ int main(void) {
     ip.current_func = create_current_stt_dc(5e10, 0, 0);
     grid_renderer_integrate(&g, ip, 1000, 1000);
 
+    gpu_session_close(&session);
     return 0;
 }
+#endif
@@ -1,3 +1,3 @@
 #include "complete_kernel.h"
 
-const char *complete_kernel = "//I hate clover\n#pragma OPENCL EXTENSION cl_khr_fp64 : enable"  "\x2f"  "\x2a"  "\x0a"  "\x42"  "\x53"  "\x44"  "\x20"  "\x33"  "\x2d"  "\x43"  "\x6c"  "\x61"  "\x75"  "\x73"  "\x65"  "\x20"  "\x4c"  "\x69"  "\x63"  "\x65"  "\x6e"  "\x73"  "\x65"  "\x0a"  "\x0a"  "\x43"  "\x6f"  "\x70"  "\x79"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x20"  "\x28"  "\x63"  "\x29"  "\x20"  "\x32"  "\x30"  "\x31"  "\x38"  "\x2c"  "\x20"  "\x54"  "\x61"  "\x64"  "\x65"  "\x6a"  "\x20"  "\x43"  "\x69"  "\x67"  "\x6c"  "\x61"  "\x72"  "\x69"  "\x63"  "\x2c"  "\x20"  "\x45"  "\x72"  "\x69"  "\x6b"  "\x20"  "\x53"  "\x74"  "\x72"  "\x75"  "\x6d"  "\x62"  "\x65"  "\x6c"  "\x6a"  "\x2c"  "\x20"  "\x52"  "\x6f"  "\x6b"  "\x20"  "\x43"  "\x65"  "\x73"  "\x6e"  "\x6f"  "\x76"  "\x61"  "\x72"  "\x2e"  "\x20"  "\x41"  "\x6c"  "\x6c"  "\x20"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x73"  "\x20"  "\x72"  "\x65"  "\x73"  "\x65"  "\x72"  "\x76"  "\x65"  "\x64"  "\x2e"  "\x0a"  "\x0a"  "\x52"  "\x65"  "\x64"  "\x69"  "\x73"  "\x74"  "\x72"  "\x69"  "\x62"  "\x75"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x20"  "\x61"  "\x6e"  "\x64"  "\x20"  "\x75"  "\x73"  "\x65"  "\x20"  "\x69"  "\x6e"  "\x20"  "\x73"  "\x6f"  "\x75"  "\x72"  "\x63"  "\x65"  "\x20"  "\x61"  "\x6e"  "\x64"  "\x20"  "\x62"  "\x69"  "\x6e"  "\x61"  "\x72"  "\x79"  "\x20"  "\x66"  "\x6f"  "\x72"  "\x6d"  "\x73"  "\x2c"  "\x20"  "\x77"  "\x69"  "\x74"  "\x68"  "\x20"  "\x6f"  "\x72"  "\x20"  "\x77"  "\x69"  "\x74"  "\x68"  "\x6f"  "\x75"  "\x74"  "\x20"  "\x6d"  "\x6f"  "\x64"  "\x69"  "\x66"  "\x69"  "\x63"  "\x61"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x2c"  "\x20"  "\x61"  "\x72"  "\x65"  "\x20"  "\x70"  "\x65"  "\x72"  "\x6d"  "\x69"  "\x74"  "\x74"  "\x65"  "\x64"  "\x20"  "\x70"  "\x72"  "\x6f"  "\x76"  "\x69"  "\x64"  "\x65"  "\x64"  "\x20"  "\x74"  "\x68"  "\x61"  "\x74"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x66"  "\x6f"  "\x6c"  "\x6c"  "\x6f"  "\x77"  "\x69"  "\x6e"  "\x67"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x64"  "\x69"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x73"  "\x20"  "\x61"  "\x72"  "\x65"  "\x20"  "\x6d"  "\x65"  "\x74"  "\x3a"  "\x0a"  "\x0a"  "\x52"  "\x65"  "\x64"  "\x69"  "\x73"  "\x74"  "\x72"  "\x69"  "\x62"  "\x75"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x73"  "\x20"  "\x6f"  "\x66"  "\x20"  "\x73"  "\x6f"  "\x75"  "\x72"  "\x63"  "\x65"  "\x20"  "\x63"  "\x6f"  "\x64"  "\x65"  "\x20"  "\x6d"  "\x75"  "\x73"  "\x74"  "\x20"  "\x72"  "\x65"  "\x74"  "\x61"  "\x69"  "\x6e"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x61"  "\x62"  "\x6f"  "\x76"  "\x65"  "\x20"  "\x63"  "\x6f"  "\x70"  "\x79"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x20"  "\x6e"  "\x6f"  "\x74"  "\x69"  "\x63"  "\x65"  "\x2c"  "\x20"  "\x74"  "\x68"  "\x69"  "\x73"  "\x20"  "\x6c"  "\x69"  "\x73"  "\x74"  "\x20"  "\x6f"  "\x66"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x64"  "\x69"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x73"  "\x20"  "\x61"  "\x6e"  "\x64"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x66"  "\x6f"  "\x6c"  "\x6c"  "\x6f"  "\x77"  "\x69"  "\x6e"  "\x67"  "\x20"  "\x64"  "\x69"  "\x73"  "\x63"  "\x6c"  "\x61"  "\x69"  "\x6d"  "\x65"  "\x72"  "\x2e"  "\x0a"  "\x0a"  "\x52"  "\x65"  "\x64"  "\x69"  "\x73"  "\x74"  "\x72"  "\x69"  "\x62"  "\x75"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x73"  "\x20"  "\x69"  "\x6e"  "\x20"  "\x62"  "\x69"  "\x6e"  "\x61"  "\x72"  "\x79"  "\x20"  "\x66"  "\x6f"  "\x72"  "\x6d"  "\x20"  "\x6d"  "\x75"  "\x73"  "\x74"  "\x20"  "\x72"  "\x65"  "\x70"  "\x72"  "\x6f"  "\x64"  "\x75"  "\x63"  "\x65"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x61"  "\x62"  "\x6f"  "\x76"  "\x65"  "\x20"  "\x63"  "\x6f"  "\x70"  "\x79"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x20"  "\x6e"  "\x6f"  "\x74"  "\x69"  "\x63"  "\x65"  "\x2c"  "\x20"  "\x74"  "\x68"  "\x69"  "\x73"  "\x20"  "\x6c"  "\x69"  "\x73"  "\x74"  "\x20"  "\x6f"  "\x66"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x64"  "\x69"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x73"  "\x20"  "\x61"  "\x6e"  "\x64"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x66"  "\x6f"  "\x6c"  "\x6c"  "\x6f"  "\x77"  "\x69"  "\x6e"  "\x67"  "\x20"  "\x64"  "\x69"  "\x73"  "\x63"  "\x6c"  "\x61"  "\x69"  "\x6d"  "\x65"  "\x72"  "\x20"  "\x69"  "\x6e"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x64"  "\x6f"  "\x63"  "\x75"  "\x6d"  "\x65"  "\x6e"  "\x74"  "\x61"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x20"  "\x61"  "\x6e"  "\x64"  "\x2f"  "\x6f"  "\x72"  "\x20"  "\x6f"  "\x74"  "\x68"  "\x65"  "\x72"  "\x20"  "\x6d"  "\x61"  "\x74"  "\x65"  "\x72"  "\x69"  "\x61"  "\x6c"  "\x73"  "\x20"  "\x70"  "\x72"  "\x6f"  "\x76"  "\x69"  "\x64"  "\x65"  "\x64"  "\x20"  "\x77"  "\x69"  "\x74"  "\x68"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x64"  "\x69"  "\x73"  "\x74"  "\x72"  "\x69"  "\x62"  "\x75"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x2e"  "\x0a"  "\x0a"  "\x4e"  "\x65"  "\x69"  "\x74"  "\x68"  "\x65"  "\x72"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x6e"  "\x61"  "\x6d"  "\x65"  "\x20"  "\x6f"  "\x66"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x63"  "\x6f"  "\x70"  "\x79"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x20"  "\x68"  "\x6f"  "\x6c"  "\x64"  "\x65"  "\x72"  "\x20"  "\x6e"  "\x6f"  "\x72"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x6e"  "\x61"  "\x6d"  "\x65"  "\x73"  "\x20"  "\x6f"  "\x66"  "\x20"  "\x69"  "\x74"  "\x73"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x74"  "\x72"  "\x69"  "\x62"  "\x75"  "\x74"  "\x6f"  "\x72"  "\x73"  "\x20"  "\x6d"  "\x61"  "\x79"  "\x20"  "\x62"  "\x65"  "\x20"  "\x75"  "\x73"  "\x65"  "\x64"  "\x20"  "\x74"  "\x6f"  "\x20"  "\x65"  "\x6e"  "\x64"  "\x6f"  "\x72"  "\x73"  "\x65"  "\x20"  "\x6f"  "\x72"  "\x20"  "\x70"  "\x72"  "\x6f"  "\x6d"  "\x6f"  "\x74"  "\x65"  "\x20"  "\x70"  "\x72"  "\x6f"  "\x64"  "\x75"  "\x63"  "\x74"  "\x73"  "\x20"  "\x64"  "\x65"  "\x72"  "\x69"  "\x76"  "\x65"  "\x64"  "\x20"  "\x66"  "\x72"  "\x6f"  "\x6d"  "\x20"  "\x74"  "\x68"  "\x69"  "\x73"  "\x20"  "\x73"  "\x6f"  "\x66"  "\x74"  "\x77"  "\x61"  "\x72"  "\x65"  "\x20"  "\x77"  "\x69"  "\x74"  "\x68"  "\x6f"  "\x75"  "\x74"  "\x20"  "\x73"  "\x70"  "\x65"  "\x63"  "\x69"  "\x66"  "\x69"  "\x63"  "\x20"  "\x70"  "\x72"  "\x69"  "\x6f"  "\x72"  "\x20"  "\x77"  "\x72"  "\x69"  "\x74"  "\x74"  "\x65"  "\x6e"  "\x20"  "\x70"  "\x65"  "\x72"  "\x6d"  "\x69"  "\x73"  "\x73"  "\x69"  "\x6f"  "\x6e"  "\x2e"  "\x0a"  "\x0a"  "\x54"  "\x48"  "\x49"  "\x53"  "\x20"  "\x53"  "\x4f"  "\x46"  "\x54"  "\x57"  "\x41"  "\x52"  "\x45"  "\x20"  "\x49"  "\x53"  "\x20"  "\x50"  "\x52"  "\x4f"  "\x56"  "\x49"  "\x44"  "\x45"  "\x44"  "\x20"  "\x42"  "\x59"  "\x20"  "\x54"  "\x48"  "\x45"  "\x20"  "\x43"  "\x4f"  "\x50"  "\x59"  "\x52"  "\x49"  "\x47"  "\x48"  "\x54"  "\x20"  "\x48"  "\x4f"  "\x4c"  "\x44"  "\x45"  "\x52"  "\x53"  "\x20"  "\x41"  "\x4e"  "\x44"  "\x20"  "\x43"  "\x4f"  "\x4e"  "\x54"  "\x52"  "\x49"  "\x42"  "\x55"  "\x54"  "\x4f"  "\x52"  "\x53"  "\x20"  "\x22"  "\x41"  "\x53"  "\x20"  "\x49"  "\x53"  "\x22"  "\x20"  "\x41"  "\x4e"  "\x44"  "\x20"  "\x41"  "\x4e"  "\x59"  "\x20"  "\x45"  "\x58"  "\x50"  "\x52"  "\x45"  "\x53"  "\x53"  "\x20"  "\x4f"  "\x52"  "\x20"  "\x49"  "\x4d"  "\x50"  "\x4c"  "\x49"  "\x45"  "\x44"  "\x20"  "\x57"  "\x41"  "\x52"  "\x52"  "\x41"  "\x4e"  "\x54"  "\x49"  "\x45"  "\x53"  "\x2c"  "\x20"  "\x49"  "\x4e"  "\x43"  "\x4c"  "\x55"  "\x44"  "\x49"  "\x4e"  "\x47"  "\x2c"  "\x20"  "\x42"  "\x55"  "\x54"  "\x20"  "\x4e"  "\x4f"  "\x54"  "\x20"  "\x4c"  "\x49"  "\x4d"  "\x49"  "\x54"  "\x45"  "\x44"  "\x20"  "\x54"  "\x4f"  "\x2c"  "\x20"  "\x54"  "\x48"  "\x45"  "\x20"  "\x49"  "\x4d"  "\x50"  "\x4c"  "\x49"  "\x45"  "\x44"  "\x20"  "\x57"  "\x41"  "\x52"  "\x52"  "\x41"  "\x4e"  "\x54"  "\x49"  "\x45"  "\x53"  "\x20"  "\x4f"  "\x46"  "\x20"  "\x4d"  "\x45"  "\x52"  "\x43"  "\x48"  "\x41"  "\x4e"  "\x54"  "\x41"  "\x42"  "\x49"  "\x4c"  "\x49"  "\x54"  "\x59"  "\x20"  "\x41"  "\x4e"  "\x44"  "\x20"  "\x46"  "\x49"  "\x54"  "\x4e"  "\x45"  "\x53"  "\x53"  "\x20"  "\x46"  "\x4f"  "\x52"  "\x20"  "\x41"  "\x20"  "\x50"  "\x41"  "\x52"  "\x54"  "\x49"  "\x43"  "\x55"  "\x4c"  "\x41"  "\x52"  "\x20"  "\x50"  "\x55"  "\x52"  "\x50"  "\x4f"  "\x53"  "\x45"  "\x20"  "\x41"  "\x52"  "\x45"  "\x20"  "\x44"  "\x49"  "\x53"  "\x43"  "\x4c"  "\x41"  "\x49"  "\x4d"  "\x45"  "\x44"  "\x2e"  "\x20"  "\x49"  "\x4e"  "\x20"  "\x4e"  "\x4f"  "\x20"  "\x45"  "\x56"  "\x45"  "\x4e"  "\x54"  "\x20"  "\x53"  "\x48"  "\x41"  "\x4c"  "\x4c"  "\x20"  "\x54"  "\x48"  "\x45"  "\x20"  "\x43"  "\x4f"  "\x50"  "\x59"  "\x52"  "\x49"  "\x47"  "\x48"  "\x54"  "\x20"  "\x48"  "\x4f"  "\x4c"  "\x44"  "\x45"  "\x52"  "\x20"  "\x4f"  "\x52"  "\x20"  "\x43"  "\x4f"  "\x4e"  "\x54"  "\x52"  "\x49"  "\x42"  "\x55"  "\x54"  "\x4f"  "\x52"  "\x53"  "\x20"  "\x42"  "\x45"  "\x20"  "\x4c"  "\x49"  "\x41"  "\x42"  "\x4c"  "\x45"  "\x20"  "\x46"  "\x4f"  "\x52"  "\x20"  "\x41"  "\x4e"  "\x59"  "\x20"  "\x44"  "\x49"  "\x52"  "\x45"  "\x43"  "\x54"  "\x2c"  "\x20"  "\x49"  "\x4e"  "\x44"  "\x49"  "\x52"  "\x45"  "\x43"  "\x54"  "\x2c"  "\x20"  "\x49"  "\x4e"  "\x43"  "\x49"  "\x44"  "\x45"  "\x4e"  "\x54"  "\x41"  "\x4c"  "\x2c"  "\x20"  "\x53"  "\x50"  "\x45"  "\x43"  "\x49"  "\x41"  "\x4c"  "\x2c"  "\x20"  "\x45"  "\x58"  "\x45"  "\x4d"  "\x50"  "\x4c"  "\x41"  "\x52"  "\x59"  "\x2c"  "\x20"  "\x4f"  "\x52"  "\x20"  "\x43"  "\x4f"  "\x4e"  "\x53"  "\x45"  "\x51"  "\x55"  "\x45"  "\x4e"  "\x54"  "\x49"  "\x41"  "\x4c"  "\x20"  "\x44"  "\x41"  "\x4d"  "\x41"  "\x47"  "\x45"  "\x53"  "\x20"  "\x28"  "\x49"  "\x4e"  "\x43"  "\x4c"  "\x55"  "\x44"  "\x49"  "\x4e"  "\x47"  "\x2c"  "\x20"  "\x42"  "\x55"  "\x54"  "\x20"  "\x4e"  "\x4f"  "\x54"  "\x20"  "\x4c"  "\x49"  "\x4d"  "\x49"  "\x54"  "\x45"  "\x44"  "\x20"  "\x54"  "\x4f"  "\x2c"  "\x20"  "\x50"  "\x52"  "\x4f"  "\x43"  "\x55"  "\x52"  "\x45"  "\x4d"  "\x45"  "\x4e"  "\x54"  "\x20"  "\x4f"  "\x46"  "\x20"  "\x53"  "\x55"  "\x42"  "\x53"  "\x54"  "\x49"  "\x54"  "\x55"  "\x54"  "\x45"  "\x20"  "\x47"  "\x4f"  "\x4f"  "\x44"  "\x53"  "\x20"  "\x4f"  "\x52"  "\x20"  "\x53"  "\x45"  "\x52"  "\x56"  "\x49"  "\x43"  "\x45"  "\x53"  "\x3b"  "\x20"  "\x4c"  "\x4f"  "\x53"  "\x53"  "\x20"  "\x4f"  "\x46"  "\x20"  "\x55"  "\x53"  "\x45"  "\x2c"  "\x20"  "\x44"  "\x41"  "\x54"  "\x41"  "\x2c"  "\x20"  "\x4f"  "\x52"  "\x20"  "\x50"  "\x52"  "\x4f"  "\x46"  "\x49"  "\x54"  "\x53"  "\x3b"  "\x20"  "\x4f"  "\x52"  "\x20"  "\x42"  "\x55"  "\x53"  "\x49"  "\x4e"  "\x45"  "\x53"  "\x53"  "\x20"  "\x49"  "\x4e"  "\x54"  "\x45"  "\x52"  "\x52"  "\x55"  "\x50"  "\x54"  "\x49"  "\x4f"  "\x4e"  "\x29"  "\x20"  "\x48"  "\x4f"  "\x57"  "\x45"  "\x56"  "\x45"  "\x52"  "\x20"  "\x43"  "\x41"  "\x55"  "\x53"  "\x45"  "\x44"  "\x20"  "\x41"  "\x4e"  "\x44"  "\x20"  "\x4f"  "\x4e"  "\x20"  "\x41"  "\x4e"  "\x59"  "\x20"  "\x54"  "\x48"  "\x45"  "\x4f"  "\x52"  "\x59"  "\x20"  "\x4f"  "\x46"  "\x20"  "\x4c"  "\x49"  "\x41"  "\x42"  "\x49"  "\x4c"  "\x49"  "\x54"  "\x59"  "\x2c"  "\x20"  "\x57"  "\x48"  "\x45"  "\x54"  "\x48"  "\x45"  "\x52"  "\x20"  "\x49"  "\x4e"  "\x20"  "\x43"  "\x4f"  "\x4e"  "\x54"  "\x52"  "\x41"  "\x43"  "\x54"  "\x2c"  "\x20"  "\x53"  "\x54"  "\x52"  "\x49"  "\x43"  "\x54"  "\x20"  "\x4c"  "\x49"  "\x41"  "\x42"  "\x49"  "\x4c"  "\x49"  "\x54"  "\x59"  "\x2c"  "\x20"  "\x4f"  "\x52"  "\x20"  "\x54"  "\x4f"  "\x52"  "\x54"  "\x20"  "\x28"  "\x49"  "\x4e"  "\x43"  "\x4c"  "\x55"  "\x44"  "\x49"  "\x4e"  "\x47"  "\x20"  "\x4e"  "\x45"  "\x47"  "\x4c"  "\x49"  "\x47"  "\x45"  "\x4e"  "\x43"  "\x45"  "\x20"  "\x4f"  "\x52"  "\x20"  "\x4f"  "\x54"  "\x48"  "\x45"  "\x52"  "\x57"  "\x49"  "\x53"  "\x45"  "\x29"  "\x20"  "\x41"  "\x52"  "\x49"  "\x53"  "\x49"  "\x4e"  "\x47"  "\x20"  "\x49"  "\x4e"  "\x20"  "\x41"  "\x4e"  "\x59"  "\x20"  "\x57"  "\x41"  "\x59"  "\x20"  "\x4f"  "\x55"  "\x54"  "\x20"  "\x4f"  "\x46"  "\x20"  "\x54"  "\x48"  "\x45"  "\x20"  "\x55"  "\x53"  "\x45"  "\x20"  "\x4f"  "\x46"  "\x20"  "\x54"  "\x48"  "\x49"  "\x53"  "\x20"  "\x53"  "\x4f"  "\x46"  "\x54"  "\x57"  "\x41"  "\x52"  "\x45"  "\x2c"  "\x20"  "\x45"  "\x56"  "\x45"  "\x4e"  "\x20"  "\x49"  "\x46"  "\x20"  "\x41"  "\x44"  "\x56"  "\x49"  "\x53"  "\x45"  "\x44"  "\x20"  "\x4f"  "\x46"  "\x20"  "\x54"  "\x48"  "\x45"  "\x20"  "\x50"  "\x4f"  "\x53"  "\x53"  "\x49"  "\x42"  "\x49"  "\x4c"  "\x49"  "\x54"  "\x59"  "\x20"  "\x4f"  "\x46"  "\x20"  "\x53"  "\x55"  "\x43"  "\x48"  "\x20"  "\x44"  "\x41"  "\x4d"  "\x41"  "\x47"  "\x45"  "\x2e"  "\x0a"  "\x2a"  "\x2f"  "\x0a"  "\x0a"  "\x2f"  "\x2a"  "\x0a"  "\x40"  "\x66"  "\x69"  "\x6c"  "\x65"  "\x0a"  "\x0a"  "\x49"  "\x6d"  "\x70"  "\x6c"  "\x65"  "\x6d"  "\x65"  "\x6e"  "\x74"  "\x73"  "\x20"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x2d"  "\x69"  "\x20"  "\x52"  "\x4e"  "\x47"  "\x2e"  "\x0a"  "\x0a"  "\x53"  "\x2e"  "\x20"  "\x4e"  "\x65"  "\x76"  "\x65"  "\x73"  "\x2c"  "\x20"  "\x46"  "\x2e"  "\x20"  "\x41"  "\x72"  "\x61"  "\x75"  "\x6a"  "\x6f"  "\x2c"  "\x20"  "\x46"  "\x61"  "\x73"  "\x74"  "\x20"  "\x61"  "\x6e"  "\x64"  "\x20"  "\x73"  "\x6d"  "\x61"  "\x6c"  "\x6c"  "\x20"  "\x6e"  "\x6f"  "\x6e"  "\x6c"  "\x69"  "\x6e"  "\x65"  "\x61"  "\x72"  "\x20"  "\x70"  "\x73"  "\x65"  "\x75"  "\x64"  "\x6f"  "\x72"  "\x61"  "\x6e"  "\x64"  "\x6f"  "\x6d"  "\x20"  "\x6e"  "\x75"  "\x6d"  "\x62"  "\x65"  "\x72"  "\x20"  "\x67"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x61"  "\x74"  "\x6f"  "\x72"  "\x73"  "\x20"  "\x66"  "\x6f"  "\x72"  "\x20"  "\x63"  "\x6f"  "\x6d"  "\x70"  "\x75"  "\x74"  "\x65"  "\x72"  "\x20"  "\x73"  "\x69"  "\x6d"  "\x75"  "\x6c"  "\x61"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x2c"  "\x20"  "\x69"  "\x6e"  "\x3a"  "\x20"  "\x49"  "\x6e"  "\x74"  "\x65"  "\x72"  "\x6e"  "\x61"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x61"  "\x6c"  "\x20"  "\x43"  "\x6f"  "\x6e"  "\x66"  "\x65"  "\x72"  "\x65"  "\x6e"  "\x63"  "\x65"  "\x20"  "\x6f"  "\x6e"  "\x20"  "\x50"  "\x61"  "\x72"  "\x61"  "\x6c"  "\x6c"  "\x65"  "\x6c"  "\x20"  "\x50"  "\x72"  "\x6f"  "\x63"  "\x65"  "\x73"  "\x73"  "\x69"  "\x6e"  "\x67"  "\x20"  "\x61"  "\x6e"  "\x64"  "\x20"  "\x41"  "\x70"  "\x70"  "\x6c"  "\x69"  "\x65"  "\x64"  "\x20"  "\x4d"  "\x61"  "\x74"  "\x68"  "\x65"  "\x6d"  "\x61"  "\x74"  "\x69"  "\x63"  "\x73"  "\x2c"  "\x20"  "\x53"  "\x70"  "\x72"  "\x69"  "\x6e"  "\x67"  "\x65"  "\x72"  "\x2c"  "\x20"  "\x32"  "\x30"  "\x31"  "\x31"  "\x2c"  "\x20"  "\x70"  "\x70"  "\x2e"  "\x20"  "\x39"  "\x32"  "\x2d"  "\x31"  "\x30"  "\x31"  "\x2e"  "\x0a"  "\x2a"  "\x2f"  "\x0a"  "\x23"  "\x69"  "\x66"  "\x6e"  "\x64"  "\x65"  "\x66"  "\x20"  "\x5f"  "\x5f"  "\x54"  "\x59"  "\x43"  "\x48"  "\x45"  "\x5f"  "\x49"  "\x5f"  "\x43"  "\x4c"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x5f"  "\x5f"  "\x54"  "\x59"  "\x43"  "\x48"  "\x45"  "\x5f"  "\x49"  "\x5f"  "\x43"  "\x4c"  "\x0a"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x54"  "\x59"  "\x43"  "\x48"  "\x45"  "\x5f"  "\x49"  "\x5f"  "\x46"  "\x4c"  "\x4f"  "\x41"  "\x54"  "\x5f"  "\x4d"  "\x55"  "\x4c"  "\x54"  "\x49"  "\x20"  "\x35"  "\x2e"  "\x34"  "\x32"  "\x31"  "\x30"  "\x31"  "\x30"  "\x38"  "\x36"  "\x32"  "\x34"  "\x32"  "\x37"  "\x35"  "\x32"  "\x32"  "\x31"  "\x37"  "\x30"  "\x30"  "\x33"  "\x37"  "\x32"  "\x36"  "\x34"  "\x30"  "\x65"  "\x2d"  "\x32"  "\x30"  "\x66"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x54"  "\x59"  "\x43"  "\x48"  "\x45"  "\x5f"  "\x49"  "\x5f"  "\x44"  "\x4f"  "\x55"  "\x42"  "\x4c"  "\x45"  "\x5f"  "\x4d"  "\x55"  "\x4c"  "\x54"  "\x49"  "\x20"  "\x35"  "\x2e"  "\x34"  "\x32"  "\x31"  "\x30"  "\x31"  "\x30"  "\x38"  "\x36"  "\x32"  "\x34"  "\x32"  "\x37"  "\x35"  "\x32"  "\x32"  "\x31"  "\x37"  "\x30"  "\x30"  "\x33"  "\x37"  "\x32"  "\x36"  "\x34"  "\x30"  "\x65"  "\x2d"  "\x32"  "\x30"  "\x0a"  "\x0a"  "\x2f"  "\x2a"  "\x2a"  "\x0a"  "\x53"  "\x74"  "\x61"  "\x74"  "\x65"  "\x20"  "\x6f"  "\x66"  "\x20"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x20"  "\x52"  "\x4e"  "\x47"  "\x2e"  "\x0a"  "\x2a"  "\x2f"  "\x0a"  "\x74"  "\x79"  "\x70"  "\x65"  "\x64"  "\x65"  "\x66"  "\x20"  "\x75"  "\x6e"  "\x69"  "\x6f"  "\x6e"  "\x7b"  "\x0a"  "\x09"  "\x73"  "\x74"  "\x72"  "\x75"  "\x63"  "\x74"  "\x7b"  "\x0a"  "\x09"  "\x09"  "\x75"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x61"  "\x2c"  "\x62"  "\x2c"  "\x63"  "\x2c"  "\x64"  "\x3b"  "\x0a"  "\x09"  "\x7d"  "\x3b"  "\x0a"  "\x09"  "\x75"  "\x6c"  "\x6f"  "\x6e"  "\x67"  "\x20"  "\x72"  "\x65"  "\x73"  "\x3b"  "\x0a"  "\x7d"  "\x20"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x3b"  "\x0a"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x54"  "\x59"  "\x43"  "\x48"  "\x45"  "\x5f"  "\x49"  "\x5f"  "\x52"  "\x4f"  "\x54"  "\x28"  "\x61"  "\x2c"  "\x62"  "\x29"  "\x20"  "\x28"  "\x28"  "\x28"  "\x61"  "\x29"  "\x20"  "\x3e"  "\x3e"  "\x20"  "\x28"  "\x62"  "\x29"  "\x29"  "\x20"  "\x7c"  "\x20"  "\x28"  "\x28"  "\x61"  "\x29"  "\x20"  "\x3c"  "\x3c"  "\x20"  "\x28"  "\x33"  "\x32"  "\x20"  "\x2d"  "\x20"  "\x28"  "\x62"  "\x29"  "\x29"  "\x29"  "\x29"  "\x0a"  "\x2f"  "\x2a"  "\x2a"  "\x0a"  "\x47"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x61"  "\x74"  "\x65"  "\x73"  "\x20"  "\x61"  "\x20"  "\x72"  "\x61"  "\x6e"  "\x64"  "\x6f"  "\x6d"  "\x20"  "\x36"  "\x34"  "\x2d"  "\x62"  "\x69"  "\x74"  "\x20"  "\x75"  "\x6e"  "\x73"  "\x69"  "\x67"  "\x6e"  "\x65"  "\x64"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x65"  "\x67"  "\x65"  "\x72"  "\x20"  "\x75"  "\x73"  "\x69"  "\x6e"  "\x67"  "\x20"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x20"  "\x52"  "\x4e"  "\x47"  "\x2e"  "\x0a"  "\x0a"  "\x54"  "\x68"  "\x69"  "\x73"  "\x20"  "\x69"  "\x73"  "\x20"  "\x61"  "\x6c"  "\x74"  "\x65"  "\x72"  "\x6e"  "\x61"  "\x74"  "\x69"  "\x76"  "\x65"  "\x2c"  "\x20"  "\x6d"  "\x61"  "\x63"  "\x72"  "\x6f"  "\x20"  "\x69"  "\x6d"  "\x70"  "\x6c"  "\x65"  "\x6d"  "\x65"  "\x6e"  "\x74"  "\x61"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x20"  "\x6f"  "\x66"  "\x20"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x20"  "\x52"  "\x4e"  "\x47"  "\x2e"  "\x0a"  "\x0a"  "\x40"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x73"  "\x20"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x20"  "\x53"  "\x74"  "\x61"  "\x74"  "\x65"  "\x20"  "\x6f"  "\x66"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x52"  "\x4e"  "\x47"  "\x20"  "\x74"  "\x6f"  "\x20"  "\x75"  "\x73"  "\x65"  "\x2e"  "\x0a"  "\x2a"  "\x2f"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x6d"  "\x61"  "\x63"  "\x72"  "\x6f"  "\x5f"  "\x75"  "\x6c"  "\x6f"  "\x6e"  "\x67"  "\x28"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x29"  "\x20"  "\x28"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x6d"  "\x61"  "\x63"  "\x72"  "\x6f"  "\x5f"  "\x61"  "\x64"  "\x76"  "\x61"  "\x6e"  "\x63"  "\x65"  "\x28"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x29"  "\x2c"  "\x20"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2e"  "\x72"  "\x65"  "\x73"  "\x29"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x6d"  "\x61"  "\x63"  "\x72"  "\x6f"  "\x5f"  "\x61"  "\x64"  "\x76"  "\x61"  "\x6e"  "\x63"  "\x65"  "\x28"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x29"  "\x20"  "\x28"  "\x20"  "\x5c"  "\x0a"  "\x09"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2e"  "\x62"  "\x20"  "\x3d"  "\x20"  "\x54"  "\x59"  "\x43"  "\x48"  "\x45"  "\x5f"  "\x49"  "\x5f"  "\x52"  "\x4f"  "\x54"  "\x28"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2e"  "\x62"  "\x2c"  "\x20"  "\x37"  "\x29"  "\x20"  "\x5e"  "\x20"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2e"  "\x63"  "\x2c"  "\x20"  "\x5c"  "\x0a"  "\x09"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2e"  "\x63"  "\x20"  "\x2d"  "\x3d"  "\x20"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2e"  "\x64"  "\x2c"  "\x20"  "\x5c"  "\x0a"  "\x09"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2e"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x54"  "\x59"  "\x43"  "\x48"  "\x45"  "\x5f"  "\x49"  "\x5f"  "\x52"  "\x4f"  "\x54"  "\x28"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2e"  "\x64"  "\x2c"  "\x20"  "\x38"  "\x29"  "\x20"  "\x5e"  "\x20"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2e"  "\x61"  "\x2c"  "\x5c"  "\x0a"  "\x09"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2e"  "\x61"  "\x20"  "\x2d"  "\x3d"  "\x20"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2e"  "\x62"  "\x2c"  "\x20"  "\x5c"  "\x0a"  "\x09"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2e"  "\x62"  "\x20"  "\x3d"  "\x20"  "\x54"  "\x59"  "\x43"  "\x48"  "\x45"  "\x5f"  "\x49"  "\x5f"  "\x52"  "\x4f"  "\x54"  "\x28"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2e"  "\x62"  "\x2c"  "\x20"  "\x31"  "\x32"  "\x29"  "\x20"  "\x5e"  "\x20"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2e"  "\x63"  "\x2c"  "\x20"  "\x5c"  "\x0a"  "\x09"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2e"  "\x63"  "\x20"  "\x2d"  "\x3d"  "\x20"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2e"  "\x64"  "\x2c"  "\x20"  "\x5c"  "\x0a"  "\x09"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2e"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x54"  "\x59"  "\x43"  "\x48"  "\x45"  "\x5f"  "\x49"  "\x5f"  "\x52"  "\x4f"  "\x54"  "\x28"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2e"  "\x64"  "\x2c"  "\x20"  "\x31"  "\x36"  "\x29"  "\x20"  "\x5e"  "\x20"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2e"  "\x61"  "\x2c"  "\x20"  "\x5c"  "\x0a"  "\x09"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2e"  "\x61"  "\x20"  "\x2d"  "\x3d"  "\x20"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2e"  "\x62"  "\x20"  "\x5c"  "\x0a"  "\x29"  "\x0a"  "\x0a"  "\x2f"  "\x2a"  "\x2a"  "\x0a"  "\x47"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x61"  "\x74"  "\x65"  "\x73"  "\x20"  "\x61"  "\x20"  "\x72"  "\x61"  "\x6e"  "\x64"  "\x6f"  "\x6d"  "\x20"  "\x36"  "\x34"  "\x2d"  "\x62"  "\x69"  "\x74"  "\x20"  "\x75"  "\x6e"  "\x73"  "\x69"  "\x67"  "\x6e"  "\x65"  "\x64"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x65"  "\x67"  "\x65"  "\x72"  "\x20"  "\x75"  "\x73"  "\x69"  "\x6e"  "\x67"  "\x20"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x20"  "\x52"  "\x4e"  "\x47"  "\x2e"  "\x0a"  "\x0a"  "\x40"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x73"  "\x20"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x20"  "\x53"  "\x74"  "\x61"  "\x74"  "\x65"  "\x20"  "\x6f"  "\x66"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x52"  "\x4e"  "\x47"  "\x20"  "\x74"  "\x6f"  "\x20"  "\x75"  "\x73"  "\x65"  "\x2e"  "\x0a"  "\x2a"  "\x2f"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x75"  "\x6c"  "\x6f"  "\x6e"  "\x67"  "\x28"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x29"  "\x20"  "\x28"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x61"  "\x64"  "\x76"  "\x61"  "\x6e"  "\x63"  "\x65"  "\x28"  "\x26"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x29"  "\x2c"  "\x20"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2e"  "\x72"  "\x65"  "\x73"  "\x29"  "\x0a"  "\x76"  "\x6f"  "\x69"  "\x64"  "\x20"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x61"  "\x64"  "\x76"  "\x61"  "\x6e"  "\x63"  "\x65"  "\x28"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2a"  "\x20"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x29"  "\x7b"  "\x0a"  "\x09"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2d"  "\x3e"  "\x62"  "\x20"  "\x3d"  "\x20"  "\x54"  "\x59"  "\x43"  "\x48"  "\x45"  "\x5f"  "\x49"  "\x5f"  "\x52"  "\x4f"  "\x54"  "\x28"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2d"  "\x3e"  "\x62"  "\x2c"  "\x20"  "\x37"  "\x29"  "\x20"  "\x5e"  "\x20"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2d"  "\x3e"  "\x63"  "\x3b"  "\x0a"  "\x09"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2d"  "\x3e"  "\x63"  "\x20"  "\x2d"  "\x3d"  "\x20"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2d"  "\x3e"  "\x64"  "\x3b"  "\x0a"  "\x09"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2d"  "\x3e"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x54"  "\x59"  "\x43"  "\x48"  "\x45"  "\x5f"  "\x49"  "\x5f"  "\x52"  "\x4f"  "\x54"  "\x28"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2d"  "\x3e"  "\x64"  "\x2c"  "\x20"  "\x38"  "\x29"  "\x20"  "\x5e"  "\x20"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2d"  "\x3e"  "\x61"  "\x3b"  "\x0a"  "\x09"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2d"  "\x3e"  "\x61"  "\x20"  "\x2d"  "\x3d"  "\x20"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2d"  "\x3e"  "\x62"  "\x3b"  "\x0a"  "\x09"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2d"  "\x3e"  "\x62"  "\x20"  "\x3d"  "\x20"  "\x54"  "\x59"  "\x43"  "\x48"  "\x45"  "\x5f"  "\x49"  "\x5f"  "\x52"  "\x4f"  "\x54"  "\x28"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2d"  "\x3e"  "\x62"  "\x2c"  "\x20"  "\x31"  "\x32"  "\x29"  "\x20"  "\x5e"  "\x20"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2d"  "\x3e"  "\x63"  "\x3b"  "\x0a"  "\x09"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2d"  "\x3e"  "\x63"  "\x20"  "\x2d"  "\x3d"  "\x20"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2d"  "\x3e"  "\x64"  "\x3b"  "\x0a"  "\x09"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2d"  "\x3e"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x54"  "\x59"  "\x43"  "\x48"  "\x45"  "\x5f"  "\x49"  "\x5f"  "\x52"  "\x4f"  "\x54"  "\x28"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2d"  "\x3e"  "\x64"  "\x2c"  "\x20"  "\x31"  "\x36"  "\x29"  "\x20"  "\x5e"  "\x20"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2d"  "\x3e"  "\x61"  "\x3b"  "\x0a"  "\x09"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2d"  "\x3e"  "\x61"  "\x20"  "\x2d"  "\x3d"  "\x20"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2d"  "\x3e"  "\x62"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x2f"  "\x2a"  "\x2a"  "\x0a"  "\x53"  "\x65"  "\x65"  "\x64"  "\x73"  "\x20"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x20"  "\x52"  "\x4e"  "\x47"  "\x2e"  "\x0a"  "\x0a"  "\x40"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x73"  "\x20"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x20"  "\x56"  "\x61"  "\x72"  "\x69"  "\x61"  "\x62"  "\x6c"  "\x65"  "\x2c"  "\x20"  "\x74"  "\x68"  "\x61"  "\x74"  "\x20"  "\x68"  "\x6f"  "\x6c"  "\x64"  "\x73"  "\x20"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x20"  "\x6f"  "\x66"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x67"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x61"  "\x74"  "\x6f"  "\x72"  "\x20"  "\x74"  "\x6f"  "\x20"  "\x62"  "\x65"  "\x20"  "\x73"  "\x65"  "\x65"  "\x64"  "\x65"  "\x64"  "\x2e"  "\x0a"  "\x40"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x73"  "\x20"  "\x73"  "\x65"  "\x65"  "\x64"  "\x20"  "\x56"  "\x61"  "\x6c"  "\x75"  "\x65"  "\x20"  "\x75"  "\x73"  "\x65"  "\x64"  "\x20"  "\x66"  "\x6f"  "\x72"  "\x20"  "\x73"  "\x65"  "\x65"  "\x64"  "\x69"  "\x6e"  "\x67"  "\x2e"  "\x20"  "\x53"  "\x68"  "\x6f"  "\x75"  "\x6c"  "\x64"  "\x20"  "\x62"  "\x65"  "\x20"  "\x72"  "\x61"  "\x6e"  "\x64"  "\x6f"  "\x6d"  "\x6c"  "\x79"  "\x20"  "\x67"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x61"  "\x74"  "\x65"  "\x64"  "\x20"  "\x66"  "\x6f"  "\x72"  "\x20"  "\x65"  "\x61"  "\x63"  "\x68"  "\x20"  "\x69"  "\x6e"  "\x73"  "\x74"  "\x61"  "\x6e"  "\x63"  "\x65"  "\x20"  "\x6f"  "\x66"  "\x20"  "\x67"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x61"  "\x74"  "\x6f"  "\x72"  "\x20"  "\x28"  "\x74"  "\x68"  "\x72"  "\x65"  "\x61"  "\x64"  "\x29"  "\x2e"  "\x0a"  "\x2a"  "\x2f"  "\x0a"  "\x76"  "\x6f"  "\x69"  "\x64"  "\x20"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x73"  "\x65"  "\x65"  "\x64"  "\x28"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2a"  "\x20"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2c"  "\x20"  "\x75"  "\x6c"  "\x6f"  "\x6e"  "\x67"  "\x20"  "\x73"  "\x65"  "\x65"  "\x64"  "\x29"  "\x7b"  "\x0a"  "\x09"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2d"  "\x3e"  "\x61"  "\x20"  "\x3d"  "\x20"  "\x73"  "\x65"  "\x65"  "\x64"  "\x20"  "\x3e"  "\x3e"  "\x20"  "\x33"  "\x32"  "\x3b"  "\x0a"  "\x09"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2d"  "\x3e"  "\x62"  "\x20"  "\x3d"  "\x20"  "\x73"  "\x65"  "\x65"  "\x64"  "\x3b"  "\x0a"  "\x09"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2d"  "\x3e"  "\x63"  "\x20"  "\x3d"  "\x20"  "\x32"  "\x36"  "\x35"  "\x34"  "\x34"  "\x33"  "\x35"  "\x37"  "\x36"  "\x39"  "\x3b"  "\x0a"  "\x09"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2d"  "\x3e"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x31"  "\x33"  "\x36"  "\x37"  "\x31"  "\x33"  "\x30"  "\x35"  "\x35"  "\x31"  "\x20"  "\x5e"  "\x20"  "\x28"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x67"  "\x6c"  "\x6f"  "\x62"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x64"  "\x28"  "\x30"  "\x29"  "\x20"  "\x2b"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x67"  "\x6c"  "\x6f"  "\x62"  "\x61"  "\x6c"  "\x5f"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x28"  "\x30"  "\x29"  "\x20"  "\x2a"  "\x20"  "\x28"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x67"  "\x6c"  "\x6f"  "\x62"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x64"  "\x28"  "\x31"  "\x29"  "\x20"  "\x2b"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x67"  "\x6c"  "\x6f"  "\x62"  "\x61"  "\x6c"  "\x5f"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x28"  "\x31"  "\x29"  "\x20"  "\x2a"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x67"  "\x6c"  "\x6f"  "\x62"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x64"  "\x28"  "\x32"  "\x29"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x09"  "\x66"  "\x6f"  "\x72"  "\x28"  "\x75"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x69"  "\x3d"  "\x30"  "\x3b"  "\x69"  "\x3c"  "\x32"  "\x30"  "\x3b"  "\x69"  "\x2b"  "\x2b"  "\x29"  "\x7b"  "\x0a"  "\x09"  "\x09"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x61"  "\x64"  "\x76"  "\x61"  "\x6e"  "\x63"  "\x65"  "\x28"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x29"  "\x3b"  "\x0a"  "\x09"  "\x7d"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x2f"  "\x2a"  "\x2a"  "\x0a"  "\x47"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x61"  "\x74"  "\x65"  "\x73"  "\x20"  "\x61"  "\x20"  "\x72"  "\x61"  "\x6e"  "\x64"  "\x6f"  "\x6d"  "\x20"  "\x33"  "\x32"  "\x2d"  "\x62"  "\x69"  "\x74"  "\x20"  "\x75"  "\x6e"  "\x73"  "\x69"  "\x67"  "\x6e"  "\x65"  "\x64"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x65"  "\x67"  "\x65"  "\x72"  "\x20"  "\x75"  "\x73"  "\x69"  "\x6e"  "\x67"  "\x20"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x20"  "\x52"  "\x4e"  "\x47"  "\x2e"  "\x0a"  "\x0a"  "\x40"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x73"  "\x20"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x20"  "\x53"  "\x74"  "\x61"  "\x74"  "\x65"  "\x20"  "\x6f"  "\x66"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x52"  "\x4e"  "\x47"  "\x20"  "\x74"  "\x6f"  "\x20"  "\x75"  "\x73"  "\x65"  "\x2e"  "\x0a"  "\x2a"  "\x2f"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x75"  "\x69"  "\x6e"  "\x74"  "\x28"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x29"  "\x20"  "\x28"  "\x28"  "\x75"  "\x69"  "\x6e"  "\x74"  "\x29"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x75"  "\x6c"  "\x6f"  "\x6e"  "\x67"  "\x28"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x29"  "\x29"  "\x0a"  "\x0a"  "\x2f"  "\x2a"  "\x2a"  "\x0a"  "\x47"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x61"  "\x74"  "\x65"  "\x73"  "\x20"  "\x61"  "\x20"  "\x72"  "\x61"  "\x6e"  "\x64"  "\x6f"  "\x6d"  "\x20"  "\x66"  "\x6c"  "\x6f"  "\x61"  "\x74"  "\x20"  "\x75"  "\x73"  "\x69"  "\x6e"  "\x67"  "\x20"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x20"  "\x52"  "\x4e"  "\x47"  "\x2e"  "\x0a"  "\x0a"  "\x40"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x73"  "\x20"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x20"  "\x53"  "\x74"  "\x61"  "\x74"  "\x65"  "\x20"  "\x6f"  "\x66"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x52"  "\x4e"  "\x47"  "\x20"  "\x74"  "\x6f"  "\x20"  "\x75"  "\x73"  "\x65"  "\x2e"  "\x0a"  "\x2a"  "\x2f"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x66"  "\x6c"  "\x6f"  "\x61"  "\x74"  "\x28"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x29"  "\x20"  "\x28"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x75"  "\x6c"  "\x6f"  "\x6e"  "\x67"  "\x28"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x29"  "\x2a"  "\x54"  "\x59"  "\x43"  "\x48"  "\x45"  "\x5f"  "\x49"  "\x5f"  "\x46"  "\x4c"  "\x4f"  "\x41"  "\x54"  "\x5f"  "\x4d"  "\x55"  "\x4c"  "\x54"  "\x49"  "\x29"  "\x0a"  "\x0a"  "\x2f"  "\x2a"  "\x2a"  "\x0a"  "\x47"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x61"  "\x74"  "\x65"  "\x73"  "\x20"  "\x61"  "\x20"  "\x72"  "\x61"  "\x6e"  "\x64"  "\x6f"  "\x6d"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x75"  "\x73"  "\x69"  "\x6e"  "\x67"  "\x20"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x20"  "\x52"  "\x4e"  "\x47"  "\x2e"  "\x0a"  "\x0a"  "\x40"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x73"  "\x20"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x20"  "\x53"  "\x74"  "\x61"  "\x74"  "\x65"  "\x20"  "\x6f"  "\x66"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x52"  "\x4e"  "\x47"  "\x20"  "\x74"  "\x6f"  "\x20"  "\x75"  "\x73"  "\x65"  "\x2e"  "\x0a"  "\x2a"  "\x2f"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x28"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x29"  "\x20"  "\x28"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x75"  "\x6c"  "\x6f"  "\x6e"  "\x67"  "\x28"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x29"  "\x2a"  "\x54"  "\x59"  "\x43"  "\x48"  "\x45"  "\x5f"  "\x49"  "\x5f"  "\x44"  "\x4f"  "\x55"  "\x42"  "\x4c"  "\x45"  "\x5f"  "\x4d"  "\x55"  "\x4c"  "\x54"  "\x49"  "\x29"  "\x0a"  "\x0a"  "\x2f"  "\x2a"  "\x2a"  "\x0a"  "\x47"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x61"  "\x74"  "\x65"  "\x73"  "\x20"  "\x61"  "\x20"  "\x72"  "\x61"  "\x6e"  "\x64"  "\x6f"  "\x6d"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x75"  "\x73"  "\x69"  "\x6e"  "\x67"  "\x20"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x20"  "\x52"  "\x4e"  "\x47"  "\x2e"  "\x20"  "\x53"  "\x69"  "\x6e"  "\x63"  "\x65"  "\x20"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x73"  "\x20"  "\x36"  "\x34"  "\x2d"  "\x62"  "\x69"  "\x74"  "\x20"  "\x6e"  "\x75"  "\x6d"  "\x62"  "\x65"  "\x72"  "\x73"  "\x20"  "\x74"  "\x68"  "\x69"  "\x73"  "\x20"  "\x69"  "\x73"  "\x20"  "\x65"  "\x71"  "\x75"  "\x69"  "\x76"  "\x61"  "\x6c"  "\x65"  "\x6e"  "\x74"  "\x20"  "\x74"  "\x6f"  "\x20"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x2e"  "\x0a"  "\x0a"  "\x40"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x73"  "\x20"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x20"  "\x53"  "\x74"  "\x61"  "\x74"  "\x65"  "\x20"  "\x6f"  "\x66"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x52"  "\x4e"  "\x47"  "\x20"  "\x74"  "\x6f"  "\x20"  "\x75"  "\x73"  "\x65"  "\x2e"  "\x0a"  "\x2a"  "\x2f"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x32"  "\x28"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x29"  "\x20"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x28"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x29"  "\x0a"  "\x0a"  "\x23"  "\x65"  "\x6e"  "\x64"  "\x69"  "\x66"  "\x20"  "\x2f"  "\x2f"  "\x5f"  "\x5f"  "\x54"  "\x59"  "\x43"  "\x48"  "\x45"  "\x5f"  "\x49"  "\x5f"  "\x43"  "\x4c"  "\x0a"  "\x23"  "\x69"  "\x66"  "\x6e"  "\x64"  "\x65"  "\x66"  "\x20"  "\x5f"  "\x5f"  "\x43"  "\x4f"  "\x4e"  "\x53"  "\x54"  "\x41"  "\x4e"  "\x54"  "\x53"  "\x5f"  "\x48"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x5f"  "\x5f"  "\x43"  "\x4f"  "\x4e"  "\x53"  "\x54"  "\x41"  "\x4e"  "\x54"  "\x53"  "\x5f"  "\x48"  "\x0a"  "\x0a"  "\x23"  "\x69"  "\x66"  "\x6e"  "\x64"  "\x65"  "\x66"  "\x20"  "\x4d"  "\x5f"  "\x50"  "\x49"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x4d"  "\x5f"  "\x50"  "\x49"  "\x20"  "\x33"  "\x2e"  "\x31"  "\x34"  "\x31"  "\x35"  "\x39"  "\x32"  "\x36"  "\x35"  "\x33"  "\x35"  "\x38"  "\x39"  "\x37"  "\x39"  "\x33"  "\x32"  "\x33"  "\x38"  "\x34"  "\x36"  "\x0a"  "\x23"  "\x65"  "\x6e"  "\x64"  "\x69"  "\x66"  "\x0a"  "\x0a"  "\x23"  "\x69"  "\x66"  "\x6e"  "\x64"  "\x65"  "\x66"  "\x20"  "\x4d"  "\x5f"  "\x45"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x4d"  "\x5f"  "\x45"  "\x20"  "\x32"  "\x2e"  "\x37"  "\x31"  "\x38"  "\x32"  "\x38"  "\x31"  "\x38"  "\x32"  "\x38"  "\x34"  "\x35"  "\x39"  "\x30"  "\x34"  "\x35"  "\x32"  "\x33"  "\x35"  "\x34"  "\x0a"  "\x23"  "\x65"  "\x6e"  "\x64"  "\x69"  "\x66"  "\x0a"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x48"  "\x42"  "\x41"  "\x52"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x35"  "\x34"  "\x35"  "\x37"  "\x31"  "\x38"  "\x31"  "\x37"  "\x65"  "\x2d"  "\x33"  "\x34"  "\x20"  "\x2f"  "\x2f"  "\x20"  "\x4a"  "\x2a"  "\x73"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x51"  "\x45"  "\x20"  "\x31"  "\x2e"  "\x36"  "\x30"  "\x32"  "\x31"  "\x37"  "\x36"  "\x36"  "\x33"  "\x34"  "\x65"  "\x2d"  "\x31"  "\x39"  "\x20"  "\x2f"  "\x2f"  "\x20"  "\x43"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x4d"  "\x55"  "\x5f"  "\x42"  "\x20"  "\x39"  "\x2e"  "\x32"  "\x37"  "\x34"  "\x30"  "\x31"  "\x30"  "\x30"  "\x37"  "\x38"  "\x33"  "\x65"  "\x2d"  "\x32"  "\x34"  "\x20"  "\x2f"  "\x2f"  "\x20"  "\x4a"  "\x2f"  "\x54"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x4d"  "\x55"  "\x5f"  "\x30"  "\x20"  "\x31"  "\x2e"  "\x32"  "\x35"  "\x36"  "\x36"  "\x33"  "\x37"  "\x30"  "\x36"  "\x32"  "\x31"  "\x32"  "\x65"  "\x2d"  "\x36"  "\x20"  "\x2f"  "\x2f"  "\x20"  "\x4e"  "\x2f"  "\x41"  "\x5e"  "\x32"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x4b"  "\x42"  "\x20"  "\x31"  "\x2e"  "\x33"  "\x38"  "\x30"  "\x36"  "\x34"  "\x39"  "\x65"  "\x2d"  "\x32"  "\x33"  "\x20"  "\x2f"  "\x2f"  "\x20"  "\x4a"  "\x2f"  "\x4b"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x4e"  "\x53"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x65"  "\x2d"  "\x39"  "\x20"  "\x2f"  "\x2f"  "\x20"  "\x73"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x4e"  "\x41"  "\x4e"  "\x4f"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x65"  "\x2d"  "\x39"  "\x0a"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x55"  "\x4e"  "\x55"  "\x53"  "\x45"  "\x44"  "\x28"  "\x78"  "\x29"  "\x20"  "\x28"  "\x28"  "\x76"  "\x6f"  "\x69"  "\x64"  "\x29"  "\x78"  "\x29"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x53"  "\x49"  "\x47"  "\x4e"  "\x28"  "\x78"  "\x29"  "\x20"  "\x28"  "\x28"  "\x78"  "\x29"  "\x20"  "\x3e"  "\x20"  "\x30"  "\x20"  "\x3f"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x3a"  "\x20"  "\x2d"  "\x31"  "\x2e"  "\x30"  "\x29"  "\x0a"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x49"  "\x4e"  "\x43"  "\x45"  "\x50"  "\x54"  "\x49"  "\x4f"  "\x4e"  "\x28"  "\x4d"  "\x29"  "\x0a"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x4c"  "\x4f"  "\x43"  "\x28"  "\x72"  "\x6f"  "\x77"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x2c"  "\x20"  "\x64"  "\x65"  "\x70"  "\x74"  "\x68"  "\x2c"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x20"  "\x28"  "\x28"  "\x63"  "\x6f"  "\x6c"  "\x29"  "\x20"  "\x2b"  "\x20"  "\x28"  "\x72"  "\x6f"  "\x77"  "\x29"  "\x20"  "\x2a"  "\x20"  "\x28"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x20"  "\x2b"  "\x20"  "\x28"  "\x64"  "\x65"  "\x70"  "\x74"  "\x68"  "\x29"  "\x20"  "\x2a"  "\x20"  "\x28"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x20"  "\x2a"  "\x20"  "\x28"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x29"  "\x29"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x45"  "\x50"  "\x53"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x65"  "\x2d"  "\x31"  "\x32"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x43"  "\x4c"  "\x4f"  "\x53"  "\x45"  "\x5f"  "\x45"  "\x4e"  "\x4f"  "\x55"  "\x47"  "\x48"  "\x28"  "\x78"  "\x2c"  "\x20"  "\x79"  "\x2c"  "\x20"  "\x65"  "\x70"  "\x73"  "\x29"  "\x20"  "\x28"  "\x28"  "\x53"  "\x49"  "\x47"  "\x4e"  "\x28"  "\x28"  "\x78"  "\x29"  "\x20"  "\x2d"  "\x20"  "\x28"  "\x79"  "\x29"  "\x29"  "\x20"  "\x2a"  "\x20"  "\x28"  "\x28"  "\x78"  "\x29"  "\x20"  "\x2d"  "\x20"  "\x28"  "\x79"  "\x29"  "\x29"  "\x29"  "\x20"  "\x3c"  "\x3d"  "\x20"  "\x28"  "\x65"  "\x70"  "\x73"  "\x29"  "\x29"  "\x0a"  "\x0a"  "\x23"  "\x69"  "\x66"  "\x6e"  "\x64"  "\x65"  "\x66"  "\x20"  "\x4f"  "\x50"  "\x45"  "\x4e"  "\x43"  "\x4c"  "\x5f"  "\x43"  "\x4f"  "\x4d"  "\x50"  "\x49"  "\x4c"  "\x41"  "\x54"  "\x49"  "\x4f"  "\x4e"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x4c"  "\x4f"  "\x43"  "\x41"  "\x4c"  "\x20"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x50"  "\x52"  "\x49"  "\x56"  "\x41"  "\x54"  "\x45"  "\x20"  "\x0a"  "\x23"  "\x65"  "\x6c"  "\x73"  "\x65"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x67"  "\x6c"  "\x6f"  "\x62"  "\x61"  "\x6c"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x4c"  "\x4f"  "\x43"  "\x41"  "\x4c"  "\x20"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x50"  "\x52"  "\x49"  "\x56"  "\x41"  "\x54"  "\x45"  "\x20"  "\x70"  "\x72"  "\x69"  "\x76"  "\x61"  "\x74"  "\x65"  "\x0a"  "\x23"  "\x65"  "\x6e"  "\x64"  "\x69"  "\x66"  "\x0a"  "\x0a"  "\x23"  "\x65"  "\x6e"  "\x64"  "\x69"  "\x66"  "\x0a"  "\x23"  "\x69"  "\x66"  "\x6e"  "\x64"  "\x65"  "\x66"  "\x20"  "\x5f"  "\x5f"  "\x56"  "\x33"  "\x44"  "\x5f"  "\x48"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x5f"  "\x5f"  "\x56"  "\x33"  "\x44"  "\x5f"  "\x48"  "\x0a"  "\x0a"  "\x74"  "\x79"  "\x70"  "\x65"  "\x64"  "\x65"  "\x66"  "\x20"  "\x73"  "\x74"  "\x72"  "\x75"  "\x63"  "\x74"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x78"  "\x2c"  "\x20"  "\x79"  "\x2c"  "\x20"  "\x7a"  "\x3b"  "\x0a"  "\x7d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x3b"  "\x0a"  "\x0a"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x28"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x78"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x79"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x7a"  "\x29"  "\x3b"  "\x0a"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x28"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x78"  "\x29"  "\x3b"  "\x0a"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x73"  "\x29"  "\x3b"  "\x0a"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x31"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x32"  "\x29"  "\x3b"  "\x0a"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x62"  "\x28"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x31"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x32"  "\x29"  "\x3b"  "\x0a"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x72"  "\x6f"  "\x73"  "\x73"  "\x28"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x31"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x32"  "\x29"  "\x3b"  "\x0a"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x6e"  "\x6f"  "\x72"  "\x6d"  "\x61"  "\x6c"  "\x69"  "\x7a"  "\x65"  "\x28"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x29"  "\x3b"  "\x0a"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x64"  "\x6f"  "\x74"  "\x28"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x31"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x32"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x23"  "\x65"  "\x6e"  "\x64"  "\x69"  "\x66"  "\x0a"  "\x23"  "\x69"  "\x66"  "\x6e"  "\x64"  "\x65"  "\x66"  "\x20"  "\x5f"  "\x5f"  "\x47"  "\x52"  "\x49"  "\x44"  "\x5f"  "\x48"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x5f"  "\x5f"  "\x47"  "\x52"  "\x49"  "\x44"  "\x5f"  "\x48"  "\x0a"  "\x0a"  "\x0a"  "\x0a"  "\x0a"  "\x0a"  "\x2f"  "\x2a"  "\x74"  "\x79"  "\x70"  "\x65"  "\x64"  "\x65"  "\x66"  "\x20"  "\x65"  "\x6e"  "\x75"  "\x6d"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x52"  "\x5f"  "\x69"  "\x6a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x3d"  "\x20"  "\x30"  "\x2c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x52"  "\x5f"  "\x69"  "\x6a"  "\x5f"  "\x43"  "\x52"  "\x4f"  "\x53"  "\x53"  "\x5f"  "\x5a"  "\x20"  "\x3d"  "\x20"  "\x31"  "\x2c"  "\x0a"  "\x7d"  "\x20"  "\x64"  "\x6d"  "\x5f"  "\x73"  "\x79"  "\x6d"  "\x6d"  "\x65"  "\x74"  "\x72"  "\x79"  "\x3b"  "\x2a"  "\x2f"  "\x0a"  "\x0a"  "\x74"  "\x79"  "\x70"  "\x65"  "\x64"  "\x65"  "\x66"  "\x20"  "\x65"  "\x6e"  "\x75"  "\x6d"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x43"  "\x55"  "\x52"  "\x5f"  "\x4e"  "\x4f"  "\x4e"  "\x45"  "\x20"  "\x3d"  "\x20"  "\x30"  "\x2c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x43"  "\x55"  "\x52"  "\x5f"  "\x53"  "\x54"  "\x54"  "\x20"  "\x3d"  "\x20"  "\x31"  "\x2c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x43"  "\x55"  "\x52"  "\x5f"  "\x53"  "\x48"  "\x45"  "\x20"  "\x3d"  "\x20"  "\x32"  "\x2c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x43"  "\x55"  "\x52"  "\x5f"  "\x42"  "\x4f"  "\x54"  "\x48"  "\x20"  "\x3d"  "\x20"  "\x43"  "\x55"  "\x52"  "\x5f"  "\x53"  "\x54"  "\x54"  "\x20"  "\x7c"  "\x20"  "\x43"  "\x55"  "\x52"  "\x5f"  "\x53"  "\x48"  "\x45"  "\x20"  "\x2f"  "\x2f"  "\x3d"  "\x33"  "\x0a"  "\x7d"  "\x20"  "\x63"  "\x75"  "\x72"  "\x72"  "\x65"  "\x6e"  "\x74"  "\x5f"  "\x74"  "\x79"  "\x70"  "\x65"  "\x3b"  "\x0a"  "\x0a"  "\x74"  "\x79"  "\x70"  "\x65"  "\x64"  "\x65"  "\x66"  "\x20"  "\x73"  "\x74"  "\x72"  "\x75"  "\x63"  "\x74"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x70"  "\x62"  "\x63"  "\x5f"  "\x78"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x70"  "\x62"  "\x63"  "\x5f"  "\x79"  "\x3b"  "\x0a"  "\x7d"  "\x20"  "\x70"  "\x62"  "\x63"  "\x5f"  "\x72"  "\x75"  "\x6c"  "\x65"  "\x73"  "\x3b"  "\x0a"  "\x0a"  "\x74"  "\x79"  "\x70"  "\x65"  "\x64"  "\x65"  "\x66"  "\x20"  "\x73"  "\x74"  "\x72"  "\x75"  "\x63"  "\x74"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6a"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x69"  "\x7a"  "\x61"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x2c"  "\x20"  "\x62"  "\x65"  "\x74"  "\x61"  "\x3b"  "\x0a"  "\x7d"  "\x20"  "\x73"  "\x74"  "\x74"  "\x5f"  "\x63"  "\x75"  "\x72"  "\x72"  "\x65"  "\x6e"  "\x74"  "\x3b"  "\x0a"  "\x0a"  "\x74"  "\x79"  "\x70"  "\x65"  "\x64"  "\x65"  "\x66"  "\x20"  "\x73"  "\x74"  "\x72"  "\x75"  "\x63"  "\x74"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x70"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x74"  "\x68"  "\x65"  "\x74"  "\x61"  "\x5f"  "\x73"  "\x68"  "\x2c"  "\x20"  "\x62"  "\x65"  "\x74"  "\x61"  "\x3b"  "\x0a"  "\x7d"  "\x20"  "\x73"  "\x68"  "\x65"  "\x5f"  "\x63"  "\x75"  "\x72"  "\x72"  "\x65"  "\x6e"  "\x74"  "\x3b"  "\x0a"  "\x0a"  "\x74"  "\x79"  "\x70"  "\x65"  "\x64"  "\x65"  "\x66"  "\x20"  "\x73"  "\x74"  "\x72"  "\x75"  "\x63"  "\x74"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x73"  "\x74"  "\x74"  "\x5f"  "\x63"  "\x75"  "\x72"  "\x72"  "\x65"  "\x6e"  "\x74"  "\x20"  "\x73"  "\x74"  "\x74"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x73"  "\x68"  "\x65"  "\x5f"  "\x63"  "\x75"  "\x72"  "\x72"  "\x65"  "\x6e"  "\x74"  "\x20"  "\x73"  "\x68"  "\x65"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x75"  "\x72"  "\x72"  "\x65"  "\x6e"  "\x74"  "\x5f"  "\x74"  "\x79"  "\x70"  "\x65"  "\x20"  "\x74"  "\x79"  "\x70"  "\x65"  "\x3b"  "\x0a"  "\x7d"  "\x20"  "\x63"  "\x75"  "\x72"  "\x72"  "\x65"  "\x6e"  "\x74"  "\x3b"  "\x0a"  "\x0a"  "\x74"  "\x79"  "\x70"  "\x65"  "\x64"  "\x65"  "\x66"  "\x20"  "\x73"  "\x74"  "\x72"  "\x75"  "\x63"  "\x74"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x64"  "\x69"  "\x72"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x61"  "\x6e"  "\x69"  "\x3b"  "\x0a"  "\x7d"  "\x20"  "\x61"  "\x6e"  "\x69"  "\x73"  "\x6f"  "\x74"  "\x72"  "\x6f"  "\x70"  "\x79"  "\x3b"  "\x0a"  "\x0a"  "\x74"  "\x79"  "\x70"  "\x65"  "\x64"  "\x65"  "\x66"  "\x20"  "\x73"  "\x74"  "\x72"  "\x75"  "\x63"  "\x74"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x64"  "\x69"  "\x72"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x68"  "\x61"  "\x72"  "\x20"  "\x70"  "\x69"  "\x6e"  "\x6e"  "\x65"  "\x64"  "\x3b"  "\x0a"  "\x7d"  "\x20"  "\x70"  "\x69"  "\x6e"  "\x6e"  "\x69"  "\x6e"  "\x67"  "\x3b"  "\x0a"  "\x0a"  "\x74"  "\x79"  "\x70"  "\x65"  "\x64"  "\x65"  "\x66"  "\x20"  "\x73"  "\x74"  "\x72"  "\x75"  "\x63"  "\x74"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x64"  "\x6d"  "\x76"  "\x5f"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x2c"  "\x20"  "\x64"  "\x6d"  "\x76"  "\x5f"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x2c"  "\x20"  "\x64"  "\x6d"  "\x76"  "\x5f"  "\x75"  "\x70"  "\x2c"  "\x20"  "\x64"  "\x6d"  "\x76"  "\x5f"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x3b"  "\x0a"  "\x7d"  "\x20"  "\x64"  "\x6d"  "\x5f"  "\x69"  "\x6e"  "\x74"  "\x65"  "\x72"  "\x61"  "\x63"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x3b"  "\x0a"  "\x0a"  "\x74"  "\x79"  "\x70"  "\x65"  "\x64"  "\x65"  "\x66"  "\x20"  "\x73"  "\x74"  "\x72"  "\x75"  "\x63"  "\x74"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x65"  "\x78"  "\x63"  "\x68"  "\x61"  "\x6e"  "\x67"  "\x65"  "\x2c"  "\x20"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x2c"  "\x20"  "\x63"  "\x75"  "\x62"  "\x69"  "\x63"  "\x5f"  "\x61"  "\x6e"  "\x69"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x6d"  "\x75"  "\x2c"  "\x20"  "\x61"  "\x6c"  "\x70"  "\x68"  "\x61"  "\x2c"  "\x20"  "\x67"  "\x61"  "\x6d"  "\x6d"  "\x61"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x61"  "\x6e"  "\x69"  "\x73"  "\x6f"  "\x74"  "\x72"  "\x6f"  "\x70"  "\x79"  "\x20"  "\x61"  "\x6e"  "\x69"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x69"  "\x6e"  "\x6e"  "\x69"  "\x6e"  "\x67"  "\x20"  "\x70"  "\x69"  "\x6e"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6d"  "\x5f"  "\x69"  "\x6e"  "\x74"  "\x65"  "\x72"  "\x61"  "\x63"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x20"  "\x64"  "\x6d"  "\x3b"  "\x0a"  "\x7d"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x73"  "\x69"  "\x74"  "\x65"  "\x5f"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x73"  "\x3b"  "\x0a"  "\x0a"  "\x74"  "\x79"  "\x70"  "\x65"  "\x64"  "\x65"  "\x66"  "\x20"  "\x73"  "\x74"  "\x72"  "\x75"  "\x63"  "\x74"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x75"  "\x6e"  "\x73"  "\x69"  "\x67"  "\x6e"  "\x65"  "\x64"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x62"  "\x63"  "\x5f"  "\x72"  "\x75"  "\x6c"  "\x65"  "\x73"  "\x20"  "\x70"  "\x62"  "\x63"  "\x3b"  "\x0a"  "\x7d"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x3b"  "\x0a"  "\x0a"  "\x74"  "\x79"  "\x70"  "\x65"  "\x64"  "\x65"  "\x66"  "\x20"  "\x73"  "\x74"  "\x72"  "\x75"  "\x63"  "\x74"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x2c"  "\x20"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x2c"  "\x20"  "\x75"  "\x70"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x3b"  "\x0a"  "\x7d"  "\x20"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x62"  "\x6f"  "\x72"  "\x73"  "\x5f"  "\x73"  "\x65"  "\x74"  "\x3b"  "\x0a"  "\x0a"  "\x74"  "\x79"  "\x70"  "\x65"  "\x64"  "\x65"  "\x66"  "\x20"  "\x73"  "\x74"  "\x72"  "\x75"  "\x63"  "\x74"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6d"  "\x61"  "\x67"  "\x6e"  "\x65"  "\x74"  "\x69"  "\x63"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x5f"  "\x66"  "\x69"  "\x6e"  "\x69"  "\x74"  "\x65"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6d"  "\x61"  "\x67"  "\x6e"  "\x65"  "\x74"  "\x69"  "\x63"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x5f"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x65"  "\x6c"  "\x65"  "\x63"  "\x74"  "\x72"  "\x69"  "\x63"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x61"  "\x76"  "\x67"  "\x5f"  "\x6d"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x5f"  "\x63"  "\x65"  "\x6e"  "\x74"  "\x65"  "\x72"  "\x5f"  "\x78"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x5f"  "\x63"  "\x65"  "\x6e"  "\x74"  "\x65"  "\x72"  "\x5f"  "\x79"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x61"  "\x62"  "\x73"  "\x5f"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x5f"  "\x63"  "\x65"  "\x6e"  "\x74"  "\x65"  "\x72"  "\x5f"  "\x78"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x61"  "\x62"  "\x73"  "\x5f"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x5f"  "\x63"  "\x65"  "\x6e"  "\x74"  "\x65"  "\x72"  "\x5f"  "\x79"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x5f"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x5f"  "\x66"  "\x69"  "\x6e"  "\x69"  "\x74"  "\x65"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x61"  "\x62"  "\x73"  "\x5f"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x5f"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x61"  "\x62"  "\x73"  "\x5f"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x5f"  "\x66"  "\x69"  "\x6e"  "\x69"  "\x74"  "\x65"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x65"  "\x78"  "\x63"  "\x68"  "\x61"  "\x6e"  "\x67"  "\x65"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x64"  "\x6d"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x61"  "\x6e"  "\x69"  "\x73"  "\x6f"  "\x74"  "\x72"  "\x6f"  "\x70"  "\x79"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x63"  "\x75"  "\x62"  "\x69"  "\x63"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x44"  "\x5f"  "\x78"  "\x78"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x44"  "\x5f"  "\x79"  "\x79"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x44"  "\x5f"  "\x78"  "\x79"  "\x3b"  "\x20"  "\x2f"  "\x2f"  "\x3d"  "\x44"  "\x5f"  "\x79"  "\x78"  "\x0a"  "\x7d"  "\x20"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x72"  "\x6d"  "\x61"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x5f"  "\x70"  "\x61"  "\x63"  "\x6b"  "\x65"  "\x64"  "\x3b"  "\x0a"  "\x0a"  "\x23"  "\x65"  "\x6e"  "\x64"  "\x69"  "\x66"  "\x0a"  "\x23"  "\x69"  "\x66"  "\x6e"  "\x64"  "\x65"  "\x66"  "\x20"  "\x5f"  "\x5f"  "\x52"  "\x41"  "\x4e"  "\x44"  "\x4f"  "\x4d"  "\x5f"  "\x48"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x5f"  "\x5f"  "\x52"  "\x41"  "\x4e"  "\x44"  "\x4f"  "\x4d"  "\x5f"  "\x48"  "\x0a"  "\x0a"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x6e"  "\x73"  "\x72"  "\x61"  "\x6e"  "\x64"  "\x6f"  "\x6d"  "\x28"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x20"  "\x2a"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x73"  "\x74"  "\x61"  "\x72"  "\x74"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x65"  "\x6e"  "\x64"  "\x29"  "\x3b"  "\x0a"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x6e"  "\x6f"  "\x72"  "\x6d"  "\x61"  "\x6c"  "\x5f"  "\x64"  "\x69"  "\x73"  "\x74"  "\x72"  "\x69"  "\x62"  "\x75"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x5f"  "\x62"  "\x6f"  "\x78"  "\x5f"  "\x6d"  "\x75"  "\x6c"  "\x6c"  "\x65"  "\x72"  "\x28"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x20"  "\x2a"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x29"  "\x3b"  "\x0a"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x6e"  "\x6f"  "\x72"  "\x6d"  "\x61"  "\x6c"  "\x5f"  "\x64"  "\x69"  "\x73"  "\x74"  "\x72"  "\x69"  "\x62"  "\x75"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x28"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x20"  "\x2a"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x29"  "\x3b"  "\x0a"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x72"  "\x61"  "\x6e"  "\x64"  "\x6f"  "\x6d"  "\x5f"  "\x67"  "\x73"  "\x61"  "\x5f"  "\x28"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x20"  "\x2a"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x71"  "\x56"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x54"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x67"  "\x61"  "\x6d"  "\x6d"  "\x61"  "\x29"  "\x3b"  "\x0a"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x72"  "\x61"  "\x6e"  "\x64"  "\x6f"  "\x6d"  "\x5f"  "\x67"  "\x73"  "\x61"  "\x28"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x20"  "\x2a"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x71"  "\x56"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x54"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x5f"  "\x67"  "\x61"  "\x6d"  "\x6d"  "\x61"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x23"  "\x65"  "\x6e"  "\x64"  "\x69"  "\x66"  "\x0a"  "\x23"  "\x69"  "\x66"  "\x6e"  "\x64"  "\x65"  "\x66"  "\x20"  "\x5f"  "\x5f"  "\x53"  "\x49"  "\x4d"  "\x55"  "\x4c"  "\x41"  "\x54"  "\x49"  "\x4f"  "\x4e"  "\x5f"  "\x46"  "\x55"  "\x4e"  "\x43"  "\x53"  "\x5f"  "\x48"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x5f"  "\x5f"  "\x53"  "\x49"  "\x4d"  "\x55"  "\x4c"  "\x41"  "\x54"  "\x49"  "\x4f"  "\x4e"  "\x5f"  "\x46"  "\x55"  "\x4e"  "\x43"  "\x53"  "\x5f"  "\x48"  "\x0a"  "\x0a"  "\x0a"  "\x0a"  "\x0a"  "\x0a"  "\x0a"  "\x0a"  "\x74"  "\x79"  "\x70"  "\x65"  "\x64"  "\x65"  "\x66"  "\x20"  "\x73"  "\x74"  "\x72"  "\x75"  "\x63"  "\x74"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x73"  "\x69"  "\x74"  "\x65"  "\x5f"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x73"  "\x20"  "\x67"  "\x73"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x74"  "\x65"  "\x6d"  "\x70"  "\x65"  "\x72"  "\x61"  "\x74"  "\x75"  "\x72"  "\x65"  "\x5f"  "\x65"  "\x66"  "\x66"  "\x65"  "\x63"  "\x74"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x62"  "\x6f"  "\x72"  "\x73"  "\x5f"  "\x73"  "\x65"  "\x74"  "\x20"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x74"  "\x69"  "\x6d"  "\x65"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x50"  "\x52"  "\x49"  "\x56"  "\x41"  "\x54"  "\x45"  "\x20"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x20"  "\x2a"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x3b"  "\x0a"  "\x23"  "\x69"  "\x66"  "\x64"  "\x65"  "\x66"  "\x20"  "\x49"  "\x4e"  "\x43"  "\x4c"  "\x55"  "\x44"  "\x45"  "\x5f"  "\x44"  "\x49"  "\x50"  "\x4f"  "\x4c"  "\x41"  "\x52"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x3b"  "\x0a"  "\x23"  "\x65"  "\x6e"  "\x64"  "\x69"  "\x66"  "\x0a"  "\x7d"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x65"  "\x74"  "\x65"  "\x72"  "\x73"  "\x3b"  "\x0a"  "\x0a"  "\x76"  "\x33"  "\x64"  "\x20"  "\x61"  "\x70"  "\x70"  "\x6c"  "\x79"  "\x5f"  "\x70"  "\x62"  "\x63"  "\x28"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x2a"  "\x76"  "\x2c"  "\x20"  "\x70"  "\x62"  "\x63"  "\x5f"  "\x72"  "\x75"  "\x6c"  "\x65"  "\x73"  "\x20"  "\x70"  "\x62"  "\x63"  "\x2c"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x2c"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x2c"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x3b"  "\x0a"  "\x76"  "\x6f"  "\x69"  "\x64"  "\x20"  "\x61"  "\x70"  "\x70"  "\x6c"  "\x79"  "\x5f"  "\x70"  "\x62"  "\x63"  "\x5f"  "\x63"  "\x6f"  "\x6d"  "\x70"  "\x6c"  "\x65"  "\x74"  "\x65"  "\x28"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x73"  "\x69"  "\x74"  "\x65"  "\x5f"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x73"  "\x20"  "\x2a"  "\x67"  "\x73"  "\x2c"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x2a"  "\x76"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x2a"  "\x6f"  "\x75"  "\x74"  "\x2c"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x73"  "\x69"  "\x74"  "\x65"  "\x5f"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x73"  "\x20"  "\x2a"  "\x67"  "\x73"  "\x6f"  "\x75"  "\x74"  "\x2c"  "\x20"  "\x70"  "\x62"  "\x63"  "\x5f"  "\x72"  "\x75"  "\x6c"  "\x65"  "\x73"  "\x20"  "\x70"  "\x62"  "\x63"  "\x2c"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x2c"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x2c"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x3b"  "\x0a"  "\x76"  "\x33"  "\x64"  "\x20"  "\x67"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x61"  "\x74"  "\x65"  "\x5f"  "\x6d"  "\x61"  "\x67"  "\x6e"  "\x65"  "\x74"  "\x69"  "\x63"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x28"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x73"  "\x69"  "\x74"  "\x65"  "\x5f"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x73"  "\x20"  "\x67"  "\x73"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x74"  "\x69"  "\x6d"  "\x65"  "\x29"  "\x3b"  "\x0a"  "\x63"  "\x75"  "\x72"  "\x72"  "\x65"  "\x6e"  "\x74"  "\x20"  "\x67"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x61"  "\x74"  "\x65"  "\x5f"  "\x63"  "\x75"  "\x72"  "\x72"  "\x65"  "\x6e"  "\x74"  "\x28"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x73"  "\x69"  "\x74"  "\x65"  "\x5f"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x73"  "\x20"  "\x67"  "\x73"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x74"  "\x69"  "\x6d"  "\x65"  "\x29"  "\x3b"  "\x0a"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x67"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x61"  "\x74"  "\x65"  "\x5f"  "\x74"  "\x65"  "\x6d"  "\x70"  "\x65"  "\x72"  "\x61"  "\x74"  "\x75"  "\x72"  "\x65"  "\x28"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x73"  "\x69"  "\x74"  "\x65"  "\x5f"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x73"  "\x20"  "\x67"  "\x73"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x74"  "\x69"  "\x6d"  "\x65"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x65"  "\x78"  "\x63"  "\x68"  "\x61"  "\x6e"  "\x67"  "\x65"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x65"  "\x74"  "\x65"  "\x72"  "\x73"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x29"  "\x3b"  "\x0a"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x64"  "\x6d"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x65"  "\x74"  "\x65"  "\x72"  "\x73"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x29"  "\x3b"  "\x0a"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x61"  "\x6e"  "\x69"  "\x73"  "\x6f"  "\x74"  "\x72"  "\x6f"  "\x70"  "\x79"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x65"  "\x74"  "\x65"  "\x72"  "\x73"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x29"  "\x3b"  "\x0a"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x63"  "\x75"  "\x62"  "\x69"  "\x63"  "\x5f"  "\x61"  "\x6e"  "\x69"  "\x73"  "\x6f"  "\x74"  "\x72"  "\x6f"  "\x70"  "\x79"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x65"  "\x74"  "\x65"  "\x72"  "\x73"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x29"  "\x3b"  "\x0a"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x65"  "\x74"  "\x65"  "\x72"  "\x73"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x29"  "\x3b"  "\x0a"  "\x23"  "\x69"  "\x66"  "\x64"  "\x65"  "\x66"  "\x20"  "\x49"  "\x4e"  "\x43"  "\x4c"  "\x55"  "\x44"  "\x45"  "\x5f"  "\x44"  "\x49"  "\x50"  "\x4f"  "\x4c"  "\x41"  "\x52"  "\x0a"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x65"  "\x74"  "\x65"  "\x72"  "\x73"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x29"  "\x3b"  "\x0a"  "\x23"  "\x65"  "\x6e"  "\x64"  "\x69"  "\x66"  "\x0a"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x65"  "\x74"  "\x65"  "\x72"  "\x73"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x23"  "\x69"  "\x66"  "\x64"  "\x65"  "\x66"  "\x20"  "\x49"  "\x4e"  "\x43"  "\x4c"  "\x55"  "\x44"  "\x45"  "\x5f"  "\x44"  "\x49"  "\x50"  "\x4f"  "\x4c"  "\x41"  "\x52"  "\x0a"  "\x76"  "\x33"  "\x64"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x65"  "\x74"  "\x65"  "\x72"  "\x73"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x29"  "\x3b"  "\x0a"  "\x23"  "\x65"  "\x6e"  "\x64"  "\x69"  "\x66"  "\x0a"  "\x76"  "\x33"  "\x64"  "\x20"  "\x65"  "\x66"  "\x66"  "\x65"  "\x63"  "\x74"  "\x69"  "\x76"  "\x65"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x65"  "\x74"  "\x65"  "\x72"  "\x73"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x29"  "\x3b"  "\x0a"  "\x76"  "\x33"  "\x64"  "\x20"  "\x64"  "\x6d"  "\x5f"  "\x64"  "\x74"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x65"  "\x74"  "\x65"  "\x72"  "\x73"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x64"  "\x74"  "\x29"  "\x3b"  "\x0a"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x64"  "\x6f"  "\x74"  "\x5f"  "\x67"  "\x72"  "\x61"  "\x64"  "\x28"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x2c"  "\x20"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x62"  "\x6f"  "\x72"  "\x73"  "\x5f"  "\x73"  "\x65"  "\x74"  "\x20"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x64"  "\x78"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x64"  "\x79"  "\x29"  "\x3b"  "\x0a"  "\x76"  "\x33"  "\x64"  "\x20"  "\x73"  "\x74"  "\x65"  "\x70"  "\x5f"  "\x6c"  "\x6c"  "\x67"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x65"  "\x74"  "\x65"  "\x72"  "\x73"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x64"  "\x74"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x5f"  "\x66"  "\x69"  "\x6e"  "\x69"  "\x74"  "\x65"  "\x28"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6d"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x75"  "\x70"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x29"  "\x3b"  "\x0a"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x5f"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x28"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6d"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x75"  "\x70"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x76"  "\x33"  "\x64"  "\x20"  "\x65"  "\x6d"  "\x65"  "\x72"  "\x67"  "\x65"  "\x6e"  "\x74"  "\x5f"  "\x6d"  "\x61"  "\x67"  "\x6e"  "\x65"  "\x74"  "\x69"  "\x63"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x5f"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x28"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6d"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x75"  "\x70"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x29"  "\x3b"  "\x0a"  "\x76"  "\x33"  "\x64"  "\x20"  "\x65"  "\x6d"  "\x65"  "\x72"  "\x67"  "\x65"  "\x6e"  "\x74"  "\x5f"  "\x6d"  "\x61"  "\x67"  "\x6e"  "\x65"  "\x74"  "\x69"  "\x63"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x5f"  "\x66"  "\x69"  "\x6e"  "\x69"  "\x74"  "\x65"  "\x28"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6d"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x75"  "\x70"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x29"  "\x3b"  "\x0a"  "\x76"  "\x33"  "\x64"  "\x20"  "\x65"  "\x6d"  "\x65"  "\x72"  "\x67"  "\x65"  "\x6e"  "\x74"  "\x5f"  "\x65"  "\x6c"  "\x65"  "\x63"  "\x74"  "\x72"  "\x69"  "\x63"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x28"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6d"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x75"  "\x70"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x64"  "\x6d"  "\x64"  "\x74"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x64"  "\x78"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x64"  "\x79"  "\x29"  "\x3b"  "\x0a"  "\x23"  "\x65"  "\x6e"  "\x64"  "\x69"  "\x66"  "\x0a"  "\x23"  "\x69"  "\x66"  "\x6e"  "\x64"  "\x65"  "\x66"  "\x20"  "\x5f"  "\x5f"  "\x43"  "\x4f"  "\x4c"  "\x4f"  "\x52"  "\x53"  "\x5f"  "\x48"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x5f"  "\x5f"  "\x43"  "\x4f"  "\x4c"  "\x4f"  "\x52"  "\x53"  "\x5f"  "\x48"  "\x0a"  "\x0a"  "\x0a"  "\x0a"  "\x0a"  "\x0a"  "\x0a"  "\x23"  "\x69"  "\x66"  "\x64"  "\x65"  "\x66"  "\x20"  "\x4f"  "\x50"  "\x45"  "\x4e"  "\x43"  "\x4c"  "\x5f"  "\x43"  "\x4f"  "\x4d"  "\x50"  "\x49"  "\x4c"  "\x41"  "\x54"  "\x49"  "\x4f"  "\x4e"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x75"  "\x69"  "\x6e"  "\x74"  "\x33"  "\x32"  "\x5f"  "\x74"  "\x20"  "\x75"  "\x63"  "\x68"  "\x61"  "\x72"  "\x34"  "\x0a"  "\x23"  "\x65"  "\x6e"  "\x64"  "\x69"  "\x66"  "\x0a"  "\x0a"  "\x74"  "\x79"  "\x70"  "\x65"  "\x64"  "\x65"  "\x66"  "\x20"  "\x75"  "\x6e"  "\x69"  "\x6f"  "\x6e"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x73"  "\x74"  "\x72"  "\x75"  "\x63"  "\x74"  "\x20"  "\x7b"  "\x20"  "\x75"  "\x6e"  "\x73"  "\x69"  "\x67"  "\x6e"  "\x65"  "\x64"  "\x20"  "\x63"  "\x68"  "\x61"  "\x72"  "\x20"  "\x62"  "\x2c"  "\x20"  "\x67"  "\x2c"  "\x20"  "\x72"  "\x2c"  "\x20"  "\x61"  "\x3b"  "\x20"  "\x7d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x73"  "\x74"  "\x72"  "\x75"  "\x63"  "\x74"  "\x20"  "\x7b"  "\x20"  "\x75"  "\x6e"  "\x73"  "\x69"  "\x67"  "\x6e"  "\x65"  "\x64"  "\x20"  "\x63"  "\x68"  "\x61"  "\x72"  "\x20"  "\x78"  "\x2c"  "\x20"  "\x79"  "\x2c"  "\x20"  "\x7a"  "\x2c"  "\x20"  "\x77"  "\x3b"  "\x20"  "\x7d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x2f"  "\x2f"  "\x63"  "\x6c"  "\x5f"  "\x63"  "\x68"  "\x61"  "\x72"  "\x34"  "\x20"  "\x63"  "\x6c"  "\x5f"  "\x72"  "\x67"  "\x62"  "\x61"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x75"  "\x69"  "\x6e"  "\x74"  "\x33"  "\x32"  "\x5f"  "\x74"  "\x20"  "\x62"  "\x67"  "\x72"  "\x61"  "\x3b"  "\x0a"  "\x7d"  "\x20"  "\x52"  "\x47"  "\x42"  "\x41"  "\x33"  "\x32"  "\x3b"  "\x0a"  "\x0a"  "\x52"  "\x47"  "\x42"  "\x41"  "\x33"  "\x32"  "\x20"  "\x6c"  "\x69"  "\x6e"  "\x65"  "\x61"  "\x72"  "\x5f"  "\x6d"  "\x61"  "\x70"  "\x70"  "\x69"  "\x6e"  "\x67"  "\x28"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x74"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x73"  "\x74"  "\x61"  "\x72"  "\x74"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6d"  "\x69"  "\x64"  "\x64"  "\x6c"  "\x65"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x65"  "\x6e"  "\x64"  "\x29"  "\x3b"  "\x0a"  "\x52"  "\x47"  "\x42"  "\x41"  "\x33"  "\x32"  "\x20"  "\x68"  "\x73"  "\x6c"  "\x5f"  "\x74"  "\x6f"  "\x5f"  "\x72"  "\x67"  "\x62"  "\x28"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x68"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x73"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x6c"  "\x29"  "\x3b"  "\x0a"  "\x52"  "\x47"  "\x42"  "\x41"  "\x33"  "\x32"  "\x20"  "\x6d"  "\x5f"  "\x74"  "\x6f"  "\x5f"  "\x68"  "\x73"  "\x6c"  "\x28"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6d"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x23"  "\x65"  "\x6e"  "\x64"  "\x69"  "\x66"  "\x0a"  "\x0a"  "\x0a"  "\x0a"  "\x0a"  "\x0a"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x28"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x78"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x79"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x7a"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x28"  "\x76"  "\x33"  "\x64"  "\x29"  "\x7b"  "\x2e"  "\x78"  "\x3d"  "\x78"  "\x2c"  "\x20"  "\x2e"  "\x79"  "\x3d"  "\x79"  "\x2c"  "\x20"  "\x2e"  "\x7a"  "\x3d"  "\x7a"  "\x7d"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x28"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x78"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x28"  "\x76"  "\x33"  "\x64"  "\x29"  "\x7b"  "\x2e"  "\x78"  "\x3d"  "\x78"  "\x2c"  "\x20"  "\x2e"  "\x79"  "\x3d"  "\x78"  "\x2c"  "\x20"  "\x2e"  "\x7a"  "\x3d"  "\x78"  "\x7d"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x73"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x2e"  "\x78"  "\x20"  "\x2a"  "\x3d"  "\x20"  "\x73"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x2e"  "\x79"  "\x20"  "\x2a"  "\x3d"  "\x20"  "\x73"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x2e"  "\x7a"  "\x20"  "\x2a"  "\x3d"  "\x20"  "\x73"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x76"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x31"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x32"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x31"  "\x2e"  "\x78"  "\x20"  "\x2b"  "\x3d"  "\x20"  "\x76"  "\x32"  "\x2e"  "\x78"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x31"  "\x2e"  "\x79"  "\x20"  "\x2b"  "\x3d"  "\x20"  "\x76"  "\x32"  "\x2e"  "\x79"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x31"  "\x2e"  "\x7a"  "\x20"  "\x2b"  "\x3d"  "\x20"  "\x76"  "\x32"  "\x2e"  "\x7a"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x76"  "\x31"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x62"  "\x28"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x31"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x32"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x31"  "\x2e"  "\x78"  "\x20"  "\x2d"  "\x3d"  "\x20"  "\x76"  "\x32"  "\x2e"  "\x78"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x31"  "\x2e"  "\x79"  "\x20"  "\x2d"  "\x3d"  "\x20"  "\x76"  "\x32"  "\x2e"  "\x79"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x31"  "\x2e"  "\x7a"  "\x20"  "\x2d"  "\x3d"  "\x20"  "\x76"  "\x32"  "\x2e"  "\x7a"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x76"  "\x31"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x72"  "\x6f"  "\x73"  "\x73"  "\x28"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x31"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x32"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x72"  "\x65"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x7b"  "\x30"  "\x7d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x2e"  "\x78"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x31"  "\x2e"  "\x79"  "\x20"  "\x2a"  "\x20"  "\x76"  "\x32"  "\x2e"  "\x7a"  "\x20"  "\x2d"  "\x20"  "\x76"  "\x31"  "\x2e"  "\x7a"  "\x20"  "\x2a"  "\x20"  "\x76"  "\x32"  "\x2e"  "\x79"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x2e"  "\x79"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x31"  "\x2e"  "\x7a"  "\x20"  "\x2a"  "\x20"  "\x76"  "\x32"  "\x2e"  "\x78"  "\x20"  "\x2d"  "\x20"  "\x76"  "\x31"  "\x2e"  "\x78"  "\x20"  "\x2a"  "\x20"  "\x76"  "\x32"  "\x2e"  "\x7a"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x2e"  "\x7a"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x31"  "\x2e"  "\x78"  "\x20"  "\x2a"  "\x20"  "\x76"  "\x32"  "\x2e"  "\x79"  "\x20"  "\x2d"  "\x20"  "\x76"  "\x31"  "\x2e"  "\x79"  "\x20"  "\x2a"  "\x20"  "\x76"  "\x32"  "\x2e"  "\x78"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x72"  "\x65"  "\x74"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x6e"  "\x6f"  "\x72"  "\x6d"  "\x61"  "\x6c"  "\x69"  "\x7a"  "\x65"  "\x28"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x4d"  "\x32"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x2e"  "\x78"  "\x20"  "\x2a"  "\x20"  "\x76"  "\x2e"  "\x78"  "\x20"  "\x2b"  "\x20"  "\x76"  "\x2e"  "\x79"  "\x20"  "\x2a"  "\x20"  "\x76"  "\x2e"  "\x79"  "\x20"  "\x2b"  "\x20"  "\x76"  "\x2e"  "\x7a"  "\x20"  "\x2a"  "\x20"  "\x76"  "\x2e"  "\x7a"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x43"  "\x4c"  "\x4f"  "\x53"  "\x45"  "\x5f"  "\x45"  "\x4e"  "\x4f"  "\x55"  "\x47"  "\x48"  "\x28"  "\x4d"  "\x32"  "\x2c"  "\x20"  "\x30"  "\x2c"  "\x20"  "\x45"  "\x50"  "\x53"  "\x29"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x76"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x4d"  "\x31"  "\x20"  "\x3d"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x20"  "\x2f"  "\x20"  "\x73"  "\x71"  "\x72"  "\x74"  "\x28"  "\x4d"  "\x32"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x2e"  "\x78"  "\x20"  "\x2a"  "\x3d"  "\x20"  "\x4d"  "\x31"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x2e"  "\x79"  "\x20"  "\x2a"  "\x3d"  "\x20"  "\x4d"  "\x31"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x2e"  "\x7a"  "\x20"  "\x2a"  "\x3d"  "\x20"  "\x4d"  "\x31"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x76"  "\x3b"  "\x0a"  "\x20"  "\x7d"  "\x0a"  "\x0a"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x64"  "\x6f"  "\x74"  "\x28"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x31"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x32"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x76"  "\x31"  "\x2e"  "\x78"  "\x20"  "\x2a"  "\x20"  "\x76"  "\x32"  "\x2e"  "\x78"  "\x20"  "\x2b"  "\x20"  "\x76"  "\x31"  "\x2e"  "\x79"  "\x20"  "\x2a"  "\x20"  "\x76"  "\x32"  "\x2e"  "\x79"  "\x20"  "\x2b"  "\x20"  "\x76"  "\x31"  "\x2e"  "\x7a"  "\x20"  "\x2a"  "\x20"  "\x76"  "\x32"  "\x2e"  "\x7a"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x0a"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x6e"  "\x73"  "\x72"  "\x61"  "\x6e"  "\x64"  "\x6f"  "\x6d"  "\x28"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x20"  "\x2a"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x73"  "\x74"  "\x61"  "\x72"  "\x74"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x65"  "\x6e"  "\x64"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x28"  "\x28"  "\x2a"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x29"  "\x29"  "\x20"  "\x2a"  "\x20"  "\x28"  "\x65"  "\x6e"  "\x64"  "\x20"  "\x2d"  "\x20"  "\x73"  "\x74"  "\x61"  "\x72"  "\x74"  "\x29"  "\x20"  "\x2b"  "\x20"  "\x73"  "\x74"  "\x61"  "\x72"  "\x74"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x6e"  "\x6f"  "\x72"  "\x6d"  "\x61"  "\x6c"  "\x5f"  "\x64"  "\x69"  "\x73"  "\x74"  "\x72"  "\x69"  "\x62"  "\x75"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x5f"  "\x62"  "\x6f"  "\x78"  "\x5f"  "\x6d"  "\x75"  "\x6c"  "\x6c"  "\x65"  "\x72"  "\x28"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x20"  "\x2a"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x75"  "\x31"  "\x20"  "\x3d"  "\x20"  "\x6e"  "\x73"  "\x72"  "\x61"  "\x6e"  "\x64"  "\x6f"  "\x6d"  "\x28"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2c"  "\x20"  "\x30"  "\x2c"  "\x20"  "\x31"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x75"  "\x32"  "\x20"  "\x3d"  "\x20"  "\x6e"  "\x73"  "\x72"  "\x61"  "\x6e"  "\x64"  "\x6f"  "\x6d"  "\x28"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2c"  "\x20"  "\x30"  "\x2c"  "\x20"  "\x31"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x73"  "\x71"  "\x72"  "\x74"  "\x28"  "\x2d"  "\x32"  "\x2e"  "\x30"  "\x20"  "\x2a"  "\x20"  "\x6c"  "\x6f"  "\x67"  "\x28"  "\x75"  "\x31"  "\x29"  "\x29"  "\x20"  "\x2a"  "\x20"  "\x63"  "\x6f"  "\x73"  "\x28"  "\x32"  "\x2e"  "\x30"  "\x20"  "\x2a"  "\x20"  "\x4d"  "\x5f"  "\x50"  "\x49"  "\x20"  "\x2a"  "\x20"  "\x75"  "\x32"  "\x29"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x6e"  "\x6f"  "\x72"  "\x6d"  "\x61"  "\x6c"  "\x5f"  "\x64"  "\x69"  "\x73"  "\x74"  "\x72"  "\x69"  "\x62"  "\x75"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x28"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x20"  "\x2a"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x66"  "\x6f"  "\x72"  "\x20"  "\x28"  "\x3b"  "\x3b"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x55"  "\x20"  "\x3d"  "\x20"  "\x6e"  "\x73"  "\x72"  "\x61"  "\x6e"  "\x64"  "\x6f"  "\x6d"  "\x28"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2c"  "\x20"  "\x30"  "\x2c"  "\x20"  "\x31"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x56"  "\x20"  "\x3d"  "\x20"  "\x6e"  "\x73"  "\x72"  "\x61"  "\x6e"  "\x64"  "\x6f"  "\x6d"  "\x28"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2c"  "\x20"  "\x30"  "\x2c"  "\x20"  "\x31"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x58"  "\x20"  "\x3d"  "\x20"  "\x73"  "\x71"  "\x72"  "\x74"  "\x28"  "\x38"  "\x2e"  "\x30"  "\x20"  "\x2f"  "\x20"  "\x4d"  "\x5f"  "\x45"  "\x29"  "\x20"  "\x2a"  "\x20"  "\x28"  "\x56"  "\x20"  "\x2d"  "\x20"  "\x30"  "\x2e"  "\x35"  "\x29"  "\x20"  "\x2f"  "\x20"  "\x55"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x58"  "\x32"  "\x20"  "\x3d"  "\x20"  "\x58"  "\x20"  "\x2a"  "\x20"  "\x58"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x58"  "\x32"  "\x20"  "\x3c"  "\x3d"  "\x20"  "\x28"  "\x35"  "\x2e"  "\x30"  "\x20"  "\x2d"  "\x20"  "\x34"  "\x2e"  "\x30"  "\x20"  "\x2a"  "\x20"  "\x65"  "\x78"  "\x70"  "\x28"  "\x30"  "\x2e"  "\x32"  "\x35"  "\x29"  "\x20"  "\x2a"  "\x20"  "\x55"  "\x29"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x58"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x65"  "\x6c"  "\x73"  "\x65"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x58"  "\x32"  "\x20"  "\x3e"  "\x3d"  "\x20"  "\x28"  "\x34"  "\x2e"  "\x30"  "\x20"  "\x2a"  "\x20"  "\x65"  "\x78"  "\x70"  "\x28"  "\x2d"  "\x31"  "\x2e"  "\x33"  "\x35"  "\x29"  "\x20"  "\x2f"  "\x20"  "\x55"  "\x20"  "\x2b"  "\x20"  "\x31"  "\x2e"  "\x34"  "\x29"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x74"  "\x69"  "\x6e"  "\x75"  "\x65"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x65"  "\x6c"  "\x73"  "\x65"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x58"  "\x32"  "\x20"  "\x3c"  "\x3d"  "\x20"  "\x28"  "\x2d"  "\x34"  "\x2e"  "\x30"  "\x20"  "\x2a"  "\x20"  "\x6c"  "\x6f"  "\x67"  "\x28"  "\x55"  "\x29"  "\x29"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x58"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7d"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x2f"  "\x2f"  "\x41"  "\x73"  "\x73"  "\x75"  "\x6d"  "\x65"  "\x20"  "\x44"  "\x3d"  "\x31"  "\x0a"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x72"  "\x61"  "\x6e"  "\x64"  "\x6f"  "\x6d"  "\x5f"  "\x67"  "\x73"  "\x61"  "\x5f"  "\x28"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x20"  "\x2a"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x71"  "\x56"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x54"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x67"  "\x61"  "\x6d"  "\x6d"  "\x61"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x64"  "\x78"  "\x20"  "\x3d"  "\x20"  "\x6e"  "\x73"  "\x72"  "\x61"  "\x6e"  "\x64"  "\x6f"  "\x6d"  "\x28"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2c"  "\x20"  "\x2d"  "\x31"  "\x30"  "\x2c"  "\x20"  "\x31"  "\x30"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x63"  "\x20"  "\x3d"  "\x20"  "\x73"  "\x71"  "\x72"  "\x74"  "\x28"  "\x28"  "\x71"  "\x56"  "\x20"  "\x2d"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x29"  "\x20"  "\x2f"  "\x20"  "\x4d"  "\x5f"  "\x50"  "\x49"  "\x29"  "\x20"  "\x2a"  "\x20"  "\x67"  "\x61"  "\x6d"  "\x6d"  "\x61"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x6f"  "\x77"  "\x28"  "\x54"  "\x2c"  "\x20"  "\x2d"  "\x31"  "\x2e"  "\x30"  "\x20"  "\x2f"  "\x20"  "\x28"  "\x33"  "\x2e"  "\x30"  "\x20"  "\x2d"  "\x20"  "\x71"  "\x56"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x6c"  "\x20"  "\x3d"  "\x20"  "\x70"  "\x6f"  "\x77"  "\x28"  "\x31"  "\x2e"  "\x30"  "\x20"  "\x2b"  "\x20"  "\x28"  "\x71"  "\x56"  "\x20"  "\x2d"  "\x20"  "\x31"  "\x29"  "\x20"  "\x2a"  "\x20"  "\x64"  "\x78"  "\x20"  "\x2a"  "\x20"  "\x64"  "\x78"  "\x20"  "\x2f"  "\x20"  "\x70"  "\x6f"  "\x77"  "\x28"  "\x54"  "\x2c"  "\x20"  "\x32"  "\x2e"  "\x30"  "\x20"  "\x2f"  "\x20"  "\x28"  "\x33"  "\x2e"  "\x30"  "\x20"  "\x2d"  "\x20"  "\x71"  "\x56"  "\x29"  "\x29"  "\x2c"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x20"  "\x2f"  "\x20"  "\x28"  "\x71"  "\x56"  "\x20"  "\x2d"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x63"  "\x20"  "\x2a"  "\x20"  "\x64"  "\x78"  "\x20"  "\x2f"  "\x20"  "\x6c"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x72"  "\x61"  "\x6e"  "\x64"  "\x6f"  "\x6d"  "\x5f"  "\x67"  "\x73"  "\x61"  "\x28"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x20"  "\x2a"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x71"  "\x56"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x54"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x5f"  "\x67"  "\x61"  "\x6d"  "\x6d"  "\x61"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x66"  "\x31"  "\x20"  "\x3d"  "\x20"  "\x65"  "\x78"  "\x70"  "\x28"  "\x6c"  "\x6f"  "\x67"  "\x28"  "\x54"  "\x29"  "\x20"  "\x2f"  "\x20"  "\x28"  "\x71"  "\x56"  "\x20"  "\x2d"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x66"  "\x32"  "\x20"  "\x3d"  "\x20"  "\x65"  "\x78"  "\x70"  "\x28"  "\x28"  "\x34"  "\x2e"  "\x30"  "\x20"  "\x2d"  "\x20"  "\x71"  "\x56"  "\x29"  "\x20"  "\x2a"  "\x20"  "\x6c"  "\x6f"  "\x67"  "\x28"  "\x71"  "\x56"  "\x20"  "\x2d"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x66"  "\x33"  "\x20"  "\x3d"  "\x20"  "\x65"  "\x78"  "\x70"  "\x28"  "\x28"  "\x32"  "\x2e"  "\x30"  "\x20"  "\x2d"  "\x20"  "\x71"  "\x56"  "\x29"  "\x20"  "\x2a"  "\x20"  "\x6c"  "\x6f"  "\x67"  "\x28"  "\x32"  "\x2e"  "\x30"  "\x29"  "\x20"  "\x2f"  "\x20"  "\x28"  "\x71"  "\x56"  "\x20"  "\x2d"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x66"  "\x34"  "\x20"  "\x3d"  "\x20"  "\x73"  "\x71"  "\x72"  "\x74"  "\x28"  "\x4d"  "\x5f"  "\x50"  "\x49"  "\x29"  "\x20"  "\x2a"  "\x20"  "\x66"  "\x31"  "\x20"  "\x2a"  "\x20"  "\x66"  "\x32"  "\x20"  "\x2f"  "\x20"  "\x28"  "\x66"  "\x33"  "\x20"  "\x2a"  "\x20"  "\x28"  "\x33"  "\x2e"  "\x30"  "\x20"  "\x2d"  "\x20"  "\x71"  "\x56"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x66"  "\x35"  "\x20"  "\x3d"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x20"  "\x2f"  "\x20"  "\x28"  "\x71"  "\x56"  "\x20"  "\x2d"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x29"  "\x20"  "\x2d"  "\x20"  "\x30"  "\x2e"  "\x35"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x66"  "\x36"  "\x20"  "\x3d"  "\x20"  "\x4d"  "\x5f"  "\x50"  "\x49"  "\x20"  "\x2a"  "\x20"  "\x28"  "\x31"  "\x2e"  "\x30"  "\x20"  "\x2d"  "\x20"  "\x66"  "\x35"  "\x29"  "\x20"  "\x2f"  "\x20"  "\x73"  "\x69"  "\x6e"  "\x28"  "\x4d"  "\x5f"  "\x50"  "\x49"  "\x20"  "\x2a"  "\x20"  "\x28"  "\x31"  "\x2e"  "\x30"  "\x20"  "\x2d"  "\x20"  "\x66"  "\x35"  "\x29"  "\x29"  "\x20"  "\x2f"  "\x20"  "\x74"  "\x67"  "\x61"  "\x6d"  "\x6d"  "\x61"  "\x28"  "\x32"  "\x2e"  "\x30"  "\x20"  "\x2d"  "\x20"  "\x66"  "\x35"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x73"  "\x69"  "\x67"  "\x6d"  "\x61"  "\x78"  "\x20"  "\x3d"  "\x20"  "\x65"  "\x78"  "\x70"  "\x28"  "\x2d"  "\x28"  "\x71"  "\x56"  "\x20"  "\x2d"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x29"  "\x20"  "\x2a"  "\x20"  "\x6c"  "\x6f"  "\x67"  "\x28"  "\x66"  "\x36"  "\x20"  "\x2f"  "\x20"  "\x66"  "\x34"  "\x29"  "\x20"  "\x2f"  "\x20"  "\x28"  "\x33"  "\x2e"  "\x30"  "\x20"  "\x2d"  "\x20"  "\x71"  "\x56"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x78"  "\x20"  "\x3d"  "\x20"  "\x73"  "\x69"  "\x67"  "\x6d"  "\x61"  "\x78"  "\x20"  "\x2a"  "\x20"  "\x6e"  "\x6f"  "\x72"  "\x6d"  "\x61"  "\x6c"  "\x5f"  "\x64"  "\x69"  "\x73"  "\x74"  "\x72"  "\x69"  "\x62"  "\x75"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x28"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x79"  "\x20"  "\x3d"  "\x20"  "\x6e"  "\x6f"  "\x72"  "\x6d"  "\x61"  "\x6c"  "\x5f"  "\x64"  "\x69"  "\x73"  "\x74"  "\x72"  "\x69"  "\x62"  "\x75"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x28"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x64"  "\x65"  "\x6e"  "\x20"  "\x3d"  "\x20"  "\x65"  "\x78"  "\x70"  "\x28"  "\x28"  "\x71"  "\x56"  "\x20"  "\x2d"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x29"  "\x20"  "\x2a"  "\x20"  "\x6c"  "\x6f"  "\x67"  "\x28"  "\x66"  "\x61"  "\x62"  "\x73"  "\x28"  "\x79"  "\x29"  "\x29"  "\x20"  "\x2f"  "\x20"  "\x28"  "\x33"  "\x2e"  "\x30"  "\x20"  "\x2d"  "\x20"  "\x71"  "\x56"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x78"  "\x20"  "\x2f"  "\x20"  "\x64"  "\x65"  "\x6e"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x0a"  "\x0a"  "\x0a"  "\x0a"  "\x76"  "\x33"  "\x64"  "\x20"  "\x61"  "\x70"  "\x70"  "\x6c"  "\x79"  "\x5f"  "\x70"  "\x62"  "\x63"  "\x28"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x2a"  "\x76"  "\x2c"  "\x20"  "\x70"  "\x62"  "\x63"  "\x5f"  "\x72"  "\x75"  "\x6c"  "\x65"  "\x73"  "\x20"  "\x70"  "\x62"  "\x63"  "\x2c"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x2c"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x2c"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3e"  "\x3d"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x7c"  "\x7c"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3c"  "\x20"  "\x30"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x21"  "\x70"  "\x62"  "\x63"  "\x2e"  "\x70"  "\x62"  "\x63"  "\x5f"  "\x79"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x70"  "\x62"  "\x63"  "\x2e"  "\x6d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x28"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x25"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x29"  "\x20"  "\x2b"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x29"  "\x20"  "\x25"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7d"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3e"  "\x3d"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x20"  "\x7c"  "\x7c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3c"  "\x20"  "\x30"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x21"  "\x70"  "\x62"  "\x63"  "\x2e"  "\x70"  "\x62"  "\x63"  "\x5f"  "\x78"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x70"  "\x62"  "\x63"  "\x2e"  "\x6d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x28"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x25"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x20"  "\x2b"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x20"  "\x25"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7d"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x76"  "\x5b"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2a"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x20"  "\x2b"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x5d"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x76"  "\x6f"  "\x69"  "\x64"  "\x20"  "\x61"  "\x70"  "\x70"  "\x6c"  "\x79"  "\x5f"  "\x70"  "\x62"  "\x63"  "\x5f"  "\x63"  "\x6f"  "\x6d"  "\x70"  "\x6c"  "\x65"  "\x74"  "\x65"  "\x28"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x73"  "\x69"  "\x74"  "\x65"  "\x5f"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x73"  "\x20"  "\x2a"  "\x67"  "\x73"  "\x2c"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x2a"  "\x76"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x2a"  "\x6f"  "\x75"  "\x74"  "\x2c"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x73"  "\x69"  "\x74"  "\x65"  "\x5f"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x73"  "\x20"  "\x2a"  "\x67"  "\x73"  "\x6f"  "\x75"  "\x74"  "\x2c"  "\x20"  "\x70"  "\x62"  "\x63"  "\x5f"  "\x72"  "\x75"  "\x6c"  "\x65"  "\x73"  "\x20"  "\x70"  "\x62"  "\x63"  "\x2c"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x2c"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x2c"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3e"  "\x3d"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x7c"  "\x7c"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3c"  "\x20"  "\x30"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x21"  "\x70"  "\x62"  "\x63"  "\x2e"  "\x70"  "\x62"  "\x63"  "\x5f"  "\x79"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x2a"  "\x6f"  "\x75"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x70"  "\x62"  "\x63"  "\x2e"  "\x6d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x2a"  "\x67"  "\x73"  "\x6f"  "\x75"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x73"  "\x5b"  "\x28"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3e"  "\x3d"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x3f"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x2d"  "\x20"  "\x31"  "\x3a"  "\x20"  "\x30"  "\x29"  "\x20"  "\x2a"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x20"  "\x2b"  "\x20"  "\x28"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3e"  "\x3d"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x3f"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x20"  "\x2d"  "\x20"  "\x31"  "\x3a"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3c"  "\x20"  "\x30"  "\x3f"  "\x20"  "\x30"  "\x3a"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x29"  "\x5d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7d"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x28"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x25"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x29"  "\x20"  "\x2b"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x29"  "\x20"  "\x25"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7d"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3e"  "\x3d"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x20"  "\x7c"  "\x7c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3c"  "\x20"  "\x30"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x21"  "\x70"  "\x62"  "\x63"  "\x2e"  "\x70"  "\x62"  "\x63"  "\x5f"  "\x78"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x2a"  "\x6f"  "\x75"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x70"  "\x62"  "\x63"  "\x2e"  "\x6d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x2a"  "\x67"  "\x73"  "\x6f"  "\x75"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x73"  "\x5b"  "\x28"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3e"  "\x3d"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x3f"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x2d"  "\x20"  "\x31"  "\x3a"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3c"  "\x20"  "\x30"  "\x3f"  "\x20"  "\x30"  "\x3a"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x29"  "\x20"  "\x2a"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x20"  "\x2b"  "\x20"  "\x28"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3e"  "\x3d"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x3f"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x20"  "\x2d"  "\x20"  "\x31"  "\x3a"  "\x20"  "\x30"  "\x29"  "\x5d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7d"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x28"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x25"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x20"  "\x2b"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x20"  "\x25"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7d"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x2a"  "\x6f"  "\x75"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x5b"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2a"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x20"  "\x2b"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x5d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x2a"  "\x67"  "\x73"  "\x6f"  "\x75"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x73"  "\x5b"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2a"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x20"  "\x2b"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x5d"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x65"  "\x78"  "\x63"  "\x68"  "\x61"  "\x6e"  "\x67"  "\x65"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x65"  "\x74"  "\x65"  "\x72"  "\x73"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x2d"  "\x28"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x64"  "\x6f"  "\x74"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x29"  "\x20"  "\x2b"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x64"  "\x6f"  "\x74"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x29"  "\x20"  "\x2b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x64"  "\x6f"  "\x74"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x75"  "\x70"  "\x29"  "\x20"  "\x2b"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x64"  "\x6f"  "\x74"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x29"  "\x29"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x65"  "\x78"  "\x63"  "\x68"  "\x61"  "\x6e"  "\x67"  "\x65"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x64"  "\x6d"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x65"  "\x74"  "\x65"  "\x72"  "\x73"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x72"  "\x65"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x30"  "\x2e"  "\x30"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x20"  "\x2b"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x64"  "\x6f"  "\x74"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x64"  "\x6d"  "\x2e"  "\x64"  "\x6d"  "\x76"  "\x5f"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x72"  "\x6f"  "\x73"  "\x73"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x20"  "\x2b"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x64"  "\x6f"  "\x74"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x64"  "\x6d"  "\x2e"  "\x64"  "\x6d"  "\x76"  "\x5f"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x72"  "\x6f"  "\x73"  "\x73"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x20"  "\x2b"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x64"  "\x6f"  "\x74"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x64"  "\x6d"  "\x2e"  "\x64"  "\x6d"  "\x76"  "\x5f"  "\x75"  "\x70"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x72"  "\x6f"  "\x73"  "\x73"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x75"  "\x70"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x20"  "\x2b"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x64"  "\x6f"  "\x74"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x64"  "\x6d"  "\x2e"  "\x64"  "\x6d"  "\x76"  "\x5f"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x72"  "\x6f"  "\x73"  "\x73"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x2d"  "\x72"  "\x65"  "\x74"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x61"  "\x6e"  "\x69"  "\x73"  "\x6f"  "\x74"  "\x72"  "\x6f"  "\x70"  "\x79"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x65"  "\x74"  "\x65"  "\x72"  "\x73"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x64"  "\x6f"  "\x74"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x61"  "\x6e"  "\x69"  "\x2e"  "\x64"  "\x69"  "\x72"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x2d"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x61"  "\x6e"  "\x69"  "\x2e"  "\x61"  "\x6e"  "\x69"  "\x20"  "\x2a"  "\x20"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x20"  "\x2a"  "\x20"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x63"  "\x75"  "\x62"  "\x69"  "\x63"  "\x5f"  "\x61"  "\x6e"  "\x69"  "\x73"  "\x6f"  "\x74"  "\x72"  "\x6f"  "\x70"  "\x79"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x65"  "\x74"  "\x65"  "\x72"  "\x73"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x2d"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2e"  "\x78"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2e"  "\x78"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2e"  "\x78"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2e"  "\x78"  "\x20"  "\x2b"  "\x20"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2e"  "\x79"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2e"  "\x79"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2e"  "\x79"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2e"  "\x79"  "\x20"  "\x2b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2e"  "\x7a"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2e"  "\x7a"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2e"  "\x7a"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2e"  "\x7a"  "\x29"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x63"  "\x75"  "\x62"  "\x69"  "\x63"  "\x5f"  "\x61"  "\x6e"  "\x69"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x65"  "\x74"  "\x65"  "\x72"  "\x73"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x2d"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x6d"  "\x75"  "\x20"  "\x2a"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x64"  "\x6f"  "\x74"  "\x28"  "\x67"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x61"  "\x74"  "\x65"  "\x5f"  "\x6d"  "\x61"  "\x67"  "\x6e"  "\x65"  "\x74"  "\x69"  "\x63"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x74"  "\x69"  "\x6d"  "\x65"  "\x29"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x29"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x65"  "\x74"  "\x65"  "\x72"  "\x73"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x30"  "\x2e"  "\x35"  "\x20"  "\x2a"  "\x20"  "\x65"  "\x78"  "\x63"  "\x68"  "\x61"  "\x6e"  "\x67"  "\x65"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x29"  "\x20"  "\x2b"  "\x20"  "\x30"  "\x2e"  "\x35"  "\x20"  "\x2a"  "\x20"  "\x64"  "\x6d"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x29"  "\x20"  "\x2b"  "\x20"  "\x61"  "\x6e"  "\x69"  "\x73"  "\x6f"  "\x74"  "\x72"  "\x6f"  "\x70"  "\x79"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x29"  "\x20"  "\x2b"  "\x20"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x29"  "\x20"  "\x2b"  "\x20"  "\x63"  "\x75"  "\x62"  "\x69"  "\x63"  "\x5f"  "\x61"  "\x6e"  "\x69"  "\x73"  "\x6f"  "\x74"  "\x72"  "\x6f"  "\x70"  "\x79"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x29"  "\x3b"  "\x0a"  "\x23"  "\x69"  "\x66"  "\x64"  "\x65"  "\x66"  "\x20"  "\x49"  "\x4e"  "\x43"  "\x4c"  "\x55"  "\x44"  "\x45"  "\x5f"  "\x44"  "\x49"  "\x50"  "\x4f"  "\x4c"  "\x41"  "\x52"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x65"  "\x20"  "\x2b"  "\x3d"  "\x20"  "\x30"  "\x2e"  "\x35"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x3b"  "\x0a"  "\x23"  "\x65"  "\x6e"  "\x64"  "\x69"  "\x66"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x65"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x76"  "\x33"  "\x64"  "\x20"  "\x65"  "\x66"  "\x66"  "\x65"  "\x63"  "\x74"  "\x69"  "\x76"  "\x65"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x65"  "\x74"  "\x65"  "\x72"  "\x73"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x72"  "\x65"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x28"  "\x30"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x65"  "\x78"  "\x63"  "\x68"  "\x61"  "\x6e"  "\x67"  "\x65"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x29"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x75"  "\x70"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x65"  "\x78"  "\x63"  "\x68"  "\x61"  "\x6e"  "\x67"  "\x65"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x65"  "\x78"  "\x63"  "\x68"  "\x61"  "\x6e"  "\x67"  "\x65"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x65"  "\x78"  "\x63"  "\x68"  "\x61"  "\x6e"  "\x67"  "\x65"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x62"  "\x28"  "\x72"  "\x65"  "\x74"  "\x2c"  "\x20"  "\x65"  "\x78"  "\x63"  "\x68"  "\x61"  "\x6e"  "\x67"  "\x65"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x64"  "\x6d"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x5f"  "\x78"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x72"  "\x6f"  "\x73"  "\x73"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x64"  "\x6d"  "\x2e"  "\x64"  "\x6d"  "\x76"  "\x5f"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x29"  "\x2c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x72"  "\x6f"  "\x73"  "\x73"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x64"  "\x6d"  "\x2e"  "\x64"  "\x6d"  "\x76"  "\x5f"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x64"  "\x6d"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x5f"  "\x79"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x72"  "\x6f"  "\x73"  "\x73"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x64"  "\x6d"  "\x2e"  "\x64"  "\x6d"  "\x76"  "\x5f"  "\x75"  "\x70"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x75"  "\x70"  "\x29"  "\x2c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x72"  "\x6f"  "\x73"  "\x73"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x64"  "\x6d"  "\x2e"  "\x64"  "\x6d"  "\x76"  "\x5f"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x64"  "\x6d"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x64"  "\x6d"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x5f"  "\x78"  "\x2c"  "\x20"  "\x64"  "\x6d"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x5f"  "\x79"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x72"  "\x65"  "\x74"  "\x2c"  "\x20"  "\x64"  "\x6d"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x62"  "\x28"  "\x72"  "\x65"  "\x74"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x67"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x61"  "\x74"  "\x65"  "\x5f"  "\x6d"  "\x61"  "\x67"  "\x6e"  "\x65"  "\x74"  "\x69"  "\x63"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x74"  "\x69"  "\x6d"  "\x65"  "\x29"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x6d"  "\x75"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x62"  "\x28"  "\x72"  "\x65"  "\x74"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x61"  "\x6e"  "\x69"  "\x2e"  "\x64"  "\x69"  "\x72"  "\x2c"  "\x20"  "\x32"  "\x2e"  "\x30"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x61"  "\x6e"  "\x69"  "\x2e"  "\x61"  "\x6e"  "\x69"  "\x20"  "\x2a"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x64"  "\x6f"  "\x74"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x61"  "\x6e"  "\x69"  "\x2e"  "\x64"  "\x69"  "\x72"  "\x29"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x62"  "\x28"  "\x72"  "\x65"  "\x74"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2e"  "\x78"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2e"  "\x78"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2e"  "\x78"  "\x2c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2e"  "\x79"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2e"  "\x79"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2e"  "\x79"  "\x2c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2e"  "\x7a"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2e"  "\x7a"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2e"  "\x7a"  "\x29"  "\x2c"  "\x20"  "\x34"  "\x2e"  "\x30"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x63"  "\x75"  "\x62"  "\x69"  "\x63"  "\x5f"  "\x61"  "\x6e"  "\x69"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x23"  "\x69"  "\x66"  "\x64"  "\x65"  "\x66"  "\x20"  "\x49"  "\x4e"  "\x43"  "\x4c"  "\x55"  "\x44"  "\x45"  "\x5f"  "\x44"  "\x49"  "\x50"  "\x4f"  "\x4c"  "\x41"  "\x52"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x72"  "\x65"  "\x74"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x29"  "\x3b"  "\x0a"  "\x23"  "\x65"  "\x6e"  "\x64"  "\x69"  "\x66"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x72"  "\x65"  "\x74"  "\x2c"  "\x20"  "\x2d"  "\x31"  "\x2e"  "\x30"  "\x20"  "\x2f"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x6d"  "\x75"  "\x29"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x2f"  "\x2f"  "\x40"  "\x54"  "\x4f"  "\x44"  "\x4f"  "\x3a"  "\x20"  "\x41"  "\x64"  "\x64"  "\x20"  "\x5a"  "\x20"  "\x66"  "\x69"  "\x6e"  "\x69"  "\x74"  "\x65"  "\x0a"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x64"  "\x6f"  "\x74"  "\x5f"  "\x67"  "\x72"  "\x61"  "\x64"  "\x28"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x2c"  "\x20"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x62"  "\x6f"  "\x72"  "\x73"  "\x5f"  "\x73"  "\x65"  "\x74"  "\x20"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x64"  "\x78"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x64"  "\x79"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x72"  "\x65"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x7b"  "\x30"  "\x7d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x2e"  "\x78"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x2e"  "\x78"  "\x20"  "\x2a"  "\x20"  "\x28"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x2e"  "\x78"  "\x20"  "\x2d"  "\x20"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x2e"  "\x78"  "\x29"  "\x20"  "\x2f"  "\x20"  "\x28"  "\x32"  "\x2e"  "\x30"  "\x20"  "\x2a"  "\x20"  "\x64"  "\x78"  "\x29"  "\x20"  "\x2b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x2e"  "\x79"  "\x20"  "\x2a"  "\x20"  "\x28"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x75"  "\x70"  "\x2e"  "\x78"  "\x20"  "\x2d"  "\x20"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x2e"  "\x78"  "\x29"  "\x20"  "\x2f"  "\x20"  "\x28"  "\x32"  "\x2e"  "\x30"  "\x20"  "\x2a"  "\x20"  "\x64"  "\x79"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x2e"  "\x79"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x2e"  "\x78"  "\x20"  "\x2a"  "\x20"  "\x28"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x2e"  "\x79"  "\x20"  "\x2d"  "\x20"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x2e"  "\x79"  "\x29"  "\x20"  "\x2f"  "\x20"  "\x28"  "\x32"  "\x2e"  "\x30"  "\x20"  "\x2a"  "\x20"  "\x64"  "\x78"  "\x29"  "\x20"  "\x2b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x2e"  "\x79"  "\x20"  "\x2a"  "\x20"  "\x28"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x75"  "\x70"  "\x2e"  "\x79"  "\x20"  "\x2d"  "\x20"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x2e"  "\x79"  "\x29"  "\x20"  "\x2f"  "\x20"  "\x28"  "\x32"  "\x2e"  "\x30"  "\x20"  "\x2a"  "\x20"  "\x64"  "\x79"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x2e"  "\x7a"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x2e"  "\x78"  "\x20"  "\x2a"  "\x20"  "\x28"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x2e"  "\x7a"  "\x20"  "\x2d"  "\x20"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x2e"  "\x7a"  "\x29"  "\x20"  "\x2f"  "\x20"  "\x28"  "\x32"  "\x2e"  "\x30"  "\x20"  "\x2a"  "\x20"  "\x64"  "\x78"  "\x29"  "\x20"  "\x2b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x2e"  "\x79"  "\x20"  "\x2a"  "\x20"  "\x28"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x75"  "\x70"  "\x2e"  "\x7a"  "\x20"  "\x2d"  "\x20"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x2e"  "\x7a"  "\x29"  "\x20"  "\x2f"  "\x20"  "\x28"  "\x32"  "\x2e"  "\x30"  "\x20"  "\x2a"  "\x20"  "\x64"  "\x79"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x72"  "\x65"  "\x74"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x76"  "\x33"  "\x64"  "\x20"  "\x64"  "\x6d"  "\x5f"  "\x64"  "\x74"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x65"  "\x74"  "\x65"  "\x72"  "\x73"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x64"  "\x74"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x48"  "\x5f"  "\x65"  "\x66"  "\x66"  "\x20"  "\x3d"  "\x20"  "\x65"  "\x66"  "\x66"  "\x65"  "\x63"  "\x74"  "\x69"  "\x76"  "\x65"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x48"  "\x5f"  "\x65"  "\x66"  "\x66"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x48"  "\x5f"  "\x65"  "\x66"  "\x66"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x74"  "\x65"  "\x6d"  "\x70"  "\x65"  "\x72"  "\x61"  "\x74"  "\x75"  "\x72"  "\x65"  "\x5f"  "\x65"  "\x66"  "\x66"  "\x65"  "\x63"  "\x74"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x72"  "\x6f"  "\x73"  "\x73"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2c"  "\x20"  "\x48"  "\x5f"  "\x65"  "\x66"  "\x66"  "\x29"  "\x2c"  "\x20"  "\x2d"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x67"  "\x61"  "\x6d"  "\x6d"  "\x61"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x75"  "\x72"  "\x72"  "\x65"  "\x6e"  "\x74"  "\x20"  "\x63"  "\x75"  "\x72"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x61"  "\x74"  "\x65"  "\x5f"  "\x63"  "\x75"  "\x72"  "\x72"  "\x65"  "\x6e"  "\x74"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x74"  "\x69"  "\x6d"  "\x65"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x73"  "\x77"  "\x69"  "\x74"  "\x63"  "\x68"  "\x20"  "\x28"  "\x63"  "\x75"  "\x72"  "\x2e"  "\x74"  "\x79"  "\x70"  "\x65"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x61"  "\x73"  "\x65"  "\x20"  "\x43"  "\x55"  "\x52"  "\x5f"  "\x53"  "\x54"  "\x54"  "\x3a"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x63"  "\x6f"  "\x6d"  "\x6d"  "\x6f"  "\x6e"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x64"  "\x6f"  "\x74"  "\x5f"  "\x67"  "\x72"  "\x61"  "\x64"  "\x28"  "\x63"  "\x75"  "\x72"  "\x2e"  "\x73"  "\x74"  "\x74"  "\x2e"  "\x6a"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6d"  "\x6d"  "\x6f"  "\x6e"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x63"  "\x6f"  "\x6d"  "\x6d"  "\x6f"  "\x6e"  "\x2c"  "\x20"  "\x63"  "\x75"  "\x72"  "\x2e"  "\x73"  "\x74"  "\x74"  "\x2e"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x69"  "\x7a"  "\x61"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x20"  "\x2f"  "\x20"  "\x28"  "\x32"  "\x2e"  "\x30"  "\x20"  "\x2a"  "\x20"  "\x51"  "\x45"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x62"  "\x65"  "\x74"  "\x61"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x72"  "\x6f"  "\x73"  "\x73"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6d"  "\x6d"  "\x6f"  "\x6e"  "\x29"  "\x2c"  "\x20"  "\x63"  "\x75"  "\x72"  "\x2e"  "\x73"  "\x74"  "\x74"  "\x2e"  "\x62"  "\x65"  "\x74"  "\x61"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x76"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x62"  "\x28"  "\x63"  "\x6f"  "\x6d"  "\x6d"  "\x6f"  "\x6e"  "\x2c"  "\x20"  "\x62"  "\x65"  "\x74"  "\x61"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7d"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x62"  "\x72"  "\x65"  "\x61"  "\x6b"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x61"  "\x73"  "\x65"  "\x20"  "\x43"  "\x55"  "\x52"  "\x5f"  "\x53"  "\x48"  "\x45"  "\x3a"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x63"  "\x6f"  "\x6d"  "\x6d"  "\x6f"  "\x6e"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x72"  "\x6f"  "\x73"  "\x73"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2c"  "\x20"  "\x63"  "\x75"  "\x72"  "\x2e"  "\x73"  "\x68"  "\x65"  "\x2e"  "\x70"  "\x29"  "\x2c"  "\x20"  "\x48"  "\x42"  "\x41"  "\x52"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x67"  "\x61"  "\x6d"  "\x6d"  "\x61"  "\x20"  "\x2a"  "\x20"  "\x63"  "\x75"  "\x72"  "\x2e"  "\x73"  "\x68"  "\x65"  "\x2e"  "\x74"  "\x68"  "\x65"  "\x74"  "\x61"  "\x5f"  "\x73"  "\x68"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x20"  "\x2f"  "\x20"  "\x28"  "\x32"  "\x2e"  "\x30"  "\x20"  "\x2a"  "\x20"  "\x51"  "\x45"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x6d"  "\x75"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x62"  "\x65"  "\x74"  "\x61"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x63"  "\x6f"  "\x6d"  "\x6d"  "\x6f"  "\x6e"  "\x2c"  "\x20"  "\x63"  "\x75"  "\x72"  "\x2e"  "\x73"  "\x74"  "\x74"  "\x2e"  "\x62"  "\x65"  "\x74"  "\x61"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x76"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x62"  "\x28"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x72"  "\x6f"  "\x73"  "\x73"  "\x28"  "\x63"  "\x6f"  "\x6d"  "\x6d"  "\x6f"  "\x6e"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x29"  "\x2c"  "\x20"  "\x62"  "\x65"  "\x74"  "\x61"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7d"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x62"  "\x72"  "\x65"  "\x61"  "\x6b"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x61"  "\x73"  "\x65"  "\x20"  "\x43"  "\x55"  "\x52"  "\x5f"  "\x42"  "\x4f"  "\x54"  "\x48"  "\x3a"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x73"  "\x74"  "\x74"  "\x5f"  "\x63"  "\x6f"  "\x6d"  "\x6d"  "\x6f"  "\x6e"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x64"  "\x6f"  "\x74"  "\x5f"  "\x67"  "\x72"  "\x61"  "\x64"  "\x28"  "\x63"  "\x75"  "\x72"  "\x2e"  "\x73"  "\x74"  "\x74"  "\x2e"  "\x6a"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x73"  "\x74"  "\x74"  "\x5f"  "\x63"  "\x6f"  "\x6d"  "\x6d"  "\x6f"  "\x6e"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x73"  "\x74"  "\x74"  "\x5f"  "\x63"  "\x6f"  "\x6d"  "\x6d"  "\x6f"  "\x6e"  "\x2c"  "\x20"  "\x63"  "\x75"  "\x72"  "\x2e"  "\x73"  "\x74"  "\x74"  "\x2e"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x69"  "\x7a"  "\x61"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x20"  "\x2f"  "\x20"  "\x28"  "\x32"  "\x2e"  "\x30"  "\x20"  "\x2a"  "\x20"  "\x51"  "\x45"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x73"  "\x74"  "\x74"  "\x5f"  "\x62"  "\x65"  "\x74"  "\x61"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x72"  "\x6f"  "\x73"  "\x73"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2c"  "\x20"  "\x73"  "\x74"  "\x74"  "\x5f"  "\x63"  "\x6f"  "\x6d"  "\x6d"  "\x6f"  "\x6e"  "\x29"  "\x2c"  "\x20"  "\x63"  "\x75"  "\x72"  "\x2e"  "\x73"  "\x74"  "\x74"  "\x2e"  "\x62"  "\x65"  "\x74"  "\x61"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x76"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x62"  "\x28"  "\x73"  "\x74"  "\x74"  "\x5f"  "\x63"  "\x6f"  "\x6d"  "\x6d"  "\x6f"  "\x6e"  "\x2c"  "\x20"  "\x73"  "\x74"  "\x74"  "\x5f"  "\x62"  "\x65"  "\x74"  "\x61"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x73"  "\x68"  "\x65"  "\x5f"  "\x63"  "\x6f"  "\x6d"  "\x6d"  "\x6f"  "\x6e"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x72"  "\x6f"  "\x73"  "\x73"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2c"  "\x20"  "\x63"  "\x75"  "\x72"  "\x2e"  "\x73"  "\x68"  "\x65"  "\x2e"  "\x70"  "\x29"  "\x2c"  "\x20"  "\x48"  "\x42"  "\x41"  "\x52"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x67"  "\x61"  "\x6d"  "\x6d"  "\x61"  "\x20"  "\x2a"  "\x20"  "\x63"  "\x75"  "\x72"  "\x2e"  "\x73"  "\x68"  "\x65"  "\x2e"  "\x74"  "\x68"  "\x65"  "\x74"  "\x61"  "\x5f"  "\x73"  "\x68"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x20"  "\x2f"  "\x20"  "\x28"  "\x32"  "\x2e"  "\x30"  "\x20"  "\x2a"  "\x20"  "\x51"  "\x45"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x6d"  "\x75"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x73"  "\x68"  "\x65"  "\x5f"  "\x62"  "\x65"  "\x74"  "\x61"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x73"  "\x68"  "\x65"  "\x5f"  "\x63"  "\x6f"  "\x6d"  "\x6d"  "\x6f"  "\x6e"  "\x2c"  "\x20"  "\x63"  "\x75"  "\x72"  "\x2e"  "\x73"  "\x74"  "\x74"  "\x2e"  "\x62"  "\x65"  "\x74"  "\x61"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x76"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x62"  "\x28"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x72"  "\x6f"  "\x73"  "\x73"  "\x28"  "\x73"  "\x68"  "\x65"  "\x5f"  "\x63"  "\x6f"  "\x6d"  "\x6d"  "\x6f"  "\x6e"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x29"  "\x2c"  "\x20"  "\x73"  "\x68"  "\x65"  "\x5f"  "\x62"  "\x65"  "\x74"  "\x61"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7d"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x62"  "\x72"  "\x65"  "\x61"  "\x6b"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x61"  "\x73"  "\x65"  "\x20"  "\x43"  "\x55"  "\x52"  "\x5f"  "\x4e"  "\x4f"  "\x4e"  "\x45"  "\x3a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x62"  "\x72"  "\x65"  "\x61"  "\x6b"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7d"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x76"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x72"  "\x6f"  "\x73"  "\x73"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2c"  "\x20"  "\x76"  "\x29"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x61"  "\x6c"  "\x70"  "\x68"  "\x61"  "\x29"  "\x29"  "\x2c"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x20"  "\x2f"  "\x20"  "\x28"  "\x31"  "\x2e"  "\x30"  "\x20"  "\x2b"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x61"  "\x6c"  "\x70"  "\x68"  "\x61"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x61"  "\x6c"  "\x70"  "\x68"  "\x61"  "\x29"  "\x20"  "\x2a"  "\x20"  "\x64"  "\x74"  "\x29"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x2f"  "\x2f"  "\x40"  "\x54"  "\x4f"  "\x44"  "\x4f"  "\x3a"  "\x20"  "\x69"  "\x6d"  "\x70"  "\x6c"  "\x65"  "\x6d"  "\x65"  "\x6e"  "\x74"  "\x20"  "\x52"  "\x4b"  "\x32"  "\x20"  "\x61"  "\x6e"  "\x64"  "\x20"  "\x65"  "\x75"  "\x6c"  "\x65"  "\x72"  "\x0a"  "\x76"  "\x33"  "\x64"  "\x20"  "\x73"  "\x74"  "\x65"  "\x70"  "\x5f"  "\x6c"  "\x6c"  "\x67"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x65"  "\x74"  "\x65"  "\x72"  "\x73"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x64"  "\x74"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x72"  "\x6b"  "\x31"  "\x2c"  "\x20"  "\x72"  "\x6b"  "\x32"  "\x2c"  "\x20"  "\x72"  "\x6b"  "\x33"  "\x2c"  "\x20"  "\x72"  "\x6b"  "\x34"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x63"  "\x5f"  "\x6f"  "\x72"  "\x69"  "\x20"  "\x3d"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x74"  "\x69"  "\x6d"  "\x65"  "\x5f"  "\x6f"  "\x72"  "\x69"  "\x20"  "\x3d"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x74"  "\x69"  "\x6d"  "\x65"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x6b"  "\x31"  "\x20"  "\x3d"  "\x20"  "\x64"  "\x6d"  "\x5f"  "\x64"  "\x74"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2c"  "\x20"  "\x64"  "\x74"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x63"  "\x5f"  "\x6f"  "\x72"  "\x69"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x72"  "\x6b"  "\x31"  "\x2c"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x20"  "\x2f"  "\x20"  "\x32"  "\x2e"  "\x30"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x74"  "\x69"  "\x6d"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x74"  "\x69"  "\x6d"  "\x65"  "\x5f"  "\x6f"  "\x72"  "\x69"  "\x20"  "\x2b"  "\x20"  "\x64"  "\x74"  "\x20"  "\x2f"  "\x20"  "\x32"  "\x2e"  "\x30"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x6b"  "\x32"  "\x20"  "\x3d"  "\x20"  "\x64"  "\x6d"  "\x5f"  "\x64"  "\x74"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2c"  "\x20"  "\x64"  "\x74"  "\x20"  "\x2f"  "\x20"  "\x32"  "\x2e"  "\x30"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x63"  "\x5f"  "\x6f"  "\x72"  "\x69"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x72"  "\x6b"  "\x32"  "\x2c"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x20"  "\x2f"  "\x20"  "\x32"  "\x2e"  "\x30"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x74"  "\x69"  "\x6d"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x74"  "\x69"  "\x6d"  "\x65"  "\x5f"  "\x6f"  "\x72"  "\x69"  "\x20"  "\x2b"  "\x20"  "\x64"  "\x74"  "\x20"  "\x2f"  "\x20"  "\x32"  "\x2e"  "\x30"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x6b"  "\x33"  "\x20"  "\x3d"  "\x20"  "\x64"  "\x6d"  "\x5f"  "\x64"  "\x74"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2c"  "\x20"  "\x64"  "\x74"  "\x20"  "\x2f"  "\x20"  "\x32"  "\x2e"  "\x30"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x63"  "\x5f"  "\x6f"  "\x72"  "\x69"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x72"  "\x6b"  "\x33"  "\x2c"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x74"  "\x69"  "\x6d"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x74"  "\x69"  "\x6d"  "\x65"  "\x5f"  "\x6f"  "\x72"  "\x69"  "\x20"  "\x2b"  "\x20"  "\x64"  "\x74"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x6b"  "\x34"  "\x20"  "\x3d"  "\x20"  "\x64"  "\x6d"  "\x5f"  "\x64"  "\x74"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2c"  "\x20"  "\x64"  "\x74"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x72"  "\x6b"  "\x31"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x72"  "\x6b"  "\x32"  "\x2c"  "\x20"  "\x32"  "\x2e"  "\x30"  "\x29"  "\x29"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x72"  "\x6b"  "\x33"  "\x2c"  "\x20"  "\x32"  "\x2e"  "\x30"  "\x29"  "\x2c"  "\x20"  "\x72"  "\x6b"  "\x34"  "\x29"  "\x29"  "\x2c"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x20"  "\x2f"  "\x20"  "\x36"  "\x2e"  "\x30"  "\x29"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x5f"  "\x66"  "\x69"  "\x6e"  "\x69"  "\x74"  "\x65"  "\x28"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6d"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x75"  "\x70"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x64"  "\x6f"  "\x74"  "\x28"  "\x6d"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x72"  "\x6f"  "\x73"  "\x73"  "\x28"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x62"  "\x28"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x2c"  "\x20"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x29"  "\x2c"  "\x20"  "\x30"  "\x2e"  "\x35"  "\x29"  "\x2c"  "\x20"  "\x2f"  "\x2f"  "\x78"  "\x20"  "\x66"  "\x69"  "\x6e"  "\x69"  "\x74"  "\x65"  "\x20"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x65"  "\x64"  "\x20"  "\x62"  "\x79"  "\x20"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x62"  "\x28"  "\x75"  "\x70"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x29"  "\x2c"  "\x20"  "\x30"  "\x2e"  "\x35"  "\x29"  "\x20"  "\x20"  "\x2f"  "\x2f"  "\x79"  "\x20"  "\x66"  "\x69"  "\x6e"  "\x69"  "\x74"  "\x65"  "\x20"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x65"  "\x64"  "\x20"  "\x62"  "\x79"  "\x20"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x29"  "\x29"  "\x20"  "\x2a"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x20"  "\x2f"  "\x20"  "\x28"  "\x34"  "\x2e"  "\x30"  "\x20"  "\x2a"  "\x20"  "\x4d"  "\x5f"  "\x50"  "\x49"  "\x29"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x0a"  "\x2f"  "\x2f"  "\x68"  "\x74"  "\x74"  "\x70"  "\x73"  "\x3a"  "\x2f"  "\x2f"  "\x69"  "\x6f"  "\x70"  "\x73"  "\x63"  "\x69"  "\x65"  "\x6e"  "\x63"  "\x65"  "\x2e"  "\x69"  "\x6f"  "\x70"  "\x2e"  "\x6f"  "\x72"  "\x67"  "\x2f"  "\x61"  "\x72"  "\x74"  "\x69"  "\x63"  "\x6c"  "\x65"  "\x2f"  "\x31"  "\x30"  "\x2e"  "\x31"  "\x30"  "\x38"  "\x38"  "\x2f"  "\x32"  "\x36"  "\x33"  "\x33"  "\x2d"  "\x31"  "\x33"  "\x35"  "\x37"  "\x2f"  "\x61"  "\x62"  "\x61"  "\x64"  "\x30"  "\x63"  "\x2f"  "\x70"  "\x64"  "\x66"  "\x0a"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x71"  "\x5f"  "\x69"  "\x6a"  "\x6b"  "\x28"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6d"  "\x69"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6d"  "\x6a"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6d"  "\x6b"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x6e"  "\x75"  "\x6d"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x64"  "\x6f"  "\x74"  "\x28"  "\x6d"  "\x69"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x72"  "\x6f"  "\x73"  "\x73"  "\x28"  "\x6d"  "\x6a"  "\x2c"  "\x20"  "\x6d"  "\x6b"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x64"  "\x65"  "\x6e"  "\x20"  "\x3d"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x20"  "\x2b"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x64"  "\x6f"  "\x74"  "\x28"  "\x6d"  "\x69"  "\x2c"  "\x20"  "\x6d"  "\x6a"  "\x29"  "\x20"  "\x2b"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x64"  "\x6f"  "\x74"  "\x28"  "\x6d"  "\x69"  "\x2c"  "\x20"  "\x6d"  "\x6b"  "\x29"  "\x20"  "\x2b"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x64"  "\x6f"  "\x74"  "\x28"  "\x6d"  "\x6a"  "\x2c"  "\x20"  "\x6d"  "\x6b"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x32"  "\x2e"  "\x30"  "\x20"  "\x2a"  "\x20"  "\x61"  "\x74"  "\x61"  "\x6e"  "\x32"  "\x28"  "\x6e"  "\x75"  "\x6d"  "\x2c"  "\x20"  "\x64"  "\x65"  "\x6e"  "\x29"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x2f"  "\x2a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x28"  "\x5f"  "\x5f"  "\x29"  "\x2d"  "\x2d"  "\x2d"  "\x28"  "\x6d"  "\x32"  "\x29"  "\x2d"  "\x2d"  "\x2d"  "\x28"  "\x5f"  "\x5f"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7c"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7c"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7c"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7c"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x28"  "\x6d"  "\x33"  "\x29"  "\x2d"  "\x2d"  "\x2d"  "\x28"  "\x6d"  "\x30"  "\x29"  "\x2d"  "\x2d"  "\x2d"  "\x28"  "\x6d"  "\x31"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7c"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7c"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7c"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7c"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x28"  "\x5f"  "\x5f"  "\x29"  "\x2d"  "\x2d"  "\x2d"  "\x28"  "\x6d"  "\x34"  "\x29"  "\x2d"  "\x2d"  "\x2d"  "\x28"  "\x5f"  "\x5f"  "\x29"  "\x0a"  "\x2a"  "\x2f"  "\x0a"  "\x0a"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x5f"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x28"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6d"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x75"  "\x70"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x71"  "\x5f"  "\x30"  "\x31"  "\x32"  "\x20"  "\x3d"  "\x20"  "\x71"  "\x5f"  "\x69"  "\x6a"  "\x6b"  "\x28"  "\x6d"  "\x2c"  "\x20"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x2c"  "\x20"  "\x75"  "\x70"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x71"  "\x5f"  "\x30"  "\x32"  "\x33"  "\x20"  "\x3d"  "\x20"  "\x71"  "\x5f"  "\x69"  "\x6a"  "\x6b"  "\x28"  "\x6d"  "\x2c"  "\x20"  "\x75"  "\x70"  "\x2c"  "\x20"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x71"  "\x5f"  "\x30"  "\x33"  "\x34"  "\x20"  "\x3d"  "\x20"  "\x71"  "\x5f"  "\x69"  "\x6a"  "\x6b"  "\x28"  "\x6d"  "\x2c"  "\x20"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x71"  "\x5f"  "\x30"  "\x34"  "\x31"  "\x20"  "\x3d"  "\x20"  "\x71"  "\x5f"  "\x69"  "\x6a"  "\x6b"  "\x28"  "\x6d"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x2c"  "\x20"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x20"  "\x2f"  "\x20"  "\x28"  "\x38"  "\x2e"  "\x30"  "\x20"  "\x2a"  "\x20"  "\x4d"  "\x5f"  "\x50"  "\x49"  "\x29"  "\x20"  "\x2a"  "\x20"  "\x28"  "\x71"  "\x5f"  "\x30"  "\x31"  "\x32"  "\x20"  "\x2b"  "\x20"  "\x71"  "\x5f"  "\x30"  "\x32"  "\x33"  "\x20"  "\x2b"  "\x20"  "\x71"  "\x5f"  "\x30"  "\x33"  "\x34"  "\x20"  "\x2b"  "\x20"  "\x71"  "\x5f"  "\x30"  "\x34"  "\x31"  "\x29"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x76"  "\x33"  "\x64"  "\x20"  "\x65"  "\x6d"  "\x65"  "\x72"  "\x67"  "\x65"  "\x6e"  "\x74"  "\x5f"  "\x6d"  "\x61"  "\x67"  "\x6e"  "\x65"  "\x74"  "\x69"  "\x63"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x5f"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x28"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6d"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x75"  "\x70"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x28"  "\x30"  "\x2e"  "\x30"  "\x2c"  "\x20"  "\x30"  "\x2e"  "\x30"  "\x2c"  "\x20"  "\x34"  "\x2e"  "\x30"  "\x20"  "\x2a"  "\x20"  "\x4d"  "\x5f"  "\x50"  "\x49"  "\x20"  "\x2a"  "\x20"  "\x48"  "\x42"  "\x41"  "\x52"  "\x20"  "\x2f"  "\x20"  "\x51"  "\x45"  "\x20"  "\x2a"  "\x20"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x5f"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x28"  "\x6d"  "\x2c"  "\x20"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x2c"  "\x20"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x2c"  "\x20"  "\x75"  "\x70"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x76"  "\x33"  "\x64"  "\x20"  "\x65"  "\x6d"  "\x65"  "\x72"  "\x67"  "\x65"  "\x6e"  "\x74"  "\x5f"  "\x6d"  "\x61"  "\x67"  "\x6e"  "\x65"  "\x74"  "\x69"  "\x63"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x5f"  "\x66"  "\x69"  "\x6e"  "\x69"  "\x74"  "\x65"  "\x28"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6d"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x75"  "\x70"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x28"  "\x30"  "\x2e"  "\x30"  "\x2c"  "\x20"  "\x30"  "\x2e"  "\x30"  "\x2c"  "\x20"  "\x34"  "\x2e"  "\x30"  "\x20"  "\x2a"  "\x20"  "\x4d"  "\x5f"  "\x50"  "\x49"  "\x20"  "\x2a"  "\x20"  "\x48"  "\x42"  "\x41"  "\x52"  "\x20"  "\x2f"  "\x20"  "\x51"  "\x45"  "\x20"  "\x2a"  "\x20"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x5f"  "\x66"  "\x69"  "\x6e"  "\x69"  "\x74"  "\x65"  "\x28"  "\x6d"  "\x2c"  "\x20"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x2c"  "\x20"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x2c"  "\x20"  "\x75"  "\x70"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x76"  "\x33"  "\x64"  "\x20"  "\x65"  "\x6d"  "\x65"  "\x72"  "\x67"  "\x65"  "\x6e"  "\x74"  "\x5f"  "\x65"  "\x6c"  "\x65"  "\x63"  "\x74"  "\x72"  "\x69"  "\x63"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x28"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6d"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x75"  "\x70"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x64"  "\x6d"  "\x64"  "\x74"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x64"  "\x78"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x64"  "\x79"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x28"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x48"  "\x42"  "\x41"  "\x52"  "\x20"  "\x2f"  "\x20"  "\x51"  "\x45"  "\x20"  "\x2a"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x64"  "\x6f"  "\x74"  "\x28"  "\x6d"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x72"  "\x6f"  "\x73"  "\x73"  "\x28"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x62"  "\x28"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x2c"  "\x20"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x29"  "\x2c"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x20"  "\x2f"  "\x20"  "\x28"  "\x32"  "\x2e"  "\x30"  "\x20"  "\x2a"  "\x20"  "\x64"  "\x78"  "\x29"  "\x29"  "\x2c"  "\x20"  "\x64"  "\x6d"  "\x64"  "\x74"  "\x29"  "\x29"  "\x2c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x48"  "\x42"  "\x41"  "\x52"  "\x20"  "\x2f"  "\x20"  "\x51"  "\x45"  "\x20"  "\x2a"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x64"  "\x6f"  "\x74"  "\x28"  "\x6d"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x72"  "\x6f"  "\x73"  "\x73"  "\x28"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x62"  "\x28"  "\x75"  "\x70"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x29"  "\x2c"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x20"  "\x2f"  "\x20"  "\x28"  "\x32"  "\x2e"  "\x30"  "\x20"  "\x2a"  "\x20"  "\x64"  "\x79"  "\x29"  "\x29"  "\x2c"  "\x20"  "\x64"  "\x6d"  "\x64"  "\x74"  "\x29"  "\x29"  "\x2c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x30"  "\x2e"  "\x30"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x29"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x0a"  "\x52"  "\x47"  "\x42"  "\x41"  "\x33"  "\x32"  "\x20"  "\x6c"  "\x69"  "\x6e"  "\x65"  "\x61"  "\x72"  "\x5f"  "\x6d"  "\x61"  "\x70"  "\x70"  "\x69"  "\x6e"  "\x67"  "\x28"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x74"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x73"  "\x74"  "\x61"  "\x72"  "\x74"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6d"  "\x69"  "\x64"  "\x64"  "\x6c"  "\x65"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x65"  "\x6e"  "\x64"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x6f"  "\x72"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x74"  "\x20"  "\x3c"  "\x20"  "\x30"  "\x2e"  "\x35"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x6f"  "\x72"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x62"  "\x28"  "\x6d"  "\x69"  "\x64"  "\x64"  "\x6c"  "\x65"  "\x2c"  "\x20"  "\x73"  "\x74"  "\x61"  "\x72"  "\x74"  "\x29"  "\x2c"  "\x20"  "\x32"  "\x2e"  "\x30"  "\x20"  "\x2a"  "\x20"  "\x74"  "\x29"  "\x2c"  "\x20"  "\x73"  "\x74"  "\x61"  "\x72"  "\x74"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7d"  "\x20"  "\x65"  "\x6c"  "\x73"  "\x65"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x6f"  "\x72"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x62"  "\x28"  "\x65"  "\x6e"  "\x64"  "\x2c"  "\x20"  "\x6d"  "\x69"  "\x64"  "\x64"  "\x6c"  "\x65"  "\x29"  "\x2c"  "\x20"  "\x32"  "\x2e"  "\x30"  "\x20"  "\x2a"  "\x20"  "\x74"  "\x20"  "\x2d"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x29"  "\x2c"  "\x20"  "\x6d"  "\x69"  "\x64"  "\x64"  "\x6c"  "\x65"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7d"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x2f"  "\x2f"  "\x52"  "\x47"  "\x42"  "\x41"  "\x20"  "\x2d"  "\x3e"  "\x20"  "\x42"  "\x47"  "\x52"  "\x41"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x28"  "\x52"  "\x47"  "\x42"  "\x41"  "\x33"  "\x32"  "\x29"  "\x7b"  "\x2e"  "\x78"  "\x20"  "\x3d"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x6f"  "\x72"  "\x2e"  "\x7a"  "\x20"  "\x2a"  "\x20"  "\x32"  "\x35"  "\x35"  "\x2c"  "\x20"  "\x2e"  "\x79"  "\x20"  "\x3d"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x6f"  "\x72"  "\x2e"  "\x79"  "\x20"  "\x2a"  "\x20"  "\x32"  "\x35"  "\x35"  "\x2c"  "\x20"  "\x2e"  "\x7a"  "\x20"  "\x3d"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x6f"  "\x72"  "\x2e"  "\x78"  "\x20"  "\x2a"  "\x20"  "\x32"  "\x35"  "\x35"  "\x2c"  "\x20"  "\x2e"  "\x77"  "\x20"  "\x3d"  "\x20"  "\x32"  "\x35"  "\x35"  "\x7d"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x52"  "\x47"  "\x42"  "\x41"  "\x33"  "\x32"  "\x20"  "\x6d"  "\x5f"  "\x62"  "\x77"  "\x72"  "\x5f"  "\x6d"  "\x61"  "\x70"  "\x70"  "\x69"  "\x6e"  "\x67"  "\x28"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6d"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x2f"  "\x2f"  "\x76"  "\x33"  "\x64"  "\x20"  "\x73"  "\x74"  "\x61"  "\x72"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x28"  "\x30"  "\x78"  "\x30"  "\x33"  "\x20"  "\x2f"  "\x20"  "\x32"  "\x35"  "\x35"  "\x2e"  "\x30"  "\x2c"  "\x20"  "\x30"  "\x78"  "\x37"  "\x66"  "\x20"  "\x2f"  "\x20"  "\x32"  "\x35"  "\x35"  "\x2e"  "\x30"  "\x2c"  "\x20"  "\x30"  "\x78"  "\x66"  "\x66"  "\x20"  "\x2f"  "\x20"  "\x32"  "\x35"  "\x35"  "\x2e"  "\x30"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x2f"  "\x2f"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6d"  "\x69"  "\x64"  "\x64"  "\x6c"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x28"  "\x31"  "\x2c"  "\x20"  "\x31"  "\x2c"  "\x20"  "\x31"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x2f"  "\x2f"  "\x76"  "\x33"  "\x64"  "\x20"  "\x65"  "\x6e"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x28"  "\x30"  "\x78"  "\x66"  "\x34"  "\x20"  "\x2f"  "\x20"  "\x32"  "\x35"  "\x35"  "\x2e"  "\x30"  "\x2c"  "\x20"  "\x30"  "\x78"  "\x30"  "\x35"  "\x20"  "\x2f"  "\x20"  "\x32"  "\x35"  "\x35"  "\x2e"  "\x30"  "\x2c"  "\x20"  "\x30"  "\x78"  "\x30"  "\x31"  "\x20"  "\x2f"  "\x20"  "\x32"  "\x35"  "\x35"  "\x2e"  "\x30"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x73"  "\x74"  "\x61"  "\x72"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x28"  "\x30"  "\x2c"  "\x20"  "\x30"  "\x2c"  "\x20"  "\x30"  "\x78"  "\x66"  "\x66"  "\x20"  "\x2f"  "\x20"  "\x32"  "\x35"  "\x35"  "\x2e"  "\x30"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6d"  "\x69"  "\x64"  "\x64"  "\x6c"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x28"  "\x31"  "\x2c"  "\x20"  "\x31"  "\x2c"  "\x20"  "\x31"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x65"  "\x6e"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x28"  "\x30"  "\x78"  "\x66"  "\x66"  "\x20"  "\x2f"  "\x20"  "\x32"  "\x35"  "\x35"  "\x2e"  "\x30"  "\x2c"  "\x20"  "\x30"  "\x2c"  "\x20"  "\x30"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x6d"  "\x7a"  "\x20"  "\x3d"  "\x20"  "\x6d"  "\x2e"  "\x7a"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x6c"  "\x69"  "\x6e"  "\x65"  "\x61"  "\x72"  "\x5f"  "\x6d"  "\x61"  "\x70"  "\x70"  "\x69"  "\x6e"  "\x67"  "\x28"  "\x30"  "\x2e"  "\x35"  "\x20"  "\x2a"  "\x20"  "\x6d"  "\x7a"  "\x20"  "\x2b"  "\x20"  "\x30"  "\x2e"  "\x35"  "\x2c"  "\x20"  "\x73"  "\x74"  "\x61"  "\x72"  "\x74"  "\x2c"  "\x20"  "\x6d"  "\x69"  "\x64"  "\x64"  "\x6c"  "\x65"  "\x2c"  "\x20"  "\x65"  "\x6e"  "\x64"  "\x29"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x5f"  "\x76"  "\x28"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x6d"  "\x31"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x6d"  "\x32"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x68"  "\x75"  "\x65"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x2f"  "\x2f"  "\x68"  "\x75"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x68"  "\x75"  "\x65"  "\x20"  "\x25"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x68"  "\x75"  "\x65"  "\x5f"  "\x69"  "\x20"  "\x3d"  "\x20"  "\x66"  "\x6c"  "\x6f"  "\x6f"  "\x72"  "\x28"  "\x68"  "\x75"  "\x65"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x68"  "\x75"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x68"  "\x75"  "\x65"  "\x20"  "\x2d"  "\x20"  "\x68"  "\x75"  "\x65"  "\x5f"  "\x69"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x68"  "\x75"  "\x65"  "\x20"  "\x3c"  "\x20"  "\x28"  "\x31"  "\x2e"  "\x30"  "\x20"  "\x2f"  "\x20"  "\x36"  "\x2e"  "\x30"  "\x29"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x6d"  "\x31"  "\x20"  "\x2b"  "\x20"  "\x28"  "\x6d"  "\x32"  "\x20"  "\x2d"  "\x20"  "\x6d"  "\x31"  "\x29"  "\x20"  "\x2a"  "\x20"  "\x68"  "\x75"  "\x65"  "\x20"  "\x2a"  "\x20"  "\x36"  "\x2e"  "\x30"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x68"  "\x75"  "\x65"  "\x20"  "\x3c"  "\x20"  "\x30"  "\x2e"  "\x35"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x6d"  "\x32"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x68"  "\x75"  "\x65"  "\x20"  "\x3c"  "\x20"  "\x28"  "\x32"  "\x2e"  "\x30"  "\x20"  "\x2f"  "\x20"  "\x33"  "\x2e"  "\x30"  "\x29"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x6d"  "\x31"  "\x20"  "\x2b"  "\x20"  "\x28"  "\x6d"  "\x32"  "\x20"  "\x2d"  "\x20"  "\x6d"  "\x31"  "\x29"  "\x20"  "\x2a"  "\x20"  "\x28"  "\x32"  "\x2e"  "\x30"  "\x20"  "\x2f"  "\x20"  "\x33"  "\x2e"  "\x30"  "\x20"  "\x2d"  "\x20"  "\x68"  "\x75"  "\x65"  "\x29"  "\x20"  "\x2a"  "\x20"  "\x36"  "\x2e"  "\x30"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x6d"  "\x31"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x52"  "\x47"  "\x42"  "\x41"  "\x33"  "\x32"  "\x20"  "\x68"  "\x73"  "\x6c"  "\x5f"  "\x74"  "\x6f"  "\x5f"  "\x72"  "\x67"  "\x62"  "\x28"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x68"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x73"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x6c"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x43"  "\x4c"  "\x4f"  "\x53"  "\x45"  "\x5f"  "\x45"  "\x4e"  "\x4f"  "\x55"  "\x47"  "\x48"  "\x28"  "\x73"  "\x2c"  "\x20"  "\x30"  "\x2e"  "\x30"  "\x2c"  "\x20"  "\x45"  "\x50"  "\x53"  "\x29"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x28"  "\x52"  "\x47"  "\x42"  "\x41"  "\x33"  "\x32"  "\x29"  "\x7b"  "\x2e"  "\x78"  "\x20"  "\x3d"  "\x20"  "\x32"  "\x35"  "\x35"  "\x20"  "\x2a"  "\x20"  "\x6c"  "\x2c"  "\x20"  "\x2e"  "\x79"  "\x20"  "\x3d"  "\x20"  "\x32"  "\x35"  "\x35"  "\x20"  "\x2a"  "\x20"  "\x6c"  "\x2c"  "\x20"  "\x2e"  "\x7a"  "\x20"  "\x3d"  "\x20"  "\x32"  "\x35"  "\x35"  "\x20"  "\x2a"  "\x20"  "\x6c"  "\x2c"  "\x20"  "\x2e"  "\x77"  "\x20"  "\x3d"  "\x20"  "\x32"  "\x35"  "\x35"  "\x7d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x6d"  "\x32"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x6c"  "\x20"  "\x3c"  "\x3d"  "\x20"  "\x30"  "\x2e"  "\x35"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6d"  "\x32"  "\x20"  "\x3d"  "\x20"  "\x6c"  "\x20"  "\x2a"  "\x20"  "\x28"  "\x31"  "\x2e"  "\x30"  "\x20"  "\x2b"  "\x20"  "\x73"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x65"  "\x6c"  "\x73"  "\x65"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6d"  "\x32"  "\x20"  "\x3d"  "\x20"  "\x6c"  "\x20"  "\x2b"  "\x20"  "\x73"  "\x20"  "\x2d"  "\x20"  "\x6c"  "\x20"  "\x2a"  "\x20"  "\x73"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x6d"  "\x31"  "\x20"  "\x3d"  "\x20"  "\x32"  "\x2e"  "\x30"  "\x20"  "\x2a"  "\x20"  "\x6c"  "\x20"  "\x2d"  "\x20"  "\x6d"  "\x32"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x52"  "\x47"  "\x42"  "\x41"  "\x33"  "\x32"  "\x20"  "\x72"  "\x65"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x52"  "\x47"  "\x42"  "\x41"  "\x33"  "\x32"  "\x29"  "\x7b"  "\x2e"  "\x78"  "\x20"  "\x3d"  "\x20"  "\x5f"  "\x76"  "\x28"  "\x6d"  "\x31"  "\x2c"  "\x20"  "\x6d"  "\x32"  "\x2c"  "\x20"  "\x68"  "\x20"  "\x2b"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x20"  "\x2f"  "\x20"  "\x33"  "\x2e"  "\x30"  "\x29"  "\x20"  "\x2a"  "\x20"  "\x32"  "\x35"  "\x35"  "\x2c"  "\x20"  "\x2e"  "\x79"  "\x20"  "\x3d"  "\x20"  "\x5f"  "\x76"  "\x28"  "\x6d"  "\x31"  "\x2c"  "\x20"  "\x6d"  "\x32"  "\x2c"  "\x20"  "\x68"  "\x29"  "\x20"  "\x2a"  "\x20"  "\x32"  "\x35"  "\x35"  "\x2c"  "\x20"  "\x2e"  "\x7a"  "\x20"  "\x3d"  "\x20"  "\x5f"  "\x76"  "\x28"  "\x6d"  "\x31"  "\x2c"  "\x20"  "\x6d"  "\x32"  "\x2c"  "\x20"  "\x68"  "\x20"  "\x2d"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x20"  "\x2f"  "\x20"  "\x33"  "\x2e"  "\x30"  "\x29"  "\x20"  "\x2a"  "\x20"  "\x32"  "\x35"  "\x35"  "\x2c"  "\x20"  "\x2e"  "\x77"  "\x20"  "\x3d"  "\x20"  "\x32"  "\x35"  "\x35"  "\x7d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x2f"  "\x2f"  "\x52"  "\x47"  "\x42"  "\x41"  "\x20"  "\x2d"  "\x3e"  "\x20"  "\x42"  "\x47"  "\x52"  "\x41"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x28"  "\x52"  "\x47"  "\x42"  "\x41"  "\x33"  "\x32"  "\x29"  "\x7b"  "\x2e"  "\x78"  "\x20"  "\x3d"  "\x20"  "\x72"  "\x65"  "\x74"  "\x2e"  "\x7a"  "\x2c"  "\x20"  "\x2e"  "\x79"  "\x20"  "\x3d"  "\x20"  "\x72"  "\x65"  "\x74"  "\x2e"  "\x79"  "\x2c"  "\x20"  "\x2e"  "\x7a"  "\x20"  "\x3d"  "\x20"  "\x72"  "\x65"  "\x74"  "\x2e"  "\x78"  "\x2c"  "\x20"  "\x2e"  "\x77"  "\x20"  "\x3d"  "\x20"  "\x72"  "\x65"  "\x74"  "\x2e"  "\x77"  "\x7d"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x52"  "\x47"  "\x42"  "\x41"  "\x33"  "\x32"  "\x20"  "\x6d"  "\x5f"  "\x74"  "\x6f"  "\x5f"  "\x68"  "\x73"  "\x6c"  "\x28"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6d"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x2f"  "\x2f"  "\x6d"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x6e"  "\x6f"  "\x72"  "\x6d"  "\x61"  "\x6c"  "\x69"  "\x7a"  "\x65"  "\x28"  "\x6d"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x61"  "\x6e"  "\x67"  "\x6c"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x61"  "\x74"  "\x61"  "\x6e"  "\x32"  "\x28"  "\x6d"  "\x2e"  "\x79"  "\x2c"  "\x20"  "\x6d"  "\x2e"  "\x78"  "\x29"  "\x20"  "\x2f"  "\x20"  "\x4d"  "\x5f"  "\x50"  "\x49"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x61"  "\x6e"  "\x67"  "\x6c"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x61"  "\x6e"  "\x67"  "\x6c"  "\x65"  "\x20"  "\x2b"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x29"  "\x20"  "\x2f"  "\x20"  "\x32"  "\x2e"  "\x30"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x6c"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x6d"  "\x2e"  "\x7a"  "\x20"  "\x2b"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x29"  "\x20"  "\x2f"  "\x20"  "\x32"  "\x2e"  "\x30"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x73"  "\x20"  "\x3d"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x68"  "\x73"  "\x6c"  "\x5f"  "\x74"  "\x6f"  "\x5f"  "\x72"  "\x67"  "\x62"  "\x28"  "\x61"  "\x6e"  "\x67"  "\x6c"  "\x65"  "\x2c"  "\x20"  "\x73"  "\x2c"  "\x20"  "\x6c"  "\x29"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x0a"  "\x0a"  "\x0a"  "\x0a"  "\x6b"  "\x65"  "\x72"  "\x6e"  "\x65"  "\x6c"  "\x20"  "\x76"  "\x6f"  "\x69"  "\x64"  "\x20"  "\x67"  "\x70"  "\x75"  "\x5f"  "\x73"  "\x74"  "\x65"  "\x70"  "\x28"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x73"  "\x69"  "\x74"  "\x65"  "\x5f"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x73"  "\x20"  "\x2a"  "\x67"  "\x73"  "\x2c"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x2a"  "\x69"  "\x6e"  "\x70"  "\x75"  "\x74"  "\x2c"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x2a"  "\x6f"  "\x75"  "\x74"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x64"  "\x74"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x74"  "\x69"  "\x6d"  "\x65"  "\x2c"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x20"  "\x67"  "\x69"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x73"  "\x74"  "\x20"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x20"  "\x69"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x67"  "\x6c"  "\x6f"  "\x62"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x64"  "\x28"  "\x30"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x69"  "\x64"  "\x20"  "\x3e"  "\x3d"  "\x20"  "\x28"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x2a"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3d"  "\x20"  "\x69"  "\x64"  "\x20"  "\x25"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3d"  "\x20"  "\x69"  "\x64"  "\x20"  "\x2f"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x65"  "\x74"  "\x65"  "\x72"  "\x73"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x65"  "\x74"  "\x65"  "\x72"  "\x73"  "\x29"  "\x7b"  "\x7d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x73"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x20"  "\x3d"  "\x20"  "\x61"  "\x70"  "\x70"  "\x6c"  "\x79"  "\x5f"  "\x70"  "\x62"  "\x63"  "\x28"  "\x69"  "\x6e"  "\x70"  "\x75"  "\x74"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x70"  "\x62"  "\x63"  "\x2c"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x61"  "\x70"  "\x70"  "\x6c"  "\x79"  "\x5f"  "\x70"  "\x62"  "\x63"  "\x28"  "\x69"  "\x6e"  "\x70"  "\x75"  "\x74"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x70"  "\x62"  "\x63"  "\x2c"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x2d"  "\x20"  "\x31"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x61"  "\x70"  "\x70"  "\x6c"  "\x79"  "\x5f"  "\x70"  "\x62"  "\x63"  "\x28"  "\x69"  "\x6e"  "\x70"  "\x75"  "\x74"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x70"  "\x62"  "\x63"  "\x2c"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x2b"  "\x20"  "\x31"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x75"  "\x70"  "\x20"  "\x3d"  "\x20"  "\x61"  "\x70"  "\x70"  "\x6c"  "\x79"  "\x5f"  "\x70"  "\x62"  "\x63"  "\x28"  "\x69"  "\x6e"  "\x70"  "\x75"  "\x74"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x70"  "\x62"  "\x63"  "\x2c"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2b"  "\x20"  "\x31"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x20"  "\x3d"  "\x20"  "\x61"  "\x70"  "\x70"  "\x6c"  "\x79"  "\x5f"  "\x70"  "\x62"  "\x63"  "\x28"  "\x69"  "\x6e"  "\x70"  "\x75"  "\x74"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x70"  "\x62"  "\x63"  "\x2c"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2d"  "\x20"  "\x31"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x74"  "\x69"  "\x6d"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x74"  "\x69"  "\x6d"  "\x65"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x20"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x73"  "\x65"  "\x65"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x2a"  "\x28"  "\x28"  "\x69"  "\x6e"  "\x74"  "\x2a"  "\x29"  "\x28"  "\x26"  "\x74"  "\x69"  "\x6d"  "\x65"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x73"  "\x65"  "\x65"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x73"  "\x65"  "\x65"  "\x64"  "\x20"  "\x3c"  "\x3c"  "\x20"  "\x31"  "\x36"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x73"  "\x65"  "\x65"  "\x64"  "\x28"  "\x26"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2c"  "\x20"  "\x73"  "\x65"  "\x65"  "\x64"  "\x20"  "\x2b"  "\x20"  "\x69"  "\x64"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x26"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x3b"  "\x0a"  "\x0a"  "\x23"  "\x69"  "\x66"  "\x64"  "\x65"  "\x66"  "\x20"  "\x49"  "\x4e"  "\x43"  "\x4c"  "\x55"  "\x44"  "\x45"  "\x5f"  "\x44"  "\x49"  "\x50"  "\x4f"  "\x4c"  "\x41"  "\x52"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x28"  "\x30"  "\x2e"  "\x30"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x66"  "\x6f"  "\x72"  "\x20"  "\x28"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x64"  "\x72"  "\x20"  "\x3d"  "\x20"  "\x2d"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x2f"  "\x20"  "\x32"  "\x3b"  "\x20"  "\x64"  "\x72"  "\x20"  "\x3c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x2f"  "\x20"  "\x32"  "\x3b"  "\x20"  "\x2b"  "\x2b"  "\x64"  "\x72"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x64"  "\x79"  "\x20"  "\x3d"  "\x20"  "\x64"  "\x72"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x66"  "\x6f"  "\x72"  "\x20"  "\x28"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x64"  "\x63"  "\x20"  "\x3d"  "\x20"  "\x2d"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x20"  "\x2f"  "\x20"  "\x32"  "\x3b"  "\x20"  "\x64"  "\x63"  "\x20"  "\x3c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x20"  "\x2f"  "\x20"  "\x32"  "\x3b"  "\x20"  "\x2b"  "\x2b"  "\x64"  "\x63"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x64"  "\x72"  "\x20"  "\x3d"  "\x3d"  "\x20"  "\x30"  "\x20"  "\x26"  "\x26"  "\x20"  "\x64"  "\x63"  "\x20"  "\x3d"  "\x3d"  "\x20"  "\x30"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x74"  "\x69"  "\x6e"  "\x75"  "\x65"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x64"  "\x78"  "\x20"  "\x3d"  "\x20"  "\x64"  "\x63"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x72"  "\x5f"  "\x69"  "\x6a"  "\x5f"  "\x20"  "\x3d"  "\x20"  "\x73"  "\x71"  "\x72"  "\x74"  "\x28"  "\x64"  "\x78"  "\x20"  "\x2a"  "\x20"  "\x64"  "\x78"  "\x20"  "\x2b"  "\x20"  "\x64"  "\x79"  "\x20"  "\x2a"  "\x20"  "\x64"  "\x79"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x72"  "\x5f"  "\x69"  "\x6a"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x6e"  "\x6f"  "\x72"  "\x6d"  "\x61"  "\x6c"  "\x69"  "\x7a"  "\x65"  "\x28"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x28"  "\x64"  "\x78"  "\x2c"  "\x20"  "\x64"  "\x79"  "\x2c"  "\x20"  "\x30"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6d"  "\x6a"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x73"  "\x69"  "\x74"  "\x65"  "\x5f"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x73"  "\x20"  "\x67"  "\x6a"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x61"  "\x70"  "\x70"  "\x6c"  "\x79"  "\x5f"  "\x70"  "\x62"  "\x63"  "\x5f"  "\x63"  "\x6f"  "\x6d"  "\x70"  "\x6c"  "\x65"  "\x74"  "\x65"  "\x28"  "\x67"  "\x73"  "\x2c"  "\x20"  "\x69"  "\x6e"  "\x70"  "\x75"  "\x74"  "\x2c"  "\x20"  "\x26"  "\x6d"  "\x6a"  "\x2c"  "\x20"  "\x26"  "\x67"  "\x6a"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x70"  "\x62"  "\x63"  "\x2c"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2b"  "\x20"  "\x64"  "\x72"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x2b"  "\x20"  "\x64"  "\x63"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x66"  "\x61"  "\x63"  "\x74"  "\x6f"  "\x72"  "\x20"  "\x3d"  "\x20"  "\x2d"  "\x4d"  "\x55"  "\x5f"  "\x30"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x6d"  "\x75"  "\x20"  "\x2a"  "\x20"  "\x67"  "\x6a"  "\x2e"  "\x6d"  "\x75"  "\x20"  "\x2f"  "\x20"  "\x28"  "\x34"  "\x2e"  "\x30"  "\x20"  "\x2a"  "\x20"  "\x4d"  "\x5f"  "\x50"  "\x49"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x65"  "\x72"  "\x61"  "\x63"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x72"  "\x5f"  "\x69"  "\x6a"  "\x2c"  "\x20"  "\x33"  "\x2e"  "\x30"  "\x20"  "\x2a"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x64"  "\x6f"  "\x74"  "\x28"  "\x6d"  "\x6a"  "\x2c"  "\x20"  "\x72"  "\x5f"  "\x69"  "\x6a"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x65"  "\x72"  "\x61"  "\x63"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x62"  "\x28"  "\x69"  "\x6e"  "\x74"  "\x65"  "\x72"  "\x61"  "\x63"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x2c"  "\x20"  "\x6d"  "\x6a"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x65"  "\x72"  "\x61"  "\x63"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x69"  "\x6e"  "\x74"  "\x65"  "\x72"  "\x61"  "\x63"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x2c"  "\x20"  "\x66"  "\x61"  "\x63"  "\x74"  "\x6f"  "\x72"  "\x20"  "\x2f"  "\x20"  "\x28"  "\x72"  "\x5f"  "\x69"  "\x6a"  "\x5f"  "\x20"  "\x2a"  "\x20"  "\x72"  "\x5f"  "\x69"  "\x6a"  "\x5f"  "\x20"  "\x2a"  "\x20"  "\x72"  "\x5f"  "\x69"  "\x6a"  "\x5f"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x2c"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x65"  "\x72"  "\x61"  "\x63"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7d"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7d"  "\x0a"  "\x23"  "\x65"  "\x6e"  "\x64"  "\x69"  "\x66"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x74"  "\x65"  "\x6d"  "\x70"  "\x65"  "\x72"  "\x61"  "\x74"  "\x75"  "\x72"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x61"  "\x74"  "\x65"  "\x5f"  "\x74"  "\x65"  "\x6d"  "\x70"  "\x65"  "\x72"  "\x61"  "\x74"  "\x75"  "\x72"  "\x65"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x74"  "\x69"  "\x6d"  "\x65"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x21"  "\x43"  "\x4c"  "\x4f"  "\x53"  "\x45"  "\x5f"  "\x45"  "\x4e"  "\x4f"  "\x55"  "\x47"  "\x48"  "\x28"  "\x74"  "\x65"  "\x6d"  "\x70"  "\x65"  "\x72"  "\x61"  "\x74"  "\x75"  "\x72"  "\x65"  "\x2c"  "\x20"  "\x30"  "\x2e"  "\x30"  "\x2c"  "\x20"  "\x45"  "\x50"  "\x53"  "\x29"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x74"  "\x65"  "\x6d"  "\x70"  "\x65"  "\x72"  "\x61"  "\x74"  "\x75"  "\x72"  "\x65"  "\x5f"  "\x65"  "\x66"  "\x66"  "\x65"  "\x63"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x6e"  "\x6f"  "\x72"  "\x6d"  "\x61"  "\x6c"  "\x69"  "\x7a"  "\x65"  "\x28"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x28"  "\x6e"  "\x6f"  "\x72"  "\x6d"  "\x61"  "\x6c"  "\x5f"  "\x64"  "\x69"  "\x73"  "\x74"  "\x72"  "\x69"  "\x62"  "\x75"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x29"  "\x2c"  "\x20"  "\x6e"  "\x6f"  "\x72"  "\x6d"  "\x61"  "\x6c"  "\x5f"  "\x64"  "\x69"  "\x73"  "\x74"  "\x72"  "\x69"  "\x62"  "\x75"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x29"  "\x2c"  "\x20"  "\x6e"  "\x6f"  "\x72"  "\x6d"  "\x61"  "\x6c"  "\x5f"  "\x64"  "\x69"  "\x73"  "\x74"  "\x72"  "\x69"  "\x62"  "\x75"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x29"  "\x29"  "\x29"  "\x2c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x73"  "\x71"  "\x72"  "\x74"  "\x28"  "\x32"  "\x2e"  "\x30"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x61"  "\x6c"  "\x70"  "\x68"  "\x61"  "\x20"  "\x2a"  "\x20"  "\x4b"  "\x42"  "\x20"  "\x2a"  "\x20"  "\x74"  "\x65"  "\x6d"  "\x70"  "\x65"  "\x72"  "\x61"  "\x74"  "\x75"  "\x72"  "\x65"  "\x20"  "\x2f"  "\x20"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x67"  "\x61"  "\x6d"  "\x6d"  "\x61"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x6d"  "\x75"  "\x20"  "\x2a"  "\x20"  "\x64"  "\x74"  "\x29"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7d"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6f"  "\x75"  "\x74"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x6e"  "\x6f"  "\x72"  "\x6d"  "\x61"  "\x6c"  "\x69"  "\x7a"  "\x65"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x70"  "\x69"  "\x6e"  "\x2e"  "\x70"  "\x69"  "\x6e"  "\x6e"  "\x65"  "\x64"  "\x3f"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x70"  "\x69"  "\x6e"  "\x2e"  "\x64"  "\x69"  "\x72"  "\x3a"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2c"  "\x20"  "\x73"  "\x74"  "\x65"  "\x70"  "\x5f"  "\x6c"  "\x6c"  "\x67"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2c"  "\x20"  "\x64"  "\x74"  "\x29"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x6b"  "\x65"  "\x72"  "\x6e"  "\x65"  "\x6c"  "\x20"  "\x76"  "\x6f"  "\x69"  "\x64"  "\x20"  "\x65"  "\x78"  "\x74"  "\x72"  "\x61"  "\x63"  "\x74"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x28"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x73"  "\x69"  "\x74"  "\x65"  "\x5f"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x73"  "\x20"  "\x2a"  "\x67"  "\x73"  "\x2c"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x2a"  "\x6d"  "\x30"  "\x2c"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x2a"  "\x6d"  "\x31"  "\x2c"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x72"  "\x6d"  "\x61"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x5f"  "\x70"  "\x61"  "\x63"  "\x6b"  "\x65"  "\x64"  "\x20"  "\x2a"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x64"  "\x74"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x74"  "\x69"  "\x6d"  "\x65"  "\x2c"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x20"  "\x67"  "\x69"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x20"  "\x69"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x67"  "\x6c"  "\x6f"  "\x62"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x64"  "\x28"  "\x30"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x69"  "\x64"  "\x20"  "\x3e"  "\x3d"  "\x20"  "\x28"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x2a"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3d"  "\x20"  "\x69"  "\x64"  "\x20"  "\x25"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3d"  "\x20"  "\x69"  "\x64"  "\x20"  "\x2f"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x65"  "\x74"  "\x65"  "\x72"  "\x73"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x73"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x20"  "\x3d"  "\x20"  "\x6d"  "\x30"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x64"  "\x6d"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x62"  "\x28"  "\x6d"  "\x31"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x61"  "\x70"  "\x70"  "\x6c"  "\x79"  "\x5f"  "\x70"  "\x62"  "\x63"  "\x28"  "\x6d"  "\x30"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x70"  "\x62"  "\x63"  "\x2c"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x2d"  "\x20"  "\x31"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x61"  "\x70"  "\x70"  "\x6c"  "\x79"  "\x5f"  "\x70"  "\x62"  "\x63"  "\x28"  "\x6d"  "\x30"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x70"  "\x62"  "\x63"  "\x2c"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x2b"  "\x20"  "\x31"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x75"  "\x70"  "\x20"  "\x3d"  "\x20"  "\x61"  "\x70"  "\x70"  "\x6c"  "\x79"  "\x5f"  "\x70"  "\x62"  "\x63"  "\x28"  "\x6d"  "\x30"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x70"  "\x62"  "\x63"  "\x2c"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2b"  "\x20"  "\x31"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x20"  "\x3d"  "\x20"  "\x61"  "\x70"  "\x70"  "\x6c"  "\x79"  "\x5f"  "\x70"  "\x62"  "\x63"  "\x28"  "\x6d"  "\x30"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x70"  "\x62"  "\x63"  "\x2c"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2d"  "\x20"  "\x31"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x74"  "\x69"  "\x6d"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x74"  "\x69"  "\x6d"  "\x65"  "\x3b"  "\x0a"  "\x23"  "\x69"  "\x66"  "\x64"  "\x65"  "\x66"  "\x20"  "\x49"  "\x4e"  "\x43"  "\x4c"  "\x55"  "\x44"  "\x45"  "\x5f"  "\x44"  "\x49"  "\x50"  "\x4f"  "\x4c"  "\x41"  "\x52"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x20"  "\x3d"  "\x20"  "\x30"  "\x2e"  "\x30"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x66"  "\x6f"  "\x72"  "\x20"  "\x28"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x64"  "\x72"  "\x20"  "\x3d"  "\x20"  "\x2d"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x2f"  "\x20"  "\x32"  "\x3b"  "\x20"  "\x64"  "\x72"  "\x20"  "\x3c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x2f"  "\x20"  "\x32"  "\x3b"  "\x20"  "\x2b"  "\x2b"  "\x64"  "\x72"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x64"  "\x79"  "\x20"  "\x3d"  "\x20"  "\x64"  "\x72"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x66"  "\x6f"  "\x72"  "\x20"  "\x28"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x64"  "\x63"  "\x20"  "\x3d"  "\x20"  "\x2d"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x20"  "\x2f"  "\x20"  "\x32"  "\x3b"  "\x20"  "\x64"  "\x63"  "\x20"  "\x3c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x20"  "\x2f"  "\x20"  "\x32"  "\x3b"  "\x20"  "\x2b"  "\x2b"  "\x64"  "\x63"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x64"  "\x72"  "\x20"  "\x3d"  "\x3d"  "\x20"  "\x30"  "\x20"  "\x26"  "\x26"  "\x20"  "\x64"  "\x63"  "\x20"  "\x3d"  "\x3d"  "\x20"  "\x30"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x74"  "\x69"  "\x6e"  "\x75"  "\x65"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x64"  "\x78"  "\x20"  "\x3d"  "\x20"  "\x64"  "\x63"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x72"  "\x5f"  "\x69"  "\x6a"  "\x5f"  "\x20"  "\x3d"  "\x20"  "\x73"  "\x71"  "\x72"  "\x74"  "\x28"  "\x64"  "\x78"  "\x20"  "\x2a"  "\x20"  "\x64"  "\x78"  "\x20"  "\x2b"  "\x20"  "\x64"  "\x79"  "\x20"  "\x2a"  "\x20"  "\x64"  "\x79"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x72"  "\x5f"  "\x69"  "\x6a"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x6e"  "\x6f"  "\x72"  "\x6d"  "\x61"  "\x6c"  "\x69"  "\x7a"  "\x65"  "\x28"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x28"  "\x64"  "\x78"  "\x2c"  "\x20"  "\x64"  "\x79"  "\x2c"  "\x20"  "\x30"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6d"  "\x6a"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x73"  "\x69"  "\x74"  "\x65"  "\x5f"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x73"  "\x20"  "\x67"  "\x6a"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x61"  "\x70"  "\x70"  "\x6c"  "\x79"  "\x5f"  "\x70"  "\x62"  "\x63"  "\x5f"  "\x63"  "\x6f"  "\x6d"  "\x70"  "\x6c"  "\x65"  "\x74"  "\x65"  "\x28"  "\x67"  "\x73"  "\x2c"  "\x20"  "\x6d"  "\x30"  "\x2c"  "\x20"  "\x26"  "\x6d"  "\x6a"  "\x2c"  "\x20"  "\x26"  "\x67"  "\x6a"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x70"  "\x62"  "\x63"  "\x2c"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2b"  "\x20"  "\x64"  "\x72"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x2b"  "\x20"  "\x64"  "\x63"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x65"  "\x72"  "\x61"  "\x63"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x20"  "\x3d"  "\x20"  "\x2d"  "\x4d"  "\x55"  "\x5f"  "\x30"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x6d"  "\x75"  "\x20"  "\x2a"  "\x20"  "\x67"  "\x6a"  "\x2e"  "\x6d"  "\x75"  "\x20"  "\x2f"  "\x20"  "\x28"  "\x34"  "\x2e"  "\x30"  "\x20"  "\x2a"  "\x20"  "\x4d"  "\x5f"  "\x50"  "\x49"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x65"  "\x72"  "\x61"  "\x63"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x20"  "\x2a"  "\x3d"  "\x20"  "\x28"  "\x33"  "\x2e"  "\x30"  "\x20"  "\x2a"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x64"  "\x6f"  "\x74"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2c"  "\x20"  "\x72"  "\x5f"  "\x69"  "\x6a"  "\x29"  "\x20"  "\x2d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x64"  "\x6f"  "\x74"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2c"  "\x20"  "\x6d"  "\x6a"  "\x29"  "\x29"  "\x20"  "\x2f"  "\x20"  "\x28"  "\x72"  "\x5f"  "\x69"  "\x6a"  "\x5f"  "\x20"  "\x2a"  "\x20"  "\x72"  "\x5f"  "\x69"  "\x6a"  "\x5f"  "\x20"  "\x2a"  "\x20"  "\x72"  "\x5f"  "\x69"  "\x6a"  "\x5f"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x20"  "\x2b"  "\x3d"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x65"  "\x72"  "\x61"  "\x63"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7d"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7d"  "\x0a"  "\x23"  "\x65"  "\x6e"  "\x64"  "\x69"  "\x66"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x72"  "\x6d"  "\x61"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x5f"  "\x70"  "\x61"  "\x63"  "\x6b"  "\x65"  "\x64"  "\x20"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x72"  "\x6d"  "\x61"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x5f"  "\x70"  "\x61"  "\x63"  "\x6b"  "\x65"  "\x64"  "\x29"  "\x7b"  "\x7d"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2e"  "\x65"  "\x78"  "\x63"  "\x68"  "\x61"  "\x6e"  "\x67"  "\x65"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x20"  "\x3d"  "\x20"  "\x65"  "\x78"  "\x63"  "\x68"  "\x61"  "\x6e"  "\x67"  "\x65"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2e"  "\x64"  "\x6d"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x20"  "\x3d"  "\x20"  "\x64"  "\x6d"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2e"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x20"  "\x3d"  "\x20"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2e"  "\x61"  "\x6e"  "\x69"  "\x73"  "\x6f"  "\x74"  "\x72"  "\x6f"  "\x70"  "\x79"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x20"  "\x3d"  "\x20"  "\x61"  "\x6e"  "\x69"  "\x73"  "\x6f"  "\x74"  "\x72"  "\x6f"  "\x70"  "\x79"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2e"  "\x63"  "\x75"  "\x62"  "\x69"  "\x63"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x20"  "\x3d"  "\x20"  "\x63"  "\x75"  "\x62"  "\x69"  "\x63"  "\x5f"  "\x61"  "\x6e"  "\x69"  "\x73"  "\x6f"  "\x74"  "\x72"  "\x6f"  "\x70"  "\x79"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x29"  "\x3b"  "\x0a"  "\x23"  "\x69"  "\x66"  "\x64"  "\x65"  "\x66"  "\x20"  "\x49"  "\x4e"  "\x43"  "\x4c"  "\x55"  "\x44"  "\x45"  "\x5f"  "\x44"  "\x49"  "\x50"  "\x4f"  "\x4c"  "\x41"  "\x52"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2e"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x20"  "\x3d"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x3b"  "\x0a"  "\x23"  "\x65"  "\x6e"  "\x64"  "\x69"  "\x66"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2e"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x20"  "\x3d"  "\x20"  "\x30"  "\x2e"  "\x35"  "\x20"  "\x2a"  "\x20"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2e"  "\x65"  "\x78"  "\x63"  "\x68"  "\x61"  "\x6e"  "\x67"  "\x65"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x20"  "\x2b"  "\x20"  "\x30"  "\x2e"  "\x35"  "\x20"  "\x2a"  "\x20"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2e"  "\x64"  "\x6d"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x20"  "\x2b"  "\x20"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2e"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x20"  "\x2b"  "\x20"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2e"  "\x61"  "\x6e"  "\x69"  "\x73"  "\x6f"  "\x74"  "\x72"  "\x6f"  "\x70"  "\x79"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x20"  "\x2b"  "\x20"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2e"  "\x63"  "\x75"  "\x62"  "\x69"  "\x63"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x20"  "\x2b"  "\x20"  "\x30"  "\x2e"  "\x35"  "\x20"  "\x2a"  "\x20"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2e"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2e"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x5f"  "\x66"  "\x69"  "\x6e"  "\x69"  "\x74"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x5f"  "\x66"  "\x69"  "\x6e"  "\x69"  "\x74"  "\x65"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x75"  "\x70"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2e"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x5f"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x5f"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x75"  "\x70"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2e"  "\x61"  "\x62"  "\x73"  "\x5f"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x5f"  "\x66"  "\x69"  "\x6e"  "\x69"  "\x74"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x66"  "\x61"  "\x62"  "\x73"  "\x28"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2e"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x5f"  "\x66"  "\x69"  "\x6e"  "\x69"  "\x74"  "\x65"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2e"  "\x61"  "\x62"  "\x73"  "\x5f"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x5f"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x66"  "\x61"  "\x62"  "\x73"  "\x28"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2e"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x5f"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2e"  "\x61"  "\x76"  "\x67"  "\x5f"  "\x6d"  "\x20"  "\x3d"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2e"  "\x65"  "\x6c"  "\x65"  "\x63"  "\x74"  "\x72"  "\x69"  "\x63"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x65"  "\x6d"  "\x65"  "\x72"  "\x67"  "\x65"  "\x6e"  "\x74"  "\x5f"  "\x65"  "\x6c"  "\x65"  "\x63"  "\x74"  "\x72"  "\x69"  "\x63"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x75"  "\x70"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x64"  "\x6d"  "\x2c"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x20"  "\x2f"  "\x20"  "\x64"  "\x74"  "\x29"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x29"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2e"  "\x6d"  "\x61"  "\x67"  "\x6e"  "\x65"  "\x74"  "\x69"  "\x63"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x5f"  "\x66"  "\x69"  "\x6e"  "\x69"  "\x74"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x65"  "\x6d"  "\x65"  "\x72"  "\x67"  "\x65"  "\x6e"  "\x74"  "\x5f"  "\x6d"  "\x61"  "\x67"  "\x6e"  "\x65"  "\x74"  "\x69"  "\x63"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x5f"  "\x66"  "\x69"  "\x6e"  "\x69"  "\x74"  "\x65"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x75"  "\x70"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2e"  "\x6d"  "\x61"  "\x67"  "\x6e"  "\x65"  "\x74"  "\x69"  "\x63"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x5f"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x65"  "\x6d"  "\x65"  "\x72"  "\x67"  "\x65"  "\x6e"  "\x74"  "\x5f"  "\x6d"  "\x61"  "\x67"  "\x6e"  "\x65"  "\x74"  "\x69"  "\x63"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x5f"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x75"  "\x70"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2e"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x5f"  "\x63"  "\x65"  "\x6e"  "\x74"  "\x65"  "\x72"  "\x5f"  "\x78"  "\x20"  "\x3d"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x20"  "\x2a"  "\x20"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2e"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x5f"  "\x66"  "\x69"  "\x6e"  "\x69"  "\x74"  "\x65"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2e"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x5f"  "\x63"  "\x65"  "\x6e"  "\x74"  "\x65"  "\x72"  "\x5f"  "\x79"  "\x20"  "\x3d"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x20"  "\x2a"  "\x20"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2e"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x5f"  "\x66"  "\x69"  "\x6e"  "\x69"  "\x74"  "\x65"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2e"  "\x61"  "\x62"  "\x73"  "\x5f"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x5f"  "\x63"  "\x65"  "\x6e"  "\x74"  "\x65"  "\x72"  "\x5f"  "\x78"  "\x20"  "\x3d"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x20"  "\x2a"  "\x20"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2e"  "\x61"  "\x62"  "\x73"  "\x5f"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x5f"  "\x66"  "\x69"  "\x6e"  "\x69"  "\x74"  "\x65"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2e"  "\x61"  "\x62"  "\x73"  "\x5f"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x5f"  "\x63"  "\x65"  "\x6e"  "\x74"  "\x65"  "\x72"  "\x5f"  "\x79"  "\x20"  "\x3d"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x20"  "\x2a"  "\x20"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2e"  "\x61"  "\x62"  "\x73"  "\x5f"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x5f"  "\x66"  "\x69"  "\x6e"  "\x69"  "\x74"  "\x65"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x64"  "\x6d"  "\x5f"  "\x64"  "\x78"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x62"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x29"  "\x2c"  "\x20"  "\x30"  "\x2e"  "\x35"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x64"  "\x6d"  "\x5f"  "\x64"  "\x79"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x62"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x75"  "\x70"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x29"  "\x2c"  "\x20"  "\x30"  "\x2e"  "\x35"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2e"  "\x44"  "\x5f"  "\x78"  "\x78"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x64"  "\x6f"  "\x74"  "\x28"  "\x64"  "\x6d"  "\x5f"  "\x64"  "\x78"  "\x2c"  "\x20"  "\x64"  "\x6d"  "\x5f"  "\x64"  "\x78"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2e"  "\x44"  "\x5f"  "\x79"  "\x79"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x64"  "\x6f"  "\x74"  "\x28"  "\x64"  "\x6d"  "\x5f"  "\x64"  "\x79"  "\x2c"  "\x20"  "\x64"  "\x6d"  "\x5f"  "\x64"  "\x79"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2e"  "\x44"  "\x5f"  "\x78"  "\x79"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x64"  "\x6f"  "\x74"  "\x28"  "\x64"  "\x6d"  "\x5f"  "\x64"  "\x78"  "\x2c"  "\x20"  "\x64"  "\x6d"  "\x5f"  "\x64"  "\x79"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x20"  "\x3d"  "\x20"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x6b"  "\x65"  "\x72"  "\x6e"  "\x65"  "\x6c"  "\x20"  "\x76"  "\x6f"  "\x69"  "\x64"  "\x20"  "\x65"  "\x78"  "\x63"  "\x68"  "\x61"  "\x6e"  "\x67"  "\x65"  "\x5f"  "\x67"  "\x72"  "\x69"  "\x64"  "\x28"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x2a"  "\x74"  "\x6f"  "\x2c"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x2a"  "\x66"  "\x72"  "\x6f"  "\x6d"  "\x2c"  "\x20"  "\x75"  "\x6e"  "\x73"  "\x69"  "\x67"  "\x6e"  "\x65"  "\x64"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x75"  "\x6e"  "\x73"  "\x69"  "\x67"  "\x6e"  "\x65"  "\x64"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x20"  "\x69"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x67"  "\x6c"  "\x6f"  "\x62"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x64"  "\x28"  "\x30"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x69"  "\x64"  "\x20"  "\x3c"  "\x20"  "\x28"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x2a"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x74"  "\x6f"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x20"  "\x3d"  "\x20"  "\x66"  "\x72"  "\x6f"  "\x6d"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x6b"  "\x65"  "\x72"  "\x6e"  "\x65"  "\x6c"  "\x20"  "\x76"  "\x6f"  "\x69"  "\x64"  "\x20"  "\x72"  "\x65"  "\x6e"  "\x64"  "\x65"  "\x72"  "\x5f"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x62"  "\x77"  "\x72"  "\x28"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x2a"  "\x76"  "\x2c"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x20"  "\x67"  "\x69"  "\x2c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x52"  "\x47"  "\x42"  "\x41"  "\x33"  "\x32"  "\x2a"  "\x20"  "\x72"  "\x67"  "\x62"  "\x61"  "\x2c"  "\x20"  "\x75"  "\x6e"  "\x73"  "\x69"  "\x67"  "\x6e"  "\x65"  "\x64"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x77"  "\x69"  "\x64"  "\x74"  "\x68"  "\x2c"  "\x20"  "\x75"  "\x6e"  "\x73"  "\x69"  "\x67"  "\x6e"  "\x65"  "\x64"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x68"  "\x65"  "\x69"  "\x67"  "\x68"  "\x74"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x20"  "\x69"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x67"  "\x6c"  "\x6f"  "\x62"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x64"  "\x28"  "\x30"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x69"  "\x64"  "\x20"  "\x3e"  "\x3d"  "\x20"  "\x28"  "\x77"  "\x69"  "\x64"  "\x74"  "\x68"  "\x20"  "\x2a"  "\x20"  "\x68"  "\x65"  "\x69"  "\x67"  "\x68"  "\x74"  "\x29"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x69"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3d"  "\x20"  "\x69"  "\x64"  "\x20"  "\x25"  "\x20"  "\x77"  "\x69"  "\x64"  "\x74"  "\x68"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x69"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3d"  "\x20"  "\x69"  "\x64"  "\x20"  "\x2f"  "\x20"  "\x77"  "\x69"  "\x64"  "\x74"  "\x68"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x76"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x66"  "\x6c"  "\x6f"  "\x61"  "\x74"  "\x29"  "\x69"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x2f"  "\x20"  "\x77"  "\x69"  "\x64"  "\x74"  "\x68"  "\x20"  "\x2a"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x76"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x66"  "\x6c"  "\x6f"  "\x61"  "\x74"  "\x29"  "\x69"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2f"  "\x20"  "\x68"  "\x65"  "\x69"  "\x67"  "\x68"  "\x74"  "\x20"  "\x2a"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x2f"  "\x2f"  "\x72"  "\x65"  "\x6e"  "\x64"  "\x65"  "\x72"  "\x69"  "\x6e"  "\x67"  "\x20"  "\x69"  "\x6e"  "\x76"  "\x65"  "\x72"  "\x74"  "\x73"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x2c"  "\x20"  "\x6e"  "\x65"  "\x65"  "\x64"  "\x20"  "\x74"  "\x6f"  "\x20"  "\x69"  "\x6e"  "\x76"  "\x65"  "\x72"  "\x74"  "\x20"  "\x62"  "\x61"  "\x63"  "\x6b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x2d"  "\x20"  "\x31"  "\x20"  "\x2d"  "\x20"  "\x76"  "\x72"  "\x6f"  "\x77"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x76"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3e"  "\x3d"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x7c"  "\x7c"  "\x20"  "\x76"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3e"  "\x3d"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6d"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x5b"  "\x76"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2a"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x20"  "\x2b"  "\x20"  "\x76"  "\x63"  "\x6f"  "\x6c"  "\x5d"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x67"  "\x62"  "\x61"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x20"  "\x3d"  "\x20"  "\x6d"  "\x5f"  "\x62"  "\x77"  "\x72"  "\x5f"  "\x6d"  "\x61"  "\x70"  "\x70"  "\x69"  "\x6e"  "\x67"  "\x28"  "\x6d"  "\x29"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x6b"  "\x65"  "\x72"  "\x6e"  "\x65"  "\x6c"  "\x20"  "\x76"  "\x6f"  "\x69"  "\x64"  "\x20"  "\x72"  "\x65"  "\x6e"  "\x64"  "\x65"  "\x72"  "\x5f"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x68"  "\x73"  "\x6c"  "\x28"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x2a"  "\x76"  "\x2c"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x20"  "\x67"  "\x69"  "\x2c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x52"  "\x47"  "\x42"  "\x41"  "\x33"  "\x32"  "\x20"  "\x2a"  "\x72"  "\x67"  "\x62"  "\x61"  "\x2c"  "\x20"  "\x75"  "\x6e"  "\x73"  "\x69"  "\x67"  "\x6e"  "\x65"  "\x64"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x77"  "\x69"  "\x64"  "\x74"  "\x68"  "\x2c"  "\x20"  "\x75"  "\x6e"  "\x73"  "\x69"  "\x67"  "\x6e"  "\x65"  "\x64"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x68"  "\x65"  "\x69"  "\x67"  "\x68"  "\x74"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x20"  "\x69"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x67"  "\x6c"  "\x6f"  "\x62"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x64"  "\x28"  "\x30"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x69"  "\x64"  "\x20"  "\x3e"  "\x3d"  "\x20"  "\x28"  "\x77"  "\x69"  "\x64"  "\x74"  "\x68"  "\x20"  "\x2a"  "\x20"  "\x68"  "\x65"  "\x69"  "\x67"  "\x68"  "\x74"  "\x29"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x69"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3d"  "\x20"  "\x69"  "\x64"  "\x20"  "\x25"  "\x20"  "\x77"  "\x69"  "\x64"  "\x74"  "\x68"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x69"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3d"  "\x20"  "\x69"  "\x64"  "\x20"  "\x2f"  "\x20"  "\x77"  "\x69"  "\x64"  "\x74"  "\x68"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x76"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x66"  "\x6c"  "\x6f"  "\x61"  "\x74"  "\x29"  "\x69"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x2f"  "\x20"  "\x77"  "\x69"  "\x64"  "\x74"  "\x68"  "\x20"  "\x2a"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x76"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x66"  "\x6c"  "\x6f"  "\x61"  "\x74"  "\x29"  "\x69"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2f"  "\x20"  "\x68"  "\x65"  "\x69"  "\x67"  "\x68"  "\x74"  "\x20"  "\x2a"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x2f"  "\x2f"  "\x72"  "\x65"  "\x6e"  "\x64"  "\x65"  "\x72"  "\x69"  "\x6e"  "\x67"  "\x20"  "\x69"  "\x6e"  "\x76"  "\x65"  "\x72"  "\x74"  "\x73"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x2c"  "\x20"  "\x6e"  "\x65"  "\x65"  "\x64"  "\x20"  "\x74"  "\x6f"  "\x20"  "\x69"  "\x6e"  "\x76"  "\x65"  "\x72"  "\x74"  "\x20"  "\x62"  "\x61"  "\x63"  "\x6b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x2d"  "\x20"  "\x31"  "\x20"  "\x2d"  "\x20"  "\x76"  "\x72"  "\x6f"  "\x77"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x76"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3e"  "\x3d"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x7c"  "\x7c"  "\x20"  "\x76"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3e"  "\x3d"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6d"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x5b"  "\x76"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2a"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x20"  "\x2b"  "\x20"  "\x76"  "\x63"  "\x6f"  "\x6c"  "\x5d"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x67"  "\x62"  "\x61"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x20"  "\x3d"  "\x20"  "\x6d"  "\x5f"  "\x74"  "\x6f"  "\x5f"  "\x68"  "\x73"  "\x6c"  "\x28"  "\x6d"  "\x29"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x6b"  "\x65"  "\x72"  "\x6e"  "\x65"  "\x6c"  "\x20"  "\x76"  "\x6f"  "\x69"  "\x64"  "\x20"  "\x63"  "\x61"  "\x6c"  "\x63"  "\x75"  "\x6c"  "\x61"  "\x74"  "\x65"  "\x5f"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x5f"  "\x74"  "\x6f"  "\x5f"  "\x72"  "\x65"  "\x6e"  "\x64"  "\x65"  "\x72"  "\x28"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x2a"  "\x76"  "\x2c"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x20"  "\x67"  "\x69"  "\x2c"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x2a"  "\x6f"  "\x75"  "\x74"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x20"  "\x69"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x67"  "\x6c"  "\x6f"  "\x62"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x64"  "\x28"  "\x30"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x69"  "\x64"  "\x20"  "\x3e"  "\x3d"  "\x20"  "\x28"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x2a"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3d"  "\x20"  "\x69"  "\x64"  "\x20"  "\x25"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3d"  "\x20"  "\x69"  "\x64"  "\x20"  "\x2f"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6d"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x61"  "\x70"  "\x70"  "\x6c"  "\x79"  "\x5f"  "\x70"  "\x62"  "\x63"  "\x28"  "\x76"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x70"  "\x62"  "\x63"  "\x2c"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x2d"  "\x20"  "\x31"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x61"  "\x70"  "\x70"  "\x6c"  "\x79"  "\x5f"  "\x70"  "\x62"  "\x63"  "\x28"  "\x76"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x70"  "\x62"  "\x63"  "\x2c"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x2b"  "\x20"  "\x31"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x75"  "\x70"  "\x20"  "\x3d"  "\x20"  "\x61"  "\x70"  "\x70"  "\x6c"  "\x79"  "\x5f"  "\x70"  "\x62"  "\x63"  "\x28"  "\x76"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x70"  "\x62"  "\x63"  "\x2c"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2b"  "\x20"  "\x31"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x20"  "\x3d"  "\x20"  "\x61"  "\x70"  "\x70"  "\x6c"  "\x79"  "\x5f"  "\x70"  "\x62"  "\x63"  "\x28"  "\x76"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x70"  "\x62"  "\x63"  "\x2c"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2d"  "\x20"  "\x31"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6f"  "\x75"  "\x74"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x20"  "\x3d"  "\x20"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x5f"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x28"  "\x6d"  "\x2c"  "\x20"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x2c"  "\x20"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x2c"  "\x20"  "\x75"  "\x70"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x29"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x6b"  "\x65"  "\x72"  "\x6e"  "\x65"  "\x6c"  "\x20"  "\x76"  "\x6f"  "\x69"  "\x64"  "\x20"  "\x72"  "\x65"  "\x6e"  "\x64"  "\x65"  "\x72"  "\x5f"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x28"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x2a"  "\x69"  "\x6e"  "\x70"  "\x75"  "\x74"  "\x2c"  "\x20"  "\x75"  "\x6e"  "\x73"  "\x69"  "\x67"  "\x6e"  "\x65"  "\x64"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x75"  "\x6e"  "\x73"  "\x69"  "\x67"  "\x6e"  "\x65"  "\x64"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x5f"  "\x6d"  "\x69"  "\x6e"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x5f"  "\x6d"  "\x61"  "\x78"  "\x2c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x52"  "\x47"  "\x42"  "\x41"  "\x33"  "\x32"  "\x20"  "\x2a"  "\x72"  "\x67"  "\x62"  "\x61"  "\x2c"  "\x20"  "\x75"  "\x6e"  "\x73"  "\x69"  "\x67"  "\x6e"  "\x65"  "\x64"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x77"  "\x69"  "\x64"  "\x74"  "\x68"  "\x2c"  "\x20"  "\x75"  "\x6e"  "\x73"  "\x69"  "\x67"  "\x6e"  "\x65"  "\x64"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x68"  "\x65"  "\x69"  "\x67"  "\x68"  "\x74"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x20"  "\x69"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x67"  "\x6c"  "\x6f"  "\x62"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x64"  "\x28"  "\x30"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x69"  "\x64"  "\x20"  "\x3e"  "\x3d"  "\x20"  "\x28"  "\x77"  "\x69"  "\x64"  "\x74"  "\x68"  "\x20"  "\x2a"  "\x20"  "\x68"  "\x65"  "\x69"  "\x67"  "\x68"  "\x74"  "\x29"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x69"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3d"  "\x20"  "\x69"  "\x64"  "\x20"  "\x25"  "\x20"  "\x77"  "\x69"  "\x64"  "\x74"  "\x68"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x69"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3d"  "\x20"  "\x69"  "\x64"  "\x20"  "\x2f"  "\x20"  "\x77"  "\x69"  "\x64"  "\x74"  "\x68"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x76"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x66"  "\x6c"  "\x6f"  "\x61"  "\x74"  "\x29"  "\x69"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x2f"  "\x20"  "\x77"  "\x69"  "\x64"  "\x74"  "\x68"  "\x20"  "\x2a"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x76"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x66"  "\x6c"  "\x6f"  "\x61"  "\x74"  "\x29"  "\x69"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2f"  "\x20"  "\x68"  "\x65"  "\x69"  "\x67"  "\x68"  "\x74"  "\x20"  "\x2a"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x2f"  "\x2f"  "\x72"  "\x65"  "\x6e"  "\x64"  "\x65"  "\x72"  "\x69"  "\x6e"  "\x67"  "\x20"  "\x69"  "\x6e"  "\x76"  "\x65"  "\x72"  "\x74"  "\x73"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x2c"  "\x20"  "\x6e"  "\x65"  "\x65"  "\x64"  "\x20"  "\x74"  "\x6f"  "\x20"  "\x69"  "\x6e"  "\x76"  "\x65"  "\x72"  "\x74"  "\x20"  "\x62"  "\x61"  "\x63"  "\x6b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3d"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x2d"  "\x20"  "\x31"  "\x20"  "\x2d"  "\x20"  "\x76"  "\x72"  "\x6f"  "\x77"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x76"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3e"  "\x3d"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x7c"  "\x7c"  "\x20"  "\x76"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3e"  "\x3d"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x73"  "\x74"  "\x61"  "\x72"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x28"  "\x30"  "\x2c"  "\x20"  "\x30"  "\x2c"  "\x20"  "\x30"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6d"  "\x69"  "\x64"  "\x64"  "\x6c"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x28"  "\x30"  "\x2e"  "\x35"  "\x2c"  "\x20"  "\x30"  "\x2e"  "\x35"  "\x2c"  "\x20"  "\x30"  "\x2e"  "\x35"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x65"  "\x6e"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x28"  "\x31"  "\x2c"  "\x20"  "\x31"  "\x2c"  "\x20"  "\x31"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x69"  "\x6e"  "\x70"  "\x75"  "\x74"  "\x5b"  "\x76"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2a"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x20"  "\x2b"  "\x20"  "\x76"  "\x63"  "\x6f"  "\x6c"  "\x5d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x20"  "\x2d"  "\x20"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x5f"  "\x6d"  "\x69"  "\x6e"  "\x29"  "\x20"  "\x2f"  "\x20"  "\x28"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x5f"  "\x6d"  "\x61"  "\x78"  "\x20"  "\x2d"  "\x20"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x5f"  "\x6d"  "\x69"  "\x6e"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x67"  "\x62"  "\x61"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x20"  "\x3d"  "\x20"  "\x6c"  "\x69"  "\x6e"  "\x65"  "\x61"  "\x72"  "\x5f"  "\x6d"  "\x61"  "\x70"  "\x70"  "\x69"  "\x6e"  "\x67"  "\x28"  "\x63"  "\x6c"  "\x61"  "\x6d"  "\x70"  "\x28"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x2c"  "\x20"  "\x30"  "\x2e"  "\x30"  "\x2c"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x29"  "\x2c"  "\x20"  "\x73"  "\x74"  "\x61"  "\x72"  "\x74"  "\x2c"  "\x20"  "\x6d"  "\x69"  "\x64"  "\x64"  "\x6c"  "\x65"  "\x2c"  "\x20"  "\x65"  "\x6e"  "\x64"  "\x29"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x6b"  "\x65"  "\x72"  "\x6e"  "\x65"  "\x6c"  "\x20"  "\x76"  "\x6f"  "\x69"  "\x64"  "\x20"  "\x72"  "\x65"  "\x6e"  "\x64"  "\x65"  "\x72"  "\x5f"  "\x70"  "\x69"  "\x6e"  "\x6e"  "\x69"  "\x6e"  "\x67"  "\x28"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x73"  "\x69"  "\x74"  "\x65"  "\x5f"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x73"  "\x20"  "\x2a"  "\x69"  "\x6e"  "\x70"  "\x75"  "\x74"  "\x2c"  "\x20"  "\x75"  "\x6e"  "\x73"  "\x69"  "\x67"  "\x6e"  "\x65"  "\x64"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x75"  "\x6e"  "\x73"  "\x69"  "\x67"  "\x6e"  "\x65"  "\x64"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x2c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x52"  "\x47"  "\x42"  "\x41"  "\x33"  "\x32"  "\x20"  "\x2a"  "\x72"  "\x67"  "\x62"  "\x61"  "\x2c"  "\x20"  "\x75"  "\x6e"  "\x73"  "\x69"  "\x67"  "\x6e"  "\x65"  "\x64"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x77"  "\x69"  "\x64"  "\x74"  "\x68"  "\x2c"  "\x20"  "\x75"  "\x6e"  "\x73"  "\x69"  "\x67"  "\x6e"  "\x65"  "\x64"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x68"  "\x65"  "\x69"  "\x67"  "\x68"  "\x74"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x20"  "\x69"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x67"  "\x6c"  "\x6f"  "\x62"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x64"  "\x28"  "\x30"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x69"  "\x64"  "\x20"  "\x3e"  "\x3d"  "\x20"  "\x28"  "\x77"  "\x69"  "\x64"  "\x74"  "\x68"  "\x20"  "\x2a"  "\x20"  "\x68"  "\x65"  "\x69"  "\x67"  "\x68"  "\x74"  "\x29"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x69"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3d"  "\x20"  "\x69"  "\x64"  "\x20"  "\x25"  "\x20"  "\x77"  "\x69"  "\x64"  "\x74"  "\x68"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x69"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3d"  "\x20"  "\x69"  "\x64"  "\x20"  "\x2f"  "\x20"  "\x77"  "\x69"  "\x64"  "\x74"  "\x68"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x76"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x66"  "\x6c"  "\x6f"  "\x61"  "\x74"  "\x29"  "\x69"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x2f"  "\x20"  "\x77"  "\x69"  "\x64"  "\x74"  "\x68"  "\x20"  "\x2a"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x76"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x66"  "\x6c"  "\x6f"  "\x61"  "\x74"  "\x29"  "\x69"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2f"  "\x20"  "\x68"  "\x65"  "\x69"  "\x67"  "\x68"  "\x74"  "\x20"  "\x2a"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x2f"  "\x2f"  "\x72"  "\x65"  "\x6e"  "\x64"  "\x65"  "\x72"  "\x69"  "\x6e"  "\x67"  "\x20"  "\x69"  "\x6e"  "\x76"  "\x65"  "\x72"  "\x74"  "\x73"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x2c"  "\x20"  "\x6e"  "\x65"  "\x65"  "\x64"  "\x20"  "\x74"  "\x6f"  "\x20"  "\x69"  "\x6e"  "\x76"  "\x65"  "\x72"  "\x74"  "\x20"  "\x62"  "\x61"  "\x63"  "\x6b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3d"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x2d"  "\x20"  "\x31"  "\x20"  "\x2d"  "\x20"  "\x76"  "\x72"  "\x6f"  "\x77"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x76"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3e"  "\x3d"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x7c"  "\x7c"  "\x20"  "\x76"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3e"  "\x3d"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x69"  "\x6e"  "\x70"  "\x75"  "\x74"  "\x5b"  "\x76"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2a"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x20"  "\x2b"  "\x20"  "\x76"  "\x63"  "\x6f"  "\x6c"  "\x5d"  "\x2e"  "\x70"  "\x69"  "\x6e"  "\x2e"  "\x70"  "\x69"  "\x6e"  "\x6e"  "\x65"  "\x64"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x67"  "\x62"  "\x61"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x52"  "\x47"  "\x42"  "\x41"  "\x33"  "\x32"  "\x29"  "\x7b"  "\x2e"  "\x61"  "\x20"  "\x3d"  "\x20"  "\x30"  "\x78"  "\x66"  "\x66"  "\x2c"  "\x20"  "\x2e"  "\x62"  "\x20"  "\x3d"  "\x20"  "\x30"  "\x2c"  "\x20"  "\x2e"  "\x67"  "\x20"  "\x3d"  "\x20"  "\x30"  "\x78"  "\x66"  "\x66"  "\x2c"  "\x20"  "\x2e"  "\x72"  "\x20"  "\x3d"  "\x20"  "\x30"  "\x78"  "\x66"  "\x66"  "\x7d"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x6b"  "\x65"  "\x72"  "\x6e"  "\x65"  "\x6c"  "\x20"  "\x76"  "\x6f"  "\x69"  "\x64"  "\x20"  "\x63"  "\x61"  "\x6c"  "\x63"  "\x75"  "\x6c"  "\x61"  "\x74"  "\x65"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x28"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x73"  "\x69"  "\x74"  "\x65"  "\x5f"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x73"  "\x20"  "\x2a"  "\x67"  "\x73"  "\x2c"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x2a"  "\x76"  "\x2c"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x20"  "\x67"  "\x69"  "\x2c"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x2a"  "\x6f"  "\x75"  "\x74"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x74"  "\x69"  "\x6d"  "\x65"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x20"  "\x69"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x67"  "\x6c"  "\x6f"  "\x62"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x64"  "\x28"  "\x30"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x69"  "\x64"  "\x20"  "\x3e"  "\x3d"  "\x20"  "\x28"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x2a"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3d"  "\x20"  "\x69"  "\x64"  "\x20"  "\x25"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3d"  "\x20"  "\x69"  "\x64"  "\x20"  "\x2f"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x65"  "\x74"  "\x65"  "\x72"  "\x73"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x73"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x61"  "\x70"  "\x70"  "\x6c"  "\x79"  "\x5f"  "\x70"  "\x62"  "\x63"  "\x28"  "\x76"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x70"  "\x62"  "\x63"  "\x2c"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x2d"  "\x20"  "\x31"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x61"  "\x70"  "\x70"  "\x6c"  "\x79"  "\x5f"  "\x70"  "\x62"  "\x63"  "\x28"  "\x76"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x70"  "\x62"  "\x63"  "\x2c"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x2b"  "\x20"  "\x31"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x75"  "\x70"  "\x20"  "\x3d"  "\x20"  "\x61"  "\x70"  "\x70"  "\x6c"  "\x79"  "\x5f"  "\x70"  "\x62"  "\x63"  "\x28"  "\x76"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x70"  "\x62"  "\x63"  "\x2c"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2b"  "\x20"  "\x31"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x20"  "\x3d"  "\x20"  "\x61"  "\x70"  "\x70"  "\x6c"  "\x79"  "\x5f"  "\x70"  "\x62"  "\x63"  "\x28"  "\x76"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x70"  "\x62"  "\x63"  "\x2c"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2d"  "\x20"  "\x31"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x74"  "\x69"  "\x6d"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x74"  "\x69"  "\x6d"  "\x65"  "\x3b"  "\x0a"  "\x0a"  "\x23"  "\x69"  "\x66"  "\x64"  "\x65"  "\x66"  "\x20"  "\x49"  "\x4e"  "\x43"  "\x4c"  "\x55"  "\x44"  "\x45"  "\x5f"  "\x44"  "\x49"  "\x50"  "\x4f"  "\x4c"  "\x41"  "\x52"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x20"  "\x3d"  "\x20"  "\x30"  "\x2e"  "\x30"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x66"  "\x6f"  "\x72"  "\x20"  "\x28"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x64"  "\x72"  "\x20"  "\x3d"  "\x20"  "\x2d"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x2f"  "\x20"  "\x32"  "\x3b"  "\x20"  "\x64"  "\x72"  "\x20"  "\x3c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x2f"  "\x20"  "\x32"  "\x3b"  "\x20"  "\x2b"  "\x2b"  "\x64"  "\x72"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x64"  "\x79"  "\x20"  "\x3d"  "\x20"  "\x64"  "\x72"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x66"  "\x6f"  "\x72"  "\x20"  "\x28"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x64"  "\x63"  "\x20"  "\x3d"  "\x20"  "\x2d"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x20"  "\x2f"  "\x20"  "\x32"  "\x3b"  "\x20"  "\x64"  "\x63"  "\x20"  "\x3c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x20"  "\x2f"  "\x20"  "\x32"  "\x3b"  "\x20"  "\x2b"  "\x2b"  "\x64"  "\x63"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x64"  "\x72"  "\x20"  "\x3d"  "\x3d"  "\x20"  "\x30"  "\x20"  "\x26"  "\x26"  "\x20"  "\x64"  "\x63"  "\x20"  "\x3d"  "\x3d"  "\x20"  "\x30"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x74"  "\x69"  "\x6e"  "\x75"  "\x65"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x64"  "\x78"  "\x20"  "\x3d"  "\x20"  "\x64"  "\x63"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x72"  "\x5f"  "\x69"  "\x6a"  "\x5f"  "\x20"  "\x3d"  "\x20"  "\x73"  "\x71"  "\x72"  "\x74"  "\x28"  "\x64"  "\x78"  "\x20"  "\x2a"  "\x20"  "\x64"  "\x78"  "\x20"  "\x2b"  "\x20"  "\x64"  "\x79"  "\x20"  "\x2a"  "\x20"  "\x64"  "\x79"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x72"  "\x5f"  "\x69"  "\x6a"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x6e"  "\x6f"  "\x72"  "\x6d"  "\x61"  "\x6c"  "\x69"  "\x7a"  "\x65"  "\x28"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x28"  "\x64"  "\x78"  "\x2c"  "\x20"  "\x64"  "\x79"  "\x2c"  "\x20"  "\x30"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6d"  "\x6a"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x73"  "\x69"  "\x74"  "\x65"  "\x5f"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x73"  "\x20"  "\x67"  "\x6a"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x61"  "\x70"  "\x70"  "\x6c"  "\x79"  "\x5f"  "\x70"  "\x62"  "\x63"  "\x5f"  "\x63"  "\x6f"  "\x6d"  "\x70"  "\x6c"  "\x65"  "\x74"  "\x65"  "\x28"  "\x67"  "\x73"  "\x2c"  "\x20"  "\x76"  "\x2c"  "\x20"  "\x26"  "\x6d"  "\x6a"  "\x2c"  "\x20"  "\x26"  "\x67"  "\x6a"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x70"  "\x62"  "\x63"  "\x2c"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2b"  "\x20"  "\x64"  "\x72"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x2b"  "\x20"  "\x64"  "\x63"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x65"  "\x72"  "\x61"  "\x63"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x20"  "\x3d"  "\x20"  "\x2d"  "\x4d"  "\x55"  "\x5f"  "\x30"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x6d"  "\x75"  "\x20"  "\x2a"  "\x20"  "\x67"  "\x6a"  "\x2e"  "\x6d"  "\x75"  "\x20"  "\x2f"  "\x20"  "\x28"  "\x34"  "\x2e"  "\x30"  "\x20"  "\x2a"  "\x20"  "\x4d"  "\x5f"  "\x50"  "\x49"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x65"  "\x72"  "\x61"  "\x63"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x20"  "\x2a"  "\x3d"  "\x20"  "\x28"  "\x33"  "\x2e"  "\x30"  "\x20"  "\x2a"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x64"  "\x6f"  "\x74"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2c"  "\x20"  "\x72"  "\x5f"  "\x69"  "\x6a"  "\x29"  "\x20"  "\x2d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x64"  "\x6f"  "\x74"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2c"  "\x20"  "\x6d"  "\x6a"  "\x29"  "\x29"  "\x20"  "\x2f"  "\x20"  "\x28"  "\x72"  "\x5f"  "\x69"  "\x6a"  "\x5f"  "\x20"  "\x2a"  "\x20"  "\x72"  "\x5f"  "\x69"  "\x6a"  "\x5f"  "\x20"  "\x2a"  "\x20"  "\x72"  "\x5f"  "\x69"  "\x6a"  "\x5f"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x20"  "\x2b"  "\x3d"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x65"  "\x72"  "\x61"  "\x63"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7d"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7d"  "\x0a"  "\x23"  "\x65"  "\x6e"  "\x64"  "\x69"  "\x66"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6f"  "\x75"  "\x74"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x20"  "\x3d"  "\x20"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x29"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x6b"  "\x65"  "\x72"  "\x6e"  "\x65"  "\x6c"  "\x20"  "\x76"  "\x6f"  "\x69"  "\x64"  "\x20"  "\x72"  "\x65"  "\x6e"  "\x64"  "\x65"  "\x72"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x28"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x2a"  "\x65"  "\x6e"  "\x65"  "\x2c"  "\x20"  "\x75"  "\x6e"  "\x73"  "\x69"  "\x67"  "\x6e"  "\x65"  "\x64"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x75"  "\x6e"  "\x73"  "\x69"  "\x67"  "\x6e"  "\x65"  "\x64"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x5f"  "\x6d"  "\x69"  "\x6e"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x5f"  "\x6d"  "\x61"  "\x78"  "\x2c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x52"  "\x47"  "\x42"  "\x41"  "\x33"  "\x32"  "\x20"  "\x2a"  "\x72"  "\x67"  "\x62"  "\x61"  "\x2c"  "\x20"  "\x75"  "\x6e"  "\x73"  "\x69"  "\x67"  "\x6e"  "\x65"  "\x64"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x77"  "\x69"  "\x64"  "\x74"  "\x68"  "\x2c"  "\x20"  "\x75"  "\x6e"  "\x73"  "\x69"  "\x67"  "\x6e"  "\x65"  "\x64"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x68"  "\x65"  "\x69"  "\x67"  "\x68"  "\x74"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x20"  "\x69"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x67"  "\x6c"  "\x6f"  "\x62"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x64"  "\x28"  "\x30"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x69"  "\x64"  "\x20"  "\x3e"  "\x3d"  "\x20"  "\x28"  "\x77"  "\x69"  "\x64"  "\x74"  "\x68"  "\x20"  "\x2a"  "\x20"  "\x68"  "\x65"  "\x69"  "\x67"  "\x68"  "\x74"  "\x29"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x69"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3d"  "\x20"  "\x69"  "\x64"  "\x20"  "\x25"  "\x20"  "\x77"  "\x69"  "\x64"  "\x74"  "\x68"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x69"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3d"  "\x20"  "\x69"  "\x64"  "\x20"  "\x2f"  "\x20"  "\x77"  "\x69"  "\x64"  "\x74"  "\x68"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x76"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x66"  "\x6c"  "\x6f"  "\x61"  "\x74"  "\x29"  "\x69"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x2f"  "\x20"  "\x77"  "\x69"  "\x64"  "\x74"  "\x68"  "\x20"  "\x2a"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x76"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x66"  "\x6c"  "\x6f"  "\x61"  "\x74"  "\x29"  "\x69"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2f"  "\x20"  "\x68"  "\x65"  "\x69"  "\x67"  "\x68"  "\x74"  "\x20"  "\x2a"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x2f"  "\x2f"  "\x72"  "\x65"  "\x6e"  "\x64"  "\x65"  "\x72"  "\x69"  "\x6e"  "\x67"  "\x20"  "\x69"  "\x6e"  "\x76"  "\x65"  "\x72"  "\x74"  "\x73"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x2c"  "\x20"  "\x6e"  "\x65"  "\x65"  "\x64"  "\x20"  "\x74"  "\x6f"  "\x20"  "\x69"  "\x6e"  "\x76"  "\x65"  "\x72"  "\x74"  "\x20"  "\x62"  "\x61"  "\x63"  "\x6b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3d"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x2d"  "\x20"  "\x31"  "\x20"  "\x2d"  "\x20"  "\x76"  "\x72"  "\x6f"  "\x77"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x76"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3e"  "\x3d"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x7c"  "\x7c"  "\x20"  "\x76"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3e"  "\x3d"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x73"  "\x74"  "\x61"  "\x72"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x28"  "\x30"  "\x2c"  "\x20"  "\x30"  "\x2c"  "\x20"  "\x30"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6d"  "\x69"  "\x64"  "\x64"  "\x6c"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x28"  "\x30"  "\x2e"  "\x35"  "\x2c"  "\x20"  "\x30"  "\x2e"  "\x35"  "\x2c"  "\x20"  "\x30"  "\x2e"  "\x35"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x65"  "\x6e"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x28"  "\x31"  "\x2c"  "\x20"  "\x31"  "\x2c"  "\x20"  "\x31"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x20"  "\x3d"  "\x20"  "\x65"  "\x6e"  "\x65"  "\x5b"  "\x76"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2a"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x20"  "\x2b"  "\x20"  "\x76"  "\x63"  "\x6f"  "\x6c"  "\x5d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x20"  "\x2d"  "\x20"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x5f"  "\x6d"  "\x69"  "\x6e"  "\x29"  "\x20"  "\x2f"  "\x20"  "\x28"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x5f"  "\x6d"  "\x61"  "\x78"  "\x20"  "\x2d"  "\x20"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x5f"  "\x6d"  "\x69"  "\x6e"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x67"  "\x62"  "\x61"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x20"  "\x3d"  "\x20"  "\x6c"  "\x69"  "\x6e"  "\x65"  "\x61"  "\x72"  "\x5f"  "\x6d"  "\x61"  "\x70"  "\x70"  "\x69"  "\x6e"  "\x67"  "\x28"  "\x63"  "\x6c"  "\x61"  "\x6d"  "\x70"  "\x28"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x2c"  "\x20"  "\x30"  "\x2e"  "\x30"  "\x2c"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x29"  "\x2c"  "\x20"  "\x73"  "\x74"  "\x61"  "\x72"  "\x74"  "\x2c"  "\x20"  "\x6d"  "\x69"  "\x64"  "\x64"  "\x6c"  "\x65"  "\x2c"  "\x20"  "\x65"  "\x6e"  "\x64"  "\x29"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x6b"  "\x65"  "\x72"  "\x6e"  "\x65"  "\x6c"  "\x20"  "\x76"  "\x6f"  "\x69"  "\x64"  "\x20"  "\x74"  "\x68"  "\x65"  "\x72"  "\x6d"  "\x61"  "\x6c"  "\x5f"  "\x73"  "\x74"  "\x65"  "\x70"  "\x5f"  "\x67"  "\x73"  "\x61"  "\x28"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x73"  "\x69"  "\x74"  "\x65"  "\x5f"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x73"  "\x20"  "\x2a"  "\x67"  "\x73"  "\x2c"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x2a"  "\x76"  "\x30"  "\x2c"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x2a"  "\x76"  "\x31"  "\x2c"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x20"  "\x67"  "\x69"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x71"  "\x56"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x67"  "\x61"  "\x6d"  "\x6d"  "\x61"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x54"  "\x2c"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x73"  "\x65"  "\x65"  "\x64"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x20"  "\x69"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x67"  "\x6c"  "\x6f"  "\x62"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x64"  "\x28"  "\x30"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x69"  "\x64"  "\x20"  "\x3e"  "\x3d"  "\x20"  "\x28"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x2a"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x30"  "\x6c"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x30"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x31"  "\x6c"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x31"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x69"  "\x6e"  "\x6e"  "\x69"  "\x6e"  "\x67"  "\x20"  "\x70"  "\x69"  "\x6e"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x73"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x2e"  "\x70"  "\x69"  "\x6e"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x20"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x73"  "\x65"  "\x65"  "\x64"  "\x28"  "\x26"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2c"  "\x20"  "\x73"  "\x65"  "\x65"  "\x64"  "\x20"  "\x2b"  "\x20"  "\x69"  "\x64"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x64"  "\x65"  "\x6c"  "\x74"  "\x61"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x28"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x72"  "\x61"  "\x6e"  "\x64"  "\x6f"  "\x6d"  "\x5f"  "\x67"  "\x73"  "\x61"  "\x28"  "\x26"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2c"  "\x20"  "\x71"  "\x56"  "\x2c"  "\x20"  "\x54"  "\x2c"  "\x20"  "\x67"  "\x61"  "\x6d"  "\x6d"  "\x61"  "\x29"  "\x2c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x72"  "\x61"  "\x6e"  "\x64"  "\x6f"  "\x6d"  "\x5f"  "\x67"  "\x73"  "\x61"  "\x28"  "\x26"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2c"  "\x20"  "\x71"  "\x56"  "\x2c"  "\x20"  "\x54"  "\x2c"  "\x20"  "\x67"  "\x61"  "\x6d"  "\x6d"  "\x61"  "\x29"  "\x2c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x72"  "\x61"  "\x6e"  "\x64"  "\x6f"  "\x6d"  "\x5f"  "\x67"  "\x73"  "\x61"  "\x28"  "\x26"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2c"  "\x20"  "\x71"  "\x56"  "\x2c"  "\x20"  "\x54"  "\x2c"  "\x20"  "\x67"  "\x61"  "\x6d"  "\x6d"  "\x61"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x31"  "\x6c"  "\x20"  "\x3d"  "\x20"  "\x70"  "\x69"  "\x6e"  "\x2e"  "\x70"  "\x69"  "\x6e"  "\x6e"  "\x65"  "\x64"  "\x3f"  "\x20"  "\x70"  "\x69"  "\x6e"  "\x2e"  "\x64"  "\x69"  "\x72"  "\x3a"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x6e"  "\x6f"  "\x72"  "\x6d"  "\x61"  "\x6c"  "\x69"  "\x7a"  "\x65"  "\x28"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x76"  "\x30"  "\x6c"  "\x2c"  "\x20"  "\x64"  "\x65"  "\x6c"  "\x74"  "\x61"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x31"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x31"  "\x6c"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x2f"  "\x2f"  "\x30"  "\x20"  "\x2d"  "\x3e"  "\x20"  "\x62"  "\x65"  "\x66"  "\x6f"  "\x72"  "\x65"  "\x0a"  "\x2f"  "\x2f"  "\x31"  "\x20"  "\x2d"  "\x3e"  "\x20"  "\x63"  "\x75"  "\x72"  "\x72"  "\x65"  "\x6e"  "\x74"  "\x0a"  "\x2f"  "\x2f"  "\x32"  "\x20"  "\x2d"  "\x3e"  "\x20"  "\x6e"  "\x65"  "\x77"  "\x0a"  "\x6b"  "\x65"  "\x72"  "\x6e"  "\x65"  "\x6c"  "\x20"  "\x76"  "\x6f"  "\x69"  "\x64"  "\x20"  "\x67"  "\x72"  "\x61"  "\x64"  "\x69"  "\x65"  "\x6e"  "\x74"  "\x5f"  "\x64"  "\x65"  "\x73"  "\x63"  "\x65"  "\x6e"  "\x74"  "\x5f"  "\x73"  "\x74"  "\x65"  "\x70"  "\x28"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x73"  "\x69"  "\x74"  "\x65"  "\x5f"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x73"  "\x20"  "\x2a"  "\x67"  "\x73"  "\x2c"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x2a"  "\x76"  "\x30"  "\x2c"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x2a"  "\x76"  "\x31"  "\x2c"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x2a"  "\x76"  "\x32"  "\x2c"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x20"  "\x67"  "\x69"  "\x2c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x6d"  "\x61"  "\x73"  "\x73"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x54"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x64"  "\x61"  "\x6d"  "\x70"  "\x69"  "\x6e"  "\x67"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x72"  "\x65"  "\x73"  "\x74"  "\x6f"  "\x72"  "\x69"  "\x6e"  "\x67"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x64"  "\x74"  "\x2c"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x73"  "\x65"  "\x65"  "\x64"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x20"  "\x69"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x67"  "\x6c"  "\x6f"  "\x62"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x64"  "\x28"  "\x30"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x69"  "\x64"  "\x20"  "\x3e"  "\x3d"  "\x20"  "\x28"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x2a"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3d"  "\x20"  "\x69"  "\x64"  "\x20"  "\x25"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3d"  "\x20"  "\x69"  "\x64"  "\x20"  "\x2f"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x65"  "\x74"  "\x65"  "\x72"  "\x73"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x31"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x65"  "\x74"  "\x65"  "\x72"  "\x73"  "\x29"  "\x7b"  "\x7d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x31"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x31"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x31"  "\x2e"  "\x74"  "\x69"  "\x6d"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x30"  "\x2e"  "\x30"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x31"  "\x2e"  "\x6d"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x31"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x31"  "\x2e"  "\x67"  "\x73"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x73"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x31"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x75"  "\x70"  "\x20"  "\x3d"  "\x20"  "\x61"  "\x70"  "\x70"  "\x6c"  "\x79"  "\x5f"  "\x70"  "\x62"  "\x63"  "\x28"  "\x76"  "\x31"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x70"  "\x62"  "\x63"  "\x2c"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2b"  "\x20"  "\x31"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x31"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x20"  "\x3d"  "\x20"  "\x61"  "\x70"  "\x70"  "\x6c"  "\x79"  "\x5f"  "\x70"  "\x62"  "\x63"  "\x28"  "\x76"  "\x31"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x70"  "\x62"  "\x63"  "\x2c"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2d"  "\x20"  "\x31"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x31"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x61"  "\x70"  "\x70"  "\x6c"  "\x79"  "\x5f"  "\x70"  "\x62"  "\x63"  "\x28"  "\x76"  "\x31"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x70"  "\x62"  "\x63"  "\x2c"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x2b"  "\x20"  "\x31"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x31"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x61"  "\x70"  "\x70"  "\x6c"  "\x79"  "\x5f"  "\x70"  "\x62"  "\x63"  "\x28"  "\x76"  "\x31"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x70"  "\x62"  "\x63"  "\x2c"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x2d"  "\x20"  "\x31"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x23"  "\x69"  "\x66"  "\x64"  "\x65"  "\x66"  "\x20"  "\x49"  "\x4e"  "\x43"  "\x4c"  "\x55"  "\x44"  "\x45"  "\x5f"  "\x44"  "\x49"  "\x50"  "\x4f"  "\x4c"  "\x41"  "\x52"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x31"  "\x2e"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x28"  "\x30"  "\x2e"  "\x30"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x66"  "\x6f"  "\x72"  "\x20"  "\x28"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x64"  "\x72"  "\x20"  "\x3d"  "\x20"  "\x2d"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x31"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x2f"  "\x20"  "\x32"  "\x3b"  "\x20"  "\x64"  "\x72"  "\x20"  "\x3c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x31"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x2f"  "\x20"  "\x32"  "\x3b"  "\x20"  "\x2b"  "\x2b"  "\x64"  "\x72"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x64"  "\x79"  "\x20"  "\x3d"  "\x20"  "\x64"  "\x72"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x31"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x66"  "\x6f"  "\x72"  "\x20"  "\x28"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x64"  "\x63"  "\x20"  "\x3d"  "\x20"  "\x2d"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x31"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x20"  "\x2f"  "\x20"  "\x32"  "\x3b"  "\x20"  "\x64"  "\x63"  "\x20"  "\x3c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x31"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x20"  "\x2f"  "\x20"  "\x32"  "\x3b"  "\x20"  "\x2b"  "\x2b"  "\x64"  "\x63"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x64"  "\x72"  "\x20"  "\x3d"  "\x3d"  "\x20"  "\x30"  "\x20"  "\x26"  "\x26"  "\x20"  "\x64"  "\x63"  "\x20"  "\x3d"  "\x3d"  "\x20"  "\x30"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x74"  "\x69"  "\x6e"  "\x75"  "\x65"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x64"  "\x78"  "\x20"  "\x3d"  "\x20"  "\x64"  "\x63"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x31"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x72"  "\x5f"  "\x69"  "\x6a"  "\x5f"  "\x20"  "\x3d"  "\x20"  "\x73"  "\x71"  "\x72"  "\x74"  "\x28"  "\x64"  "\x78"  "\x20"  "\x2a"  "\x20"  "\x64"  "\x78"  "\x20"  "\x2b"  "\x20"  "\x64"  "\x79"  "\x20"  "\x2a"  "\x20"  "\x64"  "\x79"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x72"  "\x5f"  "\x69"  "\x6a"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x6e"  "\x6f"  "\x72"  "\x6d"  "\x61"  "\x6c"  "\x69"  "\x7a"  "\x65"  "\x28"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x28"  "\x64"  "\x78"  "\x2c"  "\x20"  "\x64"  "\x79"  "\x2c"  "\x20"  "\x30"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6d"  "\x6a"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x73"  "\x69"  "\x74"  "\x65"  "\x5f"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x73"  "\x20"  "\x67"  "\x6a"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x61"  "\x70"  "\x70"  "\x6c"  "\x79"  "\x5f"  "\x70"  "\x62"  "\x63"  "\x5f"  "\x63"  "\x6f"  "\x6d"  "\x70"  "\x6c"  "\x65"  "\x74"  "\x65"  "\x28"  "\x67"  "\x73"  "\x2c"  "\x20"  "\x76"  "\x31"  "\x2c"  "\x20"  "\x26"  "\x6d"  "\x6a"  "\x2c"  "\x20"  "\x26"  "\x67"  "\x6a"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x70"  "\x62"  "\x63"  "\x2c"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2b"  "\x20"  "\x64"  "\x72"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x2b"  "\x20"  "\x64"  "\x63"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x31"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x31"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x66"  "\x61"  "\x63"  "\x74"  "\x6f"  "\x72"  "\x20"  "\x3d"  "\x20"  "\x2d"  "\x4d"  "\x55"  "\x5f"  "\x30"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x31"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x6d"  "\x75"  "\x20"  "\x2a"  "\x20"  "\x67"  "\x6a"  "\x2e"  "\x6d"  "\x75"  "\x20"  "\x2f"  "\x20"  "\x28"  "\x34"  "\x2e"  "\x30"  "\x20"  "\x2a"  "\x20"  "\x4d"  "\x5f"  "\x50"  "\x49"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x65"  "\x72"  "\x61"  "\x63"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x72"  "\x5f"  "\x69"  "\x6a"  "\x2c"  "\x20"  "\x33"  "\x2e"  "\x30"  "\x20"  "\x2a"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x64"  "\x6f"  "\x74"  "\x28"  "\x6d"  "\x6a"  "\x2c"  "\x20"  "\x72"  "\x5f"  "\x69"  "\x6a"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x65"  "\x72"  "\x61"  "\x63"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x62"  "\x28"  "\x69"  "\x6e"  "\x74"  "\x65"  "\x72"  "\x61"  "\x63"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x2c"  "\x20"  "\x6d"  "\x6a"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x65"  "\x72"  "\x61"  "\x63"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x69"  "\x6e"  "\x74"  "\x65"  "\x72"  "\x61"  "\x63"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x2c"  "\x20"  "\x66"  "\x61"  "\x63"  "\x74"  "\x6f"  "\x72"  "\x20"  "\x2f"  "\x20"  "\x28"  "\x72"  "\x5f"  "\x69"  "\x6a"  "\x5f"  "\x20"  "\x2a"  "\x20"  "\x72"  "\x5f"  "\x69"  "\x6a"  "\x5f"  "\x20"  "\x2a"  "\x20"  "\x72"  "\x5f"  "\x69"  "\x6a"  "\x5f"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x31"  "\x2e"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x31"  "\x2e"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x2c"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x65"  "\x72"  "\x61"  "\x63"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7d"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7d"  "\x0a"  "\x23"  "\x65"  "\x6e"  "\x64"  "\x69"  "\x66"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x30"  "\x6c"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x30"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x64"  "\x68"  "\x5f"  "\x64"  "\x6d"  "\x20"  "\x3d"  "\x20"  "\x65"  "\x66"  "\x66"  "\x65"  "\x63"  "\x74"  "\x69"  "\x76"  "\x65"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x31"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x65"  "\x6c"  "\x6f"  "\x63"  "\x69"  "\x74"  "\x79"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x62"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x31"  "\x2e"  "\x6d"  "\x2c"  "\x20"  "\x76"  "\x30"  "\x6c"  "\x29"  "\x2c"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x20"  "\x2f"  "\x20"  "\x64"  "\x74"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x61"  "\x63"  "\x63"  "\x65"  "\x6c"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x31"  "\x2e"  "\x6d"  "\x2c"  "\x20"  "\x2d"  "\x72"  "\x65"  "\x73"  "\x74"  "\x6f"  "\x72"  "\x69"  "\x6e"  "\x67"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x61"  "\x63"  "\x63"  "\x65"  "\x6c"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x61"  "\x63"  "\x63"  "\x65"  "\x6c"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x76"  "\x65"  "\x6c"  "\x6f"  "\x63"  "\x69"  "\x74"  "\x79"  "\x2c"  "\x20"  "\x2d"  "\x64"  "\x61"  "\x6d"  "\x70"  "\x69"  "\x6e"  "\x67"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x61"  "\x63"  "\x63"  "\x65"  "\x6c"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x61"  "\x63"  "\x63"  "\x65"  "\x6c"  "\x2c"  "\x20"  "\x64"  "\x68"  "\x5f"  "\x64"  "\x6d"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x21"  "\x43"  "\x4c"  "\x4f"  "\x53"  "\x45"  "\x5f"  "\x45"  "\x4e"  "\x4f"  "\x55"  "\x47"  "\x48"  "\x28"  "\x54"  "\x2c"  "\x20"  "\x30"  "\x2e"  "\x30"  "\x2c"  "\x20"  "\x45"  "\x50"  "\x53"  "\x29"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x20"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x73"  "\x65"  "\x65"  "\x64"  "\x28"  "\x26"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2c"  "\x20"  "\x73"  "\x65"  "\x65"  "\x64"  "\x20"  "\x2b"  "\x20"  "\x69"  "\x64"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x74"  "\x65"  "\x6d"  "\x70"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x28"  "\x73"  "\x71"  "\x72"  "\x74"  "\x28"  "\x54"  "\x29"  "\x20"  "\x2a"  "\x20"  "\x6e"  "\x6f"  "\x72"  "\x6d"  "\x61"  "\x6c"  "\x5f"  "\x64"  "\x69"  "\x73"  "\x74"  "\x72"  "\x69"  "\x62"  "\x75"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x28"  "\x26"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x29"  "\x2c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x73"  "\x71"  "\x72"  "\x74"  "\x28"  "\x54"  "\x29"  "\x20"  "\x2a"  "\x20"  "\x6e"  "\x6f"  "\x72"  "\x6d"  "\x61"  "\x6c"  "\x5f"  "\x64"  "\x69"  "\x73"  "\x74"  "\x72"  "\x69"  "\x62"  "\x75"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x28"  "\x26"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x29"  "\x2c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x73"  "\x71"  "\x72"  "\x74"  "\x28"  "\x54"  "\x29"  "\x20"  "\x2a"  "\x20"  "\x6e"  "\x6f"  "\x72"  "\x6d"  "\x61"  "\x6c"  "\x5f"  "\x64"  "\x69"  "\x73"  "\x74"  "\x72"  "\x69"  "\x62"  "\x75"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x28"  "\x26"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x61"  "\x63"  "\x63"  "\x65"  "\x6c"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x61"  "\x63"  "\x63"  "\x65"  "\x6c"  "\x2c"  "\x20"  "\x74"  "\x65"  "\x6d"  "\x70"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7d"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x61"  "\x63"  "\x63"  "\x65"  "\x6c"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x61"  "\x63"  "\x63"  "\x65"  "\x6c"  "\x2c"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x20"  "\x2f"  "\x20"  "\x6d"  "\x61"  "\x73"  "\x73"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x32"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x20"  "\x3d"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x31"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x70"  "\x69"  "\x6e"  "\x2e"  "\x70"  "\x69"  "\x6e"  "\x6e"  "\x65"  "\x64"  "\x3f"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x31"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x70"  "\x69"  "\x6e"  "\x2e"  "\x64"  "\x69"  "\x72"  "\x3a"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x6e"  "\x6f"  "\x72"  "\x6d"  "\x61"  "\x6c"  "\x69"  "\x7a"  "\x65"  "\x28"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x31"  "\x2e"  "\x6d"  "\x2c"  "\x20"  "\x32"  "\x2e"  "\x30"  "\x29"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x62"  "\x28"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x61"  "\x63"  "\x63"  "\x65"  "\x6c"  "\x2c"  "\x20"  "\x64"  "\x74"  "\x20"  "\x2a"  "\x20"  "\x64"  "\x74"  "\x29"  "\x2c"  "\x20"  "\x76"  "\x30"  "\x6c"  "\x29"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x6b"  "\x65"  "\x72"  "\x6e"  "\x65"  "\x6c"  "\x20"  "\x76"  "\x6f"  "\x69"  "\x64"  "\x20"  "\x63"  "\x61"  "\x6c"  "\x63"  "\x75"  "\x6c"  "\x61"  "\x74"  "\x65"  "\x5f"  "\x65"  "\x6c"  "\x65"  "\x63"  "\x74"  "\x72"  "\x69"  "\x63"  "\x28"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x73"  "\x69"  "\x74"  "\x65"  "\x5f"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x73"  "\x20"  "\x2a"  "\x67"  "\x73"  "\x2c"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x2a"  "\x6d"  "\x30"  "\x2c"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x2a"  "\x6d"  "\x31"  "\x2c"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x2a"  "\x6f"  "\x75"  "\x74"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x64"  "\x74"  "\x2c"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x20"  "\x67"  "\x69"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x20"  "\x69"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x67"  "\x6c"  "\x6f"  "\x62"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x64"  "\x28"  "\x30"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x69"  "\x64"  "\x20"  "\x3e"  "\x3d"  "\x20"  "\x28"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x2a"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3d"  "\x20"  "\x69"  "\x64"  "\x20"  "\x25"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3d"  "\x20"  "\x69"  "\x64"  "\x20"  "\x2f"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x65"  "\x74"  "\x65"  "\x72"  "\x73"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x73"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x20"  "\x3d"  "\x20"  "\x6d"  "\x30"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x64"  "\x6d"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x62"  "\x28"  "\x6d"  "\x31"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x61"  "\x70"  "\x70"  "\x6c"  "\x79"  "\x5f"  "\x70"  "\x62"  "\x63"  "\x28"  "\x6d"  "\x30"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x70"  "\x62"  "\x63"  "\x2c"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x2d"  "\x20"  "\x31"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x61"  "\x70"  "\x70"  "\x6c"  "\x79"  "\x5f"  "\x70"  "\x62"  "\x63"  "\x28"  "\x6d"  "\x30"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x70"  "\x62"  "\x63"  "\x2c"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x2b"  "\x20"  "\x31"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x75"  "\x70"  "\x20"  "\x3d"  "\x20"  "\x61"  "\x70"  "\x70"  "\x6c"  "\x79"  "\x5f"  "\x70"  "\x62"  "\x63"  "\x28"  "\x6d"  "\x30"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x70"  "\x62"  "\x63"  "\x2c"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2b"  "\x20"  "\x31"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x20"  "\x3d"  "\x20"  "\x61"  "\x70"  "\x70"  "\x6c"  "\x79"  "\x5f"  "\x70"  "\x62"  "\x63"  "\x28"  "\x6d"  "\x30"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x70"  "\x62"  "\x63"  "\x2c"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2d"  "\x20"  "\x31"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6f"  "\x75"  "\x74"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x65"  "\x6d"  "\x65"  "\x72"  "\x67"  "\x65"  "\x6e"  "\x74"  "\x5f"  "\x65"  "\x6c"  "\x65"  "\x63"  "\x74"  "\x72"  "\x69"  "\x63"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x75"  "\x70"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x64"  "\x6d"  "\x2c"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x20"  "\x2f"  "\x20"  "\x64"  "\x74"  "\x29"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x29"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x29"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x6b"  "\x65"  "\x72"  "\x6e"  "\x65"  "\x6c"  "\x20"  "\x76"  "\x6f"  "\x69"  "\x64"  "\x20"  "\x72"  "\x65"  "\x6e"  "\x64"  "\x65"  "\x72"  "\x5f"  "\x65"  "\x6c"  "\x65"  "\x63"  "\x74"  "\x72"  "\x69"  "\x63"  "\x28"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x2a"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x2c"  "\x20"  "\x75"  "\x6e"  "\x73"  "\x69"  "\x67"  "\x6e"  "\x65"  "\x64"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x75"  "\x6e"  "\x73"  "\x69"  "\x67"  "\x6e"  "\x65"  "\x64"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x6d"  "\x61"  "\x78"  "\x5f"  "\x6d"  "\x6f"  "\x64"  "\x2c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x52"  "\x47"  "\x42"  "\x41"  "\x33"  "\x32"  "\x20"  "\x2a"  "\x72"  "\x67"  "\x62"  "\x61"  "\x2c"  "\x20"  "\x75"  "\x6e"  "\x73"  "\x69"  "\x67"  "\x6e"  "\x65"  "\x64"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x77"  "\x69"  "\x64"  "\x74"  "\x68"  "\x2c"  "\x20"  "\x75"  "\x6e"  "\x73"  "\x69"  "\x67"  "\x6e"  "\x65"  "\x64"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x68"  "\x65"  "\x69"  "\x67"  "\x68"  "\x74"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x20"  "\x69"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x67"  "\x6c"  "\x6f"  "\x62"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x64"  "\x28"  "\x30"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x69"  "\x64"  "\x20"  "\x3e"  "\x3d"  "\x20"  "\x28"  "\x77"  "\x69"  "\x64"  "\x74"  "\x68"  "\x20"  "\x2a"  "\x20"  "\x68"  "\x65"  "\x69"  "\x67"  "\x68"  "\x74"  "\x29"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x69"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3d"  "\x20"  "\x69"  "\x64"  "\x20"  "\x25"  "\x20"  "\x77"  "\x69"  "\x64"  "\x74"  "\x68"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x69"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3d"  "\x20"  "\x69"  "\x64"  "\x20"  "\x2f"  "\x20"  "\x77"  "\x69"  "\x64"  "\x74"  "\x68"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x76"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x66"  "\x6c"  "\x6f"  "\x61"  "\x74"  "\x29"  "\x69"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x2f"  "\x20"  "\x77"  "\x69"  "\x64"  "\x74"  "\x68"  "\x20"  "\x2a"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x76"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x66"  "\x6c"  "\x6f"  "\x61"  "\x74"  "\x29"  "\x69"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2f"  "\x20"  "\x68"  "\x65"  "\x69"  "\x67"  "\x68"  "\x74"  "\x20"  "\x2a"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x2f"  "\x2f"  "\x72"  "\x65"  "\x6e"  "\x64"  "\x65"  "\x72"  "\x69"  "\x6e"  "\x67"  "\x20"  "\x69"  "\x6e"  "\x76"  "\x65"  "\x72"  "\x74"  "\x73"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x2c"  "\x20"  "\x6e"  "\x65"  "\x65"  "\x64"  "\x20"  "\x74"  "\x6f"  "\x20"  "\x69"  "\x6e"  "\x76"  "\x65"  "\x72"  "\x74"  "\x20"  "\x62"  "\x61"  "\x63"  "\x6b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3d"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x2d"  "\x20"  "\x31"  "\x20"  "\x2d"  "\x20"  "\x76"  "\x72"  "\x6f"  "\x77"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x76"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3e"  "\x3d"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x7c"  "\x7c"  "\x20"  "\x76"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3e"  "\x3d"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x66"  "\x20"  "\x3d"  "\x20"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x5b"  "\x76"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2a"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x20"  "\x2b"  "\x20"  "\x76"  "\x63"  "\x6f"  "\x6c"  "\x5d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x61"  "\x6e"  "\x67"  "\x6c"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x61"  "\x74"  "\x61"  "\x6e"  "\x32"  "\x28"  "\x66"  "\x2e"  "\x79"  "\x2c"  "\x20"  "\x66"  "\x2e"  "\x78"  "\x29"  "\x20"  "\x2f"  "\x20"  "\x4d"  "\x5f"  "\x50"  "\x49"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x61"  "\x6e"  "\x67"  "\x6c"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x61"  "\x6e"  "\x67"  "\x6c"  "\x65"  "\x20"  "\x2b"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x29"  "\x20"  "\x2f"  "\x20"  "\x32"  "\x2e"  "\x30"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x52"  "\x47"  "\x42"  "\x41"  "\x33"  "\x32"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x6f"  "\x72"  "\x20"  "\x3d"  "\x20"  "\x68"  "\x73"  "\x6c"  "\x5f"  "\x74"  "\x6f"  "\x5f"  "\x72"  "\x67"  "\x62"  "\x28"  "\x61"  "\x6e"  "\x67"  "\x6c"  "\x65"  "\x2c"  "\x20"  "\x73"  "\x71"  "\x72"  "\x74"  "\x28"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x64"  "\x6f"  "\x74"  "\x28"  "\x66"  "\x2c"  "\x20"  "\x66"  "\x29"  "\x29"  "\x20"  "\x2f"  "\x20"  "\x6d"  "\x61"  "\x78"  "\x5f"  "\x6d"  "\x6f"  "\x64"  "\x2c"  "\x20"  "\x30"  "\x2e"  "\x35"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x67"  "\x62"  "\x61"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x20"  "\x3d"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x6f"  "\x72"  "\x3b"  "\x0a"  "\x7d"  "\x0a" ;
\ No newline at end of file
+const char *complete_kernel = "//I hate clover\n#pragma OPENCL EXTENSION cl_khr_fp64 : enable"  "\x2f"  "\x2a"  "\x0a"  "\x42"  "\x53"  "\x44"  "\x20"  "\x33"  "\x2d"  "\x43"  "\x6c"  "\x61"  "\x75"  "\x73"  "\x65"  "\x20"  "\x4c"  "\x69"  "\x63"  "\x65"  "\x6e"  "\x73"  "\x65"  "\x0a"  "\x0a"  "\x43"  "\x6f"  "\x70"  "\x79"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x20"  "\x28"  "\x63"  "\x29"  "\x20"  "\x32"  "\x30"  "\x31"  "\x38"  "\x2c"  "\x20"  "\x54"  "\x61"  "\x64"  "\x65"  "\x6a"  "\x20"  "\x43"  "\x69"  "\x67"  "\x6c"  "\x61"  "\x72"  "\x69"  "\x63"  "\x2c"  "\x20"  "\x45"  "\x72"  "\x69"  "\x6b"  "\x20"  "\x53"  "\x74"  "\x72"  "\x75"  "\x6d"  "\x62"  "\x65"  "\x6c"  "\x6a"  "\x2c"  "\x20"  "\x52"  "\x6f"  "\x6b"  "\x20"  "\x43"  "\x65"  "\x73"  "\x6e"  "\x6f"  "\x76"  "\x61"  "\x72"  "\x2e"  "\x20"  "\x41"  "\x6c"  "\x6c"  "\x20"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x73"  "\x20"  "\x72"  "\x65"  "\x73"  "\x65"  "\x72"  "\x76"  "\x65"  "\x64"  "\x2e"  "\x0a"  "\x0a"  "\x52"  "\x65"  "\x64"  "\x69"  "\x73"  "\x74"  "\x72"  "\x69"  "\x62"  "\x75"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x20"  "\x61"  "\x6e"  "\x64"  "\x20"  "\x75"  "\x73"  "\x65"  "\x20"  "\x69"  "\x6e"  "\x20"  "\x73"  "\x6f"  "\x75"  "\x72"  "\x63"  "\x65"  "\x20"  "\x61"  "\x6e"  "\x64"  "\x20"  "\x62"  "\x69"  "\x6e"  "\x61"  "\x72"  "\x79"  "\x20"  "\x66"  "\x6f"  "\x72"  "\x6d"  "\x73"  "\x2c"  "\x20"  "\x77"  "\x69"  "\x74"  "\x68"  "\x20"  "\x6f"  "\x72"  "\x20"  "\x77"  "\x69"  "\x74"  "\x68"  "\x6f"  "\x75"  "\x74"  "\x20"  "\x6d"  "\x6f"  "\x64"  "\x69"  "\x66"  "\x69"  "\x63"  "\x61"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x2c"  "\x20"  "\x61"  "\x72"  "\x65"  "\x20"  "\x70"  "\x65"  "\x72"  "\x6d"  "\x69"  "\x74"  "\x74"  "\x65"  "\x64"  "\x20"  "\x70"  "\x72"  "\x6f"  "\x76"  "\x69"  "\x64"  "\x65"  "\x64"  "\x20"  "\x74"  "\x68"  "\x61"  "\x74"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x66"  "\x6f"  "\x6c"  "\x6c"  "\x6f"  "\x77"  "\x69"  "\x6e"  "\x67"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x64"  "\x69"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x73"  "\x20"  "\x61"  "\x72"  "\x65"  "\x20"  "\x6d"  "\x65"  "\x74"  "\x3a"  "\x0a"  "\x0a"  "\x52"  "\x65"  "\x64"  "\x69"  "\x73"  "\x74"  "\x72"  "\x69"  "\x62"  "\x75"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x73"  "\x20"  "\x6f"  "\x66"  "\x20"  "\x73"  "\x6f"  "\x75"  "\x72"  "\x63"  "\x65"  "\x20"  "\x63"  "\x6f"  "\x64"  "\x65"  "\x20"  "\x6d"  "\x75"  "\x73"  "\x74"  "\x20"  "\x72"  "\x65"  "\x74"  "\x61"  "\x69"  "\x6e"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x61"  "\x62"  "\x6f"  "\x76"  "\x65"  "\x20"  "\x63"  "\x6f"  "\x70"  "\x79"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x20"  "\x6e"  "\x6f"  "\x74"  "\x69"  "\x63"  "\x65"  "\x2c"  "\x20"  "\x74"  "\x68"  "\x69"  "\x73"  "\x20"  "\x6c"  "\x69"  "\x73"  "\x74"  "\x20"  "\x6f"  "\x66"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x64"  "\x69"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x73"  "\x20"  "\x61"  "\x6e"  "\x64"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x66"  "\x6f"  "\x6c"  "\x6c"  "\x6f"  "\x77"  "\x69"  "\x6e"  "\x67"  "\x20"  "\x64"  "\x69"  "\x73"  "\x63"  "\x6c"  "\x61"  "\x69"  "\x6d"  "\x65"  "\x72"  "\x2e"  "\x0a"  "\x0a"  "\x52"  "\x65"  "\x64"  "\x69"  "\x73"  "\x74"  "\x72"  "\x69"  "\x62"  "\x75"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x73"  "\x20"  "\x69"  "\x6e"  "\x20"  "\x62"  "\x69"  "\x6e"  "\x61"  "\x72"  "\x79"  "\x20"  "\x66"  "\x6f"  "\x72"  "\x6d"  "\x20"  "\x6d"  "\x75"  "\x73"  "\x74"  "\x20"  "\x72"  "\x65"  "\x70"  "\x72"  "\x6f"  "\x64"  "\x75"  "\x63"  "\x65"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x61"  "\x62"  "\x6f"  "\x76"  "\x65"  "\x20"  "\x63"  "\x6f"  "\x70"  "\x79"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x20"  "\x6e"  "\x6f"  "\x74"  "\x69"  "\x63"  "\x65"  "\x2c"  "\x20"  "\x74"  "\x68"  "\x69"  "\x73"  "\x20"  "\x6c"  "\x69"  "\x73"  "\x74"  "\x20"  "\x6f"  "\x66"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x64"  "\x69"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x73"  "\x20"  "\x61"  "\x6e"  "\x64"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x66"  "\x6f"  "\x6c"  "\x6c"  "\x6f"  "\x77"  "\x69"  "\x6e"  "\x67"  "\x20"  "\x64"  "\x69"  "\x73"  "\x63"  "\x6c"  "\x61"  "\x69"  "\x6d"  "\x65"  "\x72"  "\x20"  "\x69"  "\x6e"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x64"  "\x6f"  "\x63"  "\x75"  "\x6d"  "\x65"  "\x6e"  "\x74"  "\x61"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x20"  "\x61"  "\x6e"  "\x64"  "\x2f"  "\x6f"  "\x72"  "\x20"  "\x6f"  "\x74"  "\x68"  "\x65"  "\x72"  "\x20"  "\x6d"  "\x61"  "\x74"  "\x65"  "\x72"  "\x69"  "\x61"  "\x6c"  "\x73"  "\x20"  "\x70"  "\x72"  "\x6f"  "\x76"  "\x69"  "\x64"  "\x65"  "\x64"  "\x20"  "\x77"  "\x69"  "\x74"  "\x68"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x64"  "\x69"  "\x73"  "\x74"  "\x72"  "\x69"  "\x62"  "\x75"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x2e"  "\x0a"  "\x0a"  "\x4e"  "\x65"  "\x69"  "\x74"  "\x68"  "\x65"  "\x72"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x6e"  "\x61"  "\x6d"  "\x65"  "\x20"  "\x6f"  "\x66"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x63"  "\x6f"  "\x70"  "\x79"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x20"  "\x68"  "\x6f"  "\x6c"  "\x64"  "\x65"  "\x72"  "\x20"  "\x6e"  "\x6f"  "\x72"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x6e"  "\x61"  "\x6d"  "\x65"  "\x73"  "\x20"  "\x6f"  "\x66"  "\x20"  "\x69"  "\x74"  "\x73"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x74"  "\x72"  "\x69"  "\x62"  "\x75"  "\x74"  "\x6f"  "\x72"  "\x73"  "\x20"  "\x6d"  "\x61"  "\x79"  "\x20"  "\x62"  "\x65"  "\x20"  "\x75"  "\x73"  "\x65"  "\x64"  "\x20"  "\x74"  "\x6f"  "\x20"  "\x65"  "\x6e"  "\x64"  "\x6f"  "\x72"  "\x73"  "\x65"  "\x20"  "\x6f"  "\x72"  "\x20"  "\x70"  "\x72"  "\x6f"  "\x6d"  "\x6f"  "\x74"  "\x65"  "\x20"  "\x70"  "\x72"  "\x6f"  "\x64"  "\x75"  "\x63"  "\x74"  "\x73"  "\x20"  "\x64"  "\x65"  "\x72"  "\x69"  "\x76"  "\x65"  "\x64"  "\x20"  "\x66"  "\x72"  "\x6f"  "\x6d"  "\x20"  "\x74"  "\x68"  "\x69"  "\x73"  "\x20"  "\x73"  "\x6f"  "\x66"  "\x74"  "\x77"  "\x61"  "\x72"  "\x65"  "\x20"  "\x77"  "\x69"  "\x74"  "\x68"  "\x6f"  "\x75"  "\x74"  "\x20"  "\x73"  "\x70"  "\x65"  "\x63"  "\x69"  "\x66"  "\x69"  "\x63"  "\x20"  "\x70"  "\x72"  "\x69"  "\x6f"  "\x72"  "\x20"  "\x77"  "\x72"  "\x69"  "\x74"  "\x74"  "\x65"  "\x6e"  "\x20"  "\x70"  "\x65"  "\x72"  "\x6d"  "\x69"  "\x73"  "\x73"  "\x69"  "\x6f"  "\x6e"  "\x2e"  "\x0a"  "\x0a"  "\x54"  "\x48"  "\x49"  "\x53"  "\x20"  "\x53"  "\x4f"  "\x46"  "\x54"  "\x57"  "\x41"  "\x52"  "\x45"  "\x20"  "\x49"  "\x53"  "\x20"  "\x50"  "\x52"  "\x4f"  "\x56"  "\x49"  "\x44"  "\x45"  "\x44"  "\x20"  "\x42"  "\x59"  "\x20"  "\x54"  "\x48"  "\x45"  "\x20"  "\x43"  "\x4f"  "\x50"  "\x59"  "\x52"  "\x49"  "\x47"  "\x48"  "\x54"  "\x20"  "\x48"  "\x4f"  "\x4c"  "\x44"  "\x45"  "\x52"  "\x53"  "\x20"  "\x41"  "\x4e"  "\x44"  "\x20"  "\x43"  "\x4f"  "\x4e"  "\x54"  "\x52"  "\x49"  "\x42"  "\x55"  "\x54"  "\x4f"  "\x52"  "\x53"  "\x20"  "\x22"  "\x41"  "\x53"  "\x20"  "\x49"  "\x53"  "\x22"  "\x20"  "\x41"  "\x4e"  "\x44"  "\x20"  "\x41"  "\x4e"  "\x59"  "\x20"  "\x45"  "\x58"  "\x50"  "\x52"  "\x45"  "\x53"  "\x53"  "\x20"  "\x4f"  "\x52"  "\x20"  "\x49"  "\x4d"  "\x50"  "\x4c"  "\x49"  "\x45"  "\x44"  "\x20"  "\x57"  "\x41"  "\x52"  "\x52"  "\x41"  "\x4e"  "\x54"  "\x49"  "\x45"  "\x53"  "\x2c"  "\x20"  "\x49"  "\x4e"  "\x43"  "\x4c"  "\x55"  "\x44"  "\x49"  "\x4e"  "\x47"  "\x2c"  "\x20"  "\x42"  "\x55"  "\x54"  "\x20"  "\x4e"  "\x4f"  "\x54"  "\x20"  "\x4c"  "\x49"  "\x4d"  "\x49"  "\x54"  "\x45"  "\x44"  "\x20"  "\x54"  "\x4f"  "\x2c"  "\x20"  "\x54"  "\x48"  "\x45"  "\x20"  "\x49"  "\x4d"  "\x50"  "\x4c"  "\x49"  "\x45"  "\x44"  "\x20"  "\x57"  "\x41"  "\x52"  "\x52"  "\x41"  "\x4e"  "\x54"  "\x49"  "\x45"  "\x53"  "\x20"  "\x4f"  "\x46"  "\x20"  "\x4d"  "\x45"  "\x52"  "\x43"  "\x48"  "\x41"  "\x4e"  "\x54"  "\x41"  "\x42"  "\x49"  "\x4c"  "\x49"  "\x54"  "\x59"  "\x20"  "\x41"  "\x4e"  "\x44"  "\x20"  "\x46"  "\x49"  "\x54"  "\x4e"  "\x45"  "\x53"  "\x53"  "\x20"  "\x46"  "\x4f"  "\x52"  "\x20"  "\x41"  "\x20"  "\x50"  "\x41"  "\x52"  "\x54"  "\x49"  "\x43"  "\x55"  "\x4c"  "\x41"  "\x52"  "\x20"  "\x50"  "\x55"  "\x52"  "\x50"  "\x4f"  "\x53"  "\x45"  "\x20"  "\x41"  "\x52"  "\x45"  "\x20"  "\x44"  "\x49"  "\x53"  "\x43"  "\x4c"  "\x41"  "\x49"  "\x4d"  "\x45"  "\x44"  "\x2e"  "\x20"  "\x49"  "\x4e"  "\x20"  "\x4e"  "\x4f"  "\x20"  "\x45"  "\x56"  "\x45"  "\x4e"  "\x54"  "\x20"  "\x53"  "\x48"  "\x41"  "\x4c"  "\x4c"  "\x20"  "\x54"  "\x48"  "\x45"  "\x20"  "\x43"  "\x4f"  "\x50"  "\x59"  "\x52"  "\x49"  "\x47"  "\x48"  "\x54"  "\x20"  "\x48"  "\x4f"  "\x4c"  "\x44"  "\x45"  "\x52"  "\x20"  "\x4f"  "\x52"  "\x20"  "\x43"  "\x4f"  "\x4e"  "\x54"  "\x52"  "\x49"  "\x42"  "\x55"  "\x54"  "\x4f"  "\x52"  "\x53"  "\x20"  "\x42"  "\x45"  "\x20"  "\x4c"  "\x49"  "\x41"  "\x42"  "\x4c"  "\x45"  "\x20"  "\x46"  "\x4f"  "\x52"  "\x20"  "\x41"  "\x4e"  "\x59"  "\x20"  "\x44"  "\x49"  "\x52"  "\x45"  "\x43"  "\x54"  "\x2c"  "\x20"  "\x49"  "\x4e"  "\x44"  "\x49"  "\x52"  "\x45"  "\x43"  "\x54"  "\x2c"  "\x20"  "\x49"  "\x4e"  "\x43"  "\x49"  "\x44"  "\x45"  "\x4e"  "\x54"  "\x41"  "\x4c"  "\x2c"  "\x20"  "\x53"  "\x50"  "\x45"  "\x43"  "\x49"  "\x41"  "\x4c"  "\x2c"  "\x20"  "\x45"  "\x58"  "\x45"  "\x4d"  "\x50"  "\x4c"  "\x41"  "\x52"  "\x59"  "\x2c"  "\x20"  "\x4f"  "\x52"  "\x20"  "\x43"  "\x4f"  "\x4e"  "\x53"  "\x45"  "\x51"  "\x55"  "\x45"  "\x4e"  "\x54"  "\x49"  "\x41"  "\x4c"  "\x20"  "\x44"  "\x41"  "\x4d"  "\x41"  "\x47"  "\x45"  "\x53"  "\x20"  "\x28"  "\x49"  "\x4e"  "\x43"  "\x4c"  "\x55"  "\x44"  "\x49"  "\x4e"  "\x47"  "\x2c"  "\x20"  "\x42"  "\x55"  "\x54"  "\x20"  "\x4e"  "\x4f"  "\x54"  "\x20"  "\x4c"  "\x49"  "\x4d"  "\x49"  "\x54"  "\x45"  "\x44"  "\x20"  "\x54"  "\x4f"  "\x2c"  "\x20"  "\x50"  "\x52"  "\x4f"  "\x43"  "\x55"  "\x52"  "\x45"  "\x4d"  "\x45"  "\x4e"  "\x54"  "\x20"  "\x4f"  "\x46"  "\x20"  "\x53"  "\x55"  "\x42"  "\x53"  "\x54"  "\x49"  "\x54"  "\x55"  "\x54"  "\x45"  "\x20"  "\x47"  "\x4f"  "\x4f"  "\x44"  "\x53"  "\x20"  "\x4f"  "\x52"  "\x20"  "\x53"  "\x45"  "\x52"  "\x56"  "\x49"  "\x43"  "\x45"  "\x53"  "\x3b"  "\x20"  "\x4c"  "\x4f"  "\x53"  "\x53"  "\x20"  "\x4f"  "\x46"  "\x20"  "\x55"  "\x53"  "\x45"  "\x2c"  "\x20"  "\x44"  "\x41"  "\x54"  "\x41"  "\x2c"  "\x20"  "\x4f"  "\x52"  "\x20"  "\x50"  "\x52"  "\x4f"  "\x46"  "\x49"  "\x54"  "\x53"  "\x3b"  "\x20"  "\x4f"  "\x52"  "\x20"  "\x42"  "\x55"  "\x53"  "\x49"  "\x4e"  "\x45"  "\x53"  "\x53"  "\x20"  "\x49"  "\x4e"  "\x54"  "\x45"  "\x52"  "\x52"  "\x55"  "\x50"  "\x54"  "\x49"  "\x4f"  "\x4e"  "\x29"  "\x20"  "\x48"  "\x4f"  "\x57"  "\x45"  "\x56"  "\x45"  "\x52"  "\x20"  "\x43"  "\x41"  "\x55"  "\x53"  "\x45"  "\x44"  "\x20"  "\x41"  "\x4e"  "\x44"  "\x20"  "\x4f"  "\x4e"  "\x20"  "\x41"  "\x4e"  "\x59"  "\x20"  "\x54"  "\x48"  "\x45"  "\x4f"  "\x52"  "\x59"  "\x20"  "\x4f"  "\x46"  "\x20"  "\x4c"  "\x49"  "\x41"  "\x42"  "\x49"  "\x4c"  "\x49"  "\x54"  "\x59"  "\x2c"  "\x20"  "\x57"  "\x48"  "\x45"  "\x54"  "\x48"  "\x45"  "\x52"  "\x20"  "\x49"  "\x4e"  "\x20"  "\x43"  "\x4f"  "\x4e"  "\x54"  "\x52"  "\x41"  "\x43"  "\x54"  "\x2c"  "\x20"  "\x53"  "\x54"  "\x52"  "\x49"  "\x43"  "\x54"  "\x20"  "\x4c"  "\x49"  "\x41"  "\x42"  "\x49"  "\x4c"  "\x49"  "\x54"  "\x59"  "\x2c"  "\x20"  "\x4f"  "\x52"  "\x20"  "\x54"  "\x4f"  "\x52"  "\x54"  "\x20"  "\x28"  "\x49"  "\x4e"  "\x43"  "\x4c"  "\x55"  "\x44"  "\x49"  "\x4e"  "\x47"  "\x20"  "\x4e"  "\x45"  "\x47"  "\x4c"  "\x49"  "\x47"  "\x45"  "\x4e"  "\x43"  "\x45"  "\x20"  "\x4f"  "\x52"  "\x20"  "\x4f"  "\x54"  "\x48"  "\x45"  "\x52"  "\x57"  "\x49"  "\x53"  "\x45"  "\x29"  "\x20"  "\x41"  "\x52"  "\x49"  "\x53"  "\x49"  "\x4e"  "\x47"  "\x20"  "\x49"  "\x4e"  "\x20"  "\x41"  "\x4e"  "\x59"  "\x20"  "\x57"  "\x41"  "\x59"  "\x20"  "\x4f"  "\x55"  "\x54"  "\x20"  "\x4f"  "\x46"  "\x20"  "\x54"  "\x48"  "\x45"  "\x20"  "\x55"  "\x53"  "\x45"  "\x20"  "\x4f"  "\x46"  "\x20"  "\x54"  "\x48"  "\x49"  "\x53"  "\x20"  "\x53"  "\x4f"  "\x46"  "\x54"  "\x57"  "\x41"  "\x52"  "\x45"  "\x2c"  "\x20"  "\x45"  "\x56"  "\x45"  "\x4e"  "\x20"  "\x49"  "\x46"  "\x20"  "\x41"  "\x44"  "\x56"  "\x49"  "\x53"  "\x45"  "\x44"  "\x20"  "\x4f"  "\x46"  "\x20"  "\x54"  "\x48"  "\x45"  "\x20"  "\x50"  "\x4f"  "\x53"  "\x53"  "\x49"  "\x42"  "\x49"  "\x4c"  "\x49"  "\x54"  "\x59"  "\x20"  "\x4f"  "\x46"  "\x20"  "\x53"  "\x55"  "\x43"  "\x48"  "\x20"  "\x44"  "\x41"  "\x4d"  "\x41"  "\x47"  "\x45"  "\x2e"  "\x0a"  "\x2a"  "\x2f"  "\x0a"  "\x0a"  "\x2f"  "\x2a"  "\x0a"  "\x40"  "\x66"  "\x69"  "\x6c"  "\x65"  "\x0a"  "\x0a"  "\x49"  "\x6d"  "\x70"  "\x6c"  "\x65"  "\x6d"  "\x65"  "\x6e"  "\x74"  "\x73"  "\x20"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x2d"  "\x69"  "\x20"  "\x52"  "\x4e"  "\x47"  "\x2e"  "\x0a"  "\x0a"  "\x53"  "\x2e"  "\x20"  "\x4e"  "\x65"  "\x76"  "\x65"  "\x73"  "\x2c"  "\x20"  "\x46"  "\x2e"  "\x20"  "\x41"  "\x72"  "\x61"  "\x75"  "\x6a"  "\x6f"  "\x2c"  "\x20"  "\x46"  "\x61"  "\x73"  "\x74"  "\x20"  "\x61"  "\x6e"  "\x64"  "\x20"  "\x73"  "\x6d"  "\x61"  "\x6c"  "\x6c"  "\x20"  "\x6e"  "\x6f"  "\x6e"  "\x6c"  "\x69"  "\x6e"  "\x65"  "\x61"  "\x72"  "\x20"  "\x70"  "\x73"  "\x65"  "\x75"  "\x64"  "\x6f"  "\x72"  "\x61"  "\x6e"  "\x64"  "\x6f"  "\x6d"  "\x20"  "\x6e"  "\x75"  "\x6d"  "\x62"  "\x65"  "\x72"  "\x20"  "\x67"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x61"  "\x74"  "\x6f"  "\x72"  "\x73"  "\x20"  "\x66"  "\x6f"  "\x72"  "\x20"  "\x63"  "\x6f"  "\x6d"  "\x70"  "\x75"  "\x74"  "\x65"  "\x72"  "\x20"  "\x73"  "\x69"  "\x6d"  "\x75"  "\x6c"  "\x61"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x2c"  "\x20"  "\x69"  "\x6e"  "\x3a"  "\x20"  "\x49"  "\x6e"  "\x74"  "\x65"  "\x72"  "\x6e"  "\x61"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x61"  "\x6c"  "\x20"  "\x43"  "\x6f"  "\x6e"  "\x66"  "\x65"  "\x72"  "\x65"  "\x6e"  "\x63"  "\x65"  "\x20"  "\x6f"  "\x6e"  "\x20"  "\x50"  "\x61"  "\x72"  "\x61"  "\x6c"  "\x6c"  "\x65"  "\x6c"  "\x20"  "\x50"  "\x72"  "\x6f"  "\x63"  "\x65"  "\x73"  "\x73"  "\x69"  "\x6e"  "\x67"  "\x20"  "\x61"  "\x6e"  "\x64"  "\x20"  "\x41"  "\x70"  "\x70"  "\x6c"  "\x69"  "\x65"  "\x64"  "\x20"  "\x4d"  "\x61"  "\x74"  "\x68"  "\x65"  "\x6d"  "\x61"  "\x74"  "\x69"  "\x63"  "\x73"  "\x2c"  "\x20"  "\x53"  "\x70"  "\x72"  "\x69"  "\x6e"  "\x67"  "\x65"  "\x72"  "\x2c"  "\x20"  "\x32"  "\x30"  "\x31"  "\x31"  "\x2c"  "\x20"  "\x70"  "\x70"  "\x2e"  "\x20"  "\x39"  "\x32"  "\x2d"  "\x31"  "\x30"  "\x31"  "\x2e"  "\x0a"  "\x2a"  "\x2f"  "\x0a"  "\x23"  "\x69"  "\x66"  "\x6e"  "\x64"  "\x65"  "\x66"  "\x20"  "\x5f"  "\x5f"  "\x54"  "\x59"  "\x43"  "\x48"  "\x45"  "\x5f"  "\x49"  "\x5f"  "\x43"  "\x4c"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x5f"  "\x5f"  "\x54"  "\x59"  "\x43"  "\x48"  "\x45"  "\x5f"  "\x49"  "\x5f"  "\x43"  "\x4c"  "\x0a"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x54"  "\x59"  "\x43"  "\x48"  "\x45"  "\x5f"  "\x49"  "\x5f"  "\x46"  "\x4c"  "\x4f"  "\x41"  "\x54"  "\x5f"  "\x4d"  "\x55"  "\x4c"  "\x54"  "\x49"  "\x20"  "\x35"  "\x2e"  "\x34"  "\x32"  "\x31"  "\x30"  "\x31"  "\x30"  "\x38"  "\x36"  "\x32"  "\x34"  "\x32"  "\x37"  "\x35"  "\x32"  "\x32"  "\x31"  "\x37"  "\x30"  "\x30"  "\x33"  "\x37"  "\x32"  "\x36"  "\x34"  "\x30"  "\x65"  "\x2d"  "\x32"  "\x30"  "\x66"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x54"  "\x59"  "\x43"  "\x48"  "\x45"  "\x5f"  "\x49"  "\x5f"  "\x44"  "\x4f"  "\x55"  "\x42"  "\x4c"  "\x45"  "\x5f"  "\x4d"  "\x55"  "\x4c"  "\x54"  "\x49"  "\x20"  "\x35"  "\x2e"  "\x34"  "\x32"  "\x31"  "\x30"  "\x31"  "\x30"  "\x38"  "\x36"  "\x32"  "\x34"  "\x32"  "\x37"  "\x35"  "\x32"  "\x32"  "\x31"  "\x37"  "\x30"  "\x30"  "\x33"  "\x37"  "\x32"  "\x36"  "\x34"  "\x30"  "\x65"  "\x2d"  "\x32"  "\x30"  "\x0a"  "\x0a"  "\x2f"  "\x2a"  "\x2a"  "\x0a"  "\x53"  "\x74"  "\x61"  "\x74"  "\x65"  "\x20"  "\x6f"  "\x66"  "\x20"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x20"  "\x52"  "\x4e"  "\x47"  "\x2e"  "\x0a"  "\x2a"  "\x2f"  "\x0a"  "\x74"  "\x79"  "\x70"  "\x65"  "\x64"  "\x65"  "\x66"  "\x20"  "\x75"  "\x6e"  "\x69"  "\x6f"  "\x6e"  "\x7b"  "\x0a"  "\x09"  "\x73"  "\x74"  "\x72"  "\x75"  "\x63"  "\x74"  "\x7b"  "\x0a"  "\x09"  "\x09"  "\x75"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x61"  "\x2c"  "\x62"  "\x2c"  "\x63"  "\x2c"  "\x64"  "\x3b"  "\x0a"  "\x09"  "\x7d"  "\x3b"  "\x0a"  "\x09"  "\x75"  "\x6c"  "\x6f"  "\x6e"  "\x67"  "\x20"  "\x72"  "\x65"  "\x73"  "\x3b"  "\x0a"  "\x7d"  "\x20"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x3b"  "\x0a"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x54"  "\x59"  "\x43"  "\x48"  "\x45"  "\x5f"  "\x49"  "\x5f"  "\x52"  "\x4f"  "\x54"  "\x28"  "\x61"  "\x2c"  "\x62"  "\x29"  "\x20"  "\x28"  "\x28"  "\x28"  "\x61"  "\x29"  "\x20"  "\x3e"  "\x3e"  "\x20"  "\x28"  "\x62"  "\x29"  "\x29"  "\x20"  "\x7c"  "\x20"  "\x28"  "\x28"  "\x61"  "\x29"  "\x20"  "\x3c"  "\x3c"  "\x20"  "\x28"  "\x33"  "\x32"  "\x20"  "\x2d"  "\x20"  "\x28"  "\x62"  "\x29"  "\x29"  "\x29"  "\x29"  "\x0a"  "\x2f"  "\x2a"  "\x2a"  "\x0a"  "\x47"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x61"  "\x74"  "\x65"  "\x73"  "\x20"  "\x61"  "\x20"  "\x72"  "\x61"  "\x6e"  "\x64"  "\x6f"  "\x6d"  "\x20"  "\x36"  "\x34"  "\x2d"  "\x62"  "\x69"  "\x74"  "\x20"  "\x75"  "\x6e"  "\x73"  "\x69"  "\x67"  "\x6e"  "\x65"  "\x64"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x65"  "\x67"  "\x65"  "\x72"  "\x20"  "\x75"  "\x73"  "\x69"  "\x6e"  "\x67"  "\x20"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x20"  "\x52"  "\x4e"  "\x47"  "\x2e"  "\x0a"  "\x0a"  "\x54"  "\x68"  "\x69"  "\x73"  "\x20"  "\x69"  "\x73"  "\x20"  "\x61"  "\x6c"  "\x74"  "\x65"  "\x72"  "\x6e"  "\x61"  "\x74"  "\x69"  "\x76"  "\x65"  "\x2c"  "\x20"  "\x6d"  "\x61"  "\x63"  "\x72"  "\x6f"  "\x20"  "\x69"  "\x6d"  "\x70"  "\x6c"  "\x65"  "\x6d"  "\x65"  "\x6e"  "\x74"  "\x61"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x20"  "\x6f"  "\x66"  "\x20"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x20"  "\x52"  "\x4e"  "\x47"  "\x2e"  "\x0a"  "\x0a"  "\x40"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x73"  "\x20"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x20"  "\x53"  "\x74"  "\x61"  "\x74"  "\x65"  "\x20"  "\x6f"  "\x66"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x52"  "\x4e"  "\x47"  "\x20"  "\x74"  "\x6f"  "\x20"  "\x75"  "\x73"  "\x65"  "\x2e"  "\x0a"  "\x2a"  "\x2f"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x6d"  "\x61"  "\x63"  "\x72"  "\x6f"  "\x5f"  "\x75"  "\x6c"  "\x6f"  "\x6e"  "\x67"  "\x28"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x29"  "\x20"  "\x28"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x6d"  "\x61"  "\x63"  "\x72"  "\x6f"  "\x5f"  "\x61"  "\x64"  "\x76"  "\x61"  "\x6e"  "\x63"  "\x65"  "\x28"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x29"  "\x2c"  "\x20"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2e"  "\x72"  "\x65"  "\x73"  "\x29"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x6d"  "\x61"  "\x63"  "\x72"  "\x6f"  "\x5f"  "\x61"  "\x64"  "\x76"  "\x61"  "\x6e"  "\x63"  "\x65"  "\x28"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x29"  "\x20"  "\x28"  "\x20"  "\x5c"  "\x0a"  "\x09"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2e"  "\x62"  "\x20"  "\x3d"  "\x20"  "\x54"  "\x59"  "\x43"  "\x48"  "\x45"  "\x5f"  "\x49"  "\x5f"  "\x52"  "\x4f"  "\x54"  "\x28"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2e"  "\x62"  "\x2c"  "\x20"  "\x37"  "\x29"  "\x20"  "\x5e"  "\x20"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2e"  "\x63"  "\x2c"  "\x20"  "\x5c"  "\x0a"  "\x09"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2e"  "\x63"  "\x20"  "\x2d"  "\x3d"  "\x20"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2e"  "\x64"  "\x2c"  "\x20"  "\x5c"  "\x0a"  "\x09"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2e"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x54"  "\x59"  "\x43"  "\x48"  "\x45"  "\x5f"  "\x49"  "\x5f"  "\x52"  "\x4f"  "\x54"  "\x28"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2e"  "\x64"  "\x2c"  "\x20"  "\x38"  "\x29"  "\x20"  "\x5e"  "\x20"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2e"  "\x61"  "\x2c"  "\x5c"  "\x0a"  "\x09"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2e"  "\x61"  "\x20"  "\x2d"  "\x3d"  "\x20"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2e"  "\x62"  "\x2c"  "\x20"  "\x5c"  "\x0a"  "\x09"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2e"  "\x62"  "\x20"  "\x3d"  "\x20"  "\x54"  "\x59"  "\x43"  "\x48"  "\x45"  "\x5f"  "\x49"  "\x5f"  "\x52"  "\x4f"  "\x54"  "\x28"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2e"  "\x62"  "\x2c"  "\x20"  "\x31"  "\x32"  "\x29"  "\x20"  "\x5e"  "\x20"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2e"  "\x63"  "\x2c"  "\x20"  "\x5c"  "\x0a"  "\x09"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2e"  "\x63"  "\x20"  "\x2d"  "\x3d"  "\x20"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2e"  "\x64"  "\x2c"  "\x20"  "\x5c"  "\x0a"  "\x09"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2e"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x54"  "\x59"  "\x43"  "\x48"  "\x45"  "\x5f"  "\x49"  "\x5f"  "\x52"  "\x4f"  "\x54"  "\x28"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2e"  "\x64"  "\x2c"  "\x20"  "\x31"  "\x36"  "\x29"  "\x20"  "\x5e"  "\x20"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2e"  "\x61"  "\x2c"  "\x20"  "\x5c"  "\x0a"  "\x09"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2e"  "\x61"  "\x20"  "\x2d"  "\x3d"  "\x20"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2e"  "\x62"  "\x20"  "\x5c"  "\x0a"  "\x29"  "\x0a"  "\x0a"  "\x2f"  "\x2a"  "\x2a"  "\x0a"  "\x47"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x61"  "\x74"  "\x65"  "\x73"  "\x20"  "\x61"  "\x20"  "\x72"  "\x61"  "\x6e"  "\x64"  "\x6f"  "\x6d"  "\x20"  "\x36"  "\x34"  "\x2d"  "\x62"  "\x69"  "\x74"  "\x20"  "\x75"  "\x6e"  "\x73"  "\x69"  "\x67"  "\x6e"  "\x65"  "\x64"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x65"  "\x67"  "\x65"  "\x72"  "\x20"  "\x75"  "\x73"  "\x69"  "\x6e"  "\x67"  "\x20"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x20"  "\x52"  "\x4e"  "\x47"  "\x2e"  "\x0a"  "\x0a"  "\x40"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x73"  "\x20"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x20"  "\x53"  "\x74"  "\x61"  "\x74"  "\x65"  "\x20"  "\x6f"  "\x66"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x52"  "\x4e"  "\x47"  "\x20"  "\x74"  "\x6f"  "\x20"  "\x75"  "\x73"  "\x65"  "\x2e"  "\x0a"  "\x2a"  "\x2f"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x75"  "\x6c"  "\x6f"  "\x6e"  "\x67"  "\x28"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x29"  "\x20"  "\x28"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x61"  "\x64"  "\x76"  "\x61"  "\x6e"  "\x63"  "\x65"  "\x28"  "\x26"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x29"  "\x2c"  "\x20"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2e"  "\x72"  "\x65"  "\x73"  "\x29"  "\x0a"  "\x76"  "\x6f"  "\x69"  "\x64"  "\x20"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x61"  "\x64"  "\x76"  "\x61"  "\x6e"  "\x63"  "\x65"  "\x28"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2a"  "\x20"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x29"  "\x7b"  "\x0a"  "\x09"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2d"  "\x3e"  "\x62"  "\x20"  "\x3d"  "\x20"  "\x54"  "\x59"  "\x43"  "\x48"  "\x45"  "\x5f"  "\x49"  "\x5f"  "\x52"  "\x4f"  "\x54"  "\x28"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2d"  "\x3e"  "\x62"  "\x2c"  "\x20"  "\x37"  "\x29"  "\x20"  "\x5e"  "\x20"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2d"  "\x3e"  "\x63"  "\x3b"  "\x0a"  "\x09"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2d"  "\x3e"  "\x63"  "\x20"  "\x2d"  "\x3d"  "\x20"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2d"  "\x3e"  "\x64"  "\x3b"  "\x0a"  "\x09"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2d"  "\x3e"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x54"  "\x59"  "\x43"  "\x48"  "\x45"  "\x5f"  "\x49"  "\x5f"  "\x52"  "\x4f"  "\x54"  "\x28"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2d"  "\x3e"  "\x64"  "\x2c"  "\x20"  "\x38"  "\x29"  "\x20"  "\x5e"  "\x20"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2d"  "\x3e"  "\x61"  "\x3b"  "\x0a"  "\x09"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2d"  "\x3e"  "\x61"  "\x20"  "\x2d"  "\x3d"  "\x20"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2d"  "\x3e"  "\x62"  "\x3b"  "\x0a"  "\x09"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2d"  "\x3e"  "\x62"  "\x20"  "\x3d"  "\x20"  "\x54"  "\x59"  "\x43"  "\x48"  "\x45"  "\x5f"  "\x49"  "\x5f"  "\x52"  "\x4f"  "\x54"  "\x28"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2d"  "\x3e"  "\x62"  "\x2c"  "\x20"  "\x31"  "\x32"  "\x29"  "\x20"  "\x5e"  "\x20"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2d"  "\x3e"  "\x63"  "\x3b"  "\x0a"  "\x09"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2d"  "\x3e"  "\x63"  "\x20"  "\x2d"  "\x3d"  "\x20"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2d"  "\x3e"  "\x64"  "\x3b"  "\x0a"  "\x09"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2d"  "\x3e"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x54"  "\x59"  "\x43"  "\x48"  "\x45"  "\x5f"  "\x49"  "\x5f"  "\x52"  "\x4f"  "\x54"  "\x28"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2d"  "\x3e"  "\x64"  "\x2c"  "\x20"  "\x31"  "\x36"  "\x29"  "\x20"  "\x5e"  "\x20"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2d"  "\x3e"  "\x61"  "\x3b"  "\x0a"  "\x09"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2d"  "\x3e"  "\x61"  "\x20"  "\x2d"  "\x3d"  "\x20"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2d"  "\x3e"  "\x62"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x2f"  "\x2a"  "\x2a"  "\x0a"  "\x53"  "\x65"  "\x65"  "\x64"  "\x73"  "\x20"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x20"  "\x52"  "\x4e"  "\x47"  "\x2e"  "\x0a"  "\x0a"  "\x40"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x73"  "\x20"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x20"  "\x56"  "\x61"  "\x72"  "\x69"  "\x61"  "\x62"  "\x6c"  "\x65"  "\x2c"  "\x20"  "\x74"  "\x68"  "\x61"  "\x74"  "\x20"  "\x68"  "\x6f"  "\x6c"  "\x64"  "\x73"  "\x20"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x20"  "\x6f"  "\x66"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x67"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x61"  "\x74"  "\x6f"  "\x72"  "\x20"  "\x74"  "\x6f"  "\x20"  "\x62"  "\x65"  "\x20"  "\x73"  "\x65"  "\x65"  "\x64"  "\x65"  "\x64"  "\x2e"  "\x0a"  "\x40"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x73"  "\x20"  "\x73"  "\x65"  "\x65"  "\x64"  "\x20"  "\x56"  "\x61"  "\x6c"  "\x75"  "\x65"  "\x20"  "\x75"  "\x73"  "\x65"  "\x64"  "\x20"  "\x66"  "\x6f"  "\x72"  "\x20"  "\x73"  "\x65"  "\x65"  "\x64"  "\x69"  "\x6e"  "\x67"  "\x2e"  "\x20"  "\x53"  "\x68"  "\x6f"  "\x75"  "\x6c"  "\x64"  "\x20"  "\x62"  "\x65"  "\x20"  "\x72"  "\x61"  "\x6e"  "\x64"  "\x6f"  "\x6d"  "\x6c"  "\x79"  "\x20"  "\x67"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x61"  "\x74"  "\x65"  "\x64"  "\x20"  "\x66"  "\x6f"  "\x72"  "\x20"  "\x65"  "\x61"  "\x63"  "\x68"  "\x20"  "\x69"  "\x6e"  "\x73"  "\x74"  "\x61"  "\x6e"  "\x63"  "\x65"  "\x20"  "\x6f"  "\x66"  "\x20"  "\x67"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x61"  "\x74"  "\x6f"  "\x72"  "\x20"  "\x28"  "\x74"  "\x68"  "\x72"  "\x65"  "\x61"  "\x64"  "\x29"  "\x2e"  "\x0a"  "\x2a"  "\x2f"  "\x0a"  "\x76"  "\x6f"  "\x69"  "\x64"  "\x20"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x73"  "\x65"  "\x65"  "\x64"  "\x28"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2a"  "\x20"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2c"  "\x20"  "\x75"  "\x6c"  "\x6f"  "\x6e"  "\x67"  "\x20"  "\x73"  "\x65"  "\x65"  "\x64"  "\x29"  "\x7b"  "\x0a"  "\x09"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2d"  "\x3e"  "\x61"  "\x20"  "\x3d"  "\x20"  "\x73"  "\x65"  "\x65"  "\x64"  "\x20"  "\x3e"  "\x3e"  "\x20"  "\x33"  "\x32"  "\x3b"  "\x0a"  "\x09"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2d"  "\x3e"  "\x62"  "\x20"  "\x3d"  "\x20"  "\x73"  "\x65"  "\x65"  "\x64"  "\x3b"  "\x0a"  "\x09"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2d"  "\x3e"  "\x63"  "\x20"  "\x3d"  "\x20"  "\x32"  "\x36"  "\x35"  "\x34"  "\x34"  "\x33"  "\x35"  "\x37"  "\x36"  "\x39"  "\x3b"  "\x0a"  "\x09"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2d"  "\x3e"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x31"  "\x33"  "\x36"  "\x37"  "\x31"  "\x33"  "\x30"  "\x35"  "\x35"  "\x31"  "\x20"  "\x5e"  "\x20"  "\x28"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x67"  "\x6c"  "\x6f"  "\x62"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x64"  "\x28"  "\x30"  "\x29"  "\x20"  "\x2b"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x67"  "\x6c"  "\x6f"  "\x62"  "\x61"  "\x6c"  "\x5f"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x28"  "\x30"  "\x29"  "\x20"  "\x2a"  "\x20"  "\x28"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x67"  "\x6c"  "\x6f"  "\x62"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x64"  "\x28"  "\x31"  "\x29"  "\x20"  "\x2b"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x67"  "\x6c"  "\x6f"  "\x62"  "\x61"  "\x6c"  "\x5f"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x28"  "\x31"  "\x29"  "\x20"  "\x2a"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x67"  "\x6c"  "\x6f"  "\x62"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x64"  "\x28"  "\x32"  "\x29"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x09"  "\x66"  "\x6f"  "\x72"  "\x28"  "\x75"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x69"  "\x3d"  "\x30"  "\x3b"  "\x69"  "\x3c"  "\x32"  "\x30"  "\x3b"  "\x69"  "\x2b"  "\x2b"  "\x29"  "\x7b"  "\x0a"  "\x09"  "\x09"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x61"  "\x64"  "\x76"  "\x61"  "\x6e"  "\x63"  "\x65"  "\x28"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x29"  "\x3b"  "\x0a"  "\x09"  "\x7d"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x2f"  "\x2a"  "\x2a"  "\x0a"  "\x47"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x61"  "\x74"  "\x65"  "\x73"  "\x20"  "\x61"  "\x20"  "\x72"  "\x61"  "\x6e"  "\x64"  "\x6f"  "\x6d"  "\x20"  "\x33"  "\x32"  "\x2d"  "\x62"  "\x69"  "\x74"  "\x20"  "\x75"  "\x6e"  "\x73"  "\x69"  "\x67"  "\x6e"  "\x65"  "\x64"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x65"  "\x67"  "\x65"  "\x72"  "\x20"  "\x75"  "\x73"  "\x69"  "\x6e"  "\x67"  "\x20"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x20"  "\x52"  "\x4e"  "\x47"  "\x2e"  "\x0a"  "\x0a"  "\x40"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x73"  "\x20"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x20"  "\x53"  "\x74"  "\x61"  "\x74"  "\x65"  "\x20"  "\x6f"  "\x66"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x52"  "\x4e"  "\x47"  "\x20"  "\x74"  "\x6f"  "\x20"  "\x75"  "\x73"  "\x65"  "\x2e"  "\x0a"  "\x2a"  "\x2f"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x75"  "\x69"  "\x6e"  "\x74"  "\x28"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x29"  "\x20"  "\x28"  "\x28"  "\x75"  "\x69"  "\x6e"  "\x74"  "\x29"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x75"  "\x6c"  "\x6f"  "\x6e"  "\x67"  "\x28"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x29"  "\x29"  "\x0a"  "\x0a"  "\x2f"  "\x2a"  "\x2a"  "\x0a"  "\x47"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x61"  "\x74"  "\x65"  "\x73"  "\x20"  "\x61"  "\x20"  "\x72"  "\x61"  "\x6e"  "\x64"  "\x6f"  "\x6d"  "\x20"  "\x66"  "\x6c"  "\x6f"  "\x61"  "\x74"  "\x20"  "\x75"  "\x73"  "\x69"  "\x6e"  "\x67"  "\x20"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x20"  "\x52"  "\x4e"  "\x47"  "\x2e"  "\x0a"  "\x0a"  "\x40"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x73"  "\x20"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x20"  "\x53"  "\x74"  "\x61"  "\x74"  "\x65"  "\x20"  "\x6f"  "\x66"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x52"  "\x4e"  "\x47"  "\x20"  "\x74"  "\x6f"  "\x20"  "\x75"  "\x73"  "\x65"  "\x2e"  "\x0a"  "\x2a"  "\x2f"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x66"  "\x6c"  "\x6f"  "\x61"  "\x74"  "\x28"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x29"  "\x20"  "\x28"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x75"  "\x6c"  "\x6f"  "\x6e"  "\x67"  "\x28"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x29"  "\x2a"  "\x54"  "\x59"  "\x43"  "\x48"  "\x45"  "\x5f"  "\x49"  "\x5f"  "\x46"  "\x4c"  "\x4f"  "\x41"  "\x54"  "\x5f"  "\x4d"  "\x55"  "\x4c"  "\x54"  "\x49"  "\x29"  "\x0a"  "\x0a"  "\x2f"  "\x2a"  "\x2a"  "\x0a"  "\x47"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x61"  "\x74"  "\x65"  "\x73"  "\x20"  "\x61"  "\x20"  "\x72"  "\x61"  "\x6e"  "\x64"  "\x6f"  "\x6d"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x75"  "\x73"  "\x69"  "\x6e"  "\x67"  "\x20"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x20"  "\x52"  "\x4e"  "\x47"  "\x2e"  "\x0a"  "\x0a"  "\x40"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x73"  "\x20"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x20"  "\x53"  "\x74"  "\x61"  "\x74"  "\x65"  "\x20"  "\x6f"  "\x66"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x52"  "\x4e"  "\x47"  "\x20"  "\x74"  "\x6f"  "\x20"  "\x75"  "\x73"  "\x65"  "\x2e"  "\x0a"  "\x2a"  "\x2f"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x28"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x29"  "\x20"  "\x28"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x75"  "\x6c"  "\x6f"  "\x6e"  "\x67"  "\x28"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x29"  "\x2a"  "\x54"  "\x59"  "\x43"  "\x48"  "\x45"  "\x5f"  "\x49"  "\x5f"  "\x44"  "\x4f"  "\x55"  "\x42"  "\x4c"  "\x45"  "\x5f"  "\x4d"  "\x55"  "\x4c"  "\x54"  "\x49"  "\x29"  "\x0a"  "\x0a"  "\x2f"  "\x2a"  "\x2a"  "\x0a"  "\x47"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x61"  "\x74"  "\x65"  "\x73"  "\x20"  "\x61"  "\x20"  "\x72"  "\x61"  "\x6e"  "\x64"  "\x6f"  "\x6d"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x75"  "\x73"  "\x69"  "\x6e"  "\x67"  "\x20"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x20"  "\x52"  "\x4e"  "\x47"  "\x2e"  "\x20"  "\x53"  "\x69"  "\x6e"  "\x63"  "\x65"  "\x20"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x73"  "\x20"  "\x36"  "\x34"  "\x2d"  "\x62"  "\x69"  "\x74"  "\x20"  "\x6e"  "\x75"  "\x6d"  "\x62"  "\x65"  "\x72"  "\x73"  "\x20"  "\x74"  "\x68"  "\x69"  "\x73"  "\x20"  "\x69"  "\x73"  "\x20"  "\x65"  "\x71"  "\x75"  "\x69"  "\x76"  "\x61"  "\x6c"  "\x65"  "\x6e"  "\x74"  "\x20"  "\x74"  "\x6f"  "\x20"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x2e"  "\x0a"  "\x0a"  "\x40"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x73"  "\x20"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x20"  "\x53"  "\x74"  "\x61"  "\x74"  "\x65"  "\x20"  "\x6f"  "\x66"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x52"  "\x4e"  "\x47"  "\x20"  "\x74"  "\x6f"  "\x20"  "\x75"  "\x73"  "\x65"  "\x2e"  "\x0a"  "\x2a"  "\x2f"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x32"  "\x28"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x29"  "\x20"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x28"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x29"  "\x0a"  "\x0a"  "\x23"  "\x65"  "\x6e"  "\x64"  "\x69"  "\x66"  "\x20"  "\x2f"  "\x2f"  "\x5f"  "\x5f"  "\x54"  "\x59"  "\x43"  "\x48"  "\x45"  "\x5f"  "\x49"  "\x5f"  "\x43"  "\x4c"  "\x0a"  "\x23"  "\x69"  "\x66"  "\x6e"  "\x64"  "\x65"  "\x66"  "\x20"  "\x5f"  "\x5f"  "\x43"  "\x4f"  "\x4e"  "\x53"  "\x54"  "\x41"  "\x4e"  "\x54"  "\x53"  "\x5f"  "\x48"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x5f"  "\x5f"  "\x43"  "\x4f"  "\x4e"  "\x53"  "\x54"  "\x41"  "\x4e"  "\x54"  "\x53"  "\x5f"  "\x48"  "\x0a"  "\x0a"  "\x23"  "\x69"  "\x66"  "\x6e"  "\x64"  "\x65"  "\x66"  "\x20"  "\x4d"  "\x5f"  "\x50"  "\x49"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x4d"  "\x5f"  "\x50"  "\x49"  "\x20"  "\x33"  "\x2e"  "\x31"  "\x34"  "\x31"  "\x35"  "\x39"  "\x32"  "\x36"  "\x35"  "\x33"  "\x35"  "\x38"  "\x39"  "\x37"  "\x39"  "\x33"  "\x32"  "\x33"  "\x38"  "\x34"  "\x36"  "\x0a"  "\x23"  "\x65"  "\x6e"  "\x64"  "\x69"  "\x66"  "\x0a"  "\x0a"  "\x23"  "\x69"  "\x66"  "\x6e"  "\x64"  "\x65"  "\x66"  "\x20"  "\x4d"  "\x5f"  "\x45"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x4d"  "\x5f"  "\x45"  "\x20"  "\x32"  "\x2e"  "\x37"  "\x31"  "\x38"  "\x32"  "\x38"  "\x31"  "\x38"  "\x32"  "\x38"  "\x34"  "\x35"  "\x39"  "\x30"  "\x34"  "\x35"  "\x32"  "\x33"  "\x35"  "\x34"  "\x0a"  "\x23"  "\x65"  "\x6e"  "\x64"  "\x69"  "\x66"  "\x0a"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x48"  "\x42"  "\x41"  "\x52"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x35"  "\x34"  "\x35"  "\x37"  "\x31"  "\x38"  "\x31"  "\x37"  "\x65"  "\x2d"  "\x33"  "\x34"  "\x20"  "\x2f"  "\x2f"  "\x20"  "\x4a"  "\x2a"  "\x73"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x51"  "\x45"  "\x20"  "\x31"  "\x2e"  "\x36"  "\x30"  "\x32"  "\x31"  "\x37"  "\x36"  "\x36"  "\x33"  "\x34"  "\x65"  "\x2d"  "\x31"  "\x39"  "\x20"  "\x2f"  "\x2f"  "\x20"  "\x43"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x4d"  "\x55"  "\x5f"  "\x42"  "\x20"  "\x39"  "\x2e"  "\x32"  "\x37"  "\x34"  "\x30"  "\x31"  "\x30"  "\x30"  "\x37"  "\x38"  "\x33"  "\x65"  "\x2d"  "\x32"  "\x34"  "\x20"  "\x2f"  "\x2f"  "\x20"  "\x4a"  "\x2f"  "\x54"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x4d"  "\x55"  "\x5f"  "\x30"  "\x20"  "\x31"  "\x2e"  "\x32"  "\x35"  "\x36"  "\x36"  "\x33"  "\x37"  "\x30"  "\x36"  "\x32"  "\x31"  "\x32"  "\x65"  "\x2d"  "\x36"  "\x20"  "\x2f"  "\x2f"  "\x20"  "\x4e"  "\x2f"  "\x41"  "\x5e"  "\x32"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x4b"  "\x42"  "\x20"  "\x31"  "\x2e"  "\x33"  "\x38"  "\x30"  "\x36"  "\x34"  "\x39"  "\x65"  "\x2d"  "\x32"  "\x33"  "\x20"  "\x2f"  "\x2f"  "\x20"  "\x4a"  "\x2f"  "\x4b"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x4e"  "\x53"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x65"  "\x2d"  "\x39"  "\x20"  "\x2f"  "\x2f"  "\x20"  "\x73"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x4e"  "\x41"  "\x4e"  "\x4f"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x65"  "\x2d"  "\x39"  "\x0a"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x55"  "\x4e"  "\x55"  "\x53"  "\x45"  "\x44"  "\x28"  "\x78"  "\x29"  "\x20"  "\x28"  "\x28"  "\x76"  "\x6f"  "\x69"  "\x64"  "\x29"  "\x78"  "\x29"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x53"  "\x49"  "\x47"  "\x4e"  "\x28"  "\x78"  "\x29"  "\x20"  "\x28"  "\x28"  "\x78"  "\x29"  "\x20"  "\x3e"  "\x20"  "\x30"  "\x20"  "\x3f"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x3a"  "\x20"  "\x2d"  "\x31"  "\x2e"  "\x30"  "\x29"  "\x0a"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x49"  "\x4e"  "\x43"  "\x45"  "\x50"  "\x54"  "\x49"  "\x4f"  "\x4e"  "\x28"  "\x4d"  "\x29"  "\x0a"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x4c"  "\x4f"  "\x43"  "\x28"  "\x72"  "\x6f"  "\x77"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x2c"  "\x20"  "\x64"  "\x65"  "\x70"  "\x74"  "\x68"  "\x2c"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x20"  "\x28"  "\x28"  "\x63"  "\x6f"  "\x6c"  "\x29"  "\x20"  "\x2b"  "\x20"  "\x28"  "\x72"  "\x6f"  "\x77"  "\x29"  "\x20"  "\x2a"  "\x20"  "\x28"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x20"  "\x2b"  "\x20"  "\x28"  "\x64"  "\x65"  "\x70"  "\x74"  "\x68"  "\x29"  "\x20"  "\x2a"  "\x20"  "\x28"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x20"  "\x2a"  "\x20"  "\x28"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x29"  "\x29"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x45"  "\x50"  "\x53"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x65"  "\x2d"  "\x31"  "\x32"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x43"  "\x4c"  "\x4f"  "\x53"  "\x45"  "\x5f"  "\x45"  "\x4e"  "\x4f"  "\x55"  "\x47"  "\x48"  "\x28"  "\x78"  "\x2c"  "\x20"  "\x79"  "\x2c"  "\x20"  "\x65"  "\x70"  "\x73"  "\x29"  "\x20"  "\x28"  "\x28"  "\x53"  "\x49"  "\x47"  "\x4e"  "\x28"  "\x28"  "\x78"  "\x29"  "\x20"  "\x2d"  "\x20"  "\x28"  "\x79"  "\x29"  "\x29"  "\x20"  "\x2a"  "\x20"  "\x28"  "\x28"  "\x78"  "\x29"  "\x20"  "\x2d"  "\x20"  "\x28"  "\x79"  "\x29"  "\x29"  "\x29"  "\x20"  "\x3c"  "\x3d"  "\x20"  "\x28"  "\x65"  "\x70"  "\x73"  "\x29"  "\x29"  "\x0a"  "\x0a"  "\x23"  "\x69"  "\x66"  "\x6e"  "\x64"  "\x65"  "\x66"  "\x20"  "\x4f"  "\x50"  "\x45"  "\x4e"  "\x43"  "\x4c"  "\x5f"  "\x43"  "\x4f"  "\x4d"  "\x50"  "\x49"  "\x4c"  "\x41"  "\x54"  "\x49"  "\x4f"  "\x4e"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x4c"  "\x4f"  "\x43"  "\x41"  "\x4c"  "\x20"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x50"  "\x52"  "\x49"  "\x56"  "\x41"  "\x54"  "\x45"  "\x20"  "\x0a"  "\x23"  "\x65"  "\x6c"  "\x73"  "\x65"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x67"  "\x6c"  "\x6f"  "\x62"  "\x61"  "\x6c"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x4c"  "\x4f"  "\x43"  "\x41"  "\x4c"  "\x20"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x50"  "\x52"  "\x49"  "\x56"  "\x41"  "\x54"  "\x45"  "\x20"  "\x70"  "\x72"  "\x69"  "\x76"  "\x61"  "\x74"  "\x65"  "\x0a"  "\x23"  "\x65"  "\x6e"  "\x64"  "\x69"  "\x66"  "\x0a"  "\x0a"  "\x23"  "\x65"  "\x6e"  "\x64"  "\x69"  "\x66"  "\x0a"  "\x23"  "\x69"  "\x66"  "\x6e"  "\x64"  "\x65"  "\x66"  "\x20"  "\x5f"  "\x5f"  "\x56"  "\x33"  "\x44"  "\x5f"  "\x48"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x5f"  "\x5f"  "\x56"  "\x33"  "\x44"  "\x5f"  "\x48"  "\x0a"  "\x0a"  "\x74"  "\x79"  "\x70"  "\x65"  "\x64"  "\x65"  "\x66"  "\x20"  "\x73"  "\x74"  "\x72"  "\x75"  "\x63"  "\x74"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x78"  "\x2c"  "\x20"  "\x79"  "\x2c"  "\x20"  "\x7a"  "\x3b"  "\x0a"  "\x7d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x3b"  "\x0a"  "\x0a"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x28"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x78"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x79"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x7a"  "\x29"  "\x3b"  "\x0a"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x28"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x78"  "\x29"  "\x3b"  "\x0a"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x73"  "\x29"  "\x3b"  "\x0a"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x31"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x32"  "\x29"  "\x3b"  "\x0a"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x62"  "\x28"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x31"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x32"  "\x29"  "\x3b"  "\x0a"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x72"  "\x6f"  "\x73"  "\x73"  "\x28"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x31"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x32"  "\x29"  "\x3b"  "\x0a"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x6e"  "\x6f"  "\x72"  "\x6d"  "\x61"  "\x6c"  "\x69"  "\x7a"  "\x65"  "\x28"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x29"  "\x3b"  "\x0a"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x64"  "\x6f"  "\x74"  "\x28"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x31"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x32"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x23"  "\x65"  "\x6e"  "\x64"  "\x69"  "\x66"  "\x0a"  "\x23"  "\x69"  "\x66"  "\x6e"  "\x64"  "\x65"  "\x66"  "\x20"  "\x5f"  "\x5f"  "\x47"  "\x52"  "\x49"  "\x44"  "\x5f"  "\x48"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x5f"  "\x5f"  "\x47"  "\x52"  "\x49"  "\x44"  "\x5f"  "\x48"  "\x0a"  "\x0a"  "\x0a"  "\x0a"  "\x0a"  "\x0a"  "\x2f"  "\x2a"  "\x74"  "\x79"  "\x70"  "\x65"  "\x64"  "\x65"  "\x66"  "\x20"  "\x65"  "\x6e"  "\x75"  "\x6d"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x52"  "\x5f"  "\x69"  "\x6a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x3d"  "\x20"  "\x30"  "\x2c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x52"  "\x5f"  "\x69"  "\x6a"  "\x5f"  "\x43"  "\x52"  "\x4f"  "\x53"  "\x53"  "\x5f"  "\x5a"  "\x20"  "\x3d"  "\x20"  "\x31"  "\x2c"  "\x0a"  "\x7d"  "\x20"  "\x64"  "\x6d"  "\x5f"  "\x73"  "\x79"  "\x6d"  "\x6d"  "\x65"  "\x74"  "\x72"  "\x79"  "\x3b"  "\x2a"  "\x2f"  "\x0a"  "\x0a"  "\x74"  "\x79"  "\x70"  "\x65"  "\x64"  "\x65"  "\x66"  "\x20"  "\x65"  "\x6e"  "\x75"  "\x6d"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x43"  "\x55"  "\x52"  "\x5f"  "\x4e"  "\x4f"  "\x4e"  "\x45"  "\x20"  "\x3d"  "\x20"  "\x30"  "\x2c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x43"  "\x55"  "\x52"  "\x5f"  "\x53"  "\x54"  "\x54"  "\x20"  "\x3d"  "\x20"  "\x31"  "\x2c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x43"  "\x55"  "\x52"  "\x5f"  "\x53"  "\x48"  "\x45"  "\x20"  "\x3d"  "\x20"  "\x32"  "\x2c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x43"  "\x55"  "\x52"  "\x5f"  "\x42"  "\x4f"  "\x54"  "\x48"  "\x20"  "\x3d"  "\x20"  "\x43"  "\x55"  "\x52"  "\x5f"  "\x53"  "\x54"  "\x54"  "\x20"  "\x7c"  "\x20"  "\x43"  "\x55"  "\x52"  "\x5f"  "\x53"  "\x48"  "\x45"  "\x20"  "\x2f"  "\x2f"  "\x3d"  "\x33"  "\x0a"  "\x7d"  "\x20"  "\x63"  "\x75"  "\x72"  "\x72"  "\x65"  "\x6e"  "\x74"  "\x5f"  "\x74"  "\x79"  "\x70"  "\x65"  "\x3b"  "\x0a"  "\x0a"  "\x74"  "\x79"  "\x70"  "\x65"  "\x64"  "\x65"  "\x66"  "\x20"  "\x65"  "\x6e"  "\x75"  "\x6d"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x49"  "\x4e"  "\x54"  "\x45"  "\x47"  "\x52"  "\x41"  "\x54"  "\x45"  "\x5f"  "\x52"  "\x4b"  "\x34"  "\x20"  "\x3d"  "\x20"  "\x30"  "\x2c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x49"  "\x4e"  "\x54"  "\x45"  "\x47"  "\x52"  "\x41"  "\x54"  "\x45"  "\x5f"  "\x4d"  "\x49"  "\x44"  "\x50"  "\x4f"  "\x49"  "\x4e"  "\x54"  "\x20"  "\x3d"  "\x20"  "\x31"  "\x2c"  "\x20"  "\x2f"  "\x2f"  "\x73"  "\x65"  "\x6d"  "\x69"  "\x2d"  "\x69"  "\x6d"  "\x70"  "\x6c"  "\x69"  "\x63"  "\x69"  "\x74"  "\x20"  "\x6d"  "\x69"  "\x64"  "\x70"  "\x6f"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x77"  "\x69"  "\x74"  "\x68"  "\x20"  "\x43"  "\x61"  "\x79"  "\x6c"  "\x65"  "\x79"  "\x20"  "\x72"  "\x6f"  "\x74"  "\x61"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x2c"  "\x20"  "\x6b"  "\x65"  "\x65"  "\x70"  "\x73"  "\x20"  "\x7c"  "\x6d"  "\x7c"  "\x20"  "\x3d"  "\x20"  "\x31"  "\x0a"  "\x7d"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x65"  "\x67"  "\x72"  "\x61"  "\x74"  "\x65"  "\x5f"  "\x6d"  "\x65"  "\x74"  "\x68"  "\x6f"  "\x64"  "\x3b"  "\x0a"  "\x0a"  "\x74"  "\x79"  "\x70"  "\x65"  "\x64"  "\x65"  "\x66"  "\x20"  "\x73"  "\x74"  "\x72"  "\x75"  "\x63"  "\x74"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x70"  "\x62"  "\x63"  "\x5f"  "\x78"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x70"  "\x62"  "\x63"  "\x5f"  "\x79"  "\x3b"  "\x0a"  "\x7d"  "\x20"  "\x70"  "\x62"  "\x63"  "\x5f"  "\x72"  "\x75"  "\x6c"  "\x65"  "\x73"  "\x3b"  "\x0a"  "\x0a"  "\x74"  "\x79"  "\x70"  "\x65"  "\x64"  "\x65"  "\x66"  "\x20"  "\x73"  "\x74"  "\x72"  "\x75"  "\x63"  "\x74"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6a"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x69"  "\x7a"  "\x61"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x2c"  "\x20"  "\x62"  "\x65"  "\x74"  "\x61"  "\x3b"  "\x0a"  "\x7d"  "\x20"  "\x73"  "\x74"  "\x74"  "\x5f"  "\x63"  "\x75"  "\x72"  "\x72"  "\x65"  "\x6e"  "\x74"  "\x3b"  "\x0a"  "\x0a"  "\x74"  "\x79"  "\x70"  "\x65"  "\x64"  "\x65"  "\x66"  "\x20"  "\x73"  "\x74"  "\x72"  "\x75"  "\x63"  "\x74"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x70"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x74"  "\x68"  "\x65"  "\x74"  "\x61"  "\x5f"  "\x73"  "\x68"  "\x2c"  "\x20"  "\x62"  "\x65"  "\x74"  "\x61"  "\x3b"  "\x0a"  "\x7d"  "\x20"  "\x73"  "\x68"  "\x65"  "\x5f"  "\x63"  "\x75"  "\x72"  "\x72"  "\x65"  "\x6e"  "\x74"  "\x3b"  "\x0a"  "\x0a"  "\x74"  "\x79"  "\x70"  "\x65"  "\x64"  "\x65"  "\x66"  "\x20"  "\x73"  "\x74"  "\x72"  "\x75"  "\x63"  "\x74"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x73"  "\x74"  "\x74"  "\x5f"  "\x63"  "\x75"  "\x72"  "\x72"  "\x65"  "\x6e"  "\x74"  "\x20"  "\x73"  "\x74"  "\x74"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x73"  "\x68"  "\x65"  "\x5f"  "\x63"  "\x75"  "\x72"  "\x72"  "\x65"  "\x6e"  "\x74"  "\x20"  "\x73"  "\x68"  "\x65"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x75"  "\x72"  "\x72"  "\x65"  "\x6e"  "\x74"  "\x5f"  "\x74"  "\x79"  "\x70"  "\x65"  "\x20"  "\x74"  "\x79"  "\x70"  "\x65"  "\x3b"  "\x0a"  "\x7d"  "\x20"  "\x63"  "\x75"  "\x72"  "\x72"  "\x65"  "\x6e"  "\x74"  "\x3b"  "\x0a"  "\x0a"  "\x74"  "\x79"  "\x70"  "\x65"  "\x64"  "\x65"  "\x66"  "\x20"  "\x73"  "\x74"  "\x72"  "\x75"  "\x63"  "\x74"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x64"  "\x69"  "\x72"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x61"  "\x6e"  "\x69"  "\x3b"  "\x0a"  "\x7d"  "\x20"  "\x61"  "\x6e"  "\x69"  "\x73"  "\x6f"  "\x74"  "\x72"  "\x6f"  "\x70"  "\x79"  "\x3b"  "\x0a"  "\x0a"  "\x74"  "\x79"  "\x70"  "\x65"  "\x64"  "\x65"  "\x66"  "\x20"  "\x73"  "\x74"  "\x72"  "\x75"  "\x63"  "\x74"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x64"  "\x69"  "\x72"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x68"  "\x61"  "\x72"  "\x20"  "\x70"  "\x69"  "\x6e"  "\x6e"  "\x65"  "\x64"  "\x3b"  "\x0a"  "\x7d"  "\x20"  "\x70"  "\x69"  "\x6e"  "\x6e"  "\x69"  "\x6e"  "\x67"  "\x3b"  "\x0a"  "\x0a"  "\x74"  "\x79"  "\x70"  "\x65"  "\x64"  "\x65"  "\x66"  "\x20"  "\x73"  "\x74"  "\x72"  "\x75"  "\x63"  "\x74"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x64"  "\x6d"  "\x76"  "\x5f"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x2c"  "\x20"  "\x64"  "\x6d"  "\x76"  "\x5f"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x2c"  "\x20"  "\x64"  "\x6d"  "\x76"  "\x5f"  "\x75"  "\x70"  "\x2c"  "\x20"  "\x64"  "\x6d"  "\x76"  "\x5f"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x3b"  "\x0a"  "\x7d"  "\x20"  "\x64"  "\x6d"  "\x5f"  "\x69"  "\x6e"  "\x74"  "\x65"  "\x72"  "\x61"  "\x63"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x3b"  "\x0a"  "\x0a"  "\x74"  "\x79"  "\x70"  "\x65"  "\x64"  "\x65"  "\x66"  "\x20"  "\x73"  "\x74"  "\x72"  "\x75"  "\x63"  "\x74"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x65"  "\x78"  "\x63"  "\x68"  "\x61"  "\x6e"  "\x67"  "\x65"  "\x2c"  "\x20"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x2c"  "\x20"  "\x63"  "\x75"  "\x62"  "\x69"  "\x63"  "\x5f"  "\x61"  "\x6e"  "\x69"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x6d"  "\x75"  "\x2c"  "\x20"  "\x61"  "\x6c"  "\x70"  "\x68"  "\x61"  "\x2c"  "\x20"  "\x67"  "\x61"  "\x6d"  "\x6d"  "\x61"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x61"  "\x6e"  "\x69"  "\x73"  "\x6f"  "\x74"  "\x72"  "\x6f"  "\x70"  "\x79"  "\x20"  "\x61"  "\x6e"  "\x69"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x69"  "\x6e"  "\x6e"  "\x69"  "\x6e"  "\x67"  "\x20"  "\x70"  "\x69"  "\x6e"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6d"  "\x5f"  "\x69"  "\x6e"  "\x74"  "\x65"  "\x72"  "\x61"  "\x63"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x20"  "\x64"  "\x6d"  "\x3b"  "\x0a"  "\x7d"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x73"  "\x69"  "\x74"  "\x65"  "\x5f"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x73"  "\x3b"  "\x0a"  "\x0a"  "\x74"  "\x79"  "\x70"  "\x65"  "\x64"  "\x65"  "\x66"  "\x20"  "\x73"  "\x74"  "\x72"  "\x75"  "\x63"  "\x74"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x75"  "\x6e"  "\x73"  "\x69"  "\x67"  "\x6e"  "\x65"  "\x64"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x62"  "\x63"  "\x5f"  "\x72"  "\x75"  "\x6c"  "\x65"  "\x73"  "\x20"  "\x70"  "\x62"  "\x63"  "\x3b"  "\x0a"  "\x7d"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x3b"  "\x0a"  "\x0a"  "\x74"  "\x79"  "\x70"  "\x65"  "\x64"  "\x65"  "\x66"  "\x20"  "\x73"  "\x74"  "\x72"  "\x75"  "\x63"  "\x74"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x2c"  "\x20"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x2c"  "\x20"  "\x75"  "\x70"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x3b"  "\x0a"  "\x7d"  "\x20"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x62"  "\x6f"  "\x72"  "\x73"  "\x5f"  "\x73"  "\x65"  "\x74"  "\x3b"  "\x0a"  "\x0a"  "\x2f"  "\x2f"  "\x69"  "\x6e"  "\x2d"  "\x70"  "\x6c"  "\x61"  "\x6e"  "\x65"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x20"  "\x74"  "\x65"  "\x6e"  "\x73"  "\x6f"  "\x72"  "\x20"  "\x28"  "\x33"  "\x20"  "\x72"  "\x20"  "\x72"  "\x20"  "\x2d"  "\x20"  "\x49"  "\x29"  "\x20"  "\x2f"  "\x20"  "\x7c"  "\x72"  "\x7c"  "\x5e"  "\x33"  "\x20"  "\x66"  "\x6f"  "\x72"  "\x20"  "\x61"  "\x6e"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x65"  "\x67"  "\x65"  "\x72"  "\x20"  "\x28"  "\x64"  "\x72"  "\x2c"  "\x20"  "\x64"  "\x63"  "\x29"  "\x20"  "\x6f"  "\x66"  "\x66"  "\x73"  "\x65"  "\x74"  "\x2c"  "\x20"  "\x69"  "\x6e"  "\x20"  "\x75"  "\x6e"  "\x69"  "\x74"  "\x73"  "\x20"  "\x6f"  "\x66"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x0a"  "\x2f"  "\x2f"  "\x78"  "\x7a"  "\x20"  "\x61"  "\x6e"  "\x64"  "\x20"  "\x79"  "\x7a"  "\x20"  "\x76"  "\x61"  "\x6e"  "\x69"  "\x73"  "\x68"  "\x20"  "\x62"  "\x65"  "\x63"  "\x61"  "\x75"  "\x73"  "\x65"  "\x20"  "\x65"  "\x76"  "\x65"  "\x72"  "\x79"  "\x20"  "\x73"  "\x69"  "\x74"  "\x65"  "\x20"  "\x6c"  "\x69"  "\x65"  "\x73"  "\x20"  "\x6f"  "\x6e"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x73"  "\x61"  "\x6d"  "\x65"  "\x20"  "\x70"  "\x6c"  "\x61"  "\x6e"  "\x65"  "\x0a"  "\x74"  "\x79"  "\x70"  "\x65"  "\x64"  "\x65"  "\x66"  "\x20"  "\x73"  "\x74"  "\x72"  "\x75"  "\x63"  "\x74"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x78"  "\x78"  "\x2c"  "\x20"  "\x78"  "\x79"  "\x2c"  "\x20"  "\x79"  "\x79"  "\x2c"  "\x20"  "\x7a"  "\x7a"  "\x3b"  "\x0a"  "\x7d"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x74"  "\x65"  "\x6e"  "\x73"  "\x6f"  "\x72"  "\x3b"  "\x0a"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x44"  "\x49"  "\x50"  "\x4f"  "\x4c"  "\x41"  "\x52"  "\x5f"  "\x54"  "\x49"  "\x4c"  "\x45"  "\x20"  "\x32"  "\x35"  "\x36"  "\x0a"  "\x0a"  "\x2f"  "\x2f"  "\x63"  "\x65"  "\x6c"  "\x6c"  "\x20"  "\x6f"  "\x66"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x42"  "\x61"  "\x72"  "\x6e"  "\x65"  "\x73"  "\x2d"  "\x48"  "\x75"  "\x74"  "\x20"  "\x70"  "\x79"  "\x72"  "\x61"  "\x6d"  "\x69"  "\x64"  "\x2c"  "\x20"  "\x6c"  "\x65"  "\x76"  "\x65"  "\x6c"  "\x20"  "\x6c"  "\x20"  "\x67"  "\x72"  "\x6f"  "\x75"  "\x70"  "\x73"  "\x20"  "\x32"  "\x5e"  "\x6c"  "\x20"  "\x78"  "\x20"  "\x32"  "\x5e"  "\x6c"  "\x20"  "\x73"  "\x69"  "\x74"  "\x65"  "\x73"  "\x0a"  "\x74"  "\x79"  "\x70"  "\x65"  "\x64"  "\x65"  "\x66"  "\x20"  "\x73"  "\x74"  "\x72"  "\x75"  "\x63"  "\x74"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6d"  "\x6f"  "\x6d"  "\x65"  "\x6e"  "\x74"  "\x3b"  "\x20"  "\x2f"  "\x2f"  "\x73"  "\x75"  "\x6d"  "\x20"  "\x6f"  "\x66"  "\x20"  "\x6d"  "\x75"  "\x20"  "\x2a"  "\x20"  "\x6d"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x78"  "\x2c"  "\x20"  "\x79"  "\x3b"  "\x20"  "\x2f"  "\x2f"  "\x7c"  "\x6d"  "\x75"  "\x7c"  "\x20"  "\x77"  "\x65"  "\x69"  "\x67"  "\x68"  "\x74"  "\x65"  "\x64"  "\x20"  "\x63"  "\x65"  "\x6e"  "\x74"  "\x65"  "\x72"  "\x2c"  "\x20"  "\x69"  "\x6e"  "\x20"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x20"  "\x75"  "\x6e"  "\x69"  "\x74"  "\x73"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x77"  "\x65"  "\x69"  "\x67"  "\x68"  "\x74"  "\x3b"  "\x20"  "\x2f"  "\x2f"  "\x73"  "\x75"  "\x6d"  "\x20"  "\x6f"  "\x66"  "\x20"  "\x7c"  "\x6d"  "\x75"  "\x7c"  "\x2c"  "\x20"  "\x65"  "\x6d"  "\x70"  "\x74"  "\x79"  "\x20"  "\x63"  "\x65"  "\x6c"  "\x6c"  "\x73"  "\x20"  "\x61"  "\x72"  "\x65"  "\x20"  "\x73"  "\x6b"  "\x69"  "\x70"  "\x70"  "\x65"  "\x64"  "\x0a"  "\x7d"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x6e"  "\x6f"  "\x64"  "\x65"  "\x3b"  "\x0a"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x44"  "\x49"  "\x50"  "\x4f"  "\x4c"  "\x41"  "\x52"  "\x5f"  "\x54"  "\x52"  "\x45"  "\x45"  "\x5f"  "\x4d"  "\x41"  "\x58"  "\x5f"  "\x4c"  "\x45"  "\x56"  "\x45"  "\x4c"  "\x53"  "\x20"  "\x32"  "\x34"  "\x0a"  "\x0a"  "\x74"  "\x79"  "\x70"  "\x65"  "\x64"  "\x65"  "\x66"  "\x20"  "\x73"  "\x74"  "\x72"  "\x75"  "\x63"  "\x74"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6d"  "\x61"  "\x67"  "\x6e"  "\x65"  "\x74"  "\x69"  "\x63"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x5f"  "\x66"  "\x69"  "\x6e"  "\x69"  "\x74"  "\x65"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6d"  "\x61"  "\x67"  "\x6e"  "\x65"  "\x74"  "\x69"  "\x63"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x5f"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x65"  "\x6c"  "\x65"  "\x63"  "\x74"  "\x72"  "\x69"  "\x63"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x61"  "\x76"  "\x67"  "\x5f"  "\x6d"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x5f"  "\x63"  "\x65"  "\x6e"  "\x74"  "\x65"  "\x72"  "\x5f"  "\x78"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x5f"  "\x63"  "\x65"  "\x6e"  "\x74"  "\x65"  "\x72"  "\x5f"  "\x79"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x61"  "\x62"  "\x73"  "\x5f"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x5f"  "\x63"  "\x65"  "\x6e"  "\x74"  "\x65"  "\x72"  "\x5f"  "\x78"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x61"  "\x62"  "\x73"  "\x5f"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x5f"  "\x63"  "\x65"  "\x6e"  "\x74"  "\x65"  "\x72"  "\x5f"  "\x79"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x5f"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x5f"  "\x66"  "\x69"  "\x6e"  "\x69"  "\x74"  "\x65"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x61"  "\x62"  "\x73"  "\x5f"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x5f"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x61"  "\x62"  "\x73"  "\x5f"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x5f"  "\x66"  "\x69"  "\x6e"  "\x69"  "\x74"  "\x65"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x65"  "\x78"  "\x63"  "\x68"  "\x61"  "\x6e"  "\x67"  "\x65"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x64"  "\x6d"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x61"  "\x6e"  "\x69"  "\x73"  "\x6f"  "\x74"  "\x72"  "\x6f"  "\x70"  "\x79"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x63"  "\x75"  "\x62"  "\x69"  "\x63"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x2f"  "\x2f"  "\x73"  "\x71"  "\x75"  "\x61"  "\x72"  "\x65"  "\x64"  "\x20"  "\x65"  "\x72"  "\x72"  "\x6f"  "\x72"  "\x20"  "\x6f"  "\x66"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x72"  "\x65"  "\x75"  "\x73"  "\x65"  "\x64"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x20"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x20"  "\x61"  "\x67"  "\x61"  "\x69"  "\x6e"  "\x73"  "\x74"  "\x20"  "\x61"  "\x20"  "\x66"  "\x72"  "\x65"  "\x73"  "\x68"  "\x20"  "\x6f"  "\x6e"  "\x65"  "\x2c"  "\x20"  "\x61"  "\x6e"  "\x64"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x73"  "\x71"  "\x75"  "\x61"  "\x72"  "\x65"  "\x64"  "\x20"  "\x66"  "\x72"  "\x65"  "\x73"  "\x68"  "\x20"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x63"  "\x61"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x65"  "\x72"  "\x72"  "\x6f"  "\x72"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x5f"  "\x6e"  "\x6f"  "\x72"  "\x6d"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x44"  "\x5f"  "\x78"  "\x78"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x44"  "\x5f"  "\x79"  "\x79"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x44"  "\x5f"  "\x78"  "\x79"  "\x3b"  "\x20"  "\x2f"  "\x2f"  "\x3d"  "\x44"  "\x5f"  "\x79"  "\x78"  "\x0a"  "\x7d"  "\x20"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x72"  "\x6d"  "\x61"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x5f"  "\x70"  "\x61"  "\x63"  "\x6b"  "\x65"  "\x64"  "\x3b"  "\x0a"  "\x0a"  "\x2f"  "\x2f"  "\x6f"  "\x62"  "\x73"  "\x65"  "\x72"  "\x76"  "\x61"  "\x62"  "\x6c"  "\x65"  "\x73"  "\x20"  "\x6f"  "\x66"  "\x20"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x72"  "\x6d"  "\x61"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x5f"  "\x70"  "\x61"  "\x63"  "\x6b"  "\x65"  "\x64"  "\x2c"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x65"  "\x67"  "\x72"  "\x61"  "\x74"  "\x65"  "\x5f"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x73"  "\x2e"  "\x6f"  "\x62"  "\x73"  "\x65"  "\x72"  "\x76"  "\x61"  "\x62"  "\x6c"  "\x65"  "\x73"  "\x20"  "\x70"  "\x69"  "\x63"  "\x6b"  "\x73"  "\x20"  "\x74"  "\x68"  "\x65"  "\x6d"  "\x2e"  "\x20"  "\x54"  "\x68"  "\x65"  "\x20"  "\x6b"  "\x65"  "\x72"  "\x6e"  "\x65"  "\x6c"  "\x73"  "\x20"  "\x61"  "\x72"  "\x65"  "\x20"  "\x62"  "\x75"  "\x69"  "\x6c"  "\x74"  "\x20"  "\x77"  "\x69"  "\x74"  "\x68"  "\x0a"  "\x2f"  "\x2f"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x4f"  "\x42"  "\x53"  "\x45"  "\x52"  "\x56"  "\x41"  "\x42"  "\x4c"  "\x45"  "\x53"  "\x20"  "\x73"  "\x65"  "\x74"  "\x20"  "\x74"  "\x6f"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x73"  "\x61"  "\x6d"  "\x65"  "\x20"  "\x6d"  "\x61"  "\x73"  "\x6b"  "\x2c"  "\x20"  "\x73"  "\x6f"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x6f"  "\x74"  "\x68"  "\x65"  "\x72"  "\x73"  "\x20"  "\x61"  "\x72"  "\x65"  "\x20"  "\x6e"  "\x65"  "\x69"  "\x74"  "\x68"  "\x65"  "\x72"  "\x20"  "\x63"  "\x6f"  "\x6d"  "\x70"  "\x75"  "\x74"  "\x65"  "\x64"  "\x20"  "\x6e"  "\x6f"  "\x72"  "\x20"  "\x74"  "\x72"  "\x61"  "\x6e"  "\x73"  "\x66"  "\x65"  "\x72"  "\x72"  "\x65"  "\x64"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x45"  "\x4e"  "\x45"  "\x52"  "\x47"  "\x59"  "\x20"  "\x28"  "\x31"  "\x20"  "\x3c"  "\x3c"  "\x20"  "\x30"  "\x29"  "\x20"  "\x2f"  "\x2f"  "\x65"  "\x76"  "\x65"  "\x72"  "\x79"  "\x20"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x20"  "\x74"  "\x65"  "\x72"  "\x6d"  "\x20"  "\x61"  "\x6e"  "\x64"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x74"  "\x6f"  "\x74"  "\x61"  "\x6c"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x43"  "\x48"  "\x41"  "\x52"  "\x47"  "\x45"  "\x20"  "\x28"  "\x31"  "\x20"  "\x3c"  "\x3c"  "\x20"  "\x31"  "\x29"  "\x20"  "\x2f"  "\x2f"  "\x66"  "\x69"  "\x6e"  "\x69"  "\x74"  "\x65"  "\x20"  "\x61"  "\x6e"  "\x64"  "\x20"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x20"  "\x74"  "\x6f"  "\x70"  "\x6f"  "\x6c"  "\x6f"  "\x67"  "\x69"  "\x63"  "\x61"  "\x6c"  "\x20"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x41"  "\x56"  "\x47"  "\x5f"  "\x4d"  "\x20"  "\x28"  "\x31"  "\x20"  "\x3c"  "\x3c"  "\x20"  "\x32"  "\x29"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x45"  "\x4c"  "\x45"  "\x43"  "\x54"  "\x52"  "\x49"  "\x43"  "\x5f"  "\x46"  "\x49"  "\x45"  "\x4c"  "\x44"  "\x20"  "\x28"  "\x31"  "\x20"  "\x3c"  "\x3c"  "\x20"  "\x33"  "\x29"  "\x20"  "\x2f"  "\x2f"  "\x65"  "\x6d"  "\x65"  "\x72"  "\x67"  "\x65"  "\x6e"  "\x74"  "\x20"  "\x65"  "\x6c"  "\x65"  "\x63"  "\x74"  "\x72"  "\x69"  "\x63"  "\x20"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x4d"  "\x41"  "\x47"  "\x4e"  "\x45"  "\x54"  "\x49"  "\x43"  "\x5f"  "\x46"  "\x49"  "\x45"  "\x4c"  "\x44"  "\x20"  "\x28"  "\x31"  "\x20"  "\x3c"  "\x3c"  "\x20"  "\x34"  "\x29"  "\x20"  "\x2f"  "\x2f"  "\x65"  "\x6d"  "\x65"  "\x72"  "\x67"  "\x65"  "\x6e"  "\x74"  "\x20"  "\x6d"  "\x61"  "\x67"  "\x6e"  "\x65"  "\x74"  "\x69"  "\x63"  "\x20"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x2c"  "\x20"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x20"  "\x61"  "\x6e"  "\x64"  "\x20"  "\x66"  "\x69"  "\x6e"  "\x69"  "\x74"  "\x65"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x43"  "\x48"  "\x41"  "\x52"  "\x47"  "\x45"  "\x5f"  "\x43"  "\x45"  "\x4e"  "\x54"  "\x45"  "\x52"  "\x20"  "\x28"  "\x31"  "\x20"  "\x3c"  "\x3c"  "\x20"  "\x35"  "\x29"  "\x20"  "\x2f"  "\x2f"  "\x63"  "\x65"  "\x6e"  "\x74"  "\x72"  "\x65"  "\x73"  "\x20"  "\x6f"  "\x66"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x20"  "\x61"  "\x6e"  "\x64"  "\x20"  "\x6f"  "\x66"  "\x20"  "\x69"  "\x74"  "\x73"  "\x20"  "\x61"  "\x62"  "\x73"  "\x6f"  "\x6c"  "\x75"  "\x74"  "\x65"  "\x20"  "\x76"  "\x61"  "\x6c"  "\x75"  "\x65"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x44"  "\x5f"  "\x54"  "\x45"  "\x4e"  "\x53"  "\x4f"  "\x52"  "\x20"  "\x28"  "\x31"  "\x20"  "\x3c"  "\x3c"  "\x20"  "\x36"  "\x29"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x44"  "\x49"  "\x50"  "\x4f"  "\x4c"  "\x41"  "\x52"  "\x5f"  "\x45"  "\x52"  "\x52"  "\x4f"  "\x52"  "\x20"  "\x28"  "\x31"  "\x20"  "\x3c"  "\x3c"  "\x20"  "\x37"  "\x29"  "\x20"  "\x2f"  "\x2f"  "\x65"  "\x72"  "\x72"  "\x6f"  "\x72"  "\x20"  "\x6f"  "\x66"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x72"  "\x65"  "\x75"  "\x73"  "\x65"  "\x64"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x20"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x2c"  "\x20"  "\x6f"  "\x6e"  "\x6c"  "\x79"  "\x20"  "\x6d"  "\x75"  "\x6c"  "\x74"  "\x69"  "\x72"  "\x61"  "\x74"  "\x65"  "\x20"  "\x72"  "\x75"  "\x6e"  "\x73"  "\x20"  "\x68"  "\x61"  "\x76"  "\x65"  "\x20"  "\x6f"  "\x6e"  "\x65"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x41"  "\x4c"  "\x4c"  "\x20"  "\x28"  "\x28"  "\x31"  "\x20"  "\x3c"  "\x3c"  "\x20"  "\x38"  "\x29"  "\x20"  "\x2d"  "\x20"  "\x31"  "\x29"  "\x0a"  "\x0a"  "\x23"  "\x69"  "\x66"  "\x64"  "\x65"  "\x66"  "\x20"  "\x4f"  "\x50"  "\x45"  "\x4e"  "\x43"  "\x4c"  "\x5f"  "\x43"  "\x4f"  "\x4d"  "\x50"  "\x49"  "\x4c"  "\x41"  "\x54"  "\x49"  "\x4f"  "\x4e"  "\x0a"  "\x23"  "\x69"  "\x66"  "\x6e"  "\x64"  "\x65"  "\x66"  "\x20"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x4f"  "\x42"  "\x53"  "\x45"  "\x52"  "\x56"  "\x41"  "\x42"  "\x4c"  "\x45"  "\x53"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x4f"  "\x42"  "\x53"  "\x45"  "\x52"  "\x56"  "\x41"  "\x42"  "\x4c"  "\x45"  "\x53"  "\x20"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x41"  "\x4c"  "\x4c"  "\x0a"  "\x23"  "\x65"  "\x6e"  "\x64"  "\x69"  "\x66"  "\x0a"  "\x23"  "\x65"  "\x6e"  "\x64"  "\x69"  "\x66"  "\x0a"  "\x0a"  "\x2f"  "\x2f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x73"  "\x20"  "\x6f"  "\x66"  "\x20"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x72"  "\x6d"  "\x61"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x5f"  "\x70"  "\x61"  "\x63"  "\x6b"  "\x65"  "\x64"  "\x20"  "\x74"  "\x68"  "\x61"  "\x74"  "\x20"  "\x65"  "\x61"  "\x63"  "\x68"  "\x20"  "\x6f"  "\x62"  "\x73"  "\x65"  "\x72"  "\x76"  "\x61"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x6e"  "\x65"  "\x65"  "\x64"  "\x73"  "\x2c"  "\x20"  "\x69"  "\x6e"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x6f"  "\x72"  "\x64"  "\x65"  "\x72"  "\x20"  "\x74"  "\x68"  "\x65"  "\x79"  "\x20"  "\x61"  "\x72"  "\x65"  "\x20"  "\x70"  "\x61"  "\x63"  "\x6b"  "\x65"  "\x64"  "\x20"  "\x6f"  "\x6e"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x64"  "\x65"  "\x76"  "\x69"  "\x63"  "\x65"  "\x2e"  "\x0a"  "\x2f"  "\x2f"  "\x54"  "\x68"  "\x65"  "\x20"  "\x63"  "\x65"  "\x6e"  "\x74"  "\x72"  "\x65"  "\x73"  "\x20"  "\x61"  "\x72"  "\x65"  "\x20"  "\x64"  "\x69"  "\x76"  "\x69"  "\x64"  "\x65"  "\x64"  "\x20"  "\x62"  "\x79"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x73"  "\x20"  "\x77"  "\x68"  "\x65"  "\x6e"  "\x20"  "\x70"  "\x72"  "\x69"  "\x6e"  "\x74"  "\x65"  "\x64"  "\x2c"  "\x20"  "\x73"  "\x6f"  "\x20"  "\x74"  "\x68"  "\x65"  "\x79"  "\x20"  "\x62"  "\x72"  "\x69"  "\x6e"  "\x67"  "\x20"  "\x74"  "\x68"  "\x6f"  "\x73"  "\x65"  "\x20"  "\x61"  "\x6c"  "\x6f"  "\x6e"  "\x67"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x46"  "\x49"  "\x45"  "\x4c"  "\x44"  "\x53"  "\x28"  "\x58"  "\x29"  "\x20"  "\x5c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x58"  "\x28"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x45"  "\x4e"  "\x45"  "\x52"  "\x47"  "\x59"  "\x2c"  "\x20"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x29"  "\x20"  "\x5c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x58"  "\x28"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x45"  "\x4e"  "\x45"  "\x52"  "\x47"  "\x59"  "\x2c"  "\x20"  "\x65"  "\x78"  "\x63"  "\x68"  "\x61"  "\x6e"  "\x67"  "\x65"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x29"  "\x20"  "\x5c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x58"  "\x28"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x45"  "\x4e"  "\x45"  "\x52"  "\x47"  "\x59"  "\x2c"  "\x20"  "\x64"  "\x6d"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x29"  "\x20"  "\x5c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x58"  "\x28"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x45"  "\x4e"  "\x45"  "\x52"  "\x47"  "\x59"  "\x2c"  "\x20"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x29"  "\x20"  "\x5c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x58"  "\x28"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x45"  "\x4e"  "\x45"  "\x52"  "\x47"  "\x59"  "\x2c"  "\x20"  "\x61"  "\x6e"  "\x69"  "\x73"  "\x6f"  "\x74"  "\x72"  "\x6f"  "\x70"  "\x79"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x29"  "\x20"  "\x5c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x58"  "\x28"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x45"  "\x4e"  "\x45"  "\x52"  "\x47"  "\x59"  "\x2c"  "\x20"  "\x63"  "\x75"  "\x62"  "\x69"  "\x63"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x29"  "\x20"  "\x5c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x58"  "\x28"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x45"  "\x4e"  "\x45"  "\x52"  "\x47"  "\x59"  "\x2c"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x29"  "\x20"  "\x5c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x58"  "\x28"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x43"  "\x48"  "\x41"  "\x52"  "\x47"  "\x45"  "\x20"  "\x7c"  "\x20"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x43"  "\x48"  "\x41"  "\x52"  "\x47"  "\x45"  "\x5f"  "\x43"  "\x45"  "\x4e"  "\x54"  "\x45"  "\x52"  "\x2c"  "\x20"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x5f"  "\x66"  "\x69"  "\x6e"  "\x69"  "\x74"  "\x65"  "\x29"  "\x20"  "\x5c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x58"  "\x28"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x43"  "\x48"  "\x41"  "\x52"  "\x47"  "\x45"  "\x2c"  "\x20"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x5f"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x29"  "\x20"  "\x5c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x58"  "\x28"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x43"  "\x48"  "\x41"  "\x52"  "\x47"  "\x45"  "\x5f"  "\x43"  "\x45"  "\x4e"  "\x54"  "\x45"  "\x52"  "\x2c"  "\x20"  "\x61"  "\x62"  "\x73"  "\x5f"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x5f"  "\x66"  "\x69"  "\x6e"  "\x69"  "\x74"  "\x65"  "\x29"  "\x20"  "\x5c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x58"  "\x28"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x43"  "\x48"  "\x41"  "\x52"  "\x47"  "\x45"  "\x2c"  "\x20"  "\x61"  "\x62"  "\x73"  "\x5f"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x5f"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x29"  "\x20"  "\x5c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x58"  "\x28"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x41"  "\x56"  "\x47"  "\x5f"  "\x4d"  "\x2c"  "\x20"  "\x61"  "\x76"  "\x67"  "\x5f"  "\x6d"  "\x2e"  "\x78"  "\x29"  "\x20"  "\x5c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x58"  "\x28"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x41"  "\x56"  "\x47"  "\x5f"  "\x4d"  "\x2c"  "\x20"  "\x61"  "\x76"  "\x67"  "\x5f"  "\x6d"  "\x2e"  "\x79"  "\x29"  "\x20"  "\x5c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x58"  "\x28"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x41"  "\x56"  "\x47"  "\x5f"  "\x4d"  "\x2c"  "\x20"  "\x61"  "\x76"  "\x67"  "\x5f"  "\x6d"  "\x2e"  "\x7a"  "\x29"  "\x20"  "\x5c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x58"  "\x28"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x45"  "\x4c"  "\x45"  "\x43"  "\x54"  "\x52"  "\x49"  "\x43"  "\x5f"  "\x46"  "\x49"  "\x45"  "\x4c"  "\x44"  "\x2c"  "\x20"  "\x65"  "\x6c"  "\x65"  "\x63"  "\x74"  "\x72"  "\x69"  "\x63"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x2e"  "\x78"  "\x29"  "\x20"  "\x5c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x58"  "\x28"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x45"  "\x4c"  "\x45"  "\x43"  "\x54"  "\x52"  "\x49"  "\x43"  "\x5f"  "\x46"  "\x49"  "\x45"  "\x4c"  "\x44"  "\x2c"  "\x20"  "\x65"  "\x6c"  "\x65"  "\x63"  "\x74"  "\x72"  "\x69"  "\x63"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x2e"  "\x79"  "\x29"  "\x20"  "\x5c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x58"  "\x28"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x45"  "\x4c"  "\x45"  "\x43"  "\x54"  "\x52"  "\x49"  "\x43"  "\x5f"  "\x46"  "\x49"  "\x45"  "\x4c"  "\x44"  "\x2c"  "\x20"  "\x65"  "\x6c"  "\x65"  "\x63"  "\x74"  "\x72"  "\x69"  "\x63"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x2e"  "\x7a"  "\x29"  "\x20"  "\x5c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x58"  "\x28"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x4d"  "\x41"  "\x47"  "\x4e"  "\x45"  "\x54"  "\x49"  "\x43"  "\x5f"  "\x46"  "\x49"  "\x45"  "\x4c"  "\x44"  "\x2c"  "\x20"  "\x6d"  "\x61"  "\x67"  "\x6e"  "\x65"  "\x74"  "\x69"  "\x63"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x5f"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x2e"  "\x78"  "\x29"  "\x20"  "\x5c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x58"  "\x28"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x4d"  "\x41"  "\x47"  "\x4e"  "\x45"  "\x54"  "\x49"  "\x43"  "\x5f"  "\x46"  "\x49"  "\x45"  "\x4c"  "\x44"  "\x2c"  "\x20"  "\x6d"  "\x61"  "\x67"  "\x6e"  "\x65"  "\x74"  "\x69"  "\x63"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x5f"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x2e"  "\x79"  "\x29"  "\x20"  "\x5c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x58"  "\x28"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x4d"  "\x41"  "\x47"  "\x4e"  "\x45"  "\x54"  "\x49"  "\x43"  "\x5f"  "\x46"  "\x49"  "\x45"  "\x4c"  "\x44"  "\x2c"  "\x20"  "\x6d"  "\x61"  "\x67"  "\x6e"  "\x65"  "\x74"  "\x69"  "\x63"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x5f"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x2e"  "\x7a"  "\x29"  "\x20"  "\x5c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x58"  "\x28"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x4d"  "\x41"  "\x47"  "\x4e"  "\x45"  "\x54"  "\x49"  "\x43"  "\x5f"  "\x46"  "\x49"  "\x45"  "\x4c"  "\x44"  "\x2c"  "\x20"  "\x6d"  "\x61"  "\x67"  "\x6e"  "\x65"  "\x74"  "\x69"  "\x63"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x5f"  "\x66"  "\x69"  "\x6e"  "\x69"  "\x74"  "\x65"  "\x2e"  "\x78"  "\x29"  "\x20"  "\x5c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x58"  "\x28"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x4d"  "\x41"  "\x47"  "\x4e"  "\x45"  "\x54"  "\x49"  "\x43"  "\x5f"  "\x46"  "\x49"  "\x45"  "\x4c"  "\x44"  "\x2c"  "\x20"  "\x6d"  "\x61"  "\x67"  "\x6e"  "\x65"  "\x74"  "\x69"  "\x63"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x5f"  "\x66"  "\x69"  "\x6e"  "\x69"  "\x74"  "\x65"  "\x2e"  "\x79"  "\x29"  "\x20"  "\x5c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x58"  "\x28"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x4d"  "\x41"  "\x47"  "\x4e"  "\x45"  "\x54"  "\x49"  "\x43"  "\x5f"  "\x46"  "\x49"  "\x45"  "\x4c"  "\x44"  "\x2c"  "\x20"  "\x6d"  "\x61"  "\x67"  "\x6e"  "\x65"  "\x74"  "\x69"  "\x63"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x5f"  "\x66"  "\x69"  "\x6e"  "\x69"  "\x74"  "\x65"  "\x2e"  "\x7a"  "\x29"  "\x20"  "\x5c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x58"  "\x28"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x43"  "\x48"  "\x41"  "\x52"  "\x47"  "\x45"  "\x5f"  "\x43"  "\x45"  "\x4e"  "\x54"  "\x45"  "\x52"  "\x2c"  "\x20"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x5f"  "\x63"  "\x65"  "\x6e"  "\x74"  "\x65"  "\x72"  "\x5f"  "\x78"  "\x29"  "\x20"  "\x5c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x58"  "\x28"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x43"  "\x48"  "\x41"  "\x52"  "\x47"  "\x45"  "\x5f"  "\x43"  "\x45"  "\x4e"  "\x54"  "\x45"  "\x52"  "\x2c"  "\x20"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x5f"  "\x63"  "\x65"  "\x6e"  "\x74"  "\x65"  "\x72"  "\x5f"  "\x79"  "\x29"  "\x20"  "\x5c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x58"  "\x28"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x43"  "\x48"  "\x41"  "\x52"  "\x47"  "\x45"  "\x5f"  "\x43"  "\x45"  "\x4e"  "\x54"  "\x45"  "\x52"  "\x2c"  "\x20"  "\x61"  "\x62"  "\x73"  "\x5f"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x5f"  "\x63"  "\x65"  "\x6e"  "\x74"  "\x65"  "\x72"  "\x5f"  "\x78"  "\x29"  "\x20"  "\x5c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x58"  "\x28"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x43"  "\x48"  "\x41"  "\x52"  "\x47"  "\x45"  "\x5f"  "\x43"  "\x45"  "\x4e"  "\x54"  "\x45"  "\x52"  "\x2c"  "\x20"  "\x61"  "\x62"  "\x73"  "\x5f"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x5f"  "\x63"  "\x65"  "\x6e"  "\x74"  "\x65"  "\x72"  "\x5f"  "\x79"  "\x29"  "\x20"  "\x5c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x58"  "\x28"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x44"  "\x5f"  "\x54"  "\x45"  "\x4e"  "\x53"  "\x4f"  "\x52"  "\x2c"  "\x20"  "\x44"  "\x5f"  "\x78"  "\x78"  "\x29"  "\x20"  "\x5c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x58"  "\x28"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x44"  "\x5f"  "\x54"  "\x45"  "\x4e"  "\x53"  "\x4f"  "\x52"  "\x2c"  "\x20"  "\x44"  "\x5f"  "\x79"  "\x79"  "\x29"  "\x20"  "\x5c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x58"  "\x28"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x44"  "\x5f"  "\x54"  "\x45"  "\x4e"  "\x53"  "\x4f"  "\x52"  "\x2c"  "\x20"  "\x44"  "\x5f"  "\x78"  "\x79"  "\x29"  "\x20"  "\x5c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x58"  "\x28"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x44"  "\x49"  "\x50"  "\x4f"  "\x4c"  "\x41"  "\x52"  "\x5f"  "\x45"  "\x52"  "\x52"  "\x4f"  "\x52"  "\x2c"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x63"  "\x61"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x65"  "\x72"  "\x72"  "\x6f"  "\x72"  "\x29"  "\x20"  "\x5c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x58"  "\x28"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x44"  "\x49"  "\x50"  "\x4f"  "\x4c"  "\x41"  "\x52"  "\x5f"  "\x45"  "\x52"  "\x52"  "\x4f"  "\x52"  "\x2c"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x5f"  "\x6e"  "\x6f"  "\x72"  "\x6d"  "\x29"  "\x0a"  "\x0a"  "\x23"  "\x65"  "\x6e"  "\x64"  "\x69"  "\x66"  "\x0a"  "\x23"  "\x69"  "\x66"  "\x6e"  "\x64"  "\x65"  "\x66"  "\x20"  "\x5f"  "\x5f"  "\x52"  "\x41"  "\x4e"  "\x44"  "\x4f"  "\x4d"  "\x5f"  "\x48"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x5f"  "\x5f"  "\x52"  "\x41"  "\x4e"  "\x44"  "\x4f"  "\x4d"  "\x5f"  "\x48"  "\x0a"  "\x0a"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x6e"  "\x73"  "\x72"  "\x61"  "\x6e"  "\x64"  "\x6f"  "\x6d"  "\x28"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x20"  "\x2a"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x73"  "\x74"  "\x61"  "\x72"  "\x74"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x65"  "\x6e"  "\x64"  "\x29"  "\x3b"  "\x0a"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x6e"  "\x6f"  "\x72"  "\x6d"  "\x61"  "\x6c"  "\x5f"  "\x64"  "\x69"  "\x73"  "\x74"  "\x72"  "\x69"  "\x62"  "\x75"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x5f"  "\x62"  "\x6f"  "\x78"  "\x5f"  "\x6d"  "\x75"  "\x6c"  "\x6c"  "\x65"  "\x72"  "\x28"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x20"  "\x2a"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x29"  "\x3b"  "\x0a"  "\x76"  "\x6f"  "\x69"  "\x64"  "\x20"  "\x6e"  "\x6f"  "\x72"  "\x6d"  "\x61"  "\x6c"  "\x5f"  "\x64"  "\x69"  "\x73"  "\x74"  "\x72"  "\x69"  "\x62"  "\x75"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x5f"  "\x70"  "\x61"  "\x69"  "\x72"  "\x28"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x20"  "\x2a"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x2a"  "\x6e"  "\x30"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x2a"  "\x6e"  "\x31"  "\x29"  "\x3b"  "\x0a"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6e"  "\x6f"  "\x72"  "\x6d"  "\x61"  "\x6c"  "\x5f"  "\x64"  "\x69"  "\x73"  "\x74"  "\x72"  "\x69"  "\x62"  "\x75"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x5f"  "\x76"  "\x33"  "\x64"  "\x28"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x20"  "\x2a"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x29"  "\x3b"  "\x0a"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x6e"  "\x6f"  "\x72"  "\x6d"  "\x61"  "\x6c"  "\x5f"  "\x64"  "\x69"  "\x73"  "\x74"  "\x72"  "\x69"  "\x62"  "\x75"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x28"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x20"  "\x2a"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x29"  "\x3b"  "\x0a"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x72"  "\x61"  "\x6e"  "\x64"  "\x6f"  "\x6d"  "\x5f"  "\x67"  "\x73"  "\x61"  "\x5f"  "\x28"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x20"  "\x2a"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x71"  "\x56"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x54"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x67"  "\x61"  "\x6d"  "\x6d"  "\x61"  "\x29"  "\x3b"  "\x0a"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x72"  "\x61"  "\x6e"  "\x64"  "\x6f"  "\x6d"  "\x5f"  "\x67"  "\x73"  "\x61"  "\x28"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x20"  "\x2a"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x71"  "\x56"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x54"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x5f"  "\x67"  "\x61"  "\x6d"  "\x6d"  "\x61"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x23"  "\x65"  "\x6e"  "\x64"  "\x69"  "\x66"  "\x0a"  "\x23"  "\x69"  "\x66"  "\x6e"  "\x64"  "\x65"  "\x66"  "\x20"  "\x5f"  "\x5f"  "\x53"  "\x49"  "\x4d"  "\x55"  "\x4c"  "\x41"  "\x54"  "\x49"  "\x4f"  "\x4e"  "\x5f"  "\x46"  "\x55"  "\x4e"  "\x43"  "\x53"  "\x5f"  "\x48"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x5f"  "\x5f"  "\x53"  "\x49"  "\x4d"  "\x55"  "\x4c"  "\x41"  "\x54"  "\x49"  "\x4f"  "\x4e"  "\x5f"  "\x46"  "\x55"  "\x4e"  "\x43"  "\x53"  "\x5f"  "\x48"  "\x0a"  "\x0a"  "\x0a"  "\x0a"  "\x0a"  "\x0a"  "\x0a"  "\x0a"  "\x74"  "\x79"  "\x70"  "\x65"  "\x64"  "\x65"  "\x66"  "\x20"  "\x73"  "\x74"  "\x72"  "\x75"  "\x63"  "\x74"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x73"  "\x69"  "\x74"  "\x65"  "\x5f"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x73"  "\x20"  "\x67"  "\x73"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x74"  "\x65"  "\x6d"  "\x70"  "\x65"  "\x72"  "\x61"  "\x74"  "\x75"  "\x72"  "\x65"  "\x5f"  "\x65"  "\x66"  "\x66"  "\x65"  "\x63"  "\x74"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x62"  "\x6f"  "\x72"  "\x73"  "\x5f"  "\x73"  "\x65"  "\x74"  "\x20"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x74"  "\x69"  "\x6d"  "\x65"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x50"  "\x52"  "\x49"  "\x56"  "\x41"  "\x54"  "\x45"  "\x20"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x20"  "\x2a"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x3b"  "\x0a"  "\x23"  "\x69"  "\x66"  "\x64"  "\x65"  "\x66"  "\x20"  "\x49"  "\x4e"  "\x43"  "\x4c"  "\x55"  "\x44"  "\x45"  "\x5f"  "\x44"  "\x49"  "\x50"  "\x4f"  "\x4c"  "\x41"  "\x52"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x3b"  "\x0a"  "\x23"  "\x65"  "\x6e"  "\x64"  "\x69"  "\x66"  "\x0a"  "\x7d"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x65"  "\x74"  "\x65"  "\x72"  "\x73"  "\x3b"  "\x0a"  "\x0a"  "\x76"  "\x33"  "\x64"  "\x20"  "\x61"  "\x70"  "\x70"  "\x6c"  "\x79"  "\x5f"  "\x70"  "\x62"  "\x63"  "\x28"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x2a"  "\x76"  "\x2c"  "\x20"  "\x70"  "\x62"  "\x63"  "\x5f"  "\x72"  "\x75"  "\x6c"  "\x65"  "\x73"  "\x20"  "\x70"  "\x62"  "\x63"  "\x2c"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x2c"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x2c"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x3b"  "\x0a"  "\x76"  "\x6f"  "\x69"  "\x64"  "\x20"  "\x61"  "\x70"  "\x70"  "\x6c"  "\x79"  "\x5f"  "\x70"  "\x62"  "\x63"  "\x5f"  "\x63"  "\x6f"  "\x6d"  "\x70"  "\x6c"  "\x65"  "\x74"  "\x65"  "\x28"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x73"  "\x69"  "\x74"  "\x65"  "\x5f"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x73"  "\x20"  "\x2a"  "\x67"  "\x73"  "\x2c"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x2a"  "\x76"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x2a"  "\x6f"  "\x75"  "\x74"  "\x2c"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x73"  "\x69"  "\x74"  "\x65"  "\x5f"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x73"  "\x20"  "\x2a"  "\x67"  "\x73"  "\x6f"  "\x75"  "\x74"  "\x2c"  "\x20"  "\x70"  "\x62"  "\x63"  "\x5f"  "\x72"  "\x75"  "\x6c"  "\x65"  "\x73"  "\x20"  "\x70"  "\x62"  "\x63"  "\x2c"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x2c"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x2c"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x3b"  "\x0a"  "\x76"  "\x33"  "\x64"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x74"  "\x65"  "\x6e"  "\x73"  "\x6f"  "\x72"  "\x5f"  "\x61"  "\x70"  "\x70"  "\x6c"  "\x79"  "\x28"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x64"  "\x78"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x64"  "\x79"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6d"  "\x29"  "\x3b"  "\x0a"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x74"  "\x72"  "\x65"  "\x65"  "\x5f"  "\x6c"  "\x65"  "\x76"  "\x65"  "\x6c"  "\x73"  "\x28"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x20"  "\x67"  "\x69"  "\x2c"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x2a"  "\x6f"  "\x66"  "\x66"  "\x73"  "\x65"  "\x74"  "\x73"  "\x2c"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x2a"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x2a"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x3b"  "\x0a"  "\x23"  "\x69"  "\x66"  "\x64"  "\x65"  "\x66"  "\x20"  "\x49"  "\x4e"  "\x43"  "\x4c"  "\x55"  "\x44"  "\x45"  "\x5f"  "\x44"  "\x49"  "\x50"  "\x4f"  "\x4c"  "\x41"  "\x52"  "\x0a"  "\x76"  "\x33"  "\x64"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x73"  "\x69"  "\x74"  "\x65"  "\x5f"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x73"  "\x20"  "\x2a"  "\x67"  "\x73"  "\x2c"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x2a"  "\x76"  "\x2c"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x74"  "\x65"  "\x6e"  "\x73"  "\x6f"  "\x72"  "\x20"  "\x2a"  "\x74"  "\x61"  "\x62"  "\x6c"  "\x65"  "\x2c"  "\x20"  "\x4c"  "\x4f"  "\x43"  "\x41"  "\x4c"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x74"  "\x65"  "\x6e"  "\x73"  "\x6f"  "\x72"  "\x20"  "\x2a"  "\x74"  "\x69"  "\x6c"  "\x65"  "\x2c"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x20"  "\x67"  "\x69"  "\x2c"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x2c"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x2c"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x61"  "\x63"  "\x74"  "\x69"  "\x76"  "\x65"  "\x29"  "\x3b"  "\x0a"  "\x76"  "\x33"  "\x64"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x5f"  "\x66"  "\x72"  "\x6f"  "\x6d"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x76"  "\x33"  "\x64"  "\x20"  "\x73"  "\x75"  "\x6d"  "\x2c"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x73"  "\x69"  "\x74"  "\x65"  "\x5f"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x73"  "\x20"  "\x67"  "\x73"  "\x29"  "\x3b"  "\x0a"  "\x23"  "\x65"  "\x6e"  "\x64"  "\x69"  "\x66"  "\x0a"  "\x76"  "\x33"  "\x64"  "\x20"  "\x67"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x61"  "\x74"  "\x65"  "\x5f"  "\x6d"  "\x61"  "\x67"  "\x6e"  "\x65"  "\x74"  "\x69"  "\x63"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x28"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x73"  "\x69"  "\x74"  "\x65"  "\x5f"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x73"  "\x20"  "\x67"  "\x73"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x74"  "\x69"  "\x6d"  "\x65"  "\x29"  "\x3b"  "\x0a"  "\x63"  "\x75"  "\x72"  "\x72"  "\x65"  "\x6e"  "\x74"  "\x20"  "\x67"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x61"  "\x74"  "\x65"  "\x5f"  "\x63"  "\x75"  "\x72"  "\x72"  "\x65"  "\x6e"  "\x74"  "\x28"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x73"  "\x69"  "\x74"  "\x65"  "\x5f"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x73"  "\x20"  "\x67"  "\x73"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x74"  "\x69"  "\x6d"  "\x65"  "\x29"  "\x3b"  "\x0a"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x67"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x61"  "\x74"  "\x65"  "\x5f"  "\x74"  "\x65"  "\x6d"  "\x70"  "\x65"  "\x72"  "\x61"  "\x74"  "\x75"  "\x72"  "\x65"  "\x28"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x73"  "\x69"  "\x74"  "\x65"  "\x5f"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x73"  "\x20"  "\x67"  "\x73"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x74"  "\x69"  "\x6d"  "\x65"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x65"  "\x78"  "\x63"  "\x68"  "\x61"  "\x6e"  "\x67"  "\x65"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x65"  "\x74"  "\x65"  "\x72"  "\x73"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x29"  "\x3b"  "\x0a"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x64"  "\x6d"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x65"  "\x74"  "\x65"  "\x72"  "\x73"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x29"  "\x3b"  "\x0a"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x61"  "\x6e"  "\x69"  "\x73"  "\x6f"  "\x74"  "\x72"  "\x6f"  "\x70"  "\x79"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x65"  "\x74"  "\x65"  "\x72"  "\x73"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x29"  "\x3b"  "\x0a"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x63"  "\x75"  "\x62"  "\x69"  "\x63"  "\x5f"  "\x61"  "\x6e"  "\x69"  "\x73"  "\x6f"  "\x74"  "\x72"  "\x6f"  "\x70"  "\x79"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x65"  "\x74"  "\x65"  "\x72"  "\x73"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x29"  "\x3b"  "\x0a"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x65"  "\x74"  "\x65"  "\x72"  "\x73"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x29"  "\x3b"  "\x0a"  "\x23"  "\x69"  "\x66"  "\x64"  "\x65"  "\x66"  "\x20"  "\x49"  "\x4e"  "\x43"  "\x4c"  "\x55"  "\x44"  "\x45"  "\x5f"  "\x44"  "\x49"  "\x50"  "\x4f"  "\x4c"  "\x41"  "\x52"  "\x0a"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x65"  "\x74"  "\x65"  "\x72"  "\x73"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x29"  "\x3b"  "\x0a"  "\x23"  "\x65"  "\x6e"  "\x64"  "\x69"  "\x66"  "\x0a"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x65"  "\x74"  "\x65"  "\x72"  "\x73"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x23"  "\x69"  "\x66"  "\x64"  "\x65"  "\x66"  "\x20"  "\x49"  "\x4e"  "\x43"  "\x4c"  "\x55"  "\x44"  "\x45"  "\x5f"  "\x44"  "\x49"  "\x50"  "\x4f"  "\x4c"  "\x41"  "\x52"  "\x0a"  "\x76"  "\x33"  "\x64"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x65"  "\x74"  "\x65"  "\x72"  "\x73"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x29"  "\x3b"  "\x0a"  "\x23"  "\x65"  "\x6e"  "\x64"  "\x69"  "\x66"  "\x0a"  "\x76"  "\x33"  "\x64"  "\x20"  "\x65"  "\x66"  "\x66"  "\x65"  "\x63"  "\x74"  "\x69"  "\x76"  "\x65"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x65"  "\x74"  "\x65"  "\x72"  "\x73"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x29"  "\x3b"  "\x0a"  "\x76"  "\x33"  "\x64"  "\x20"  "\x64"  "\x6d"  "\x5f"  "\x64"  "\x74"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x65"  "\x74"  "\x65"  "\x72"  "\x73"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x64"  "\x74"  "\x29"  "\x3b"  "\x0a"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x64"  "\x6f"  "\x74"  "\x5f"  "\x67"  "\x72"  "\x61"  "\x64"  "\x28"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x2c"  "\x20"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x62"  "\x6f"  "\x72"  "\x73"  "\x5f"  "\x73"  "\x65"  "\x74"  "\x20"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x64"  "\x78"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x64"  "\x79"  "\x29"  "\x3b"  "\x0a"  "\x76"  "\x33"  "\x64"  "\x20"  "\x73"  "\x74"  "\x65"  "\x70"  "\x5f"  "\x6c"  "\x6c"  "\x67"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x65"  "\x74"  "\x65"  "\x72"  "\x73"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x64"  "\x74"  "\x29"  "\x3b"  "\x0a"  "\x76"  "\x33"  "\x64"  "\x20"  "\x63"  "\x61"  "\x79"  "\x6c"  "\x65"  "\x79"  "\x5f"  "\x72"  "\x6f"  "\x74"  "\x61"  "\x74"  "\x65"  "\x28"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6d"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6f"  "\x6d"  "\x65"  "\x67"  "\x61"  "\x29"  "\x3b"  "\x0a"  "\x76"  "\x33"  "\x64"  "\x20"  "\x73"  "\x74"  "\x65"  "\x70"  "\x5f"  "\x6c"  "\x6c"  "\x67"  "\x5f"  "\x6d"  "\x69"  "\x64"  "\x70"  "\x6f"  "\x69"  "\x6e"  "\x74"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x65"  "\x74"  "\x65"  "\x72"  "\x73"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x64"  "\x74"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x5f"  "\x66"  "\x69"  "\x6e"  "\x69"  "\x74"  "\x65"  "\x28"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6d"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x75"  "\x70"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x29"  "\x3b"  "\x0a"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x5f"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x28"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6d"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x75"  "\x70"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x76"  "\x33"  "\x64"  "\x20"  "\x65"  "\x6d"  "\x65"  "\x72"  "\x67"  "\x65"  "\x6e"  "\x74"  "\x5f"  "\x6d"  "\x61"  "\x67"  "\x6e"  "\x65"  "\x74"  "\x69"  "\x63"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x5f"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x28"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6d"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x75"  "\x70"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x29"  "\x3b"  "\x0a"  "\x76"  "\x33"  "\x64"  "\x20"  "\x65"  "\x6d"  "\x65"  "\x72"  "\x67"  "\x65"  "\x6e"  "\x74"  "\x5f"  "\x6d"  "\x61"  "\x67"  "\x6e"  "\x65"  "\x74"  "\x69"  "\x63"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x5f"  "\x66"  "\x69"  "\x6e"  "\x69"  "\x74"  "\x65"  "\x28"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6d"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x75"  "\x70"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x29"  "\x3b"  "\x0a"  "\x76"  "\x33"  "\x64"  "\x20"  "\x65"  "\x6d"  "\x65"  "\x72"  "\x67"  "\x65"  "\x6e"  "\x74"  "\x5f"  "\x65"  "\x6c"  "\x65"  "\x63"  "\x74"  "\x72"  "\x69"  "\x63"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x28"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6d"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x75"  "\x70"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x64"  "\x6d"  "\x64"  "\x74"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x64"  "\x78"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x64"  "\x79"  "\x29"  "\x3b"  "\x0a"  "\x23"  "\x65"  "\x6e"  "\x64"  "\x69"  "\x66"  "\x0a"  "\x23"  "\x69"  "\x66"  "\x6e"  "\x64"  "\x65"  "\x66"  "\x20"  "\x5f"  "\x5f"  "\x43"  "\x4f"  "\x4c"  "\x4f"  "\x52"  "\x53"  "\x5f"  "\x48"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x5f"  "\x5f"  "\x43"  "\x4f"  "\x4c"  "\x4f"  "\x52"  "\x53"  "\x5f"  "\x48"  "\x0a"  "\x0a"  "\x0a"  "\x0a"  "\x0a"  "\x0a"  "\x0a"  "\x23"  "\x69"  "\x66"  "\x64"  "\x65"  "\x66"  "\x20"  "\x4f"  "\x50"  "\x45"  "\x4e"  "\x43"  "\x4c"  "\x5f"  "\x43"  "\x4f"  "\x4d"  "\x50"  "\x49"  "\x4c"  "\x41"  "\x54"  "\x49"  "\x4f"  "\x4e"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x75"  "\x69"  "\x6e"  "\x74"  "\x33"  "\x32"  "\x5f"  "\x74"  "\x20"  "\x75"  "\x63"  "\x68"  "\x61"  "\x72"  "\x34"  "\x0a"  "\x23"  "\x65"  "\x6e"  "\x64"  "\x69"  "\x66"  "\x0a"  "\x0a"  "\x74"  "\x79"  "\x70"  "\x65"  "\x64"  "\x65"  "\x66"  "\x20"  "\x75"  "\x6e"  "\x69"  "\x6f"  "\x6e"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x73"  "\x74"  "\x72"  "\x75"  "\x63"  "\x74"  "\x20"  "\x7b"  "\x20"  "\x75"  "\x6e"  "\x73"  "\x69"  "\x67"  "\x6e"  "\x65"  "\x64"  "\x20"  "\x63"  "\x68"  "\x61"  "\x72"  "\x20"  "\x62"  "\x2c"  "\x20"  "\x67"  "\x2c"  "\x20"  "\x72"  "\x2c"  "\x20"  "\x61"  "\x3b"  "\x20"  "\x7d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x73"  "\x74"  "\x72"  "\x75"  "\x63"  "\x74"  "\x20"  "\x7b"  "\x20"  "\x75"  "\x6e"  "\x73"  "\x69"  "\x67"  "\x6e"  "\x65"  "\x64"  "\x20"  "\x63"  "\x68"  "\x61"  "\x72"  "\x20"  "\x78"  "\x2c"  "\x20"  "\x79"  "\x2c"  "\x20"  "\x7a"  "\x2c"  "\x20"  "\x77"  "\x3b"  "\x20"  "\x7d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x2f"  "\x2f"  "\x63"  "\x6c"  "\x5f"  "\x63"  "\x68"  "\x61"  "\x72"  "\x34"  "\x20"  "\x63"  "\x6c"  "\x5f"  "\x72"  "\x67"  "\x62"  "\x61"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x75"  "\x69"  "\x6e"  "\x74"  "\x33"  "\x32"  "\x5f"  "\x74"  "\x20"  "\x62"  "\x67"  "\x72"  "\x61"  "\x3b"  "\x0a"  "\x7d"  "\x20"  "\x52"  "\x47"  "\x42"  "\x41"  "\x33"  "\x32"  "\x3b"  "\x0a"  "\x0a"  "\x52"  "\x47"  "\x42"  "\x41"  "\x33"  "\x32"  "\x20"  "\x6c"  "\x69"  "\x6e"  "\x65"  "\x61"  "\x72"  "\x5f"  "\x6d"  "\x61"  "\x70"  "\x70"  "\x69"  "\x6e"  "\x67"  "\x28"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x74"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x73"  "\x74"  "\x61"  "\x72"  "\x74"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6d"  "\x69"  "\x64"  "\x64"  "\x6c"  "\x65"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x65"  "\x6e"  "\x64"  "\x29"  "\x3b"  "\x0a"  "\x52"  "\x47"  "\x42"  "\x41"  "\x33"  "\x32"  "\x20"  "\x68"  "\x73"  "\x6c"  "\x5f"  "\x74"  "\x6f"  "\x5f"  "\x72"  "\x67"  "\x62"  "\x28"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x68"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x73"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x6c"  "\x29"  "\x3b"  "\x0a"  "\x52"  "\x47"  "\x42"  "\x41"  "\x33"  "\x32"  "\x20"  "\x6d"  "\x5f"  "\x74"  "\x6f"  "\x5f"  "\x68"  "\x73"  "\x6c"  "\x28"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6d"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x23"  "\x65"  "\x6e"  "\x64"  "\x69"  "\x66"  "\x0a"  "\x0a"  "\x0a"  "\x0a"  "\x0a"  "\x0a"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x28"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x78"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x79"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x7a"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x28"  "\x76"  "\x33"  "\x64"  "\x29"  "\x7b"  "\x2e"  "\x78"  "\x3d"  "\x78"  "\x2c"  "\x20"  "\x2e"  "\x79"  "\x3d"  "\x79"  "\x2c"  "\x20"  "\x2e"  "\x7a"  "\x3d"  "\x7a"  "\x7d"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x28"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x78"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x28"  "\x76"  "\x33"  "\x64"  "\x29"  "\x7b"  "\x2e"  "\x78"  "\x3d"  "\x78"  "\x2c"  "\x20"  "\x2e"  "\x79"  "\x3d"  "\x78"  "\x2c"  "\x20"  "\x2e"  "\x7a"  "\x3d"  "\x78"  "\x7d"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x73"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x2e"  "\x78"  "\x20"  "\x2a"  "\x3d"  "\x20"  "\x73"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x2e"  "\x79"  "\x20"  "\x2a"  "\x3d"  "\x20"  "\x73"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x2e"  "\x7a"  "\x20"  "\x2a"  "\x3d"  "\x20"  "\x73"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x76"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x31"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x32"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x31"  "\x2e"  "\x78"  "\x20"  "\x2b"  "\x3d"  "\x20"  "\x76"  "\x32"  "\x2e"  "\x78"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x31"  "\x2e"  "\x79"  "\x20"  "\x2b"  "\x3d"  "\x20"  "\x76"  "\x32"  "\x2e"  "\x79"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x31"  "\x2e"  "\x7a"  "\x20"  "\x2b"  "\x3d"  "\x20"  "\x76"  "\x32"  "\x2e"  "\x7a"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x76"  "\x31"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x62"  "\x28"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x31"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x32"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x31"  "\x2e"  "\x78"  "\x20"  "\x2d"  "\x3d"  "\x20"  "\x76"  "\x32"  "\x2e"  "\x78"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x31"  "\x2e"  "\x79"  "\x20"  "\x2d"  "\x3d"  "\x20"  "\x76"  "\x32"  "\x2e"  "\x79"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x31"  "\x2e"  "\x7a"  "\x20"  "\x2d"  "\x3d"  "\x20"  "\x76"  "\x32"  "\x2e"  "\x7a"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x76"  "\x31"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x72"  "\x6f"  "\x73"  "\x73"  "\x28"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x31"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x32"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x72"  "\x65"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x7b"  "\x30"  "\x7d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x2e"  "\x78"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x31"  "\x2e"  "\x79"  "\x20"  "\x2a"  "\x20"  "\x76"  "\x32"  "\x2e"  "\x7a"  "\x20"  "\x2d"  "\x20"  "\x76"  "\x31"  "\x2e"  "\x7a"  "\x20"  "\x2a"  "\x20"  "\x76"  "\x32"  "\x2e"  "\x79"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x2e"  "\x79"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x31"  "\x2e"  "\x7a"  "\x20"  "\x2a"  "\x20"  "\x76"  "\x32"  "\x2e"  "\x78"  "\x20"  "\x2d"  "\x20"  "\x76"  "\x31"  "\x2e"  "\x78"  "\x20"  "\x2a"  "\x20"  "\x76"  "\x32"  "\x2e"  "\x7a"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x2e"  "\x7a"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x31"  "\x2e"  "\x78"  "\x20"  "\x2a"  "\x20"  "\x76"  "\x32"  "\x2e"  "\x79"  "\x20"  "\x2d"  "\x20"  "\x76"  "\x31"  "\x2e"  "\x79"  "\x20"  "\x2a"  "\x20"  "\x76"  "\x32"  "\x2e"  "\x78"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x72"  "\x65"  "\x74"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x6e"  "\x6f"  "\x72"  "\x6d"  "\x61"  "\x6c"  "\x69"  "\x7a"  "\x65"  "\x28"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x4d"  "\x32"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x2e"  "\x78"  "\x20"  "\x2a"  "\x20"  "\x76"  "\x2e"  "\x78"  "\x20"  "\x2b"  "\x20"  "\x76"  "\x2e"  "\x79"  "\x20"  "\x2a"  "\x20"  "\x76"  "\x2e"  "\x79"  "\x20"  "\x2b"  "\x20"  "\x76"  "\x2e"  "\x7a"  "\x20"  "\x2a"  "\x20"  "\x76"  "\x2e"  "\x7a"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x43"  "\x4c"  "\x4f"  "\x53"  "\x45"  "\x5f"  "\x45"  "\x4e"  "\x4f"  "\x55"  "\x47"  "\x48"  "\x28"  "\x4d"  "\x32"  "\x2c"  "\x20"  "\x30"  "\x2c"  "\x20"  "\x45"  "\x50"  "\x53"  "\x29"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x76"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x4d"  "\x31"  "\x20"  "\x3d"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x20"  "\x2f"  "\x20"  "\x73"  "\x71"  "\x72"  "\x74"  "\x28"  "\x4d"  "\x32"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x2e"  "\x78"  "\x20"  "\x2a"  "\x3d"  "\x20"  "\x4d"  "\x31"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x2e"  "\x79"  "\x20"  "\x2a"  "\x3d"  "\x20"  "\x4d"  "\x31"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x2e"  "\x7a"  "\x20"  "\x2a"  "\x3d"  "\x20"  "\x4d"  "\x31"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x76"  "\x3b"  "\x0a"  "\x20"  "\x7d"  "\x0a"  "\x0a"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x64"  "\x6f"  "\x74"  "\x28"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x31"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x32"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x76"  "\x31"  "\x2e"  "\x78"  "\x20"  "\x2a"  "\x20"  "\x76"  "\x32"  "\x2e"  "\x78"  "\x20"  "\x2b"  "\x20"  "\x76"  "\x31"  "\x2e"  "\x79"  "\x20"  "\x2a"  "\x20"  "\x76"  "\x32"  "\x2e"  "\x79"  "\x20"  "\x2b"  "\x20"  "\x76"  "\x31"  "\x2e"  "\x7a"  "\x20"  "\x2a"  "\x20"  "\x76"  "\x32"  "\x2e"  "\x7a"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x0a"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x6e"  "\x73"  "\x72"  "\x61"  "\x6e"  "\x64"  "\x6f"  "\x6d"  "\x28"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x20"  "\x2a"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x73"  "\x74"  "\x61"  "\x72"  "\x74"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x65"  "\x6e"  "\x64"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x28"  "\x28"  "\x2a"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x29"  "\x29"  "\x20"  "\x2a"  "\x20"  "\x28"  "\x65"  "\x6e"  "\x64"  "\x20"  "\x2d"  "\x20"  "\x73"  "\x74"  "\x61"  "\x72"  "\x74"  "\x29"  "\x20"  "\x2b"  "\x20"  "\x73"  "\x74"  "\x61"  "\x72"  "\x74"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x2f"  "\x2f"  "\x41"  "\x6c"  "\x6c"  "\x20"  "\x6e"  "\x6f"  "\x72"  "\x6d"  "\x61"  "\x6c"  "\x20"  "\x73"  "\x61"  "\x6d"  "\x70"  "\x6c"  "\x65"  "\x72"  "\x73"  "\x20"  "\x62"  "\x65"  "\x6c"  "\x6f"  "\x77"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x73"  "\x75"  "\x6d"  "\x65"  "\x20"  "\x61"  "\x20"  "\x66"  "\x69"  "\x78"  "\x65"  "\x64"  "\x20"  "\x6e"  "\x75"  "\x6d"  "\x62"  "\x65"  "\x72"  "\x20"  "\x6f"  "\x66"  "\x20"  "\x75"  "\x6e"  "\x69"  "\x66"  "\x6f"  "\x72"  "\x6d"  "\x73"  "\x20"  "\x61"  "\x6e"  "\x64"  "\x20"  "\x68"  "\x61"  "\x76"  "\x65"  "\x20"  "\x6e"  "\x6f"  "\x20"  "\x72"  "\x65"  "\x6a"  "\x65"  "\x63"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x20"  "\x6c"  "\x6f"  "\x6f"  "\x70"  "\x2c"  "\x0a"  "\x2f"  "\x2f"  "\x73"  "\x6f"  "\x20"  "\x77"  "\x6f"  "\x72"  "\x6b"  "\x2d"  "\x69"  "\x74"  "\x65"  "\x6d"  "\x73"  "\x20"  "\x6e"  "\x65"  "\x76"  "\x65"  "\x72"  "\x20"  "\x64"  "\x69"  "\x76"  "\x65"  "\x72"  "\x67"  "\x65"  "\x20"  "\x6f"  "\x6e"  "\x20"  "\x74"  "\x68"  "\x65"  "\x6d"  "\x2e"  "\x20"  "\x31"  "\x20"  "\x2d"  "\x20"  "\x75"  "\x20"  "\x69"  "\x73"  "\x20"  "\x69"  "\x6e"  "\x20"  "\x28"  "\x30"  "\x2c"  "\x20"  "\x31"  "\x5d"  "\x2c"  "\x20"  "\x77"  "\x68"  "\x69"  "\x63"  "\x68"  "\x20"  "\x6b"  "\x65"  "\x65"  "\x70"  "\x73"  "\x20"  "\x6c"  "\x6f"  "\x67"  "\x20"  "\x66"  "\x69"  "\x6e"  "\x69"  "\x74"  "\x65"  "\x0a"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x6e"  "\x6f"  "\x72"  "\x6d"  "\x61"  "\x6c"  "\x5f"  "\x64"  "\x69"  "\x73"  "\x74"  "\x72"  "\x69"  "\x62"  "\x75"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x5f"  "\x62"  "\x6f"  "\x78"  "\x5f"  "\x6d"  "\x75"  "\x6c"  "\x6c"  "\x65"  "\x72"  "\x28"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x20"  "\x2a"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x75"  "\x31"  "\x20"  "\x3d"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x20"  "\x2d"  "\x20"  "\x6e"  "\x73"  "\x72"  "\x61"  "\x6e"  "\x64"  "\x6f"  "\x6d"  "\x28"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2c"  "\x20"  "\x30"  "\x2c"  "\x20"  "\x31"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x75"  "\x32"  "\x20"  "\x3d"  "\x20"  "\x6e"  "\x73"  "\x72"  "\x61"  "\x6e"  "\x64"  "\x6f"  "\x6d"  "\x28"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2c"  "\x20"  "\x30"  "\x2c"  "\x20"  "\x31"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x73"  "\x71"  "\x72"  "\x74"  "\x28"  "\x2d"  "\x32"  "\x2e"  "\x30"  "\x20"  "\x2a"  "\x20"  "\x6c"  "\x6f"  "\x67"  "\x28"  "\x75"  "\x31"  "\x29"  "\x29"  "\x20"  "\x2a"  "\x20"  "\x63"  "\x6f"  "\x73"  "\x28"  "\x32"  "\x2e"  "\x30"  "\x20"  "\x2a"  "\x20"  "\x4d"  "\x5f"  "\x50"  "\x49"  "\x20"  "\x2a"  "\x20"  "\x75"  "\x32"  "\x29"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x76"  "\x6f"  "\x69"  "\x64"  "\x20"  "\x6e"  "\x6f"  "\x72"  "\x6d"  "\x61"  "\x6c"  "\x5f"  "\x64"  "\x69"  "\x73"  "\x74"  "\x72"  "\x69"  "\x62"  "\x75"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x5f"  "\x70"  "\x61"  "\x69"  "\x72"  "\x28"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x20"  "\x2a"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x2a"  "\x6e"  "\x30"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x2a"  "\x6e"  "\x31"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x75"  "\x31"  "\x20"  "\x3d"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x20"  "\x2d"  "\x20"  "\x6e"  "\x73"  "\x72"  "\x61"  "\x6e"  "\x64"  "\x6f"  "\x6d"  "\x28"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2c"  "\x20"  "\x30"  "\x2c"  "\x20"  "\x31"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x75"  "\x32"  "\x20"  "\x3d"  "\x20"  "\x6e"  "\x73"  "\x72"  "\x61"  "\x6e"  "\x64"  "\x6f"  "\x6d"  "\x28"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2c"  "\x20"  "\x30"  "\x2c"  "\x20"  "\x31"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x72"  "\x20"  "\x3d"  "\x20"  "\x73"  "\x71"  "\x72"  "\x74"  "\x28"  "\x2d"  "\x32"  "\x2e"  "\x30"  "\x20"  "\x2a"  "\x20"  "\x6c"  "\x6f"  "\x67"  "\x28"  "\x75"  "\x31"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x74"  "\x68"  "\x65"  "\x74"  "\x61"  "\x20"  "\x3d"  "\x20"  "\x32"  "\x2e"  "\x30"  "\x20"  "\x2a"  "\x20"  "\x4d"  "\x5f"  "\x50"  "\x49"  "\x20"  "\x2a"  "\x20"  "\x75"  "\x32"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x2a"  "\x6e"  "\x30"  "\x20"  "\x3d"  "\x20"  "\x72"  "\x20"  "\x2a"  "\x20"  "\x63"  "\x6f"  "\x73"  "\x28"  "\x74"  "\x68"  "\x65"  "\x74"  "\x61"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x2a"  "\x6e"  "\x31"  "\x20"  "\x3d"  "\x20"  "\x72"  "\x20"  "\x2a"  "\x20"  "\x73"  "\x69"  "\x6e"  "\x28"  "\x74"  "\x68"  "\x65"  "\x74"  "\x61"  "\x29"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x2f"  "\x2f"  "\x34"  "\x20"  "\x75"  "\x6e"  "\x69"  "\x66"  "\x6f"  "\x72"  "\x6d"  "\x73"  "\x20"  "\x2d"  "\x3e"  "\x20"  "\x33"  "\x20"  "\x6e"  "\x6f"  "\x72"  "\x6d"  "\x61"  "\x6c"  "\x73"  "\x2c"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x66"  "\x6f"  "\x75"  "\x72"  "\x74"  "\x68"  "\x20"  "\x6f"  "\x6e"  "\x65"  "\x20"  "\x69"  "\x73"  "\x20"  "\x64"  "\x72"  "\x6f"  "\x70"  "\x70"  "\x65"  "\x64"  "\x0a"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6e"  "\x6f"  "\x72"  "\x6d"  "\x61"  "\x6c"  "\x5f"  "\x64"  "\x69"  "\x73"  "\x74"  "\x72"  "\x69"  "\x62"  "\x75"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x5f"  "\x76"  "\x33"  "\x64"  "\x28"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x20"  "\x2a"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x78"  "\x2c"  "\x20"  "\x79"  "\x2c"  "\x20"  "\x7a"  "\x2c"  "\x20"  "\x75"  "\x6e"  "\x75"  "\x73"  "\x65"  "\x64"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6e"  "\x6f"  "\x72"  "\x6d"  "\x61"  "\x6c"  "\x5f"  "\x64"  "\x69"  "\x73"  "\x74"  "\x72"  "\x69"  "\x62"  "\x75"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x5f"  "\x70"  "\x61"  "\x69"  "\x72"  "\x28"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2c"  "\x20"  "\x26"  "\x78"  "\x2c"  "\x20"  "\x26"  "\x79"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6e"  "\x6f"  "\x72"  "\x6d"  "\x61"  "\x6c"  "\x5f"  "\x64"  "\x69"  "\x73"  "\x74"  "\x72"  "\x69"  "\x62"  "\x75"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x5f"  "\x70"  "\x61"  "\x69"  "\x72"  "\x28"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2c"  "\x20"  "\x26"  "\x7a"  "\x2c"  "\x20"  "\x26"  "\x75"  "\x6e"  "\x75"  "\x73"  "\x65"  "\x64"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x28"  "\x78"  "\x2c"  "\x20"  "\x79"  "\x2c"  "\x20"  "\x7a"  "\x29"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x6e"  "\x6f"  "\x72"  "\x6d"  "\x61"  "\x6c"  "\x5f"  "\x64"  "\x69"  "\x73"  "\x74"  "\x72"  "\x69"  "\x62"  "\x75"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x28"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x20"  "\x2a"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x6e"  "\x6f"  "\x72"  "\x6d"  "\x61"  "\x6c"  "\x5f"  "\x64"  "\x69"  "\x73"  "\x74"  "\x72"  "\x69"  "\x62"  "\x75"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x5f"  "\x62"  "\x6f"  "\x78"  "\x5f"  "\x6d"  "\x75"  "\x6c"  "\x6c"  "\x65"  "\x72"  "\x28"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x29"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x2f"  "\x2f"  "\x41"  "\x73"  "\x73"  "\x75"  "\x6d"  "\x65"  "\x20"  "\x44"  "\x3d"  "\x31"  "\x0a"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x72"  "\x61"  "\x6e"  "\x64"  "\x6f"  "\x6d"  "\x5f"  "\x67"  "\x73"  "\x61"  "\x5f"  "\x28"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x20"  "\x2a"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x71"  "\x56"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x54"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x67"  "\x61"  "\x6d"  "\x6d"  "\x61"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x64"  "\x78"  "\x20"  "\x3d"  "\x20"  "\x6e"  "\x73"  "\x72"  "\x61"  "\x6e"  "\x64"  "\x6f"  "\x6d"  "\x28"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2c"  "\x20"  "\x2d"  "\x31"  "\x30"  "\x2c"  "\x20"  "\x31"  "\x30"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x63"  "\x20"  "\x3d"  "\x20"  "\x73"  "\x71"  "\x72"  "\x74"  "\x28"  "\x28"  "\x71"  "\x56"  "\x20"  "\x2d"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x29"  "\x20"  "\x2f"  "\x20"  "\x4d"  "\x5f"  "\x50"  "\x49"  "\x29"  "\x20"  "\x2a"  "\x20"  "\x67"  "\x61"  "\x6d"  "\x6d"  "\x61"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x6f"  "\x77"  "\x28"  "\x54"  "\x2c"  "\x20"  "\x2d"  "\x31"  "\x2e"  "\x30"  "\x20"  "\x2f"  "\x20"  "\x28"  "\x33"  "\x2e"  "\x30"  "\x20"  "\x2d"  "\x20"  "\x71"  "\x56"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x6c"  "\x20"  "\x3d"  "\x20"  "\x70"  "\x6f"  "\x77"  "\x28"  "\x31"  "\x2e"  "\x30"  "\x20"  "\x2b"  "\x20"  "\x28"  "\x71"  "\x56"  "\x20"  "\x2d"  "\x20"  "\x31"  "\x29"  "\x20"  "\x2a"  "\x20"  "\x64"  "\x78"  "\x20"  "\x2a"  "\x20"  "\x64"  "\x78"  "\x20"  "\x2f"  "\x20"  "\x70"  "\x6f"  "\x77"  "\x28"  "\x54"  "\x2c"  "\x20"  "\x32"  "\x2e"  "\x30"  "\x20"  "\x2f"  "\x20"  "\x28"  "\x33"  "\x2e"  "\x30"  "\x20"  "\x2d"  "\x20"  "\x71"  "\x56"  "\x29"  "\x29"  "\x2c"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x20"  "\x2f"  "\x20"  "\x28"  "\x71"  "\x56"  "\x20"  "\x2d"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x63"  "\x20"  "\x2a"  "\x20"  "\x64"  "\x78"  "\x20"  "\x2f"  "\x20"  "\x6c"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x72"  "\x61"  "\x6e"  "\x64"  "\x6f"  "\x6d"  "\x5f"  "\x67"  "\x73"  "\x61"  "\x28"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x20"  "\x2a"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x71"  "\x56"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x54"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x5f"  "\x67"  "\x61"  "\x6d"  "\x6d"  "\x61"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x66"  "\x31"  "\x20"  "\x3d"  "\x20"  "\x65"  "\x78"  "\x70"  "\x28"  "\x6c"  "\x6f"  "\x67"  "\x28"  "\x54"  "\x29"  "\x20"  "\x2f"  "\x20"  "\x28"  "\x71"  "\x56"  "\x20"  "\x2d"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x66"  "\x32"  "\x20"  "\x3d"  "\x20"  "\x65"  "\x78"  "\x70"  "\x28"  "\x28"  "\x34"  "\x2e"  "\x30"  "\x20"  "\x2d"  "\x20"  "\x71"  "\x56"  "\x29"  "\x20"  "\x2a"  "\x20"  "\x6c"  "\x6f"  "\x67"  "\x28"  "\x71"  "\x56"  "\x20"  "\x2d"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x66"  "\x33"  "\x20"  "\x3d"  "\x20"  "\x65"  "\x78"  "\x70"  "\x28"  "\x28"  "\x32"  "\x2e"  "\x30"  "\x20"  "\x2d"  "\x20"  "\x71"  "\x56"  "\x29"  "\x20"  "\x2a"  "\x20"  "\x6c"  "\x6f"  "\x67"  "\x28"  "\x32"  "\x2e"  "\x30"  "\x29"  "\x20"  "\x2f"  "\x20"  "\x28"  "\x71"  "\x56"  "\x20"  "\x2d"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x66"  "\x34"  "\x20"  "\x3d"  "\x20"  "\x73"  "\x71"  "\x72"  "\x74"  "\x28"  "\x4d"  "\x5f"  "\x50"  "\x49"  "\x29"  "\x20"  "\x2a"  "\x20"  "\x66"  "\x31"  "\x20"  "\x2a"  "\x20"  "\x66"  "\x32"  "\x20"  "\x2f"  "\x20"  "\x28"  "\x66"  "\x33"  "\x20"  "\x2a"  "\x20"  "\x28"  "\x33"  "\x2e"  "\x30"  "\x20"  "\x2d"  "\x20"  "\x71"  "\x56"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x66"  "\x35"  "\x20"  "\x3d"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x20"  "\x2f"  "\x20"  "\x28"  "\x71"  "\x56"  "\x20"  "\x2d"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x29"  "\x20"  "\x2d"  "\x20"  "\x30"  "\x2e"  "\x35"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x66"  "\x36"  "\x20"  "\x3d"  "\x20"  "\x4d"  "\x5f"  "\x50"  "\x49"  "\x20"  "\x2a"  "\x20"  "\x28"  "\x31"  "\x2e"  "\x30"  "\x20"  "\x2d"  "\x20"  "\x66"  "\x35"  "\x29"  "\x20"  "\x2f"  "\x20"  "\x73"  "\x69"  "\x6e"  "\x28"  "\x4d"  "\x5f"  "\x50"  "\x49"  "\x20"  "\x2a"  "\x20"  "\x28"  "\x31"  "\x2e"  "\x30"  "\x20"  "\x2d"  "\x20"  "\x66"  "\x35"  "\x29"  "\x29"  "\x20"  "\x2f"  "\x20"  "\x74"  "\x67"  "\x61"  "\x6d"  "\x6d"  "\x61"  "\x28"  "\x32"  "\x2e"  "\x30"  "\x20"  "\x2d"  "\x20"  "\x66"  "\x35"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x73"  "\x69"  "\x67"  "\x6d"  "\x61"  "\x78"  "\x20"  "\x3d"  "\x20"  "\x65"  "\x78"  "\x70"  "\x28"  "\x2d"  "\x28"  "\x71"  "\x56"  "\x20"  "\x2d"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x29"  "\x20"  "\x2a"  "\x20"  "\x6c"  "\x6f"  "\x67"  "\x28"  "\x66"  "\x36"  "\x20"  "\x2f"  "\x20"  "\x66"  "\x34"  "\x29"  "\x20"  "\x2f"  "\x20"  "\x28"  "\x33"  "\x2e"  "\x30"  "\x20"  "\x2d"  "\x20"  "\x71"  "\x56"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x78"  "\x2c"  "\x20"  "\x79"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6e"  "\x6f"  "\x72"  "\x6d"  "\x61"  "\x6c"  "\x5f"  "\x64"  "\x69"  "\x73"  "\x74"  "\x72"  "\x69"  "\x62"  "\x75"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x5f"  "\x70"  "\x61"  "\x69"  "\x72"  "\x28"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2c"  "\x20"  "\x26"  "\x78"  "\x2c"  "\x20"  "\x26"  "\x79"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x78"  "\x20"  "\x2a"  "\x3d"  "\x20"  "\x73"  "\x69"  "\x67"  "\x6d"  "\x61"  "\x78"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x64"  "\x65"  "\x6e"  "\x20"  "\x3d"  "\x20"  "\x65"  "\x78"  "\x70"  "\x28"  "\x28"  "\x71"  "\x56"  "\x20"  "\x2d"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x29"  "\x20"  "\x2a"  "\x20"  "\x6c"  "\x6f"  "\x67"  "\x28"  "\x66"  "\x61"  "\x62"  "\x73"  "\x28"  "\x79"  "\x29"  "\x29"  "\x20"  "\x2f"  "\x20"  "\x28"  "\x33"  "\x2e"  "\x30"  "\x20"  "\x2d"  "\x20"  "\x71"  "\x56"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x78"  "\x20"  "\x2f"  "\x20"  "\x64"  "\x65"  "\x6e"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x0a"  "\x0a"  "\x0a"  "\x0a"  "\x76"  "\x33"  "\x64"  "\x20"  "\x61"  "\x70"  "\x70"  "\x6c"  "\x79"  "\x5f"  "\x70"  "\x62"  "\x63"  "\x28"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x2a"  "\x76"  "\x2c"  "\x20"  "\x70"  "\x62"  "\x63"  "\x5f"  "\x72"  "\x75"  "\x6c"  "\x65"  "\x73"  "\x20"  "\x70"  "\x62"  "\x63"  "\x2c"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x2c"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x2c"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3e"  "\x3d"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x7c"  "\x7c"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3c"  "\x20"  "\x30"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x21"  "\x70"  "\x62"  "\x63"  "\x2e"  "\x70"  "\x62"  "\x63"  "\x5f"  "\x79"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x70"  "\x62"  "\x63"  "\x2e"  "\x6d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x28"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x25"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x29"  "\x20"  "\x2b"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x29"  "\x20"  "\x25"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7d"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3e"  "\x3d"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x20"  "\x7c"  "\x7c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3c"  "\x20"  "\x30"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x21"  "\x70"  "\x62"  "\x63"  "\x2e"  "\x70"  "\x62"  "\x63"  "\x5f"  "\x78"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x70"  "\x62"  "\x63"  "\x2e"  "\x6d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x28"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x25"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x20"  "\x2b"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x20"  "\x25"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7d"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x76"  "\x5b"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2a"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x20"  "\x2b"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x5d"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x76"  "\x6f"  "\x69"  "\x64"  "\x20"  "\x61"  "\x70"  "\x70"  "\x6c"  "\x79"  "\x5f"  "\x70"  "\x62"  "\x63"  "\x5f"  "\x63"  "\x6f"  "\x6d"  "\x70"  "\x6c"  "\x65"  "\x74"  "\x65"  "\x28"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x73"  "\x69"  "\x74"  "\x65"  "\x5f"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x73"  "\x20"  "\x2a"  "\x67"  "\x73"  "\x2c"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x2a"  "\x76"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x2a"  "\x6f"  "\x75"  "\x74"  "\x2c"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x73"  "\x69"  "\x74"  "\x65"  "\x5f"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x73"  "\x20"  "\x2a"  "\x67"  "\x73"  "\x6f"  "\x75"  "\x74"  "\x2c"  "\x20"  "\x70"  "\x62"  "\x63"  "\x5f"  "\x72"  "\x75"  "\x6c"  "\x65"  "\x73"  "\x20"  "\x70"  "\x62"  "\x63"  "\x2c"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x2c"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x2c"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3e"  "\x3d"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x7c"  "\x7c"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3c"  "\x20"  "\x30"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x21"  "\x70"  "\x62"  "\x63"  "\x2e"  "\x70"  "\x62"  "\x63"  "\x5f"  "\x79"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x2a"  "\x6f"  "\x75"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x70"  "\x62"  "\x63"  "\x2e"  "\x6d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x2a"  "\x67"  "\x73"  "\x6f"  "\x75"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x73"  "\x5b"  "\x28"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3e"  "\x3d"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x3f"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x2d"  "\x20"  "\x31"  "\x3a"  "\x20"  "\x30"  "\x29"  "\x20"  "\x2a"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x20"  "\x2b"  "\x20"  "\x28"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3e"  "\x3d"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x3f"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x20"  "\x2d"  "\x20"  "\x31"  "\x3a"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3c"  "\x20"  "\x30"  "\x3f"  "\x20"  "\x30"  "\x3a"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x29"  "\x5d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7d"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x28"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x25"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x29"  "\x20"  "\x2b"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x29"  "\x20"  "\x25"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7d"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3e"  "\x3d"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x20"  "\x7c"  "\x7c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3c"  "\x20"  "\x30"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x21"  "\x70"  "\x62"  "\x63"  "\x2e"  "\x70"  "\x62"  "\x63"  "\x5f"  "\x78"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x2a"  "\x6f"  "\x75"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x70"  "\x62"  "\x63"  "\x2e"  "\x6d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x2a"  "\x67"  "\x73"  "\x6f"  "\x75"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x73"  "\x5b"  "\x28"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3e"  "\x3d"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x3f"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x2d"  "\x20"  "\x31"  "\x3a"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3c"  "\x20"  "\x30"  "\x3f"  "\x20"  "\x30"  "\x3a"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x29"  "\x20"  "\x2a"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x20"  "\x2b"  "\x20"  "\x28"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3e"  "\x3d"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x3f"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x20"  "\x2d"  "\x20"  "\x31"  "\x3a"  "\x20"  "\x30"  "\x29"  "\x5d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7d"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x28"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x25"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x20"  "\x2b"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x20"  "\x25"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7d"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x2a"  "\x6f"  "\x75"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x5b"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2a"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x20"  "\x2b"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x5d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x2a"  "\x67"  "\x73"  "\x6f"  "\x75"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x73"  "\x5b"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2a"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x20"  "\x2b"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x5d"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x2f"  "\x2f"  "\x28"  "\x33"  "\x20"  "\x72"  "\x20"  "\x72"  "\x20"  "\x2d"  "\x20"  "\x49"  "\x29"  "\x20"  "\x6d"  "\x20"  "\x2f"  "\x20"  "\x7c"  "\x72"  "\x7c"  "\x5e"  "\x33"  "\x20"  "\x66"  "\x6f"  "\x72"  "\x20"  "\x61"  "\x6e"  "\x20"  "\x69"  "\x6e"  "\x2d"  "\x70"  "\x6c"  "\x61"  "\x6e"  "\x65"  "\x20"  "\x73"  "\x65"  "\x70"  "\x61"  "\x72"  "\x61"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x20"  "\x67"  "\x69"  "\x76"  "\x65"  "\x6e"  "\x20"  "\x69"  "\x6e"  "\x20"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x20"  "\x75"  "\x6e"  "\x69"  "\x74"  "\x73"  "\x0a"  "\x76"  "\x33"  "\x64"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x74"  "\x65"  "\x6e"  "\x73"  "\x6f"  "\x72"  "\x5f"  "\x61"  "\x70"  "\x70"  "\x6c"  "\x79"  "\x28"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x64"  "\x78"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x64"  "\x79"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6d"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x72"  "\x32"  "\x20"  "\x3d"  "\x20"  "\x64"  "\x78"  "\x20"  "\x2a"  "\x20"  "\x64"  "\x78"  "\x20"  "\x2b"  "\x20"  "\x64"  "\x79"  "\x20"  "\x2a"  "\x20"  "\x64"  "\x79"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x72"  "\x33"  "\x20"  "\x3d"  "\x20"  "\x72"  "\x32"  "\x20"  "\x2a"  "\x20"  "\x73"  "\x71"  "\x72"  "\x74"  "\x28"  "\x72"  "\x32"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x72"  "\x6d"  "\x20"  "\x3d"  "\x20"  "\x33"  "\x2e"  "\x30"  "\x20"  "\x2a"  "\x20"  "\x28"  "\x64"  "\x78"  "\x20"  "\x2a"  "\x20"  "\x6d"  "\x2e"  "\x78"  "\x20"  "\x2b"  "\x20"  "\x64"  "\x79"  "\x20"  "\x2a"  "\x20"  "\x6d"  "\x2e"  "\x79"  "\x29"  "\x20"  "\x2f"  "\x20"  "\x72"  "\x32"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x28"  "\x64"  "\x78"  "\x20"  "\x2a"  "\x20"  "\x72"  "\x6d"  "\x20"  "\x2d"  "\x20"  "\x6d"  "\x2e"  "\x78"  "\x2c"  "\x20"  "\x64"  "\x79"  "\x20"  "\x2a"  "\x20"  "\x72"  "\x6d"  "\x20"  "\x2d"  "\x20"  "\x6d"  "\x2e"  "\x79"  "\x2c"  "\x20"  "\x2d"  "\x6d"  "\x2e"  "\x7a"  "\x29"  "\x2c"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x20"  "\x2f"  "\x20"  "\x72"  "\x33"  "\x29"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x2f"  "\x2f"  "\x66"  "\x69"  "\x6c"  "\x6c"  "\x73"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x6e"  "\x6f"  "\x64"  "\x65"  "\x20"  "\x6f"  "\x66"  "\x66"  "\x73"  "\x65"  "\x74"  "\x20"  "\x61"  "\x6e"  "\x64"  "\x20"  "\x73"  "\x68"  "\x61"  "\x70"  "\x65"  "\x20"  "\x6f"  "\x66"  "\x20"  "\x65"  "\x76"  "\x65"  "\x72"  "\x79"  "\x20"  "\x70"  "\x79"  "\x72"  "\x61"  "\x6d"  "\x69"  "\x64"  "\x20"  "\x6c"  "\x65"  "\x76"  "\x65"  "\x6c"  "\x2c"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x73"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x69"  "\x6e"  "\x64"  "\x65"  "\x78"  "\x20"  "\x6f"  "\x66"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x31"  "\x78"  "\x31"  "\x20"  "\x74"  "\x6f"  "\x70"  "\x20"  "\x6c"  "\x65"  "\x76"  "\x65"  "\x6c"  "\x0a"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x74"  "\x72"  "\x65"  "\x65"  "\x5f"  "\x6c"  "\x65"  "\x76"  "\x65"  "\x6c"  "\x73"  "\x28"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x20"  "\x67"  "\x69"  "\x2c"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x2a"  "\x6f"  "\x66"  "\x66"  "\x73"  "\x65"  "\x74"  "\x73"  "\x2c"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x2a"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x2a"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x6c"  "\x65"  "\x76"  "\x65"  "\x6c"  "\x20"  "\x3d"  "\x20"  "\x30"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6f"  "\x66"  "\x66"  "\x73"  "\x65"  "\x74"  "\x73"  "\x5b"  "\x30"  "\x5d"  "\x20"  "\x3d"  "\x20"  "\x30"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x5b"  "\x30"  "\x5d"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x5b"  "\x30"  "\x5d"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x77"  "\x68"  "\x69"  "\x6c"  "\x65"  "\x20"  "\x28"  "\x28"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x5b"  "\x6c"  "\x65"  "\x76"  "\x65"  "\x6c"  "\x5d"  "\x20"  "\x3e"  "\x20"  "\x31"  "\x20"  "\x7c"  "\x7c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x5b"  "\x6c"  "\x65"  "\x76"  "\x65"  "\x6c"  "\x5d"  "\x20"  "\x3e"  "\x20"  "\x31"  "\x29"  "\x20"  "\x26"  "\x26"  "\x20"  "\x6c"  "\x65"  "\x76"  "\x65"  "\x6c"  "\x20"  "\x3c"  "\x20"  "\x44"  "\x49"  "\x50"  "\x4f"  "\x4c"  "\x41"  "\x52"  "\x5f"  "\x54"  "\x52"  "\x45"  "\x45"  "\x5f"  "\x4d"  "\x41"  "\x58"  "\x5f"  "\x4c"  "\x45"  "\x56"  "\x45"  "\x4c"  "\x53"  "\x20"  "\x2d"  "\x20"  "\x31"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6f"  "\x66"  "\x66"  "\x73"  "\x65"  "\x74"  "\x73"  "\x5b"  "\x6c"  "\x65"  "\x76"  "\x65"  "\x6c"  "\x20"  "\x2b"  "\x20"  "\x31"  "\x5d"  "\x20"  "\x3d"  "\x20"  "\x6f"  "\x66"  "\x66"  "\x73"  "\x65"  "\x74"  "\x73"  "\x5b"  "\x6c"  "\x65"  "\x76"  "\x65"  "\x6c"  "\x5d"  "\x20"  "\x2b"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x5b"  "\x6c"  "\x65"  "\x76"  "\x65"  "\x6c"  "\x5d"  "\x20"  "\x2a"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x5b"  "\x6c"  "\x65"  "\x76"  "\x65"  "\x6c"  "\x5d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x5b"  "\x6c"  "\x65"  "\x76"  "\x65"  "\x6c"  "\x20"  "\x2b"  "\x20"  "\x31"  "\x5d"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x5b"  "\x6c"  "\x65"  "\x76"  "\x65"  "\x6c"  "\x5d"  "\x20"  "\x2b"  "\x20"  "\x31"  "\x29"  "\x20"  "\x2f"  "\x20"  "\x32"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x5b"  "\x6c"  "\x65"  "\x76"  "\x65"  "\x6c"  "\x20"  "\x2b"  "\x20"  "\x31"  "\x5d"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x5b"  "\x6c"  "\x65"  "\x76"  "\x65"  "\x6c"  "\x5d"  "\x20"  "\x2b"  "\x20"  "\x31"  "\x29"  "\x20"  "\x2f"  "\x20"  "\x32"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6c"  "\x65"  "\x76"  "\x65"  "\x6c"  "\x2b"  "\x2b"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7d"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x6c"  "\x65"  "\x76"  "\x65"  "\x6c"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x23"  "\x69"  "\x66"  "\x64"  "\x65"  "\x66"  "\x20"  "\x49"  "\x4e"  "\x43"  "\x4c"  "\x55"  "\x44"  "\x45"  "\x5f"  "\x44"  "\x49"  "\x50"  "\x4f"  "\x4c"  "\x41"  "\x52"  "\x0a"  "\x2f"  "\x2f"  "\x73"  "\x75"  "\x6d"  "\x20"  "\x6f"  "\x66"  "\x20"  "\x6d"  "\x75"  "\x5f"  "\x6a"  "\x20"  "\x2a"  "\x20"  "\x44"  "\x28"  "\x72"  "\x5f"  "\x69"  "\x6a"  "\x29"  "\x20"  "\x2a"  "\x20"  "\x6d"  "\x5f"  "\x6a"  "\x20"  "\x6f"  "\x76"  "\x65"  "\x72"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x73"  "\x61"  "\x6d"  "\x65"  "\x20"  "\x6f"  "\x66"  "\x66"  "\x73"  "\x65"  "\x74"  "\x20"  "\x77"  "\x69"  "\x6e"  "\x64"  "\x6f"  "\x77"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x64"  "\x69"  "\x72"  "\x65"  "\x63"  "\x74"  "\x20"  "\x73"  "\x75"  "\x6d"  "\x20"  "\x61"  "\x6c"  "\x77"  "\x61"  "\x79"  "\x73"  "\x20"  "\x75"  "\x73"  "\x65"  "\x64"  "\x0a"  "\x2f"  "\x2f"  "\x74"  "\x68"  "\x65"  "\x20"  "\x74"  "\x65"  "\x6e"  "\x73"  "\x6f"  "\x72"  "\x20"  "\x74"  "\x61"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x69"  "\x73"  "\x20"  "\x77"  "\x61"  "\x6c"  "\x6b"  "\x65"  "\x64"  "\x20"  "\x69"  "\x6e"  "\x20"  "\x74"  "\x69"  "\x6c"  "\x65"  "\x73"  "\x20"  "\x73"  "\x74"  "\x61"  "\x67"  "\x65"  "\x64"  "\x20"  "\x69"  "\x6e"  "\x20"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x20"  "\x6d"  "\x65"  "\x6d"  "\x6f"  "\x72"  "\x79"  "\x2c"  "\x20"  "\x65"  "\x76"  "\x65"  "\x72"  "\x79"  "\x20"  "\x77"  "\x6f"  "\x72"  "\x6b"  "\x20"  "\x69"  "\x74"  "\x65"  "\x6d"  "\x20"  "\x6f"  "\x66"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x67"  "\x72"  "\x6f"  "\x75"  "\x70"  "\x20"  "\x6d"  "\x75"  "\x73"  "\x74"  "\x20"  "\x63"  "\x61"  "\x6c"  "\x6c"  "\x20"  "\x74"  "\x68"  "\x69"  "\x73"  "\x0a"  "\x76"  "\x33"  "\x64"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x73"  "\x69"  "\x74"  "\x65"  "\x5f"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x73"  "\x20"  "\x2a"  "\x67"  "\x73"  "\x2c"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x2a"  "\x76"  "\x2c"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x74"  "\x65"  "\x6e"  "\x73"  "\x6f"  "\x72"  "\x20"  "\x2a"  "\x74"  "\x61"  "\x62"  "\x6c"  "\x65"  "\x2c"  "\x20"  "\x4c"  "\x4f"  "\x43"  "\x41"  "\x4c"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x74"  "\x65"  "\x6e"  "\x73"  "\x6f"  "\x72"  "\x20"  "\x2a"  "\x74"  "\x69"  "\x6c"  "\x65"  "\x2c"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x20"  "\x67"  "\x69"  "\x2c"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x2c"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x2c"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x61"  "\x63"  "\x74"  "\x69"  "\x76"  "\x65"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x73"  "\x74"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x68"  "\x61"  "\x6c"  "\x66"  "\x5f"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x2f"  "\x20"  "\x32"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x73"  "\x74"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x68"  "\x61"  "\x6c"  "\x66"  "\x5f"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x20"  "\x2f"  "\x20"  "\x32"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x73"  "\x74"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x77"  "\x69"  "\x6e"  "\x64"  "\x6f"  "\x77"  "\x5f"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x20"  "\x3d"  "\x20"  "\x32"  "\x20"  "\x2a"  "\x20"  "\x68"  "\x61"  "\x6c"  "\x66"  "\x5f"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x73"  "\x74"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x74"  "\x6f"  "\x74"  "\x61"  "\x6c"  "\x20"  "\x3d"  "\x20"  "\x32"  "\x20"  "\x2a"  "\x20"  "\x68"  "\x61"  "\x6c"  "\x66"  "\x5f"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x2a"  "\x20"  "\x77"  "\x69"  "\x6e"  "\x64"  "\x6f"  "\x77"  "\x5f"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x2f"  "\x2f"  "\x74"  "\x68"  "\x65"  "\x20"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x20"  "\x6b"  "\x65"  "\x72"  "\x6e"  "\x65"  "\x6c"  "\x73"  "\x20"  "\x72"  "\x75"  "\x6e"  "\x20"  "\x6f"  "\x6e"  "\x20"  "\x32"  "\x44"  "\x20"  "\x74"  "\x69"  "\x6c"  "\x65"  "\x73"  "\x2c"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x77"  "\x68"  "\x6f"  "\x6c"  "\x65"  "\x20"  "\x67"  "\x72"  "\x6f"  "\x75"  "\x70"  "\x20"  "\x73"  "\x68"  "\x61"  "\x72"  "\x65"  "\x73"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x74"  "\x61"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x6c"  "\x6f"  "\x61"  "\x64"  "\x73"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x73"  "\x74"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x6c"  "\x69"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x64"  "\x28"  "\x31"  "\x29"  "\x20"  "\x2a"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x28"  "\x30"  "\x29"  "\x20"  "\x2b"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x64"  "\x28"  "\x30"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x73"  "\x74"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x6c"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x28"  "\x30"  "\x29"  "\x20"  "\x2a"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x28"  "\x31"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x72"  "\x65"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x28"  "\x30"  "\x2e"  "\x30"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x66"  "\x6f"  "\x72"  "\x20"  "\x28"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x73"  "\x74"  "\x61"  "\x72"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x30"  "\x3b"  "\x20"  "\x73"  "\x74"  "\x61"  "\x72"  "\x74"  "\x20"  "\x3c"  "\x20"  "\x74"  "\x6f"  "\x74"  "\x61"  "\x6c"  "\x3b"  "\x20"  "\x73"  "\x74"  "\x61"  "\x72"  "\x74"  "\x20"  "\x2b"  "\x3d"  "\x20"  "\x44"  "\x49"  "\x50"  "\x4f"  "\x4c"  "\x41"  "\x52"  "\x5f"  "\x54"  "\x49"  "\x4c"  "\x45"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x6c"  "\x65"  "\x6e"  "\x20"  "\x3d"  "\x20"  "\x74"  "\x6f"  "\x74"  "\x61"  "\x6c"  "\x20"  "\x2d"  "\x20"  "\x73"  "\x74"  "\x61"  "\x72"  "\x74"  "\x20"  "\x3c"  "\x20"  "\x44"  "\x49"  "\x50"  "\x4f"  "\x4c"  "\x41"  "\x52"  "\x5f"  "\x54"  "\x49"  "\x4c"  "\x45"  "\x3f"  "\x20"  "\x74"  "\x6f"  "\x74"  "\x61"  "\x6c"  "\x20"  "\x2d"  "\x20"  "\x73"  "\x74"  "\x61"  "\x72"  "\x74"  "\x3a"  "\x20"  "\x44"  "\x49"  "\x50"  "\x4f"  "\x4c"  "\x41"  "\x52"  "\x5f"  "\x54"  "\x49"  "\x4c"  "\x45"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x62"  "\x61"  "\x72"  "\x72"  "\x69"  "\x65"  "\x72"  "\x28"  "\x43"  "\x4c"  "\x4b"  "\x5f"  "\x4c"  "\x4f"  "\x43"  "\x41"  "\x4c"  "\x5f"  "\x4d"  "\x45"  "\x4d"  "\x5f"  "\x46"  "\x45"  "\x4e"  "\x43"  "\x45"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x66"  "\x6f"  "\x72"  "\x20"  "\x28"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x6b"  "\x20"  "\x3d"  "\x20"  "\x6c"  "\x69"  "\x64"  "\x3b"  "\x20"  "\x6b"  "\x20"  "\x3c"  "\x20"  "\x6c"  "\x65"  "\x6e"  "\x3b"  "\x20"  "\x6b"  "\x20"  "\x2b"  "\x3d"  "\x20"  "\x6c"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x74"  "\x69"  "\x6c"  "\x65"  "\x5b"  "\x6b"  "\x5d"  "\x20"  "\x3d"  "\x20"  "\x74"  "\x61"  "\x62"  "\x6c"  "\x65"  "\x5b"  "\x73"  "\x74"  "\x61"  "\x72"  "\x74"  "\x20"  "\x2b"  "\x20"  "\x6b"  "\x5d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x62"  "\x61"  "\x72"  "\x72"  "\x69"  "\x65"  "\x72"  "\x28"  "\x43"  "\x4c"  "\x4b"  "\x5f"  "\x4c"  "\x4f"  "\x43"  "\x41"  "\x4c"  "\x5f"  "\x4d"  "\x45"  "\x4d"  "\x5f"  "\x46"  "\x45"  "\x4e"  "\x43"  "\x45"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x21"  "\x61"  "\x63"  "\x74"  "\x69"  "\x76"  "\x65"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x74"  "\x69"  "\x6e"  "\x75"  "\x65"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x66"  "\x6f"  "\x72"  "\x20"  "\x28"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x6b"  "\x20"  "\x3d"  "\x20"  "\x30"  "\x3b"  "\x20"  "\x6b"  "\x20"  "\x3c"  "\x20"  "\x6c"  "\x65"  "\x6e"  "\x3b"  "\x20"  "\x2b"  "\x2b"  "\x6b"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x64"  "\x72"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x73"  "\x74"  "\x61"  "\x72"  "\x74"  "\x20"  "\x2b"  "\x20"  "\x6b"  "\x29"  "\x20"  "\x2f"  "\x20"  "\x77"  "\x69"  "\x6e"  "\x64"  "\x6f"  "\x77"  "\x5f"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x20"  "\x2d"  "\x20"  "\x68"  "\x61"  "\x6c"  "\x66"  "\x5f"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x64"  "\x63"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x73"  "\x74"  "\x61"  "\x72"  "\x74"  "\x20"  "\x2b"  "\x20"  "\x6b"  "\x29"  "\x20"  "\x25"  "\x20"  "\x77"  "\x69"  "\x6e"  "\x64"  "\x6f"  "\x77"  "\x5f"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x20"  "\x2d"  "\x20"  "\x68"  "\x61"  "\x6c"  "\x66"  "\x5f"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6d"  "\x6a"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x73"  "\x69"  "\x74"  "\x65"  "\x5f"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x73"  "\x20"  "\x67"  "\x6a"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x61"  "\x70"  "\x70"  "\x6c"  "\x79"  "\x5f"  "\x70"  "\x62"  "\x63"  "\x5f"  "\x63"  "\x6f"  "\x6d"  "\x70"  "\x6c"  "\x65"  "\x74"  "\x65"  "\x28"  "\x67"  "\x73"  "\x2c"  "\x20"  "\x76"  "\x2c"  "\x20"  "\x26"  "\x6d"  "\x6a"  "\x2c"  "\x20"  "\x26"  "\x67"  "\x6a"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x70"  "\x62"  "\x63"  "\x2c"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2b"  "\x20"  "\x64"  "\x72"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x2b"  "\x20"  "\x64"  "\x63"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6d"  "\x6a"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x6d"  "\x6a"  "\x2c"  "\x20"  "\x67"  "\x6a"  "\x2e"  "\x6d"  "\x75"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x74"  "\x65"  "\x6e"  "\x73"  "\x6f"  "\x72"  "\x20"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x74"  "\x69"  "\x6c"  "\x65"  "\x5b"  "\x6b"  "\x5d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x2e"  "\x78"  "\x20"  "\x2b"  "\x3d"  "\x20"  "\x64"  "\x2e"  "\x78"  "\x78"  "\x20"  "\x2a"  "\x20"  "\x6d"  "\x6a"  "\x2e"  "\x78"  "\x20"  "\x2b"  "\x20"  "\x64"  "\x2e"  "\x78"  "\x79"  "\x20"  "\x2a"  "\x20"  "\x6d"  "\x6a"  "\x2e"  "\x79"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x2e"  "\x79"  "\x20"  "\x2b"  "\x3d"  "\x20"  "\x64"  "\x2e"  "\x78"  "\x79"  "\x20"  "\x2a"  "\x20"  "\x6d"  "\x6a"  "\x2e"  "\x78"  "\x20"  "\x2b"  "\x20"  "\x64"  "\x2e"  "\x79"  "\x79"  "\x20"  "\x2a"  "\x20"  "\x6d"  "\x6a"  "\x2e"  "\x79"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x2e"  "\x7a"  "\x20"  "\x2b"  "\x3d"  "\x20"  "\x64"  "\x2e"  "\x7a"  "\x7a"  "\x20"  "\x2a"  "\x20"  "\x6d"  "\x6a"  "\x2e"  "\x7a"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7d"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7d"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x72"  "\x65"  "\x74"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x2f"  "\x2f"  "\x67"  "\x72"  "\x61"  "\x64"  "\x69"  "\x65"  "\x6e"  "\x74"  "\x20"  "\x6f"  "\x66"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x20"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x20"  "\x77"  "\x69"  "\x74"  "\x68"  "\x20"  "\x72"  "\x65"  "\x73"  "\x70"  "\x65"  "\x63"  "\x74"  "\x20"  "\x74"  "\x6f"  "\x20"  "\x6d"  "\x5f"  "\x69"  "\x2c"  "\x20"  "\x72"  "\x65"  "\x61"  "\x64"  "\x79"  "\x20"  "\x74"  "\x6f"  "\x20"  "\x62"  "\x65"  "\x20"  "\x73"  "\x74"  "\x6f"  "\x72"  "\x65"  "\x64"  "\x20"  "\x69"  "\x6e"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x65"  "\x74"  "\x65"  "\x72"  "\x73"  "\x2e"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x0a"  "\x76"  "\x33"  "\x64"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x5f"  "\x66"  "\x72"  "\x6f"  "\x6d"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x76"  "\x33"  "\x64"  "\x20"  "\x73"  "\x75"  "\x6d"  "\x2c"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x73"  "\x69"  "\x74"  "\x65"  "\x5f"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x73"  "\x20"  "\x67"  "\x73"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x73"  "\x75"  "\x6d"  "\x2c"  "\x20"  "\x2d"  "\x4d"  "\x55"  "\x5f"  "\x30"  "\x20"  "\x2a"  "\x20"  "\x67"  "\x73"  "\x2e"  "\x6d"  "\x75"  "\x20"  "\x2f"  "\x20"  "\x28"  "\x34"  "\x2e"  "\x30"  "\x20"  "\x2a"  "\x20"  "\x4d"  "\x5f"  "\x50"  "\x49"  "\x20"  "\x2a"  "\x20"  "\x67"  "\x73"  "\x2e"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x20"  "\x2a"  "\x20"  "\x67"  "\x73"  "\x2e"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x20"  "\x2a"  "\x20"  "\x67"  "\x73"  "\x2e"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x23"  "\x65"  "\x6e"  "\x64"  "\x69"  "\x66"  "\x0a"  "\x0a"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x65"  "\x78"  "\x63"  "\x68"  "\x61"  "\x6e"  "\x67"  "\x65"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x65"  "\x74"  "\x65"  "\x72"  "\x73"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x2d"  "\x28"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x64"  "\x6f"  "\x74"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x29"  "\x20"  "\x2b"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x64"  "\x6f"  "\x74"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x29"  "\x20"  "\x2b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x64"  "\x6f"  "\x74"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x75"  "\x70"  "\x29"  "\x20"  "\x2b"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x64"  "\x6f"  "\x74"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x29"  "\x29"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x65"  "\x78"  "\x63"  "\x68"  "\x61"  "\x6e"  "\x67"  "\x65"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x64"  "\x6d"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x65"  "\x74"  "\x65"  "\x72"  "\x73"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x72"  "\x65"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x30"  "\x2e"  "\x30"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x20"  "\x2b"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x64"  "\x6f"  "\x74"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x64"  "\x6d"  "\x2e"  "\x64"  "\x6d"  "\x76"  "\x5f"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x72"  "\x6f"  "\x73"  "\x73"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x20"  "\x2b"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x64"  "\x6f"  "\x74"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x64"  "\x6d"  "\x2e"  "\x64"  "\x6d"  "\x76"  "\x5f"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x72"  "\x6f"  "\x73"  "\x73"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x20"  "\x2b"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x64"  "\x6f"  "\x74"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x64"  "\x6d"  "\x2e"  "\x64"  "\x6d"  "\x76"  "\x5f"  "\x75"  "\x70"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x72"  "\x6f"  "\x73"  "\x73"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x75"  "\x70"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x20"  "\x2b"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x64"  "\x6f"  "\x74"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x64"  "\x6d"  "\x2e"  "\x64"  "\x6d"  "\x76"  "\x5f"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x72"  "\x6f"  "\x73"  "\x73"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x2d"  "\x72"  "\x65"  "\x74"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x61"  "\x6e"  "\x69"  "\x73"  "\x6f"  "\x74"  "\x72"  "\x6f"  "\x70"  "\x79"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x65"  "\x74"  "\x65"  "\x72"  "\x73"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x64"  "\x6f"  "\x74"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x61"  "\x6e"  "\x69"  "\x2e"  "\x64"  "\x69"  "\x72"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x2d"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x61"  "\x6e"  "\x69"  "\x2e"  "\x61"  "\x6e"  "\x69"  "\x20"  "\x2a"  "\x20"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x20"  "\x2a"  "\x20"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x63"  "\x75"  "\x62"  "\x69"  "\x63"  "\x5f"  "\x61"  "\x6e"  "\x69"  "\x73"  "\x6f"  "\x74"  "\x72"  "\x6f"  "\x70"  "\x79"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x65"  "\x74"  "\x65"  "\x72"  "\x73"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x23"  "\x69"  "\x66"  "\x64"  "\x65"  "\x66"  "\x20"  "\x48"  "\x41"  "\x53"  "\x5f"  "\x43"  "\x55"  "\x42"  "\x49"  "\x43"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x2d"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2e"  "\x78"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2e"  "\x78"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2e"  "\x78"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2e"  "\x78"  "\x20"  "\x2b"  "\x20"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2e"  "\x79"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2e"  "\x79"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2e"  "\x79"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2e"  "\x79"  "\x20"  "\x2b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2e"  "\x7a"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2e"  "\x7a"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2e"  "\x7a"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2e"  "\x7a"  "\x29"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x63"  "\x75"  "\x62"  "\x69"  "\x63"  "\x5f"  "\x61"  "\x6e"  "\x69"  "\x3b"  "\x0a"  "\x23"  "\x65"  "\x6c"  "\x73"  "\x65"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x30"  "\x2e"  "\x30"  "\x3b"  "\x0a"  "\x23"  "\x65"  "\x6e"  "\x64"  "\x69"  "\x66"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x65"  "\x74"  "\x65"  "\x72"  "\x73"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x2d"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x6d"  "\x75"  "\x20"  "\x2a"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x64"  "\x6f"  "\x74"  "\x28"  "\x67"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x61"  "\x74"  "\x65"  "\x5f"  "\x6d"  "\x61"  "\x67"  "\x6e"  "\x65"  "\x74"  "\x69"  "\x63"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x74"  "\x69"  "\x6d"  "\x65"  "\x29"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x29"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x65"  "\x74"  "\x65"  "\x72"  "\x73"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x30"  "\x2e"  "\x35"  "\x20"  "\x2a"  "\x20"  "\x65"  "\x78"  "\x63"  "\x68"  "\x61"  "\x6e"  "\x67"  "\x65"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x29"  "\x20"  "\x2b"  "\x20"  "\x30"  "\x2e"  "\x35"  "\x20"  "\x2a"  "\x20"  "\x64"  "\x6d"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x29"  "\x20"  "\x2b"  "\x20"  "\x61"  "\x6e"  "\x69"  "\x73"  "\x6f"  "\x74"  "\x72"  "\x6f"  "\x70"  "\x79"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x29"  "\x20"  "\x2b"  "\x20"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x29"  "\x3b"  "\x0a"  "\x23"  "\x69"  "\x66"  "\x64"  "\x65"  "\x66"  "\x20"  "\x48"  "\x41"  "\x53"  "\x5f"  "\x43"  "\x55"  "\x42"  "\x49"  "\x43"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x65"  "\x20"  "\x2b"  "\x3d"  "\x20"  "\x63"  "\x75"  "\x62"  "\x69"  "\x63"  "\x5f"  "\x61"  "\x6e"  "\x69"  "\x73"  "\x6f"  "\x74"  "\x72"  "\x6f"  "\x70"  "\x79"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x29"  "\x3b"  "\x0a"  "\x23"  "\x65"  "\x6e"  "\x64"  "\x69"  "\x66"  "\x0a"  "\x23"  "\x69"  "\x66"  "\x64"  "\x65"  "\x66"  "\x20"  "\x49"  "\x4e"  "\x43"  "\x4c"  "\x55"  "\x44"  "\x45"  "\x5f"  "\x44"  "\x49"  "\x50"  "\x4f"  "\x4c"  "\x41"  "\x52"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x65"  "\x20"  "\x2b"  "\x3d"  "\x20"  "\x30"  "\x2e"  "\x35"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x3b"  "\x0a"  "\x23"  "\x65"  "\x6e"  "\x64"  "\x69"  "\x66"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x65"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x76"  "\x33"  "\x64"  "\x20"  "\x65"  "\x66"  "\x66"  "\x65"  "\x63"  "\x74"  "\x69"  "\x76"  "\x65"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x65"  "\x74"  "\x65"  "\x72"  "\x73"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x72"  "\x65"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x28"  "\x30"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x65"  "\x78"  "\x63"  "\x68"  "\x61"  "\x6e"  "\x67"  "\x65"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x29"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x75"  "\x70"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x65"  "\x78"  "\x63"  "\x68"  "\x61"  "\x6e"  "\x67"  "\x65"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x65"  "\x78"  "\x63"  "\x68"  "\x61"  "\x6e"  "\x67"  "\x65"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x65"  "\x78"  "\x63"  "\x68"  "\x61"  "\x6e"  "\x67"  "\x65"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x62"  "\x28"  "\x72"  "\x65"  "\x74"  "\x2c"  "\x20"  "\x65"  "\x78"  "\x63"  "\x68"  "\x61"  "\x6e"  "\x67"  "\x65"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x64"  "\x6d"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x5f"  "\x78"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x72"  "\x6f"  "\x73"  "\x73"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x64"  "\x6d"  "\x2e"  "\x64"  "\x6d"  "\x76"  "\x5f"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x29"  "\x2c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x72"  "\x6f"  "\x73"  "\x73"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x64"  "\x6d"  "\x2e"  "\x64"  "\x6d"  "\x76"  "\x5f"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x64"  "\x6d"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x5f"  "\x79"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x72"  "\x6f"  "\x73"  "\x73"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x64"  "\x6d"  "\x2e"  "\x64"  "\x6d"  "\x76"  "\x5f"  "\x75"  "\x70"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x75"  "\x70"  "\x29"  "\x2c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x72"  "\x6f"  "\x73"  "\x73"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x64"  "\x6d"  "\x2e"  "\x64"  "\x6d"  "\x76"  "\x5f"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x64"  "\x6d"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x64"  "\x6d"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x5f"  "\x78"  "\x2c"  "\x20"  "\x64"  "\x6d"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x5f"  "\x79"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x72"  "\x65"  "\x74"  "\x2c"  "\x20"  "\x64"  "\x6d"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x62"  "\x28"  "\x72"  "\x65"  "\x74"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x67"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x61"  "\x74"  "\x65"  "\x5f"  "\x6d"  "\x61"  "\x67"  "\x6e"  "\x65"  "\x74"  "\x69"  "\x63"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x74"  "\x69"  "\x6d"  "\x65"  "\x29"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x6d"  "\x75"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x62"  "\x28"  "\x72"  "\x65"  "\x74"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x61"  "\x6e"  "\x69"  "\x2e"  "\x64"  "\x69"  "\x72"  "\x2c"  "\x20"  "\x32"  "\x2e"  "\x30"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x61"  "\x6e"  "\x69"  "\x2e"  "\x61"  "\x6e"  "\x69"  "\x20"  "\x2a"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x64"  "\x6f"  "\x74"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x61"  "\x6e"  "\x69"  "\x2e"  "\x64"  "\x69"  "\x72"  "\x29"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x23"  "\x69"  "\x66"  "\x64"  "\x65"  "\x66"  "\x20"  "\x48"  "\x41"  "\x53"  "\x5f"  "\x43"  "\x55"  "\x42"  "\x49"  "\x43"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x62"  "\x28"  "\x72"  "\x65"  "\x74"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2e"  "\x78"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2e"  "\x78"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2e"  "\x78"  "\x2c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2e"  "\x79"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2e"  "\x79"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2e"  "\x79"  "\x2c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2e"  "\x7a"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2e"  "\x7a"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2e"  "\x7a"  "\x29"  "\x2c"  "\x20"  "\x34"  "\x2e"  "\x30"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x63"  "\x75"  "\x62"  "\x69"  "\x63"  "\x5f"  "\x61"  "\x6e"  "\x69"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x23"  "\x65"  "\x6e"  "\x64"  "\x69"  "\x66"  "\x0a"  "\x0a"  "\x23"  "\x69"  "\x66"  "\x64"  "\x65"  "\x66"  "\x20"  "\x49"  "\x4e"  "\x43"  "\x4c"  "\x55"  "\x44"  "\x45"  "\x5f"  "\x44"  "\x49"  "\x50"  "\x4f"  "\x4c"  "\x41"  "\x52"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x72"  "\x65"  "\x74"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x29"  "\x3b"  "\x0a"  "\x23"  "\x65"  "\x6e"  "\x64"  "\x69"  "\x66"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x72"  "\x65"  "\x74"  "\x2c"  "\x20"  "\x2d"  "\x31"  "\x2e"  "\x30"  "\x20"  "\x2f"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x6d"  "\x75"  "\x29"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x2f"  "\x2f"  "\x40"  "\x54"  "\x4f"  "\x44"  "\x4f"  "\x3a"  "\x20"  "\x41"  "\x64"  "\x64"  "\x20"  "\x5a"  "\x20"  "\x66"  "\x69"  "\x6e"  "\x69"  "\x74"  "\x65"  "\x0a"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x64"  "\x6f"  "\x74"  "\x5f"  "\x67"  "\x72"  "\x61"  "\x64"  "\x28"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x2c"  "\x20"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x62"  "\x6f"  "\x72"  "\x73"  "\x5f"  "\x73"  "\x65"  "\x74"  "\x20"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x64"  "\x78"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x64"  "\x79"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x72"  "\x65"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x7b"  "\x30"  "\x7d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x2e"  "\x78"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x2e"  "\x78"  "\x20"  "\x2a"  "\x20"  "\x28"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x2e"  "\x78"  "\x20"  "\x2d"  "\x20"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x2e"  "\x78"  "\x29"  "\x20"  "\x2f"  "\x20"  "\x28"  "\x32"  "\x2e"  "\x30"  "\x20"  "\x2a"  "\x20"  "\x64"  "\x78"  "\x29"  "\x20"  "\x2b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x2e"  "\x79"  "\x20"  "\x2a"  "\x20"  "\x28"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x75"  "\x70"  "\x2e"  "\x78"  "\x20"  "\x2d"  "\x20"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x2e"  "\x78"  "\x29"  "\x20"  "\x2f"  "\x20"  "\x28"  "\x32"  "\x2e"  "\x30"  "\x20"  "\x2a"  "\x20"  "\x64"  "\x79"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x2e"  "\x79"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x2e"  "\x78"  "\x20"  "\x2a"  "\x20"  "\x28"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x2e"  "\x79"  "\x20"  "\x2d"  "\x20"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x2e"  "\x79"  "\x29"  "\x20"  "\x2f"  "\x20"  "\x28"  "\x32"  "\x2e"  "\x30"  "\x20"  "\x2a"  "\x20"  "\x64"  "\x78"  "\x29"  "\x20"  "\x2b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x2e"  "\x79"  "\x20"  "\x2a"  "\x20"  "\x28"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x75"  "\x70"  "\x2e"  "\x79"  "\x20"  "\x2d"  "\x20"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x2e"  "\x79"  "\x29"  "\x20"  "\x2f"  "\x20"  "\x28"  "\x32"  "\x2e"  "\x30"  "\x20"  "\x2a"  "\x20"  "\x64"  "\x79"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x2e"  "\x7a"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x2e"  "\x78"  "\x20"  "\x2a"  "\x20"  "\x28"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x2e"  "\x7a"  "\x20"  "\x2d"  "\x20"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x2e"  "\x7a"  "\x29"  "\x20"  "\x2f"  "\x20"  "\x28"  "\x32"  "\x2e"  "\x30"  "\x20"  "\x2a"  "\x20"  "\x64"  "\x78"  "\x29"  "\x20"  "\x2b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x2e"  "\x79"  "\x20"  "\x2a"  "\x20"  "\x28"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x75"  "\x70"  "\x2e"  "\x7a"  "\x20"  "\x2d"  "\x20"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x2e"  "\x7a"  "\x29"  "\x20"  "\x2f"  "\x20"  "\x28"  "\x32"  "\x2e"  "\x30"  "\x20"  "\x2a"  "\x20"  "\x64"  "\x79"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x72"  "\x65"  "\x74"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x76"  "\x33"  "\x64"  "\x20"  "\x64"  "\x6d"  "\x5f"  "\x64"  "\x74"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x65"  "\x74"  "\x65"  "\x72"  "\x73"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x64"  "\x74"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x48"  "\x5f"  "\x65"  "\x66"  "\x66"  "\x20"  "\x3d"  "\x20"  "\x65"  "\x66"  "\x66"  "\x65"  "\x63"  "\x74"  "\x69"  "\x76"  "\x65"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x48"  "\x5f"  "\x65"  "\x66"  "\x66"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x48"  "\x5f"  "\x65"  "\x66"  "\x66"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x74"  "\x65"  "\x6d"  "\x70"  "\x65"  "\x72"  "\x61"  "\x74"  "\x75"  "\x72"  "\x65"  "\x5f"  "\x65"  "\x66"  "\x66"  "\x65"  "\x63"  "\x74"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x72"  "\x6f"  "\x73"  "\x73"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2c"  "\x20"  "\x48"  "\x5f"  "\x65"  "\x66"  "\x66"  "\x29"  "\x2c"  "\x20"  "\x2d"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x67"  "\x61"  "\x6d"  "\x6d"  "\x61"  "\x29"  "\x3b"  "\x0a"  "\x23"  "\x69"  "\x66"  "\x20"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x64"  "\x28"  "\x48"  "\x41"  "\x53"  "\x5f"  "\x53"  "\x54"  "\x54"  "\x29"  "\x20"  "\x7c"  "\x7c"  "\x20"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x64"  "\x28"  "\x48"  "\x41"  "\x53"  "\x5f"  "\x53"  "\x48"  "\x45"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x75"  "\x72"  "\x72"  "\x65"  "\x6e"  "\x74"  "\x20"  "\x63"  "\x75"  "\x72"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x61"  "\x74"  "\x65"  "\x5f"  "\x63"  "\x75"  "\x72"  "\x72"  "\x65"  "\x6e"  "\x74"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x74"  "\x69"  "\x6d"  "\x65"  "\x29"  "\x3b"  "\x0a"  "\x23"  "\x65"  "\x6e"  "\x64"  "\x69"  "\x66"  "\x0a"  "\x0a"  "\x23"  "\x69"  "\x66"  "\x64"  "\x65"  "\x66"  "\x20"  "\x48"  "\x41"  "\x53"  "\x5f"  "\x53"  "\x54"  "\x54"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x63"  "\x75"  "\x72"  "\x2e"  "\x74"  "\x79"  "\x70"  "\x65"  "\x20"  "\x26"  "\x20"  "\x43"  "\x55"  "\x52"  "\x5f"  "\x53"  "\x54"  "\x54"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x63"  "\x6f"  "\x6d"  "\x6d"  "\x6f"  "\x6e"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x64"  "\x6f"  "\x74"  "\x5f"  "\x67"  "\x72"  "\x61"  "\x64"  "\x28"  "\x63"  "\x75"  "\x72"  "\x2e"  "\x73"  "\x74"  "\x74"  "\x2e"  "\x6a"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6d"  "\x6d"  "\x6f"  "\x6e"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x63"  "\x6f"  "\x6d"  "\x6d"  "\x6f"  "\x6e"  "\x2c"  "\x20"  "\x63"  "\x75"  "\x72"  "\x2e"  "\x73"  "\x74"  "\x74"  "\x2e"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x69"  "\x7a"  "\x61"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x20"  "\x2f"  "\x20"  "\x28"  "\x32"  "\x2e"  "\x30"  "\x20"  "\x2a"  "\x20"  "\x51"  "\x45"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x62"  "\x65"  "\x74"  "\x61"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x72"  "\x6f"  "\x73"  "\x73"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6d"  "\x6d"  "\x6f"  "\x6e"  "\x29"  "\x2c"  "\x20"  "\x63"  "\x75"  "\x72"  "\x2e"  "\x73"  "\x74"  "\x74"  "\x2e"  "\x62"  "\x65"  "\x74"  "\x61"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x76"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x62"  "\x28"  "\x63"  "\x6f"  "\x6d"  "\x6d"  "\x6f"  "\x6e"  "\x2c"  "\x20"  "\x62"  "\x65"  "\x74"  "\x61"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7d"  "\x0a"  "\x23"  "\x65"  "\x6e"  "\x64"  "\x69"  "\x66"  "\x0a"  "\x0a"  "\x23"  "\x69"  "\x66"  "\x64"  "\x65"  "\x66"  "\x20"  "\x48"  "\x41"  "\x53"  "\x5f"  "\x53"  "\x48"  "\x45"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x63"  "\x75"  "\x72"  "\x2e"  "\x74"  "\x79"  "\x70"  "\x65"  "\x20"  "\x26"  "\x20"  "\x43"  "\x55"  "\x52"  "\x5f"  "\x53"  "\x48"  "\x45"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x63"  "\x6f"  "\x6d"  "\x6d"  "\x6f"  "\x6e"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x72"  "\x6f"  "\x73"  "\x73"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2c"  "\x20"  "\x63"  "\x75"  "\x72"  "\x2e"  "\x73"  "\x68"  "\x65"  "\x2e"  "\x70"  "\x29"  "\x2c"  "\x20"  "\x48"  "\x42"  "\x41"  "\x52"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x67"  "\x61"  "\x6d"  "\x6d"  "\x61"  "\x20"  "\x2a"  "\x20"  "\x63"  "\x75"  "\x72"  "\x2e"  "\x73"  "\x68"  "\x65"  "\x2e"  "\x74"  "\x68"  "\x65"  "\x74"  "\x61"  "\x5f"  "\x73"  "\x68"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x20"  "\x2f"  "\x20"  "\x28"  "\x32"  "\x2e"  "\x30"  "\x20"  "\x2a"  "\x20"  "\x51"  "\x45"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x6d"  "\x75"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x62"  "\x65"  "\x74"  "\x61"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x63"  "\x6f"  "\x6d"  "\x6d"  "\x6f"  "\x6e"  "\x2c"  "\x20"  "\x63"  "\x75"  "\x72"  "\x2e"  "\x73"  "\x74"  "\x74"  "\x2e"  "\x62"  "\x65"  "\x74"  "\x61"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x76"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x62"  "\x28"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x72"  "\x6f"  "\x73"  "\x73"  "\x28"  "\x63"  "\x6f"  "\x6d"  "\x6d"  "\x6f"  "\x6e"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x29"  "\x2c"  "\x20"  "\x62"  "\x65"  "\x74"  "\x61"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7d"  "\x0a"  "\x23"  "\x65"  "\x6e"  "\x64"  "\x69"  "\x66"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x76"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x72"  "\x6f"  "\x73"  "\x73"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2c"  "\x20"  "\x76"  "\x29"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x61"  "\x6c"  "\x70"  "\x68"  "\x61"  "\x29"  "\x29"  "\x2c"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x20"  "\x2f"  "\x20"  "\x28"  "\x31"  "\x2e"  "\x30"  "\x20"  "\x2b"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x61"  "\x6c"  "\x70"  "\x68"  "\x61"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x61"  "\x6c"  "\x70"  "\x68"  "\x61"  "\x29"  "\x20"  "\x2a"  "\x20"  "\x64"  "\x74"  "\x29"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x2f"  "\x2f"  "\x40"  "\x54"  "\x4f"  "\x44"  "\x4f"  "\x3a"  "\x20"  "\x69"  "\x6d"  "\x70"  "\x6c"  "\x65"  "\x6d"  "\x65"  "\x6e"  "\x74"  "\x20"  "\x52"  "\x4b"  "\x32"  "\x20"  "\x61"  "\x6e"  "\x64"  "\x20"  "\x65"  "\x75"  "\x6c"  "\x65"  "\x72"  "\x0a"  "\x76"  "\x33"  "\x64"  "\x20"  "\x73"  "\x74"  "\x65"  "\x70"  "\x5f"  "\x6c"  "\x6c"  "\x67"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x65"  "\x74"  "\x65"  "\x72"  "\x73"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x64"  "\x74"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x72"  "\x6b"  "\x31"  "\x2c"  "\x20"  "\x72"  "\x6b"  "\x32"  "\x2c"  "\x20"  "\x72"  "\x6b"  "\x33"  "\x2c"  "\x20"  "\x72"  "\x6b"  "\x34"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x63"  "\x5f"  "\x6f"  "\x72"  "\x69"  "\x20"  "\x3d"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x74"  "\x69"  "\x6d"  "\x65"  "\x5f"  "\x6f"  "\x72"  "\x69"  "\x20"  "\x3d"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x74"  "\x69"  "\x6d"  "\x65"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x6b"  "\x31"  "\x20"  "\x3d"  "\x20"  "\x64"  "\x6d"  "\x5f"  "\x64"  "\x74"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2c"  "\x20"  "\x64"  "\x74"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x63"  "\x5f"  "\x6f"  "\x72"  "\x69"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x72"  "\x6b"  "\x31"  "\x2c"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x20"  "\x2f"  "\x20"  "\x32"  "\x2e"  "\x30"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x74"  "\x69"  "\x6d"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x74"  "\x69"  "\x6d"  "\x65"  "\x5f"  "\x6f"  "\x72"  "\x69"  "\x20"  "\x2b"  "\x20"  "\x64"  "\x74"  "\x20"  "\x2f"  "\x20"  "\x32"  "\x2e"  "\x30"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x6b"  "\x32"  "\x20"  "\x3d"  "\x20"  "\x64"  "\x6d"  "\x5f"  "\x64"  "\x74"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2c"  "\x20"  "\x64"  "\x74"  "\x20"  "\x2f"  "\x20"  "\x32"  "\x2e"  "\x30"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x63"  "\x5f"  "\x6f"  "\x72"  "\x69"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x72"  "\x6b"  "\x32"  "\x2c"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x20"  "\x2f"  "\x20"  "\x32"  "\x2e"  "\x30"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x74"  "\x69"  "\x6d"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x74"  "\x69"  "\x6d"  "\x65"  "\x5f"  "\x6f"  "\x72"  "\x69"  "\x20"  "\x2b"  "\x20"  "\x64"  "\x74"  "\x20"  "\x2f"  "\x20"  "\x32"  "\x2e"  "\x30"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x6b"  "\x33"  "\x20"  "\x3d"  "\x20"  "\x64"  "\x6d"  "\x5f"  "\x64"  "\x74"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2c"  "\x20"  "\x64"  "\x74"  "\x20"  "\x2f"  "\x20"  "\x32"  "\x2e"  "\x30"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x63"  "\x5f"  "\x6f"  "\x72"  "\x69"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x72"  "\x6b"  "\x33"  "\x2c"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x74"  "\x69"  "\x6d"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x74"  "\x69"  "\x6d"  "\x65"  "\x5f"  "\x6f"  "\x72"  "\x69"  "\x20"  "\x2b"  "\x20"  "\x64"  "\x74"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x6b"  "\x34"  "\x20"  "\x3d"  "\x20"  "\x64"  "\x6d"  "\x5f"  "\x64"  "\x74"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2c"  "\x20"  "\x64"  "\x74"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x72"  "\x6b"  "\x31"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x72"  "\x6b"  "\x32"  "\x2c"  "\x20"  "\x32"  "\x2e"  "\x30"  "\x29"  "\x29"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x72"  "\x6b"  "\x33"  "\x2c"  "\x20"  "\x32"  "\x2e"  "\x30"  "\x29"  "\x2c"  "\x20"  "\x72"  "\x6b"  "\x34"  "\x29"  "\x29"  "\x2c"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x20"  "\x2f"  "\x20"  "\x36"  "\x2e"  "\x30"  "\x29"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x2f"  "\x2f"  "\x72"  "\x6f"  "\x74"  "\x61"  "\x74"  "\x65"  "\x73"  "\x20"  "\x6d"  "\x20"  "\x62"  "\x79"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x43"  "\x61"  "\x79"  "\x6c"  "\x65"  "\x79"  "\x20"  "\x74"  "\x72"  "\x61"  "\x6e"  "\x73"  "\x66"  "\x6f"  "\x72"  "\x6d"  "\x20"  "\x6f"  "\x66"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x72"  "\x6f"  "\x74"  "\x61"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x20"  "\x76"  "\x65"  "\x63"  "\x74"  "\x6f"  "\x72"  "\x20"  "\x6f"  "\x6d"  "\x65"  "\x67"  "\x61"  "\x20"  "\x28"  "\x61"  "\x6c"  "\x72"  "\x65"  "\x61"  "\x64"  "\x79"  "\x20"  "\x6d"  "\x75"  "\x6c"  "\x74"  "\x69"  "\x70"  "\x6c"  "\x69"  "\x65"  "\x64"  "\x20"  "\x62"  "\x79"  "\x20"  "\x64"  "\x74"  "\x29"  "\x0a"  "\x2f"  "\x2f"  "\x6d"  "\x27"  "\x20"  "\x3d"  "\x20"  "\x6d"  "\x20"  "\x2b"  "\x20"  "\x6f"  "\x6d"  "\x65"  "\x67"  "\x61"  "\x20"  "\x78"  "\x20"  "\x28"  "\x6d"  "\x20"  "\x2b"  "\x20"  "\x6d"  "\x27"  "\x29"  "\x20"  "\x2f"  "\x20"  "\x32"  "\x2c"  "\x20"  "\x73"  "\x6f"  "\x6c"  "\x76"  "\x65"  "\x64"  "\x20"  "\x65"  "\x78"  "\x70"  "\x6c"  "\x69"  "\x63"  "\x69"  "\x74"  "\x6c"  "\x79"  "\x2e"  "\x20"  "\x45"  "\x78"  "\x61"  "\x63"  "\x74"  "\x20"  "\x72"  "\x6f"  "\x74"  "\x61"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x2c"  "\x20"  "\x73"  "\x6f"  "\x20"  "\x7c"  "\x6d"  "\x27"  "\x7c"  "\x20"  "\x3d"  "\x20"  "\x7c"  "\x6d"  "\x7c"  "\x0a"  "\x76"  "\x33"  "\x64"  "\x20"  "\x63"  "\x61"  "\x79"  "\x6c"  "\x65"  "\x79"  "\x5f"  "\x72"  "\x6f"  "\x74"  "\x61"  "\x74"  "\x65"  "\x28"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6d"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6f"  "\x6d"  "\x65"  "\x67"  "\x61"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x61"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x6f"  "\x6d"  "\x65"  "\x67"  "\x61"  "\x2c"  "\x20"  "\x30"  "\x2e"  "\x35"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x61"  "\x32"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x64"  "\x6f"  "\x74"  "\x28"  "\x61"  "\x2c"  "\x20"  "\x61"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x72"  "\x65"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x6d"  "\x2c"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x20"  "\x2d"  "\x20"  "\x61"  "\x32"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x72"  "\x65"  "\x74"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x72"  "\x6f"  "\x73"  "\x73"  "\x28"  "\x61"  "\x2c"  "\x20"  "\x6d"  "\x29"  "\x2c"  "\x20"  "\x32"  "\x2e"  "\x30"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x72"  "\x65"  "\x74"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x61"  "\x2c"  "\x20"  "\x32"  "\x2e"  "\x30"  "\x20"  "\x2a"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x64"  "\x6f"  "\x74"  "\x28"  "\x61"  "\x2c"  "\x20"  "\x6d"  "\x29"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x72"  "\x65"  "\x74"  "\x2c"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x20"  "\x2f"  "\x20"  "\x28"  "\x31"  "\x2e"  "\x30"  "\x20"  "\x2b"  "\x20"  "\x61"  "\x32"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x2f"  "\x2f"  "\x53"  "\x65"  "\x6d"  "\x69"  "\x2d"  "\x69"  "\x6d"  "\x70"  "\x6c"  "\x69"  "\x63"  "\x69"  "\x74"  "\x20"  "\x6d"  "\x69"  "\x64"  "\x70"  "\x6f"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x28"  "\x4d"  "\x65"  "\x6e"  "\x74"  "\x69"  "\x6e"  "\x6b"  "\x20"  "\x65"  "\x74"  "\x20"  "\x61"  "\x6c"  "\x2e"  "\x20"  "\x32"  "\x30"  "\x31"  "\x30"  "\x29"  "\x2e"  "\x20"  "\x4e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x62"  "\x6f"  "\x72"  "\x73"  "\x20"  "\x61"  "\x72"  "\x65"  "\x20"  "\x6b"  "\x65"  "\x70"  "\x74"  "\x20"  "\x66"  "\x69"  "\x78"  "\x65"  "\x64"  "\x20"  "\x64"  "\x75"  "\x72"  "\x69"  "\x6e"  "\x67"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x73"  "\x74"  "\x65"  "\x70"  "\x2c"  "\x20"  "\x73"  "\x61"  "\x6d"  "\x65"  "\x20"  "\x61"  "\x73"  "\x20"  "\x73"  "\x74"  "\x65"  "\x70"  "\x5f"  "\x6c"  "\x6c"  "\x67"  "\x2e"  "\x0a"  "\x2f"  "\x2f"  "\x54"  "\x68"  "\x65"  "\x20"  "\x74"  "\x6f"  "\x72"  "\x71"  "\x75"  "\x65"  "\x20"  "\x54"  "\x20"  "\x3d"  "\x20"  "\x64"  "\x6d"  "\x5f"  "\x64"  "\x74"  "\x20"  "\x69"  "\x73"  "\x20"  "\x77"  "\x72"  "\x69"  "\x74"  "\x74"  "\x65"  "\x6e"  "\x20"  "\x61"  "\x73"  "\x20"  "\x61"  "\x20"  "\x72"  "\x6f"  "\x74"  "\x61"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x20"  "\x6f"  "\x6d"  "\x65"  "\x67"  "\x61"  "\x20"  "\x3d"  "\x20"  "\x6d"  "\x20"  "\x78"  "\x20"  "\x54"  "\x20"  "\x61"  "\x72"  "\x6f"  "\x75"  "\x6e"  "\x64"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x70"  "\x6f"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x77"  "\x68"  "\x65"  "\x72"  "\x65"  "\x20"  "\x69"  "\x74"  "\x20"  "\x77"  "\x61"  "\x73"  "\x20"  "\x65"  "\x76"  "\x61"  "\x6c"  "\x75"  "\x61"  "\x74"  "\x65"  "\x64"  "\x0a"  "\x2f"  "\x2f"  "\x52"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x73"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x6e"  "\x65"  "\x77"  "\x20"  "\x73"  "\x70"  "\x69"  "\x6e"  "\x2c"  "\x20"  "\x6e"  "\x6f"  "\x74"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x69"  "\x6e"  "\x63"  "\x72"  "\x65"  "\x6d"  "\x65"  "\x6e"  "\x74"  "\x0a"  "\x76"  "\x33"  "\x64"  "\x20"  "\x73"  "\x74"  "\x65"  "\x70"  "\x5f"  "\x6c"  "\x6c"  "\x67"  "\x5f"  "\x6d"  "\x69"  "\x64"  "\x70"  "\x6f"  "\x69"  "\x6e"  "\x74"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x65"  "\x74"  "\x65"  "\x72"  "\x73"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x64"  "\x74"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6d"  "\x30"  "\x20"  "\x3d"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x74"  "\x69"  "\x6d"  "\x65"  "\x5f"  "\x6f"  "\x72"  "\x69"  "\x20"  "\x3d"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x74"  "\x69"  "\x6d"  "\x65"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6f"  "\x6d"  "\x65"  "\x67"  "\x61"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x72"  "\x6f"  "\x73"  "\x73"  "\x28"  "\x6d"  "\x30"  "\x2c"  "\x20"  "\x64"  "\x6d"  "\x5f"  "\x64"  "\x74"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2c"  "\x20"  "\x64"  "\x74"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x70"  "\x72"  "\x65"  "\x64"  "\x69"  "\x63"  "\x74"  "\x6f"  "\x72"  "\x20"  "\x3d"  "\x20"  "\x63"  "\x61"  "\x79"  "\x6c"  "\x65"  "\x79"  "\x5f"  "\x72"  "\x6f"  "\x74"  "\x61"  "\x74"  "\x65"  "\x28"  "\x6d"  "\x30"  "\x2c"  "\x20"  "\x6f"  "\x6d"  "\x65"  "\x67"  "\x61"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x6e"  "\x6f"  "\x72"  "\x6d"  "\x61"  "\x6c"  "\x69"  "\x7a"  "\x65"  "\x28"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x6d"  "\x30"  "\x2c"  "\x20"  "\x70"  "\x72"  "\x65"  "\x64"  "\x69"  "\x63"  "\x74"  "\x6f"  "\x72"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x74"  "\x69"  "\x6d"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x74"  "\x69"  "\x6d"  "\x65"  "\x5f"  "\x6f"  "\x72"  "\x69"  "\x20"  "\x2b"  "\x20"  "\x64"  "\x74"  "\x20"  "\x2f"  "\x20"  "\x32"  "\x2e"  "\x30"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6f"  "\x6d"  "\x65"  "\x67"  "\x61"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x72"  "\x6f"  "\x73"  "\x73"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2c"  "\x20"  "\x64"  "\x6d"  "\x5f"  "\x64"  "\x74"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2c"  "\x20"  "\x64"  "\x74"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x63"  "\x61"  "\x79"  "\x6c"  "\x65"  "\x79"  "\x5f"  "\x72"  "\x6f"  "\x74"  "\x61"  "\x74"  "\x65"  "\x28"  "\x6d"  "\x30"  "\x2c"  "\x20"  "\x6f"  "\x6d"  "\x65"  "\x67"  "\x61"  "\x29"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x5f"  "\x66"  "\x69"  "\x6e"  "\x69"  "\x74"  "\x65"  "\x28"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6d"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x75"  "\x70"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x64"  "\x6f"  "\x74"  "\x28"  "\x6d"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x72"  "\x6f"  "\x73"  "\x73"  "\x28"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x62"  "\x28"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x2c"  "\x20"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x29"  "\x2c"  "\x20"  "\x30"  "\x2e"  "\x35"  "\x29"  "\x2c"  "\x20"  "\x2f"  "\x2f"  "\x78"  "\x20"  "\x66"  "\x69"  "\x6e"  "\x69"  "\x74"  "\x65"  "\x20"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x65"  "\x64"  "\x20"  "\x62"  "\x79"  "\x20"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x62"  "\x28"  "\x75"  "\x70"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x29"  "\x2c"  "\x20"  "\x30"  "\x2e"  "\x35"  "\x29"  "\x20"  "\x20"  "\x2f"  "\x2f"  "\x79"  "\x20"  "\x66"  "\x69"  "\x6e"  "\x69"  "\x74"  "\x65"  "\x20"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x65"  "\x64"  "\x20"  "\x62"  "\x79"  "\x20"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x29"  "\x29"  "\x20"  "\x2a"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x20"  "\x2f"  "\x20"  "\x28"  "\x34"  "\x2e"  "\x30"  "\x20"  "\x2a"  "\x20"  "\x4d"  "\x5f"  "\x50"  "\x49"  "\x29"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x0a"  "\x2f"  "\x2f"  "\x68"  "\x74"  "\x74"  "\x70"  "\x73"  "\x3a"  "\x2f"  "\x2f"  "\x69"  "\x6f"  "\x70"  "\x73"  "\x63"  "\x69"  "\x65"  "\x6e"  "\x63"  "\x65"  "\x2e"  "\x69"  "\x6f"  "\x70"  "\x2e"  "\x6f"  "\x72"  "\x67"  "\x2f"  "\x61"  "\x72"  "\x74"  "\x69"  "\x63"  "\x6c"  "\x65"  "\x2f"  "\x31"  "\x30"  "\x2e"  "\x31"  "\x30"  "\x38"  "\x38"  "\x2f"  "\x32"  "\x36"  "\x33"  "\x33"  "\x2d"  "\x31"  "\x33"  "\x35"  "\x37"  "\x2f"  "\x61"  "\x62"  "\x61"  "\x64"  "\x30"  "\x63"  "\x2f"  "\x70"  "\x64"  "\x66"  "\x0a"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x71"  "\x5f"  "\x69"  "\x6a"  "\x6b"  "\x28"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6d"  "\x69"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6d"  "\x6a"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6d"  "\x6b"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x6e"  "\x75"  "\x6d"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x64"  "\x6f"  "\x74"  "\x28"  "\x6d"  "\x69"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x72"  "\x6f"  "\x73"  "\x73"  "\x28"  "\x6d"  "\x6a"  "\x2c"  "\x20"  "\x6d"  "\x6b"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x64"  "\x65"  "\x6e"  "\x20"  "\x3d"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x20"  "\x2b"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x64"  "\x6f"  "\x74"  "\x28"  "\x6d"  "\x69"  "\x2c"  "\x20"  "\x6d"  "\x6a"  "\x29"  "\x20"  "\x2b"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x64"  "\x6f"  "\x74"  "\x28"  "\x6d"  "\x69"  "\x2c"  "\x20"  "\x6d"  "\x6b"  "\x29"  "\x20"  "\x2b"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x64"  "\x6f"  "\x74"  "\x28"  "\x6d"  "\x6a"  "\x2c"  "\x20"  "\x6d"  "\x6b"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x32"  "\x2e"  "\x30"  "\x20"  "\x2a"  "\x20"  "\x61"  "\x74"  "\x61"  "\x6e"  "\x32"  "\x28"  "\x6e"  "\x75"  "\x6d"  "\x2c"  "\x20"  "\x64"  "\x65"  "\x6e"  "\x29"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x2f"  "\x2a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x28"  "\x5f"  "\x5f"  "\x29"  "\x2d"  "\x2d"  "\x2d"  "\x28"  "\x6d"  "\x32"  "\x29"  "\x2d"  "\x2d"  "\x2d"  "\x28"  "\x5f"  "\x5f"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7c"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7c"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7c"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7c"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x28"  "\x6d"  "\x33"  "\x29"  "\x2d"  "\x2d"  "\x2d"  "\x28"  "\x6d"  "\x30"  "\x29"  "\x2d"  "\x2d"  "\x2d"  "\x28"  "\x6d"  "\x31"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7c"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7c"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7c"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7c"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x28"  "\x5f"  "\x5f"  "\x29"  "\x2d"  "\x2d"  "\x2d"  "\x28"  "\x6d"  "\x34"  "\x29"  "\x2d"  "\x2d"  "\x2d"  "\x28"  "\x5f"  "\x5f"  "\x29"  "\x0a"  "\x2a"  "\x2f"  "\x0a"  "\x0a"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x5f"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x28"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6d"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x75"  "\x70"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x71"  "\x5f"  "\x30"  "\x31"  "\x32"  "\x20"  "\x3d"  "\x20"  "\x71"  "\x5f"  "\x69"  "\x6a"  "\x6b"  "\x28"  "\x6d"  "\x2c"  "\x20"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x2c"  "\x20"  "\x75"  "\x70"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x71"  "\x5f"  "\x30"  "\x32"  "\x33"  "\x20"  "\x3d"  "\x20"  "\x71"  "\x5f"  "\x69"  "\x6a"  "\x6b"  "\x28"  "\x6d"  "\x2c"  "\x20"  "\x75"  "\x70"  "\x2c"  "\x20"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x71"  "\x5f"  "\x30"  "\x33"  "\x34"  "\x20"  "\x3d"  "\x20"  "\x71"  "\x5f"  "\x69"  "\x6a"  "\x6b"  "\x28"  "\x6d"  "\x2c"  "\x20"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x71"  "\x5f"  "\x30"  "\x34"  "\x31"  "\x20"  "\x3d"  "\x20"  "\x71"  "\x5f"  "\x69"  "\x6a"  "\x6b"  "\x28"  "\x6d"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x2c"  "\x20"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x20"  "\x2f"  "\x20"  "\x28"  "\x38"  "\x2e"  "\x30"  "\x20"  "\x2a"  "\x20"  "\x4d"  "\x5f"  "\x50"  "\x49"  "\x29"  "\x20"  "\x2a"  "\x20"  "\x28"  "\x71"  "\x5f"  "\x30"  "\x31"  "\x32"  "\x20"  "\x2b"  "\x20"  "\x71"  "\x5f"  "\x30"  "\x32"  "\x33"  "\x20"  "\x2b"  "\x20"  "\x71"  "\x5f"  "\x30"  "\x33"  "\x34"  "\x20"  "\x2b"  "\x20"  "\x71"  "\x5f"  "\x30"  "\x34"  "\x31"  "\x29"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x76"  "\x33"  "\x64"  "\x20"  "\x65"  "\x6d"  "\x65"  "\x72"  "\x67"  "\x65"  "\x6e"  "\x74"  "\x5f"  "\x6d"  "\x61"  "\x67"  "\x6e"  "\x65"  "\x74"  "\x69"  "\x63"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x5f"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x28"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6d"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x75"  "\x70"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x28"  "\x30"  "\x2e"  "\x30"  "\x2c"  "\x20"  "\x30"  "\x2e"  "\x30"  "\x2c"  "\x20"  "\x34"  "\x2e"  "\x30"  "\x20"  "\x2a"  "\x20"  "\x4d"  "\x5f"  "\x50"  "\x49"  "\x20"  "\x2a"  "\x20"  "\x48"  "\x42"  "\x41"  "\x52"  "\x20"  "\x2f"  "\x20"  "\x51"  "\x45"  "\x20"  "\x2a"  "\x20"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x5f"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x28"  "\x6d"  "\x2c"  "\x20"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x2c"  "\x20"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x2c"  "\x20"  "\x75"  "\x70"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x76"  "\x33"  "\x64"  "\x20"  "\x65"  "\x6d"  "\x65"  "\x72"  "\x67"  "\x65"  "\x6e"  "\x74"  "\x5f"  "\x6d"  "\x61"  "\x67"  "\x6e"  "\x65"  "\x74"  "\x69"  "\x63"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x5f"  "\x66"  "\x69"  "\x6e"  "\x69"  "\x74"  "\x65"  "\x28"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6d"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x75"  "\x70"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x28"  "\x30"  "\x2e"  "\x30"  "\x2c"  "\x20"  "\x30"  "\x2e"  "\x30"  "\x2c"  "\x20"  "\x34"  "\x2e"  "\x30"  "\x20"  "\x2a"  "\x20"  "\x4d"  "\x5f"  "\x50"  "\x49"  "\x20"  "\x2a"  "\x20"  "\x48"  "\x42"  "\x41"  "\x52"  "\x20"  "\x2f"  "\x20"  "\x51"  "\x45"  "\x20"  "\x2a"  "\x20"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x5f"  "\x66"  "\x69"  "\x6e"  "\x69"  "\x74"  "\x65"  "\x28"  "\x6d"  "\x2c"  "\x20"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x2c"  "\x20"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x2c"  "\x20"  "\x75"  "\x70"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x76"  "\x33"  "\x64"  "\x20"  "\x65"  "\x6d"  "\x65"  "\x72"  "\x67"  "\x65"  "\x6e"  "\x74"  "\x5f"  "\x65"  "\x6c"  "\x65"  "\x63"  "\x74"  "\x72"  "\x69"  "\x63"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x28"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6d"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x75"  "\x70"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x64"  "\x6d"  "\x64"  "\x74"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x64"  "\x78"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x64"  "\x79"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x28"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x48"  "\x42"  "\x41"  "\x52"  "\x20"  "\x2f"  "\x20"  "\x51"  "\x45"  "\x20"  "\x2a"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x64"  "\x6f"  "\x74"  "\x28"  "\x6d"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x72"  "\x6f"  "\x73"  "\x73"  "\x28"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x62"  "\x28"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x2c"  "\x20"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x29"  "\x2c"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x20"  "\x2f"  "\x20"  "\x28"  "\x32"  "\x2e"  "\x30"  "\x20"  "\x2a"  "\x20"  "\x64"  "\x78"  "\x29"  "\x29"  "\x2c"  "\x20"  "\x64"  "\x6d"  "\x64"  "\x74"  "\x29"  "\x29"  "\x2c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x48"  "\x42"  "\x41"  "\x52"  "\x20"  "\x2f"  "\x20"  "\x51"  "\x45"  "\x20"  "\x2a"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x64"  "\x6f"  "\x74"  "\x28"  "\x6d"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x72"  "\x6f"  "\x73"  "\x73"  "\x28"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x62"  "\x28"  "\x75"  "\x70"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x29"  "\x2c"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x20"  "\x2f"  "\x20"  "\x28"  "\x32"  "\x2e"  "\x30"  "\x20"  "\x2a"  "\x20"  "\x64"  "\x79"  "\x29"  "\x29"  "\x2c"  "\x20"  "\x64"  "\x6d"  "\x64"  "\x74"  "\x29"  "\x29"  "\x2c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x30"  "\x2e"  "\x30"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x29"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x0a"  "\x52"  "\x47"  "\x42"  "\x41"  "\x33"  "\x32"  "\x20"  "\x6c"  "\x69"  "\x6e"  "\x65"  "\x61"  "\x72"  "\x5f"  "\x6d"  "\x61"  "\x70"  "\x70"  "\x69"  "\x6e"  "\x67"  "\x28"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x74"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x73"  "\x74"  "\x61"  "\x72"  "\x74"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6d"  "\x69"  "\x64"  "\x64"  "\x6c"  "\x65"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x65"  "\x6e"  "\x64"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x6f"  "\x72"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x74"  "\x20"  "\x3c"  "\x20"  "\x30"  "\x2e"  "\x35"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x6f"  "\x72"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x62"  "\x28"  "\x6d"  "\x69"  "\x64"  "\x64"  "\x6c"  "\x65"  "\x2c"  "\x20"  "\x73"  "\x74"  "\x61"  "\x72"  "\x74"  "\x29"  "\x2c"  "\x20"  "\x32"  "\x2e"  "\x30"  "\x20"  "\x2a"  "\x20"  "\x74"  "\x29"  "\x2c"  "\x20"  "\x73"  "\x74"  "\x61"  "\x72"  "\x74"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7d"  "\x20"  "\x65"  "\x6c"  "\x73"  "\x65"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x6f"  "\x72"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x62"  "\x28"  "\x65"  "\x6e"  "\x64"  "\x2c"  "\x20"  "\x6d"  "\x69"  "\x64"  "\x64"  "\x6c"  "\x65"  "\x29"  "\x2c"  "\x20"  "\x32"  "\x2e"  "\x30"  "\x20"  "\x2a"  "\x20"  "\x74"  "\x20"  "\x2d"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x29"  "\x2c"  "\x20"  "\x6d"  "\x69"  "\x64"  "\x64"  "\x6c"  "\x65"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7d"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x2f"  "\x2f"  "\x52"  "\x47"  "\x42"  "\x41"  "\x20"  "\x2d"  "\x3e"  "\x20"  "\x42"  "\x47"  "\x52"  "\x41"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x28"  "\x52"  "\x47"  "\x42"  "\x41"  "\x33"  "\x32"  "\x29"  "\x7b"  "\x2e"  "\x78"  "\x20"  "\x3d"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x6f"  "\x72"  "\x2e"  "\x7a"  "\x20"  "\x2a"  "\x20"  "\x32"  "\x35"  "\x35"  "\x2c"  "\x20"  "\x2e"  "\x79"  "\x20"  "\x3d"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x6f"  "\x72"  "\x2e"  "\x79"  "\x20"  "\x2a"  "\x20"  "\x32"  "\x35"  "\x35"  "\x2c"  "\x20"  "\x2e"  "\x7a"  "\x20"  "\x3d"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x6f"  "\x72"  "\x2e"  "\x78"  "\x20"  "\x2a"  "\x20"  "\x32"  "\x35"  "\x35"  "\x2c"  "\x20"  "\x2e"  "\x77"  "\x20"  "\x3d"  "\x20"  "\x32"  "\x35"  "\x35"  "\x7d"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x52"  "\x47"  "\x42"  "\x41"  "\x33"  "\x32"  "\x20"  "\x6d"  "\x5f"  "\x62"  "\x77"  "\x72"  "\x5f"  "\x6d"  "\x61"  "\x70"  "\x70"  "\x69"  "\x6e"  "\x67"  "\x28"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6d"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x2f"  "\x2f"  "\x76"  "\x33"  "\x64"  "\x20"  "\x73"  "\x74"  "\x61"  "\x72"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x28"  "\x30"  "\x78"  "\x30"  "\x33"  "\x20"  "\x2f"  "\x20"  "\x32"  "\x35"  "\x35"  "\x2e"  "\x30"  "\x2c"  "\x20"  "\x30"  "\x78"  "\x37"  "\x66"  "\x20"  "\x2f"  "\x20"  "\x32"  "\x35"  "\x35"  "\x2e"  "\x30"  "\x2c"  "\x20"  "\x30"  "\x78"  "\x66"  "\x66"  "\x20"  "\x2f"  "\x20"  "\x32"  "\x35"  "\x35"  "\x2e"  "\x30"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x2f"  "\x2f"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6d"  "\x69"  "\x64"  "\x64"  "\x6c"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x28"  "\x31"  "\x2c"  "\x20"  "\x31"  "\x2c"  "\x20"  "\x31"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x2f"  "\x2f"  "\x76"  "\x33"  "\x64"  "\x20"  "\x65"  "\x6e"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x28"  "\x30"  "\x78"  "\x66"  "\x34"  "\x20"  "\x2f"  "\x20"  "\x32"  "\x35"  "\x35"  "\x2e"  "\x30"  "\x2c"  "\x20"  "\x30"  "\x78"  "\x30"  "\x35"  "\x20"  "\x2f"  "\x20"  "\x32"  "\x35"  "\x35"  "\x2e"  "\x30"  "\x2c"  "\x20"  "\x30"  "\x78"  "\x30"  "\x31"  "\x20"  "\x2f"  "\x20"  "\x32"  "\x35"  "\x35"  "\x2e"  "\x30"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x73"  "\x74"  "\x61"  "\x72"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x28"  "\x30"  "\x2c"  "\x20"  "\x30"  "\x2c"  "\x20"  "\x30"  "\x78"  "\x66"  "\x66"  "\x20"  "\x2f"  "\x20"  "\x32"  "\x35"  "\x35"  "\x2e"  "\x30"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6d"  "\x69"  "\x64"  "\x64"  "\x6c"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x28"  "\x31"  "\x2c"  "\x20"  "\x31"  "\x2c"  "\x20"  "\x31"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x65"  "\x6e"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x28"  "\x30"  "\x78"  "\x66"  "\x66"  "\x20"  "\x2f"  "\x20"  "\x32"  "\x35"  "\x35"  "\x2e"  "\x30"  "\x2c"  "\x20"  "\x30"  "\x2c"  "\x20"  "\x30"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x6d"  "\x7a"  "\x20"  "\x3d"  "\x20"  "\x6d"  "\x2e"  "\x7a"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x6c"  "\x69"  "\x6e"  "\x65"  "\x61"  "\x72"  "\x5f"  "\x6d"  "\x61"  "\x70"  "\x70"  "\x69"  "\x6e"  "\x67"  "\x28"  "\x30"  "\x2e"  "\x35"  "\x20"  "\x2a"  "\x20"  "\x6d"  "\x7a"  "\x20"  "\x2b"  "\x20"  "\x30"  "\x2e"  "\x35"  "\x2c"  "\x20"  "\x73"  "\x74"  "\x61"  "\x72"  "\x74"  "\x2c"  "\x20"  "\x6d"  "\x69"  "\x64"  "\x64"  "\x6c"  "\x65"  "\x2c"  "\x20"  "\x65"  "\x6e"  "\x64"  "\x29"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x5f"  "\x76"  "\x28"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x6d"  "\x31"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x6d"  "\x32"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x68"  "\x75"  "\x65"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x2f"  "\x2f"  "\x68"  "\x75"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x68"  "\x75"  "\x65"  "\x20"  "\x25"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x68"  "\x75"  "\x65"  "\x5f"  "\x69"  "\x20"  "\x3d"  "\x20"  "\x66"  "\x6c"  "\x6f"  "\x6f"  "\x72"  "\x28"  "\x68"  "\x75"  "\x65"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x68"  "\x75"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x68"  "\x75"  "\x65"  "\x20"  "\x2d"  "\x20"  "\x68"  "\x75"  "\x65"  "\x5f"  "\x69"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x68"  "\x75"  "\x65"  "\x20"  "\x3c"  "\x20"  "\x28"  "\x31"  "\x2e"  "\x30"  "\x20"  "\x2f"  "\x20"  "\x36"  "\x2e"  "\x30"  "\x29"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x6d"  "\x31"  "\x20"  "\x2b"  "\x20"  "\x28"  "\x6d"  "\x32"  "\x20"  "\x2d"  "\x20"  "\x6d"  "\x31"  "\x29"  "\x20"  "\x2a"  "\x20"  "\x68"  "\x75"  "\x65"  "\x20"  "\x2a"  "\x20"  "\x36"  "\x2e"  "\x30"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x68"  "\x75"  "\x65"  "\x20"  "\x3c"  "\x20"  "\x30"  "\x2e"  "\x35"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x6d"  "\x32"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x68"  "\x75"  "\x65"  "\x20"  "\x3c"  "\x20"  "\x28"  "\x32"  "\x2e"  "\x30"  "\x20"  "\x2f"  "\x20"  "\x33"  "\x2e"  "\x30"  "\x29"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x6d"  "\x31"  "\x20"  "\x2b"  "\x20"  "\x28"  "\x6d"  "\x32"  "\x20"  "\x2d"  "\x20"  "\x6d"  "\x31"  "\x29"  "\x20"  "\x2a"  "\x20"  "\x28"  "\x32"  "\x2e"  "\x30"  "\x20"  "\x2f"  "\x20"  "\x33"  "\x2e"  "\x30"  "\x20"  "\x2d"  "\x20"  "\x68"  "\x75"  "\x65"  "\x29"  "\x20"  "\x2a"  "\x20"  "\x36"  "\x2e"  "\x30"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x6d"  "\x31"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x52"  "\x47"  "\x42"  "\x41"  "\x33"  "\x32"  "\x20"  "\x68"  "\x73"  "\x6c"  "\x5f"  "\x74"  "\x6f"  "\x5f"  "\x72"  "\x67"  "\x62"  "\x28"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x68"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x73"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x6c"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x43"  "\x4c"  "\x4f"  "\x53"  "\x45"  "\x5f"  "\x45"  "\x4e"  "\x4f"  "\x55"  "\x47"  "\x48"  "\x28"  "\x73"  "\x2c"  "\x20"  "\x30"  "\x2e"  "\x30"  "\x2c"  "\x20"  "\x45"  "\x50"  "\x53"  "\x29"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x28"  "\x52"  "\x47"  "\x42"  "\x41"  "\x33"  "\x32"  "\x29"  "\x7b"  "\x2e"  "\x78"  "\x20"  "\x3d"  "\x20"  "\x32"  "\x35"  "\x35"  "\x20"  "\x2a"  "\x20"  "\x6c"  "\x2c"  "\x20"  "\x2e"  "\x79"  "\x20"  "\x3d"  "\x20"  "\x32"  "\x35"  "\x35"  "\x20"  "\x2a"  "\x20"  "\x6c"  "\x2c"  "\x20"  "\x2e"  "\x7a"  "\x20"  "\x3d"  "\x20"  "\x32"  "\x35"  "\x35"  "\x20"  "\x2a"  "\x20"  "\x6c"  "\x2c"  "\x20"  "\x2e"  "\x77"  "\x20"  "\x3d"  "\x20"  "\x32"  "\x35"  "\x35"  "\x7d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x6d"  "\x32"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x6c"  "\x20"  "\x3c"  "\x3d"  "\x20"  "\x30"  "\x2e"  "\x35"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6d"  "\x32"  "\x20"  "\x3d"  "\x20"  "\x6c"  "\x20"  "\x2a"  "\x20"  "\x28"  "\x31"  "\x2e"  "\x30"  "\x20"  "\x2b"  "\x20"  "\x73"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x65"  "\x6c"  "\x73"  "\x65"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6d"  "\x32"  "\x20"  "\x3d"  "\x20"  "\x6c"  "\x20"  "\x2b"  "\x20"  "\x73"  "\x20"  "\x2d"  "\x20"  "\x6c"  "\x20"  "\x2a"  "\x20"  "\x73"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x6d"  "\x31"  "\x20"  "\x3d"  "\x20"  "\x32"  "\x2e"  "\x30"  "\x20"  "\x2a"  "\x20"  "\x6c"  "\x20"  "\x2d"  "\x20"  "\x6d"  "\x32"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x52"  "\x47"  "\x42"  "\x41"  "\x33"  "\x32"  "\x20"  "\x72"  "\x65"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x52"  "\x47"  "\x42"  "\x41"  "\x33"  "\x32"  "\x29"  "\x7b"  "\x2e"  "\x78"  "\x20"  "\x3d"  "\x20"  "\x5f"  "\x76"  "\x28"  "\x6d"  "\x31"  "\x2c"  "\x20"  "\x6d"  "\x32"  "\x2c"  "\x20"  "\x68"  "\x20"  "\x2b"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x20"  "\x2f"  "\x20"  "\x33"  "\x2e"  "\x30"  "\x29"  "\x20"  "\x2a"  "\x20"  "\x32"  "\x35"  "\x35"  "\x2c"  "\x20"  "\x2e"  "\x79"  "\x20"  "\x3d"  "\x20"  "\x5f"  "\x76"  "\x28"  "\x6d"  "\x31"  "\x2c"  "\x20"  "\x6d"  "\x32"  "\x2c"  "\x20"  "\x68"  "\x29"  "\x20"  "\x2a"  "\x20"  "\x32"  "\x35"  "\x35"  "\x2c"  "\x20"  "\x2e"  "\x7a"  "\x20"  "\x3d"  "\x20"  "\x5f"  "\x76"  "\x28"  "\x6d"  "\x31"  "\x2c"  "\x20"  "\x6d"  "\x32"  "\x2c"  "\x20"  "\x68"  "\x20"  "\x2d"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x20"  "\x2f"  "\x20"  "\x33"  "\x2e"  "\x30"  "\x29"  "\x20"  "\x2a"  "\x20"  "\x32"  "\x35"  "\x35"  "\x2c"  "\x20"  "\x2e"  "\x77"  "\x20"  "\x3d"  "\x20"  "\x32"  "\x35"  "\x35"  "\x7d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x2f"  "\x2f"  "\x52"  "\x47"  "\x42"  "\x41"  "\x20"  "\x2d"  "\x3e"  "\x20"  "\x42"  "\x47"  "\x52"  "\x41"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x28"  "\x52"  "\x47"  "\x42"  "\x41"  "\x33"  "\x32"  "\x29"  "\x7b"  "\x2e"  "\x78"  "\x20"  "\x3d"  "\x20"  "\x72"  "\x65"  "\x74"  "\x2e"  "\x7a"  "\x2c"  "\x20"  "\x2e"  "\x79"  "\x20"  "\x3d"  "\x20"  "\x72"  "\x65"  "\x74"  "\x2e"  "\x79"  "\x2c"  "\x20"  "\x2e"  "\x7a"  "\x20"  "\x3d"  "\x20"  "\x72"  "\x65"  "\x74"  "\x2e"  "\x78"  "\x2c"  "\x20"  "\x2e"  "\x77"  "\x20"  "\x3d"  "\x20"  "\x72"  "\x65"  "\x74"  "\x2e"  "\x77"  "\x7d"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x52"  "\x47"  "\x42"  "\x41"  "\x33"  "\x32"  "\x20"  "\x6d"  "\x5f"  "\x74"  "\x6f"  "\x5f"  "\x68"  "\x73"  "\x6c"  "\x28"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6d"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x2f"  "\x2f"  "\x6d"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x6e"  "\x6f"  "\x72"  "\x6d"  "\x61"  "\x6c"  "\x69"  "\x7a"  "\x65"  "\x28"  "\x6d"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x61"  "\x6e"  "\x67"  "\x6c"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x61"  "\x74"  "\x61"  "\x6e"  "\x32"  "\x28"  "\x6d"  "\x2e"  "\x79"  "\x2c"  "\x20"  "\x6d"  "\x2e"  "\x78"  "\x29"  "\x20"  "\x2f"  "\x20"  "\x4d"  "\x5f"  "\x50"  "\x49"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x61"  "\x6e"  "\x67"  "\x6c"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x61"  "\x6e"  "\x67"  "\x6c"  "\x65"  "\x20"  "\x2b"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x29"  "\x20"  "\x2f"  "\x20"  "\x32"  "\x2e"  "\x30"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x6c"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x6d"  "\x2e"  "\x7a"  "\x20"  "\x2b"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x29"  "\x20"  "\x2f"  "\x20"  "\x32"  "\x2e"  "\x30"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x73"  "\x20"  "\x3d"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x68"  "\x73"  "\x6c"  "\x5f"  "\x74"  "\x6f"  "\x5f"  "\x72"  "\x67"  "\x62"  "\x28"  "\x61"  "\x6e"  "\x67"  "\x6c"  "\x65"  "\x2c"  "\x20"  "\x73"  "\x2c"  "\x20"  "\x6c"  "\x29"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x0a"  "\x0a"  "\x0a"  "\x0a"  "\x2f"  "\x2f"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x20"  "\x61"  "\x6e"  "\x64"  "\x20"  "\x72"  "\x65"  "\x6e"  "\x64"  "\x65"  "\x72"  "\x20"  "\x6b"  "\x65"  "\x72"  "\x6e"  "\x65"  "\x6c"  "\x73"  "\x20"  "\x72"  "\x75"  "\x6e"  "\x20"  "\x6f"  "\x6e"  "\x20"  "\x61"  "\x20"  "\x32"  "\x44"  "\x20"  "\x72"  "\x61"  "\x6e"  "\x67"  "\x65"  "\x3a"  "\x20"  "\x64"  "\x69"  "\x6d"  "\x65"  "\x6e"  "\x73"  "\x69"  "\x6f"  "\x6e"  "\x20"  "\x30"  "\x20"  "\x77"  "\x61"  "\x6c"  "\x6b"  "\x73"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x75"  "\x6d"  "\x6e"  "\x73"  "\x2c"  "\x20"  "\x73"  "\x6f"  "\x20"  "\x61"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x73"  "\x74"  "\x61"  "\x79"  "\x73"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x74"  "\x69"  "\x67"  "\x75"  "\x6f"  "\x75"  "\x73"  "\x20"  "\x69"  "\x6e"  "\x20"  "\x6d"  "\x65"  "\x6d"  "\x6f"  "\x72"  "\x79"  "\x0a"  "\x2f"  "\x2f"  "\x61"  "\x6e"  "\x64"  "\x20"  "\x61"  "\x20"  "\x74"  "\x69"  "\x6c"  "\x65"  "\x20"  "\x6f"  "\x66"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x6b"  "\x65"  "\x65"  "\x70"  "\x73"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x75"  "\x70"  "\x2f"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x20"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x62"  "\x6f"  "\x75"  "\x72"  "\x73"  "\x20"  "\x69"  "\x6e"  "\x73"  "\x69"  "\x64"  "\x65"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x77"  "\x6f"  "\x72"  "\x6b"  "\x20"  "\x67"  "\x72"  "\x6f"  "\x75"  "\x70"  "\x0a"  "\x0a"  "\x2f"  "\x2f"  "\x6e"  "\x65"  "\x78"  "\x74"  "\x20"  "\x76"  "\x61"  "\x6c"  "\x75"  "\x65"  "\x20"  "\x6f"  "\x66"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x73"  "\x69"  "\x74"  "\x65"  "\x20"  "\x61"  "\x74"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x2e"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x20"  "\x63"  "\x6f"  "\x6d"  "\x65"  "\x73"  "\x20"  "\x69"  "\x6e"  "\x20"  "\x77"  "\x69"  "\x74"  "\x68"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x20"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x20"  "\x73"  "\x65"  "\x74"  "\x20"  "\x61"  "\x6e"  "\x64"  "\x20"  "\x6c"  "\x65"  "\x61"  "\x76"  "\x65"  "\x73"  "\x20"  "\x68"  "\x6f"  "\x6c"  "\x64"  "\x69"  "\x6e"  "\x67"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x73"  "\x69"  "\x74"  "\x65"  "\x20"  "\x61"  "\x6e"  "\x64"  "\x0a"  "\x2f"  "\x2f"  "\x69"  "\x74"  "\x73"  "\x20"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x62"  "\x6f"  "\x75"  "\x72"  "\x73"  "\x2c"  "\x20"  "\x77"  "\x68"  "\x69"  "\x63"  "\x68"  "\x20"  "\x69"  "\x73"  "\x20"  "\x61"  "\x6c"  "\x6c"  "\x20"  "\x67"  "\x70"  "\x75"  "\x5f"  "\x73"  "\x74"  "\x65"  "\x70"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x20"  "\x6e"  "\x65"  "\x65"  "\x64"  "\x73"  "\x20"  "\x66"  "\x6f"  "\x72"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x72"  "\x6d"  "\x61"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x20"  "\x6f"  "\x66"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x73"  "\x74"  "\x65"  "\x70"  "\x0a"  "\x76"  "\x33"  "\x64"  "\x20"  "\x73"  "\x74"  "\x65"  "\x70"  "\x5f"  "\x73"  "\x69"  "\x74"  "\x65"  "\x28"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x73"  "\x69"  "\x74"  "\x65"  "\x5f"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x73"  "\x20"  "\x2a"  "\x67"  "\x73"  "\x2c"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x2a"  "\x69"  "\x6e"  "\x70"  "\x75"  "\x74"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x64"  "\x74"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x74"  "\x69"  "\x6d"  "\x65"  "\x2c"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x20"  "\x67"  "\x69"  "\x2c"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x6d"  "\x65"  "\x74"  "\x68"  "\x6f"  "\x64"  "\x2c"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x2c"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x65"  "\x74"  "\x65"  "\x72"  "\x73"  "\x20"  "\x2a"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x73"  "\x74"  "\x20"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x20"  "\x69"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x29"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2a"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x20"  "\x2b"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2d"  "\x3e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2d"  "\x3e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2d"  "\x3e"  "\x67"  "\x73"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x73"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2d"  "\x3e"  "\x6d"  "\x20"  "\x3d"  "\x20"  "\x61"  "\x70"  "\x70"  "\x6c"  "\x79"  "\x5f"  "\x70"  "\x62"  "\x63"  "\x28"  "\x69"  "\x6e"  "\x70"  "\x75"  "\x74"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x70"  "\x62"  "\x63"  "\x2c"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2d"  "\x3e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x61"  "\x70"  "\x70"  "\x6c"  "\x79"  "\x5f"  "\x70"  "\x62"  "\x63"  "\x28"  "\x69"  "\x6e"  "\x70"  "\x75"  "\x74"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x70"  "\x62"  "\x63"  "\x2c"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x2d"  "\x20"  "\x31"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2d"  "\x3e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x61"  "\x70"  "\x70"  "\x6c"  "\x79"  "\x5f"  "\x70"  "\x62"  "\x63"  "\x28"  "\x69"  "\x6e"  "\x70"  "\x75"  "\x74"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x70"  "\x62"  "\x63"  "\x2c"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x2b"  "\x20"  "\x31"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2d"  "\x3e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x75"  "\x70"  "\x20"  "\x3d"  "\x20"  "\x61"  "\x70"  "\x70"  "\x6c"  "\x79"  "\x5f"  "\x70"  "\x62"  "\x63"  "\x28"  "\x69"  "\x6e"  "\x70"  "\x75"  "\x74"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x70"  "\x62"  "\x63"  "\x2c"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2b"  "\x20"  "\x31"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2d"  "\x3e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x20"  "\x3d"  "\x20"  "\x61"  "\x70"  "\x70"  "\x6c"  "\x79"  "\x5f"  "\x70"  "\x62"  "\x63"  "\x28"  "\x69"  "\x6e"  "\x70"  "\x75"  "\x74"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x70"  "\x62"  "\x63"  "\x2c"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2d"  "\x20"  "\x31"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2d"  "\x3e"  "\x74"  "\x69"  "\x6d"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x74"  "\x69"  "\x6d"  "\x65"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x20"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x73"  "\x65"  "\x65"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x2a"  "\x28"  "\x28"  "\x69"  "\x6e"  "\x74"  "\x2a"  "\x29"  "\x28"  "\x26"  "\x74"  "\x69"  "\x6d"  "\x65"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x73"  "\x65"  "\x65"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x73"  "\x65"  "\x65"  "\x64"  "\x20"  "\x3c"  "\x3c"  "\x20"  "\x31"  "\x36"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x2f"  "\x2f"  "\x73"  "\x65"  "\x65"  "\x64"  "\x65"  "\x64"  "\x20"  "\x62"  "\x79"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x20"  "\x70"  "\x6f"  "\x73"  "\x69"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x2c"  "\x20"  "\x6e"  "\x6f"  "\x74"  "\x20"  "\x62"  "\x79"  "\x20"  "\x69"  "\x64"  "\x2c"  "\x20"  "\x6f"  "\x74"  "\x68"  "\x65"  "\x72"  "\x77"  "\x69"  "\x73"  "\x65"  "\x20"  "\x73"  "\x69"  "\x74"  "\x65"  "\x73"  "\x20"  "\x61"  "\x74"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x73"  "\x61"  "\x6d"  "\x65"  "\x20"  "\x70"  "\x6c"  "\x61"  "\x63"  "\x65"  "\x20"  "\x6f"  "\x66"  "\x20"  "\x74"  "\x77"  "\x6f"  "\x20"  "\x73"  "\x6c"  "\x61"  "\x62"  "\x73"  "\x20"  "\x64"  "\x72"  "\x61"  "\x77"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x73"  "\x61"  "\x6d"  "\x65"  "\x20"  "\x6e"  "\x6f"  "\x69"  "\x73"  "\x65"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x73"  "\x65"  "\x65"  "\x64"  "\x28"  "\x26"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2c"  "\x20"  "\x73"  "\x65"  "\x65"  "\x64"  "\x20"  "\x2b"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2d"  "\x3e"  "\x67"  "\x73"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2a"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x20"  "\x2b"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2d"  "\x3e"  "\x67"  "\x73"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2d"  "\x3e"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x26"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x3b"  "\x0a"  "\x0a"  "\x23"  "\x69"  "\x66"  "\x64"  "\x65"  "\x66"  "\x20"  "\x48"  "\x41"  "\x53"  "\x5f"  "\x54"  "\x45"  "\x4d"  "\x50"  "\x45"  "\x52"  "\x41"  "\x54"  "\x55"  "\x52"  "\x45"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x74"  "\x65"  "\x6d"  "\x70"  "\x65"  "\x72"  "\x61"  "\x74"  "\x75"  "\x72"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x61"  "\x74"  "\x65"  "\x5f"  "\x74"  "\x65"  "\x6d"  "\x70"  "\x65"  "\x72"  "\x61"  "\x74"  "\x75"  "\x72"  "\x65"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2d"  "\x3e"  "\x67"  "\x73"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2d"  "\x3e"  "\x74"  "\x69"  "\x6d"  "\x65"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x21"  "\x43"  "\x4c"  "\x4f"  "\x53"  "\x45"  "\x5f"  "\x45"  "\x4e"  "\x4f"  "\x55"  "\x47"  "\x48"  "\x28"  "\x74"  "\x65"  "\x6d"  "\x70"  "\x65"  "\x72"  "\x61"  "\x74"  "\x75"  "\x72"  "\x65"  "\x2c"  "\x20"  "\x30"  "\x2e"  "\x30"  "\x2c"  "\x20"  "\x45"  "\x50"  "\x53"  "\x29"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2d"  "\x3e"  "\x74"  "\x65"  "\x6d"  "\x70"  "\x65"  "\x72"  "\x61"  "\x74"  "\x75"  "\x72"  "\x65"  "\x5f"  "\x65"  "\x66"  "\x66"  "\x65"  "\x63"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x6e"  "\x6f"  "\x72"  "\x6d"  "\x61"  "\x6c"  "\x69"  "\x7a"  "\x65"  "\x28"  "\x6e"  "\x6f"  "\x72"  "\x6d"  "\x61"  "\x6c"  "\x5f"  "\x64"  "\x69"  "\x73"  "\x74"  "\x72"  "\x69"  "\x62"  "\x75"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x5f"  "\x76"  "\x33"  "\x64"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2d"  "\x3e"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x29"  "\x29"  "\x2c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x73"  "\x71"  "\x72"  "\x74"  "\x28"  "\x32"  "\x2e"  "\x30"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2d"  "\x3e"  "\x67"  "\x73"  "\x2e"  "\x61"  "\x6c"  "\x70"  "\x68"  "\x61"  "\x20"  "\x2a"  "\x20"  "\x4b"  "\x42"  "\x20"  "\x2a"  "\x20"  "\x74"  "\x65"  "\x6d"  "\x70"  "\x65"  "\x72"  "\x61"  "\x74"  "\x75"  "\x72"  "\x65"  "\x20"  "\x2f"  "\x20"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2d"  "\x3e"  "\x67"  "\x73"  "\x2e"  "\x67"  "\x61"  "\x6d"  "\x6d"  "\x61"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2d"  "\x3e"  "\x67"  "\x73"  "\x2e"  "\x6d"  "\x75"  "\x20"  "\x2a"  "\x20"  "\x64"  "\x74"  "\x29"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7d"  "\x0a"  "\x23"  "\x65"  "\x6e"  "\x64"  "\x69"  "\x66"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x72"  "\x65"  "\x74"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x73"  "\x77"  "\x69"  "\x74"  "\x63"  "\x68"  "\x20"  "\x28"  "\x6d"  "\x65"  "\x74"  "\x68"  "\x6f"  "\x64"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x61"  "\x73"  "\x65"  "\x20"  "\x49"  "\x4e"  "\x54"  "\x45"  "\x47"  "\x52"  "\x41"  "\x54"  "\x45"  "\x5f"  "\x4d"  "\x49"  "\x44"  "\x50"  "\x4f"  "\x49"  "\x4e"  "\x54"  "\x3a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2d"  "\x3e"  "\x67"  "\x73"  "\x2e"  "\x70"  "\x69"  "\x6e"  "\x2e"  "\x70"  "\x69"  "\x6e"  "\x6e"  "\x65"  "\x64"  "\x3f"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2d"  "\x3e"  "\x67"  "\x73"  "\x2e"  "\x70"  "\x69"  "\x6e"  "\x2e"  "\x64"  "\x69"  "\x72"  "\x3a"  "\x20"  "\x73"  "\x74"  "\x65"  "\x70"  "\x5f"  "\x6c"  "\x6c"  "\x67"  "\x5f"  "\x6d"  "\x69"  "\x64"  "\x70"  "\x6f"  "\x69"  "\x6e"  "\x74"  "\x28"  "\x2a"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2c"  "\x20"  "\x64"  "\x74"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x62"  "\x72"  "\x65"  "\x61"  "\x6b"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x61"  "\x73"  "\x65"  "\x20"  "\x49"  "\x4e"  "\x54"  "\x45"  "\x47"  "\x52"  "\x41"  "\x54"  "\x45"  "\x5f"  "\x52"  "\x4b"  "\x34"  "\x3a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x65"  "\x66"  "\x61"  "\x75"  "\x6c"  "\x74"  "\x3a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x6e"  "\x6f"  "\x72"  "\x6d"  "\x61"  "\x6c"  "\x69"  "\x7a"  "\x65"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2d"  "\x3e"  "\x67"  "\x73"  "\x2e"  "\x70"  "\x69"  "\x6e"  "\x2e"  "\x70"  "\x69"  "\x6e"  "\x6e"  "\x65"  "\x64"  "\x3f"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2d"  "\x3e"  "\x67"  "\x73"  "\x2e"  "\x70"  "\x69"  "\x6e"  "\x2e"  "\x64"  "\x69"  "\x72"  "\x3a"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2d"  "\x3e"  "\x6d"  "\x2c"  "\x20"  "\x73"  "\x74"  "\x65"  "\x70"  "\x5f"  "\x6c"  "\x6c"  "\x67"  "\x28"  "\x2a"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2c"  "\x20"  "\x64"  "\x74"  "\x29"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x62"  "\x72"  "\x65"  "\x61"  "\x6b"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7d"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2d"  "\x3e"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x4e"  "\x55"  "\x4c"  "\x4c"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x72"  "\x65"  "\x74"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x2f"  "\x2f"  "\x73"  "\x65"  "\x6c"  "\x65"  "\x63"  "\x74"  "\x65"  "\x64"  "\x20"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x73"  "\x20"  "\x6f"  "\x66"  "\x20"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x72"  "\x6d"  "\x61"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x5f"  "\x70"  "\x61"  "\x63"  "\x6b"  "\x65"  "\x64"  "\x20"  "\x70"  "\x65"  "\x72"  "\x20"  "\x73"  "\x69"  "\x74"  "\x65"  "\x20"  "\x6f"  "\x72"  "\x20"  "\x70"  "\x65"  "\x72"  "\x20"  "\x77"  "\x6f"  "\x72"  "\x6b"  "\x20"  "\x67"  "\x72"  "\x6f"  "\x75"  "\x70"  "\x2c"  "\x20"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x46"  "\x49"  "\x45"  "\x4c"  "\x44"  "\x53"  "\x20"  "\x67"  "\x69"  "\x76"  "\x65"  "\x73"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x6f"  "\x72"  "\x64"  "\x65"  "\x72"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x4b"  "\x45"  "\x52"  "\x4e"  "\x45"  "\x4c"  "\x5f"  "\x43"  "\x4f"  "\x55"  "\x4e"  "\x54"  "\x28"  "\x62"  "\x69"  "\x74"  "\x73"  "\x2c"  "\x20"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x29"  "\x20"  "\x2b"  "\x20"  "\x28"  "\x28"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x4f"  "\x42"  "\x53"  "\x45"  "\x52"  "\x56"  "\x41"  "\x42"  "\x4c"  "\x45"  "\x53"  "\x20"  "\x26"  "\x20"  "\x28"  "\x62"  "\x69"  "\x74"  "\x73"  "\x29"  "\x29"  "\x3f"  "\x20"  "\x31"  "\x3a"  "\x20"  "\x30"  "\x29"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x50"  "\x41"  "\x43"  "\x4b"  "\x45"  "\x44"  "\x5f"  "\x44"  "\x4f"  "\x55"  "\x42"  "\x4c"  "\x45"  "\x53"  "\x20"  "\x28"  "\x30"  "\x20"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x46"  "\x49"  "\x45"  "\x4c"  "\x44"  "\x53"  "\x28"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x4b"  "\x45"  "\x52"  "\x4e"  "\x45"  "\x4c"  "\x5f"  "\x43"  "\x4f"  "\x55"  "\x4e"  "\x54"  "\x29"  "\x29"  "\x0a"  "\x0a"  "\x76"  "\x6f"  "\x69"  "\x64"  "\x20"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x5f"  "\x70"  "\x61"  "\x63"  "\x6b"  "\x28"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x72"  "\x6d"  "\x61"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x5f"  "\x70"  "\x61"  "\x63"  "\x6b"  "\x65"  "\x64"  "\x20"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2c"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x2a"  "\x6f"  "\x75"  "\x74"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x6e"  "\x20"  "\x3d"  "\x20"  "\x30"  "\x3b"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x50"  "\x41"  "\x43"  "\x4b"  "\x28"  "\x62"  "\x69"  "\x74"  "\x73"  "\x2c"  "\x20"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x29"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x4f"  "\x42"  "\x53"  "\x45"  "\x52"  "\x56"  "\x41"  "\x42"  "\x4c"  "\x45"  "\x53"  "\x20"  "\x26"  "\x20"  "\x28"  "\x62"  "\x69"  "\x74"  "\x73"  "\x29"  "\x29"  "\x20"  "\x6f"  "\x75"  "\x74"  "\x5b"  "\x6e"  "\x2b"  "\x2b"  "\x5d"  "\x20"  "\x3d"  "\x20"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2e"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x46"  "\x49"  "\x45"  "\x4c"  "\x44"  "\x53"  "\x28"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x50"  "\x41"  "\x43"  "\x4b"  "\x29"  "\x0a"  "\x23"  "\x75"  "\x6e"  "\x64"  "\x65"  "\x66"  "\x20"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x50"  "\x41"  "\x43"  "\x4b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x55"  "\x4e"  "\x55"  "\x53"  "\x45"  "\x44"  "\x28"  "\x6e"  "\x29"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x2f"  "\x2f"  "\x77"  "\x68"  "\x61"  "\x74"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x68"  "\x6f"  "\x73"  "\x74"  "\x20"  "\x72"  "\x65"  "\x61"  "\x64"  "\x73"  "\x20"  "\x74"  "\x6f"  "\x20"  "\x6b"  "\x6e"  "\x6f"  "\x77"  "\x20"  "\x77"  "\x68"  "\x69"  "\x63"  "\x68"  "\x20"  "\x6f"  "\x62"  "\x73"  "\x65"  "\x72"  "\x76"  "\x61"  "\x62"  "\x6c"  "\x65"  "\x73"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x70"  "\x72"  "\x6f"  "\x67"  "\x72"  "\x61"  "\x6d"  "\x20"  "\x63"  "\x6f"  "\x6d"  "\x70"  "\x75"  "\x74"  "\x65"  "\x73"  "\x0a"  "\x6b"  "\x65"  "\x72"  "\x6e"  "\x65"  "\x6c"  "\x20"  "\x76"  "\x6f"  "\x69"  "\x64"  "\x20"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x5f"  "\x6f"  "\x62"  "\x73"  "\x65"  "\x72"  "\x76"  "\x61"  "\x62"  "\x6c"  "\x65"  "\x73"  "\x28"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x75"  "\x6c"  "\x6f"  "\x6e"  "\x67"  "\x20"  "\x2a"  "\x6f"  "\x75"  "\x74"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x67"  "\x6c"  "\x6f"  "\x62"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x64"  "\x28"  "\x30"  "\x29"  "\x20"  "\x3d"  "\x3d"  "\x20"  "\x30"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6f"  "\x75"  "\x74"  "\x5b"  "\x30"  "\x5d"  "\x20"  "\x3d"  "\x20"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x4f"  "\x42"  "\x53"  "\x45"  "\x52"  "\x56"  "\x41"  "\x42"  "\x4c"  "\x45"  "\x53"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x2f"  "\x2f"  "\x65"  "\x76"  "\x65"  "\x72"  "\x79"  "\x74"  "\x68"  "\x69"  "\x6e"  "\x67"  "\x20"  "\x6f"  "\x66"  "\x20"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x72"  "\x6d"  "\x61"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x5f"  "\x70"  "\x61"  "\x63"  "\x6b"  "\x65"  "\x64"  "\x20"  "\x62"  "\x75"  "\x74"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x20"  "\x63"  "\x61"  "\x63"  "\x68"  "\x65"  "\x20"  "\x65"  "\x72"  "\x72"  "\x6f"  "\x72"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x20"  "\x68"  "\x61"  "\x73"  "\x20"  "\x74"  "\x6f"  "\x20"  "\x62"  "\x65"  "\x20"  "\x73"  "\x65"  "\x74"  "\x20"  "\x61"  "\x6c"  "\x72"  "\x65"  "\x61"  "\x64"  "\x79"  "\x2e"  "\x0a"  "\x2f"  "\x2f"  "\x6f"  "\x6e"  "\x6c"  "\x79"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x6f"  "\x62"  "\x73"  "\x65"  "\x72"  "\x76"  "\x61"  "\x62"  "\x6c"  "\x65"  "\x73"  "\x20"  "\x6f"  "\x66"  "\x20"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x4f"  "\x42"  "\x53"  "\x45"  "\x52"  "\x56"  "\x41"  "\x42"  "\x4c"  "\x45"  "\x53"  "\x20"  "\x61"  "\x72"  "\x65"  "\x20"  "\x63"  "\x6f"  "\x6d"  "\x70"  "\x75"  "\x74"  "\x65"  "\x64"  "\x0a"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x72"  "\x6d"  "\x61"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x5f"  "\x70"  "\x61"  "\x63"  "\x6b"  "\x65"  "\x64"  "\x20"  "\x73"  "\x69"  "\x74"  "\x65"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x65"  "\x74"  "\x65"  "\x72"  "\x73"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6d"  "\x31"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x64"  "\x74"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x72"  "\x6d"  "\x61"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x5f"  "\x70"  "\x61"  "\x63"  "\x6b"  "\x65"  "\x64"  "\x20"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x72"  "\x6d"  "\x61"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x5f"  "\x70"  "\x61"  "\x63"  "\x6b"  "\x65"  "\x64"  "\x29"  "\x7b"  "\x7d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x55"  "\x4e"  "\x55"  "\x53"  "\x45"  "\x44"  "\x28"  "\x6d"  "\x31"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x55"  "\x4e"  "\x55"  "\x53"  "\x45"  "\x44"  "\x28"  "\x64"  "\x74"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x23"  "\x69"  "\x66"  "\x20"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x4f"  "\x42"  "\x53"  "\x45"  "\x52"  "\x56"  "\x41"  "\x42"  "\x4c"  "\x45"  "\x53"  "\x20"  "\x26"  "\x20"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x45"  "\x4e"  "\x45"  "\x52"  "\x47"  "\x59"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2e"  "\x65"  "\x78"  "\x63"  "\x68"  "\x61"  "\x6e"  "\x67"  "\x65"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x20"  "\x3d"  "\x20"  "\x65"  "\x78"  "\x63"  "\x68"  "\x61"  "\x6e"  "\x67"  "\x65"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2e"  "\x64"  "\x6d"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x20"  "\x3d"  "\x20"  "\x64"  "\x6d"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2e"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x20"  "\x3d"  "\x20"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2e"  "\x61"  "\x6e"  "\x69"  "\x73"  "\x6f"  "\x74"  "\x72"  "\x6f"  "\x70"  "\x79"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x20"  "\x3d"  "\x20"  "\x61"  "\x6e"  "\x69"  "\x73"  "\x6f"  "\x74"  "\x72"  "\x6f"  "\x70"  "\x79"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2e"  "\x63"  "\x75"  "\x62"  "\x69"  "\x63"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x20"  "\x3d"  "\x20"  "\x63"  "\x75"  "\x62"  "\x69"  "\x63"  "\x5f"  "\x61"  "\x6e"  "\x69"  "\x73"  "\x6f"  "\x74"  "\x72"  "\x6f"  "\x70"  "\x79"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x29"  "\x3b"  "\x0a"  "\x23"  "\x69"  "\x66"  "\x64"  "\x65"  "\x66"  "\x20"  "\x49"  "\x4e"  "\x43"  "\x4c"  "\x55"  "\x44"  "\x45"  "\x5f"  "\x44"  "\x49"  "\x50"  "\x4f"  "\x4c"  "\x41"  "\x52"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2e"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x20"  "\x3d"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x3b"  "\x0a"  "\x23"  "\x65"  "\x6e"  "\x64"  "\x69"  "\x66"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2e"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x20"  "\x3d"  "\x20"  "\x30"  "\x2e"  "\x35"  "\x20"  "\x2a"  "\x20"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2e"  "\x65"  "\x78"  "\x63"  "\x68"  "\x61"  "\x6e"  "\x67"  "\x65"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x20"  "\x2b"  "\x20"  "\x30"  "\x2e"  "\x35"  "\x20"  "\x2a"  "\x20"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2e"  "\x64"  "\x6d"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x20"  "\x2b"  "\x20"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2e"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x20"  "\x2b"  "\x20"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2e"  "\x61"  "\x6e"  "\x69"  "\x73"  "\x6f"  "\x74"  "\x72"  "\x6f"  "\x70"  "\x79"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x20"  "\x2b"  "\x20"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2e"  "\x63"  "\x75"  "\x62"  "\x69"  "\x63"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x20"  "\x2b"  "\x20"  "\x30"  "\x2e"  "\x35"  "\x20"  "\x2a"  "\x20"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2e"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x3b"  "\x0a"  "\x23"  "\x65"  "\x6e"  "\x64"  "\x69"  "\x66"  "\x0a"  "\x23"  "\x69"  "\x66"  "\x20"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x4f"  "\x42"  "\x53"  "\x45"  "\x52"  "\x56"  "\x41"  "\x42"  "\x4c"  "\x45"  "\x53"  "\x20"  "\x26"  "\x20"  "\x28"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x43"  "\x48"  "\x41"  "\x52"  "\x47"  "\x45"  "\x20"  "\x7c"  "\x20"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x43"  "\x48"  "\x41"  "\x52"  "\x47"  "\x45"  "\x5f"  "\x43"  "\x45"  "\x4e"  "\x54"  "\x45"  "\x52"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2e"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x5f"  "\x66"  "\x69"  "\x6e"  "\x69"  "\x74"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x5f"  "\x66"  "\x69"  "\x6e"  "\x69"  "\x74"  "\x65"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x75"  "\x70"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2e"  "\x61"  "\x62"  "\x73"  "\x5f"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x5f"  "\x66"  "\x69"  "\x6e"  "\x69"  "\x74"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x66"  "\x61"  "\x62"  "\x73"  "\x28"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2e"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x5f"  "\x66"  "\x69"  "\x6e"  "\x69"  "\x74"  "\x65"  "\x29"  "\x3b"  "\x0a"  "\x23"  "\x65"  "\x6e"  "\x64"  "\x69"  "\x66"  "\x0a"  "\x23"  "\x69"  "\x66"  "\x20"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x4f"  "\x42"  "\x53"  "\x45"  "\x52"  "\x56"  "\x41"  "\x42"  "\x4c"  "\x45"  "\x53"  "\x20"  "\x26"  "\x20"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x43"  "\x48"  "\x41"  "\x52"  "\x47"  "\x45"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2e"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x5f"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x5f"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x75"  "\x70"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2e"  "\x61"  "\x62"  "\x73"  "\x5f"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x5f"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x66"  "\x61"  "\x62"  "\x73"  "\x28"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2e"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x5f"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x29"  "\x3b"  "\x0a"  "\x23"  "\x65"  "\x6e"  "\x64"  "\x69"  "\x66"  "\x0a"  "\x23"  "\x69"  "\x66"  "\x20"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x4f"  "\x42"  "\x53"  "\x45"  "\x52"  "\x56"  "\x41"  "\x42"  "\x4c"  "\x45"  "\x53"  "\x20"  "\x26"  "\x20"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x41"  "\x56"  "\x47"  "\x5f"  "\x4d"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2e"  "\x61"  "\x76"  "\x67"  "\x5f"  "\x6d"  "\x20"  "\x3d"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x3b"  "\x0a"  "\x23"  "\x65"  "\x6e"  "\x64"  "\x69"  "\x66"  "\x0a"  "\x23"  "\x69"  "\x66"  "\x20"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x4f"  "\x42"  "\x53"  "\x45"  "\x52"  "\x56"  "\x41"  "\x42"  "\x4c"  "\x45"  "\x53"  "\x20"  "\x26"  "\x20"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x45"  "\x4c"  "\x45"  "\x43"  "\x54"  "\x52"  "\x49"  "\x43"  "\x5f"  "\x46"  "\x49"  "\x45"  "\x4c"  "\x44"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x64"  "\x6d"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x62"  "\x28"  "\x6d"  "\x31"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2e"  "\x65"  "\x6c"  "\x65"  "\x63"  "\x74"  "\x72"  "\x69"  "\x63"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x65"  "\x6d"  "\x65"  "\x72"  "\x67"  "\x65"  "\x6e"  "\x74"  "\x5f"  "\x65"  "\x6c"  "\x65"  "\x63"  "\x74"  "\x72"  "\x69"  "\x63"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x75"  "\x70"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x64"  "\x6d"  "\x2c"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x20"  "\x2f"  "\x20"  "\x64"  "\x74"  "\x29"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x29"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x29"  "\x3b"  "\x0a"  "\x23"  "\x65"  "\x6e"  "\x64"  "\x69"  "\x66"  "\x0a"  "\x23"  "\x69"  "\x66"  "\x20"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x4f"  "\x42"  "\x53"  "\x45"  "\x52"  "\x56"  "\x41"  "\x42"  "\x4c"  "\x45"  "\x53"  "\x20"  "\x26"  "\x20"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x4d"  "\x41"  "\x47"  "\x4e"  "\x45"  "\x54"  "\x49"  "\x43"  "\x5f"  "\x46"  "\x49"  "\x45"  "\x4c"  "\x44"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2e"  "\x6d"  "\x61"  "\x67"  "\x6e"  "\x65"  "\x74"  "\x69"  "\x63"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x5f"  "\x66"  "\x69"  "\x6e"  "\x69"  "\x74"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x65"  "\x6d"  "\x65"  "\x72"  "\x67"  "\x65"  "\x6e"  "\x74"  "\x5f"  "\x6d"  "\x61"  "\x67"  "\x6e"  "\x65"  "\x74"  "\x69"  "\x63"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x5f"  "\x66"  "\x69"  "\x6e"  "\x69"  "\x74"  "\x65"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x75"  "\x70"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2e"  "\x6d"  "\x61"  "\x67"  "\x6e"  "\x65"  "\x74"  "\x69"  "\x63"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x5f"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x65"  "\x6d"  "\x65"  "\x72"  "\x67"  "\x65"  "\x6e"  "\x74"  "\x5f"  "\x6d"  "\x61"  "\x67"  "\x6e"  "\x65"  "\x74"  "\x69"  "\x63"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x5f"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x75"  "\x70"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x29"  "\x3b"  "\x0a"  "\x23"  "\x65"  "\x6e"  "\x64"  "\x69"  "\x66"  "\x0a"  "\x23"  "\x69"  "\x66"  "\x20"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x4f"  "\x42"  "\x53"  "\x45"  "\x52"  "\x56"  "\x41"  "\x42"  "\x4c"  "\x45"  "\x53"  "\x20"  "\x26"  "\x20"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x43"  "\x48"  "\x41"  "\x52"  "\x47"  "\x45"  "\x5f"  "\x43"  "\x45"  "\x4e"  "\x54"  "\x45"  "\x52"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2e"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x5f"  "\x63"  "\x65"  "\x6e"  "\x74"  "\x65"  "\x72"  "\x5f"  "\x78"  "\x20"  "\x3d"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x20"  "\x2a"  "\x20"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2e"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x5f"  "\x66"  "\x69"  "\x6e"  "\x69"  "\x74"  "\x65"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2e"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x5f"  "\x63"  "\x65"  "\x6e"  "\x74"  "\x65"  "\x72"  "\x5f"  "\x79"  "\x20"  "\x3d"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x20"  "\x2a"  "\x20"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2e"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x5f"  "\x66"  "\x69"  "\x6e"  "\x69"  "\x74"  "\x65"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2e"  "\x61"  "\x62"  "\x73"  "\x5f"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x5f"  "\x63"  "\x65"  "\x6e"  "\x74"  "\x65"  "\x72"  "\x5f"  "\x78"  "\x20"  "\x3d"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x20"  "\x2a"  "\x20"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2e"  "\x61"  "\x62"  "\x73"  "\x5f"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x5f"  "\x66"  "\x69"  "\x6e"  "\x69"  "\x74"  "\x65"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2e"  "\x61"  "\x62"  "\x73"  "\x5f"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x5f"  "\x63"  "\x65"  "\x6e"  "\x74"  "\x65"  "\x72"  "\x5f"  "\x79"  "\x20"  "\x3d"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x20"  "\x2a"  "\x20"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2e"  "\x61"  "\x62"  "\x73"  "\x5f"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x5f"  "\x66"  "\x69"  "\x6e"  "\x69"  "\x74"  "\x65"  "\x3b"  "\x0a"  "\x23"  "\x65"  "\x6e"  "\x64"  "\x69"  "\x66"  "\x0a"  "\x23"  "\x69"  "\x66"  "\x20"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x4f"  "\x42"  "\x53"  "\x45"  "\x52"  "\x56"  "\x41"  "\x42"  "\x4c"  "\x45"  "\x53"  "\x20"  "\x26"  "\x20"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x44"  "\x5f"  "\x54"  "\x45"  "\x4e"  "\x53"  "\x4f"  "\x52"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x64"  "\x6d"  "\x5f"  "\x64"  "\x78"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x62"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x29"  "\x2c"  "\x20"  "\x30"  "\x2e"  "\x35"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x64"  "\x6d"  "\x5f"  "\x64"  "\x79"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x62"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x75"  "\x70"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x29"  "\x2c"  "\x20"  "\x30"  "\x2e"  "\x35"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2e"  "\x44"  "\x5f"  "\x78"  "\x78"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x64"  "\x6f"  "\x74"  "\x28"  "\x64"  "\x6d"  "\x5f"  "\x64"  "\x78"  "\x2c"  "\x20"  "\x64"  "\x6d"  "\x5f"  "\x64"  "\x78"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2e"  "\x44"  "\x5f"  "\x79"  "\x79"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x64"  "\x6f"  "\x74"  "\x28"  "\x64"  "\x6d"  "\x5f"  "\x64"  "\x79"  "\x2c"  "\x20"  "\x64"  "\x6d"  "\x5f"  "\x64"  "\x79"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2e"  "\x44"  "\x5f"  "\x78"  "\x79"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x64"  "\x6f"  "\x74"  "\x28"  "\x64"  "\x6d"  "\x5f"  "\x64"  "\x78"  "\x2c"  "\x20"  "\x64"  "\x6d"  "\x5f"  "\x64"  "\x79"  "\x29"  "\x3b"  "\x0a"  "\x23"  "\x65"  "\x6e"  "\x64"  "\x69"  "\x66"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x2f"  "\x2f"  "\x73"  "\x75"  "\x6d"  "\x20"  "\x6f"  "\x66"  "\x20"  "\x76"  "\x20"  "\x6f"  "\x76"  "\x65"  "\x72"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x77"  "\x6f"  "\x72"  "\x6b"  "\x20"  "\x67"  "\x72"  "\x6f"  "\x75"  "\x70"  "\x2c"  "\x20"  "\x65"  "\x76"  "\x65"  "\x72"  "\x79"  "\x20"  "\x69"  "\x74"  "\x65"  "\x6d"  "\x20"  "\x6f"  "\x66"  "\x20"  "\x69"  "\x74"  "\x20"  "\x68"  "\x61"  "\x73"  "\x20"  "\x74"  "\x6f"  "\x20"  "\x63"  "\x61"  "\x6c"  "\x6c"  "\x20"  "\x69"  "\x74"  "\x0a"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x67"  "\x72"  "\x6f"  "\x75"  "\x70"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x4c"  "\x4f"  "\x43"  "\x41"  "\x4c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x2a"  "\x73"  "\x63"  "\x72"  "\x61"  "\x74"  "\x63"  "\x68"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x76"  "\x2c"  "\x20"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x20"  "\x6c"  "\x69"  "\x64"  "\x2c"  "\x20"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x20"  "\x67"  "\x72"  "\x6f"  "\x75"  "\x70"  "\x5f"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x20"  "\x74"  "\x6f"  "\x70"  "\x20"  "\x3d"  "\x20"  "\x31"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x77"  "\x68"  "\x69"  "\x6c"  "\x65"  "\x20"  "\x28"  "\x74"  "\x6f"  "\x70"  "\x20"  "\x3c"  "\x20"  "\x67"  "\x72"  "\x6f"  "\x75"  "\x70"  "\x5f"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x74"  "\x6f"  "\x70"  "\x20"  "\x2a"  "\x3d"  "\x20"  "\x32"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x73"  "\x63"  "\x72"  "\x61"  "\x74"  "\x63"  "\x68"  "\x5b"  "\x6c"  "\x69"  "\x64"  "\x5d"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x66"  "\x6f"  "\x72"  "\x20"  "\x28"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x20"  "\x73"  "\x74"  "\x72"  "\x69"  "\x64"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x74"  "\x6f"  "\x70"  "\x20"  "\x2f"  "\x20"  "\x32"  "\x3b"  "\x20"  "\x73"  "\x74"  "\x72"  "\x69"  "\x64"  "\x65"  "\x20"  "\x3e"  "\x20"  "\x30"  "\x3b"  "\x20"  "\x73"  "\x74"  "\x72"  "\x69"  "\x64"  "\x65"  "\x20"  "\x2f"  "\x3d"  "\x20"  "\x32"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x62"  "\x61"  "\x72"  "\x72"  "\x69"  "\x65"  "\x72"  "\x28"  "\x43"  "\x4c"  "\x4b"  "\x5f"  "\x4c"  "\x4f"  "\x43"  "\x41"  "\x4c"  "\x5f"  "\x4d"  "\x45"  "\x4d"  "\x5f"  "\x46"  "\x45"  "\x4e"  "\x43"  "\x45"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x6c"  "\x69"  "\x64"  "\x20"  "\x3c"  "\x20"  "\x73"  "\x74"  "\x72"  "\x69"  "\x64"  "\x65"  "\x20"  "\x26"  "\x26"  "\x20"  "\x6c"  "\x69"  "\x64"  "\x20"  "\x2b"  "\x20"  "\x73"  "\x74"  "\x72"  "\x69"  "\x64"  "\x65"  "\x20"  "\x3c"  "\x20"  "\x67"  "\x72"  "\x6f"  "\x75"  "\x70"  "\x5f"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x73"  "\x63"  "\x72"  "\x61"  "\x74"  "\x63"  "\x68"  "\x5b"  "\x6c"  "\x69"  "\x64"  "\x5d"  "\x20"  "\x2b"  "\x3d"  "\x20"  "\x73"  "\x63"  "\x72"  "\x61"  "\x74"  "\x63"  "\x68"  "\x5b"  "\x6c"  "\x69"  "\x64"  "\x20"  "\x2b"  "\x20"  "\x73"  "\x74"  "\x72"  "\x69"  "\x64"  "\x65"  "\x5d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7d"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x62"  "\x61"  "\x72"  "\x72"  "\x69"  "\x65"  "\x72"  "\x28"  "\x43"  "\x4c"  "\x4b"  "\x5f"  "\x4c"  "\x4f"  "\x43"  "\x41"  "\x4c"  "\x5f"  "\x4d"  "\x45"  "\x4d"  "\x5f"  "\x46"  "\x45"  "\x4e"  "\x43"  "\x45"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x72"  "\x65"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x73"  "\x63"  "\x72"  "\x61"  "\x74"  "\x63"  "\x68"  "\x5b"  "\x30"  "\x5d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x62"  "\x61"  "\x72"  "\x72"  "\x69"  "\x65"  "\x72"  "\x28"  "\x43"  "\x4c"  "\x4b"  "\x5f"  "\x4c"  "\x4f"  "\x43"  "\x41"  "\x4c"  "\x5f"  "\x4d"  "\x45"  "\x4d"  "\x5f"  "\x46"  "\x45"  "\x4e"  "\x43"  "\x45"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x20"  "\x72"  "\x65"  "\x74"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x2f"  "\x2f"  "\x74"  "\x69"  "\x6d"  "\x65"  "\x20"  "\x69"  "\x73"  "\x20"  "\x74"  "\x30"  "\x20"  "\x2b"  "\x20"  "\x73"  "\x74"  "\x65"  "\x70"  "\x20"  "\x2a"  "\x20"  "\x64"  "\x74"  "\x20"  "\x77"  "\x69"  "\x74"  "\x68"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x73"  "\x74"  "\x65"  "\x70"  "\x20"  "\x63"  "\x6f"  "\x75"  "\x6e"  "\x74"  "\x65"  "\x72"  "\x20"  "\x61"  "\x64"  "\x76"  "\x61"  "\x6e"  "\x63"  "\x65"  "\x64"  "\x20"  "\x6f"  "\x6e"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x64"  "\x65"  "\x76"  "\x69"  "\x63"  "\x65"  "\x20"  "\x62"  "\x79"  "\x20"  "\x61"  "\x64"  "\x76"  "\x61"  "\x6e"  "\x63"  "\x65"  "\x5f"  "\x73"  "\x74"  "\x65"  "\x70"  "\x2c"  "\x20"  "\x73"  "\x6f"  "\x20"  "\x73"  "\x74"  "\x65"  "\x70"  "\x73"  "\x20"  "\x63"  "\x61"  "\x6e"  "\x20"  "\x62"  "\x65"  "\x20"  "\x71"  "\x75"  "\x65"  "\x75"  "\x65"  "\x64"  "\x20"  "\x77"  "\x69"  "\x74"  "\x68"  "\x6f"  "\x75"  "\x74"  "\x20"  "\x74"  "\x6f"  "\x75"  "\x63"  "\x68"  "\x69"  "\x6e"  "\x67"  "\x20"  "\x61"  "\x72"  "\x67"  "\x75"  "\x6d"  "\x65"  "\x6e"  "\x74"  "\x73"  "\x0a"  "\x6b"  "\x65"  "\x72"  "\x6e"  "\x65"  "\x6c"  "\x20"  "\x76"  "\x6f"  "\x69"  "\x64"  "\x20"  "\x67"  "\x70"  "\x75"  "\x5f"  "\x73"  "\x74"  "\x65"  "\x70"  "\x28"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x73"  "\x69"  "\x74"  "\x65"  "\x5f"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x73"  "\x20"  "\x2a"  "\x67"  "\x73"  "\x2c"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x2a"  "\x69"  "\x6e"  "\x70"  "\x75"  "\x74"  "\x2c"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x2a"  "\x6f"  "\x75"  "\x74"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x64"  "\x74"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x74"  "\x30"  "\x2c"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x20"  "\x67"  "\x69"  "\x2c"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x6d"  "\x65"  "\x74"  "\x68"  "\x6f"  "\x64"  "\x2c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x74"  "\x65"  "\x6e"  "\x73"  "\x6f"  "\x72"  "\x20"  "\x2a"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x74"  "\x61"  "\x62"  "\x6c"  "\x65"  "\x2c"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x2a"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x63"  "\x61"  "\x63"  "\x68"  "\x65"  "\x2c"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x63"  "\x61"  "\x63"  "\x68"  "\x65"  "\x64"  "\x2c"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x75"  "\x6c"  "\x6f"  "\x6e"  "\x67"  "\x20"  "\x2a"  "\x73"  "\x74"  "\x65"  "\x70"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x73"  "\x74"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x67"  "\x6c"  "\x6f"  "\x62"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x64"  "\x28"  "\x30"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x73"  "\x74"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x67"  "\x6c"  "\x6f"  "\x62"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x64"  "\x28"  "\x31"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x73"  "\x74"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x61"  "\x63"  "\x74"  "\x69"  "\x76"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x26"  "\x26"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x73"  "\x74"  "\x20"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x20"  "\x69"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x29"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2a"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x20"  "\x2b"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x73"  "\x74"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x74"  "\x69"  "\x6d"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x74"  "\x30"  "\x20"  "\x2b"  "\x20"  "\x73"  "\x74"  "\x65"  "\x70"  "\x5b"  "\x30"  "\x5d"  "\x20"  "\x2a"  "\x20"  "\x64"  "\x74"  "\x3b"  "\x0a"  "\x0a"  "\x23"  "\x69"  "\x66"  "\x64"  "\x65"  "\x66"  "\x20"  "\x49"  "\x4e"  "\x43"  "\x4c"  "\x55"  "\x44"  "\x45"  "\x5f"  "\x44"  "\x49"  "\x50"  "\x4f"  "\x4c"  "\x41"  "\x52"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x4c"  "\x4f"  "\x43"  "\x41"  "\x4c"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x74"  "\x65"  "\x6e"  "\x73"  "\x6f"  "\x72"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x74"  "\x69"  "\x6c"  "\x65"  "\x5b"  "\x44"  "\x49"  "\x50"  "\x4f"  "\x4c"  "\x41"  "\x52"  "\x5f"  "\x54"  "\x49"  "\x4c"  "\x45"  "\x5d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x2f"  "\x2f"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x63"  "\x61"  "\x63"  "\x68"  "\x65"  "\x64"  "\x20"  "\x69"  "\x73"  "\x20"  "\x75"  "\x6e"  "\x69"  "\x66"  "\x6f"  "\x72"  "\x6d"  "\x20"  "\x61"  "\x63"  "\x72"  "\x6f"  "\x73"  "\x73"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x6c"  "\x61"  "\x75"  "\x6e"  "\x63"  "\x68"  "\x2c"  "\x20"  "\x73"  "\x6f"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x62"  "\x61"  "\x72"  "\x72"  "\x69"  "\x65"  "\x72"  "\x73"  "\x20"  "\x69"  "\x6e"  "\x73"  "\x69"  "\x64"  "\x65"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x20"  "\x61"  "\x72"  "\x65"  "\x20"  "\x73"  "\x74"  "\x69"  "\x6c"  "\x6c"  "\x20"  "\x72"  "\x65"  "\x61"  "\x63"  "\x68"  "\x65"  "\x64"  "\x20"  "\x62"  "\x79"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x77"  "\x68"  "\x6f"  "\x6c"  "\x65"  "\x20"  "\x67"  "\x72"  "\x6f"  "\x75"  "\x70"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x63"  "\x61"  "\x63"  "\x68"  "\x65"  "\x64"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x20"  "\x3d"  "\x20"  "\x61"  "\x63"  "\x74"  "\x69"  "\x76"  "\x65"  "\x3f"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x63"  "\x61"  "\x63"  "\x68"  "\x65"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x3a"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x28"  "\x30"  "\x2e"  "\x30"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x65"  "\x6c"  "\x73"  "\x65"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x20"  "\x3d"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x67"  "\x73"  "\x2c"  "\x20"  "\x69"  "\x6e"  "\x70"  "\x75"  "\x74"  "\x2c"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x74"  "\x61"  "\x62"  "\x6c"  "\x65"  "\x2c"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x74"  "\x69"  "\x6c"  "\x65"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2c"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x2c"  "\x20"  "\x61"  "\x63"  "\x74"  "\x69"  "\x76"  "\x65"  "\x29"  "\x3b"  "\x0a"  "\x23"  "\x65"  "\x6c"  "\x73"  "\x65"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x55"  "\x4e"  "\x55"  "\x53"  "\x45"  "\x44"  "\x28"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x74"  "\x61"  "\x62"  "\x6c"  "\x65"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x55"  "\x4e"  "\x55"  "\x53"  "\x45"  "\x44"  "\x28"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x63"  "\x61"  "\x63"  "\x68"  "\x65"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x55"  "\x4e"  "\x55"  "\x53"  "\x45"  "\x44"  "\x28"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x63"  "\x61"  "\x63"  "\x68"  "\x65"  "\x64"  "\x29"  "\x3b"  "\x0a"  "\x23"  "\x65"  "\x6e"  "\x64"  "\x69"  "\x66"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x21"  "\x61"  "\x63"  "\x74"  "\x69"  "\x76"  "\x65"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x65"  "\x74"  "\x65"  "\x72"  "\x73"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x65"  "\x74"  "\x65"  "\x72"  "\x73"  "\x29"  "\x7b"  "\x7d"  "\x3b"  "\x0a"  "\x23"  "\x69"  "\x66"  "\x64"  "\x65"  "\x66"  "\x20"  "\x49"  "\x4e"  "\x43"  "\x4c"  "\x55"  "\x44"  "\x45"  "\x5f"  "\x44"  "\x49"  "\x50"  "\x4f"  "\x4c"  "\x41"  "\x52"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x5f"  "\x66"  "\x72"  "\x6f"  "\x6d"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x2c"  "\x20"  "\x67"  "\x73"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x29"  "\x3b"  "\x0a"  "\x23"  "\x65"  "\x6e"  "\x64"  "\x69"  "\x66"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6f"  "\x75"  "\x74"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x20"  "\x3d"  "\x20"  "\x73"  "\x74"  "\x65"  "\x70"  "\x5f"  "\x73"  "\x69"  "\x74"  "\x65"  "\x28"  "\x67"  "\x73"  "\x2c"  "\x20"  "\x69"  "\x6e"  "\x70"  "\x75"  "\x74"  "\x2c"  "\x20"  "\x64"  "\x74"  "\x2c"  "\x20"  "\x74"  "\x69"  "\x6d"  "\x65"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2c"  "\x20"  "\x6d"  "\x65"  "\x74"  "\x68"  "\x6f"  "\x64"  "\x2c"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x2c"  "\x20"  "\x26"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x29"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x2f"  "\x2f"  "\x67"  "\x70"  "\x75"  "\x5f"  "\x73"  "\x74"  "\x65"  "\x70"  "\x20"  "\x74"  "\x68"  "\x61"  "\x74"  "\x20"  "\x61"  "\x6c"  "\x73"  "\x6f"  "\x20"  "\x73"  "\x75"  "\x6d"  "\x73"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x72"  "\x6d"  "\x61"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x20"  "\x6f"  "\x66"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x73"  "\x74"  "\x65"  "\x70"  "\x20"  "\x6f"  "\x76"  "\x65"  "\x72"  "\x20"  "\x65"  "\x61"  "\x63"  "\x68"  "\x20"  "\x77"  "\x6f"  "\x72"  "\x6b"  "\x20"  "\x67"  "\x72"  "\x6f"  "\x75"  "\x70"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x6f"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x70"  "\x61"  "\x63"  "\x6b"  "\x65"  "\x64"  "\x20"  "\x70"  "\x61"  "\x72"  "\x74"  "\x69"  "\x61"  "\x6c"  "\x5b"  "\x67"  "\x72"  "\x6f"  "\x75"  "\x70"  "\x5d"  "\x2c"  "\x20"  "\x66"  "\x6f"  "\x72"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x70"  "\x72"  "\x69"  "\x63"  "\x65"  "\x20"  "\x6f"  "\x66"  "\x0a"  "\x2f"  "\x2f"  "\x6f"  "\x6e"  "\x65"  "\x20"  "\x72"  "\x65"  "\x64"  "\x75"  "\x63"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x20"  "\x69"  "\x6e"  "\x73"  "\x74"  "\x65"  "\x61"  "\x64"  "\x20"  "\x6f"  "\x66"  "\x20"  "\x61"  "\x6e"  "\x20"  "\x65"  "\x78"  "\x74"  "\x72"  "\x61"  "\x63"  "\x74"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x20"  "\x6c"  "\x61"  "\x75"  "\x6e"  "\x63"  "\x68"  "\x20"  "\x74"  "\x68"  "\x61"  "\x74"  "\x20"  "\x72"  "\x65"  "\x6c"  "\x6f"  "\x61"  "\x64"  "\x73"  "\x20"  "\x65"  "\x76"  "\x65"  "\x72"  "\x79"  "\x74"  "\x68"  "\x69"  "\x6e"  "\x67"  "\x20"  "\x61"  "\x6e"  "\x64"  "\x20"  "\x77"  "\x72"  "\x69"  "\x74"  "\x65"  "\x73"  "\x20"  "\x61"  "\x20"  "\x73"  "\x74"  "\x72"  "\x75"  "\x63"  "\x74"  "\x20"  "\x70"  "\x65"  "\x72"  "\x20"  "\x73"  "\x69"  "\x74"  "\x65"  "\x2e"  "\x0a"  "\x2f"  "\x2f"  "\x73"  "\x63"  "\x72"  "\x61"  "\x74"  "\x63"  "\x68"  "\x20"  "\x68"  "\x6f"  "\x6c"  "\x64"  "\x73"  "\x20"  "\x61"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x70"  "\x65"  "\x72"  "\x20"  "\x77"  "\x6f"  "\x72"  "\x6b"  "\x20"  "\x69"  "\x74"  "\x65"  "\x6d"  "\x20"  "\x6f"  "\x66"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x6c"  "\x61"  "\x72"  "\x67"  "\x65"  "\x73"  "\x74"  "\x20"  "\x67"  "\x72"  "\x6f"  "\x75"  "\x70"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x6b"  "\x65"  "\x72"  "\x6e"  "\x65"  "\x6c"  "\x20"  "\x61"  "\x6c"  "\x6c"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x73"  "\x69"  "\x6e"  "\x63"  "\x65"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x68"  "\x6f"  "\x73"  "\x74"  "\x20"  "\x74"  "\x75"  "\x6e"  "\x65"  "\x73"  "\x20"  "\x69"  "\x74"  "\x73"  "\x20"  "\x6f"  "\x77"  "\x6e"  "\x20"  "\x74"  "\x69"  "\x6c"  "\x65"  "\x20"  "\x66"  "\x6f"  "\x72"  "\x20"  "\x69"  "\x74"  "\x2e"  "\x0a"  "\x2f"  "\x2f"  "\x69"  "\x74"  "\x20"  "\x69"  "\x73"  "\x20"  "\x6f"  "\x6e"  "\x6c"  "\x79"  "\x20"  "\x72"  "\x75"  "\x6e"  "\x20"  "\x77"  "\x69"  "\x74"  "\x68"  "\x6f"  "\x75"  "\x74"  "\x20"  "\x61"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x20"  "\x63"  "\x61"  "\x63"  "\x68"  "\x65"  "\x0a"  "\x6b"  "\x65"  "\x72"  "\x6e"  "\x65"  "\x6c"  "\x20"  "\x76"  "\x6f"  "\x69"  "\x64"  "\x20"  "\x67"  "\x70"  "\x75"  "\x5f"  "\x73"  "\x74"  "\x65"  "\x70"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x28"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x73"  "\x69"  "\x74"  "\x65"  "\x5f"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x73"  "\x20"  "\x2a"  "\x67"  "\x73"  "\x2c"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x2a"  "\x69"  "\x6e"  "\x70"  "\x75"  "\x74"  "\x2c"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x2a"  "\x6f"  "\x75"  "\x74"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x64"  "\x74"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x74"  "\x30"  "\x2c"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x20"  "\x67"  "\x69"  "\x2c"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x6d"  "\x65"  "\x74"  "\x68"  "\x6f"  "\x64"  "\x2c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x74"  "\x65"  "\x6e"  "\x73"  "\x6f"  "\x72"  "\x20"  "\x2a"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x74"  "\x61"  "\x62"  "\x6c"  "\x65"  "\x2c"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x75"  "\x6c"  "\x6f"  "\x6e"  "\x67"  "\x20"  "\x2a"  "\x73"  "\x74"  "\x65"  "\x70"  "\x2c"  "\x20"  "\x4c"  "\x4f"  "\x43"  "\x41"  "\x4c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x2a"  "\x73"  "\x63"  "\x72"  "\x61"  "\x74"  "\x63"  "\x68"  "\x2c"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x2a"  "\x70"  "\x61"  "\x72"  "\x74"  "\x69"  "\x61"  "\x6c"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x73"  "\x74"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x67"  "\x6c"  "\x6f"  "\x62"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x64"  "\x28"  "\x30"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x73"  "\x74"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x67"  "\x6c"  "\x6f"  "\x62"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x64"  "\x28"  "\x31"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x73"  "\x74"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x61"  "\x63"  "\x74"  "\x69"  "\x76"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x26"  "\x26"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x73"  "\x74"  "\x20"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x20"  "\x69"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x29"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2a"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x20"  "\x2b"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x73"  "\x74"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x74"  "\x69"  "\x6d"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x74"  "\x30"  "\x20"  "\x2b"  "\x20"  "\x73"  "\x74"  "\x65"  "\x70"  "\x5b"  "\x30"  "\x5d"  "\x20"  "\x2a"  "\x20"  "\x64"  "\x74"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x73"  "\x74"  "\x20"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x20"  "\x6c"  "\x69"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x64"  "\x28"  "\x31"  "\x29"  "\x20"  "\x2a"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x28"  "\x30"  "\x29"  "\x20"  "\x2b"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x64"  "\x28"  "\x30"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x73"  "\x74"  "\x20"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x20"  "\x67"  "\x72"  "\x6f"  "\x75"  "\x70"  "\x5f"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x28"  "\x30"  "\x29"  "\x20"  "\x2a"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x28"  "\x31"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x23"  "\x69"  "\x66"  "\x64"  "\x65"  "\x66"  "\x20"  "\x49"  "\x4e"  "\x43"  "\x4c"  "\x55"  "\x44"  "\x45"  "\x5f"  "\x44"  "\x49"  "\x50"  "\x4f"  "\x4c"  "\x41"  "\x52"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x4c"  "\x4f"  "\x43"  "\x41"  "\x4c"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x74"  "\x65"  "\x6e"  "\x73"  "\x6f"  "\x72"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x74"  "\x69"  "\x6c"  "\x65"  "\x5b"  "\x44"  "\x49"  "\x50"  "\x4f"  "\x4c"  "\x41"  "\x52"  "\x5f"  "\x54"  "\x49"  "\x4c"  "\x45"  "\x5d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x20"  "\x3d"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x67"  "\x73"  "\x2c"  "\x20"  "\x69"  "\x6e"  "\x70"  "\x75"  "\x74"  "\x2c"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x74"  "\x61"  "\x62"  "\x6c"  "\x65"  "\x2c"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x74"  "\x69"  "\x6c"  "\x65"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2c"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x2c"  "\x20"  "\x61"  "\x63"  "\x74"  "\x69"  "\x76"  "\x65"  "\x29"  "\x3b"  "\x0a"  "\x23"  "\x65"  "\x6c"  "\x73"  "\x65"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x55"  "\x4e"  "\x55"  "\x53"  "\x45"  "\x44"  "\x28"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x74"  "\x61"  "\x62"  "\x6c"  "\x65"  "\x29"  "\x3b"  "\x0a"  "\x23"  "\x65"  "\x6e"  "\x64"  "\x69"  "\x66"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x2f"  "\x2f"  "\x6e"  "\x6f"  "\x20"  "\x65"  "\x61"  "\x72"  "\x6c"  "\x79"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x2c"  "\x20"  "\x65"  "\x76"  "\x65"  "\x72"  "\x79"  "\x20"  "\x69"  "\x74"  "\x65"  "\x6d"  "\x20"  "\x74"  "\x61"  "\x6b"  "\x65"  "\x73"  "\x20"  "\x70"  "\x61"  "\x72"  "\x74"  "\x20"  "\x69"  "\x6e"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x72"  "\x65"  "\x64"  "\x75"  "\x63"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x72"  "\x6d"  "\x61"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x5f"  "\x70"  "\x61"  "\x63"  "\x6b"  "\x65"  "\x64"  "\x20"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x72"  "\x6d"  "\x61"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x5f"  "\x70"  "\x61"  "\x63"  "\x6b"  "\x65"  "\x64"  "\x29"  "\x7b"  "\x7d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x61"  "\x63"  "\x74"  "\x69"  "\x76"  "\x65"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x65"  "\x74"  "\x65"  "\x72"  "\x73"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x65"  "\x74"  "\x65"  "\x72"  "\x73"  "\x29"  "\x7b"  "\x7d"  "\x3b"  "\x0a"  "\x23"  "\x69"  "\x66"  "\x64"  "\x65"  "\x66"  "\x20"  "\x49"  "\x4e"  "\x43"  "\x4c"  "\x55"  "\x44"  "\x45"  "\x5f"  "\x44"  "\x49"  "\x50"  "\x4f"  "\x4c"  "\x41"  "\x52"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x5f"  "\x66"  "\x72"  "\x6f"  "\x6d"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x2c"  "\x20"  "\x67"  "\x73"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x64"  "\x6f"  "\x74"  "\x28"  "\x61"  "\x70"  "\x70"  "\x6c"  "\x79"  "\x5f"  "\x70"  "\x62"  "\x63"  "\x28"  "\x69"  "\x6e"  "\x70"  "\x75"  "\x74"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x70"  "\x62"  "\x63"  "\x2c"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x29"  "\x3b"  "\x0a"  "\x23"  "\x65"  "\x6e"  "\x64"  "\x69"  "\x66"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6e"  "\x65"  "\x78"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x73"  "\x74"  "\x65"  "\x70"  "\x5f"  "\x73"  "\x69"  "\x74"  "\x65"  "\x28"  "\x67"  "\x73"  "\x2c"  "\x20"  "\x69"  "\x6e"  "\x70"  "\x75"  "\x74"  "\x2c"  "\x20"  "\x64"  "\x74"  "\x2c"  "\x20"  "\x74"  "\x69"  "\x6d"  "\x65"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2c"  "\x20"  "\x6d"  "\x65"  "\x74"  "\x68"  "\x6f"  "\x64"  "\x2c"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x2c"  "\x20"  "\x26"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6f"  "\x75"  "\x74"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x20"  "\x3d"  "\x20"  "\x6e"  "\x65"  "\x78"  "\x74"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x20"  "\x3d"  "\x20"  "\x73"  "\x69"  "\x74"  "\x65"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2c"  "\x20"  "\x6e"  "\x65"  "\x78"  "\x74"  "\x2c"  "\x20"  "\x64"  "\x74"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7d"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x2f"  "\x2f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x20"  "\x62"  "\x79"  "\x20"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x20"  "\x74"  "\x68"  "\x72"  "\x6f"  "\x75"  "\x67"  "\x68"  "\x20"  "\x6f"  "\x6e"  "\x65"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x70"  "\x65"  "\x72"  "\x20"  "\x69"  "\x74"  "\x65"  "\x6d"  "\x2c"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x77"  "\x68"  "\x6f"  "\x6c"  "\x65"  "\x20"  "\x73"  "\x74"  "\x72"  "\x75"  "\x63"  "\x74"  "\x20"  "\x70"  "\x65"  "\x72"  "\x20"  "\x69"  "\x74"  "\x65"  "\x6d"  "\x20"  "\x77"  "\x6f"  "\x75"  "\x6c"  "\x64"  "\x20"  "\x6e"  "\x6f"  "\x74"  "\x20"  "\x66"  "\x69"  "\x74"  "\x20"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x20"  "\x6d"  "\x65"  "\x6d"  "\x6f"  "\x72"  "\x79"  "\x0a"  "\x23"  "\x64"  "\x65"  "\x66"  "\x69"  "\x6e"  "\x65"  "\x20"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x52"  "\x45"  "\x44"  "\x55"  "\x43"  "\x45"  "\x28"  "\x62"  "\x69"  "\x74"  "\x73"  "\x2c"  "\x20"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x29"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x4f"  "\x42"  "\x53"  "\x45"  "\x52"  "\x56"  "\x41"  "\x42"  "\x4c"  "\x45"  "\x53"  "\x20"  "\x26"  "\x20"  "\x28"  "\x62"  "\x69"  "\x74"  "\x73"  "\x29"  "\x29"  "\x20"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2e"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x72"  "\x6f"  "\x75"  "\x70"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x73"  "\x63"  "\x72"  "\x61"  "\x74"  "\x63"  "\x68"  "\x2c"  "\x20"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2e"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x2c"  "\x20"  "\x6c"  "\x69"  "\x64"  "\x2c"  "\x20"  "\x67"  "\x72"  "\x6f"  "\x75"  "\x70"  "\x5f"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x46"  "\x49"  "\x45"  "\x4c"  "\x44"  "\x53"  "\x28"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x52"  "\x45"  "\x44"  "\x55"  "\x43"  "\x45"  "\x29"  "\x0a"  "\x23"  "\x75"  "\x6e"  "\x64"  "\x65"  "\x66"  "\x20"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x52"  "\x45"  "\x44"  "\x55"  "\x43"  "\x45"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x6c"  "\x69"  "\x64"  "\x20"  "\x3d"  "\x3d"  "\x20"  "\x30"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x5f"  "\x70"  "\x61"  "\x63"  "\x6b"  "\x28"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x74"  "\x69"  "\x61"  "\x6c"  "\x20"  "\x2b"  "\x20"  "\x28"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x67"  "\x72"  "\x6f"  "\x75"  "\x70"  "\x5f"  "\x69"  "\x64"  "\x28"  "\x31"  "\x29"  "\x20"  "\x2a"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x6e"  "\x75"  "\x6d"  "\x5f"  "\x67"  "\x72"  "\x6f"  "\x75"  "\x70"  "\x73"  "\x28"  "\x30"  "\x29"  "\x20"  "\x2b"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x67"  "\x72"  "\x6f"  "\x75"  "\x70"  "\x5f"  "\x69"  "\x64"  "\x28"  "\x30"  "\x29"  "\x29"  "\x20"  "\x2a"  "\x20"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x50"  "\x41"  "\x43"  "\x4b"  "\x45"  "\x44"  "\x5f"  "\x44"  "\x4f"  "\x55"  "\x42"  "\x4c"  "\x45"  "\x53"  "\x29"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x6b"  "\x65"  "\x72"  "\x6e"  "\x65"  "\x6c"  "\x20"  "\x76"  "\x6f"  "\x69"  "\x64"  "\x20"  "\x65"  "\x78"  "\x74"  "\x72"  "\x61"  "\x63"  "\x74"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x28"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x73"  "\x69"  "\x74"  "\x65"  "\x5f"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x73"  "\x20"  "\x2a"  "\x67"  "\x73"  "\x2c"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x2a"  "\x6d"  "\x30"  "\x2c"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x2a"  "\x6d"  "\x31"  "\x2c"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x2a"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x64"  "\x74"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x74"  "\x69"  "\x6d"  "\x65"  "\x2c"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x20"  "\x67"  "\x69"  "\x2c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x74"  "\x65"  "\x6e"  "\x73"  "\x6f"  "\x72"  "\x20"  "\x2a"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x74"  "\x61"  "\x62"  "\x6c"  "\x65"  "\x2c"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x2a"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x63"  "\x61"  "\x63"  "\x68"  "\x65"  "\x2c"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x63"  "\x61"  "\x63"  "\x68"  "\x65"  "\x64"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x73"  "\x74"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x67"  "\x6c"  "\x6f"  "\x62"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x64"  "\x28"  "\x30"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x73"  "\x74"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x67"  "\x6c"  "\x6f"  "\x62"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x64"  "\x28"  "\x31"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x73"  "\x74"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x61"  "\x63"  "\x74"  "\x69"  "\x76"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x26"  "\x26"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x73"  "\x74"  "\x20"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x20"  "\x69"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x29"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2a"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x20"  "\x2b"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x3b"  "\x0a"  "\x0a"  "\x23"  "\x69"  "\x66"  "\x64"  "\x65"  "\x66"  "\x20"  "\x49"  "\x4e"  "\x43"  "\x4c"  "\x55"  "\x44"  "\x45"  "\x5f"  "\x44"  "\x49"  "\x50"  "\x4f"  "\x4c"  "\x41"  "\x52"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x4c"  "\x4f"  "\x43"  "\x41"  "\x4c"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x74"  "\x65"  "\x6e"  "\x73"  "\x6f"  "\x72"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x74"  "\x69"  "\x6c"  "\x65"  "\x5b"  "\x44"  "\x49"  "\x50"  "\x4f"  "\x4c"  "\x41"  "\x52"  "\x5f"  "\x54"  "\x49"  "\x4c"  "\x45"  "\x5d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x20"  "\x3d"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x67"  "\x73"  "\x2c"  "\x20"  "\x6d"  "\x30"  "\x2c"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x74"  "\x61"  "\x62"  "\x6c"  "\x65"  "\x2c"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x74"  "\x69"  "\x6c"  "\x65"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2c"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x2c"  "\x20"  "\x61"  "\x63"  "\x74"  "\x69"  "\x76"  "\x65"  "\x29"  "\x3b"  "\x0a"  "\x23"  "\x65"  "\x6c"  "\x73"  "\x65"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x55"  "\x4e"  "\x55"  "\x53"  "\x45"  "\x44"  "\x28"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x74"  "\x61"  "\x62"  "\x6c"  "\x65"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x55"  "\x4e"  "\x55"  "\x53"  "\x45"  "\x44"  "\x28"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x63"  "\x61"  "\x63"  "\x68"  "\x65"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x55"  "\x4e"  "\x55"  "\x53"  "\x45"  "\x44"  "\x28"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x63"  "\x61"  "\x63"  "\x68"  "\x65"  "\x64"  "\x29"  "\x3b"  "\x0a"  "\x23"  "\x65"  "\x6e"  "\x64"  "\x69"  "\x66"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x21"  "\x61"  "\x63"  "\x74"  "\x69"  "\x76"  "\x65"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x65"  "\x74"  "\x65"  "\x72"  "\x73"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x65"  "\x74"  "\x65"  "\x72"  "\x73"  "\x29"  "\x7b"  "\x7d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x73"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x20"  "\x3d"  "\x20"  "\x6d"  "\x30"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x61"  "\x70"  "\x70"  "\x6c"  "\x79"  "\x5f"  "\x70"  "\x62"  "\x63"  "\x28"  "\x6d"  "\x30"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x70"  "\x62"  "\x63"  "\x2c"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x2d"  "\x20"  "\x31"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x61"  "\x70"  "\x70"  "\x6c"  "\x79"  "\x5f"  "\x70"  "\x62"  "\x63"  "\x28"  "\x6d"  "\x30"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x70"  "\x62"  "\x63"  "\x2c"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x2b"  "\x20"  "\x31"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x75"  "\x70"  "\x20"  "\x3d"  "\x20"  "\x61"  "\x70"  "\x70"  "\x6c"  "\x79"  "\x5f"  "\x70"  "\x62"  "\x63"  "\x28"  "\x6d"  "\x30"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x70"  "\x62"  "\x63"  "\x2c"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2b"  "\x20"  "\x31"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x20"  "\x3d"  "\x20"  "\x61"  "\x70"  "\x70"  "\x6c"  "\x79"  "\x5f"  "\x70"  "\x62"  "\x63"  "\x28"  "\x6d"  "\x30"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x70"  "\x62"  "\x63"  "\x2c"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2d"  "\x20"  "\x31"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x74"  "\x69"  "\x6d"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x74"  "\x69"  "\x6d"  "\x65"  "\x3b"  "\x0a"  "\x23"  "\x69"  "\x66"  "\x64"  "\x65"  "\x66"  "\x20"  "\x49"  "\x4e"  "\x43"  "\x4c"  "\x55"  "\x44"  "\x45"  "\x5f"  "\x44"  "\x49"  "\x50"  "\x4f"  "\x4c"  "\x41"  "\x52"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x64"  "\x6f"  "\x74"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2c"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x5f"  "\x66"  "\x72"  "\x6f"  "\x6d"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x23"  "\x65"  "\x6e"  "\x64"  "\x69"  "\x66"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x72"  "\x6d"  "\x61"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x5f"  "\x70"  "\x61"  "\x63"  "\x6b"  "\x65"  "\x64"  "\x20"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x20"  "\x3d"  "\x20"  "\x73"  "\x69"  "\x74"  "\x65"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2c"  "\x20"  "\x6d"  "\x31"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x2c"  "\x20"  "\x64"  "\x74"  "\x29"  "\x3b"  "\x0a"  "\x23"  "\x69"  "\x66"  "\x64"  "\x65"  "\x66"  "\x20"  "\x49"  "\x4e"  "\x43"  "\x4c"  "\x55"  "\x44"  "\x45"  "\x5f"  "\x44"  "\x49"  "\x50"  "\x4f"  "\x4c"  "\x41"  "\x52"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x28"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x4f"  "\x42"  "\x53"  "\x45"  "\x52"  "\x56"  "\x41"  "\x42"  "\x4c"  "\x45"  "\x53"  "\x20"  "\x26"  "\x20"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x44"  "\x49"  "\x50"  "\x4f"  "\x4c"  "\x41"  "\x52"  "\x5f"  "\x45"  "\x52"  "\x52"  "\x4f"  "\x52"  "\x29"  "\x20"  "\x26"  "\x26"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x63"  "\x61"  "\x63"  "\x68"  "\x65"  "\x64"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x66"  "\x72"  "\x65"  "\x73"  "\x68"  "\x20"  "\x3d"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x5f"  "\x66"  "\x72"  "\x6f"  "\x6d"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x65"  "\x72"  "\x72"  "\x6f"  "\x72"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x62"  "\x28"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x5f"  "\x66"  "\x72"  "\x6f"  "\x6d"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x63"  "\x61"  "\x63"  "\x68"  "\x65"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x29"  "\x2c"  "\x20"  "\x66"  "\x72"  "\x65"  "\x73"  "\x68"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2e"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x63"  "\x61"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x65"  "\x72"  "\x72"  "\x6f"  "\x72"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x64"  "\x6f"  "\x74"  "\x28"  "\x65"  "\x72"  "\x72"  "\x6f"  "\x72"  "\x2c"  "\x20"  "\x65"  "\x72"  "\x72"  "\x6f"  "\x72"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2e"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x5f"  "\x6e"  "\x6f"  "\x72"  "\x6d"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x64"  "\x6f"  "\x74"  "\x28"  "\x66"  "\x72"  "\x65"  "\x73"  "\x68"  "\x2c"  "\x20"  "\x66"  "\x72"  "\x65"  "\x73"  "\x68"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7d"  "\x0a"  "\x23"  "\x65"  "\x6e"  "\x64"  "\x69"  "\x66"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x5f"  "\x70"  "\x61"  "\x63"  "\x6b"  "\x28"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x2c"  "\x20"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x20"  "\x2b"  "\x20"  "\x69"  "\x64"  "\x20"  "\x2a"  "\x20"  "\x49"  "\x4e"  "\x46"  "\x4f"  "\x5f"  "\x50"  "\x41"  "\x43"  "\x4b"  "\x45"  "\x44"  "\x5f"  "\x44"  "\x4f"  "\x55"  "\x42"  "\x4c"  "\x45"  "\x53"  "\x29"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x6b"  "\x65"  "\x72"  "\x6e"  "\x65"  "\x6c"  "\x20"  "\x76"  "\x6f"  "\x69"  "\x64"  "\x20"  "\x65"  "\x78"  "\x63"  "\x68"  "\x61"  "\x6e"  "\x67"  "\x65"  "\x5f"  "\x67"  "\x72"  "\x69"  "\x64"  "\x28"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x2a"  "\x74"  "\x6f"  "\x2c"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x2a"  "\x66"  "\x72"  "\x6f"  "\x6d"  "\x2c"  "\x20"  "\x75"  "\x6e"  "\x73"  "\x69"  "\x67"  "\x6e"  "\x65"  "\x64"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x75"  "\x6e"  "\x73"  "\x69"  "\x67"  "\x6e"  "\x65"  "\x64"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x20"  "\x69"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x67"  "\x6c"  "\x6f"  "\x62"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x64"  "\x28"  "\x30"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x69"  "\x64"  "\x20"  "\x3c"  "\x20"  "\x28"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x2a"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x74"  "\x6f"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x20"  "\x3d"  "\x20"  "\x66"  "\x72"  "\x6f"  "\x6d"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x2f"  "\x2f"  "\x65"  "\x78"  "\x63"  "\x68"  "\x61"  "\x6e"  "\x67"  "\x65"  "\x5f"  "\x67"  "\x72"  "\x69"  "\x64"  "\x20"  "\x74"  "\x68"  "\x61"  "\x74"  "\x20"  "\x61"  "\x6c"  "\x73"  "\x6f"  "\x20"  "\x6d"  "\x6f"  "\x76"  "\x65"  "\x73"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x73"  "\x74"  "\x65"  "\x70"  "\x20"  "\x63"  "\x6f"  "\x75"  "\x6e"  "\x74"  "\x65"  "\x72"  "\x20"  "\x72"  "\x65"  "\x61"  "\x64"  "\x20"  "\x62"  "\x79"  "\x20"  "\x67"  "\x70"  "\x75"  "\x5f"  "\x73"  "\x74"  "\x65"  "\x70"  "\x2c"  "\x20"  "\x6c"  "\x61"  "\x75"  "\x6e"  "\x63"  "\x68"  "\x65"  "\x73"  "\x20"  "\x6f"  "\x6e"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x71"  "\x75"  "\x65"  "\x75"  "\x65"  "\x20"  "\x61"  "\x72"  "\x65"  "\x20"  "\x6f"  "\x72"  "\x64"  "\x65"  "\x72"  "\x65"  "\x64"  "\x20"  "\x73"  "\x6f"  "\x20"  "\x6e"  "\x6f"  "\x20"  "\x61"  "\x74"  "\x6f"  "\x6d"  "\x69"  "\x63"  "\x73"  "\x20"  "\x61"  "\x72"  "\x65"  "\x20"  "\x6e"  "\x65"  "\x65"  "\x64"  "\x65"  "\x64"  "\x0a"  "\x6b"  "\x65"  "\x72"  "\x6e"  "\x65"  "\x6c"  "\x20"  "\x76"  "\x6f"  "\x69"  "\x64"  "\x20"  "\x61"  "\x64"  "\x76"  "\x61"  "\x6e"  "\x63"  "\x65"  "\x5f"  "\x73"  "\x74"  "\x65"  "\x70"  "\x28"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x2a"  "\x74"  "\x6f"  "\x2c"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x2a"  "\x66"  "\x72"  "\x6f"  "\x6d"  "\x2c"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x75"  "\x6c"  "\x6f"  "\x6e"  "\x67"  "\x20"  "\x2a"  "\x73"  "\x74"  "\x65"  "\x70"  "\x2c"  "\x20"  "\x75"  "\x6e"  "\x73"  "\x69"  "\x67"  "\x6e"  "\x65"  "\x64"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x75"  "\x6e"  "\x73"  "\x69"  "\x67"  "\x6e"  "\x65"  "\x64"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x20"  "\x69"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x67"  "\x6c"  "\x6f"  "\x62"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x64"  "\x28"  "\x30"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x69"  "\x64"  "\x20"  "\x3d"  "\x3d"  "\x20"  "\x30"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x73"  "\x74"  "\x65"  "\x70"  "\x5b"  "\x30"  "\x5d"  "\x20"  "\x2b"  "\x3d"  "\x20"  "\x31"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x69"  "\x64"  "\x20"  "\x3c"  "\x20"  "\x28"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x2a"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x74"  "\x6f"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x20"  "\x3d"  "\x20"  "\x66"  "\x72"  "\x6f"  "\x6d"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x2f"  "\x2f"  "\x73"  "\x74"  "\x6f"  "\x72"  "\x65"  "\x73"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x20"  "\x73"  "\x75"  "\x6d"  "\x20"  "\x6f"  "\x66"  "\x20"  "\x76"  "\x20"  "\x66"  "\x6f"  "\x72"  "\x20"  "\x67"  "\x70"  "\x75"  "\x5f"  "\x73"  "\x74"  "\x65"  "\x70"  "\x20"  "\x74"  "\x6f"  "\x20"  "\x72"  "\x65"  "\x75"  "\x73"  "\x65"  "\x20"  "\x61"  "\x6e"  "\x64"  "\x20"  "\x6b"  "\x65"  "\x65"  "\x70"  "\x73"  "\x20"  "\x76"  "\x20"  "\x61"  "\x73"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x72"  "\x65"  "\x66"  "\x65"  "\x72"  "\x65"  "\x6e"  "\x63"  "\x65"  "\x20"  "\x66"  "\x6f"  "\x72"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x64"  "\x72"  "\x69"  "\x66"  "\x74"  "\x0a"  "\x6b"  "\x65"  "\x72"  "\x6e"  "\x65"  "\x6c"  "\x20"  "\x76"  "\x6f"  "\x69"  "\x64"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x72"  "\x65"  "\x66"  "\x72"  "\x65"  "\x73"  "\x68"  "\x28"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x73"  "\x69"  "\x74"  "\x65"  "\x5f"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x73"  "\x20"  "\x2a"  "\x67"  "\x73"  "\x2c"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x2a"  "\x76"  "\x2c"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x74"  "\x65"  "\x6e"  "\x73"  "\x6f"  "\x72"  "\x20"  "\x2a"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x74"  "\x61"  "\x62"  "\x6c"  "\x65"  "\x2c"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x2a"  "\x63"  "\x61"  "\x63"  "\x68"  "\x65"  "\x2c"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x2a"  "\x72"  "\x65"  "\x66"  "\x65"  "\x72"  "\x65"  "\x6e"  "\x63"  "\x65"  "\x2c"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x20"  "\x67"  "\x69"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x73"  "\x74"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x67"  "\x6c"  "\x6f"  "\x62"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x64"  "\x28"  "\x30"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x73"  "\x74"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x67"  "\x6c"  "\x6f"  "\x62"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x64"  "\x28"  "\x31"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x73"  "\x74"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x61"  "\x63"  "\x74"  "\x69"  "\x76"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x26"  "\x26"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x73"  "\x74"  "\x20"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x20"  "\x69"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x29"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2a"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x20"  "\x2b"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x3b"  "\x0a"  "\x0a"  "\x23"  "\x69"  "\x66"  "\x64"  "\x65"  "\x66"  "\x20"  "\x49"  "\x4e"  "\x43"  "\x4c"  "\x55"  "\x44"  "\x45"  "\x5f"  "\x44"  "\x49"  "\x50"  "\x4f"  "\x4c"  "\x41"  "\x52"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x4c"  "\x4f"  "\x43"  "\x41"  "\x4c"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x74"  "\x65"  "\x6e"  "\x73"  "\x6f"  "\x72"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x74"  "\x69"  "\x6c"  "\x65"  "\x5b"  "\x44"  "\x49"  "\x50"  "\x4f"  "\x4c"  "\x41"  "\x52"  "\x5f"  "\x54"  "\x49"  "\x4c"  "\x45"  "\x5d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x20"  "\x3d"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x67"  "\x73"  "\x2c"  "\x20"  "\x76"  "\x2c"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x74"  "\x61"  "\x62"  "\x6c"  "\x65"  "\x2c"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x74"  "\x69"  "\x6c"  "\x65"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2c"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x2c"  "\x20"  "\x61"  "\x63"  "\x74"  "\x69"  "\x76"  "\x65"  "\x29"  "\x3b"  "\x0a"  "\x23"  "\x65"  "\x6c"  "\x73"  "\x65"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x55"  "\x4e"  "\x55"  "\x53"  "\x45"  "\x44"  "\x28"  "\x67"  "\x73"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x55"  "\x4e"  "\x55"  "\x53"  "\x45"  "\x44"  "\x28"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x74"  "\x61"  "\x62"  "\x6c"  "\x65"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x55"  "\x4e"  "\x55"  "\x53"  "\x45"  "\x44"  "\x28"  "\x72"  "\x6f"  "\x77"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x55"  "\x4e"  "\x55"  "\x53"  "\x45"  "\x44"  "\x28"  "\x63"  "\x6f"  "\x6c"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x28"  "\x30"  "\x2e"  "\x30"  "\x29"  "\x3b"  "\x0a"  "\x23"  "\x65"  "\x6e"  "\x64"  "\x69"  "\x66"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x21"  "\x61"  "\x63"  "\x74"  "\x69"  "\x76"  "\x65"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x61"  "\x63"  "\x68"  "\x65"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x20"  "\x3d"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x66"  "\x65"  "\x72"  "\x65"  "\x6e"  "\x63"  "\x65"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x2f"  "\x2f"  "\x42"  "\x61"  "\x72"  "\x6e"  "\x65"  "\x73"  "\x2d"  "\x48"  "\x75"  "\x74"  "\x3a"  "\x20"  "\x6c"  "\x65"  "\x61"  "\x76"  "\x65"  "\x73"  "\x20"  "\x61"  "\x72"  "\x65"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x73"  "\x69"  "\x74"  "\x65"  "\x73"  "\x20"  "\x74"  "\x68"  "\x65"  "\x6d"  "\x73"  "\x65"  "\x6c"  "\x76"  "\x65"  "\x73"  "\x2c"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x73"  "\x61"  "\x6d"  "\x70"  "\x6c"  "\x65"  "\x20"  "\x69"  "\x73"  "\x20"  "\x74"  "\x72"  "\x65"  "\x61"  "\x74"  "\x65"  "\x64"  "\x20"  "\x61"  "\x73"  "\x20"  "\x69"  "\x73"  "\x6f"  "\x6c"  "\x61"  "\x74"  "\x65"  "\x64"  "\x20"  "\x28"  "\x6e"  "\x6f"  "\x20"  "\x69"  "\x6d"  "\x61"  "\x67"  "\x65"  "\x73"  "\x2c"  "\x20"  "\x6e"  "\x6f"  "\x20"  "\x62"  "\x6f"  "\x75"  "\x6e"  "\x64"  "\x61"  "\x72"  "\x79"  "\x20"  "\x73"  "\x70"  "\x69"  "\x6e"  "\x73"  "\x29"  "\x0a"  "\x6b"  "\x65"  "\x72"  "\x6e"  "\x65"  "\x6c"  "\x20"  "\x76"  "\x6f"  "\x69"  "\x64"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x74"  "\x72"  "\x65"  "\x65"  "\x5f"  "\x6c"  "\x65"  "\x61"  "\x76"  "\x65"  "\x73"  "\x28"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x73"  "\x69"  "\x74"  "\x65"  "\x5f"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x73"  "\x20"  "\x2a"  "\x67"  "\x73"  "\x2c"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x2a"  "\x76"  "\x2c"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x6e"  "\x6f"  "\x64"  "\x65"  "\x20"  "\x2a"  "\x6e"  "\x6f"  "\x64"  "\x65"  "\x73"  "\x2c"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x2a"  "\x72"  "\x65"  "\x66"  "\x65"  "\x72"  "\x65"  "\x6e"  "\x63"  "\x65"  "\x2c"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x20"  "\x67"  "\x69"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x20"  "\x69"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x67"  "\x6c"  "\x6f"  "\x62"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x64"  "\x28"  "\x30"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x69"  "\x64"  "\x20"  "\x3e"  "\x3d"  "\x20"  "\x28"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x2a"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x6d"  "\x75"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x73"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x2e"  "\x6d"  "\x75"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6d"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6e"  "\x6f"  "\x64"  "\x65"  "\x73"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x6e"  "\x6f"  "\x64"  "\x65"  "\x29"  "\x7b"  "\x2e"  "\x6d"  "\x6f"  "\x6d"  "\x65"  "\x6e"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x6d"  "\x2c"  "\x20"  "\x6d"  "\x75"  "\x29"  "\x2c"  "\x20"  "\x2e"  "\x78"  "\x20"  "\x3d"  "\x20"  "\x69"  "\x64"  "\x20"  "\x25"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x2c"  "\x20"  "\x2e"  "\x79"  "\x20"  "\x3d"  "\x20"  "\x69"  "\x64"  "\x20"  "\x2f"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x2c"  "\x20"  "\x2e"  "\x77"  "\x65"  "\x69"  "\x67"  "\x68"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x66"  "\x61"  "\x62"  "\x73"  "\x28"  "\x6d"  "\x75"  "\x29"  "\x7d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x66"  "\x65"  "\x72"  "\x65"  "\x6e"  "\x63"  "\x65"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x20"  "\x3d"  "\x20"  "\x6d"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x6b"  "\x65"  "\x72"  "\x6e"  "\x65"  "\x6c"  "\x20"  "\x76"  "\x6f"  "\x69"  "\x64"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x74"  "\x72"  "\x65"  "\x65"  "\x5f"  "\x6c"  "\x65"  "\x76"  "\x65"  "\x6c"  "\x28"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x6e"  "\x6f"  "\x64"  "\x65"  "\x20"  "\x2a"  "\x6e"  "\x6f"  "\x64"  "\x65"  "\x73"  "\x2c"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x20"  "\x67"  "\x69"  "\x2c"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x6c"  "\x65"  "\x76"  "\x65"  "\x6c"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x20"  "\x69"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x67"  "\x6c"  "\x6f"  "\x62"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x64"  "\x28"  "\x30"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x6f"  "\x66"  "\x66"  "\x73"  "\x65"  "\x74"  "\x73"  "\x5b"  "\x44"  "\x49"  "\x50"  "\x4f"  "\x4c"  "\x41"  "\x52"  "\x5f"  "\x54"  "\x52"  "\x45"  "\x45"  "\x5f"  "\x4d"  "\x41"  "\x58"  "\x5f"  "\x4c"  "\x45"  "\x56"  "\x45"  "\x4c"  "\x53"  "\x5d"  "\x2c"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x5b"  "\x44"  "\x49"  "\x50"  "\x4f"  "\x4c"  "\x41"  "\x52"  "\x5f"  "\x54"  "\x52"  "\x45"  "\x45"  "\x5f"  "\x4d"  "\x41"  "\x58"  "\x5f"  "\x4c"  "\x45"  "\x56"  "\x45"  "\x4c"  "\x53"  "\x5d"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x5b"  "\x44"  "\x49"  "\x50"  "\x4f"  "\x4c"  "\x41"  "\x52"  "\x5f"  "\x54"  "\x52"  "\x45"  "\x45"  "\x5f"  "\x4d"  "\x41"  "\x58"  "\x5f"  "\x4c"  "\x45"  "\x56"  "\x45"  "\x4c"  "\x53"  "\x5d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x74"  "\x72"  "\x65"  "\x65"  "\x5f"  "\x6c"  "\x65"  "\x76"  "\x65"  "\x6c"  "\x73"  "\x28"  "\x67"  "\x69"  "\x2c"  "\x20"  "\x6f"  "\x66"  "\x66"  "\x73"  "\x65"  "\x74"  "\x73"  "\x2c"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x69"  "\x64"  "\x20"  "\x3e"  "\x3d"  "\x20"  "\x28"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x5b"  "\x6c"  "\x65"  "\x76"  "\x65"  "\x6c"  "\x5d"  "\x20"  "\x2a"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x5b"  "\x6c"  "\x65"  "\x76"  "\x65"  "\x6c"  "\x5d"  "\x29"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3d"  "\x20"  "\x69"  "\x64"  "\x20"  "\x25"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x5b"  "\x6c"  "\x65"  "\x76"  "\x65"  "\x6c"  "\x5d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3d"  "\x20"  "\x69"  "\x64"  "\x20"  "\x2f"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x5b"  "\x6c"  "\x65"  "\x76"  "\x65"  "\x6c"  "\x5d"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x6e"  "\x6f"  "\x64"  "\x65"  "\x20"  "\x63"  "\x65"  "\x6c"  "\x6c"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x6e"  "\x6f"  "\x64"  "\x65"  "\x29"  "\x7b"  "\x7d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x66"  "\x6f"  "\x72"  "\x20"  "\x28"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x64"  "\x72"  "\x20"  "\x3d"  "\x20"  "\x30"  "\x3b"  "\x20"  "\x64"  "\x72"  "\x20"  "\x3c"  "\x20"  "\x32"  "\x3b"  "\x20"  "\x2b"  "\x2b"  "\x64"  "\x72"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x66"  "\x6f"  "\x72"  "\x20"  "\x28"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x64"  "\x63"  "\x20"  "\x3d"  "\x20"  "\x30"  "\x3b"  "\x20"  "\x64"  "\x63"  "\x20"  "\x3c"  "\x20"  "\x32"  "\x3b"  "\x20"  "\x2b"  "\x2b"  "\x64"  "\x63"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x63"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3d"  "\x20"  "\x32"  "\x20"  "\x2a"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2b"  "\x20"  "\x64"  "\x72"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x63"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3d"  "\x20"  "\x32"  "\x20"  "\x2a"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x2b"  "\x20"  "\x64"  "\x63"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x63"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3e"  "\x3d"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x5b"  "\x6c"  "\x65"  "\x76"  "\x65"  "\x6c"  "\x20"  "\x2d"  "\x20"  "\x31"  "\x5d"  "\x20"  "\x7c"  "\x7c"  "\x20"  "\x63"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3e"  "\x3d"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x5b"  "\x6c"  "\x65"  "\x76"  "\x65"  "\x6c"  "\x20"  "\x2d"  "\x20"  "\x31"  "\x5d"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x74"  "\x69"  "\x6e"  "\x75"  "\x65"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x6e"  "\x6f"  "\x64"  "\x65"  "\x20"  "\x63"  "\x68"  "\x69"  "\x6c"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x6e"  "\x6f"  "\x64"  "\x65"  "\x73"  "\x5b"  "\x6f"  "\x66"  "\x66"  "\x73"  "\x65"  "\x74"  "\x73"  "\x5b"  "\x6c"  "\x65"  "\x76"  "\x65"  "\x6c"  "\x20"  "\x2d"  "\x20"  "\x31"  "\x5d"  "\x20"  "\x2b"  "\x20"  "\x63"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2a"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x5b"  "\x6c"  "\x65"  "\x76"  "\x65"  "\x6c"  "\x20"  "\x2d"  "\x20"  "\x31"  "\x5d"  "\x20"  "\x2b"  "\x20"  "\x63"  "\x63"  "\x6f"  "\x6c"  "\x5d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x65"  "\x6c"  "\x6c"  "\x2e"  "\x6d"  "\x6f"  "\x6d"  "\x65"  "\x6e"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x63"  "\x65"  "\x6c"  "\x6c"  "\x2e"  "\x6d"  "\x6f"  "\x6d"  "\x65"  "\x6e"  "\x74"  "\x2c"  "\x20"  "\x63"  "\x68"  "\x69"  "\x6c"  "\x64"  "\x2e"  "\x6d"  "\x6f"  "\x6d"  "\x65"  "\x6e"  "\x74"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x65"  "\x6c"  "\x6c"  "\x2e"  "\x78"  "\x20"  "\x2b"  "\x3d"  "\x20"  "\x63"  "\x68"  "\x69"  "\x6c"  "\x64"  "\x2e"  "\x77"  "\x65"  "\x69"  "\x67"  "\x68"  "\x74"  "\x20"  "\x2a"  "\x20"  "\x63"  "\x68"  "\x69"  "\x6c"  "\x64"  "\x2e"  "\x78"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x65"  "\x6c"  "\x6c"  "\x2e"  "\x79"  "\x20"  "\x2b"  "\x3d"  "\x20"  "\x63"  "\x68"  "\x69"  "\x6c"  "\x64"  "\x2e"  "\x77"  "\x65"  "\x69"  "\x67"  "\x68"  "\x74"  "\x20"  "\x2a"  "\x20"  "\x63"  "\x68"  "\x69"  "\x6c"  "\x64"  "\x2e"  "\x79"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x65"  "\x6c"  "\x6c"  "\x2e"  "\x77"  "\x65"  "\x69"  "\x67"  "\x68"  "\x74"  "\x20"  "\x2b"  "\x3d"  "\x20"  "\x63"  "\x68"  "\x69"  "\x6c"  "\x64"  "\x2e"  "\x77"  "\x65"  "\x69"  "\x67"  "\x68"  "\x74"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7d"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7d"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x63"  "\x65"  "\x6c"  "\x6c"  "\x2e"  "\x77"  "\x65"  "\x69"  "\x67"  "\x68"  "\x74"  "\x20"  "\x3e"  "\x20"  "\x30"  "\x2e"  "\x30"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x65"  "\x6c"  "\x6c"  "\x2e"  "\x78"  "\x20"  "\x2f"  "\x3d"  "\x20"  "\x63"  "\x65"  "\x6c"  "\x6c"  "\x2e"  "\x77"  "\x65"  "\x69"  "\x67"  "\x68"  "\x74"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x65"  "\x6c"  "\x6c"  "\x2e"  "\x79"  "\x20"  "\x2f"  "\x3d"  "\x20"  "\x63"  "\x65"  "\x6c"  "\x6c"  "\x2e"  "\x77"  "\x65"  "\x69"  "\x67"  "\x68"  "\x74"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7d"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6e"  "\x6f"  "\x64"  "\x65"  "\x73"  "\x5b"  "\x6f"  "\x66"  "\x66"  "\x73"  "\x65"  "\x74"  "\x73"  "\x5b"  "\x6c"  "\x65"  "\x76"  "\x65"  "\x6c"  "\x5d"  "\x20"  "\x2b"  "\x20"  "\x69"  "\x64"  "\x5d"  "\x20"  "\x3d"  "\x20"  "\x63"  "\x65"  "\x6c"  "\x6c"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x2f"  "\x2f"  "\x61"  "\x20"  "\x63"  "\x65"  "\x6c"  "\x6c"  "\x20"  "\x6f"  "\x66"  "\x20"  "\x73"  "\x69"  "\x64"  "\x65"  "\x20"  "\x73"  "\x20"  "\x73"  "\x65"  "\x65"  "\x6e"  "\x20"  "\x61"  "\x74"  "\x20"  "\x64"  "\x69"  "\x73"  "\x74"  "\x61"  "\x6e"  "\x63"  "\x65"  "\x20"  "\x64"  "\x20"  "\x69"  "\x73"  "\x20"  "\x75"  "\x73"  "\x65"  "\x64"  "\x20"  "\x61"  "\x73"  "\x20"  "\x61"  "\x20"  "\x73"  "\x69"  "\x6e"  "\x67"  "\x6c"  "\x65"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x65"  "\x20"  "\x77"  "\x68"  "\x65"  "\x6e"  "\x20"  "\x73"  "\x20"  "\x3c"  "\x20"  "\x74"  "\x68"  "\x65"  "\x74"  "\x61"  "\x20"  "\x2a"  "\x20"  "\x64"  "\x2c"  "\x20"  "\x6f"  "\x74"  "\x68"  "\x65"  "\x72"  "\x77"  "\x69"  "\x73"  "\x65"  "\x20"  "\x69"  "\x74"  "\x73"  "\x20"  "\x63"  "\x68"  "\x69"  "\x6c"  "\x64"  "\x72"  "\x65"  "\x6e"  "\x20"  "\x61"  "\x72"  "\x65"  "\x20"  "\x76"  "\x69"  "\x73"  "\x69"  "\x74"  "\x65"  "\x64"  "\x0a"  "\x6b"  "\x65"  "\x72"  "\x6e"  "\x65"  "\x6c"  "\x20"  "\x76"  "\x6f"  "\x69"  "\x64"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x74"  "\x72"  "\x65"  "\x65"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x28"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x6e"  "\x6f"  "\x64"  "\x65"  "\x20"  "\x2a"  "\x6e"  "\x6f"  "\x64"  "\x65"  "\x73"  "\x2c"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x2a"  "\x63"  "\x61"  "\x63"  "\x68"  "\x65"  "\x2c"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x20"  "\x67"  "\x69"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x74"  "\x68"  "\x65"  "\x74"  "\x61"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x20"  "\x69"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x67"  "\x6c"  "\x6f"  "\x62"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x64"  "\x28"  "\x30"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x69"  "\x64"  "\x20"  "\x3e"  "\x3d"  "\x20"  "\x28"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x2a"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3d"  "\x20"  "\x69"  "\x64"  "\x20"  "\x25"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3d"  "\x20"  "\x69"  "\x64"  "\x20"  "\x2f"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x6f"  "\x66"  "\x66"  "\x73"  "\x65"  "\x74"  "\x73"  "\x5b"  "\x44"  "\x49"  "\x50"  "\x4f"  "\x4c"  "\x41"  "\x52"  "\x5f"  "\x54"  "\x52"  "\x45"  "\x45"  "\x5f"  "\x4d"  "\x41"  "\x58"  "\x5f"  "\x4c"  "\x45"  "\x56"  "\x45"  "\x4c"  "\x53"  "\x5d"  "\x2c"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x5b"  "\x44"  "\x49"  "\x50"  "\x4f"  "\x4c"  "\x41"  "\x52"  "\x5f"  "\x54"  "\x52"  "\x45"  "\x45"  "\x5f"  "\x4d"  "\x41"  "\x58"  "\x5f"  "\x4c"  "\x45"  "\x56"  "\x45"  "\x4c"  "\x53"  "\x5d"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x5b"  "\x44"  "\x49"  "\x50"  "\x4f"  "\x4c"  "\x41"  "\x52"  "\x5f"  "\x54"  "\x52"  "\x45"  "\x45"  "\x5f"  "\x4d"  "\x41"  "\x58"  "\x5f"  "\x4c"  "\x45"  "\x56"  "\x45"  "\x4c"  "\x53"  "\x5d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x74"  "\x6f"  "\x70"  "\x20"  "\x3d"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x74"  "\x72"  "\x65"  "\x65"  "\x5f"  "\x6c"  "\x65"  "\x76"  "\x65"  "\x6c"  "\x73"  "\x28"  "\x67"  "\x69"  "\x2c"  "\x20"  "\x6f"  "\x66"  "\x66"  "\x73"  "\x65"  "\x74"  "\x73"  "\x2c"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x2f"  "\x2f"  "\x64"  "\x65"  "\x70"  "\x74"  "\x68"  "\x20"  "\x66"  "\x69"  "\x72"  "\x73"  "\x74"  "\x2c"  "\x20"  "\x65"  "\x61"  "\x63"  "\x68"  "\x20"  "\x76"  "\x69"  "\x73"  "\x69"  "\x74"  "\x20"  "\x70"  "\x6f"  "\x70"  "\x73"  "\x20"  "\x6f"  "\x6e"  "\x65"  "\x20"  "\x63"  "\x65"  "\x6c"  "\x6c"  "\x20"  "\x61"  "\x6e"  "\x64"  "\x20"  "\x70"  "\x75"  "\x73"  "\x68"  "\x65"  "\x73"  "\x20"  "\x61"  "\x74"  "\x20"  "\x6d"  "\x6f"  "\x73"  "\x74"  "\x20"  "\x66"  "\x6f"  "\x75"  "\x72"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x73"  "\x74"  "\x61"  "\x63"  "\x6b"  "\x5b"  "\x34"  "\x20"  "\x2a"  "\x20"  "\x44"  "\x49"  "\x50"  "\x4f"  "\x4c"  "\x41"  "\x52"  "\x5f"  "\x54"  "\x52"  "\x45"  "\x45"  "\x5f"  "\x4d"  "\x41"  "\x58"  "\x5f"  "\x4c"  "\x45"  "\x56"  "\x45"  "\x4c"  "\x53"  "\x5d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x73"  "\x70"  "\x20"  "\x3d"  "\x20"  "\x30"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x73"  "\x74"  "\x61"  "\x63"  "\x6b"  "\x5b"  "\x73"  "\x70"  "\x2b"  "\x2b"  "\x5d"  "\x20"  "\x3d"  "\x20"  "\x6f"  "\x66"  "\x66"  "\x73"  "\x65"  "\x74"  "\x73"  "\x5b"  "\x74"  "\x6f"  "\x70"  "\x5d"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x72"  "\x65"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x28"  "\x30"  "\x2e"  "\x30"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x77"  "\x68"  "\x69"  "\x6c"  "\x65"  "\x20"  "\x28"  "\x73"  "\x70"  "\x20"  "\x3e"  "\x20"  "\x30"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x69"  "\x6e"  "\x64"  "\x65"  "\x78"  "\x20"  "\x3d"  "\x20"  "\x73"  "\x74"  "\x61"  "\x63"  "\x6b"  "\x5b"  "\x2d"  "\x2d"  "\x73"  "\x70"  "\x5d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x6c"  "\x65"  "\x76"  "\x65"  "\x6c"  "\x20"  "\x3d"  "\x20"  "\x74"  "\x6f"  "\x70"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x77"  "\x68"  "\x69"  "\x6c"  "\x65"  "\x20"  "\x28"  "\x6c"  "\x65"  "\x76"  "\x65"  "\x6c"  "\x20"  "\x3e"  "\x20"  "\x30"  "\x20"  "\x26"  "\x26"  "\x20"  "\x69"  "\x6e"  "\x64"  "\x65"  "\x78"  "\x20"  "\x3c"  "\x20"  "\x6f"  "\x66"  "\x66"  "\x73"  "\x65"  "\x74"  "\x73"  "\x5b"  "\x6c"  "\x65"  "\x76"  "\x65"  "\x6c"  "\x5d"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6c"  "\x65"  "\x76"  "\x65"  "\x6c"  "\x2d"  "\x2d"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x6e"  "\x6f"  "\x64"  "\x65"  "\x20"  "\x63"  "\x65"  "\x6c"  "\x6c"  "\x20"  "\x3d"  "\x20"  "\x6e"  "\x6f"  "\x64"  "\x65"  "\x73"  "\x5b"  "\x69"  "\x6e"  "\x64"  "\x65"  "\x78"  "\x5d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x63"  "\x65"  "\x6c"  "\x6c"  "\x2e"  "\x77"  "\x65"  "\x69"  "\x67"  "\x68"  "\x74"  "\x20"  "\x3c"  "\x3d"  "\x20"  "\x30"  "\x2e"  "\x30"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x74"  "\x69"  "\x6e"  "\x75"  "\x65"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x63"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x69"  "\x6e"  "\x64"  "\x65"  "\x78"  "\x20"  "\x2d"  "\x20"  "\x6f"  "\x66"  "\x66"  "\x73"  "\x65"  "\x74"  "\x73"  "\x5b"  "\x6c"  "\x65"  "\x76"  "\x65"  "\x6c"  "\x5d"  "\x29"  "\x20"  "\x2f"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x5b"  "\x6c"  "\x65"  "\x76"  "\x65"  "\x6c"  "\x5d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x63"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x69"  "\x6e"  "\x64"  "\x65"  "\x78"  "\x20"  "\x2d"  "\x20"  "\x6f"  "\x66"  "\x66"  "\x73"  "\x65"  "\x74"  "\x73"  "\x5b"  "\x6c"  "\x65"  "\x76"  "\x65"  "\x6c"  "\x5d"  "\x29"  "\x20"  "\x25"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x5b"  "\x6c"  "\x65"  "\x76"  "\x65"  "\x6c"  "\x5d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x64"  "\x78"  "\x20"  "\x3d"  "\x20"  "\x63"  "\x65"  "\x6c"  "\x6c"  "\x2e"  "\x78"  "\x20"  "\x2d"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x64"  "\x79"  "\x20"  "\x3d"  "\x20"  "\x63"  "\x65"  "\x6c"  "\x6c"  "\x2e"  "\x79"  "\x20"  "\x2d"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x6c"  "\x65"  "\x76"  "\x65"  "\x6c"  "\x20"  "\x3d"  "\x3d"  "\x20"  "\x30"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x63"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x21"  "\x3d"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x7c"  "\x7c"  "\x20"  "\x63"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x21"  "\x3d"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x72"  "\x65"  "\x74"  "\x2c"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x74"  "\x65"  "\x6e"  "\x73"  "\x6f"  "\x72"  "\x5f"  "\x61"  "\x70"  "\x70"  "\x6c"  "\x79"  "\x28"  "\x64"  "\x78"  "\x2c"  "\x20"  "\x64"  "\x79"  "\x2c"  "\x20"  "\x63"  "\x65"  "\x6c"  "\x6c"  "\x2e"  "\x6d"  "\x6f"  "\x6d"  "\x65"  "\x6e"  "\x74"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x74"  "\x69"  "\x6e"  "\x75"  "\x65"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7d"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x73"  "\x69"  "\x64"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x31"  "\x20"  "\x3c"  "\x3c"  "\x20"  "\x6c"  "\x65"  "\x76"  "\x65"  "\x6c"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x74"  "\x61"  "\x69"  "\x6e"  "\x73"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3e"  "\x3e"  "\x20"  "\x6c"  "\x65"  "\x76"  "\x65"  "\x6c"  "\x29"  "\x20"  "\x3d"  "\x3d"  "\x20"  "\x63"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x26"  "\x26"  "\x20"  "\x28"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3e"  "\x3e"  "\x20"  "\x6c"  "\x65"  "\x76"  "\x65"  "\x6c"  "\x29"  "\x20"  "\x3d"  "\x3d"  "\x20"  "\x63"  "\x63"  "\x6f"  "\x6c"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x21"  "\x63"  "\x6f"  "\x6e"  "\x74"  "\x61"  "\x69"  "\x6e"  "\x73"  "\x20"  "\x26"  "\x26"  "\x20"  "\x73"  "\x69"  "\x64"  "\x65"  "\x20"  "\x2a"  "\x20"  "\x73"  "\x69"  "\x64"  "\x65"  "\x20"  "\x3c"  "\x20"  "\x74"  "\x68"  "\x65"  "\x74"  "\x61"  "\x20"  "\x2a"  "\x20"  "\x74"  "\x68"  "\x65"  "\x74"  "\x61"  "\x20"  "\x2a"  "\x20"  "\x28"  "\x64"  "\x78"  "\x20"  "\x2a"  "\x20"  "\x64"  "\x78"  "\x20"  "\x2b"  "\x20"  "\x64"  "\x79"  "\x20"  "\x2a"  "\x20"  "\x64"  "\x79"  "\x29"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x72"  "\x65"  "\x74"  "\x2c"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x74"  "\x65"  "\x6e"  "\x73"  "\x6f"  "\x72"  "\x5f"  "\x61"  "\x70"  "\x70"  "\x6c"  "\x79"  "\x28"  "\x64"  "\x78"  "\x2c"  "\x20"  "\x64"  "\x79"  "\x2c"  "\x20"  "\x63"  "\x65"  "\x6c"  "\x6c"  "\x2e"  "\x6d"  "\x6f"  "\x6d"  "\x65"  "\x6e"  "\x74"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x74"  "\x69"  "\x6e"  "\x75"  "\x65"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7d"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x66"  "\x6f"  "\x72"  "\x20"  "\x28"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x64"  "\x72"  "\x20"  "\x3d"  "\x20"  "\x30"  "\x3b"  "\x20"  "\x64"  "\x72"  "\x20"  "\x3c"  "\x20"  "\x32"  "\x3b"  "\x20"  "\x2b"  "\x2b"  "\x64"  "\x72"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x66"  "\x6f"  "\x72"  "\x20"  "\x28"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x64"  "\x63"  "\x20"  "\x3d"  "\x20"  "\x30"  "\x3b"  "\x20"  "\x64"  "\x63"  "\x20"  "\x3c"  "\x20"  "\x32"  "\x3b"  "\x20"  "\x2b"  "\x2b"  "\x64"  "\x63"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x72"  "\x20"  "\x3d"  "\x20"  "\x32"  "\x20"  "\x2a"  "\x20"  "\x63"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2b"  "\x20"  "\x64"  "\x72"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x63"  "\x20"  "\x3d"  "\x20"  "\x32"  "\x20"  "\x2a"  "\x20"  "\x63"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x2b"  "\x20"  "\x64"  "\x63"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x72"  "\x20"  "\x3c"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x5b"  "\x6c"  "\x65"  "\x76"  "\x65"  "\x6c"  "\x20"  "\x2d"  "\x20"  "\x31"  "\x5d"  "\x20"  "\x26"  "\x26"  "\x20"  "\x63"  "\x20"  "\x3c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x5b"  "\x6c"  "\x65"  "\x76"  "\x65"  "\x6c"  "\x20"  "\x2d"  "\x20"  "\x31"  "\x5d"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x73"  "\x74"  "\x61"  "\x63"  "\x6b"  "\x5b"  "\x73"  "\x70"  "\x2b"  "\x2b"  "\x5d"  "\x20"  "\x3d"  "\x20"  "\x6f"  "\x66"  "\x66"  "\x73"  "\x65"  "\x74"  "\x73"  "\x5b"  "\x6c"  "\x65"  "\x76"  "\x65"  "\x6c"  "\x20"  "\x2d"  "\x20"  "\x31"  "\x5d"  "\x20"  "\x2b"  "\x20"  "\x72"  "\x20"  "\x2a"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x5b"  "\x6c"  "\x65"  "\x76"  "\x65"  "\x6c"  "\x20"  "\x2d"  "\x20"  "\x31"  "\x5d"  "\x20"  "\x2b"  "\x20"  "\x63"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7d"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7d"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7d"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x61"  "\x63"  "\x68"  "\x65"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x20"  "\x3d"  "\x20"  "\x72"  "\x65"  "\x74"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x2f"  "\x2f"  "\x6c"  "\x61"  "\x72"  "\x67"  "\x65"  "\x73"  "\x74"  "\x20"  "\x7c"  "\x76"  "\x20"  "\x2d"  "\x20"  "\x72"  "\x65"  "\x66"  "\x65"  "\x72"  "\x65"  "\x6e"  "\x63"  "\x65"  "\x7c"  "\x20"  "\x6f"  "\x66"  "\x20"  "\x65"  "\x61"  "\x63"  "\x68"  "\x20"  "\x77"  "\x6f"  "\x72"  "\x6b"  "\x20"  "\x67"  "\x72"  "\x6f"  "\x75"  "\x70"  "\x2c"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x68"  "\x6f"  "\x73"  "\x74"  "\x20"  "\x74"  "\x61"  "\x6b"  "\x65"  "\x73"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x6d"  "\x61"  "\x78"  "\x20"  "\x6f"  "\x76"  "\x65"  "\x72"  "\x20"  "\x67"  "\x72"  "\x6f"  "\x75"  "\x70"  "\x73"  "\x20"  "\x28"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x20"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x20"  "\x6d"  "\x75"  "\x73"  "\x74"  "\x20"  "\x62"  "\x65"  "\x20"  "\x61"  "\x20"  "\x70"  "\x6f"  "\x77"  "\x65"  "\x72"  "\x20"  "\x6f"  "\x66"  "\x20"  "\x74"  "\x77"  "\x6f"  "\x29"  "\x0a"  "\x6b"  "\x65"  "\x72"  "\x6e"  "\x65"  "\x6c"  "\x20"  "\x76"  "\x6f"  "\x69"  "\x64"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x64"  "\x72"  "\x69"  "\x66"  "\x74"  "\x28"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x2a"  "\x76"  "\x2c"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x2a"  "\x72"  "\x65"  "\x66"  "\x65"  "\x72"  "\x65"  "\x6e"  "\x63"  "\x65"  "\x2c"  "\x20"  "\x4c"  "\x4f"  "\x43"  "\x41"  "\x4c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x2a"  "\x73"  "\x63"  "\x72"  "\x61"  "\x74"  "\x63"  "\x68"  "\x2c"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x2a"  "\x6f"  "\x75"  "\x74"  "\x2c"  "\x20"  "\x75"  "\x6e"  "\x73"  "\x69"  "\x67"  "\x6e"  "\x65"  "\x64"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x75"  "\x6e"  "\x73"  "\x69"  "\x67"  "\x6e"  "\x65"  "\x64"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x20"  "\x69"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x67"  "\x6c"  "\x6f"  "\x62"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x64"  "\x28"  "\x30"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x20"  "\x6c"  "\x69"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x64"  "\x28"  "\x30"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x64"  "\x72"  "\x69"  "\x66"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x30"  "\x2e"  "\x30"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x69"  "\x64"  "\x20"  "\x3c"  "\x20"  "\x28"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x2a"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x62"  "\x28"  "\x76"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x2c"  "\x20"  "\x72"  "\x65"  "\x66"  "\x65"  "\x72"  "\x65"  "\x6e"  "\x63"  "\x65"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x72"  "\x69"  "\x66"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x64"  "\x6f"  "\x74"  "\x28"  "\x64"  "\x2c"  "\x20"  "\x64"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7d"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x73"  "\x63"  "\x72"  "\x61"  "\x74"  "\x63"  "\x68"  "\x5b"  "\x6c"  "\x69"  "\x64"  "\x5d"  "\x20"  "\x3d"  "\x20"  "\x64"  "\x72"  "\x69"  "\x66"  "\x74"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x66"  "\x6f"  "\x72"  "\x20"  "\x28"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x20"  "\x73"  "\x74"  "\x72"  "\x69"  "\x64"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x28"  "\x30"  "\x29"  "\x20"  "\x2f"  "\x20"  "\x32"  "\x3b"  "\x20"  "\x73"  "\x74"  "\x72"  "\x69"  "\x64"  "\x65"  "\x20"  "\x3e"  "\x20"  "\x30"  "\x3b"  "\x20"  "\x73"  "\x74"  "\x72"  "\x69"  "\x64"  "\x65"  "\x20"  "\x2f"  "\x3d"  "\x20"  "\x32"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x62"  "\x61"  "\x72"  "\x72"  "\x69"  "\x65"  "\x72"  "\x28"  "\x43"  "\x4c"  "\x4b"  "\x5f"  "\x4c"  "\x4f"  "\x43"  "\x41"  "\x4c"  "\x5f"  "\x4d"  "\x45"  "\x4d"  "\x5f"  "\x46"  "\x45"  "\x4e"  "\x43"  "\x45"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x6c"  "\x69"  "\x64"  "\x20"  "\x3c"  "\x20"  "\x73"  "\x74"  "\x72"  "\x69"  "\x64"  "\x65"  "\x20"  "\x26"  "\x26"  "\x20"  "\x73"  "\x63"  "\x72"  "\x61"  "\x74"  "\x63"  "\x68"  "\x5b"  "\x6c"  "\x69"  "\x64"  "\x20"  "\x2b"  "\x20"  "\x73"  "\x74"  "\x72"  "\x69"  "\x64"  "\x65"  "\x5d"  "\x20"  "\x3e"  "\x20"  "\x73"  "\x63"  "\x72"  "\x61"  "\x74"  "\x63"  "\x68"  "\x5b"  "\x6c"  "\x69"  "\x64"  "\x5d"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x73"  "\x63"  "\x72"  "\x61"  "\x74"  "\x63"  "\x68"  "\x5b"  "\x6c"  "\x69"  "\x64"  "\x5d"  "\x20"  "\x3d"  "\x20"  "\x73"  "\x63"  "\x72"  "\x61"  "\x74"  "\x63"  "\x68"  "\x5b"  "\x6c"  "\x69"  "\x64"  "\x20"  "\x2b"  "\x20"  "\x73"  "\x74"  "\x72"  "\x69"  "\x64"  "\x65"  "\x5d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7d"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x6c"  "\x69"  "\x64"  "\x20"  "\x3d"  "\x3d"  "\x20"  "\x30"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6f"  "\x75"  "\x74"  "\x5b"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x67"  "\x72"  "\x6f"  "\x75"  "\x70"  "\x5f"  "\x69"  "\x64"  "\x28"  "\x30"  "\x29"  "\x5d"  "\x20"  "\x3d"  "\x20"  "\x73"  "\x71"  "\x72"  "\x74"  "\x28"  "\x73"  "\x63"  "\x72"  "\x61"  "\x74"  "\x63"  "\x68"  "\x5b"  "\x30"  "\x5d"  "\x29"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x6b"  "\x65"  "\x72"  "\x6e"  "\x65"  "\x6c"  "\x20"  "\x76"  "\x6f"  "\x69"  "\x64"  "\x20"  "\x72"  "\x65"  "\x6e"  "\x64"  "\x65"  "\x72"  "\x5f"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x62"  "\x77"  "\x72"  "\x28"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x2a"  "\x76"  "\x2c"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x20"  "\x67"  "\x69"  "\x2c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x52"  "\x47"  "\x42"  "\x41"  "\x33"  "\x32"  "\x2a"  "\x20"  "\x72"  "\x67"  "\x62"  "\x61"  "\x2c"  "\x20"  "\x75"  "\x6e"  "\x73"  "\x69"  "\x67"  "\x6e"  "\x65"  "\x64"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x77"  "\x69"  "\x64"  "\x74"  "\x68"  "\x2c"  "\x20"  "\x75"  "\x6e"  "\x73"  "\x69"  "\x67"  "\x6e"  "\x65"  "\x64"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x68"  "\x65"  "\x69"  "\x67"  "\x68"  "\x74"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x73"  "\x74"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x69"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x67"  "\x6c"  "\x6f"  "\x62"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x64"  "\x28"  "\x30"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x73"  "\x74"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x69"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x67"  "\x6c"  "\x6f"  "\x62"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x64"  "\x28"  "\x31"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x69"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3e"  "\x3d"  "\x20"  "\x77"  "\x69"  "\x64"  "\x74"  "\x68"  "\x20"  "\x7c"  "\x7c"  "\x20"  "\x69"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3e"  "\x3d"  "\x20"  "\x68"  "\x65"  "\x69"  "\x67"  "\x68"  "\x74"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x73"  "\x74"  "\x20"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x20"  "\x69"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x29"  "\x69"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2a"  "\x20"  "\x77"  "\x69"  "\x64"  "\x74"  "\x68"  "\x20"  "\x2b"  "\x20"  "\x69"  "\x63"  "\x6f"  "\x6c"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x76"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x29"  "\x69"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x2a"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x20"  "\x2f"  "\x20"  "\x77"  "\x69"  "\x64"  "\x74"  "\x68"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x76"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x29"  "\x69"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2a"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x2f"  "\x20"  "\x68"  "\x65"  "\x69"  "\x67"  "\x68"  "\x74"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x2f"  "\x2f"  "\x72"  "\x65"  "\x6e"  "\x64"  "\x65"  "\x72"  "\x69"  "\x6e"  "\x67"  "\x20"  "\x69"  "\x6e"  "\x76"  "\x65"  "\x72"  "\x74"  "\x73"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x2c"  "\x20"  "\x6e"  "\x65"  "\x65"  "\x64"  "\x20"  "\x74"  "\x6f"  "\x20"  "\x69"  "\x6e"  "\x76"  "\x65"  "\x72"  "\x74"  "\x20"  "\x62"  "\x61"  "\x63"  "\x6b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x2d"  "\x20"  "\x31"  "\x20"  "\x2d"  "\x20"  "\x76"  "\x72"  "\x6f"  "\x77"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x76"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3e"  "\x3d"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x7c"  "\x7c"  "\x20"  "\x76"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3e"  "\x3d"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6d"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x5b"  "\x76"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2a"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x20"  "\x2b"  "\x20"  "\x76"  "\x63"  "\x6f"  "\x6c"  "\x5d"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x67"  "\x62"  "\x61"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x20"  "\x3d"  "\x20"  "\x6d"  "\x5f"  "\x62"  "\x77"  "\x72"  "\x5f"  "\x6d"  "\x61"  "\x70"  "\x70"  "\x69"  "\x6e"  "\x67"  "\x28"  "\x6d"  "\x29"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x6b"  "\x65"  "\x72"  "\x6e"  "\x65"  "\x6c"  "\x20"  "\x76"  "\x6f"  "\x69"  "\x64"  "\x20"  "\x72"  "\x65"  "\x6e"  "\x64"  "\x65"  "\x72"  "\x5f"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x68"  "\x73"  "\x6c"  "\x28"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x2a"  "\x76"  "\x2c"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x20"  "\x67"  "\x69"  "\x2c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x52"  "\x47"  "\x42"  "\x41"  "\x33"  "\x32"  "\x20"  "\x2a"  "\x72"  "\x67"  "\x62"  "\x61"  "\x2c"  "\x20"  "\x75"  "\x6e"  "\x73"  "\x69"  "\x67"  "\x6e"  "\x65"  "\x64"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x77"  "\x69"  "\x64"  "\x74"  "\x68"  "\x2c"  "\x20"  "\x75"  "\x6e"  "\x73"  "\x69"  "\x67"  "\x6e"  "\x65"  "\x64"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x68"  "\x65"  "\x69"  "\x67"  "\x68"  "\x74"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x73"  "\x74"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x69"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x67"  "\x6c"  "\x6f"  "\x62"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x64"  "\x28"  "\x30"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x73"  "\x74"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x69"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x67"  "\x6c"  "\x6f"  "\x62"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x64"  "\x28"  "\x31"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x69"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3e"  "\x3d"  "\x20"  "\x77"  "\x69"  "\x64"  "\x74"  "\x68"  "\x20"  "\x7c"  "\x7c"  "\x20"  "\x69"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3e"  "\x3d"  "\x20"  "\x68"  "\x65"  "\x69"  "\x67"  "\x68"  "\x74"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x73"  "\x74"  "\x20"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x20"  "\x69"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x29"  "\x69"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2a"  "\x20"  "\x77"  "\x69"  "\x64"  "\x74"  "\x68"  "\x20"  "\x2b"  "\x20"  "\x69"  "\x63"  "\x6f"  "\x6c"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x76"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x29"  "\x69"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x2a"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x20"  "\x2f"  "\x20"  "\x77"  "\x69"  "\x64"  "\x74"  "\x68"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x76"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x29"  "\x69"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2a"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x2f"  "\x20"  "\x68"  "\x65"  "\x69"  "\x67"  "\x68"  "\x74"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x2f"  "\x2f"  "\x72"  "\x65"  "\x6e"  "\x64"  "\x65"  "\x72"  "\x69"  "\x6e"  "\x67"  "\x20"  "\x69"  "\x6e"  "\x76"  "\x65"  "\x72"  "\x74"  "\x73"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x2c"  "\x20"  "\x6e"  "\x65"  "\x65"  "\x64"  "\x20"  "\x74"  "\x6f"  "\x20"  "\x69"  "\x6e"  "\x76"  "\x65"  "\x72"  "\x74"  "\x20"  "\x62"  "\x61"  "\x63"  "\x6b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x2d"  "\x20"  "\x31"  "\x20"  "\x2d"  "\x20"  "\x76"  "\x72"  "\x6f"  "\x77"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x76"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3e"  "\x3d"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x7c"  "\x7c"  "\x20"  "\x76"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3e"  "\x3d"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6d"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x5b"  "\x76"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2a"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x20"  "\x2b"  "\x20"  "\x76"  "\x63"  "\x6f"  "\x6c"  "\x5d"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x67"  "\x62"  "\x61"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x20"  "\x3d"  "\x20"  "\x6d"  "\x5f"  "\x74"  "\x6f"  "\x5f"  "\x68"  "\x73"  "\x6c"  "\x28"  "\x6d"  "\x29"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x2f"  "\x2f"  "\x61"  "\x76"  "\x65"  "\x72"  "\x61"  "\x67"  "\x65"  "\x73"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x73"  "\x69"  "\x74"  "\x65"  "\x73"  "\x20"  "\x6f"  "\x66"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x78"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x20"  "\x69"  "\x6d"  "\x61"  "\x67"  "\x65"  "\x20"  "\x28"  "\x6f"  "\x6e"  "\x65"  "\x20"  "\x70"  "\x69"  "\x78"  "\x65"  "\x6c"  "\x20"  "\x70"  "\x65"  "\x72"  "\x20"  "\x73"  "\x69"  "\x74"  "\x65"  "\x29"  "\x20"  "\x74"  "\x68"  "\x61"  "\x74"  "\x20"  "\x66"  "\x61"  "\x6c"  "\x6c"  "\x20"  "\x69"  "\x6e"  "\x20"  "\x65"  "\x61"  "\x63"  "\x68"  "\x20"  "\x6f"  "\x66"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x77"  "\x69"  "\x64"  "\x74"  "\x68"  "\x20"  "\x78"  "\x20"  "\x68"  "\x65"  "\x69"  "\x67"  "\x68"  "\x74"  "\x20"  "\x70"  "\x69"  "\x78"  "\x65"  "\x6c"  "\x73"  "\x2c"  "\x0a"  "\x2f"  "\x2f"  "\x66"  "\x6f"  "\x72"  "\x20"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x73"  "\x20"  "\x62"  "\x69"  "\x67"  "\x67"  "\x65"  "\x72"  "\x20"  "\x74"  "\x68"  "\x61"  "\x6e"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x77"  "\x69"  "\x6e"  "\x64"  "\x6f"  "\x77"  "\x0a"  "\x6b"  "\x65"  "\x72"  "\x6e"  "\x65"  "\x6c"  "\x20"  "\x76"  "\x6f"  "\x69"  "\x64"  "\x20"  "\x72"  "\x65"  "\x6e"  "\x64"  "\x65"  "\x72"  "\x5f"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x73"  "\x61"  "\x6d"  "\x70"  "\x6c"  "\x65"  "\x28"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x52"  "\x47"  "\x42"  "\x41"  "\x33"  "\x32"  "\x20"  "\x2a"  "\x73"  "\x69"  "\x74"  "\x65"  "\x73"  "\x2c"  "\x20"  "\x75"  "\x6e"  "\x73"  "\x69"  "\x67"  "\x6e"  "\x65"  "\x64"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x75"  "\x6e"  "\x73"  "\x69"  "\x67"  "\x6e"  "\x65"  "\x64"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x2c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x52"  "\x47"  "\x42"  "\x41"  "\x33"  "\x32"  "\x20"  "\x2a"  "\x72"  "\x67"  "\x62"  "\x61"  "\x2c"  "\x20"  "\x75"  "\x6e"  "\x73"  "\x69"  "\x67"  "\x6e"  "\x65"  "\x64"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x77"  "\x69"  "\x64"  "\x74"  "\x68"  "\x2c"  "\x20"  "\x75"  "\x6e"  "\x73"  "\x69"  "\x67"  "\x6e"  "\x65"  "\x64"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x68"  "\x65"  "\x69"  "\x67"  "\x68"  "\x74"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x73"  "\x74"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x69"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x67"  "\x6c"  "\x6f"  "\x62"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x64"  "\x28"  "\x30"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x73"  "\x74"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x69"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x67"  "\x6c"  "\x6f"  "\x62"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x64"  "\x28"  "\x31"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x69"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3e"  "\x3d"  "\x20"  "\x77"  "\x69"  "\x64"  "\x74"  "\x68"  "\x20"  "\x7c"  "\x7c"  "\x20"  "\x69"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3e"  "\x3d"  "\x20"  "\x68"  "\x65"  "\x69"  "\x67"  "\x68"  "\x74"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x73"  "\x74"  "\x20"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x30"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x29"  "\x69"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x2a"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x20"  "\x2f"  "\x20"  "\x77"  "\x69"  "\x64"  "\x74"  "\x68"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x73"  "\x74"  "\x20"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x31"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x28"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x29"  "\x69"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x2b"  "\x20"  "\x31"  "\x29"  "\x20"  "\x2a"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x20"  "\x2f"  "\x20"  "\x77"  "\x69"  "\x64"  "\x74"  "\x68"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x73"  "\x74"  "\x20"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x30"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x29"  "\x69"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2a"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x2f"  "\x20"  "\x68"  "\x65"  "\x69"  "\x67"  "\x68"  "\x74"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x73"  "\x74"  "\x20"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x31"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x28"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x29"  "\x69"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2b"  "\x20"  "\x31"  "\x29"  "\x20"  "\x2a"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x2f"  "\x20"  "\x68"  "\x65"  "\x69"  "\x67"  "\x68"  "\x74"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x75"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x72"  "\x20"  "\x3d"  "\x20"  "\x30"  "\x2c"  "\x20"  "\x67"  "\x20"  "\x3d"  "\x20"  "\x30"  "\x2c"  "\x20"  "\x62"  "\x20"  "\x3d"  "\x20"  "\x30"  "\x2c"  "\x20"  "\x61"  "\x20"  "\x3d"  "\x20"  "\x30"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x66"  "\x6f"  "\x72"  "\x20"  "\x28"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3d"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x30"  "\x3b"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3c"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x31"  "\x3b"  "\x20"  "\x2b"  "\x2b"  "\x72"  "\x6f"  "\x77"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x66"  "\x6f"  "\x72"  "\x20"  "\x28"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3d"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x30"  "\x3b"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x31"  "\x3b"  "\x20"  "\x2b"  "\x2b"  "\x63"  "\x6f"  "\x6c"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x52"  "\x47"  "\x42"  "\x41"  "\x33"  "\x32"  "\x20"  "\x63"  "\x20"  "\x3d"  "\x20"  "\x73"  "\x69"  "\x74"  "\x65"  "\x73"  "\x5b"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2a"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x20"  "\x2b"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x5d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x20"  "\x2b"  "\x3d"  "\x20"  "\x63"  "\x2e"  "\x72"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x67"  "\x20"  "\x2b"  "\x3d"  "\x20"  "\x63"  "\x2e"  "\x67"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x62"  "\x20"  "\x2b"  "\x3d"  "\x20"  "\x63"  "\x2e"  "\x62"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x61"  "\x20"  "\x2b"  "\x3d"  "\x20"  "\x63"  "\x2e"  "\x61"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7d"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7d"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x73"  "\x74"  "\x20"  "\x75"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x6e"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x72"  "\x6f"  "\x77"  "\x31"  "\x20"  "\x2d"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x30"  "\x29"  "\x20"  "\x2a"  "\x20"  "\x28"  "\x63"  "\x6f"  "\x6c"  "\x31"  "\x20"  "\x2d"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x30"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x67"  "\x62"  "\x61"  "\x5b"  "\x28"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x29"  "\x69"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2a"  "\x20"  "\x77"  "\x69"  "\x64"  "\x74"  "\x68"  "\x20"  "\x2b"  "\x20"  "\x69"  "\x63"  "\x6f"  "\x6c"  "\x5d"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x52"  "\x47"  "\x42"  "\x41"  "\x33"  "\x32"  "\x29"  "\x7b"  "\x2e"  "\x72"  "\x20"  "\x3d"  "\x20"  "\x72"  "\x20"  "\x2f"  "\x20"  "\x6e"  "\x2c"  "\x20"  "\x2e"  "\x67"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x20"  "\x2f"  "\x20"  "\x6e"  "\x2c"  "\x20"  "\x2e"  "\x62"  "\x20"  "\x3d"  "\x20"  "\x62"  "\x20"  "\x2f"  "\x20"  "\x6e"  "\x2c"  "\x20"  "\x2e"  "\x61"  "\x20"  "\x3d"  "\x20"  "\x61"  "\x20"  "\x2f"  "\x20"  "\x6e"  "\x7d"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x6b"  "\x65"  "\x72"  "\x6e"  "\x65"  "\x6c"  "\x20"  "\x76"  "\x6f"  "\x69"  "\x64"  "\x20"  "\x63"  "\x61"  "\x6c"  "\x63"  "\x75"  "\x6c"  "\x61"  "\x74"  "\x65"  "\x5f"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x5f"  "\x74"  "\x6f"  "\x5f"  "\x72"  "\x65"  "\x6e"  "\x64"  "\x65"  "\x72"  "\x28"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x2a"  "\x76"  "\x2c"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x20"  "\x67"  "\x69"  "\x2c"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x2a"  "\x6f"  "\x75"  "\x74"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x73"  "\x74"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x67"  "\x6c"  "\x6f"  "\x62"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x64"  "\x28"  "\x30"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x73"  "\x74"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x67"  "\x6c"  "\x6f"  "\x62"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x64"  "\x28"  "\x31"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x73"  "\x74"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x61"  "\x63"  "\x74"  "\x69"  "\x76"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x26"  "\x26"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x73"  "\x74"  "\x20"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x20"  "\x69"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x29"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2a"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x20"  "\x2b"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x21"  "\x61"  "\x63"  "\x74"  "\x69"  "\x76"  "\x65"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6d"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x61"  "\x70"  "\x70"  "\x6c"  "\x79"  "\x5f"  "\x70"  "\x62"  "\x63"  "\x28"  "\x76"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x70"  "\x62"  "\x63"  "\x2c"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x2d"  "\x20"  "\x31"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x61"  "\x70"  "\x70"  "\x6c"  "\x79"  "\x5f"  "\x70"  "\x62"  "\x63"  "\x28"  "\x76"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x70"  "\x62"  "\x63"  "\x2c"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x2b"  "\x20"  "\x31"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x75"  "\x70"  "\x20"  "\x3d"  "\x20"  "\x61"  "\x70"  "\x70"  "\x6c"  "\x79"  "\x5f"  "\x70"  "\x62"  "\x63"  "\x28"  "\x76"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x70"  "\x62"  "\x63"  "\x2c"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2b"  "\x20"  "\x31"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x20"  "\x3d"  "\x20"  "\x61"  "\x70"  "\x70"  "\x6c"  "\x79"  "\x5f"  "\x70"  "\x62"  "\x63"  "\x28"  "\x76"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x70"  "\x62"  "\x63"  "\x2c"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2d"  "\x20"  "\x31"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6f"  "\x75"  "\x74"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x20"  "\x3d"  "\x20"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x5f"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x28"  "\x6d"  "\x2c"  "\x20"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x2c"  "\x20"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x2c"  "\x20"  "\x75"  "\x70"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x29"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x2f"  "\x2f"  "\x74"  "\x68"  "\x65"  "\x20"  "\x6c"  "\x6f"  "\x77"  "\x65"  "\x73"  "\x74"  "\x20"  "\x61"  "\x6e"  "\x64"  "\x20"  "\x68"  "\x69"  "\x67"  "\x68"  "\x65"  "\x73"  "\x74"  "\x20"  "\x6f"  "\x66"  "\x20"  "\x6d"  "\x69"  "\x6e"  "\x5f"  "\x76"  "\x61"  "\x6c"  "\x75"  "\x65"  "\x20"  "\x61"  "\x6e"  "\x64"  "\x20"  "\x6d"  "\x61"  "\x78"  "\x5f"  "\x76"  "\x61"  "\x6c"  "\x75"  "\x65"  "\x20"  "\x6f"  "\x76"  "\x65"  "\x72"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x77"  "\x6f"  "\x72"  "\x6b"  "\x20"  "\x67"  "\x72"  "\x6f"  "\x75"  "\x70"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x6f"  "\x20"  "\x72"  "\x61"  "\x6e"  "\x67"  "\x65"  "\x5b"  "\x30"  "\x5d"  "\x20"  "\x61"  "\x6e"  "\x64"  "\x20"  "\x72"  "\x61"  "\x6e"  "\x67"  "\x65"  "\x5b"  "\x31"  "\x5d"  "\x0a"  "\x76"  "\x6f"  "\x69"  "\x64"  "\x20"  "\x72"  "\x65"  "\x6e"  "\x64"  "\x65"  "\x72"  "\x5f"  "\x72"  "\x61"  "\x6e"  "\x67"  "\x65"  "\x5f"  "\x67"  "\x72"  "\x6f"  "\x75"  "\x70"  "\x28"  "\x4c"  "\x4f"  "\x43"  "\x41"  "\x4c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x2a"  "\x6c"  "\x6f"  "\x2c"  "\x20"  "\x4c"  "\x4f"  "\x43"  "\x41"  "\x4c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x2a"  "\x68"  "\x69"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x6d"  "\x69"  "\x6e"  "\x5f"  "\x76"  "\x61"  "\x6c"  "\x75"  "\x65"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x6d"  "\x61"  "\x78"  "\x5f"  "\x76"  "\x61"  "\x6c"  "\x75"  "\x65"  "\x2c"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x2a"  "\x72"  "\x61"  "\x6e"  "\x67"  "\x65"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x73"  "\x74"  "\x20"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x20"  "\x6c"  "\x69"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x64"  "\x28"  "\x30"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x73"  "\x74"  "\x20"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x20"  "\x6e"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x28"  "\x30"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x20"  "\x74"  "\x6f"  "\x70"  "\x20"  "\x3d"  "\x20"  "\x31"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x77"  "\x68"  "\x69"  "\x6c"  "\x65"  "\x20"  "\x28"  "\x74"  "\x6f"  "\x70"  "\x20"  "\x3c"  "\x20"  "\x6e"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x74"  "\x6f"  "\x70"  "\x20"  "\x2a"  "\x3d"  "\x20"  "\x32"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6c"  "\x6f"  "\x5b"  "\x6c"  "\x69"  "\x64"  "\x5d"  "\x20"  "\x3d"  "\x20"  "\x6d"  "\x69"  "\x6e"  "\x5f"  "\x76"  "\x61"  "\x6c"  "\x75"  "\x65"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x68"  "\x69"  "\x5b"  "\x6c"  "\x69"  "\x64"  "\x5d"  "\x20"  "\x3d"  "\x20"  "\x6d"  "\x61"  "\x78"  "\x5f"  "\x76"  "\x61"  "\x6c"  "\x75"  "\x65"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x66"  "\x6f"  "\x72"  "\x20"  "\x28"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x20"  "\x73"  "\x74"  "\x72"  "\x69"  "\x64"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x74"  "\x6f"  "\x70"  "\x20"  "\x2f"  "\x20"  "\x32"  "\x3b"  "\x20"  "\x73"  "\x74"  "\x72"  "\x69"  "\x64"  "\x65"  "\x20"  "\x3e"  "\x20"  "\x30"  "\x3b"  "\x20"  "\x73"  "\x74"  "\x72"  "\x69"  "\x64"  "\x65"  "\x20"  "\x2f"  "\x3d"  "\x20"  "\x32"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x62"  "\x61"  "\x72"  "\x72"  "\x69"  "\x65"  "\x72"  "\x28"  "\x43"  "\x4c"  "\x4b"  "\x5f"  "\x4c"  "\x4f"  "\x43"  "\x41"  "\x4c"  "\x5f"  "\x4d"  "\x45"  "\x4d"  "\x5f"  "\x46"  "\x45"  "\x4e"  "\x43"  "\x45"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x6c"  "\x69"  "\x64"  "\x20"  "\x3c"  "\x20"  "\x73"  "\x74"  "\x72"  "\x69"  "\x64"  "\x65"  "\x20"  "\x26"  "\x26"  "\x20"  "\x6c"  "\x69"  "\x64"  "\x20"  "\x2b"  "\x20"  "\x73"  "\x74"  "\x72"  "\x69"  "\x64"  "\x65"  "\x20"  "\x3c"  "\x20"  "\x6e"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6c"  "\x6f"  "\x5b"  "\x6c"  "\x69"  "\x64"  "\x5d"  "\x20"  "\x3d"  "\x20"  "\x66"  "\x6d"  "\x69"  "\x6e"  "\x28"  "\x6c"  "\x6f"  "\x5b"  "\x6c"  "\x69"  "\x64"  "\x5d"  "\x2c"  "\x20"  "\x6c"  "\x6f"  "\x5b"  "\x6c"  "\x69"  "\x64"  "\x20"  "\x2b"  "\x20"  "\x73"  "\x74"  "\x72"  "\x69"  "\x64"  "\x65"  "\x5d"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x68"  "\x69"  "\x5b"  "\x6c"  "\x69"  "\x64"  "\x5d"  "\x20"  "\x3d"  "\x20"  "\x66"  "\x6d"  "\x61"  "\x78"  "\x28"  "\x68"  "\x69"  "\x5b"  "\x6c"  "\x69"  "\x64"  "\x5d"  "\x2c"  "\x20"  "\x68"  "\x69"  "\x5b"  "\x6c"  "\x69"  "\x64"  "\x20"  "\x2b"  "\x20"  "\x73"  "\x74"  "\x72"  "\x69"  "\x64"  "\x65"  "\x5d"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7d"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7d"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x6c"  "\x69"  "\x64"  "\x20"  "\x3d"  "\x3d"  "\x20"  "\x30"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x61"  "\x6e"  "\x67"  "\x65"  "\x5b"  "\x30"  "\x5d"  "\x20"  "\x3d"  "\x20"  "\x6c"  "\x6f"  "\x5b"  "\x30"  "\x5d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x61"  "\x6e"  "\x67"  "\x65"  "\x5b"  "\x31"  "\x5d"  "\x20"  "\x3d"  "\x20"  "\x68"  "\x69"  "\x5b"  "\x30"  "\x5d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7d"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x2f"  "\x2f"  "\x63"  "\x6f"  "\x6c"  "\x6f"  "\x75"  "\x72"  "\x20"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x65"  "\x20"  "\x6f"  "\x66"  "\x20"  "\x72"  "\x65"  "\x6e"  "\x64"  "\x65"  "\x72"  "\x5f"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x20"  "\x61"  "\x6e"  "\x64"  "\x20"  "\x72"  "\x65"  "\x6e"  "\x64"  "\x65"  "\x72"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x2c"  "\x20"  "\x61"  "\x20"  "\x73"  "\x69"  "\x6e"  "\x67"  "\x6c"  "\x65"  "\x20"  "\x77"  "\x6f"  "\x72"  "\x6b"  "\x20"  "\x67"  "\x72"  "\x6f"  "\x75"  "\x70"  "\x20"  "\x77"  "\x61"  "\x6c"  "\x6b"  "\x73"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x6e"  "\x20"  "\x76"  "\x61"  "\x6c"  "\x75"  "\x65"  "\x73"  "\x20"  "\x73"  "\x6f"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x72"  "\x61"  "\x6e"  "\x67"  "\x65"  "\x20"  "\x6e"  "\x65"  "\x76"  "\x65"  "\x72"  "\x0a"  "\x2f"  "\x2f"  "\x6c"  "\x65"  "\x61"  "\x76"  "\x65"  "\x73"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x64"  "\x65"  "\x76"  "\x69"  "\x63"  "\x65"  "\x0a"  "\x6b"  "\x65"  "\x72"  "\x6e"  "\x65"  "\x6c"  "\x20"  "\x76"  "\x6f"  "\x69"  "\x64"  "\x20"  "\x72"  "\x65"  "\x6e"  "\x64"  "\x65"  "\x72"  "\x5f"  "\x72"  "\x61"  "\x6e"  "\x67"  "\x65"  "\x28"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x2a"  "\x76"  "\x61"  "\x6c"  "\x75"  "\x65"  "\x73"  "\x2c"  "\x20"  "\x75"  "\x6e"  "\x73"  "\x69"  "\x67"  "\x6e"  "\x65"  "\x64"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x6e"  "\x2c"  "\x20"  "\x4c"  "\x4f"  "\x43"  "\x41"  "\x4c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x2a"  "\x6c"  "\x6f"  "\x2c"  "\x20"  "\x4c"  "\x4f"  "\x43"  "\x41"  "\x4c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x2a"  "\x68"  "\x69"  "\x2c"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x2a"  "\x72"  "\x61"  "\x6e"  "\x67"  "\x65"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x6d"  "\x69"  "\x6e"  "\x5f"  "\x76"  "\x61"  "\x6c"  "\x75"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x49"  "\x4e"  "\x46"  "\x49"  "\x4e"  "\x49"  "\x54"  "\x59"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x6d"  "\x61"  "\x78"  "\x5f"  "\x76"  "\x61"  "\x6c"  "\x75"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x2d"  "\x49"  "\x4e"  "\x46"  "\x49"  "\x4e"  "\x49"  "\x54"  "\x59"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x66"  "\x6f"  "\x72"  "\x20"  "\x28"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x20"  "\x69"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x64"  "\x28"  "\x30"  "\x29"  "\x3b"  "\x20"  "\x69"  "\x20"  "\x3c"  "\x20"  "\x6e"  "\x3b"  "\x20"  "\x69"  "\x20"  "\x2b"  "\x3d"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x28"  "\x30"  "\x29"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6d"  "\x69"  "\x6e"  "\x5f"  "\x76"  "\x61"  "\x6c"  "\x75"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x66"  "\x6d"  "\x69"  "\x6e"  "\x28"  "\x6d"  "\x69"  "\x6e"  "\x5f"  "\x76"  "\x61"  "\x6c"  "\x75"  "\x65"  "\x2c"  "\x20"  "\x76"  "\x61"  "\x6c"  "\x75"  "\x65"  "\x73"  "\x5b"  "\x69"  "\x5d"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6d"  "\x61"  "\x78"  "\x5f"  "\x76"  "\x61"  "\x6c"  "\x75"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x66"  "\x6d"  "\x61"  "\x78"  "\x28"  "\x6d"  "\x61"  "\x78"  "\x5f"  "\x76"  "\x61"  "\x6c"  "\x75"  "\x65"  "\x2c"  "\x20"  "\x76"  "\x61"  "\x6c"  "\x75"  "\x65"  "\x73"  "\x5b"  "\x69"  "\x5d"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7d"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x6e"  "\x64"  "\x65"  "\x72"  "\x5f"  "\x72"  "\x61"  "\x6e"  "\x67"  "\x65"  "\x5f"  "\x67"  "\x72"  "\x6f"  "\x75"  "\x70"  "\x28"  "\x6c"  "\x6f"  "\x2c"  "\x20"  "\x68"  "\x69"  "\x2c"  "\x20"  "\x6d"  "\x69"  "\x6e"  "\x5f"  "\x76"  "\x61"  "\x6c"  "\x75"  "\x65"  "\x2c"  "\x20"  "\x6d"  "\x61"  "\x78"  "\x5f"  "\x76"  "\x61"  "\x6c"  "\x75"  "\x65"  "\x2c"  "\x20"  "\x72"  "\x61"  "\x6e"  "\x67"  "\x65"  "\x29"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x2f"  "\x2f"  "\x73"  "\x61"  "\x6d"  "\x65"  "\x20"  "\x6f"  "\x76"  "\x65"  "\x72"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x6c"  "\x65"  "\x6e"  "\x67"  "\x74"  "\x68"  "\x73"  "\x20"  "\x6f"  "\x66"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x76"  "\x65"  "\x63"  "\x74"  "\x6f"  "\x72"  "\x73"  "\x2c"  "\x20"  "\x66"  "\x6f"  "\x72"  "\x20"  "\x72"  "\x65"  "\x6e"  "\x64"  "\x65"  "\x72"  "\x5f"  "\x65"  "\x6c"  "\x65"  "\x63"  "\x74"  "\x72"  "\x69"  "\x63"  "\x0a"  "\x6b"  "\x65"  "\x72"  "\x6e"  "\x65"  "\x6c"  "\x20"  "\x76"  "\x6f"  "\x69"  "\x64"  "\x20"  "\x72"  "\x65"  "\x6e"  "\x64"  "\x65"  "\x72"  "\x5f"  "\x72"  "\x61"  "\x6e"  "\x67"  "\x65"  "\x5f"  "\x6e"  "\x6f"  "\x72"  "\x6d"  "\x28"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x2a"  "\x76"  "\x61"  "\x6c"  "\x75"  "\x65"  "\x73"  "\x2c"  "\x20"  "\x75"  "\x6e"  "\x73"  "\x69"  "\x67"  "\x6e"  "\x65"  "\x64"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x6e"  "\x2c"  "\x20"  "\x4c"  "\x4f"  "\x43"  "\x41"  "\x4c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x2a"  "\x6c"  "\x6f"  "\x2c"  "\x20"  "\x4c"  "\x4f"  "\x43"  "\x41"  "\x4c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x2a"  "\x68"  "\x69"  "\x2c"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x2a"  "\x72"  "\x61"  "\x6e"  "\x67"  "\x65"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x6d"  "\x69"  "\x6e"  "\x5f"  "\x76"  "\x61"  "\x6c"  "\x75"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x49"  "\x4e"  "\x46"  "\x49"  "\x4e"  "\x49"  "\x54"  "\x59"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x6d"  "\x61"  "\x78"  "\x5f"  "\x76"  "\x61"  "\x6c"  "\x75"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x2d"  "\x49"  "\x4e"  "\x46"  "\x49"  "\x4e"  "\x49"  "\x54"  "\x59"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x66"  "\x6f"  "\x72"  "\x20"  "\x28"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x20"  "\x69"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x64"  "\x28"  "\x30"  "\x29"  "\x3b"  "\x20"  "\x69"  "\x20"  "\x3c"  "\x20"  "\x6e"  "\x3b"  "\x20"  "\x69"  "\x20"  "\x2b"  "\x3d"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x6c"  "\x6f"  "\x63"  "\x61"  "\x6c"  "\x5f"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x28"  "\x30"  "\x29"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x64"  "\x6f"  "\x74"  "\x28"  "\x76"  "\x61"  "\x6c"  "\x75"  "\x65"  "\x73"  "\x5b"  "\x69"  "\x5d"  "\x2c"  "\x20"  "\x76"  "\x61"  "\x6c"  "\x75"  "\x65"  "\x73"  "\x5b"  "\x69"  "\x5d"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6d"  "\x69"  "\x6e"  "\x5f"  "\x76"  "\x61"  "\x6c"  "\x75"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x66"  "\x6d"  "\x69"  "\x6e"  "\x28"  "\x6d"  "\x69"  "\x6e"  "\x5f"  "\x76"  "\x61"  "\x6c"  "\x75"  "\x65"  "\x2c"  "\x20"  "\x64"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6d"  "\x61"  "\x78"  "\x5f"  "\x76"  "\x61"  "\x6c"  "\x75"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x66"  "\x6d"  "\x61"  "\x78"  "\x28"  "\x6d"  "\x61"  "\x78"  "\x5f"  "\x76"  "\x61"  "\x6c"  "\x75"  "\x65"  "\x2c"  "\x20"  "\x64"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7d"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x6e"  "\x64"  "\x65"  "\x72"  "\x5f"  "\x72"  "\x61"  "\x6e"  "\x67"  "\x65"  "\x5f"  "\x67"  "\x72"  "\x6f"  "\x75"  "\x70"  "\x28"  "\x6c"  "\x6f"  "\x2c"  "\x20"  "\x68"  "\x69"  "\x2c"  "\x20"  "\x73"  "\x71"  "\x72"  "\x74"  "\x28"  "\x6d"  "\x69"  "\x6e"  "\x5f"  "\x76"  "\x61"  "\x6c"  "\x75"  "\x65"  "\x29"  "\x2c"  "\x20"  "\x73"  "\x71"  "\x72"  "\x74"  "\x28"  "\x6d"  "\x61"  "\x78"  "\x5f"  "\x76"  "\x61"  "\x6c"  "\x75"  "\x65"  "\x29"  "\x2c"  "\x20"  "\x72"  "\x61"  "\x6e"  "\x67"  "\x65"  "\x29"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x6b"  "\x65"  "\x72"  "\x6e"  "\x65"  "\x6c"  "\x20"  "\x76"  "\x6f"  "\x69"  "\x64"  "\x20"  "\x72"  "\x65"  "\x6e"  "\x64"  "\x65"  "\x72"  "\x5f"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x28"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x2a"  "\x69"  "\x6e"  "\x70"  "\x75"  "\x74"  "\x2c"  "\x20"  "\x75"  "\x6e"  "\x73"  "\x69"  "\x67"  "\x6e"  "\x65"  "\x64"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x75"  "\x6e"  "\x73"  "\x69"  "\x67"  "\x6e"  "\x65"  "\x64"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x2c"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x2a"  "\x72"  "\x61"  "\x6e"  "\x67"  "\x65"  "\x2c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x52"  "\x47"  "\x42"  "\x41"  "\x33"  "\x32"  "\x20"  "\x2a"  "\x72"  "\x67"  "\x62"  "\x61"  "\x2c"  "\x20"  "\x75"  "\x6e"  "\x73"  "\x69"  "\x67"  "\x6e"  "\x65"  "\x64"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x77"  "\x69"  "\x64"  "\x74"  "\x68"  "\x2c"  "\x20"  "\x75"  "\x6e"  "\x73"  "\x69"  "\x67"  "\x6e"  "\x65"  "\x64"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x68"  "\x65"  "\x69"  "\x67"  "\x68"  "\x74"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x73"  "\x74"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x69"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x67"  "\x6c"  "\x6f"  "\x62"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x64"  "\x28"  "\x30"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x73"  "\x74"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x69"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x67"  "\x6c"  "\x6f"  "\x62"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x64"  "\x28"  "\x31"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x69"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3e"  "\x3d"  "\x20"  "\x77"  "\x69"  "\x64"  "\x74"  "\x68"  "\x20"  "\x7c"  "\x7c"  "\x20"  "\x69"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3e"  "\x3d"  "\x20"  "\x68"  "\x65"  "\x69"  "\x67"  "\x68"  "\x74"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x73"  "\x74"  "\x20"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x20"  "\x69"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x29"  "\x69"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2a"  "\x20"  "\x77"  "\x69"  "\x64"  "\x74"  "\x68"  "\x20"  "\x2b"  "\x20"  "\x69"  "\x63"  "\x6f"  "\x6c"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x76"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x29"  "\x69"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x2a"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x20"  "\x2f"  "\x20"  "\x77"  "\x69"  "\x64"  "\x74"  "\x68"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x76"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x29"  "\x69"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2a"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x2f"  "\x20"  "\x68"  "\x65"  "\x69"  "\x67"  "\x68"  "\x74"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x2f"  "\x2f"  "\x72"  "\x65"  "\x6e"  "\x64"  "\x65"  "\x72"  "\x69"  "\x6e"  "\x67"  "\x20"  "\x69"  "\x6e"  "\x76"  "\x65"  "\x72"  "\x74"  "\x73"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x2c"  "\x20"  "\x6e"  "\x65"  "\x65"  "\x64"  "\x20"  "\x74"  "\x6f"  "\x20"  "\x69"  "\x6e"  "\x76"  "\x65"  "\x72"  "\x74"  "\x20"  "\x62"  "\x61"  "\x63"  "\x6b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3d"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x2d"  "\x20"  "\x31"  "\x20"  "\x2d"  "\x20"  "\x76"  "\x72"  "\x6f"  "\x77"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x76"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3e"  "\x3d"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x7c"  "\x7c"  "\x20"  "\x76"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3e"  "\x3d"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x73"  "\x74"  "\x61"  "\x72"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x28"  "\x30"  "\x2c"  "\x20"  "\x30"  "\x2c"  "\x20"  "\x30"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6d"  "\x69"  "\x64"  "\x64"  "\x6c"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x28"  "\x30"  "\x2e"  "\x35"  "\x2c"  "\x20"  "\x30"  "\x2e"  "\x35"  "\x2c"  "\x20"  "\x30"  "\x2e"  "\x35"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x65"  "\x6e"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x28"  "\x31"  "\x2c"  "\x20"  "\x31"  "\x2c"  "\x20"  "\x31"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x69"  "\x6e"  "\x70"  "\x75"  "\x74"  "\x5b"  "\x76"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2a"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x20"  "\x2b"  "\x20"  "\x76"  "\x63"  "\x6f"  "\x6c"  "\x5d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x20"  "\x2d"  "\x20"  "\x72"  "\x61"  "\x6e"  "\x67"  "\x65"  "\x5b"  "\x30"  "\x5d"  "\x29"  "\x20"  "\x2f"  "\x20"  "\x28"  "\x72"  "\x61"  "\x6e"  "\x67"  "\x65"  "\x5b"  "\x31"  "\x5d"  "\x20"  "\x2d"  "\x20"  "\x72"  "\x61"  "\x6e"  "\x67"  "\x65"  "\x5b"  "\x30"  "\x5d"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x67"  "\x62"  "\x61"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x20"  "\x3d"  "\x20"  "\x6c"  "\x69"  "\x6e"  "\x65"  "\x61"  "\x72"  "\x5f"  "\x6d"  "\x61"  "\x70"  "\x70"  "\x69"  "\x6e"  "\x67"  "\x28"  "\x63"  "\x6c"  "\x61"  "\x6d"  "\x70"  "\x28"  "\x63"  "\x68"  "\x61"  "\x72"  "\x67"  "\x65"  "\x2c"  "\x20"  "\x30"  "\x2e"  "\x30"  "\x2c"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x29"  "\x2c"  "\x20"  "\x73"  "\x74"  "\x61"  "\x72"  "\x74"  "\x2c"  "\x20"  "\x6d"  "\x69"  "\x64"  "\x64"  "\x6c"  "\x65"  "\x2c"  "\x20"  "\x65"  "\x6e"  "\x64"  "\x29"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x6b"  "\x65"  "\x72"  "\x6e"  "\x65"  "\x6c"  "\x20"  "\x76"  "\x6f"  "\x69"  "\x64"  "\x20"  "\x72"  "\x65"  "\x6e"  "\x64"  "\x65"  "\x72"  "\x5f"  "\x70"  "\x69"  "\x6e"  "\x6e"  "\x69"  "\x6e"  "\x67"  "\x28"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x73"  "\x69"  "\x74"  "\x65"  "\x5f"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x73"  "\x20"  "\x2a"  "\x69"  "\x6e"  "\x70"  "\x75"  "\x74"  "\x2c"  "\x20"  "\x75"  "\x6e"  "\x73"  "\x69"  "\x67"  "\x6e"  "\x65"  "\x64"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x75"  "\x6e"  "\x73"  "\x69"  "\x67"  "\x6e"  "\x65"  "\x64"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x2c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x52"  "\x47"  "\x42"  "\x41"  "\x33"  "\x32"  "\x20"  "\x2a"  "\x72"  "\x67"  "\x62"  "\x61"  "\x2c"  "\x20"  "\x75"  "\x6e"  "\x73"  "\x69"  "\x67"  "\x6e"  "\x65"  "\x64"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x77"  "\x69"  "\x64"  "\x74"  "\x68"  "\x2c"  "\x20"  "\x75"  "\x6e"  "\x73"  "\x69"  "\x67"  "\x6e"  "\x65"  "\x64"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x68"  "\x65"  "\x69"  "\x67"  "\x68"  "\x74"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x73"  "\x74"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x69"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x67"  "\x6c"  "\x6f"  "\x62"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x64"  "\x28"  "\x30"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x73"  "\x74"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x69"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x67"  "\x6c"  "\x6f"  "\x62"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x64"  "\x28"  "\x31"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x69"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3e"  "\x3d"  "\x20"  "\x77"  "\x69"  "\x64"  "\x74"  "\x68"  "\x20"  "\x7c"  "\x7c"  "\x20"  "\x69"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3e"  "\x3d"  "\x20"  "\x68"  "\x65"  "\x69"  "\x67"  "\x68"  "\x74"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x73"  "\x74"  "\x20"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x20"  "\x69"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x29"  "\x69"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2a"  "\x20"  "\x77"  "\x69"  "\x64"  "\x74"  "\x68"  "\x20"  "\x2b"  "\x20"  "\x69"  "\x63"  "\x6f"  "\x6c"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x76"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x29"  "\x69"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x2a"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x20"  "\x2f"  "\x20"  "\x77"  "\x69"  "\x64"  "\x74"  "\x68"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x76"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x29"  "\x69"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2a"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x2f"  "\x20"  "\x68"  "\x65"  "\x69"  "\x67"  "\x68"  "\x74"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x2f"  "\x2f"  "\x72"  "\x65"  "\x6e"  "\x64"  "\x65"  "\x72"  "\x69"  "\x6e"  "\x67"  "\x20"  "\x69"  "\x6e"  "\x76"  "\x65"  "\x72"  "\x74"  "\x73"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x2c"  "\x20"  "\x6e"  "\x65"  "\x65"  "\x64"  "\x20"  "\x74"  "\x6f"  "\x20"  "\x69"  "\x6e"  "\x76"  "\x65"  "\x72"  "\x74"  "\x20"  "\x62"  "\x61"  "\x63"  "\x6b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3d"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x2d"  "\x20"  "\x31"  "\x20"  "\x2d"  "\x20"  "\x76"  "\x72"  "\x6f"  "\x77"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x76"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3e"  "\x3d"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x7c"  "\x7c"  "\x20"  "\x76"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3e"  "\x3d"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x69"  "\x6e"  "\x70"  "\x75"  "\x74"  "\x5b"  "\x76"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2a"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x20"  "\x2b"  "\x20"  "\x76"  "\x63"  "\x6f"  "\x6c"  "\x5d"  "\x2e"  "\x70"  "\x69"  "\x6e"  "\x2e"  "\x70"  "\x69"  "\x6e"  "\x6e"  "\x65"  "\x64"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x67"  "\x62"  "\x61"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x52"  "\x47"  "\x42"  "\x41"  "\x33"  "\x32"  "\x29"  "\x7b"  "\x2e"  "\x61"  "\x20"  "\x3d"  "\x20"  "\x30"  "\x78"  "\x66"  "\x66"  "\x2c"  "\x20"  "\x2e"  "\x62"  "\x20"  "\x3d"  "\x20"  "\x30"  "\x2c"  "\x20"  "\x2e"  "\x67"  "\x20"  "\x3d"  "\x20"  "\x30"  "\x78"  "\x66"  "\x66"  "\x2c"  "\x20"  "\x2e"  "\x72"  "\x20"  "\x3d"  "\x20"  "\x30"  "\x78"  "\x66"  "\x66"  "\x7d"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x6b"  "\x65"  "\x72"  "\x6e"  "\x65"  "\x6c"  "\x20"  "\x76"  "\x6f"  "\x69"  "\x64"  "\x20"  "\x63"  "\x61"  "\x6c"  "\x63"  "\x75"  "\x6c"  "\x61"  "\x74"  "\x65"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x28"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x73"  "\x69"  "\x74"  "\x65"  "\x5f"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x73"  "\x20"  "\x2a"  "\x67"  "\x73"  "\x2c"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x2a"  "\x76"  "\x2c"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x20"  "\x67"  "\x69"  "\x2c"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x2a"  "\x6f"  "\x75"  "\x74"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x74"  "\x69"  "\x6d"  "\x65"  "\x2c"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x74"  "\x65"  "\x6e"  "\x73"  "\x6f"  "\x72"  "\x20"  "\x2a"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x74"  "\x61"  "\x62"  "\x6c"  "\x65"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x73"  "\x74"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x67"  "\x6c"  "\x6f"  "\x62"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x64"  "\x28"  "\x30"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x73"  "\x74"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x67"  "\x6c"  "\x6f"  "\x62"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x64"  "\x28"  "\x31"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x73"  "\x74"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x61"  "\x63"  "\x74"  "\x69"  "\x76"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x26"  "\x26"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x73"  "\x74"  "\x20"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x20"  "\x69"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x29"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2a"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x20"  "\x2b"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x3b"  "\x0a"  "\x0a"  "\x23"  "\x69"  "\x66"  "\x64"  "\x65"  "\x66"  "\x20"  "\x49"  "\x4e"  "\x43"  "\x4c"  "\x55"  "\x44"  "\x45"  "\x5f"  "\x44"  "\x49"  "\x50"  "\x4f"  "\x4c"  "\x41"  "\x52"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x4c"  "\x4f"  "\x43"  "\x41"  "\x4c"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x74"  "\x65"  "\x6e"  "\x73"  "\x6f"  "\x72"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x74"  "\x69"  "\x6c"  "\x65"  "\x5b"  "\x44"  "\x49"  "\x50"  "\x4f"  "\x4c"  "\x41"  "\x52"  "\x5f"  "\x54"  "\x49"  "\x4c"  "\x45"  "\x5d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x20"  "\x3d"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x67"  "\x73"  "\x2c"  "\x20"  "\x76"  "\x2c"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x74"  "\x61"  "\x62"  "\x6c"  "\x65"  "\x2c"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x74"  "\x69"  "\x6c"  "\x65"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2c"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x2c"  "\x20"  "\x61"  "\x63"  "\x74"  "\x69"  "\x76"  "\x65"  "\x29"  "\x3b"  "\x0a"  "\x23"  "\x65"  "\x6c"  "\x73"  "\x65"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x55"  "\x4e"  "\x55"  "\x53"  "\x45"  "\x44"  "\x28"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x74"  "\x61"  "\x62"  "\x6c"  "\x65"  "\x29"  "\x3b"  "\x0a"  "\x23"  "\x65"  "\x6e"  "\x64"  "\x69"  "\x66"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x21"  "\x61"  "\x63"  "\x74"  "\x69"  "\x76"  "\x65"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x65"  "\x74"  "\x65"  "\x72"  "\x73"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x73"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x61"  "\x70"  "\x70"  "\x6c"  "\x79"  "\x5f"  "\x70"  "\x62"  "\x63"  "\x28"  "\x76"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x70"  "\x62"  "\x63"  "\x2c"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x2d"  "\x20"  "\x31"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x61"  "\x70"  "\x70"  "\x6c"  "\x79"  "\x5f"  "\x70"  "\x62"  "\x63"  "\x28"  "\x76"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x70"  "\x62"  "\x63"  "\x2c"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x2b"  "\x20"  "\x31"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x75"  "\x70"  "\x20"  "\x3d"  "\x20"  "\x61"  "\x70"  "\x70"  "\x6c"  "\x79"  "\x5f"  "\x70"  "\x62"  "\x63"  "\x28"  "\x76"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x70"  "\x62"  "\x63"  "\x2c"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2b"  "\x20"  "\x31"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x20"  "\x3d"  "\x20"  "\x61"  "\x70"  "\x70"  "\x6c"  "\x79"  "\x5f"  "\x70"  "\x62"  "\x63"  "\x28"  "\x76"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x70"  "\x62"  "\x63"  "\x2c"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2d"  "\x20"  "\x31"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x74"  "\x69"  "\x6d"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x74"  "\x69"  "\x6d"  "\x65"  "\x3b"  "\x0a"  "\x0a"  "\x23"  "\x69"  "\x66"  "\x64"  "\x65"  "\x66"  "\x20"  "\x49"  "\x4e"  "\x43"  "\x4c"  "\x55"  "\x44"  "\x45"  "\x5f"  "\x44"  "\x49"  "\x50"  "\x4f"  "\x4c"  "\x41"  "\x52"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x64"  "\x6f"  "\x74"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2c"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x5f"  "\x66"  "\x72"  "\x6f"  "\x6d"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x23"  "\x65"  "\x6e"  "\x64"  "\x69"  "\x66"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6f"  "\x75"  "\x74"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x20"  "\x3d"  "\x20"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x29"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x6b"  "\x65"  "\x72"  "\x6e"  "\x65"  "\x6c"  "\x20"  "\x76"  "\x6f"  "\x69"  "\x64"  "\x20"  "\x72"  "\x65"  "\x6e"  "\x64"  "\x65"  "\x72"  "\x5f"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x28"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x2a"  "\x65"  "\x6e"  "\x65"  "\x2c"  "\x20"  "\x75"  "\x6e"  "\x73"  "\x69"  "\x67"  "\x6e"  "\x65"  "\x64"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x75"  "\x6e"  "\x73"  "\x69"  "\x67"  "\x6e"  "\x65"  "\x64"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x2c"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x2a"  "\x72"  "\x61"  "\x6e"  "\x67"  "\x65"  "\x2c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x52"  "\x47"  "\x42"  "\x41"  "\x33"  "\x32"  "\x20"  "\x2a"  "\x72"  "\x67"  "\x62"  "\x61"  "\x2c"  "\x20"  "\x75"  "\x6e"  "\x73"  "\x69"  "\x67"  "\x6e"  "\x65"  "\x64"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x77"  "\x69"  "\x64"  "\x74"  "\x68"  "\x2c"  "\x20"  "\x75"  "\x6e"  "\x73"  "\x69"  "\x67"  "\x6e"  "\x65"  "\x64"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x68"  "\x65"  "\x69"  "\x67"  "\x68"  "\x74"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x73"  "\x74"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x69"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x67"  "\x6c"  "\x6f"  "\x62"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x64"  "\x28"  "\x30"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x73"  "\x74"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x69"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x67"  "\x6c"  "\x6f"  "\x62"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x64"  "\x28"  "\x31"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x69"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3e"  "\x3d"  "\x20"  "\x77"  "\x69"  "\x64"  "\x74"  "\x68"  "\x20"  "\x7c"  "\x7c"  "\x20"  "\x69"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3e"  "\x3d"  "\x20"  "\x68"  "\x65"  "\x69"  "\x67"  "\x68"  "\x74"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x73"  "\x74"  "\x20"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x20"  "\x69"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x29"  "\x69"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2a"  "\x20"  "\x77"  "\x69"  "\x64"  "\x74"  "\x68"  "\x20"  "\x2b"  "\x20"  "\x69"  "\x63"  "\x6f"  "\x6c"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x76"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x29"  "\x69"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x2a"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x20"  "\x2f"  "\x20"  "\x77"  "\x69"  "\x64"  "\x74"  "\x68"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x76"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x29"  "\x69"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2a"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x2f"  "\x20"  "\x68"  "\x65"  "\x69"  "\x67"  "\x68"  "\x74"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x2f"  "\x2f"  "\x72"  "\x65"  "\x6e"  "\x64"  "\x65"  "\x72"  "\x69"  "\x6e"  "\x67"  "\x20"  "\x69"  "\x6e"  "\x76"  "\x65"  "\x72"  "\x74"  "\x73"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x2c"  "\x20"  "\x6e"  "\x65"  "\x65"  "\x64"  "\x20"  "\x74"  "\x6f"  "\x20"  "\x69"  "\x6e"  "\x76"  "\x65"  "\x72"  "\x74"  "\x20"  "\x62"  "\x61"  "\x63"  "\x6b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3d"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x2d"  "\x20"  "\x31"  "\x20"  "\x2d"  "\x20"  "\x76"  "\x72"  "\x6f"  "\x77"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x76"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3e"  "\x3d"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x7c"  "\x7c"  "\x20"  "\x76"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3e"  "\x3d"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x73"  "\x74"  "\x61"  "\x72"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x28"  "\x30"  "\x2c"  "\x20"  "\x30"  "\x2c"  "\x20"  "\x30"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x6d"  "\x69"  "\x64"  "\x64"  "\x6c"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x28"  "\x30"  "\x2e"  "\x35"  "\x2c"  "\x20"  "\x30"  "\x2e"  "\x35"  "\x2c"  "\x20"  "\x30"  "\x2e"  "\x35"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x65"  "\x6e"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x28"  "\x31"  "\x2c"  "\x20"  "\x31"  "\x2c"  "\x20"  "\x31"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x20"  "\x3d"  "\x20"  "\x65"  "\x6e"  "\x65"  "\x5b"  "\x76"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2a"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x20"  "\x2b"  "\x20"  "\x76"  "\x63"  "\x6f"  "\x6c"  "\x5d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x20"  "\x2d"  "\x20"  "\x72"  "\x61"  "\x6e"  "\x67"  "\x65"  "\x5b"  "\x30"  "\x5d"  "\x29"  "\x20"  "\x2f"  "\x20"  "\x28"  "\x72"  "\x61"  "\x6e"  "\x67"  "\x65"  "\x5b"  "\x31"  "\x5d"  "\x20"  "\x2d"  "\x20"  "\x72"  "\x61"  "\x6e"  "\x67"  "\x65"  "\x5b"  "\x30"  "\x5d"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x67"  "\x62"  "\x61"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x20"  "\x3d"  "\x20"  "\x6c"  "\x69"  "\x6e"  "\x65"  "\x61"  "\x72"  "\x5f"  "\x6d"  "\x61"  "\x70"  "\x70"  "\x69"  "\x6e"  "\x67"  "\x28"  "\x63"  "\x6c"  "\x61"  "\x6d"  "\x70"  "\x28"  "\x65"  "\x6e"  "\x65"  "\x72"  "\x67"  "\x79"  "\x2c"  "\x20"  "\x30"  "\x2e"  "\x30"  "\x2c"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x29"  "\x2c"  "\x20"  "\x73"  "\x74"  "\x61"  "\x72"  "\x74"  "\x2c"  "\x20"  "\x6d"  "\x69"  "\x64"  "\x64"  "\x6c"  "\x65"  "\x2c"  "\x20"  "\x65"  "\x6e"  "\x64"  "\x29"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x6b"  "\x65"  "\x72"  "\x6e"  "\x65"  "\x6c"  "\x20"  "\x76"  "\x6f"  "\x69"  "\x64"  "\x20"  "\x74"  "\x68"  "\x65"  "\x72"  "\x6d"  "\x61"  "\x6c"  "\x5f"  "\x73"  "\x74"  "\x65"  "\x70"  "\x5f"  "\x67"  "\x73"  "\x61"  "\x28"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x73"  "\x69"  "\x74"  "\x65"  "\x5f"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x73"  "\x20"  "\x2a"  "\x67"  "\x73"  "\x2c"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x2a"  "\x76"  "\x30"  "\x2c"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x2a"  "\x76"  "\x31"  "\x2c"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x20"  "\x67"  "\x69"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x71"  "\x56"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x67"  "\x61"  "\x6d"  "\x6d"  "\x61"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x54"  "\x2c"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x73"  "\x65"  "\x65"  "\x64"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x20"  "\x69"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x67"  "\x6c"  "\x6f"  "\x62"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x64"  "\x28"  "\x30"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x69"  "\x64"  "\x20"  "\x3e"  "\x3d"  "\x20"  "\x28"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x2a"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x30"  "\x6c"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x30"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x31"  "\x6c"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x31"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x69"  "\x6e"  "\x6e"  "\x69"  "\x6e"  "\x67"  "\x20"  "\x70"  "\x69"  "\x6e"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x73"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x2e"  "\x70"  "\x69"  "\x6e"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x20"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x73"  "\x65"  "\x65"  "\x64"  "\x28"  "\x26"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2c"  "\x20"  "\x73"  "\x65"  "\x65"  "\x64"  "\x20"  "\x2b"  "\x20"  "\x69"  "\x64"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x64"  "\x65"  "\x6c"  "\x74"  "\x61"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x63"  "\x28"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x72"  "\x61"  "\x6e"  "\x64"  "\x6f"  "\x6d"  "\x5f"  "\x67"  "\x73"  "\x61"  "\x28"  "\x26"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2c"  "\x20"  "\x71"  "\x56"  "\x2c"  "\x20"  "\x54"  "\x2c"  "\x20"  "\x67"  "\x61"  "\x6d"  "\x6d"  "\x61"  "\x29"  "\x2c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x72"  "\x61"  "\x6e"  "\x64"  "\x6f"  "\x6d"  "\x5f"  "\x67"  "\x73"  "\x61"  "\x28"  "\x26"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2c"  "\x20"  "\x71"  "\x56"  "\x2c"  "\x20"  "\x54"  "\x2c"  "\x20"  "\x67"  "\x61"  "\x6d"  "\x6d"  "\x61"  "\x29"  "\x2c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x72"  "\x61"  "\x6e"  "\x64"  "\x6f"  "\x6d"  "\x5f"  "\x67"  "\x73"  "\x61"  "\x28"  "\x26"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2c"  "\x20"  "\x71"  "\x56"  "\x2c"  "\x20"  "\x54"  "\x2c"  "\x20"  "\x67"  "\x61"  "\x6d"  "\x6d"  "\x61"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x31"  "\x6c"  "\x20"  "\x3d"  "\x20"  "\x70"  "\x69"  "\x6e"  "\x2e"  "\x70"  "\x69"  "\x6e"  "\x6e"  "\x65"  "\x64"  "\x3f"  "\x20"  "\x70"  "\x69"  "\x6e"  "\x2e"  "\x64"  "\x69"  "\x72"  "\x3a"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x6e"  "\x6f"  "\x72"  "\x6d"  "\x61"  "\x6c"  "\x69"  "\x7a"  "\x65"  "\x28"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x76"  "\x30"  "\x6c"  "\x2c"  "\x20"  "\x64"  "\x65"  "\x6c"  "\x74"  "\x61"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x31"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x31"  "\x6c"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x2f"  "\x2f"  "\x30"  "\x20"  "\x2d"  "\x3e"  "\x20"  "\x62"  "\x65"  "\x66"  "\x6f"  "\x72"  "\x65"  "\x0a"  "\x2f"  "\x2f"  "\x31"  "\x20"  "\x2d"  "\x3e"  "\x20"  "\x63"  "\x75"  "\x72"  "\x72"  "\x65"  "\x6e"  "\x74"  "\x0a"  "\x2f"  "\x2f"  "\x32"  "\x20"  "\x2d"  "\x3e"  "\x20"  "\x6e"  "\x65"  "\x77"  "\x0a"  "\x6b"  "\x65"  "\x72"  "\x6e"  "\x65"  "\x6c"  "\x20"  "\x76"  "\x6f"  "\x69"  "\x64"  "\x20"  "\x67"  "\x72"  "\x61"  "\x64"  "\x69"  "\x65"  "\x6e"  "\x74"  "\x5f"  "\x64"  "\x65"  "\x73"  "\x63"  "\x65"  "\x6e"  "\x74"  "\x5f"  "\x73"  "\x74"  "\x65"  "\x70"  "\x28"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x73"  "\x69"  "\x74"  "\x65"  "\x5f"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x73"  "\x20"  "\x2a"  "\x67"  "\x73"  "\x2c"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x2a"  "\x76"  "\x30"  "\x2c"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x2a"  "\x76"  "\x31"  "\x2c"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x2a"  "\x76"  "\x32"  "\x2c"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x20"  "\x67"  "\x69"  "\x2c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x6d"  "\x61"  "\x73"  "\x73"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x54"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x64"  "\x61"  "\x6d"  "\x70"  "\x69"  "\x6e"  "\x67"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x72"  "\x65"  "\x73"  "\x74"  "\x6f"  "\x72"  "\x69"  "\x6e"  "\x67"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x64"  "\x74"  "\x2c"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x73"  "\x65"  "\x65"  "\x64"  "\x2c"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x74"  "\x65"  "\x6e"  "\x73"  "\x6f"  "\x72"  "\x20"  "\x2a"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x74"  "\x61"  "\x62"  "\x6c"  "\x65"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x73"  "\x74"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x67"  "\x6c"  "\x6f"  "\x62"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x64"  "\x28"  "\x30"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x73"  "\x74"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x67"  "\x6c"  "\x6f"  "\x62"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x64"  "\x28"  "\x31"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x73"  "\x74"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x61"  "\x63"  "\x74"  "\x69"  "\x76"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x26"  "\x26"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x73"  "\x74"  "\x20"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x20"  "\x69"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x29"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2a"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x20"  "\x2b"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x3b"  "\x0a"  "\x0a"  "\x23"  "\x69"  "\x66"  "\x64"  "\x65"  "\x66"  "\x20"  "\x49"  "\x4e"  "\x43"  "\x4c"  "\x55"  "\x44"  "\x45"  "\x5f"  "\x44"  "\x49"  "\x50"  "\x4f"  "\x4c"  "\x41"  "\x52"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x4c"  "\x4f"  "\x43"  "\x41"  "\x4c"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x74"  "\x65"  "\x6e"  "\x73"  "\x6f"  "\x72"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x74"  "\x69"  "\x6c"  "\x65"  "\x5b"  "\x44"  "\x49"  "\x50"  "\x4f"  "\x4c"  "\x41"  "\x52"  "\x5f"  "\x54"  "\x49"  "\x4c"  "\x45"  "\x5d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x20"  "\x3d"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x67"  "\x73"  "\x2c"  "\x20"  "\x76"  "\x31"  "\x2c"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x74"  "\x61"  "\x62"  "\x6c"  "\x65"  "\x2c"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x74"  "\x69"  "\x6c"  "\x65"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2c"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x2c"  "\x20"  "\x61"  "\x63"  "\x74"  "\x69"  "\x76"  "\x65"  "\x29"  "\x3b"  "\x0a"  "\x23"  "\x65"  "\x6c"  "\x73"  "\x65"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x55"  "\x4e"  "\x55"  "\x53"  "\x45"  "\x44"  "\x28"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x74"  "\x61"  "\x62"  "\x6c"  "\x65"  "\x29"  "\x3b"  "\x0a"  "\x23"  "\x65"  "\x6e"  "\x64"  "\x69"  "\x66"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x21"  "\x61"  "\x63"  "\x74"  "\x69"  "\x76"  "\x65"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x65"  "\x74"  "\x65"  "\x72"  "\x73"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x31"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x65"  "\x74"  "\x65"  "\x72"  "\x73"  "\x29"  "\x7b"  "\x7d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x31"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x31"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x31"  "\x2e"  "\x74"  "\x69"  "\x6d"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x30"  "\x2e"  "\x30"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x31"  "\x2e"  "\x6d"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x31"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x31"  "\x2e"  "\x67"  "\x73"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x73"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x31"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x75"  "\x70"  "\x20"  "\x3d"  "\x20"  "\x61"  "\x70"  "\x70"  "\x6c"  "\x79"  "\x5f"  "\x70"  "\x62"  "\x63"  "\x28"  "\x76"  "\x31"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x70"  "\x62"  "\x63"  "\x2c"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2b"  "\x20"  "\x31"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x31"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x20"  "\x3d"  "\x20"  "\x61"  "\x70"  "\x70"  "\x6c"  "\x79"  "\x5f"  "\x70"  "\x62"  "\x63"  "\x28"  "\x76"  "\x31"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x70"  "\x62"  "\x63"  "\x2c"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2d"  "\x20"  "\x31"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x31"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x61"  "\x70"  "\x70"  "\x6c"  "\x79"  "\x5f"  "\x70"  "\x62"  "\x63"  "\x28"  "\x76"  "\x31"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x70"  "\x62"  "\x63"  "\x2c"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x2b"  "\x20"  "\x31"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x31"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x61"  "\x70"  "\x70"  "\x6c"  "\x79"  "\x5f"  "\x70"  "\x62"  "\x63"  "\x28"  "\x76"  "\x31"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x70"  "\x62"  "\x63"  "\x2c"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x2d"  "\x20"  "\x31"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x23"  "\x69"  "\x66"  "\x64"  "\x65"  "\x66"  "\x20"  "\x49"  "\x4e"  "\x43"  "\x4c"  "\x55"  "\x44"  "\x45"  "\x5f"  "\x44"  "\x49"  "\x50"  "\x4f"  "\x4c"  "\x41"  "\x52"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x31"  "\x2e"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x5f"  "\x66"  "\x72"  "\x6f"  "\x6d"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x64"  "\x69"  "\x70"  "\x6f"  "\x6c"  "\x61"  "\x72"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x31"  "\x2e"  "\x67"  "\x73"  "\x29"  "\x3b"  "\x0a"  "\x23"  "\x65"  "\x6e"  "\x64"  "\x69"  "\x66"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x30"  "\x6c"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x30"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x64"  "\x68"  "\x5f"  "\x64"  "\x6d"  "\x20"  "\x3d"  "\x20"  "\x65"  "\x66"  "\x66"  "\x65"  "\x63"  "\x74"  "\x69"  "\x76"  "\x65"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x31"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x76"  "\x65"  "\x6c"  "\x6f"  "\x63"  "\x69"  "\x74"  "\x79"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x62"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x31"  "\x2e"  "\x6d"  "\x2c"  "\x20"  "\x76"  "\x30"  "\x6c"  "\x29"  "\x2c"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x20"  "\x2f"  "\x20"  "\x64"  "\x74"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x61"  "\x63"  "\x63"  "\x65"  "\x6c"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x31"  "\x2e"  "\x6d"  "\x2c"  "\x20"  "\x2d"  "\x72"  "\x65"  "\x73"  "\x74"  "\x6f"  "\x72"  "\x69"  "\x6e"  "\x67"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x61"  "\x63"  "\x63"  "\x65"  "\x6c"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x61"  "\x63"  "\x63"  "\x65"  "\x6c"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x76"  "\x65"  "\x6c"  "\x6f"  "\x63"  "\x69"  "\x74"  "\x79"  "\x2c"  "\x20"  "\x2d"  "\x64"  "\x61"  "\x6d"  "\x70"  "\x69"  "\x6e"  "\x67"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x61"  "\x63"  "\x63"  "\x65"  "\x6c"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x61"  "\x63"  "\x63"  "\x65"  "\x6c"  "\x2c"  "\x20"  "\x64"  "\x68"  "\x5f"  "\x64"  "\x6d"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x21"  "\x43"  "\x4c"  "\x4f"  "\x53"  "\x45"  "\x5f"  "\x45"  "\x4e"  "\x4f"  "\x55"  "\x47"  "\x48"  "\x28"  "\x54"  "\x2c"  "\x20"  "\x30"  "\x2e"  "\x30"  "\x2c"  "\x20"  "\x45"  "\x50"  "\x53"  "\x29"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x20"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x74"  "\x79"  "\x63"  "\x68"  "\x65"  "\x5f"  "\x69"  "\x5f"  "\x73"  "\x65"  "\x65"  "\x64"  "\x28"  "\x26"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x2c"  "\x20"  "\x73"  "\x65"  "\x65"  "\x64"  "\x20"  "\x2b"  "\x20"  "\x69"  "\x64"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x74"  "\x65"  "\x6d"  "\x70"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x6e"  "\x6f"  "\x72"  "\x6d"  "\x61"  "\x6c"  "\x5f"  "\x64"  "\x69"  "\x73"  "\x74"  "\x72"  "\x69"  "\x62"  "\x75"  "\x74"  "\x69"  "\x6f"  "\x6e"  "\x5f"  "\x76"  "\x33"  "\x64"  "\x28"  "\x26"  "\x73"  "\x74"  "\x61"  "\x74"  "\x65"  "\x29"  "\x2c"  "\x20"  "\x73"  "\x71"  "\x72"  "\x74"  "\x28"  "\x54"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x61"  "\x63"  "\x63"  "\x65"  "\x6c"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x61"  "\x63"  "\x63"  "\x65"  "\x6c"  "\x2c"  "\x20"  "\x74"  "\x65"  "\x6d"  "\x70"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x7d"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x61"  "\x63"  "\x63"  "\x65"  "\x6c"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x61"  "\x63"  "\x63"  "\x65"  "\x6c"  "\x2c"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x20"  "\x2f"  "\x20"  "\x6d"  "\x61"  "\x73"  "\x73"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x32"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x20"  "\x3d"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x31"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x70"  "\x69"  "\x6e"  "\x2e"  "\x70"  "\x69"  "\x6e"  "\x6e"  "\x65"  "\x64"  "\x3f"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x31"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x70"  "\x69"  "\x6e"  "\x2e"  "\x64"  "\x69"  "\x72"  "\x3a"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x6e"  "\x6f"  "\x72"  "\x6d"  "\x61"  "\x6c"  "\x69"  "\x7a"  "\x65"  "\x28"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x6d"  "\x28"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x31"  "\x2e"  "\x6d"  "\x2c"  "\x20"  "\x32"  "\x2e"  "\x30"  "\x29"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x62"  "\x28"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x61"  "\x63"  "\x63"  "\x65"  "\x6c"  "\x2c"  "\x20"  "\x64"  "\x74"  "\x20"  "\x2a"  "\x20"  "\x64"  "\x74"  "\x29"  "\x2c"  "\x20"  "\x76"  "\x30"  "\x6c"  "\x29"  "\x29"  "\x29"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x6b"  "\x65"  "\x72"  "\x6e"  "\x65"  "\x6c"  "\x20"  "\x76"  "\x6f"  "\x69"  "\x64"  "\x20"  "\x63"  "\x61"  "\x6c"  "\x63"  "\x75"  "\x6c"  "\x61"  "\x74"  "\x65"  "\x5f"  "\x65"  "\x6c"  "\x65"  "\x63"  "\x74"  "\x72"  "\x69"  "\x63"  "\x28"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x73"  "\x69"  "\x74"  "\x65"  "\x5f"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x73"  "\x20"  "\x2a"  "\x67"  "\x73"  "\x2c"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x2a"  "\x6d"  "\x30"  "\x2c"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x2a"  "\x6d"  "\x31"  "\x2c"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x2a"  "\x6f"  "\x75"  "\x74"  "\x2c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x64"  "\x74"  "\x2c"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x5f"  "\x69"  "\x6e"  "\x66"  "\x6f"  "\x20"  "\x67"  "\x69"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x73"  "\x74"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x67"  "\x6c"  "\x6f"  "\x62"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x64"  "\x28"  "\x30"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x73"  "\x74"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x67"  "\x6c"  "\x6f"  "\x62"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x64"  "\x28"  "\x31"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x73"  "\x74"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x61"  "\x63"  "\x74"  "\x69"  "\x76"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x26"  "\x26"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x73"  "\x74"  "\x20"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x20"  "\x69"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x29"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2a"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x20"  "\x2b"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x21"  "\x61"  "\x63"  "\x74"  "\x69"  "\x76"  "\x65"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x65"  "\x74"  "\x65"  "\x72"  "\x73"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x73"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x20"  "\x3d"  "\x20"  "\x6d"  "\x30"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x64"  "\x6d"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x75"  "\x62"  "\x28"  "\x6d"  "\x31"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x61"  "\x70"  "\x70"  "\x6c"  "\x79"  "\x5f"  "\x70"  "\x62"  "\x63"  "\x28"  "\x6d"  "\x30"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x70"  "\x62"  "\x63"  "\x2c"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x2d"  "\x20"  "\x31"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x20"  "\x3d"  "\x20"  "\x61"  "\x70"  "\x70"  "\x6c"  "\x79"  "\x5f"  "\x70"  "\x62"  "\x63"  "\x28"  "\x6d"  "\x30"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x70"  "\x62"  "\x63"  "\x2c"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x2b"  "\x20"  "\x31"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x75"  "\x70"  "\x20"  "\x3d"  "\x20"  "\x61"  "\x70"  "\x70"  "\x6c"  "\x79"  "\x5f"  "\x70"  "\x62"  "\x63"  "\x28"  "\x6d"  "\x30"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x70"  "\x62"  "\x63"  "\x2c"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2b"  "\x20"  "\x31"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x20"  "\x3d"  "\x20"  "\x61"  "\x70"  "\x70"  "\x6c"  "\x79"  "\x5f"  "\x70"  "\x62"  "\x63"  "\x28"  "\x6d"  "\x30"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x70"  "\x62"  "\x63"  "\x2c"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2d"  "\x20"  "\x31"  "\x2c"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x67"  "\x69"  "\x2e"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x6f"  "\x75"  "\x74"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x20"  "\x3d"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x65"  "\x6d"  "\x65"  "\x72"  "\x67"  "\x65"  "\x6e"  "\x74"  "\x5f"  "\x65"  "\x6c"  "\x65"  "\x63"  "\x74"  "\x72"  "\x69"  "\x63"  "\x5f"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x28"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6d"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x6c"  "\x65"  "\x66"  "\x74"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x72"  "\x69"  "\x67"  "\x68"  "\x74"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x75"  "\x70"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x6e"  "\x65"  "\x69"  "\x67"  "\x68"  "\x2e"  "\x64"  "\x6f"  "\x77"  "\x6e"  "\x2c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x73"  "\x63"  "\x61"  "\x6c"  "\x61"  "\x72"  "\x28"  "\x64"  "\x6d"  "\x2c"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x20"  "\x2f"  "\x20"  "\x64"  "\x74"  "\x29"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x29"  "\x2c"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x20"  "\x2a"  "\x20"  "\x70"  "\x61"  "\x72"  "\x61"  "\x6d"  "\x2e"  "\x67"  "\x73"  "\x2e"  "\x6c"  "\x61"  "\x74"  "\x74"  "\x69"  "\x63"  "\x65"  "\x29"  "\x3b"  "\x0a"  "\x7d"  "\x0a"  "\x0a"  "\x6b"  "\x65"  "\x72"  "\x6e"  "\x65"  "\x6c"  "\x20"  "\x76"  "\x6f"  "\x69"  "\x64"  "\x20"  "\x72"  "\x65"  "\x6e"  "\x64"  "\x65"  "\x72"  "\x5f"  "\x65"  "\x6c"  "\x65"  "\x63"  "\x74"  "\x72"  "\x69"  "\x63"  "\x28"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x2a"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x2c"  "\x20"  "\x75"  "\x6e"  "\x73"  "\x69"  "\x67"  "\x6e"  "\x65"  "\x64"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x2c"  "\x20"  "\x75"  "\x6e"  "\x73"  "\x69"  "\x67"  "\x6e"  "\x65"  "\x64"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x2c"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x2a"  "\x72"  "\x61"  "\x6e"  "\x67"  "\x65"  "\x2c"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x47"  "\x4c"  "\x4f"  "\x42"  "\x41"  "\x4c"  "\x20"  "\x52"  "\x47"  "\x42"  "\x41"  "\x33"  "\x32"  "\x20"  "\x2a"  "\x72"  "\x67"  "\x62"  "\x61"  "\x2c"  "\x20"  "\x75"  "\x6e"  "\x73"  "\x69"  "\x67"  "\x6e"  "\x65"  "\x64"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x77"  "\x69"  "\x64"  "\x74"  "\x68"  "\x2c"  "\x20"  "\x75"  "\x6e"  "\x73"  "\x69"  "\x67"  "\x6e"  "\x65"  "\x64"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x68"  "\x65"  "\x69"  "\x67"  "\x68"  "\x74"  "\x29"  "\x20"  "\x7b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x73"  "\x74"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x69"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x67"  "\x6c"  "\x6f"  "\x62"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x64"  "\x28"  "\x30"  "\x29"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x73"  "\x74"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x69"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3d"  "\x20"  "\x67"  "\x65"  "\x74"  "\x5f"  "\x67"  "\x6c"  "\x6f"  "\x62"  "\x61"  "\x6c"  "\x5f"  "\x69"  "\x64"  "\x28"  "\x31"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x69"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3e"  "\x3d"  "\x20"  "\x77"  "\x69"  "\x64"  "\x74"  "\x68"  "\x20"  "\x7c"  "\x7c"  "\x20"  "\x69"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3e"  "\x3d"  "\x20"  "\x68"  "\x65"  "\x69"  "\x67"  "\x68"  "\x74"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x63"  "\x6f"  "\x6e"  "\x73"  "\x74"  "\x20"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x20"  "\x69"  "\x64"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x29"  "\x69"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2a"  "\x20"  "\x77"  "\x69"  "\x64"  "\x74"  "\x68"  "\x20"  "\x2b"  "\x20"  "\x69"  "\x63"  "\x6f"  "\x6c"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x76"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x29"  "\x69"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x2a"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x20"  "\x2f"  "\x20"  "\x77"  "\x69"  "\x64"  "\x74"  "\x68"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x6e"  "\x74"  "\x20"  "\x76"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x73"  "\x69"  "\x7a"  "\x65"  "\x5f"  "\x74"  "\x29"  "\x69"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2a"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x2f"  "\x20"  "\x68"  "\x65"  "\x69"  "\x67"  "\x68"  "\x74"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x2f"  "\x2f"  "\x72"  "\x65"  "\x6e"  "\x64"  "\x65"  "\x72"  "\x69"  "\x6e"  "\x67"  "\x20"  "\x69"  "\x6e"  "\x76"  "\x65"  "\x72"  "\x74"  "\x73"  "\x20"  "\x74"  "\x68"  "\x65"  "\x20"  "\x67"  "\x72"  "\x69"  "\x64"  "\x2c"  "\x20"  "\x6e"  "\x65"  "\x65"  "\x64"  "\x20"  "\x74"  "\x6f"  "\x20"  "\x69"  "\x6e"  "\x76"  "\x65"  "\x72"  "\x74"  "\x20"  "\x62"  "\x61"  "\x63"  "\x6b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3d"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x2d"  "\x20"  "\x31"  "\x20"  "\x2d"  "\x20"  "\x76"  "\x72"  "\x6f"  "\x77"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x69"  "\x66"  "\x20"  "\x28"  "\x76"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x3e"  "\x3d"  "\x20"  "\x72"  "\x6f"  "\x77"  "\x73"  "\x20"  "\x7c"  "\x7c"  "\x20"  "\x76"  "\x63"  "\x6f"  "\x6c"  "\x20"  "\x3e"  "\x3d"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x29"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x65"  "\x74"  "\x75"  "\x72"  "\x6e"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x76"  "\x33"  "\x64"  "\x20"  "\x66"  "\x20"  "\x3d"  "\x20"  "\x66"  "\x69"  "\x65"  "\x6c"  "\x64"  "\x5b"  "\x76"  "\x72"  "\x6f"  "\x77"  "\x20"  "\x2a"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x73"  "\x20"  "\x2b"  "\x20"  "\x76"  "\x63"  "\x6f"  "\x6c"  "\x5d"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x64"  "\x6f"  "\x75"  "\x62"  "\x6c"  "\x65"  "\x20"  "\x61"  "\x6e"  "\x67"  "\x6c"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x61"  "\x74"  "\x61"  "\x6e"  "\x32"  "\x28"  "\x66"  "\x2e"  "\x79"  "\x2c"  "\x20"  "\x66"  "\x2e"  "\x78"  "\x29"  "\x20"  "\x2f"  "\x20"  "\x4d"  "\x5f"  "\x50"  "\x49"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x61"  "\x6e"  "\x67"  "\x6c"  "\x65"  "\x20"  "\x3d"  "\x20"  "\x28"  "\x61"  "\x6e"  "\x67"  "\x6c"  "\x65"  "\x20"  "\x2b"  "\x20"  "\x31"  "\x2e"  "\x30"  "\x29"  "\x20"  "\x2f"  "\x20"  "\x32"  "\x2e"  "\x30"  "\x3b"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x52"  "\x47"  "\x42"  "\x41"  "\x33"  "\x32"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x6f"  "\x72"  "\x20"  "\x3d"  "\x20"  "\x68"  "\x73"  "\x6c"  "\x5f"  "\x74"  "\x6f"  "\x5f"  "\x72"  "\x67"  "\x62"  "\x28"  "\x61"  "\x6e"  "\x67"  "\x6c"  "\x65"  "\x2c"  "\x20"  "\x73"  "\x71"  "\x72"  "\x74"  "\x28"  "\x76"  "\x33"  "\x64"  "\x5f"  "\x64"  "\x6f"  "\x74"  "\x28"  "\x66"  "\x2c"  "\x20"  "\x66"  "\x29"  "\x29"  "\x20"  "\x2f"  "\x20"  "\x72"  "\x61"  "\x6e"  "\x67"  "\x65"  "\x5b"  "\x31"  "\x5d"  "\x2c"  "\x20"  "\x30"  "\x2e"  "\x35"  "\x29"  "\x3b"  "\x0a"  "\x0a"  "\x20"  "\x20"  "\x20"  "\x20"  "\x72"  "\x67"  "\x62"  "\x61"  "\x5b"  "\x69"  "\x64"  "\x5d"  "\x20"  "\x3d"  "\x20"  "\x63"  "\x6f"  "\x6c"  "\x6f"  "\x72"  "\x3b"  "\x0a"  "\x7d"  "\x0a" ;
\ No newline at end of file
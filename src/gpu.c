@@ -12,6 +12,8 @@ static_assert(sizeof(cl_char4) == sizeof(uint32_t), "Size of cl_char4 is not the
 uint64_t p_id = 0;
 uint64_t d_id = 0;
 uint64_t gpu_optimal_wg = 32; //TODO: change to 64 on amd?
+uint64_t gpu_optimal_tile[2] = {16, 16}; //{cols, rows}, used by 2D launches when gpu_autotune is off
+uint64_t gpu_cpu_subdevices = 0; //CPU devices are split into this many sub-devices when above 1, for slab runs
 
 static const char *errors[60] = {"CL_SUCCESS",
                                  "CL_DEVICE_NOT_FOUND",
@@ -80,6 +82,15 @@ const char *gpu_cl_get_str_error(cl_int err) {
     return errors[err_];
 }
 
+//FNV-1a, only needs to tell apart builds of the kernel
+static uint64_t gpu_cl_hash(uint64_t h, const char *str) {
+    for (; *str; ++str) {
+        h ^= (unsigned char)*str;
+        h *= 0x100000001b3ULL;
+    }
+    return h;
+}
+
 INCEPTION("Compile OPT is assumed to be storing a null terminated string")
 static void gpu_cl_compile_source(gpu_cl *gpu, const char *source, const char *compile_opt) {
     cl_int err;
@@ -159,11 +170,40 @@ static void gpu_cl_get_devices(gpu_cl *gpu) {
     if ((err = clGetDeviceIDs(gpu->platforms[p_id], CL_DEVICE_TYPE_ALL, 0, NULL, &nn)) != CL_SUCCESS)
         logging_log(LOG_FATAL, "Could not find number of devices %d: %s", err, gpu_cl_get_str_error(err));
     gpu->n_devices = nn;
+    gpu->n_root_devices = nn;
 
     gpu->devices = mmalloc(sizeof(cl_device_id) * nn);
     if ((err = clGetDeviceIDs(gpu->platforms[p_id], CL_DEVICE_TYPE_ALL, nn, gpu->devices, NULL)) != CL_SUCCESS)
         logging_log(LOG_FATAL, "Could not initialize devices %d: %s", err, gpu_cl_get_str_error(err));
 
+    //sub-devices go after the root devices, so d_id keeps pointing at the same device
+    for (uint64_t i = 0; i < nn && gpu_cpu_subdevices > 1; ++i) {
+        cl_device_type type;
+        cl_uint units;
+        if ((err = clGetDeviceInfo(gpu->devices[i], CL_DEVICE_TYPE, sizeof(type), &type, NULL)) != CL_SUCCESS)
+            logging_log(LOG_FATAL, "Could not get type of device %"PRIu64" %d: %s", i, err, gpu_cl_get_str_error(err));
+        if (!(type & CL_DEVICE_TYPE_CPU))
+            continue;
+        if ((err = clGetDeviceInfo(gpu->devices[i], CL_DEVICE_MAX_COMPUTE_UNITS, sizeof(units), &units, NULL)) != CL_SUCCESS)
+            logging_log(LOG_FATAL, "Could not get compute units of device %"PRIu64" %d: %s", i, err, gpu_cl_get_str_error(err));
+        if (units / gpu_cpu_subdevices == 0) {
+            logging_log(LOG_WARNING, "Device %"PRIu64" has %u compute units, can not split it in %"PRIu64, i, units, gpu_cpu_subdevices);
+            continue;
+        }
+
+        cl_device_partition_property props[] = {CL_DEVICE_PARTITION_EQUALLY, units / gpu_cpu_subdevices, 0};
+        cl_uint n_sub;
+        if ((err = clCreateSubDevices(gpu->devices[i], props, 0, NULL, &n_sub)) != CL_SUCCESS) {
+            logging_log(LOG_WARNING, "Could not partition device %"PRIu64" %d: %s", i, err, gpu_cl_get_str_error(err));
+            continue;
+        }
+        gpu->devices = mrealloc(gpu->devices, sizeof(cl_device_id) * (gpu->n_devices + n_sub));
+        if ((err = clCreateSubDevices(gpu->devices[i], props, n_sub, gpu->devices + gpu->n_devices, NULL)) != CL_SUCCESS)
+            logging_log(LOG_FATAL, "Could not create sub-devices of device %"PRIu64" %d: %s", i, err, gpu_cl_get_str_error(err));
+        logging_log(LOG_INFO, "Split device %"PRIu64" in %u sub-devices as devices %"PRIu64"-%"PRIu64, i, n_sub, gpu->n_devices, gpu->n_devices + n_sub - 1);
+        gpu->n_devices += n_sub;
+    }
+
     logging_log(LOG_INFO, "Initialized %"PRIu64" devices", gpu->n_devices);
 }
 
@@ -297,71 +337,179 @@ static void gpu_cl_init_context(gpu_cl *gpu) {
     logging_log(LOG_INFO, "Created context on GPU");
 }
 
-static void gpu_cl_init_queue(gpu_cl *gpu) {
+cl_command_queue gpu_cl_create_queue(gpu_cl *gpu, cl_device_id device) {
     cl_int err;
+    cl_command_queue queue;
 #ifdef _WIN32
-    gpu->queue = clCreateCommandQueue(gpu->ctx, gpu->devices[d_id], CL_QUEUE_PROFILING_ENABLE, &err);
+    queue = clCreateCommandQueue(gpu->ctx, device, CL_QUEUE_PROFILING_ENABLE, &err);
 #else
     cl_command_queue_properties properties[] = {
         CL_QUEUE_PROPERTIES, CL_QUEUE_PROFILING_ENABLE,
         0
     };
-    gpu->queue = clCreateCommandQueueWithProperties(gpu->ctx, gpu->devices[d_id], properties, &err);
+    queue = clCreateCommandQueueWithProperties(gpu->ctx, device, properties, &err);
 #endif
     if (err != CL_SUCCESS)
         logging_log(LOG_FATAL, "Could not create command queue with profiling properties");
     logging_log(LOG_INFO, "Created command queue on GPU");
+    return queue;
 }
 
+void gpu_cl_release_queue(cl_command_queue queue) {
+    cl_int err;
+    if ((err = clReleaseCommandQueue(queue)) != CL_SUCCESS)
+        logging_log(LOG_FATAL, "Could not release command queue %d: %s", err, gpu_cl_get_str_error(err));
+}
+
+static void gpu_cl_init_queue(gpu_cl *gpu) {
+    gpu->queue_device = gpu->devices[d_id];
+    gpu->queue = gpu_cl_create_queue(gpu, gpu->queue_device);
+}
+
+//Without a grid to look at, cubic anisotropy is always compiled in
 gpu_cl gpu_cl_init(const char *current_function, const char *field_func, const char *temperature_func, const char *kernel_augment, const char *compile_augment) {
-    gpu_cl ret = {0};
-    gpu_cl_get_platforms(&ret);
-    p_id = p_id % ret.n_platforms;
+    return gpu_cl_init_terms(current_function, field_func, temperature_func, kernel_augment, compile_augment, KERNEL_TERM_CUBIC);
+}
+
+//platforms, devices, context and queue, everything but the program
+static void gpu_cl_open_device(gpu_cl *gpu) {
+    gpu_cl_get_platforms(gpu);
+    p_id = p_id % gpu->n_platforms;
 
-    for (uint64_t i = 0; i < ret.n_platforms; ++i)
-        gpu_cl_get_platform_info(ret.platforms[i], i);
+    for (uint64_t i = 0; i < gpu->n_platforms; ++i)
+        gpu_cl_get_platform_info(gpu->platforms[i], i);
 
-    gpu_cl_get_devices(&ret);
-    d_id = d_id % ret.n_devices;
-    for (uint64_t i = 0; i < ret.n_devices; ++i)
-        gpu_cl_get_device_info(ret.devices[i], i);
+    gpu_cl_get_devices(gpu);
+    d_id = d_id % gpu->n_devices;
+    for (uint64_t i = 0; i < gpu->n_devices; ++i)
+        gpu_cl_get_device_info(gpu->devices[i], i);
+
+    gpu_cl_init_context(gpu);
+    gpu_cl_init_queue(gpu);
+}
+
+static void gpu_cl_close_device(gpu_cl *gpu) {
+    cl_int err;
+    if ((err = clReleaseCommandQueue(gpu->queue)) != CL_SUCCESS)
+        logging_log(LOG_FATAL, "Could not release command queue");
 
-    gpu_cl_init_context(&ret);
-    gpu_cl_init_queue(&ret);
+    if ((err = clReleaseContext(gpu->ctx)) != CL_SUCCESS)
+        logging_log(LOG_FATAL, "Could not release context");
+
+    //root devices are not reference counted, the sub-devices are owned by us
+    for (uint64_t i = gpu->n_root_devices; i < gpu->n_devices; ++i)
+        if ((err = clReleaseDevice(gpu->devices[i])) != CL_SUCCESS)
+            logging_log(LOG_FATAL, "Could not release sub-device %"PRIu64" %d: %s", i, err, gpu_cl_get_str_error(err));
+    if (gpu->n_devices > gpu->n_root_devices)
+        logging_log(LOG_INFO, "Released %"PRIu64" sub-devices", gpu->n_devices - gpu->n_root_devices);
+
+    mfree(gpu->devices);
+    mfree(gpu->platforms);
+}
 
+//compiles only when session has no program with the same hash, session may be NULL
+static void gpu_cl_build_program(gpu_cl *gpu, gpu_session *session, const char *current_function, const char *field_func, const char *temperature_func, const char *kernel_augment, const char *compile_augment, uint64_t grid_terms) {
     const char *cmp = "-DOPENCL_COMPILATION";
-    char *kernel = fill_functions_on_kernel(current_function, field_func, temperature_func, kernel_augment);
+    char *kernel = fill_functions_on_kernel(current_function, field_func, temperature_func, kernel_augment, grid_terms);
     char *compile = fill_compilation_params(cmp, compile_augment);
-    gpu_cl_compile_source(&ret, kernel, compile);
+    gpu->program_hash = gpu_cl_hash(gpu_cl_hash(0xcbf29ce484222325ULL, kernel), compile);
+    gpu->dipolar = (compile_augment && strstr(compile_augment, "INCLUDE_DIPOLAR")) || (kernel_augment && strstr(kernel_augment, "INCLUDE_DIPOLAR"));
+
+    uint64_t i = 0;
+    for (; session && i < session->n_programs; ++i)
+        if (session->program_hashes[i] == gpu->program_hash)
+            break;
+
+    if (session && i < session->n_programs) {
+        gpu->program = session->programs[i];
+        logging_log(LOG_INFO, "Reusing OpenCL program %016"PRIx64" of the session", gpu->program_hash);
+    } else {
+        gpu_cl_compile_source(gpu, kernel, compile);
+        if (session) {
+            session->programs = mrealloc(session->programs, sizeof(*session->programs) * (session->n_programs + 1));
+            session->program_hashes = mrealloc(session->program_hashes, sizeof(*session->program_hashes) * (session->n_programs + 1));
+            session->programs[session->n_programs] = gpu->program;
+            session->program_hashes[session->n_programs] = gpu->program_hash;
+            ++session->n_programs;
+        }
+    }
 
     mfree(kernel);
     mfree(compile);
+}
+
+gpu_cl gpu_cl_init_terms(const char *current_function, const char *field_func, const char *temperature_func, const char *kernel_augment, const char *compile_augment, uint64_t grid_terms) {
+    gpu_cl ret = {0};
+    gpu_cl_open_device(&ret);
+#ifdef PROFILING
+    ret.profiler = gpu_profiler_init();
+#endif
+    gpu_cl_build_program(&ret, NULL, current_function, field_func, temperature_func, kernel_augment, compile_augment, grid_terms);
+    return ret;
+}
 
+gpu_session gpu_session_open(void) {
+    gpu_session ret = {0};
+    gpu_cl_open_device(&ret.base);
+    ret.pool = gpu_pool_init(ret.base.ctx, ret.base.queue);
+    return ret;
+}
+
+void gpu_session_close(gpu_session *session) {
+    cl_int err;
+    if (session->borrowed)
+        logging_log(LOG_WARNING, "Closing a session with %"PRIu64" gpu_cl still borrowed", session->borrowed);
+
+    for (uint64_t i = 0; i < session->n_programs; ++i)
+        if ((err = clReleaseProgram(session->programs[i])) != CL_SUCCESS)
+            logging_log(LOG_FATAL, "Could not release program %016"PRIx64" %d: %s", session->program_hashes[i], err, gpu_cl_get_str_error(err));
+    mfree(session->programs);
+    mfree(session->program_hashes);
+
+    gpu_pool_free(session->pool);
+    gpu_cl_close_device(&session->base);
+    memset(session, 0, sizeof(*session));
+}
+
+gpu_cl gpu_session_borrow(gpu_session *session, const char *current_function, const char *field_func, const char *temperature_func, const char *kernel_augment, const char *compile_augment, uint64_t grid_terms) {
+    if (!session)
+        return gpu_cl_init_terms(current_function, field_func, temperature_func, kernel_augment, compile_augment, grid_terms);
+
+    gpu_cl ret = session->base;
+    ret.session = session;
+#ifdef PROFILING
+    ret.profiler = gpu_profiler_init();
+#endif
+    gpu_cl_build_program(&ret, session, current_function, field_func, temperature_func, kernel_augment, compile_augment, grid_terms);
+    ++session->borrowed;
     return ret;
 }
 
 void gpu_cl_close(gpu_cl *gpu) {
     cl_int err;
+    if (gpu->profiler) {
+        gpu_profiler_free(gpu->profiler);
+        gpu->profiler = NULL;
+    }
+
     for (uint64_t i = 0; i < gpu->n_kernels; ++i)
         if ((err = clReleaseKernel(gpu->kernels[i].kernel)) != CL_SUCCESS)
             logging_log(LOG_FATAL, "Could not release kernel \"%s\" %d: %s", gpu->kernels[i].name, err, gpu_cl_get_str_error(err));
     mfree(gpu->kernels);
 
+    //the program, queue and context stay with the session for the next run
+    if (gpu->session) {
+        if ((err = clFinish(gpu->queue)) != CL_SUCCESS)
+            logging_log(LOG_FATAL, "Could not finish the session queue %d: %s", err, gpu_cl_get_str_error(err));
+        --gpu->session->borrowed;
+        memset(gpu, 0, sizeof(*gpu));
+        return;
+    }
+
     if ((err = clReleaseProgram(gpu->program)) != CL_SUCCESS)
         logging_log(LOG_FATAL, "Could not release program");
 
-    if ((err = clReleaseCommandQueue(gpu->queue)) != CL_SUCCESS)
-        logging_log(LOG_FATAL, "Could not release command queue");
-
-    if ((err = clReleaseContext(gpu->ctx)) != CL_SUCCESS)
-        logging_log(LOG_FATAL, "Could not release context");
-
-    for (uint64_t i = 0; i < gpu->n_devices; ++i)
-        if ((err = clReleaseDevice(gpu->devices[i])) != CL_SUCCESS)
-            logging_log(LOG_FATAL, "Could not release device %zu", i);
-
-    mfree(gpu->devices);
-    mfree(gpu->platforms);
+    gpu_cl_close_device(gpu);
     memset(gpu, 0, sizeof(*gpu));
 }
 
@@ -375,6 +523,9 @@ uint64_t gpu_cl_append_kernel(gpu_cl *gpu, const char *kernel) {
     gpu->kernels = mrealloc(gpu->kernels, sizeof(*gpu->kernels) * (gpu->n_kernels + 1));
     gpu->kernels[gpu->n_kernels].name = kernel;
     gpu->kernels[gpu->n_kernels].kernel = temp;
+    memset(gpu->kernels[gpu->n_kernels].local, 0, sizeof(gpu->kernels[gpu->n_kernels].local));
+    memset(gpu->kernels[gpu->n_kernels].global, 0, sizeof(gpu->kernels[gpu->n_kernels].global));
+    memset(gpu->kernels[gpu->n_kernels].tuned_items, 0, sizeof(gpu->kernels[gpu->n_kernels].tuned_items));
     uint64_t index = gpu->n_kernels;
     ++gpu->n_kernels;
     return index;
@@ -393,27 +544,14 @@ void gpu_cl_fill_kernel_args(gpu_cl *gpu, uint64_t kernel, uint64_t offset, uint
     va_end(arg_list);
 }
 
+//events are resolved lazily by the profiler so the queue keeps running ahead of the host
 void gpu_cl_enqueue_nd_profiling(gpu_cl *gpu, uint64_t kernel, uint64_t n_dim, uint64_t *local, uint64_t *global, uint64_t *offset) {
     cl_event ev;
     cl_int err;
     if ((err = clEnqueueNDRangeKernel(gpu->queue, gpu->kernels[kernel].kernel, n_dim, offset, global, local, 0, NULL, &ev)) != CL_SUCCESS)
         logging_log(LOG_FATAL, "Could not enqueue kernel \"%s\" %d: %s", gpu->kernels[kernel].name, err, gpu_cl_get_str_error(err));
 
-    uint64_t start, end, duration;
-    uint64_t size;
-    if ((err = clWaitForEvents(1, &ev)) != CL_SUCCESS)
-        logging_log(LOG_FATAL, "Could not wait for kernel \"%s\" event %d: %s", gpu->kernels[kernel].name, err, gpu_cl_get_str_error(err));
-
-    if ((err = clGetEventProfilingInfo(ev, CL_PROFILING_COMMAND_START, sizeof(start), &start, &size)) != CL_SUCCESS)
-        logging_log(LOG_FATAL, "Could not get command start for kernel \"%s\" %d: %s", gpu->kernels[kernel].name, err, gpu_cl_get_str_error(err));
-
-    if ((err = clGetEventProfilingInfo(ev, CL_PROFILING_COMMAND_END, sizeof(end), &end, &size)) != CL_SUCCESS)
-        logging_log(LOG_FATAL, "Could not get command end for kernel \"%s\" %d: %s", gpu->kernels[kernel].name, err, gpu_cl_get_str_error(err));
-
-    duration = end - start;
-    fprintf(stdout, "%s: %e us\n", gpu->kernels[kernel].name, (double)duration / 1000.0);
-    if ((err = clReleaseEvent(ev)) != CL_SUCCESS)
-        logging_log(LOG_FATAL, "Could not release event for kernel \"%s\" %d: %s", gpu->kernels[kernel].name, err, gpu_cl_get_str_error(err));
+    gpu_profiler_push(gpu->profiler, ev, gpu->kernels[kernel].name);
 }
 
 void gpu_cl_enqueue_nd_no_profiling(gpu_cl *gpu, uint64_t kernel, uint64_t n_dim, uint64_t *local, uint64_t *global, uint64_t *offset) {
@@ -423,6 +561,9 @@ void gpu_cl_enqueue_nd_no_profiling(gpu_cl *gpu, uint64_t kernel, uint64_t n_dim
 }
 
 cl_mem gpu_cl_create_gpu_base(gpu_cl *gpu, uint64_t size, cl_mem_flags flags, const char *file, int line) {
+    if (gpu->session)
+        return gpu_pool_acquire(gpu->session->pool, size, flags, file, line);
+
     cl_int err;
     cl_mem ret = clCreateBuffer(gpu->ctx, flags, size, NULL, &err);
     if (err != CL_SUCCESS)
@@ -444,12 +585,127 @@ void gpu_cl_read_gpu_base(gpu_cl *gpu, uint64_t size, uint64_t offset, void *hos
         logging_log(LOG_FATAL, "%s:%d Could not read from GPU buffer \"%s\" %d: %s", file, line, name, err, gpu_cl_get_str_error(err));
 }
 
+void gpu_cl_read_gpu_async_base(gpu_cl *gpu, uint64_t size, uint64_t offset, void *host, cl_mem device, cl_event *ev, const char *name, const char *file, int line) {
+    gpu_cl_read_gpu_after_base(gpu, size, offset, host, device, 0, NULL, ev, name, file, line);
+}
+
+void gpu_cl_read_gpu_after_base(gpu_cl *gpu, uint64_t size, uint64_t offset, void *host, cl_mem device, uint64_t n_wait, cl_event *wait, cl_event *ev, const char *name, const char *file, int line) {
+    cl_int err = clEnqueueReadBuffer(gpu->queue, device, CL_FALSE, offset, size, host, n_wait, n_wait? wait: NULL, ev);
+    if (err != CL_SUCCESS)
+        logging_log(LOG_FATAL, "%s:%d Could not read from GPU buffer \"%s\" %d: %s", file, line, name, err, gpu_cl_get_str_error(err));
+}
+
+//blocking when ev is NULL, otherwise the pointer is only valid once ev completed
+void *gpu_cl_map_gpu_base(gpu_cl *gpu, uint64_t size, uint64_t offset, cl_mem device, cl_map_flags flags, uint64_t n_wait, cl_event *wait, cl_event *ev, const char *name, const char *file, int line) {
+    cl_int err;
+    void *ret = clEnqueueMapBuffer(gpu->queue, device, ev? CL_FALSE: CL_TRUE, flags, offset, size, n_wait, n_wait? wait: NULL, ev, &err);
+    if (err != CL_SUCCESS)
+        logging_log(LOG_FATAL, "%s:%d Could not map GPU buffer \"%s\" %d: %s", file, line, name, err, gpu_cl_get_str_error(err));
+    return ret;
+}
+
+void gpu_cl_unmap_gpu_base(gpu_cl *gpu, cl_mem device, void *host, const char *name, const char *file, int line) {
+    cl_int err = clEnqueueUnmapMemObject(gpu->queue, device, host, 0, NULL, NULL);
+    if (err != CL_SUCCESS)
+        logging_log(LOG_FATAL, "%s:%d Could not unmap GPU buffer \"%s\" %d: %s", file, line, name, err, gpu_cl_get_str_error(err));
+}
+
+//CPU runtimes and integrated GPUs, where mapping a buffer allocated with CL_MEM_ALLOC_HOST_PTR costs nothing
+bool gpu_cl_unified_memory(gpu_cl *gpu) {
+    cl_int err;
+    cl_device_type type;
+    cl_bool unified = CL_FALSE;
+    if ((err = clGetDeviceInfo(gpu->queue_device, CL_DEVICE_TYPE, sizeof(type), &type, NULL)) != CL_SUCCESS)
+        logging_log(LOG_FATAL, "Could not get device type %d: %s", err, gpu_cl_get_str_error(err));
+    //deprecated since 2.0 but still answered, a failure only means a copy where a map would do
+    if (clGetDeviceInfo(gpu->queue_device, CL_DEVICE_HOST_UNIFIED_MEMORY, sizeof(unified), &unified, NULL) != CL_SUCCESS)
+        unified = CL_FALSE;
+    return (type & CL_DEVICE_TYPE_CPU) || unified;
+}
+
+void gpu_cl_copy_gpu_offset_base(gpu_cl *gpu, uint64_t size, cl_mem src, uint64_t src_offset, cl_mem dst, uint64_t dst_offset, const char *name, const char *file, int line) {
+    cl_int err = clEnqueueCopyBuffer(gpu->queue, src, dst, src_offset, dst_offset, size, 0, NULL, NULL);
+    if (err != CL_SUCCESS)
+        logging_log(LOG_FATAL, "%s:%d Could not copy GPU buffer \"%s\" %d: %s", file, line, name, err, gpu_cl_get_str_error(err));
+}
+
+void gpu_cl_enqueue_marker(gpu_cl *gpu, cl_event *ev) {
+    cl_int err;
+    if ((err = clEnqueueMarkerWithWaitList(gpu->queue, 0, NULL, ev)) != CL_SUCCESS)
+        logging_log(LOG_FATAL, "Could not enqueue marker %d: %s", err, gpu_cl_get_str_error(err));
+}
+
+void gpu_cl_write_gpu_async_base(gpu_cl *gpu, uint64_t size, uint64_t offset, void *host, cl_mem device, cl_event *ev, const char *name, const char *file, int line) {
+    cl_int err = clEnqueueWriteBuffer(gpu->queue, device, CL_FALSE, offset, size, host, 0, NULL, ev);
+    if (err != CL_SUCCESS)
+        logging_log(LOG_FATAL, "%s:%d Could not write to GPU buffer \"%s\" %d: %s", file, line, name, err, gpu_cl_get_str_error(err));
+}
+
+void gpu_cl_read_gpu_rect_base(gpu_cl *gpu, uint64_t width, uint64_t height, uint64_t x, uint64_t y, uint64_t pitch, void *host, cl_mem device, const char *name, const char *file, int line) {
+    size_t buffer_origin[3] = {x, y, 0};
+    size_t host_origin[3] = {0, 0, 0};
+    size_t region[3] = {width, height, 1};
+    cl_int err = clEnqueueReadBufferRect(gpu->queue, device, CL_TRUE, buffer_origin, host_origin, region, pitch, 0, width, 0, host, 0, NULL, NULL);
+    if (err != CL_SUCCESS)
+        logging_log(LOG_FATAL, "%s:%d Could not read from GPU buffer \"%s\" %d: %s", file, line, name, err, gpu_cl_get_str_error(err));
+}
+
+void gpu_cl_write_gpu_rect_base(gpu_cl *gpu, uint64_t width, uint64_t height, uint64_t x, uint64_t y, uint64_t pitch, void *host, cl_mem device, const char *name, const char *file, int line) {
+    size_t buffer_origin[3] = {x, y, 0};
+    size_t host_origin[3] = {0, 0, 0};
+    size_t region[3] = {width, height, 1};
+    cl_int err = clEnqueueWriteBufferRect(gpu->queue, device, CL_TRUE, buffer_origin, host_origin, region, pitch, 0, width, 0, host, 0, NULL, NULL);
+    if (err != CL_SUCCESS)
+        logging_log(LOG_FATAL, "%s:%d Could not write to GPU buffer \"%s\" %d: %s", file, line, name, err, gpu_cl_get_str_error(err));
+}
+
+//for launches that depend on work of another queue, the events may come from any queue of the context
+void gpu_cl_enqueue_nd_wait(gpu_cl *gpu, uint64_t kernel, uint64_t n_dim, uint64_t *local, uint64_t *global, uint64_t *offset, uint64_t n_wait, cl_event *wait) {
+    cl_event ev;
+    cl_int err;
+    if ((err = clEnqueueNDRangeKernel(gpu->queue, gpu->kernels[kernel].kernel, n_dim, offset, global, local, n_wait, n_wait? wait: NULL, gpu->profiler? &ev: NULL)) != CL_SUCCESS)
+        logging_log(LOG_FATAL, "Could not enqueue kernel \"%s\" %d: %s", gpu->kernels[kernel].name, err, gpu_cl_get_str_error(err));
+
+    if (gpu->profiler)
+        gpu_profiler_push(gpu->profiler, ev, gpu->kernels[kernel].name);
+}
+
+//waits and releases the events
+void gpu_cl_wait_events(uint64_t n, cl_event *events) {
+    cl_int err;
+    if (n == 0)
+        return;
+    if ((err = clWaitForEvents(n, events)) != CL_SUCCESS)
+        logging_log(LOG_FATAL, "Could not wait for %"PRIu64" events %d: %s", n, err, gpu_cl_get_str_error(err));
+    for (uint64_t i = 0; i < n; ++i)
+        if ((err = clReleaseEvent(events[i])) != CL_SUCCESS)
+            logging_log(LOG_FATAL, "Could not release event %d: %s", err, gpu_cl_get_str_error(err));
+}
+
 void gpu_cl_set_kernel_arg(gpu_cl *gpu, uint64_t kernel, uint64_t index, uint64_t size, void *data) {
     cl_int err = clSetKernelArg(gpu->kernels[kernel].kernel, index, size, data);
     if (err != CL_SUCCESS)
         logging_log(LOG_FATAL, "Could not set argument %d of kernel \"%s\" %d: %s", (int)index, gpu->kernels[kernel].name, err, gpu_cl_get_str_error(err));
 }
 
+void gpu_cl_finish(gpu_cl *gpu) {
+    cl_int err = clFinish(gpu->queue);
+    if (err != CL_SUCCESS)
+        logging_log(LOG_FATAL, "Could not finish command queue %d: %s", err, gpu_cl_get_str_error(err));
+}
+
+void gpu_cl_flush(gpu_cl *gpu) {
+    cl_int err = clFlush(gpu->queue);
+    if (err != CL_SUCCESS)
+        logging_log(LOG_FATAL, "Could not flush command queue %d: %s", err, gpu_cl_get_str_error(err));
+}
+
+void gpu_cl_release_event(cl_event ev) {
+    cl_int err = clReleaseEvent(ev);
+    if (err != CL_SUCCESS)
+        logging_log(LOG_FATAL, "Could not release event %d: %s", err, gpu_cl_get_str_error(err));
+}
+
 uint64_t gpu_cl_gcd(uint64_t a, uint64_t b) {
     if (b == 0)
         return a;
@@ -458,6 +714,9 @@ uint64_t gpu_cl_gcd(uint64_t a, uint64_t b) {
 }
 
 void gpu_cl_release_memory_base(cl_mem mem, const char *name, const char *file, int line) {
+    if (gpu_pool_release(mem, name, file, line))
+        return;
+
     cl_int err = clReleaseMemObject(mem);
     if (err != CL_SUCCESS)
         logging_log(LOG_FATAL, "%s:%d Could not release memory buffer \"%s\" from GPU %d: %s", file, line, name, err, gpu_cl_get_str_error(err));
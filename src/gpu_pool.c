@@ -0,0 +1,170 @@
+#include "gpu_pool.h"
+#include "allocator.h"
+#include "logging.h"
+#include "render.h"
+
+#include <inttypes.h>
+#include <string.h>
+
+bool gpu_pool_poison = false;
+
+//gpu_cl_release_memory only gets the cl_mem, so the pools are found through here.
+//the lock guards the registry and every pool in it, the viewers allocate from their simulation and render threads
+static gpu_pool **gpu_pools = NULL;
+static uint64_t gpu_n_pools = 0;
+static render_lock gpu_pools_lock = RENDER_LOCK_INIT;
+
+uint64_t gpu_pool_size_class(uint64_t size) {
+    if (size <= GPU_POOL_MIN_CLASS)
+        return GPU_POOL_MIN_CLASS;
+    uint64_t p = GPU_POOL_MIN_CLASS;
+    while (p * 2 < size)
+        p *= 2;
+    uint64_t step = p / GPU_POOL_CLASS_STEPS;
+    return (size + step - 1) / step * step;
+}
+
+gpu_pool *gpu_pool_init(cl_context ctx, cl_command_queue queue) {
+    gpu_pool *pool = mmalloc(sizeof(*pool));
+    memset(pool, 0, sizeof(*pool));
+    pool->ctx = ctx;
+    pool->queue = queue;
+
+    render_lock_acquire(&gpu_pools_lock);
+    gpu_pools = mrealloc(gpu_pools, sizeof(*gpu_pools) * (gpu_n_pools + 1));
+    gpu_pools[gpu_n_pools++] = pool;
+    render_lock_release(&gpu_pools_lock);
+    return pool;
+}
+
+static void gpu_pool_release_buffer(gpu_pool_buffer *b) {
+    cl_int err;
+    if ((err = clReleaseMemObject(b->mem)) != CL_SUCCESS)
+        logging_log(LOG_FATAL, "Could not release pooled buffer of %"PRIu64" bytes %d", b->size, err);
+}
+
+static void gpu_pool_trim_locked(gpu_pool *pool) {
+    for (uint64_t i = 0; i < pool->n_free; ++i) {
+        gpu_pool_release_buffer(&pool->free[i]);
+        pool->stats.bytes_held -= pool->free[i].size;
+    }
+    pool->n_free = 0;
+}
+
+void gpu_pool_trim(gpu_pool *pool) {
+    render_lock_acquire(&gpu_pools_lock);
+    gpu_pool_trim_locked(pool);
+    render_lock_release(&gpu_pools_lock);
+}
+
+void gpu_pool_log_stats(gpu_pool *pool) {
+    gpu_pool_stats *s = &pool->stats;
+    logging_log(LOG_INFO, "Buffer pool: %"PRIu64" requests, %"PRIu64" reused (%.1f%%), %"PRIu64" created, peak %.3f MB in use, peak %.3f MB held",
+                s->requests, s->reuses, s->requests? 100.0 * s->reuses / s->requests: 0.0, s->created,
+                s->peak_bytes_in_use / 1.0e6, s->peak_bytes_held / 1.0e6);
+}
+
+void gpu_pool_free(gpu_pool *pool) {
+    render_lock_acquire(&gpu_pools_lock);
+    if (pool->n_used)
+        logging_log(LOG_WARNING, "Buffer pool closed with %"PRIu64" buffers (%.3f MB) still in use", pool->n_used, pool->stats.bytes_in_use / 1.0e6);
+    gpu_pool_log_stats(pool);
+
+    for (uint64_t i = 0; i < pool->n_used; ++i)
+        gpu_pool_release_buffer(&pool->used[i]);
+    gpu_pool_trim_locked(pool);
+    mfree(pool->used);
+    mfree(pool->free);
+
+    for (uint64_t i = 0; i < gpu_n_pools; ++i) {
+        if (gpu_pools[i] == pool) {
+            gpu_pools[i] = gpu_pools[--gpu_n_pools];
+            break;
+        }
+    }
+    if (!gpu_n_pools) {
+        mfree(gpu_pools);
+        gpu_pools = NULL;
+    }
+    render_lock_release(&gpu_pools_lock);
+    mfree(pool);
+}
+
+static void gpu_pool_push(gpu_pool_buffer **list, uint64_t *n, gpu_pool_buffer b) {
+    *list = mrealloc(*list, sizeof(**list) * (*n + 1));
+    (*list)[(*n)++] = b;
+}
+
+static void gpu_pool_note_use(gpu_pool *pool, uint64_t size) {
+    pool->stats.bytes_in_use += size;
+    if (pool->stats.bytes_in_use > pool->stats.peak_bytes_in_use)
+        pool->stats.peak_bytes_in_use = pool->stats.bytes_in_use;
+    if (pool->stats.bytes_held > pool->stats.peak_bytes_held)
+        pool->stats.peak_bytes_held = pool->stats.bytes_held;
+}
+
+cl_mem gpu_pool_acquire(gpu_pool *pool, uint64_t size, cl_mem_flags flags, const char *file, int line) {
+    uint64_t class = gpu_pool_size_class(size);
+    render_lock_acquire(&gpu_pools_lock);
+    pool->stats.requests++;
+
+    for (uint64_t i = 0; i < pool->n_free; ++i) {
+        if (pool->free[i].size != class || pool->free[i].flags != flags)
+            continue;
+        gpu_pool_buffer b = pool->free[i];
+        pool->free[i] = pool->free[--pool->n_free];
+        gpu_pool_push(&pool->used, &pool->n_used, b);
+        pool->stats.reuses++;
+        gpu_pool_note_use(pool, class);
+        render_lock_release(&gpu_pools_lock);
+        return b.mem;
+    }
+
+    cl_int err;
+    cl_mem mem = clCreateBuffer(pool->ctx, flags, class, NULL, &err);
+    //buffers of other sizes waiting in the pool may be what is missing
+    if ((err == CL_MEM_OBJECT_ALLOCATION_FAILURE || err == CL_OUT_OF_RESOURCES) && pool->n_free) {
+        logging_log(LOG_WARNING, "%s:%d Out of device memory for %"PRIu64" bytes, releasing %"PRIu64" pooled buffers", file, line, class, pool->n_free);
+        gpu_pool_trim_locked(pool);
+        mem = clCreateBuffer(pool->ctx, flags, class, NULL, &err);
+    }
+    if (err != CL_SUCCESS)
+        logging_log(LOG_FATAL, "%s:%d Could not create pooled buffer with size %"PRIu64" bytes %d", file, line, class, err);
+
+    gpu_pool_push(&pool->used, &pool->n_used, (gpu_pool_buffer){.mem = mem, .size = class, .flags = flags});
+    pool->stats.created++;
+    pool->stats.bytes_held += class;
+    gpu_pool_note_use(pool, class);
+    render_lock_release(&gpu_pools_lock);
+    return mem;
+}
+
+bool gpu_pool_release(cl_mem mem, const char *name, const char *file, int line) {
+    render_lock_acquire(&gpu_pools_lock);
+    for (uint64_t p = 0; p < gpu_n_pools; ++p) {
+        gpu_pool *pool = gpu_pools[p];
+        for (uint64_t i = 0; i < pool->n_used; ++i) {
+            if (pool->used[i].mem != mem)
+                continue;
+            gpu_pool_buffer b = pool->used[i];
+            pool->used[i] = pool->used[--pool->n_used];
+
+            if (gpu_pool_poison) {
+                cl_int err;
+                unsigned char pattern = 0xff;
+                if ((err = clEnqueueFillBuffer(pool->queue, b.mem, &pattern, 1, 0, b.size, 0, NULL, NULL)) != CL_SUCCESS)
+                    logging_log(LOG_FATAL, "%s:%d Could not poison buffer \"%s\" %d", file, line, name, err);
+                //the next owner may write it from another queue
+                if ((err = clFinish(pool->queue)) != CL_SUCCESS)
+                    logging_log(LOG_FATAL, "%s:%d Could not finish poisoning buffer \"%s\" %d", file, line, name, err);
+            }
+
+            gpu_pool_push(&pool->free, &pool->n_free, b);
+            pool->stats.bytes_in_use -= b.size;
+            render_lock_release(&gpu_pools_lock);
+            return true;
+        }
+    }
+    render_lock_release(&gpu_pools_lock);
+    return false;
+}
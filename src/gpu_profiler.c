@@ -0,0 +1,141 @@
+#include "gpu_profiler.h"
+#include "allocator.h"
+#include "logging.h"
+
+#include <inttypes.h>
+#include <stdlib.h>
+#include <string.h>
+#include <float.h>
+
+gpu_profiler *gpu_profiler_init(void) {
+    gpu_profiler *p = mmalloc(sizeof(*p));
+    memset(p, 0, sizeof(*p));
+    p->seed = 0x9e3779b97f4a7c15ULL;
+    return p;
+}
+
+static uint64_t gpu_profiler_rand(gpu_profiler *p) {
+    p->seed ^= p->seed << 13;
+    p->seed ^= p->seed >> 7;
+    p->seed ^= p->seed << 17;
+    return p->seed;
+}
+
+static gpu_profiler_stats *gpu_profiler_get_stats(gpu_profiler *p, const char *name) {
+    for (uint64_t i = 0; i < p->n_stats; ++i)
+        if (p->stats[i].name == name || !strcmp(p->stats[i].name, name))
+            return &p->stats[i];
+
+    p->stats = mrealloc(p->stats, sizeof(*p->stats) * (p->n_stats + 1));
+    gpu_profiler_stats *s = &p->stats[p->n_stats++];
+    memset(s, 0, sizeof(*s));
+    s->name = name;
+    s->min = DBL_MAX;
+    return s;
+}
+
+//waits for the event only if it did not finish yet, which is rare for the oldest ones in the ring
+static void gpu_profiler_resolve(gpu_profiler *p, cl_event ev, const char *name) {
+    cl_int err;
+    cl_ulong start, end;
+    if ((err = clWaitForEvents(1, &ev)) != CL_SUCCESS)
+        logging_log(LOG_FATAL, "Could not wait for kernel \"%s\" event %d", name, err);
+    if ((err = clGetEventProfilingInfo(ev, CL_PROFILING_COMMAND_START, sizeof(start), &start, NULL)) != CL_SUCCESS)
+        logging_log(LOG_FATAL, "Could not get command start for kernel \"%s\" %d", name, err);
+    if ((err = clGetEventProfilingInfo(ev, CL_PROFILING_COMMAND_END, sizeof(end), &end, NULL)) != CL_SUCCESS)
+        logging_log(LOG_FATAL, "Could not get command end for kernel \"%s\" %d", name, err);
+    if ((err = clReleaseEvent(ev)) != CL_SUCCESS)
+        logging_log(LOG_FATAL, "Could not release event for kernel \"%s\" %d", name, err);
+
+    double us = (end - start) / 1000.0;
+    gpu_profiler_stats *s = gpu_profiler_get_stats(p, name);
+    if (s->count < GPU_PROFILER_SAMPLES)
+        s->samples[s->count] = us;
+    else {
+        uint64_t j = gpu_profiler_rand(p) % (s->count + 1);
+        if (j < GPU_PROFILER_SAMPLES)
+            s->samples[j] = us;
+    }
+    s->count++;
+    s->total += us;
+    s->min = us < s->min? us: s->min;
+    s->max = us > s->max? us: s->max;
+
+    if (p->trace) {
+        if (!p->has_origin) {
+            p->origin = start;
+            p->has_origin = true;
+        }
+        fprintf(p->trace, "%s{\"name\":\"%s\",\"ph\":\"X\",\"pid\":0,\"tid\":0,\"ts\":%.3f,\"dur\":%.3f}",
+                p->trace_empty? "": ",\n", name, start >= p->origin? (start - p->origin) / 1000.0: 0.0, us);
+        p->trace_empty = false;
+    }
+}
+
+static void gpu_profiler_resolve_oldest(gpu_profiler *p, uint64_t n) {
+    for (uint64_t i = 0; i < n && p->len > 0; ++i) {
+        gpu_profiler_resolve(p, p->events[p->head], p->names[p->head]);
+        p->head = (p->head + 1) % GPU_PROFILER_RING;
+        p->len--;
+    }
+}
+
+void gpu_profiler_push(gpu_profiler *p, cl_event ev, const char *name) {
+    if (p->len == GPU_PROFILER_RING)
+        gpu_profiler_resolve_oldest(p, GPU_PROFILER_RING / 2);
+
+    uint64_t tail = (p->head + p->len) % GPU_PROFILER_RING;
+    p->events[tail] = ev;
+    p->names[tail] = name;
+    p->len++;
+}
+
+void gpu_profiler_flush(gpu_profiler *p) {
+    gpu_profiler_resolve_oldest(p, p->len);
+}
+
+bool gpu_profiler_trace_open(gpu_profiler *p, const char *path) {
+    gpu_profiler_trace_close(p);
+    p->trace = mfopen(path, "w");
+    if (!p->trace)
+        return false;
+    fprintf(p->trace, "{\"traceEvents\":[\n");
+    p->trace_empty = true;
+    return true;
+}
+
+void gpu_profiler_trace_close(gpu_profiler *p) {
+    if (!p->trace)
+        return;
+    gpu_profiler_flush(p);
+    fprintf(p->trace, "\n]}\n");
+    mfclose(p->trace);
+    p->trace = NULL;
+}
+
+static int gpu_profiler_cmp(const void *a, const void *b) {
+    double x = *(const double*)a;
+    double y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+void gpu_profiler_summary(gpu_profiler *p, FILE *f) {
+    gpu_profiler_flush(p);
+    double samples[GPU_PROFILER_SAMPLES];
+    fprintf(f, "%-32s %10s %14s %12s %12s %12s %12s %12s %12s\n", "kernel", "count", "total(ms)", "avg(us)", "min(us)", "p50(us)", "p90(us)", "p99(us)", "max(us)");
+    for (uint64_t i = 0; i < p->n_stats; ++i) {
+        gpu_profiler_stats *s = &p->stats[i];
+        uint64_t n = s->count < GPU_PROFILER_SAMPLES? s->count: GPU_PROFILER_SAMPLES;
+        memcpy(samples, s->samples, n * sizeof(*samples));
+        qsort(samples, n, sizeof(*samples), gpu_profiler_cmp);
+        fprintf(f, "%-32s %10"PRIu64" %14.3f %12.3f %12.3f %12.3f %12.3f %12.3f %12.3f\n", s->name, s->count, s->total / 1000.0, s->total / s->count,
+                s->min, samples[n / 2], samples[n * 9 / 10], samples[n * 99 / 100], s->max);
+    }
+}
+
+void gpu_profiler_free(gpu_profiler *p) {
+    gpu_profiler_trace_close(p);
+    gpu_profiler_flush(p);
+    mfree(p->stats);
+    mfree(p);
+}
@@ -0,0 +1,208 @@
+#include "gpu_tuner.h"
+#include "logging.h"
+#include "render.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <float.h>
+
+bool gpu_autotune = true;
+const char *gpu_autotune_cache = "workgroup_cache.txt";
+//the viewers tune from their simulation and render threads at once, one kernel is tuned at a time
+static render_lock gpu_tuner_lock = RENDER_LOCK_INIT;
+
+static uint64_t gpu_tuner_pad(uint64_t items, uint64_t local) {
+    return items % local? items + (local - items % local): items;
+}
+
+//tabs and newlines would break the cache lines, device names never have them but better safe
+static void gpu_tuner_device_string(gpu_cl *gpu, cl_device_info param, char *out, uint64_t len) {
+    cl_int err;
+    if ((err = clGetDeviceInfo(gpu->queue_device, param, len, out, NULL)) != CL_SUCCESS)
+        logging_log(LOG_FATAL, "Could not get device info for the work-group cache %d", err);
+    out[len - 1] = 0;
+    for (char *c = out; *c; ++c)
+        if (*c == '\t' || *c == '\n')
+            *c = ' ';
+}
+
+static bool gpu_tuner_lookup(const char *device, const char *driver, uint64_t hash, const char *name, uint64_t *items, uint64_t *local) {
+    //a+ creates the cache on the first run instead of failing to open it
+    FILE *f = mfopen(gpu_autotune_cache, "a+");
+    if (!f)
+        return false;
+    rewind(f);
+
+    char line[1024];
+    bool found = false;
+    while (fgets(line, sizeof(line), f)) {
+        char *fields[8];
+        int n = 0;
+        for (char *tok = strtok(line, "\t\n"); tok && n < 8; tok = strtok(NULL, "\t\n"))
+            fields[n++] = tok;
+        if (n < 8)
+            continue;
+        if (strcmp(fields[0], device) || strcmp(fields[1], driver) || strcmp(fields[3], name))
+            continue;
+        if (strtoull(fields[2], NULL, 16) != hash || strtoull(fields[4], NULL, 10) != items[0] || strtoull(fields[5], NULL, 10) != items[1])
+            continue;
+        //later lines win, so a retune only needs to append
+        local[0] = strtoull(fields[6], NULL, 10);
+        local[1] = strtoull(fields[7], NULL, 10);
+        found = true;
+    }
+    mfclose(f);
+    return found && local[0] > 0 && local[1] > 0;
+}
+
+static void gpu_tuner_store(const char *device, const char *driver, uint64_t hash, const char *name, uint64_t *items, uint64_t *local, double us) {
+    FILE *f = mfopen(gpu_autotune_cache, "a");
+    if (!f)
+        return;
+    fprintf(f, "%s\t%s\t%016"PRIx64"\t%s\t%"PRIu64"\t%"PRIu64"\t%"PRIu64"\t%"PRIu64"\t%.3f\n", device, driver, hash, name, items[0], items[1], local[0], local[1], us);
+    mfclose(f);
+}
+
+//returns DBL_MAX when the device refuses the size, kernels with big local arrays can do that
+static double gpu_tuner_time(gpu_cl *gpu, uint64_t kernel, uint64_t *items, uint64_t *local) {
+    uint64_t global[2] = {gpu_tuner_pad(items[0], local[0]), gpu_tuner_pad(items[1], local[1])};
+    double best = DBL_MAX;
+    for (int i = 0; i <= GPU_TUNER_REPEATS; ++i) {
+        cl_event ev;
+        cl_int err = clEnqueueNDRangeKernel(gpu->queue, gpu->kernels[kernel].kernel, 2, NULL, global, local, 0, NULL, &ev);
+        if (err == CL_INVALID_WORK_GROUP_SIZE || err == CL_INVALID_WORK_ITEM_SIZE || err == CL_OUT_OF_RESOURCES)
+            return DBL_MAX;
+        if (err != CL_SUCCESS)
+            logging_log(LOG_FATAL, "Could not enqueue kernel \"%s\" while tuning %d", gpu->kernels[kernel].name, err);
+
+        cl_ulong start, end;
+        if ((err = clWaitForEvents(1, &ev)) != CL_SUCCESS)
+            logging_log(LOG_FATAL, "Could not wait for kernel \"%s\" while tuning %d", gpu->kernels[kernel].name, err);
+        if ((err = clGetEventProfilingInfo(ev, CL_PROFILING_COMMAND_START, sizeof(start), &start, NULL)) != CL_SUCCESS)
+            logging_log(LOG_FATAL, "Could not get command start for kernel \"%s\" %d", gpu->kernels[kernel].name, err);
+        if ((err = clGetEventProfilingInfo(ev, CL_PROFILING_COMMAND_END, sizeof(end), &end, NULL)) != CL_SUCCESS)
+            logging_log(LOG_FATAL, "Could not get command end for kernel \"%s\" %d", gpu->kernels[kernel].name, err);
+        clReleaseEvent(ev);
+
+        //first launch is a warm up
+        double us = (end - start) / 1000.0;
+        if (i > 0 && us < best)
+            best = us;
+    }
+    return best;
+}
+
+//item_max gets the device limit per dimension
+static void gpu_tuner_limits(gpu_cl *gpu, uint64_t kernel, uint64_t *group_max, uint64_t *multiple, uint64_t *item_max) {
+    cl_int err;
+    size_t kmax, kmul, item_sizes[3] = {0};
+    if ((err = clGetKernelWorkGroupInfo(gpu->kernels[kernel].kernel, gpu->queue_device, CL_KERNEL_WORK_GROUP_SIZE, sizeof(kmax), &kmax, NULL)) != CL_SUCCESS)
+        logging_log(LOG_FATAL, "Could not get work-group size of kernel \"%s\" %d", gpu->kernels[kernel].name, err);
+    if ((err = clGetKernelWorkGroupInfo(gpu->kernels[kernel].kernel, gpu->queue_device, CL_KERNEL_PREFERRED_WORK_GROUP_SIZE_MULTIPLE, sizeof(kmul), &kmul, NULL)) != CL_SUCCESS)
+        logging_log(LOG_FATAL, "Could not get preferred work-group multiple of kernel \"%s\" %d", gpu->kernels[kernel].name, err);
+    if ((err = clGetDeviceInfo(gpu->queue_device, CL_DEVICE_MAX_WORK_ITEM_SIZES, sizeof(item_sizes), item_sizes, NULL)) != CL_SUCCESS)
+        logging_log(LOG_FATAL, "Could not get max work items of device %d", err);
+    *group_max = kmax;
+    *multiple = kmul? kmul: 1;
+    item_max[0] = item_sizes[0];
+    item_max[1] = item_sizes[1];
+}
+
+static uint64_t gpu_tuner_pow2(uint64_t x) {
+    uint64_t p = 1;
+    while (p < x)
+        p *= 2;
+    return p;
+}
+
+//power of two tiles, at least 8 columns wide so rows are still read in whole cache lines
+static bool gpu_tuner_search(gpu_cl *gpu, uint64_t kernel, uint64_t *items, uint64_t *best, double *best_us) {
+    uint64_t group_max, multiple, item_max[2];
+    gpu_tuner_limits(gpu, kernel, &group_max, &multiple, item_max);
+
+    uint64_t limit[2] = {gpu_tuner_pow2(items[0]), gpu_tuner_pow2(items[1])};
+    *best_us = DBL_MAX;
+    for (uint64_t ly = 1; ly <= limit[1] && ly <= item_max[1]; ly *= 2) {
+        for (uint64_t lx = 1; lx <= limit[0] && lx <= item_max[0] && lx * ly <= group_max; lx *= 2) {
+            bool whole = lx == limit[0] && ly == limit[1];
+            if ((lx < 8 && lx < limit[0]) || (lx * ly < multiple && !whole))
+                continue;
+
+            uint64_t local[2] = {lx, ly};
+            double us = gpu_tuner_time(gpu, kernel, items, local);
+            logging_log(LOG_INFO, "Kernel \"%s\" on %"PRIu64"x%"PRIu64" with tile %"PRIu64"x%"PRIu64": %.3f us", gpu->kernels[kernel].name, items[0], items[1], lx, ly, us);
+            if (us < *best_us) {
+                *best_us = us;
+                best[0] = lx;
+                best[1] = ly;
+            }
+        }
+    }
+    return *best_us < DBL_MAX;
+}
+
+//gpu_optimal_tile reshaped for thin domains and shrunk to what the kernel accepts
+static void gpu_tuner_default(gpu_cl *gpu, uint64_t kernel, uint64_t *items, uint64_t *local) {
+    uint64_t group_max, multiple, item_max[2];
+    gpu_tuner_limits(gpu, kernel, &group_max, &multiple, item_max);
+
+    local[0] = gpu_optimal_tile[0];
+    local[1] = gpu_optimal_tile[1];
+    while (local[1] > 1 && local[1] >= 2 * items[1]) {
+        local[1] /= 2;
+        local[0] *= 2;
+    }
+    while (local[0] * local[1] > group_max || local[0] > item_max[0] || local[1] > item_max[1]) {
+        if (local[1] > 1 && (local[1] >= local[0] || local[0] == 1))
+            local[1] /= 2;
+        else
+            local[0] /= 2;
+    }
+}
+
+void gpu_cl_tune_kernel(gpu_cl *gpu, uint64_t kernel, uint64_t cols, uint64_t rows) {
+    kernel_t *k = &gpu->kernels[kernel];
+    uint64_t items[2] = {cols, rows};
+    k->tuned_items[0] = cols;
+    k->tuned_items[1] = rows;
+
+    bool tuned = false;
+    if (gpu_autotune) {
+        char device[256], driver[256];
+        gpu_tuner_device_string(gpu, CL_DEVICE_NAME, device, sizeof(device));
+        gpu_tuner_device_string(gpu, CL_DRIVER_VERSION, driver, sizeof(driver));
+
+        double us;
+        render_lock_acquire(&gpu_tuner_lock);
+        if (gpu_tuner_lookup(device, driver, gpu->program_hash, k->name, items, k->local))
+            tuned = true;
+        else if (gpu_tuner_search(gpu, kernel, items, k->local, &us)) {
+            tuned = true;
+            gpu_tuner_store(device, driver, gpu->program_hash, k->name, items, k->local, us);
+        } else
+            logging_log(LOG_WARNING, "No work-group shape worked for kernel \"%s\", using the default tile", k->name);
+        render_lock_release(&gpu_tuner_lock);
+    }
+    if (!tuned)
+        gpu_tuner_default(gpu, kernel, items, k->local);
+
+    k->global[0] = gpu_tuner_pad(cols, k->local[0]);
+    k->global[1] = gpu_tuner_pad(rows, k->local[1]);
+    logging_log(LOG_INFO, "Kernel \"%s\" uses tile %"PRIu64"x%"PRIu64" for %"PRIu64"x%"PRIu64" items", k->name, k->local[0], k->local[1], cols, rows);
+}
+
+uint64_t gpu_cl_kernel_max_group(gpu_cl *gpu, uint64_t kernel) {
+    uint64_t group_max, multiple, item_max[2];
+    gpu_tuner_limits(gpu, kernel, &group_max, &multiple, item_max);
+    return group_max;
+}
+
+//tunes on the first launch, by then every argument of the kernel is set
+void gpu_cl_enqueue_tuned(gpu_cl *gpu, uint64_t kernel, uint64_t cols, uint64_t rows) {
+    kernel_t *k = &gpu->kernels[kernel];
+    if (k->tuned_items[0] != cols || k->tuned_items[1] != rows)
+        gpu_cl_tune_kernel(gpu, kernel, cols, rows);
+    gpu_cl_enqueue_nd(gpu, kernel, 2, k->local, k->global, NULL);
+}
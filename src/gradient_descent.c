@@ -1,10 +1,11 @@
 #include "gradient_descent.h"
 #include "allocator.h"
+#include "gpu_tuner.h"
 #include <inttypes.h>
 #include <time.h>
 
 static double energy_from_gradient_descent_context(gradient_descent_context *ctx) {
-    gpu_cl_enqueue_nd(ctx->gpu, ctx->energy_id, 1, &ctx->local, &ctx->global, NULL);
+    gpu_cl_enqueue_tuned(ctx->gpu, ctx->energy_id, ctx->g->gi.cols, ctx->g->gi.rows);
     gpu_cl_read_gpu(ctx->gpu, ctx->g->gi.rows * ctx->g->gi.cols * sizeof(*ctx->energy_cpu), 0, ctx->energy_cpu, ctx->energy_gpu);
     double ret = 0.0;
     for (uint64_t i = 0; i < ctx->g->gi.rows * ctx->g->gi.cols; ++i)
@@ -46,10 +47,10 @@ gradient_descent_context gradient_descent_context_init(grid *g, gpu_cl *gpu, gra
 
 
     double t = 0.0;
-    gpu_cl_fill_kernel_args(gpu, ret.energy_id, 0, 5, &g->gp_gpu, sizeof(cl_mem), &g->m_gpu, sizeof(cl_mem), &g->gi, sizeof(g->gi), &ret.energy_gpu, sizeof(cl_mem), &t, sizeof(t));
+    gpu_cl_fill_kernel_args(gpu, ret.energy_id, 0, 6, &g->gp_gpu, sizeof(cl_mem), &g->m_gpu, sizeof(cl_mem), &g->gi, sizeof(g->gi), &ret.energy_gpu, sizeof(cl_mem), &t, sizeof(t), &g->dipolar_gpu, sizeof(cl_mem));
 
     int seed = rand();
-    gpu_cl_fill_kernel_args(gpu, ret.step_id, 0, 11, &g->gp_gpu, sizeof(cl_mem), &ret.before_gpu, sizeof(cl_mem), &g->m_gpu, sizeof(cl_mem), &ret.after_gpu, sizeof(cl_mem), &g->gi, sizeof(g->gi), &ret.params.mass, sizeof(ret.params.mass), &ret.params.T, sizeof(ret.params.T), &ret.params.damping, sizeof(ret.params.damping), &ret.params.restoring, sizeof(ret.params.restoring), &ret.params.dt, sizeof(ret.params.dt), &seed, sizeof(seed));
+    gpu_cl_fill_kernel_args(gpu, ret.step_id, 0, 12, &g->gp_gpu, sizeof(cl_mem), &ret.before_gpu, sizeof(cl_mem), &g->m_gpu, sizeof(cl_mem), &ret.after_gpu, sizeof(cl_mem), &g->gi, sizeof(g->gi), &ret.params.mass, sizeof(ret.params.mass), &ret.params.T, sizeof(ret.params.T), &ret.params.damping, sizeof(ret.params.damping), &ret.params.restoring, sizeof(ret.params.restoring), &ret.params.dt, sizeof(ret.params.dt), &seed, sizeof(seed), &g->dipolar_gpu, sizeof(cl_mem));
 
     ret.min_energy = energy_from_gradient_descent_context(&ret);
 
@@ -60,7 +61,7 @@ void gradient_descent_step(gradient_descent_context *ctx) {
     gpu_cl_set_kernel_arg(ctx->gpu, ctx->step_id, 6, sizeof(ctx->params.T), &ctx->params.T);
     int seed = rand();
     gpu_cl_set_kernel_arg(ctx->gpu, ctx->step_id, 10, sizeof(seed), &seed);
-    gpu_cl_enqueue_nd(ctx->gpu, ctx->step_id, 1, &ctx->local, &ctx->global, NULL);
+    gpu_cl_enqueue_tuned(ctx->gpu, ctx->step_id, ctx->g->gi.cols, ctx->g->gi.rows);
     ctx->params.T *= ctx->params.T_factor;
 
     ctx->step++;
@@ -121,7 +122,7 @@ gradient_descent_params gradient_descent_params_init(void) {
 }
 
 void gradient_descent(grid *g, gradient_descent_params params) {
-    gpu_cl gpu = gpu_cl_init(NULL, params.field_func, NULL, NULL, params.compile_augment);
+    gpu_cl gpu = gpu_session_borrow(params.session, NULL, params.field_func, NULL, NULL, params.compile_augment, grid_kernel_terms(g));
     grid_to_gpu(g, gpu);
     gradient_descent_context ctx = gradient_descent_context_init(g, &gpu, params);
 
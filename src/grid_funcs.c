@@ -14,6 +14,7 @@
 #include "allocator.h"
 #include "profiler.h"
 #include "utils.h"
+#include "kernel_funcs.h"
 
 #define CHECK_BOUNDS(rows, cols, row, col) do { if (row >= (int)rows || col >= (int)cols || \
         row < 0 || col < 0) { \
@@ -370,12 +371,48 @@ bool grid_release_from_gpu(grid *g) {
     if (g->on_gpu) {
         gpu_cl_release_memory(g->gp_gpu);
         gpu_cl_release_memory(g->m_gpu);
+        gpu_cl_release_memory(g->dipolar_gpu);
     } else
         logging_log(LOG_WARNING, "Trying to release a grid that was already freed from the gpu");
     g->on_gpu = false;
     return ret;
 }
 
+uint64_t grid_kernel_terms(grid *g) {
+    uint64_t terms = 0;
+    for (uint64_t i = 0; i < g->gi.rows * g->gi.cols; ++i)
+        if (!CLOSE_ENOUGH(g->gp[i].cubic_ani, 0.0, EPS)) {
+            terms |= KERNEL_TERM_CUBIC;
+            break;
+        }
+    return terms;
+}
+
+//only depends on the grid shape, the lattice constant and the moments are applied on the kernel
+static dipolar_tensor *dipolar_table_create(unsigned int rows, unsigned int cols, uint64_t *size_bytes) {
+    int half_rows = rows / 2;
+    int half_cols = cols / 2;
+    uint64_t len = 4 * half_rows * half_cols;
+    *size_bytes = (len? len: 1) * sizeof(dipolar_tensor);
+    dipolar_tensor *table = mmalloc(*size_bytes);
+    memset(table, 0, *size_bytes);
+
+    for (int dr = -half_rows; dr < half_rows; ++dr) {
+        for (int dc = -half_cols; dc < half_cols; ++dc) {
+            if (dr == 0 && dc == 0)
+                continue;
+            double r2 = dr * dr + dc * dc;
+            double r3 = r2 * sqrt(r2);
+            dipolar_tensor *d = &table[(dr + half_rows) * 2 * half_cols + dc + half_cols];
+            d->xx = (3.0 * dc * dc / r2 - 1.0) / r3;
+            d->xy = 3.0 * dc * dr / (r2 * r3);
+            d->yy = (3.0 * dr * dr / r2 - 1.0) / r3;
+            d->zz = -1.0 / r3;
+        }
+    }
+    return table;
+}
+
 void grid_to_gpu(grid *g, gpu_cl gpu) {
     uint64_t gp_size_bytes = g->gi.rows * g->gi.cols * sizeof(*g->gp);
     uint64_t m_size_bytes = g->gi.rows * g->gi.cols * sizeof(*g->m);
@@ -387,6 +424,17 @@ void grid_to_gpu(grid *g, gpu_cl gpu) {
 
     g->gp_gpu = gpu_cl_create_gpu(&gpu, gp_size_bytes, CL_MEM_READ_WRITE);
     g->m_gpu = gpu_cl_create_gpu(&gpu, m_size_bytes, CL_MEM_READ_WRITE);
+
+    //without dipolar the kernels still take the table but never read it, a single element placeholder is bound
+    if (gpu.dipolar) {
+        uint64_t dipolar_size_bytes;
+        dipolar_tensor *dipolar = dipolar_table_create(g->gi.rows, g->gi.cols, &dipolar_size_bytes);
+        g->dipolar_gpu = gpu_cl_create_gpu(&gpu, dipolar_size_bytes, CL_MEM_READ_ONLY);
+        gpu_cl_write_gpu(&gpu, dipolar_size_bytes, 0, dipolar, g->dipolar_gpu);
+        mfree(dipolar);
+    } else
+        g->dipolar_gpu = gpu_cl_create_gpu(&gpu, sizeof(dipolar_tensor), CL_MEM_READ_ONLY);
+
     g->on_gpu = true;
     
 writing:
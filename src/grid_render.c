@@ -8,35 +8,48 @@
 #include "gradient_descent.h"
 #include "profiler.h"
 #include "allocator.h"
+#include "gpu_tuner.h"
 
-#include <float.h>
 #include <inttypes.h>
 #include <stdint.h>
+#include <stdatomic.h>
+#include <string.h>
 
 grid_renderer grid_renderer_init(grid *g, gpu_cl *gpu) {
+    return grid_renderer_init_size(g, gpu, window_width(), window_height());
+}
+
+grid_renderer grid_renderer_init_size(grid *g, gpu_cl *gpu, unsigned int width, unsigned int height) {
     grid_renderer ret = {0};
-    ret.width = window_width();
-    ret.height = window_height();
+    ret.width = width;
+    ret.height = height;
     ret.g = g;
     ret.gpu = gpu;
     grid_to_gpu(g, *ret.gpu);
 
-    ret.r_global = ret.width * ret.height;
-    ret.r_global = ret.r_global + (gpu_optimal_wg - ret.r_global % gpu_optimal_wg);
-    
-    ret.g_global = g->gi.rows * g->gi.cols;
-    ret.g_global = ret.g_global + (gpu_optimal_wg - ret.g_global % gpu_optimal_wg);
-
-    ret.local = gpu_optimal_wg;
-
+    //launch sizes are tuned per kernel on the first frame
+    ret.zero_copy = gpu_cl_unified_memory(gpu);
     ret.rgba_cpu = mmalloc(ret.width * ret.height * sizeof(*ret.rgba_cpu));
-    ret.rgba_gpu = gpu_cl_create_gpu(ret.gpu, sizeof(*ret.rgba_cpu) * ret.width * ret.height, CL_MEM_READ_WRITE);
 
-    ret.buffer_cpu = mmalloc(g->gi.rows * g->gi.cols * sizeof(*ret.buffer_cpu));
-    ret.buffer_gpu = gpu_cl_create_gpu(ret.gpu, sizeof(*ret.buffer_cpu) * g->gi.rows * g->gi.cols, CL_MEM_READ_WRITE);
+    //colouring and reading back only min(lattice, window) pixels, the host stretches them
+    ret.image_width = g->gi.cols < ret.width? g->gi.cols: ret.width;
+    ret.image_height = g->gi.rows < ret.height? g->gi.rows: ret.height;
+    ret.rgba_gpu = gpu_cl_create_gpu(ret.gpu, sizeof(*ret.rgba_cpu) * ret.image_width * ret.image_height, CL_MEM_READ_WRITE | (ret.zero_copy? CL_MEM_ALLOC_HOST_PTR: 0));
+    //the colour kernels draw into colour_gpu at colour_width x colour_height
+    cl_mem colour_gpu = ret.rgba_gpu;
+    unsigned int colour_width = ret.image_width;
+    unsigned int colour_height = ret.image_height;
+    if (g->gi.cols > ret.width || g->gi.rows > ret.height) {
+        ret.site_rgba_gpu = gpu_cl_create_gpu(ret.gpu, sizeof(*ret.rgba_cpu) * g->gi.rows * g->gi.cols, CL_MEM_READ_WRITE);
+        colour_gpu = ret.site_rgba_gpu;
+        colour_width = g->gi.cols;
+        colour_height = g->gi.rows;
+        logging_log(LOG_INFO, "Rendering %ux%u sites averaged down to %ux%u pixels", colour_width, colour_height, ret.image_width, ret.image_height);
+    }
 
-    ret.v3d_buffer_cpu = mmalloc(g->gi.rows * g->gi.cols * sizeof(*ret.v3d_buffer_cpu));
-    ret.v3d_buffer_gpu = gpu_cl_create_gpu(ret.gpu, sizeof(*ret.v3d_buffer_cpu) * g->gi.rows * g->gi.cols, CL_MEM_READ_WRITE);
+    ret.buffer_gpu = gpu_cl_create_gpu(ret.gpu, sizeof(double) * g->gi.rows * g->gi.cols, CL_MEM_READ_WRITE);
+    ret.v3d_buffer_gpu = gpu_cl_create_gpu(ret.gpu, sizeof(v3d) * g->gi.rows * g->gi.cols, CL_MEM_READ_WRITE);
+    ret.range_gpu = gpu_cl_create_gpu(ret.gpu, 2 * sizeof(double), CL_MEM_READ_WRITE);
 
     ret.grid_hsl_id = gpu_cl_append_kernel(ret.gpu, "render_grid_hsl");
     ret.grid_bwr_id = gpu_cl_append_kernel(ret.gpu, "render_grid_bwr");
@@ -47,25 +60,45 @@ grid_renderer grid_renderer_init(grid *g, gpu_cl *gpu) {
     ret.calc_charge_id = gpu_cl_append_kernel(ret.gpu, "calculate_charge_to_render");
     ret.calc_energy_id = gpu_cl_append_kernel(ret.gpu, "calculate_energy");
     ret.calc_electric_id = gpu_cl_append_kernel(ret.gpu, "calculate_electric");
+    ret.range_id = gpu_cl_append_kernel(ret.gpu, "render_range");
+    ret.range_norm_id = gpu_cl_append_kernel(ret.gpu, "render_range_norm");
+    ret.downsample_id = gpu_cl_append_kernel(ret.gpu, "render_downsample");
 
-    gpu_cl_fill_kernel_args(ret.gpu, ret.grid_hsl_id, 0, 5, &ret.g->m_gpu, sizeof(cl_mem), &ret.g->gi, sizeof(ret.g->gi), &ret.rgba_gpu, sizeof(cl_mem), &ret.width, sizeof(ret.width), &ret.height, sizeof(ret.height));
+    gpu_cl_fill_kernel_args(ret.gpu, ret.grid_hsl_id, 0, 5, &ret.g->m_gpu, sizeof(cl_mem), &ret.g->gi, sizeof(ret.g->gi), &colour_gpu, sizeof(cl_mem), &colour_width, sizeof(colour_width), &colour_height, sizeof(colour_height));
 
-    gpu_cl_fill_kernel_args(ret.gpu, ret.grid_bwr_id, 0, 5, &ret.g->m_gpu, sizeof(cl_mem), &ret.g->gi, sizeof(ret.g->gi), &ret.rgba_gpu, sizeof(cl_mem), &ret.width, sizeof(ret.width), &ret.height, sizeof(ret.height));
+    gpu_cl_fill_kernel_args(ret.gpu, ret.grid_bwr_id, 0, 5, &ret.g->m_gpu, sizeof(cl_mem), &ret.g->gi, sizeof(ret.g->gi), &colour_gpu, sizeof(cl_mem), &colour_width, sizeof(colour_width), &colour_height, sizeof(colour_height));
 
-    gpu_cl_fill_kernel_args(ret.gpu, ret.pinning_id, 0, 6, &ret.g->gp_gpu, sizeof(cl_mem), &ret.g->gi.rows, sizeof(ret.g->gi.rows), &ret.g->gi.cols, sizeof(ret.g->gi.cols), &ret.rgba_gpu, sizeof(cl_mem), &ret.width, sizeof(ret.width), &ret.height, sizeof(ret.height));
+    gpu_cl_fill_kernel_args(ret.gpu, ret.pinning_id, 0, 6, &ret.g->gp_gpu, sizeof(cl_mem), &ret.g->gi.rows, sizeof(ret.g->gi.rows), &ret.g->gi.cols, sizeof(ret.g->gi.cols), &colour_gpu, sizeof(cl_mem), &colour_width, sizeof(colour_width), &colour_height, sizeof(colour_height));
 
     gpu_cl_fill_kernel_args(ret.gpu, ret.calc_charge_id, 0, 3, &ret.g->m_gpu, sizeof(cl_mem), &ret.g->gi, sizeof(ret.g->gi), &ret.buffer_gpu, sizeof(cl_mem));
 
     //Need to set time
     gpu_cl_fill_kernel_args(ret.gpu, ret.calc_energy_id, 0, 4, &ret.g->gp_gpu, sizeof(cl_mem), &ret.g->m_gpu, sizeof(cl_mem), &ret.g->gi, sizeof(ret.g->gi), &ret.buffer_gpu, sizeof(cl_mem));
+    gpu_cl_fill_kernel_args(ret.gpu, ret.calc_energy_id, 5, 1, &ret.g->dipolar_gpu, sizeof(cl_mem));
+
+
+    gpu_cl_fill_kernel_args(ret.gpu, ret.charge_id, 0, 7, &ret.buffer_gpu, sizeof(cl_mem), &ret.g->gi.rows, sizeof(ret.g->gi.rows), &ret.g->gi.cols, sizeof(ret.g->gi.cols),
+                            &ret.range_gpu, sizeof(cl_mem), &colour_gpu, sizeof(cl_mem), &colour_width, sizeof(colour_width), &colour_height, sizeof(colour_height));
+
+    gpu_cl_fill_kernel_args(ret.gpu, ret.energy_id, 0, 7, &ret.buffer_gpu, sizeof(cl_mem), &ret.g->gi.rows, sizeof(ret.g->gi.rows), &ret.g->gi.cols, sizeof(ret.g->gi.cols),
+                            &ret.range_gpu, sizeof(cl_mem), &colour_gpu, sizeof(cl_mem), &colour_width, sizeof(colour_width), &colour_height, sizeof(colour_height));
+
+    //one work group does the whole lattice, as wide as the device lets it up to 256
+    unsigned int sites = g->gi.rows * g->gi.cols;
+    ret.range_local = gpu_cl_kernel_max_group(ret.gpu, ret.range_id);
+    if (gpu_cl_kernel_max_group(ret.gpu, ret.range_norm_id) < ret.range_local)
+        ret.range_local = gpu_cl_kernel_max_group(ret.gpu, ret.range_norm_id);
+    if (ret.range_local > 256)
+        ret.range_local = 256;
+    gpu_cl_fill_kernel_args(ret.gpu, ret.range_id, 0, 2, &ret.buffer_gpu, sizeof(cl_mem), &sites, sizeof(sites));
+    gpu_cl_fill_kernel_args(ret.gpu, ret.range_norm_id, 0, 2, &ret.v3d_buffer_gpu, sizeof(cl_mem), &sites, sizeof(sites));
+    uint64_t range_ids[] = {ret.range_id, ret.range_norm_id};
+    for (uint64_t i = 0; i < sizeof(range_ids) / sizeof(*range_ids); ++i) {
+        gpu_cl_set_kernel_arg(ret.gpu, range_ids[i], 2, ret.range_local * sizeof(double), NULL);
+        gpu_cl_set_kernel_arg(ret.gpu, range_ids[i], 3, ret.range_local * sizeof(double), NULL);
+        gpu_cl_set_kernel_arg(ret.gpu, range_ids[i], 4, sizeof(cl_mem), &ret.range_gpu);
+    }
 
-
-    gpu_cl_fill_kernel_args(ret.gpu, ret.charge_id, 0, 3, &ret.buffer_gpu, sizeof(cl_mem), &ret.g->gi.rows, sizeof(ret.g->gi.rows), &ret.g->gi.cols, sizeof(ret.g->gi.cols));
-    gpu_cl_fill_kernel_args(ret.gpu, ret.charge_id, 5, 3, &ret.rgba_gpu, sizeof(cl_mem), &ret.width, sizeof(ret.width), &ret.height, sizeof(ret.height)); //Need to set ranges
-
-    gpu_cl_fill_kernel_args(ret.gpu, ret.energy_id, 0, 3, &ret.buffer_gpu, sizeof(cl_mem), &ret.g->gi.rows, sizeof(ret.g->gi.rows), &ret.g->gi.cols, sizeof(ret.g->gi.cols));
-    gpu_cl_fill_kernel_args(ret.gpu, ret.energy_id, 5, 3, &ret.rgba_gpu, sizeof(cl_mem), &ret.width, sizeof(ret.width), &ret.height, sizeof(ret.height)); //Need to set ranges
-                                                                                                                                                          //
 //kernel void calculate_electric(GLOBAL grid_site_params *gs, GLOBAL v3d *m0, GLOBAL v3d *m1, GLOBAL v3d *out, double dt, grid_info gi) {
     gpu_cl_fill_kernel_args(ret.gpu, ret.calc_electric_id, 0, 2, &ret.g->gp_gpu, sizeof(cl_mem), &ret.g->m_gpu, sizeof(cl_mem));
     gpu_cl_set_kernel_arg(ret.gpu, ret.calc_electric_id, 3, sizeof(cl_mem), &ret.v3d_buffer_gpu);
@@ -74,137 +107,129 @@ grid_renderer grid_renderer_init(grid *g, gpu_cl *gpu) {
 //    kernel void render_electric(GLOBAL v3d *field, unsigned int rows, unsigned int cols, double max_mod,
 //                            GLOBAL RGBA32 *rgba, unsigned int width, unsigned int height) {
 
-    gpu_cl_fill_kernel_args(ret.gpu, ret.electric_id, 0, 3, &ret.v3d_buffer_gpu, sizeof(cl_mem), &ret.g->gi.rows, sizeof(ret.g->gi.rows), &ret.g->gi.cols, sizeof(ret.g->gi.cols));
-    gpu_cl_fill_kernel_args(ret.gpu, ret.electric_id, 4, 3, &ret.rgba_gpu, sizeof(cl_mem), &ret.width, sizeof(ret.width), &ret.height, sizeof(ret.height));
+    gpu_cl_fill_kernel_args(ret.gpu, ret.electric_id, 0, 7, &ret.v3d_buffer_gpu, sizeof(cl_mem), &ret.g->gi.rows, sizeof(ret.g->gi.rows), &ret.g->gi.cols, sizeof(ret.g->gi.cols),
+                            &ret.range_gpu, sizeof(cl_mem), &colour_gpu, sizeof(cl_mem), &colour_width, sizeof(colour_width), &colour_height, sizeof(colour_height));
+
+    if (ret.site_rgba_gpu)
+        gpu_cl_fill_kernel_args(ret.gpu, ret.downsample_id, 0, 6, &ret.site_rgba_gpu, sizeof(cl_mem), &ret.g->gi.rows, sizeof(ret.g->gi.rows), &ret.g->gi.cols, sizeof(ret.g->gi.cols),
+                                &ret.rgba_gpu, sizeof(cl_mem), &ret.image_width, sizeof(ret.image_width), &ret.image_height, sizeof(ret.image_height));
 
     return ret;
 }
 
 void grid_renderer_close(grid_renderer *gr) {
     mfree(gr->rgba_cpu);
-    mfree(gr->buffer_cpu);
-    mfree(gr->v3d_buffer_cpu);
     gpu_cl_release_memory(gr->rgba_gpu);
+    if (gr->site_rgba_gpu)
+        gpu_cl_release_memory(gr->site_rgba_gpu);
     gpu_cl_release_memory(gr->buffer_gpu);
     gpu_cl_release_memory(gr->v3d_buffer_gpu);
+    gpu_cl_release_memory(gr->range_gpu);
     grid_release_from_gpu(gr->g);
 }
 
+//runs a colour kernel over the sites or the image, whichever it draws into
+static void grid_renderer_colour(grid_renderer *gr, uint64_t kernel) {
+    if (!gr->site_rgba_gpu) {
+        gpu_cl_enqueue_tuned(gr->gpu, kernel, gr->image_width, gr->image_height);
+        return;
+    }
+    gpu_cl_enqueue_tuned(gr->gpu, kernel, gr->g->gi.cols, gr->g->gi.rows);
+    gpu_cl_enqueue_tuned(gr->gpu, gr->downsample_id, gr->image_width, gr->image_height);
+}
+
+static void grid_renderer_show(grid_renderer *gr, RGBA32 *rgba) {
+    if (gr->video)
+        video_writer_push(gr->video, rgba, gr->video_frames++);
+    else
+        window_draw_scaled(rgba, gr->image_width, gr->image_height, gr->linear_filter);
+}
+
+//draws rgba_gpu over the window (or into the video), straight from a mapped view when the device shares the host memory
+static void grid_renderer_present(grid_renderer *gr) {
+    uint64_t size = gr->image_width * gr->image_height * sizeof(*gr->rgba_cpu);
+    if (!gr->zero_copy) {
+        gpu_cl_read_gpu(gr->gpu, size, 0, gr->rgba_cpu, gr->rgba_gpu);
+        grid_renderer_show(gr, gr->rgba_cpu);
+        return;
+    }
+    RGBA32 *rgba = gpu_cl_map_gpu(gr->gpu, size, 0, gr->rgba_gpu, CL_MAP_READ, 0, NULL, NULL);
+    grid_renderer_show(gr, rgba);
+    gpu_cl_unmap_gpu(gr->gpu, gr->rgba_gpu, rgba);
+}
+
 void grid_renderer_hsl(grid_renderer *gr) {
-    gpu_cl_enqueue_nd(gr->gpu, gr->grid_hsl_id, 1, &gr->local, &gr->r_global, NULL);
-    gpu_cl_read_gpu(gr->gpu, gr->width * gr->height * sizeof(*gr->rgba_cpu), 0, gr->rgba_cpu, gr->rgba_gpu);
-    window_draw_from_bytes(gr->rgba_cpu, 0, 0, gr->width, gr->height);
+    grid_renderer_colour(gr, gr->grid_hsl_id);
+    grid_renderer_present(gr);
 }
 
 void grid_renderer_pinning(grid_renderer *gr) {
-    gpu_cl_enqueue_nd(gr->gpu, gr->pinning_id, 1, &gr->local, &gr->r_global, NULL);
-    gpu_cl_read_gpu(gr->gpu, gr->width * gr->height * sizeof(*gr->rgba_cpu), 0, gr->rgba_cpu, gr->rgba_gpu);
-    window_draw_from_bytes(gr->rgba_cpu, 0, 0, gr->width, gr->height);
+    grid_renderer_colour(gr, gr->pinning_id);
+    grid_renderer_present(gr);
 }
 
 void grid_renderer_bwr(grid_renderer *gr) {
-    gpu_cl_enqueue_nd(gr->gpu, gr->grid_bwr_id, 1, &gr->local, &gr->r_global, NULL);
-    gpu_cl_read_gpu(gr->gpu, gr->width * gr->height * sizeof(*gr->rgba_cpu), 0, gr->rgba_cpu, gr->rgba_gpu);
-    window_draw_from_bytes(gr->rgba_cpu, 0, 0, gr->width, gr->height);
+    grid_renderer_colour(gr, gr->grid_bwr_id);
+    grid_renderer_present(gr);
+}
+
+//colour scale of the values the last calc kernel left, only the final image comes back to the host
+static void grid_renderer_range(grid_renderer *gr, uint64_t kernel) {
+    gpu_cl_enqueue_nd(gr->gpu, kernel, 1, &gr->range_local, &gr->range_local, NULL);
 }
 
 void grid_renderer_energy(grid_renderer *gr, double time) {
     gpu_cl_set_kernel_arg(gr->gpu, gr->calc_energy_id, 4, sizeof(time), &time);
-    gpu_cl_enqueue_nd(gr->gpu, gr->calc_energy_id, 1, &gr->local, &gr->g_global, NULL);
-
-    gpu_cl_read_gpu(gr->gpu, gr->g->gi.rows * gr->g->gi.cols * sizeof(*gr->buffer_cpu), 0, gr->buffer_cpu, gr->buffer_gpu);
-
-    double min_energy = FLT_MAX;
-    double max_energy = -FLT_MAX;
-
-    for (uint64_t i = 0; i < gr->g->gi.rows * gr->g->gi.cols; ++i) {
-        if (gr->buffer_cpu[i] < min_energy) min_energy = gr->buffer_cpu[i];
-        if (gr->buffer_cpu[i] > max_energy) max_energy = gr->buffer_cpu[i];
-    }
-
-    gpu_cl_set_kernel_arg(gr->gpu, gr->energy_id, 3, sizeof(min_energy), &min_energy);
-    gpu_cl_set_kernel_arg(gr->gpu, gr->energy_id, 4, sizeof(max_energy), &max_energy);
-    gpu_cl_enqueue_nd(gr->gpu, gr->energy_id, 1, &gr->local, &gr->r_global, NULL);
-
-    gpu_cl_read_gpu(gr->gpu, gr->width * gr->height * sizeof(*gr->rgba_cpu), 0, gr->rgba_cpu, gr->rgba_gpu);
-
-    window_draw_from_bytes(gr->rgba_cpu, 0, 0, gr->width, gr->height);
+    gpu_cl_enqueue_tuned(gr->gpu, gr->calc_energy_id, gr->g->gi.cols, gr->g->gi.rows);
+    grid_renderer_range(gr, gr->range_id);
+    grid_renderer_colour(gr, gr->energy_id);
+    grid_renderer_present(gr);
 }
 
 void grid_renderer_charge(grid_renderer *gr) {
-    gpu_cl_enqueue_nd(gr->gpu, gr->calc_charge_id, 1, &gr->local, &gr->g_global, NULL);
-
-    gpu_cl_read_gpu(gr->gpu, gr->g->gi.rows * gr->g->gi.cols * sizeof(*gr->buffer_cpu), 0, gr->buffer_cpu, gr->buffer_gpu);
-
-    double min_charge = FLT_MAX;
-    double max_charge = -FLT_MAX;
-
-    for (uint64_t i = 0; i < gr->g->gi.rows * gr->g->gi.cols; ++i) {
-        if (gr->buffer_cpu[i] < min_charge) min_charge = gr->buffer_cpu[i];
-        if (gr->buffer_cpu[i] > max_charge) max_charge = gr->buffer_cpu[i];
-    }
-
-    gpu_cl_set_kernel_arg(gr->gpu, gr->charge_id, 3, sizeof(min_charge), &min_charge);
-    gpu_cl_set_kernel_arg(gr->gpu, gr->charge_id, 4, sizeof(max_charge), &max_charge);
-    gpu_cl_enqueue_nd(gr->gpu, gr->charge_id, 1, &gr->local, &gr->r_global, NULL);
-
-    gpu_cl_read_gpu(gr->gpu, gr->width * gr->height * sizeof(*gr->rgba_cpu), 0, gr->rgba_cpu, gr->rgba_gpu);
-
-    window_draw_from_bytes(gr->rgba_cpu, 0, 0, gr->width, gr->height);
-
+    gpu_cl_enqueue_tuned(gr->gpu, gr->calc_charge_id, gr->g->gi.cols, gr->g->gi.rows);
+    grid_renderer_range(gr, gr->range_id);
+    grid_renderer_colour(gr, gr->charge_id);
+    grid_renderer_present(gr);
 }
 
 void grid_renderer_electric_field(grid_renderer *gr) {
-    gpu_cl_enqueue_nd(gr->gpu, gr->calc_electric_id, 1, &gr->local, &gr->g_global, NULL);
-
-    gpu_cl_read_gpu(gr->gpu, gr->g->gi.rows * gr->g->gi.cols * sizeof(*gr->v3d_buffer_cpu), 0, gr->v3d_buffer_cpu, gr->v3d_buffer_gpu);
-
-    double max_electric = -FLT_MAX;
-    for (uint64_t i = 0; i < gr->g->gi.cols * gr->g->gi.rows; ++i) {
-        double value = v3d_dot(gr->v3d_buffer_cpu[i], gr->v3d_buffer_cpu[i]);
-        v3d v = gr->v3d_buffer_cpu[i];
-        if (value > max_electric) max_electric = value;
-    }
-    max_electric = sqrt(max_electric);
-
-    gpu_cl_set_kernel_arg(gr->gpu, gr->electric_id, 3, sizeof(max_electric), &max_electric);
-    gpu_cl_enqueue_nd(gr->gpu, gr->electric_id, 1, &gr->local, &gr->r_global, NULL);
-
-    gpu_cl_read_gpu(gr->gpu, gr->width * gr->height * sizeof(*gr->rgba_cpu), 0, gr->rgba_cpu, gr->rgba_gpu);
-
-    window_draw_from_bytes(gr->rgba_cpu, 0, 0, gr->width, gr->height);
+    gpu_cl_enqueue_tuned(gr->gpu, gr->calc_electric_id, gr->g->gi.cols, gr->g->gi.rows);
+    grid_renderer_range(gr, gr->range_norm_id);
+    grid_renderer_colour(gr, gr->electric_id);
+    grid_renderer_present(gr);
 }
 
 double eps = 0.105;
 
-void grid_renderer_clustering(grid_renderer *gr) {
-    double delta_h = 1.0 / gr->g->clusters.len;
+void grid_renderer_clustering(grid_renderer *gr, const cluster_point *points, const cluster_centers *clusters) {
+    double delta_h = 1.0 / clusters->len;
     for (uint64_t y = 0; y < gr->height; ++y) {
         uint64_t gy = (gr->height - y - 1) / (double)gr->height * gr->g->gi.rows;
         for (uint64_t x = 0; x < gr->width; ++x) {
             uint64_t gx = x / (double)gr->width * gr->g->gi.cols;
-            uint64_t c_idx = gr->g->points[gy * gr->g->gi.cols + gx].cluster;
-            if (gr->g->points[gy * gr->g->gi.cols + gx].label != NOISE)
-                gr->rgba_cpu[y * gr->width + x] = m_to_hsl(v3d_normalize(gr->g->clusters.items[c_idx].avg_m));
+            uint64_t c_idx = points[gy * gr->g->gi.cols + gx].cluster;
+            if (points[gy * gr->g->gi.cols + gx].label != NOISE)
+                gr->rgba_cpu[y * gr->width + x] = m_to_hsl(v3d_normalize(clusters->items[c_idx].avg_m));
             else
                 gr->rgba_cpu[y * gr->width + x] = (RGBA32){.r = 255, .g = 0, .b = 0, .a = 255};
         }
     }
 
-    for (uint64_t i = 0; i < gr->g->clusters.len; ++i) {
+    for (uint64_t i = 0; i < clusters->len; ++i) {
         for (int idy = -10; idy <= 10; ++idy) {
-            int iy = (gr->g->clusters.items[i].y + gr->g->gp->lattice * 0.5) / (gr->g->gi.rows) * (gr->height - 1) * 1.0 / gr->g->gp->lattice;
+            int iy = (clusters->items[i].y + gr->g->gp->lattice * 0.5) / (gr->g->gi.rows) * (gr->height - 1) * 1.0 / gr->g->gp->lattice;
             iy = iy + idy;
             iy = gr->height - iy - 1;
             for (int idx = -10; idx <= 10; ++idx) {
-                int ix = (gr->g->clusters.items[i].x + gr->g->gp->lattice * 0.5) / (gr->g->gi.cols) * (gr->width - 1) * 1.0 / gr->g->gp->lattice;
+                int ix = (clusters->items[i].x + gr->g->gp->lattice * 0.5) / (gr->g->gi.cols) * (gr->width - 1) * 1.0 / gr->g->gp->lattice;
                 ix = ix + idx;
                 RGBA32 color = {0};
 
                 if (idx * idx + idy * idy <= 8 * 8)
-                    color = m_to_hsl(v3d_normalize(gr->g->clusters.items[i].avg_m));
+                    color = m_to_hsl(v3d_normalize(clusters->items[i].avg_m));
                 else if (idx * idx + idy * idy <= 10 * 10)
-                    color = (RGBA32){.bgra = ~m_to_hsl(v3d_normalize(gr->g->clusters.items[i].avg_m)).bgra};
+                    color = (RGBA32){.bgra = ~m_to_hsl(v3d_normalize(clusters->items[i].avg_m)).bgra};
                 else
                     continue;
                 if (iy * gr->width + ix < gr->width * gr->height)
@@ -217,261 +242,753 @@ void grid_renderer_clustering(grid_renderer *gr) {
     window_draw_from_bytes(gr->rgba_cpu, 0, 0, gr->width, gr->height);
 }
 
-void grid_renderer_clustering_centers(grid_renderer *gr) {
-    for (uint64_t i = 0; i < gr->g->clusters.len; ++i) {
+//draws the centres over whatever the window holds, a row of a circle at a time
+void grid_renderer_clustering_centers(grid_renderer *gr, const cluster_centers *clusters) {
+    RGBA32 span[21];
+    for (uint64_t i = 0; i < clusters->len; ++i) {
+        RGBA32 inner = m_to_hsl(v3d_normalize(clusters->items[i].avg_m));
+        RGBA32 outer = (RGBA32){.bgra = ~inner.bgra};
+        int cy = (clusters->items[i].y + gr->g->gp->lattice * 0.5) / (gr->g->gi.rows) * (gr->height - 1) * 1.0 / gr->g->gp->lattice;
+        int cx = (clusters->items[i].x + gr->g->gp->lattice * 0.5) / (gr->g->gi.cols) * (gr->width - 1) * 1.0 / gr->g->gp->lattice;
         for (int idy = -10; idy <= 10; ++idy) {
-            int iy = (gr->g->clusters.items[i].y + gr->g->gp->lattice * 0.5) / (gr->g->gi.rows) * (gr->height - 1) * 1.0 / gr->g->gp->lattice;
-            iy = iy + idy;
-            iy = gr->height - iy - 1;
+            int iy = gr->height - (cy + idy) - 1;
+            if (iy < 0 || iy >= (int)gr->height)
+                continue;
+            int x0 = -1;
+            int n = 0;
             for (int idx = -10; idx <= 10; ++idx) {
-                int ix = (gr->g->clusters.items[i].x + gr->g->gp->lattice * 0.5) / (gr->g->gi.cols) * (gr->width - 1) * 1.0 / gr->g->gp->lattice;
-                ix = ix + idx;
-                RGBA32 color = {0};
-
-                if (idx * idx + idy * idy <= 8 * 8)
-                    color = m_to_hsl(v3d_normalize(gr->g->clusters.items[i].avg_m));
-                else if (idx * idx + idy * idy <= 10 * 10)
-                    color = (RGBA32){.bgra = ~m_to_hsl(v3d_normalize(gr->g->clusters.items[i].avg_m)).bgra};
-                else
+                int ix = cx + idx;
+                if (idx * idx + idy * idy > 10 * 10 || ix < 0 || ix >= (int)gr->width)
                     continue;
-                if (iy * gr->width + ix < gr->width * gr->height)
-                    gr->rgba_cpu[iy * gr->width + ix] = color;
-
+                if (x0 < 0)
+                    x0 = ix;
+                span[n++] = idx * idx + idy * idy <= 8 * 8? inner: outer;
             }
+            if (n)
+                window_draw_from_bytes(span, x0, iy, n, 1);
         }
     }
-    window_draw_from_bytes(gr->rgba_cpu, 0, 0, gr->width, gr->height);
 }
 
 unsigned int steps_per_frame = 100;
+double target_fps = 30.0;
 double print_time = 1.0;
+const char *record_path = NULL;
+video_params record_video = {.format = VIDEO_Y4M, .fps = 30, .png_level = 1, .threads = 4};
+int record_view = 'h';
+
+//pressed keys in flight from the window thread to the simulation thread
+#define GRID_VIEWER_KEYS 64
+//set in latest until the window thread takes the frame there
+#define GRID_VIEWER_FRESH 4u
+//bounds of the adaptive steps per frame
+#define GRID_VIEWER_MAX_STEPS 1000000
+
+//lattice published by the simulation thread, copied on the device so the simulation never waits for a render
+typedef struct {
+    cl_mem m_gpu;
+    //the lattice one step after m_gpu, only for render_electric
+    cl_mem next_gpu;
+    //the copies are done, NULL once the window thread waited for it
+    cl_event ready;
+    double time;
+    //host copies of the clusters, NULL unless the simulation clusters
+    cluster_point *points;
+    cluster_centers clusters;
+} grid_viewer_frame;
+
+typedef struct grid_viewer grid_viewer;
+struct grid_viewer {
+    const char *name;
+    grid *g;
+    //the simulation thread enqueues on gpu, the window thread on render, a copy with its own queue
+    gpu_cl *gpu;
+    gpu_cl render;
+    grid_renderer gr;
+    //render modes the viewer has, by key
+    const char *views;
+
+    //triple buffer, the simulation fills frames[writing] while frames[reading] is on screen and latest holds
+    //the newest complete one, each index is only touched by its own thread
+    grid_viewer_frame frames[3];
+    unsigned int writing;
+    unsigned int reading;
+    atomic_uint latest;
+
+    //single producer single consumer ring, the keys the window thread does not handle itself
+    int keys[GRID_VIEWER_KEYS];
+    atomic_uint_fast64_t keys_head;
+    atomic_uint_fast64_t keys_tail;
+    atomic_bool quit;
+
+    //runs steps steps and sets time, on the simulation thread
+    void (*advance)(grid_viewer *v);
+    //logs the state of the simulation every print_time seconds, may be NULL
+    void (*report)(grid_viewer *v);
+    //the run is over, only asked when recording
+    bool (*done)(grid_viewer *v);
+    void *ctx;
+    //copied into next_gpu of the frames, NULL when the viewer has no electric field
+    cl_mem next_gpu;
+    bool clusters;
+    double time;
+
+    //steps per published frame, sized by grid_viewer_pace from the measured seconds per step
+    unsigned int steps;
+    double step_time;
+    //marker after the previous batch, its steps and when the one before it completed
+    cl_event batch_done;
+    unsigned int batch_steps;
+    double batch_end;
+};
+
+static void grid_viewer_init(grid_viewer *v, const char *name, grid *g, gpu_cl *gpu, const char *views, cl_mem next_gpu, bool clusters,
+                             unsigned int width, unsigned int height) {
+    *v = (grid_viewer){0};
+    v->name = name;
+    v->g = g;
+    v->gpu = gpu;
+    v->views = views;
+    v->next_gpu = next_gpu;
+    v->clusters = clusters;
+    v->steps = steps_per_frame;
+
+    //every kernel is appended before the copy, the two share the kernel list
+    v->gr = record_path? grid_renderer_init_size(g, gpu, width, height): grid_renderer_init(g, gpu);
+    v->render = *gpu;
+    v->render.queue = gpu_cl_create_queue(gpu, gpu->queue_device);
+    if (gpu->profiler)
+        v->render.profiler = gpu_profiler_init();
+    v->gr.gpu = &v->render;
+
+    uint64_t size = g->gi.rows * g->gi.cols * sizeof(*g->m);
+    for (uint64_t i = 0; i < 3; ++i) {
+        v->frames[i].m_gpu = gpu_cl_create_gpu(gpu, size, CL_MEM_READ_WRITE);
+        if (next_gpu)
+            v->frames[i].next_gpu = gpu_cl_create_gpu(gpu, size, CL_MEM_READ_WRITE);
+        if (clusters)
+            v->frames[i].points = mmalloc(g->gi.rows * g->gi.cols * sizeof(*v->frames[i].points));
+    }
+    v->writing = 0;
+    v->reading = 1;
+    atomic_init(&v->latest, 2);
+    atomic_init(&v->keys_head, 0);
+    atomic_init(&v->keys_tail, 0);
+    atomic_init(&v->quit, false);
+}
 
-void grid_renderer_gsa(grid *g, gsa_params params, unsigned int width, unsigned int height) {
-    gpu_cl gpu_stack = gpu_cl_init(NULL, params.field_func, NULL, NULL, params.compile_augment);
-    gpu_cl *gpu = &gpu_stack;
-    gsa_context ctx = gsa_context_init(g, gpu, params);
-    window_init("GSA", width, height);
+static void grid_viewer_close(grid_viewer *v) {
+    if (v->batch_done)
+        gpu_cl_release_event(v->batch_done);
+    for (uint64_t i = 0; i < 3; ++i) {
+        grid_viewer_frame *f = &v->frames[i];
+        if (f->ready)
+            gpu_cl_release_event(f->ready);
+        gpu_cl_release_memory(f->m_gpu);
+        if (f->next_gpu)
+            gpu_cl_release_memory(f->next_gpu);
+        if (f->points)
+            mfree(f->points);
+        if (f->clusters.items)
+            mfree(f->clusters.items);
+    }
+    gpu_cl_release_queue(v->render.queue);
+    if (v->render.profiler)
+        gpu_profiler_free(v->render.profiler);
+    grid_renderer_close(&v->gr);
+}
 
-    grid_renderer gr = grid_renderer_init(g, gpu);
-    int state = 'h';
+//simulation thread, the frame is visible to the window thread once its copies are done
+static void grid_viewer_publish(grid_viewer *v) {
+    grid_viewer_frame *f = &v->frames[v->writing];
+    if (f->ready)
+        gpu_cl_release_event(f->ready);
+
+    uint64_t size = v->g->gi.rows * v->g->gi.cols * sizeof(*v->g->m);
+    gpu_cl_copy_gpu(v->gpu, size, v->g->m_gpu, f->m_gpu);
+    if (v->next_gpu)
+        gpu_cl_copy_gpu(v->gpu, size, v->next_gpu, f->next_gpu);
+    gpu_cl_enqueue_marker(v->gpu, &f->ready);
+    gpu_cl_flush(v->gpu);
+    f->time = v->time;
+
+    if (v->clusters) {
+        memcpy(f->points, v->g->points, v->g->gi.rows * v->g->gi.cols * sizeof(*f->points));
+        if (f->clusters.cap < v->g->clusters.len) {
+            f->clusters.cap = v->g->clusters.len;
+            f->clusters.items = mrealloc(f->clusters.items, f->clusters.cap * sizeof(*f->clusters.items));
+        }
+        f->clusters.len = v->g->clusters.len;
+        if (f->clusters.len)
+            memcpy(f->clusters.items, v->g->clusters.items, f->clusters.len * sizeof(*f->clusters.items));
+    }
+
+    v->writing = atomic_exchange(&v->latest, v->writing | GRID_VIEWER_FRESH) & ~GRID_VIEWER_FRESH;
+}
+
+//window thread, the newest frame or the one already on screen when nothing new came
+static grid_viewer_frame *grid_viewer_take(grid_viewer *v) {
+    if (atomic_load(&v->latest) & GRID_VIEWER_FRESH)
+        v->reading = atomic_exchange(&v->latest, v->reading) & ~GRID_VIEWER_FRESH;
+    grid_viewer_frame *f = &v->frames[v->reading];
+    if (f->ready) {
+        gpu_cl_wait_events(1, &f->ready);
+        f->ready = NULL;
+    }
+    return f;
+}
+
+//window thread, drops the key when the simulation is GRID_VIEWER_KEYS behind
+static void grid_viewer_send(grid_viewer *v, int key) {
+    uint64_t head = atomic_load_explicit(&v->keys_head, memory_order_relaxed);
+    if (head - atomic_load_explicit(&v->keys_tail, memory_order_acquire) == GRID_VIEWER_KEYS)
+        return;
+    v->keys[head % GRID_VIEWER_KEYS] = key;
+    atomic_store_explicit(&v->keys_head, head + 1, memory_order_release);
+}
+
+//simulation thread
+static bool grid_viewer_receive(grid_viewer *v, int *key) {
+    uint64_t tail = atomic_load_explicit(&v->keys_tail, memory_order_relaxed);
+    if (tail == atomic_load_explicit(&v->keys_head, memory_order_acquire))
+        return false;
+    *key = v->keys[tail % GRID_VIEWER_KEYS];
+    atomic_store_explicit(&v->keys_tail, tail + 1, memory_order_release);
+    return true;
+}
+
+//simulation thread, waits for the previous batch so the measured time is the device's and not the enqueue's, then
+//sizes the next batch to take one displayed frame: fresh frames at target_fps with a single lattice copy per frame
+static void grid_viewer_pace(grid_viewer *v) {
+    cl_event done;
+    gpu_cl_enqueue_marker(v->gpu, &done);
+    gpu_cl_flush(v->gpu);
+    if (!v->batch_done) {
+        v->batch_done = done;
+        v->batch_steps = v->steps;
+        v->batch_end = profiler_get_sec();
+        return;
+    }
+
+    gpu_cl_wait_events(1, &v->batch_done);
+    double now = profiler_get_sec();
+    double step_time = (now - v->batch_end) / v->batch_steps;
+    v->step_time = v->step_time > 0.0? 0.7 * v->step_time + 0.3 * step_time: step_time;
+    v->batch_done = done;
+    v->batch_steps = v->steps;
+    v->batch_end = now;
+
+    //at most doubling or halving per frame, a single slow batch does not swing it
+    double steps = 1.0 / (target_fps * v->step_time);
+    if (steps > 2.0 * v->steps)
+        steps = 2.0 * v->steps;
+    if (steps < 0.5 * v->steps)
+        steps = 0.5 * v->steps;
+    v->steps = steps < 1.0? 1: steps > GRID_VIEWER_MAX_STEPS? GRID_VIEWER_MAX_STEPS: steps;
+}
+
+static void *grid_viewer_simulate(void *data) {
+    grid_viewer *v = data;
+    double print_timer = profiler_get_sec();
+    uint64_t steps = 0;
+    uint64_t batches = 0;
+    while (!atomic_load(&v->quit)) {
+        int key;
+        while (grid_viewer_receive(v, &key)) {
+            if (key == 'k') {
+                eps += 0.01;
+                logging_log(LOG_INFO, "eps: %e" , eps);
+            } else if (key == 'l') {
+                eps -= 0.01;
+                logging_log(LOG_INFO, "eps: %e" , eps);
+            }
+        }
+
+        unsigned int batch = v->steps;
+        v->advance(v);
+        grid_viewer_publish(v);
+        steps += batch;
+        batches++;
+        if (target_fps > 0.0)
+            grid_viewer_pace(v);
+
+        double elapsed = profiler_get_sec() - print_timer;
+        if (elapsed >= print_time) {
+            logging_log(LOG_INFO, "%s Steps per Second: %"PRIu64" (%"PRIu64" frames published, %u steps per frame, %es per step)",
+                        v->name, (uint64_t)(steps / elapsed), batches, v->steps, elapsed / steps);
+            if (v->report)
+                v->report(v);
+            print_timer += elapsed;
+            steps = 0;
+            batches = 0;
+        }
+    }
+    gpu_cl_finish(v->gpu);
+    return NULL;
+}
+
+static void grid_viewer_draw(grid_viewer *v, grid_viewer_frame *f, int state) {
+    grid_renderer *gr = &v->gr;
+    gpu_cl_set_kernel_arg(gr->gpu, gr->grid_hsl_id, 0, sizeof(cl_mem), &f->m_gpu);
+    gpu_cl_set_kernel_arg(gr->gpu, gr->grid_bwr_id, 0, sizeof(cl_mem), &f->m_gpu);
+    gpu_cl_set_kernel_arg(gr->gpu, gr->calc_charge_id, 0, sizeof(cl_mem), &f->m_gpu);
+    gpu_cl_set_kernel_arg(gr->gpu, gr->calc_energy_id, 1, sizeof(cl_mem), &f->m_gpu);
+    if (f->next_gpu) {
+        gpu_cl_set_kernel_arg(gr->gpu, gr->calc_electric_id, 1, sizeof(cl_mem), &f->m_gpu);
+        gpu_cl_set_kernel_arg(gr->gpu, gr->calc_electric_id, 2, sizeof(cl_mem), &f->next_gpu);
+    }
+
+    switch (state) {
+        case 'q':
+            grid_renderer_charge(gr);
+            break;
+        case 'e':
+            grid_renderer_energy(gr, f->time);
+            break;
+        case 'b':
+            grid_renderer_bwr(gr);
+            break;
+        case 'w':
+            grid_renderer_electric_field(gr);
+            break;
+        case 'c':
+            if (f->points) {
+                grid_renderer_clustering(gr, f->points, &f->clusters);
+                break;
+            }
+            grid_renderer_hsl(gr);
+            break;
+        case 'v':
+            grid_renderer_hsl(gr);
+            if (f->points)
+                grid_renderer_clustering_centers(gr, &f->clusters);
+            break;
+        case 'h':
+        default:
+            grid_renderer_hsl(gr);
+            break;
+    }
+}
+
+//the window thread draws the newest frame at display rate while the simulation runs on its own thread,
+//neither waits for the other
+static void grid_viewer_run(grid_viewer *v) {
+    grid_viewer_publish(v);
+    render_thread *simulation = render_thread_start(grid_viewer_simulate, v);
 
     double print_timer = 0;
     double dt_fps = 0;
+    double render_time = 0;
     double frame_start = profiler_get_sec();
     uint64_t frames = 0;
 
+    int state = 'h';
     while (!window_should_close()) {
-        switch (state) {
-            case 'q':
-                grid_renderer_charge(&gr);
-                break;
-            case 'e':
-                grid_renderer_energy(&gr, 0.0);
-                break;
-            case 'h':
-                grid_renderer_hsl(&gr);
-                break;
-            case 'b':
-                grid_renderer_bwr(&gr);
-                break;
-            default:
-                grid_renderer_hsl(&gr);
-        }
-        if (window_key_pressed('q'))
-            state = 'q';
-        else if (window_key_pressed('e'))
-            state = 'e';
-        else if (window_key_pressed('h'))
-            state = 'h';
-        else if (window_key_pressed('b'))
-            state = 'b';
-
-        for (unsigned int i = 0; i < steps_per_frame; ++i) {
-            gsa_metropolis_step(&ctx);
-            gsa_thermal_step(&ctx);
+        grid_viewer_draw(v, grid_viewer_take(v), state);
+        window_render();
+        window_poll();
+
+        for (int k = 1; k < 128; ++k) {
+            if (!window_key_pressed(k))
+                continue;
+            if (strchr(v->views, k))
+                state = k;
+            else if (k == 'f')
+                v->gr.linear_filter = !v->gr.linear_filter;
+            else
+                grid_viewer_send(v, k);
         }
 
         if (print_timer >= print_time) {
-            logging_log(LOG_INFO, "GSA FPS: %"PRIu64" <dt real>: %e", frames / print_timer, print_timer / frames);
+            logging_log(LOG_INFO, "%s FPS: %"PRIu64" (%.3fms rendering, %.3fms idle per frame)", v->name, (uint64_t)(frames / print_timer),
+                        render_time / frames * 1e3, (print_timer - render_time) / frames * 1e3);
             print_timer = 0;
+            render_time = 0;
             frames = 0;
         }
 
-        window_render();
-        window_poll();
+        //the rest of the frame is left to the simulation
+        double busy = profiler_get_sec() - frame_start;
+        render_time += busy;
+        if (target_fps > 0.0 && busy < 1.0 / target_fps)
+            render_sleep(1.0 / target_fps - busy);
+
         frames++;
         double end = profiler_get_sec();
         dt_fps = end - frame_start;
         print_timer += dt_fps;
         frame_start = end;
     }
+
+    atomic_store(&v->quit, true);
+    render_thread_join(simulation);
+}
+
+//draws every published frame into record_path on this thread, the next batch is enqueued before the
+//frame is rendered so the device simulates while the host encodes
+static void grid_viewer_record(grid_viewer *v) {
+    int view = record_view;
+    //the cluster views draw on the host into the window
+    if (!strchr(v->views, view) || view == 'c' || view == 'v') {
+        logging_log(LOG_WARNING, "%s can not record view '%c', recording 'h'", v->name, view);
+        view = 'h';
+    }
+    v->gr.video = video_writer_open(record_path, v->gr.image_width, v->gr.image_height, record_video);
+    v->steps = steps_per_frame;
+
+    double print_timer = profiler_get_sec();
+    uint64_t frames = 0;
+    grid_viewer_publish(v);
+    for (;;) {
+        bool last = v->done(v);
+        if (!last)
+            v->advance(v);
+        grid_viewer_draw(v, grid_viewer_take(v), view);
+        frames++;
+        if (last)
+            break;
+        grid_viewer_publish(v);
+
+        double elapsed = profiler_get_sec() - print_timer;
+        if (elapsed >= print_time) {
+            logging_log(LOG_INFO, "%s Frames per Second: %"PRIu64" (%"PRIu64" frames recorded)", v->name, (uint64_t)(frames / elapsed), v->gr.video_frames);
+            if (v->report)
+                v->report(v);
+            print_timer += elapsed;
+            frames = 0;
+        }
+    }
+    gpu_cl_finish(v->gpu);
+    video_writer_close(v->gr.video);
+    v->gr.video = NULL;
+}
+
+//the window, or the recording without one
+static void grid_viewer_show(grid_viewer *v) {
+    if (record_path)
+        grid_viewer_record(v);
+    else
+        grid_viewer_run(v);
+}
+
+static void grid_viewer_gsa_advance(grid_viewer *v) {
+    gsa_context *ctx = v->ctx;
+    for (unsigned int i = 0; i < v->steps; ++i) {
+        gsa_metropolis_step(ctx);
+        gsa_thermal_step(ctx);
+    }
+}
+
+static bool grid_viewer_gsa_done(grid_viewer *v) {
+    gsa_context *ctx = v->ctx;
+    return ctx->outer_step >= ctx->parameters.outer_steps;
+}
+
+void grid_renderer_gsa(grid *g, gsa_params params, unsigned int width, unsigned int height) {
+    gpu_cl gpu_stack = gpu_session_borrow(params.session, NULL, params.field_func, NULL, NULL, params.compile_augment, grid_kernel_terms(g));
+    gpu_cl *gpu = &gpu_stack;
+    gsa_context ctx = gsa_context_init(g, gpu, params);
+    if (!record_path)
+        window_init("GSA", width, height);
+
+    grid_viewer v;
+    grid_viewer_init(&v, "GSA", g, gpu, "qehb", NULL, false, width, height);
+    v.ctx = &ctx;
+    v.advance = grid_viewer_gsa_advance;
+    v.done = grid_viewer_gsa_done;
+    grid_viewer_show(&v);
+
     gsa_context_read_minimun_grid(&ctx);
     gsa_context_close(&ctx);
-    grid_renderer_close(&gr);
+    grid_viewer_close(&v);
     gpu_cl_close(gpu);
 }
 
+static void grid_viewer_integrate_advance(grid_viewer *v) {
+    integrate_context *ctx = v->ctx;
+    //v->steps (exchange, step) pairs, the middle ones batched
+    if (v->steps > 0) {
+        integrate_exchange_grids(ctx);
+        integrate_run_steps(ctx, v->steps - 1);
+        integrate_step(ctx);
+    }
+    //no-op unless the run is split in slabs
+    integrate_context_sync_grid(ctx);
+    v->time = ctx->time;
+}
+
+static void grid_viewer_integrate_report(grid_viewer *v) {
+    integrate_context *ctx = v->ctx;
+    logging_log(LOG_INFO, "Integrate time: %ens", ctx->time / NS);
+}
+
+static bool grid_viewer_integrate_done(grid_viewer *v) {
+    integrate_context *ctx = v->ctx;
+    return ctx->time >= ctx->time0 + ctx->params.duration;
+}
+
 void grid_renderer_integrate(grid *g, integrate_params params, unsigned int width, unsigned int height) {
-    gpu_cl gpu_stack = gpu_cl_init(params.current_func, params.field_func, params.temperature_func, NULL, params.compile_augment);
+    char *compile = integrate_compile_augment(params);
+    gpu_cl gpu_stack = gpu_session_borrow(params.session, params.current_func, params.field_func, params.temperature_func, NULL, compile, grid_kernel_terms(g));
+    mfree(compile);
     gpu_cl *gpu = &gpu_stack;
-    window_init("Integration", width, height);
+    if (!record_path)
+        window_init("Integration", width, height);
     integrate_context ctx = integrate_context_init(g, gpu, params);
 
-    grid_renderer gr = grid_renderer_init(g, gpu);
-    
-    double print_timer = 0;
-    double dt_fps = 0;
-    double frame_start = profiler_get_sec();
-    uint64_t frames = 0;
+    grid_viewer v;
+    grid_viewer_init(&v, "Integrate", g, gpu, "qehbwcv", ctx.swap_gpu, params.do_cluster && !record_path, width, height);
+    v.ctx = &ctx;
+    v.advance = grid_viewer_integrate_advance;
+    v.report = grid_viewer_integrate_report;
+    v.done = grid_viewer_integrate_done;
 //kernel void calculate_electric(GLOBAL grid_site_params *gs, GLOBAL v3d *m0, GLOBAL v3d *m1, GLOBAL v3d *out, double dt, grid_info gi) {
-    gpu_cl_set_kernel_arg(gpu, gr.calc_electric_id, 2, sizeof(cl_mem), &ctx.swap_gpu);
-    gpu_cl_set_kernel_arg(gpu, gr.calc_electric_id, 4, sizeof(ctx.params.dt), &ctx.params.dt);
+    gpu_cl_set_kernel_arg(gpu, v.gr.calc_electric_id, 4, sizeof(ctx.params.dt), &ctx.params.dt);
 
-    int state = 'h';
     integrate_step(&ctx);
-    while (!window_should_close()) {
-        switch (state) {
-            case 'q':
-                grid_renderer_charge(&gr);
-                break;
-            case 'e':
-                grid_renderer_energy(&gr, ctx.time);
-                break;
-            case 'h':
-                grid_renderer_hsl(&gr);
-                break;
-            case 'b':
-                grid_renderer_bwr(&gr);
-                break;
-            case 'w':
-                grid_renderer_electric_field(&gr);
-                break;
-            case 'c':
-                grid_renderer_clustering(&gr);
-                break;
-            case 'v':
-                grid_renderer_hsl(&gr);
-                grid_renderer_clustering_centers(&gr);
-                break;
-            default:
-                grid_renderer_hsl(&gr);
-                break;
-        }
-        //grid_renderer_pinning(&gr);
-        if (window_key_pressed('q'))
-            state = 'q';
-        else if (window_key_pressed('e'))
-            state = 'e';
-        else if (window_key_pressed('h'))
-            state = 'h';
-        else if (window_key_pressed('b'))
-            state = 'b';
-        else if (window_key_pressed('w'))
-            state = 'w';
-        else if (window_key_pressed('c'))
-            state = 'c';
-        else if (window_key_pressed('v'))
-            state = 'v';
-
-        if (window_key_pressed('k')) {
-            eps += 0.01;
-            logging_log(LOG_INFO, "eps: %e" , eps);
-        } else if (window_key_pressed('l')) {
-            eps -= 0.01;
-            logging_log(LOG_INFO, "eps: %e" , eps);
-        } 
-
-        for (unsigned int i = 0; i < steps_per_frame; ++i) {
-            integrate_exchange_grids(&ctx);
-            integrate_step(&ctx);
-        }
-
-        if (print_timer >= print_time) {
-            logging_log(LOG_INFO, "Integrate FPS: %"PRIu64, (uint64_t)(frames / print_timer));
-            logging_log(LOG_INFO, "Integrate Steps per Second: %"PRIu64, (uint64_t)(frames / print_timer * steps_per_frame));
-            logging_log(LOG_INFO, "Integrate <dt_real>: %es", print_timer / frames);
-            logging_log(LOG_INFO, "Integrate time: %ens", ctx.time / NS);
-            print_timer = 0;
-            frames = 0;
-        }
+    integrate_context_sync_grid(&ctx);
+    v.time = ctx.time;
+    grid_viewer_show(&v);
 
-        window_render();
-        window_poll();
+    integrate_context_close(&ctx);
+    grid_viewer_close(&v);
+}
 
-        frames++;
-        double end = profiler_get_sec();
-        dt_fps = end - frame_start;
-        print_timer += dt_fps;
-        frame_start = end;
+static void grid_viewer_gradient_descent_advance(grid_viewer *v) {
+    gradient_descent_context *ctx = v->ctx;
+    for (unsigned int i = 0; i < v->steps; ++i) {
+        gradient_descent_step(ctx);
+        gradient_descent_exchange(ctx);
     }
-    integrate_context_close(&ctx);
-    grid_renderer_close(&gr);
+}
+
+static void grid_viewer_gradient_descent_report(grid_viewer *v) {
+    gradient_descent_context *ctx = v->ctx;
+    logging_log(LOG_INFO, "Gradient Descent[Outer=%"PRIu64"][Inner=%"PRIu64"] Minimun Energy: %e eV Temperature: %e",
+                           ctx->outer_step, ctx->step, ctx->min_energy / QE, ctx->params.T);
+}
+
+static bool grid_viewer_gradient_descent_done(grid_viewer *v) {
+    gradient_descent_context *ctx = v->ctx;
+    return ctx->outer_step >= ctx->params.outer_steps;
 }
 
 void grid_renderer_gradient_descent(grid *g, gradient_descent_params params, unsigned int width, unsigned int height) {
-    gpu_cl gpu_stack = gpu_cl_init(NULL, params.field_func, NULL, NULL, params.compile_augment);
+    gpu_cl gpu_stack = gpu_session_borrow(params.session, NULL, params.field_func, NULL, NULL, params.compile_augment, grid_kernel_terms(g));
     gpu_cl *gpu = &gpu_stack;
-    window_init("Gradient Descent", width, height);
+    if (!record_path)
+        window_init("Gradient Descent", width, height);
     gradient_descent_context ctx = gradient_descent_context_init(g, gpu, params);
-    grid_renderer gr = grid_renderer_init(g, gpu);
+
+    grid_viewer v;
+    grid_viewer_init(&v, "Gradient Descent", g, gpu, "qehb", NULL, false, width, height);
+    v.ctx = &ctx;
+    v.advance = grid_viewer_gradient_descent_advance;
+    v.report = grid_viewer_gradient_descent_report;
+    v.done = grid_viewer_gradient_descent_done;
+    grid_viewer_show(&v);
+
+    gradient_descent_read_mininum_grid(&ctx);
+    gradient_descent_close(&ctx);
+    grid_viewer_close(&v);
+    gpu_cl_close(gpu);
+}
+
+//frames of the trajectory the prefetch thread keeps ahead of the one on screen
+#define GRID_REPLAY_PREFETCH 8
+
+//integrate_evolution.dat mapped read only: frame count, grid_info, gp, then one lattice of m per frame
+typedef struct {
+    const unsigned char *data;
+    uint64_t size;
+    uint64_t header;
+    uint64_t frame_size;
+    uint64_t frames;
+
+    //frame on screen and how many frames the next shown one is away (negative backwards), from the window thread
+    atomic_uint_fast64_t position;
+    atomic_int_fast64_t stride;
+    atomic_bool quit;
+} grid_replay;
+
+static uint64_t grid_replay_wrap(grid_replay *r, int64_t frame) {
+    int64_t n = r->frames;
+    return ((frame % n) + n) % n;
+}
+
+static const v3d *grid_replay_frame(grid_replay *r, uint64_t frame) {
+    return (const v3d*)(r->data + r->header + frame * r->frame_size);
+}
+
+//faults the pages of the next frames in, a frame at a time so a seek is followed right away
+static void *grid_replay_prefetch(void *data) {
+    grid_replay *r = data;
+    uint64_t recent[2 * GRID_REPLAY_PREFETCH];
+    for (uint64_t i = 0; i < 2 * GRID_REPLAY_PREFETCH; ++i)
+        recent[i] = UINT64_MAX;
+    uint64_t next = 0;
+    volatile unsigned char sink = 0;
+
+    while (!atomic_load(&r->quit)) {
+        uint64_t position = atomic_load(&r->position);
+        int64_t stride = atomic_load(&r->stride);
+        bool touched = false;
+        for (int64_t i = 1; i <= GRID_REPLAY_PREFETCH && !touched; ++i) {
+            uint64_t frame = grid_replay_wrap(r, position + i * stride);
+            bool seen = false;
+            for (uint64_t j = 0; j < 2 * GRID_REPLAY_PREFETCH; ++j)
+                seen = seen || recent[j] == frame;
+            if (seen)
+                continue;
+            const unsigned char *p = (const unsigned char*)grid_replay_frame(r, frame);
+            for (uint64_t offset = 0; offset < r->frame_size; offset += 4096)
+                sink ^= p[offset];
+            sink ^= p[r->frame_size - 1];
+            recent[next++ % (2 * GRID_REPLAY_PREFETCH)] = frame;
+            touched = true;
+        }
+        if (!touched)
+            render_sleep(1e-3);
+    }
+    return NULL;
+}
+
+//plays the raw frames integrate wrote to path with the params of that run, which the energy needs. the frames are
+//uploaded straight from the mapped file, only the ones shown
+void grid_renderer_replay(const char *path, integrate_params params, unsigned int width, unsigned int height) {
+    grid g = {0};
+    if (!grid_from_animation_bin(path, &g, 0)) {
+        logging_log(LOG_ERROR, "Could not read trajectory \"%s\"", path);
+        return;
+    }
+
+    grid_replay r = {0};
+    r.data = render_map_file(path, &r.size);
+    uint64_t sites = g.gi.rows * g.gi.cols;
+    r.header = sizeof(uint64_t) + sizeof(g.gi) + sites * sizeof(*g.gp);
+    r.frame_size = sites * sizeof(*g.m);
+    if (!r.data || r.size < r.header + r.frame_size) {
+        logging_log(LOG_ERROR, "Trajectory \"%s\" has no frames", path);
+        if (r.data)
+            render_unmap_file(r.data, r.size);
+        grid_free(&g);
+        return;
+    }
+    r.frames = (r.size - r.header) / r.frame_size;
+    atomic_init(&r.position, 0);
+    atomic_init(&r.stride, 1);
+    atomic_init(&r.quit, false);
+    logging_log(LOG_INFO, "Replaying %"PRIu64" frames of %ux%u sites from \"%s\"", r.frames, g.gi.cols, g.gi.rows, path);
+
+    char *compile = integrate_compile_augment(params);
+    gpu_cl gpu = gpu_session_borrow(params.session, params.current_func, params.field_func, params.temperature_func, NULL, compile, grid_kernel_terms(&g));
+    mfree(compile);
+    window_init("Replay", width, height);
+    grid_renderer gr = grid_renderer_init(&g, &gpu);
+    render_thread *prefetch = render_thread_start(grid_replay_prefetch, &r);
+
+    //seconds of the run between two frames, for the energy
+    double frame_time = params.interval_for_raw_grid * params.dt;
+    //frames of the trajectory per second
+    double speed = target_fps > 0.0? target_fps: 30.0;
+    int direction = 1;
+    bool paused = false;
+    double position = 0;
+    uint64_t shown = UINT64_MAX;
 
     double print_timer = 0;
-    double dt_fps = 0;
     double frame_start = profiler_get_sec();
+    double last = frame_start;
     uint64_t frames = 0;
+    uint64_t uploads = 0;
 
     int state = 'h';
     while (!window_should_close()) {
+        double now = profiler_get_sec();
+        if (!paused)
+            position += direction * speed * (now - last);
+        last = now;
+        position = fmod(position, r.frames);
+        if (position < 0)
+            position += r.frames;
+
+        uint64_t frame = position;
+        //frame 0 is the initial state grid_dump writes and frame 1 the capture of step 0, both at t = 0
+        double time = (frame? frame - 1: 0) * frame_time;
+        if (frame != shown) {
+            gpu_cl_write_gpu(&gpu, r.frame_size, 0, (void*)grid_replay_frame(&r, frame), g.m_gpu);
+            shown = frame;
+            uploads++;
+        }
+        //frames in between are skipped, the prefetch follows the ones that will be shown
+        double per_frame = speed / (target_fps > 0.0? target_fps: 60.0);
+        atomic_store(&r.stride, direction * (per_frame < 1.0? 1: (int64_t)(per_frame + 0.5)));
+        atomic_store(&r.position, frame);
+
         switch (state) {
             case 'q':
                 grid_renderer_charge(&gr);
                 break;
             case 'e':
-                grid_renderer_energy(&gr, 0.0);
-                break;
-            case 'h':
-                grid_renderer_hsl(&gr);
+                grid_renderer_energy(&gr, time);
                 break;
             case 'b':
                 grid_renderer_bwr(&gr);
                 break;
+            case 'h':
             default:
                 grid_renderer_hsl(&gr);
+                break;
         }
-        if (window_key_pressed('q'))
-            state = 'q';
-        else if (window_key_pressed('e'))
-            state = 'e';
-        else if (window_key_pressed('h'))
-            state = 'h';
-        else if (window_key_pressed('b'))
-            state = 'b';
-
-        for (unsigned int i = 0; i < steps_per_frame; ++i) {
-            gradient_descent_step(&ctx);
-            gradient_descent_exchange(&ctx);
+        window_render();
+        window_poll();
+
+        for (int k = 1; k < 128; ++k) {
+            if (!window_key_pressed(k))
+                continue;
+            if (strchr("qehb", k))
+                state = k;
+            else if (k == 'f')
+                gr.linear_filter = !gr.linear_filter;
+            else if (k == ' ')
+                paused = !paused;
+            else if (k == 'r')
+                direction = -direction;
+            else if (k == ',' || k == '.') {
+                //one frame at a time, paused
+                paused = true;
+                position = grid_replay_wrap(&r, (int64_t)frame + (k == '.'? 1: -1));
+            } else if (k == '[' || k == ']') {
+                speed = k == ']'? speed * 2.0: speed * 0.5;
+                logging_log(LOG_INFO, "Replay speed: %g frames per second", speed);
+            } else if (k == 'j' || k == 'l')
+                position = grid_replay_wrap(&r, (int64_t)frame + (k == 'l'? 1: -1) * (int64_t)(r.frames / 20 + 1));
+            else if (k >= '0' && k <= '9')
+                position = r.frames * (k - '0') / 10;
         }
+
         if (print_timer >= print_time) {
-            logging_log(LOG_INFO, "Gradient Descent FPS: %"PRIu64, (uint64_t)(frames / print_timer));
-            logging_log(LOG_INFO, "Gradient Descent Steps per Second: %"PRIu64, (uint64_t)(frames / print_timer * steps_per_frame));
-            logging_log(LOG_INFO, "Gradient Descent <dt_real>: %es", print_timer / frames);
-            logging_log(LOG_INFO, "Gradient Descent[Outer=%"PRIu64"][Inner=%"PRIu64"] Minimun Energy: %e eV Temperature: %e",
-                                   ctx.outer_step, ctx.step, ctx.min_energy / QE, ctx.params.T);
+            logging_log(LOG_INFO, "Replay frame %"PRIu64"/%"PRIu64" (%es) FPS: %"PRIu64" (%"PRIu64" frames uploaded)",
+                        frame, r.frames, time, (uint64_t)(frames / print_timer), uploads);
             print_timer = 0;
             frames = 0;
+            uploads = 0;
         }
 
-        window_render();
-        window_poll();
+        double busy = profiler_get_sec() - frame_start;
+        if (target_fps > 0.0 && busy < 1.0 / target_fps)
+            render_sleep(1.0 / target_fps - busy);
 
         frames++;
         double end = profiler_get_sec();
-        dt_fps = end - frame_start;
-        print_timer += dt_fps;
+        print_timer += end - frame_start;
         frame_start = end;
     }
-    gradient_descent_read_mininum_grid(&ctx);
-    gradient_descent_close(&ctx);
+
+    atomic_store(&r.quit, true);
+    render_thread_join(prefetch);
+    render_unmap_file(r.data, r.size);
     grid_renderer_close(&gr);
-    gpu_cl_close(gpu);
+    grid_free(&g);
+    gpu_cl_close(&gpu);
 }
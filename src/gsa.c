@@ -4,6 +4,7 @@
 #include "kernel_funcs.h"
 #include "logging.h"
 #include "allocator.h"
+#include "gpu_tuner.h"
 #include "utils.h"
 
 #include <math.h>
@@ -12,7 +13,7 @@
 #include <inttypes.h>
 
 static double energy_from_gsa_context(gsa_context *ctx) {
-    gpu_cl_enqueue_nd(ctx->gpu, ctx->energy_id, 1, &ctx->local, &ctx->global, NULL);
+    gpu_cl_enqueue_tuned(ctx->gpu, ctx->energy_id, ctx->g->gi.cols, ctx->g->gi.rows);
     gpu_cl_read_gpu(ctx->gpu, ctx->g->gi.rows * ctx->g->gi.cols * sizeof(*ctx->energy_cpu), 0, ctx->energy_cpu, ctx->energy_gpu);
     double ret = 0.0;
     for (uint64_t i = 0; i < ctx->g->gi.rows * ctx->g->gi.cols; ++i)
@@ -63,7 +64,7 @@ gsa_context gsa_context_init_base(grid *g, gpu_cl *gpu, double qA, double qV, do
     gpu_cl_fill_kernel_args(gpu, ret.thermal_id, 0, 7, &g->gp_gpu, sizeof(cl_mem), &g->m_gpu, sizeof(cl_mem), &ret.swap_gpu, sizeof(cl_mem), &g->gi, sizeof(grid_info), &ret.parameters.qV, sizeof(double), &ret.gamma, sizeof(double), &ret.T, sizeof(double));
 
     double t = 0.0;
-    gpu_cl_fill_kernel_args(gpu, ret.energy_id, 0, 5, &g->gp_gpu, sizeof(cl_mem), &ret.swap_gpu, sizeof(cl_mem), &g->gi, sizeof(grid_info), &ret.energy_gpu, sizeof(cl_mem), &t, sizeof(double));
+    gpu_cl_fill_kernel_args(gpu, ret.energy_id, 0, 6, &g->gp_gpu, sizeof(cl_mem), &ret.swap_gpu, sizeof(cl_mem), &g->gi, sizeof(grid_info), &ret.energy_gpu, sizeof(cl_mem), &t, sizeof(double), &g->dipolar_gpu, sizeof(cl_mem));
 
     gpu_cl_fill_kernel_args(gpu, ret.exchange_id, 0, 4, &ret.swap_gpu, sizeof(cl_mem), &ret.g->m_gpu, sizeof(cl_mem), &ret.g->gi.rows, sizeof(ret.g->gi.rows), &ret.g->gi.cols, sizeof(ret.g->gi.cols));
     gpu_cl_enqueue_nd(gpu, ret.exchange_id, 1, &ret.local, &ret.global, NULL);
@@ -83,7 +84,7 @@ gsa_context gsa_context_init(grid *g, gpu_cl *gpu, gsa_params params) {
 }
 
 void gsa(grid *g, gsa_params params) {
-    gpu_cl gpu = gpu_cl_init(NULL, params.field_func, NULL, NULL, params.compile_augment);
+    gpu_cl gpu = gpu_session_borrow(params.session, NULL, params.field_func, NULL, NULL, params.compile_augment, grid_kernel_terms(g));
     grid_to_gpu(g, gpu);
 
     gsa_context ctx = gsa_context_init_base(g, &gpu, params.qA, params.qV, params.qT, params.T0, params.inner_steps, params.outer_steps, params.print_factor);
@@ -4,12 +4,161 @@
 #include "allocator.h"
 #include "utils.h"
 #include "string_builder.h"
-
-#include "stb_image_write.h"
+#include "profiler.h"
+#include "gpu_tuner.h"
 
 #include <inttypes.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <math.h>
+
+
+//host mirror of dipolar_tree_levels on the kernel, returns the top level and the total number of nodes
+static int integrate_dipolar_tree_levels(grid_info gi, uint64_t *cells, uint64_t *total) {
+    uint64_t rows = gi.rows;
+    uint64_t cols = gi.cols;
+    int level = 0;
+    *total = 0;
+    for (;;) {
+        cells[level] = rows * cols;
+        *total += cells[level];
+        if ((rows == 1 && cols == 1) || level == DIPOLAR_TREE_MAX_LEVELS - 1)
+            break;
+        rows = (rows + 1) / 2;
+        cols = (cols + 1) / 2;
+        level++;
+    }
+    return level;
+}
+
+//kernels appended after the slab was set up move the context's array, so the copies pick it up on every use
+static gpu_cl *integrate_slab_gpu(integrate_context *ctx, integrate_slab *s) {
+    s->gpu.kernels = ctx->gpu->kernels;
+    s->gpu.n_kernels = ctx->gpu->n_kernels;
+    return &s->gpu;
+}
+
+static void integrate_slabs_init(integrate_context *ctx) {
+    grid *g = ctx->g;
+    gpu_cl *gpu = ctx->gpu;
+    uint64_t halo = ctx->params.slab_halo? ctx->params.slab_halo: 1;
+    uint64_t n = ctx->params.n_slabs;
+    //the edge steps after an exchange must not reach the other halo
+    uint64_t min_rows = halo > 2? halo: 2;
+    if (g->gi.rows / n < min_rows) {
+        n = g->gi.rows / min_rows;
+        logging_log(LOG_WARNING, "%u rows can not be split in %"PRIu64" slabs with halo %"PRIu64", using %"PRIu64, g->gi.rows, ctx->params.n_slabs, halo, n);
+        if (n <= 1)
+            return;
+    }
+
+    ctx->n_slabs = n;
+    ctx->slab_halo = halo;
+    ctx->slab_phase = 0;
+    ctx->slabs = mmalloc(n * sizeof(*ctx->slabs));
+    memset(ctx->slabs, 0, n * sizeof(*ctx->slabs));
+
+    uint64_t cols = g->gi.cols;
+    int method = ctx->params.method;
+    int dipolar_cached = 0;
+    for (uint64_t i = 0; i < n; ++i) {
+        integrate_slab *s = &ctx->slabs[i];
+        s->row0 = g->gi.rows * i / n;
+        s->rows = g->gi.rows * (i + 1) / n - s->row0;
+        s->halo_low = i > 0 || g->gi.pbc.pbc_y? halo: 0;
+        s->halo_high = i < n - 1 || g->gi.pbc.pbc_y? halo: 0;
+        s->gi = g->gi;
+        s->gi.rows = s->halo_low + s->rows + s->halo_high;
+        s->gi.pbc.pbc_y = 0;
+        s->global = s->gi.rows * cols;
+        s->global = s->global + (ctx->local - s->global % ctx->local);
+
+        uint64_t device = ctx->params.slab_devices? ctx->params.slab_devices[i]: i;
+        if (device >= gpu->n_devices)
+            logging_log(LOG_FATAL, "Slab %"PRIu64" wants device %"PRIu64" but the context has %"PRIu64, i, device, gpu->n_devices);
+        s->gpu = *gpu;
+        s->gpu.queue_device = gpu->devices[device];
+        s->gpu.queue = gpu_cl_create_queue(gpu, s->gpu.queue_device);
+        s->transfer = s->gpu;
+        s->transfer.queue = gpu_cl_create_queue(gpu, s->gpu.queue_device);
+
+        uint64_t size = s->gi.rows * cols;
+        grid_site_params *gp = mmalloc(size * sizeof(*gp));
+        v3d *m = mmalloc(size * sizeof(*m));
+        for (uint64_t b = 0; b < s->gi.rows; ++b) {
+            uint64_t row = (s->row0 + g->gi.rows - s->halo_low + b) % g->gi.rows;
+            memcpy(gp + b * cols, g->gp + row * cols, cols * sizeof(*gp));
+            memcpy(m + b * cols, g->m + row * cols, cols * sizeof(*m));
+        }
+
+        cl_ulong step0 = 0;
+        s->gp_gpu = gpu_cl_create_gpu(gpu, size * sizeof(*gp), CL_MEM_READ_WRITE);
+        s->m_gpu = gpu_cl_create_gpu(gpu, size * sizeof(*m), CL_MEM_READ_WRITE);
+        s->swap_gpu = gpu_cl_create_gpu(gpu, size * sizeof(*m), CL_MEM_READ_WRITE);
+        s->step_gpu = gpu_cl_create_gpu(gpu, sizeof(step0), CL_MEM_READ_WRITE);
+        s->info_gpu = gpu_cl_create_gpu(gpu, size * ctx->info_doubles * sizeof(*ctx->info), CL_MEM_READ_WRITE);
+        gpu_cl_write_gpu(&s->gpu, size * sizeof(*gp), 0, gp, s->gp_gpu);
+        gpu_cl_write_gpu(&s->gpu, size * sizeof(*m), 0, m, s->m_gpu);
+        gpu_cl_write_gpu(&s->gpu, sizeof(step0), 0, &step0, s->step_gpu);
+        mfree(gp);
+        mfree(m);
+
+        s->band_low = mmalloc(halo * cols * sizeof(*s->band_low));
+        s->band_high = mmalloc(halo * cols * sizeof(*s->band_high));
+
+        s->step_id = gpu_cl_append_kernel(gpu, "gpu_step");
+        s->advance_id = gpu_cl_append_kernel(gpu, "advance_step");
+        s->info_id = gpu_cl_append_kernel(gpu, "extract_info");
+        gpu_cl_fill_kernel_args(gpu, s->step_id, 0, 11, &s->gp_gpu, sizeof(cl_mem),
+                                                        &s->m_gpu, sizeof(cl_mem),
+                                                        &s->swap_gpu, sizeof(cl_mem),
+                                                        &ctx->params.dt, sizeof(double),
+                                                        &ctx->time0, sizeof(double),
+                                                        &s->gi, sizeof(grid_info),
+                                                        &method, sizeof(int),
+                                                        &g->dipolar_gpu, sizeof(cl_mem),
+                                                        &ctx->dipolar_cache_gpu, sizeof(cl_mem),
+                                                        &dipolar_cached, sizeof(int),
+                                                        &s->step_gpu, sizeof(cl_mem));
+        gpu_cl_fill_kernel_args(gpu, s->advance_id, 0, 5, &s->m_gpu, sizeof(cl_mem), &s->swap_gpu, sizeof(cl_mem), &s->step_gpu, sizeof(cl_mem), &s->gi.rows, sizeof(s->gi.rows), &s->gi.cols, sizeof(s->gi.cols));
+        gpu_cl_fill_kernel_args(gpu, s->info_id, 0, 10, &s->gp_gpu, sizeof(cl_mem),
+                                                        &s->m_gpu, sizeof(cl_mem),
+                                                        &s->swap_gpu, sizeof(cl_mem),
+                                                        &s->info_gpu, sizeof(cl_mem),
+                                                        &ctx->params.dt, sizeof(double),
+                                                        &ctx->time, sizeof(double),
+                                                        &s->gi, sizeof(grid_info),
+                                                        &g->dipolar_gpu, sizeof(cl_mem),
+                                                        &ctx->dipolar_cache_gpu, sizeof(cl_mem),
+                                                        &dipolar_cached, sizeof(int));
+        logging_log(LOG_INFO, "Slab %"PRIu64" holds rows %"PRIu64"-%"PRIu64" on device %"PRIu64, i, s->row0, s->row0 + s->rows - 1, device);
+    }
+
+    //tuned on the whole slab, the partial launches reuse the tile
+    for (uint64_t i = 0; i < n; ++i) {
+        integrate_slab *s = &ctx->slabs[i];
+        gpu_cl_tune_kernel(integrate_slab_gpu(ctx, s), s->step_id, cols, s->gi.rows);
+        gpu_cl_tune_kernel(integrate_slab_gpu(ctx, s), s->info_id, cols, s->gi.rows);
+    }
+}
+
+static void integrate_slabs_close(integrate_context *ctx) {
+    for (uint64_t i = 0; i < ctx->n_slabs; ++i) {
+        integrate_slab *s = &ctx->slabs[i];
+        gpu_cl_release_memory(s->gp_gpu);
+        gpu_cl_release_memory(s->m_gpu);
+        gpu_cl_release_memory(s->swap_gpu);
+        gpu_cl_release_memory(s->step_gpu);
+        gpu_cl_release_memory(s->info_gpu);
+        gpu_cl_release_queue(s->gpu.queue);
+        gpu_cl_release_queue(s->transfer.queue);
+        mfree(s->band_low);
+        mfree(s->band_high);
+    }
+    mfree(ctx->slabs);
+    ctx->slabs = NULL;
+    ctx->n_slabs = 0;
+}
 
 
 integrate_context integrate_context_init(grid *grid, gpu_cl *gpu, integrate_params params) {
@@ -18,23 +167,84 @@ integrate_context integrate_context_init(grid *grid, gpu_cl *gpu, integrate_para
     ctx.gpu = gpu;
     grid_to_gpu(grid, *gpu);
     ctx.params = params;
+    ctx.params.observables = integrate_kernel_observables(gpu, params.observables);
+    //at least one double per site, so the buffers stay valid when nothing is selected
+    ctx.info_doubles = integrate_info_doubles(ctx.params.observables);
+    ctx.info_doubles = ctx.info_doubles? ctx.info_doubles: 1;
     ctx.time = 0.0;
+    ctx.time0 = ctx.time;
     ctx.swap_gpu = gpu_cl_create_gpu(gpu, sizeof(*grid->m) * grid->gi.rows * grid->gi.cols, CL_MEM_READ_WRITE);
     ctx.step_id = gpu_cl_append_kernel(gpu, "gpu_step");
-    ctx.exchange_id = gpu_cl_append_kernel(gpu, "exchange_grid");
+    ctx.advance_id = gpu_cl_append_kernel(gpu, "advance_step");
 
-    gpu_cl_fill_kernel_args(gpu, ctx.step_id, 0, 6, &grid->gp_gpu, sizeof(cl_mem),
-                            &grid->m_gpu, sizeof(cl_mem),
-                            &ctx.swap_gpu, sizeof(cl_mem),
-                            &params.dt, sizeof(double),
-                            &ctx.time, sizeof(double),
-                            &grid->gi, sizeof(grid_info));
+    cl_ulong step0 = 0;
+    ctx.step_gpu = gpu_cl_create_gpu(gpu, sizeof(step0), CL_MEM_READ_WRITE);
+    gpu_cl_write_gpu(gpu, sizeof(step0), 0, &step0, ctx.step_gpu);
 
-    gpu_cl_fill_kernel_args(gpu, ctx.exchange_id, 0, 4, &grid->m_gpu, sizeof(cl_mem), &ctx.swap_gpu, sizeof(cl_mem), &ctx.g->gi.rows, sizeof(ctx.g->gi.rows), &ctx.g->gi.cols, sizeof(ctx.g->gi.cols));
     ctx.global = grid->gi.cols * grid->gi.rows;
     ctx.global = ctx.global + (gpu_optimal_wg - ctx.global % gpu_optimal_wg);
     ctx.local = gpu_optimal_wg;
 
+    //without multirate the buffers are placeholders, gpu_step computes the dipolar sum itself.
+    //without INCLUDE_DIPOLAR the kernels never read the field, so there is nothing to refresh
+    bool dipolar = params.compile_augment && strstr(params.compile_augment, "INCLUDE_DIPOLAR");
+    bool multirate = params.dipolar == DIPOLAR_BARNES_HUT || params.dipolar_refresh_steps > 1 || params.dipolar_refresh_threshold > 0.0;
+    if (multirate && !dipolar)
+        logging_log(LOG_WARNING, "Multirate or Barnes-Hut dipolar selected without -DINCLUDE_DIPOLAR, ignoring it");
+    ctx.dipolar_multirate = multirate && dipolar;
+    uint64_t dipolar_size_bytes = ctx.dipolar_multirate? sizeof(*grid->m) * grid->gi.rows * grid->gi.cols: sizeof(*grid->m);
+    ctx.dipolar_cache_gpu = gpu_cl_create_gpu(gpu, dipolar_size_bytes, CL_MEM_READ_WRITE);
+    ctx.dipolar_reference_gpu = gpu_cl_create_gpu(gpu, dipolar_size_bytes, CL_MEM_READ_WRITE);
+    ctx.dipolar_drift = mmalloc(ctx.global / ctx.local * sizeof(*ctx.dipolar_drift));
+    ctx.dipolar_drift_gpu = gpu_cl_create_gpu(gpu, ctx.global / ctx.local * sizeof(*ctx.dipolar_drift), CL_MEM_READ_WRITE);
+    ctx.dipolar_refresh_id = gpu_cl_append_kernel(gpu, "dipolar_refresh");
+    ctx.dipolar_drift_id = gpu_cl_append_kernel(gpu, "dipolar_drift");
+
+    gpu_cl_fill_kernel_args(gpu, ctx.dipolar_refresh_id, 0, 6, &grid->gp_gpu, sizeof(cl_mem),
+                                                                &grid->m_gpu, sizeof(cl_mem),
+                                                                &grid->dipolar_gpu, sizeof(cl_mem),
+                                                                &ctx.dipolar_cache_gpu, sizeof(cl_mem),
+                                                                &ctx.dipolar_reference_gpu, sizeof(cl_mem),
+                                                                &grid->gi, sizeof(grid_info));
+    gpu_cl_fill_kernel_args(gpu, ctx.dipolar_drift_id, 0, 2, &grid->m_gpu, sizeof(cl_mem), &ctx.dipolar_reference_gpu, sizeof(cl_mem));
+    gpu_cl_set_kernel_arg(gpu, ctx.dipolar_drift_id, 2, ctx.local * sizeof(double), NULL);
+    gpu_cl_fill_kernel_args(gpu, ctx.dipolar_drift_id, 3, 3, &ctx.dipolar_drift_gpu, sizeof(cl_mem), &grid->gi.rows, sizeof(grid->gi.rows), &grid->gi.cols, sizeof(grid->gi.cols));
+
+    uint64_t dipolar_nodes = 0;
+    if (ctx.dipolar_multirate && params.dipolar == DIPOLAR_BARNES_HUT)
+        ctx.dipolar_top_level = integrate_dipolar_tree_levels(grid->gi, ctx.dipolar_level_cells, &dipolar_nodes);
+    ctx.dipolar_nodes_gpu = gpu_cl_create_gpu(gpu, (dipolar_nodes? dipolar_nodes: 1) * sizeof(dipolar_node), CL_MEM_READ_WRITE);
+    ctx.dipolar_leaves_id = gpu_cl_append_kernel(gpu, "dipolar_tree_leaves");
+    ctx.dipolar_level_id = gpu_cl_append_kernel(gpu, "dipolar_tree_level");
+    ctx.dipolar_tree_id = gpu_cl_append_kernel(gpu, "dipolar_tree_field");
+
+    gpu_cl_fill_kernel_args(gpu, ctx.dipolar_leaves_id, 0, 5, &grid->gp_gpu, sizeof(cl_mem),
+                                                               &grid->m_gpu, sizeof(cl_mem),
+                                                               &ctx.dipolar_nodes_gpu, sizeof(cl_mem),
+                                                               &ctx.dipolar_reference_gpu, sizeof(cl_mem),
+                                                               &grid->gi, sizeof(grid_info));
+    gpu_cl_fill_kernel_args(gpu, ctx.dipolar_level_id, 0, 2, &ctx.dipolar_nodes_gpu, sizeof(cl_mem), &grid->gi, sizeof(grid_info));
+    gpu_cl_fill_kernel_args(gpu, ctx.dipolar_tree_id, 0, 4, &ctx.dipolar_nodes_gpu, sizeof(cl_mem),
+                                                            &ctx.dipolar_cache_gpu, sizeof(cl_mem),
+                                                            &grid->gi, sizeof(grid_info),
+                                                            &params.dipolar_theta, sizeof(double));
+
+    int method = params.method;
+    int dipolar_cached = ctx.dipolar_multirate;
+    gpu_cl_fill_kernel_args(gpu, ctx.step_id, 0, 11, &grid->gp_gpu, sizeof(cl_mem),
+                            &grid->m_gpu, sizeof(cl_mem),
+                            &ctx.swap_gpu, sizeof(cl_mem),
+                            &params.dt, sizeof(double),
+                            &ctx.time0, sizeof(double),
+                            &grid->gi, sizeof(grid_info),
+                            &method, sizeof(int),
+                            &grid->dipolar_gpu, sizeof(cl_mem),
+                            &ctx.dipolar_cache_gpu, sizeof(cl_mem),
+                            &dipolar_cached, sizeof(int),
+                            &ctx.step_gpu, sizeof(cl_mem));
+
+    gpu_cl_fill_kernel_args(gpu, ctx.advance_id, 0, 5, &grid->m_gpu, sizeof(cl_mem), &ctx.swap_gpu, sizeof(cl_mem), &ctx.step_gpu, sizeof(cl_mem), &ctx.g->gi.rows, sizeof(ctx.g->gi.rows), &ctx.g->gi.cols, sizeof(ctx.g->gi.cols));
+
     string_builder output_info_path = {0};
     sb_cat_cstr(&output_info_path, params.output_path);
     sb_cat_cstr(&output_info_path, "/integrate_info.dat");
@@ -44,15 +254,18 @@ integrate_context integrate_context_init(grid *grid, gpu_cl *gpu, integrate_para
 
     sb_free(&output_info_path);
 
-    fprintf(ctx.integrate_info, "time(s),energy(J),exchange_energy(J),dm_energy(J),field_energy(J),anisotropy_energy(J),cubic_anisotropy_energy(J),dipolar_energy(J),");
-    fprintf(ctx.integrate_info, "charge_finite,charge_lattice,");
-    fprintf(ctx.integrate_info, "avg_mx,avg_my,avg_mz,");
-    fprintf(ctx.integrate_info, "electric_x(V/m),electric_y(V/m),electric_z(V/m),");
-    fprintf(ctx.integrate_info, "magnetic_lattice_x(T),magnetic_lattice_y(T),magnetic_lattice_z(T),");
-    fprintf(ctx.integrate_info, "magnetic_finite_x(T),magnetic_finite_y(T),magnetic_finite_z(T),");
-    fprintf(ctx.integrate_info, "charge_center_x(m),charge_center_y(m),");
-    fprintf(ctx.integrate_info, "abs_charge_center_x(m),abs_charge_center_y(m),");
-    fprintf(ctx.integrate_info, "D_xx,D_yy,D_xy\n");
+#ifdef PROFILING
+    if (params.profile_trace) {
+        string_builder trace_path = {0};
+        sb_cat_cstr(&trace_path, params.output_path);
+        sb_cat_cstr(&trace_path, "/trace.json");
+        if (!gpu_profiler_trace_open(gpu->profiler, sb_as_cstr(&trace_path)))
+            logging_log(LOG_WARNING, "Could not open kernel trace \"%s\"", sb_as_cstr(&trace_path));
+        sb_free(&trace_path);
+    }
+#endif
+
+    integrate_print_info_header(ctx.integrate_info, ctx.params.observables);
 
     if (params.do_cluster) {
         string_builder output_cluster_path = {0};
@@ -73,25 +286,70 @@ integrate_context integrate_context_init(grid *grid, gpu_cl *gpu, integrate_para
     massert(ctx.integrate_info);
     sb_free(&output_grid_path);
 
+    //buffers the host only reads are mapped instead of copied when the device shares its memory
+    ctx.zero_copy = gpu_cl_unified_memory(gpu);
+    cl_mem_flags host_flags = CL_MEM_READ_WRITE | (ctx.zero_copy? CL_MEM_ALLOC_HOST_PTR: 0);
+    if (ctx.zero_copy)
+        logging_log(LOG_INFO, "Device shares the host memory, integrate output is mapped");
+
     ctx.info_id = gpu_cl_append_kernel(gpu, "extract_info");
-    ctx.info = mmalloc(grid->gi.rows * grid->gi.cols * sizeof(*ctx.info));
-    ctx.info_gpu = gpu_cl_create_gpu(gpu, grid->gi.rows * grid->gi.cols * sizeof(*ctx.info), CL_MEM_READ_WRITE);
+    ctx.info = mmalloc(grid->gi.rows * grid->gi.cols * ctx.info_doubles * sizeof(*ctx.info));
+    ctx.info_gpu = gpu_cl_create_gpu(gpu, grid->gi.rows * grid->gi.cols * ctx.info_doubles * sizeof(*ctx.info), host_flags);
 
-    gpu_cl_fill_kernel_args(gpu, ctx.info_id, 0, 7, &grid->gp_gpu, sizeof(cl_mem),
+    gpu_cl_fill_kernel_args(gpu, ctx.info_id, 0, 10, &grid->gp_gpu, sizeof(cl_mem),
                                                      &grid->m_gpu, sizeof(cl_mem),
                                                      &ctx.swap_gpu, sizeof(cl_mem),
                                                      &ctx.info_gpu, sizeof(cl_mem),
                                                      &ctx.params.dt, sizeof(double),
                                                      &ctx.time, sizeof(double),
-                                                     &grid->gi, sizeof(grid_info));
+                                                     &grid->gi, sizeof(grid_info),
+                                                     &grid->dipolar_gpu, sizeof(cl_mem),
+                                                     &ctx.dipolar_cache_gpu, sizeof(cl_mem),
+                                                     &dipolar_cached, sizeof(int));
 
+    //partial sums land in info_gpu, which has room for a group per site
+    ctx.step_info_id = gpu_cl_append_kernel(gpu, "gpu_step_info");
+    gpu_cl_fill_kernel_args(gpu, ctx.step_info_id, 0, 9, &grid->gp_gpu, sizeof(cl_mem),
+                                                         &grid->m_gpu, sizeof(cl_mem),
+                                                         &ctx.swap_gpu, sizeof(cl_mem),
+                                                         &params.dt, sizeof(double),
+                                                         &ctx.time0, sizeof(double),
+                                                         &grid->gi, sizeof(grid_info),
+                                                         &method, sizeof(int),
+                                                         &grid->dipolar_gpu, sizeof(cl_mem),
+                                                         &ctx.step_gpu, sizeof(cl_mem));
+    gpu_cl_set_kernel_arg(gpu, ctx.step_info_id, 9, gpu_cl_kernel_max_group(gpu, ctx.step_info_id) * sizeof(double), NULL);
+    gpu_cl_set_kernel_arg(gpu, ctx.step_info_id, 10, sizeof(cl_mem), &ctx.info_gpu);
+
+    //the output buffer is the snapshot's, set at every render
     ctx.render_id = gpu_cl_append_kernel(gpu, "render_grid_hsl");
-    ctx.rgb = mmalloc(grid->gi.rows * grid->gi.cols * sizeof(*ctx.rgb));
-    ctx.rgb_gpu = gpu_cl_create_gpu(gpu, grid->gi.rows * grid->gi.cols * sizeof(*ctx.rgb), CL_MEM_READ_WRITE);
+    gpu_cl_fill_kernel_args(gpu, ctx.render_id, 0, 2, &grid->m_gpu, sizeof(cl_mem), &grid->gi, sizeof(grid->gi));
+    gpu_cl_fill_kernel_args(gpu, ctx.render_id, 3, 2, &grid->gi.cols, sizeof(grid->gi.cols), &grid->gi.rows, sizeof(grid->gi.rows));
 
-    gpu_cl_fill_kernel_args(gpu, ctx.render_id, 0, 5, &grid->m_gpu, sizeof(cl_mem), &grid->gi, sizeof(grid->gi), &ctx.rgb_gpu, sizeof(cl_mem), &grid->gi.cols, sizeof(grid->gi.cols), &grid->gi.rows, sizeof(grid->gi.rows));
+    ctx.transfer = *gpu;
+    ctx.transfer.queue = gpu_cl_create_queue(gpu, gpu->queue_device);
+    for (uint64_t i = 0; i < INTEGRATE_SNAPSHOTS; ++i) {
+        integrate_snapshot *s = &ctx.snapshots[i];
+        //with zero_copy these point into the mapped buffers while a snapshot is in flight
+        if (!ctx.zero_copy) {
+            s->m = mmalloc(grid->gi.rows * grid->gi.cols * sizeof(*s->m));
+            s->rgb = mmalloc(grid->gi.rows * grid->gi.cols * sizeof(*s->rgb));
+        }
+        s->m_gpu = gpu_cl_create_gpu(gpu, grid->gi.rows * grid->gi.cols * sizeof(*s->m), host_flags);
+        s->rgb_gpu = gpu_cl_create_gpu(gpu, grid->gi.rows * grid->gi.cols * sizeof(*s->rgb), host_flags);
+    }
+
+    if (params.n_slabs > 1) {
+        //slabs only see their halos, the dipolar sum needs the whole lattice
+        if (dipolar)
+            logging_log(LOG_WARNING, "Dipolar runs can not be split in slabs, integrating on a single device");
+        else
+            integrate_slabs_init(&ctx);
+    }
 
     uint64_t expected_steps = params.duration / params.dt + 1;
+    if (!ctx.params.observables)
+        ctx.params.interval_for_information = 0;
     if (ctx.params.interval_for_information == 0)
         ctx.params.interval_for_information = expected_steps + 1;
 
@@ -101,26 +359,61 @@ integrate_context integrate_context_init(grid *grid, gpu_cl *gpu, integrate_para
     if (ctx.params.interval_for_rgb_grid == 0)
         ctx.params.interval_for_rgb_grid = expected_steps + 1;
 
+    //step 0 always has a frame, even without interval_for_rgb_grid
+    string_builder rgb_path = {0};
+    sb_cat_cstr(&rgb_path, params.output_path);
+    sb_cat_cstr(&rgb_path, "/");
+    sb_cat_cstr(&rgb_path, video_file_name(params.rgb_video.format));
+    ctx.rgb_video = video_writer_open(sb_as_cstr(&rgb_path), grid->gi.cols, grid->gi.rows, params.rgb_video);
+    sb_free(&rgb_path);
+
     uint64_t number_raw = 3 + expected_steps / ctx.params.interval_for_raw_grid;
     uint64_t number_rgb = 3 + expected_steps / ctx.params.interval_for_rgb_grid;
     logging_log(LOG_INFO, "Expected raw frames written %"PRIu64, number_raw);
     logging_log(LOG_INFO, "Expected rgb frames written %"PRIu64, number_rgb);
 
+    //a bank never holds more than the run writes
+    uint64_t frame_size = grid->gi.rows * grid->gi.cols * sizeof(*grid->m);
+    ctx.raw_ring_frames = params.raw_ring_frames;
+    if (ctx.raw_ring_frames > INTEGRATE_RAW_RING_MAX_BYTES / (INTEGRATE_RAW_BANKS * frame_size))
+        ctx.raw_ring_frames = INTEGRATE_RAW_RING_MAX_BYTES / (INTEGRATE_RAW_BANKS * frame_size);
+    if (ctx.raw_ring_frames > number_raw)
+        ctx.raw_ring_frames = number_raw;
+    if (ctx.raw_ring_frames < 1)
+        ctx.raw_ring_frames = 1;
+    for (uint64_t i = 0; i < INTEGRATE_RAW_BANKS; ++i) {
+        integrate_raw_bank *b = &ctx.raw_banks[i];
+        if (!ctx.zero_copy)
+            b->m = mmalloc(ctx.raw_ring_frames * frame_size);
+        b->m_gpu = gpu_cl_create_gpu(gpu, ctx.raw_ring_frames * frame_size, host_flags);
+    }
+    logging_log(LOG_INFO, "Raw frames read back %"PRIu64" at a time", ctx.raw_ring_frames);
+
     fwrite(&number_raw, sizeof(number_raw), 1, ctx.integrate_evolution);
     grid_dump(ctx.integrate_evolution, grid);
 
     uint64_t dump_size = grid->gi.rows * grid->gi.cols * (sizeof(*grid->gp) + number_raw * sizeof(*grid->m)) + sizeof(number_raw);
     logging_log(LOG_INFO, "Expected raw grid dump %.2f MB", dump_size / 1.0e6);
-    logging_log(LOG_INFO, "Expected rgb grid dump %.2f MB", sizeof(*ctx.rgb) * grid->gi.rows * grid->gi.cols * number_rgb / 1.0e6);
+    logging_log(LOG_INFO, "Expected rgb grid dump %.2f MB", sizeof(RGBA32) * grid->gi.rows * grid->gi.cols * number_rgb / 1.0e6);
     return ctx;
 }
 
 void integrate_context_close(integrate_context *ctx) {
+    integrate_context_flush_output(ctx);
+    integrate_context_sync_grid(ctx);
     grid_from_gpu(ctx->g, *ctx->gpu);
+#ifdef PROFILING
+    gpu_profiler_summary(ctx->gpu->profiler, stdout);
+    gpu_profiler_trace_close(ctx->gpu->profiler);
+    profiler_print_measures(stdout);
+#endif
     gpu_cl_release_memory(ctx->swap_gpu);
+    gpu_cl_release_memory(ctx->step_gpu);
+    integrate_slabs_close(ctx);
     
     mfclose(ctx->integrate_info);
     mfclose(ctx->integrate_evolution);
+    video_writer_close(ctx->rgb_video);
 
     if (ctx->params.do_cluster)
         mfclose(ctx->clusters);
@@ -128,8 +421,23 @@ void integrate_context_close(integrate_context *ctx) {
     gpu_cl_release_memory(ctx->info_gpu);
     mfree(ctx->info);
 
-    gpu_cl_release_memory(ctx->rgb_gpu);
-    mfree(ctx->rgb);
+    for (uint64_t i = 0; i < INTEGRATE_SNAPSHOTS; ++i) {
+        gpu_cl_release_memory(ctx->snapshots[i].m_gpu);
+        gpu_cl_release_memory(ctx->snapshots[i].rgb_gpu);
+        mfree(ctx->snapshots[i].m);
+        mfree(ctx->snapshots[i].rgb);
+    }
+    for (uint64_t i = 0; i < INTEGRATE_RAW_BANKS; ++i) {
+        gpu_cl_release_memory(ctx->raw_banks[i].m_gpu);
+        mfree(ctx->raw_banks[i].m);
+    }
+    gpu_cl_release_queue(ctx->transfer.queue);
+
+    gpu_cl_release_memory(ctx->dipolar_cache_gpu);
+    gpu_cl_release_memory(ctx->dipolar_reference_gpu);
+    gpu_cl_release_memory(ctx->dipolar_drift_gpu);
+    gpu_cl_release_memory(ctx->dipolar_nodes_gpu);
+    mfree(ctx->dipolar_drift);
 
     grid_release_from_gpu(ctx->g);
     gpu_cl_close(ctx->gpu);
@@ -139,10 +447,20 @@ integrate_params integrate_params_init(void) {
     integrate_params ret = {0};
     ret.dt = 1.0e-15;
     ret.duration = 200.0 * NS;
+    ret.method = INTEGRATE_RK4; //INTEGRATE_MIDPOINT conserves |m| and tolerates larger dt on precession-dominated runs
+    ret.dipolar_refresh_steps = 1;
+    ret.dipolar_refresh_threshold = 0.0;
+    ret.dipolar = DIPOLAR_DIRECT;
+    ret.dipolar_theta = 0.5;
+    ret.n_slabs = 0;
+    ret.slab_halo = 1;
     ret.interval_for_information = 1000;
+    ret.observables = INFO_ALL;
     ret.interval_for_cluster = ret.interval_for_information;
     ret.interval_for_raw_grid = 10000;
+    ret.raw_ring_frames = 32;
     ret.interval_for_rgb_grid = 50000;
+    ret.rgb_video = video_params_init();
 
     ret.cluster_eps = 0.1;
     ret.cluster_min_pts = 5;
@@ -158,121 +476,594 @@ integrate_params integrate_params_init(void) {
 }
 
 void integrate(grid *g, integrate_params params) {
-    gpu_cl gpu = gpu_cl_init(params.current_func, params.field_func, params.temperature_func, NULL, params.compile_augment);
+    char *compile = integrate_compile_augment(params);
+    gpu_cl gpu = gpu_session_borrow(params.session, params.current_func, params.field_func, params.temperature_func, NULL, compile, grid_kernel_terms(g));
+    mfree(compile);
     integrate_context ctx = integrate_context_init(g, &gpu, params);
 
     uint64_t expected_steps = params.duration / params.dt + 1;
     logging_log(LOG_INFO, "Expected integrate steps: %"PRIu64, expected_steps);
 
-    for (unsigned int t = 0; t < expected_steps; ++t) {
-        integrate_step(&ctx);
-
-        if (ctx.integrate_step % (expected_steps / 100 + 1) == 0)
-            logging_log(LOG_INFO, "%.3es - %.2f%%", ctx.time, ctx.time / params.duration * 100.0);
-
-        integrate_exchange_grids(&ctx);
+    uint64_t chunk = expected_steps / 100 + 1;
+    while (ctx.integrate_step < expected_steps) {
+        integrate_run_steps(&ctx, ctx.integrate_step + chunk > expected_steps? expected_steps - ctx.integrate_step: chunk);
+        logging_log(LOG_INFO, "%.3es - %.2f%%", ctx.time, ctx.time / params.duration * 100.0);
     }
     logging_log(LOG_INFO, "Steps: %d", ctx.integrate_step);
+    if (ctx.dipolar_multirate)
+        logging_log(LOG_INFO, "Dipolar field refreshes: %"PRIu64, ctx.dipolar_refreshes);
 
+    integrate_context_flush_output(&ctx);
+    integrate_context_sync_grid(&ctx);
     v3d_from_gpu(g->m, g->m_gpu, g->gi.rows, g->gi.cols, gpu);
     v3d_dump(ctx.integrate_evolution, g->m, g->gi.rows, g->gi.cols);
-
-    gpu_cl_enqueue_nd(ctx.gpu, ctx.render_id, 1, &ctx.local, &ctx.global, NULL);
-    gpu_cl_read_gpu(ctx.gpu, ctx.g->gi.cols * ctx.g->gi.rows * sizeof(*ctx.rgb), 0, ctx.rgb, ctx.rgb_gpu);
     integrate_context_close(&ctx);
 }
 
-void integrate_step(integrate_context *ctx) {
-    gpu_cl_set_kernel_arg(ctx->gpu, ctx->step_id, 4, sizeof(ctx->time), &ctx->time);
-    gpu_cl_enqueue_nd(ctx->gpu, ctx->step_id, 1, &ctx->local, &ctx->global, NULL);
-    bool read_grid_from_gpu = false;
-
-    if (ctx->integrate_step % ctx->params.interval_for_information == 0) {
-        information_packed info = integrate_get_info(ctx);
-        fprintf(ctx->integrate_info, "%.15e,%.15e,%.15e,%.15e,%.15e,%.15e,%.15e,%.15e,", ctx->time, info.energy, info.exchange_energy, info.dm_energy, info.field_energy, info.anisotropy_energy, info.cubic_energy, info.dipolar_energy);
-        fprintf(ctx->integrate_info, "%.15e,%.15e,", info.charge_finite, info.charge_lattice);
-        fprintf(ctx->integrate_info, "%.15e,%.15e,%.15e,", info.avg_m.x, info.avg_m.y, info.avg_m.z);
-        fprintf(ctx->integrate_info, "%.15e,%.15e,%.15e,", info.electric_field.x, info.electric_field.y, info.electric_field.z);
-        fprintf(ctx->integrate_info, "%.15e,%.15e,%.15e,", info.magnetic_field_lattice.x, info.magnetic_field_lattice.y, info.magnetic_field_lattice.z);
-        fprintf(ctx->integrate_info, "%.15e,%.15e,%.15e,", info.magnetic_field_finite.x, info.magnetic_field_finite.y, info.magnetic_field_finite.z);
-        fprintf(ctx->integrate_info, "%.15e,%.15e,", info.charge_center_x / info.charge_finite, info.charge_center_y / info.charge_finite);
-        fprintf(ctx->integrate_info, "%.15e,%.15e,", info.abs_charge_center_x / info.abs_charge_finite, info.abs_charge_center_y / info.abs_charge_finite);
-        fprintf(ctx->integrate_info, "%.15e,%.15e,%.15e\n", info.D_xx, info.D_yy, info.D_xy);
-    }
-
-    if (ctx->integrate_step % ctx->params.interval_for_raw_grid == 0) {
-        v3d_from_gpu(ctx->g->m, ctx->g->m_gpu, ctx->g->gi.rows, ctx->g->gi.cols, *ctx->gpu);
-        v3d_dump(ctx->integrate_evolution, ctx->g->m, ctx->g->gi.rows, ctx->g->gi.cols);
-        read_grid_from_gpu = true;
+static void integrate_build_dipolar_tree(integrate_context *ctx) {
+    gpu_cl_enqueue_nd(ctx->gpu, ctx->dipolar_leaves_id, 1, &ctx->local, &ctx->global, NULL);
+    for (int level = 1; level <= ctx->dipolar_top_level; ++level) {
+        uint64_t global = ctx->dipolar_level_cells[level];
+        global = global + (ctx->local - global % ctx->local);
+        gpu_cl_set_kernel_arg(ctx->gpu, ctx->dipolar_level_id, 2, sizeof(level), &level);
+        gpu_cl_enqueue_nd(ctx->gpu, ctx->dipolar_level_id, 1, &ctx->local, &global, NULL);
+    }
+    gpu_cl_enqueue_nd(ctx->gpu, ctx->dipolar_tree_id, 1, &ctx->local, &ctx->global, NULL);
+}
+
+static void integrate_refresh_dipolar(integrate_context *ctx) {
+    //with only a threshold the steps criterion is off, Barnes-Hut without either refreshes every step
+    uint64_t every = ctx->params.dipolar_refresh_steps;
+    if (every <= 1 && ctx->params.dipolar_refresh_threshold > 0.0)
+        every = 0;
+    else if (every == 0)
+        every = 1;
+    uint64_t since = ctx->integrate_step - ctx->dipolar_last_refresh;
+    bool refresh = ctx->dipolar_refreshes == 0 || (every && since >= every);
+
+    if (!refresh && ctx->params.dipolar_refresh_threshold > 0.0) {
+        gpu_cl_enqueue_nd(ctx->gpu, ctx->dipolar_drift_id, 1, &ctx->local, &ctx->global, NULL);
+        gpu_cl_read_gpu(ctx->gpu, ctx->global / ctx->local * sizeof(*ctx->dipolar_drift), 0, ctx->dipolar_drift, ctx->dipolar_drift_gpu);
+        for (uint64_t i = 0; i < ctx->global / ctx->local && !refresh; ++i)
+            refresh = ctx->dipolar_drift[i] > ctx->params.dipolar_refresh_threshold;
+    }
+
+    if (refresh) {
+        if (ctx->params.dipolar == DIPOLAR_BARNES_HUT)
+            integrate_build_dipolar_tree(ctx);
+        else
+            gpu_cl_enqueue_tuned(ctx->gpu, ctx->dipolar_refresh_id, ctx->g->gi.cols, ctx->g->gi.rows);
+        ctx->dipolar_last_refresh = ctx->integrate_step;
+        ctx->dipolar_refreshes++;
+    }
+}
+
+//launches over buffer rows [first, first + count) of the slab
+static void integrate_slab_launch(integrate_context *ctx, integrate_slab *s, uint64_t kernel, uint64_t first, uint64_t count, uint64_t n_wait, cl_event *wait) {
+    if (count == 0)
+        return;
+    gpu_cl *gpu = integrate_slab_gpu(ctx, s);
+    kernel_t *k = &gpu->kernels[kernel];
+    uint64_t global[2] = {k->global[0], count + (k->local[1] - count % k->local[1]) % k->local[1]};
+    uint64_t offset[2] = {0, first};
+    gpu_cl_enqueue_nd_wait(gpu, kernel, 2, k->local, global, offset, n_wait, wait);
+}
+
+static void integrate_slabs_exchange(integrate_context *ctx) {
+    uint64_t halo = ctx->slab_halo;
+    uint64_t n = ctx->n_slabs;
+    uint64_t row_bytes = ctx->g->gi.cols * sizeof(v3d);
+    uint64_t band = halo * row_bytes;
+
+    for (uint64_t i = 0; i < n; ++i) {
+        integrate_slab *s = &ctx->slabs[i];
+        gpu_cl_read_gpu_async(&s->gpu, band, s->halo_low * row_bytes, s->band_low, s->m_gpu, &s->reads[0]);
+        gpu_cl_read_gpu_async(&s->gpu, band, (s->halo_low + s->rows - halo) * row_bytes, s->band_high, s->m_gpu, &s->reads[1]);
+    }
+
+    //rows that do not touch a halo go first, the bands travel meanwhile
+    for (uint64_t i = 0; i < n; ++i) {
+        integrate_slab *s = &ctx->slabs[i];
+        uint64_t first = s->halo_low? s->halo_low + 1: 0;
+        uint64_t last = s->halo_high? s->halo_low + s->rows - 1: s->gi.rows;
+        integrate_slab_launch(ctx, s, s->step_id, first, last - first, 0, NULL);
+    }
+
+    for (uint64_t i = 0; i < n; ++i)
+        gpu_cl_wait_events(2, ctx->slabs[i].reads);
+
+    for (uint64_t i = 0; i < n; ++i) {
+        integrate_slab *s = &ctx->slabs[i];
+        s->n_writes = 0;
+        if (s->halo_low)
+            gpu_cl_write_gpu_async(&s->transfer, band, 0, ctx->slabs[(i + n - 1) % n].band_high, s->m_gpu, &s->writes[s->n_writes++]);
+        if (s->halo_high)
+            gpu_cl_write_gpu_async(&s->transfer, band, (s->halo_low + s->rows) * row_bytes, ctx->slabs[(i + 1) % n].band_low, s->m_gpu, &s->writes[s->n_writes++]);
+    }
+
+    for (uint64_t i = 0; i < n; ++i) {
+        integrate_slab *s = &ctx->slabs[i];
+        if (s->halo_low)
+            integrate_slab_launch(ctx, s, s->step_id, 1, halo, s->n_writes, s->writes);
+        if (s->halo_high)
+            integrate_slab_launch(ctx, s, s->step_id, s->halo_low + s->rows - 1, halo, s->n_writes, s->writes);
+    }
+
+    //the launches already hold the dependency, this only returns the events
+    for (uint64_t i = 0; i < n; ++i)
+        gpu_cl_wait_events(ctx->slabs[i].n_writes, ctx->slabs[i].writes);
+    ctx->slab_phase = 0;
+}
+
+//each step trusts one row less next to every halo, until the halos are refilled
+static void integrate_slabs_step(integrate_context *ctx) {
+    if (ctx->slab_phase == ctx->slab_halo) {
+        integrate_slabs_exchange(ctx);
+        return;
+    }
+    uint64_t k = ctx->slab_phase;
+    for (uint64_t i = 0; i < ctx->n_slabs; ++i) {
+        integrate_slab *s = &ctx->slabs[i];
+        uint64_t first = s->halo_low? k + 1: 0;
+        uint64_t last = s->halo_high? s->gi.rows - k - 1: s->gi.rows;
+        integrate_slab_launch(ctx, s, s->step_id, first, last - first, 0, NULL);
+    }
+}
+
+static void integrate_slabs_advance(integrate_context *ctx) {
+    for (uint64_t i = 0; i < ctx->n_slabs; ++i) {
+        integrate_slab *s = &ctx->slabs[i];
+        gpu_cl_enqueue_nd(integrate_slab_gpu(ctx, s), s->advance_id, 1, &ctx->local, &s->global, NULL);
     }
+    ctx->slab_phase++;
+}
 
-    if (ctx->integrate_step % ctx->params.interval_for_rgb_grid == 0) {
-        gpu_cl_enqueue_nd(ctx->gpu, ctx->render_id, 1, &ctx->local, &ctx->global, NULL);
-        gpu_cl_read_gpu(ctx->gpu, ctx->g->gi.cols * ctx->g->gi.rows * sizeof(*ctx->rgb), 0, ctx->rgb, ctx->rgb_gpu);
-        char buffer[1024];
-        snprintf(buffer, sizeof(buffer), "%s/frame_%"PRIu64".png", ctx->params.output_path, ctx->integrate_step);
-        stbi_write_png(buffer, ctx->g->gi.cols, ctx->g->gi.rows, 4, ctx->rgb, ctx->g->gi.cols * sizeof(*ctx->rgb));
+static void integrate_slabs_info(integrate_context *ctx) {
+    uint64_t cols = ctx->g->gi.cols;
+    for (uint64_t i = 0; i < ctx->n_slabs; ++i) {
+        integrate_slab *s = &ctx->slabs[i];
+        gpu_cl_set_kernel_arg(ctx->gpu, s->info_id, 5, sizeof(double), &ctx->time);
+        integrate_slab_launch(ctx, s, s->info_id, s->halo_low, s->rows, 0, NULL);
+        uint64_t site = ctx->info_doubles * sizeof(*ctx->info);
+        gpu_cl_read_gpu_async(&s->gpu, s->rows * cols * site, s->halo_low * cols * site, ctx->info + s->row0 * cols * ctx->info_doubles, s->info_gpu, &s->reads[0]);
     }
+    for (uint64_t i = 0; i < ctx->n_slabs; ++i)
+        gpu_cl_wait_events(1, ctx->slabs[i].reads);
+}
 
-    if (ctx->params.do_cluster && ctx->integrate_step % ctx->params.interval_for_cluster == 0) {
-        if (!read_grid_from_gpu)
-            v3d_from_gpu(ctx->g->m, ctx->g->m_gpu, ctx->g->gi.rows, ctx->g->gi.cols, *ctx->gpu);
+//interior rows of m, or of the pending step with swap, into a whole lattice on the host
+static void integrate_slabs_gather(integrate_context *ctx, v3d *out, bool swap) {
+    uint64_t cols = ctx->g->gi.cols;
+    for (uint64_t i = 0; i < ctx->n_slabs; ++i) {
+        integrate_slab *s = &ctx->slabs[i];
+        gpu_cl_read_gpu_async(&s->gpu, s->rows * cols * sizeof(*out), s->halo_low * cols * sizeof(*out), out + s->row0 * cols, swap? s->swap_gpu: s->m_gpu, &s->reads[0]);
+    }
+    for (uint64_t i = 0; i < ctx->n_slabs; ++i)
+        gpu_cl_wait_events(1, ctx->slabs[i].reads);
+}
 
-        grid_cluster(ctx->g, ctx->params.cluster_eps, ctx->params.cluster_background_size, ctx->params.cluster_min_pts, ctx->params.cluster_metric, ctx->params.cluster_weight, ctx->params.cluster_metric_data, ctx->params.cluster_weight_data);
+static void integrate_finish(integrate_context *ctx) {
+    gpu_cl_finish(ctx->gpu);
+    for (uint64_t i = 0; i < ctx->n_slabs; ++i)
+        gpu_cl_finish(&ctx->slabs[i].gpu);
+}
+
+//single device runs refresh the dipolar field first, slab runs never have one
+static void integrate_enqueue_step(integrate_context *ctx) {
+    if (ctx->n_slabs > 1) {
+        integrate_slabs_step(ctx);
+        return;
+    }
+    if (ctx->dipolar_multirate)
+        integrate_refresh_dipolar(ctx);
+    gpu_cl_enqueue_tuned(ctx->gpu, ctx->step_id, ctx->g->gi.cols, ctx->g->gi.rows);
+}
+
+static void integrate_consume_rgb(integrate_context *ctx, integrate_snapshot *s) {
+    video_writer_push(ctx->rgb_video, s->rgb, s->step);
+}
 
-        fprintf(ctx->clusters, "%.15e,", ctx->time);
+static void integrate_consume_cluster(integrate_context *ctx, integrate_snapshot *s) {
+    //grid_cluster works on g->m, the snapshot stands in for it
+    v3d *m = ctx->g->m;
+    ctx->g->m = s->m;
+    grid_cluster(ctx->g, ctx->params.cluster_eps, ctx->params.cluster_background_size, ctx->params.cluster_min_pts, ctx->params.cluster_metric, ctx->params.cluster_weight, ctx->params.cluster_metric_data, ctx->params.cluster_weight_data);
+    ctx->g->m = m;
 
-        for (uint64_t i = 0; i < ctx->g->clusters.len; ++i) {
-            fprintf(ctx->clusters, "%.15e,%.15e,%.15e", ctx->g->clusters.items[i].x, ctx->g->clusters.items[i].y, ctx->g->clusters.items[i].count / ((double)ctx->g->gi.rows * ctx->g->gi.cols));
-            if (i == ctx->g->clusters.len - 1)
-                fprintf(ctx->clusters, "\n");
-            else
-                fprintf(ctx->clusters, ",");
+    fprintf(ctx->clusters, "%.15e,", s->time);
+
+    for (uint64_t i = 0; i < ctx->g->clusters.len; ++i) {
+        fprintf(ctx->clusters, "%.15e,%.15e,%.15e", ctx->g->clusters.items[i].x, ctx->g->clusters.items[i].y, ctx->g->clusters.items[i].count / ((double)ctx->g->gi.rows * ctx->g->gi.cols));
+        if (i == ctx->g->clusters.len - 1)
+            fprintf(ctx->clusters, "\n");
+        else
+            fprintf(ctx->clusters, ",");
+    }
+}
+
+static void integrate_drain_snapshot(integrate_context *ctx, integrate_snapshot *s) {
+    if (!s->done)
+        return;
+    PROFILER_PHASE_START("integrate_output");
+    gpu_cl_wait_events(1, &s->done);
+    s->done = NULL;
+    for (uint64_t i = 0; i < s->n_consumers; ++i)
+        s->consumers[i](ctx, s);
+    s->n_consumers = 0;
+
+    //the next copy into the snapshot is enqueued behind the unmap, so the device never writes a mapped buffer
+    if (ctx->zero_copy && s->m) {
+        gpu_cl_unmap_gpu(ctx->gpu, s->m_gpu, s->m);
+        s->m = NULL;
+    }
+    if (ctx->zero_copy && s->rgb) {
+        gpu_cl_unmap_gpu(ctx->gpu, s->rgb_gpu, s->rgb);
+        s->rgb = NULL;
+    }
+    PROFILER_PHASE_END("integrate_output");
+}
+
+//into the snapshot's host copy, or a view of the snapshot itself with zero_copy
+static void integrate_snapshot_fetch(integrate_context *ctx, cl_mem device, void **host, uint64_t size, cl_event *ready, cl_event *done) {
+    if (!ctx->zero_copy) {
+        gpu_cl_read_gpu_after(&ctx->transfer, size, 0, *host, device, 1, ready, done);
+        return;
+    }
+    cl_event ev;
+    *host = gpu_cl_map_gpu(&ctx->transfer, size, 0, device, CL_MAP_READ, 1, ready, done? done: &ev);
+    if (!done)
+        gpu_cl_release_event(ev);
+}
+
+//m of the pending step is copied (and rendered) on the compute queue, which moves on right away,
+//the transfer queue reads it back once that is done
+static void integrate_take_snapshot(integrate_context *ctx, bool rgb, bool cluster) {
+    integrate_snapshot *s = &ctx->snapshots[ctx->snapshot_next];
+    ctx->snapshot_next = (ctx->snapshot_next + 1) % INTEGRATE_SNAPSHOTS;
+    integrate_drain_snapshot(ctx, s);
+
+    uint64_t sites = ctx->g->gi.rows * ctx->g->gi.cols;
+    s->step = ctx->integrate_step;
+    s->time = ctx->time;
+    if (cluster)
+        gpu_cl_copy_gpu(ctx->gpu, sites * sizeof(*s->m), ctx->g->m_gpu, s->m_gpu);
+    if (rgb) {
+        gpu_cl_set_kernel_arg(ctx->gpu, ctx->render_id, 2, sizeof(cl_mem), &s->rgb_gpu);
+        gpu_cl_enqueue_tuned(ctx->gpu, ctx->render_id, ctx->g->gi.cols, ctx->g->gi.rows);
+    }
+    cl_event ready;
+    gpu_cl_enqueue_marker(ctx->gpu, &ready);
+    //the transfer queue is in order, so the last read completing means both did
+    if (cluster)
+        integrate_snapshot_fetch(ctx, s->m_gpu, (void**)&s->m, sites * sizeof(*s->m), &ready, rgb? NULL: &s->done);
+    if (rgb)
+        integrate_snapshot_fetch(ctx, s->rgb_gpu, (void**)&s->rgb, sites * sizeof(*s->rgb), &ready, &s->done);
+    gpu_cl_release_event(ready);
+    //nothing guarantees the commands reach the device before the next wait otherwise
+    gpu_cl_flush(ctx->gpu);
+    gpu_cl_flush(&ctx->transfer);
+
+    if (rgb)
+        s->consumers[s->n_consumers++] = integrate_consume_rgb;
+    if (cluster)
+        s->consumers[s->n_consumers++] = integrate_consume_cluster;
+}
+
+//the whole bank in one read on the transfer queue, behind the copies into it
+static void integrate_raw_read(integrate_context *ctx, integrate_raw_bank *b) {
+    uint64_t size = b->frames * ctx->g->gi.rows * ctx->g->gi.cols * sizeof(*b->m);
+    cl_event ready;
+    gpu_cl_enqueue_marker(ctx->gpu, &ready);
+    integrate_snapshot_fetch(ctx, b->m_gpu, (void**)&b->m, size, &ready, &b->done);
+    gpu_cl_release_event(ready);
+    gpu_cl_flush(ctx->gpu);
+    gpu_cl_flush(&ctx->transfer);
+}
+
+static void integrate_raw_drain(integrate_context *ctx, integrate_raw_bank *b) {
+    if (!b->done)
+        return;
+    PROFILER_PHASE_START("integrate_output");
+    gpu_cl_wait_events(1, &b->done);
+    b->done = NULL;
+    //the frames are contiguous, a single write
+    v3d_dump(ctx->integrate_evolution, b->m, b->frames * ctx->g->gi.rows, ctx->g->gi.cols);
+    b->frames = 0;
+    if (ctx->zero_copy) {
+        gpu_cl_unmap_gpu(ctx->gpu, b->m_gpu, b->m);
+        b->m = NULL;
+    }
+    PROFILER_PHASE_END("integrate_output");
+}
+
+//copies m into the next slot of the bank, a full bank is read back and the other one, written out by now, takes over
+static void integrate_raw_capture(integrate_context *ctx) {
+    integrate_raw_bank *b = &ctx->raw_banks[ctx->raw_bank];
+    uint64_t size = ctx->g->gi.rows * ctx->g->gi.cols * sizeof(*ctx->g->m);
+    gpu_cl_copy_gpu_offset(ctx->gpu, size, ctx->g->m_gpu, 0, b->m_gpu, b->frames * size);
+    if (++b->frames < ctx->raw_ring_frames)
+        return;
+    integrate_raw_read(ctx, b);
+    ctx->raw_bank = (ctx->raw_bank + 1) % INTEGRATE_RAW_BANKS;
+    integrate_raw_drain(ctx, &ctx->raw_banks[ctx->raw_bank]);
+}
+
+void integrate_context_flush_output(integrate_context *ctx) {
+    for (uint64_t i = 0; i < INTEGRATE_SNAPSHOTS; ++i)
+        integrate_drain_snapshot(ctx, &ctx->snapshots[(ctx->snapshot_next + i) % INTEGRATE_SNAPSHOTS]);
+
+    //the banks that are read back, oldest first, then whatever the current one holds
+    for (uint64_t i = 1; i <= INTEGRATE_RAW_BANKS; ++i)
+        integrate_raw_drain(ctx, &ctx->raw_banks[(ctx->raw_bank + i) % INTEGRATE_RAW_BANKS]);
+    integrate_raw_bank *b = &ctx->raw_banks[ctx->raw_bank];
+    if (b->frames) {
+        integrate_raw_read(ctx, b);
+        integrate_raw_drain(ctx, b);
+    }
+}
+
+//sums the partials gpu_step_info left in info_gpu, one per work group of its tile
+static information_packed integrate_step_info_sum(integrate_context *ctx) {
+    kernel_t *k = &ctx->gpu->kernels[ctx->step_info_id];
+    uint64_t groups = (k->global[0] / k->local[0]) * (k->global[1] / k->local[1]);
+    uint64_t sites = ctx->g->gi.rows * ctx->g->gi.cols;
+    uint64_t size = groups * ctx->info_doubles * sizeof(*ctx->info);
+    if (ctx->zero_copy) {
+        double *info = gpu_cl_map_gpu(ctx->gpu, size, 0, ctx->info_gpu, CL_MAP_READ, 0, NULL, NULL);
+        information_packed ret = integrate_sum_info(info, groups, ctx->params.observables, sites);
+        gpu_cl_unmap_gpu(ctx->gpu, ctx->info_gpu, info);
+        return ret;
+    }
+    gpu_cl_read_gpu(ctx->gpu, size, 0, ctx->info, ctx->info_gpu);
+    return integrate_sum_info(ctx->info, groups, ctx->params.observables, sites);
+}
+
+void integrate_step(integrate_context *ctx) {
+    bool info_step = ctx->integrate_step % ctx->params.interval_for_information == 0;
+    //multirate dipolar steps read a cached field and slabs only see their halos, both keep extract_info
+    bool fused = info_step && ctx->n_slabs <= 1 && !ctx->dipolar_multirate;
+    if (fused)
+        gpu_cl_enqueue_tuned(ctx->gpu, ctx->step_info_id, ctx->g->gi.cols, ctx->g->gi.rows);
+    else
+        integrate_enqueue_step(ctx);
+
+    if (info_step) {
+        PROFILER_PHASE_START("integrate_information");
+        information_packed info = fused? integrate_step_info_sum(ctx): integrate_get_info(ctx);
+        integrate_print_info(ctx->integrate_info, ctx->params.observables, ctx->time, info);
+        PROFILER_PHASE_END("integrate_information");
+    }
+
+    bool raw = ctx->integrate_step % ctx->params.interval_for_raw_grid == 0;
+    bool rgb = ctx->integrate_step % ctx->params.interval_for_rgb_grid == 0;
+    bool cluster = ctx->params.do_cluster && ctx->integrate_step % ctx->params.interval_for_cluster == 0;
+    if (raw || rgb || cluster) {
+        PROFILER_PHASE_START("integrate_snapshot");
+        //the render and the copy read the context's m, which slab runs only fill on demand
+        if (ctx->n_slabs > 1) {
+            integrate_context_read_grid(ctx);
+            gpu_cl_write_gpu(ctx->gpu, ctx->g->gi.rows * ctx->g->gi.cols * sizeof(*ctx->g->m), 0, ctx->g->m, ctx->g->m_gpu);
         }
+        if (raw)
+            integrate_raw_capture(ctx);
+        if (rgb || cluster)
+            integrate_take_snapshot(ctx, rgb, cluster);
+        PROFILER_PHASE_END("integrate_snapshot");
     }
 
     ctx->integrate_step += 1;
-    ctx->time += ctx->params.dt;
+    ctx->time = ctx->time0 + ctx->integrate_step * ctx->params.dt;
 }
 
-information_packed integrate_get_info(integrate_context *ctx) {
-    gpu_cl_set_kernel_arg(ctx->gpu, ctx->info_id, 5, sizeof(double), &ctx->time);
-    gpu_cl_enqueue_nd(ctx->gpu, ctx->info_id, 1, &ctx->local, &ctx->global, NULL);
+//first step at or after the current one that writes any output
+static uint64_t integrate_next_output(integrate_context *ctx) {
+    uint64_t intervals[] = {ctx->params.interval_for_information, ctx->params.interval_for_raw_grid,
+                            ctx->params.interval_for_rgb_grid, ctx->params.do_cluster? ctx->params.interval_for_cluster: 0};
+    uint64_t next = UINT64_MAX;
+    for (uint64_t i = 0; i < sizeof(intervals) / sizeof(*intervals); ++i) {
+        if (intervals[i] == 0)
+            continue;
+        uint64_t r = ctx->integrate_step % intervals[i];
+        uint64_t candidate = r? ctx->integrate_step + intervals[i] - r: ctx->integrate_step;
+        if (candidate < next)
+            next = candidate;
+    }
+    return next;
+}
+
+//same as n calls to integrate_step + integrate_exchange_grids, but steps without output are only enqueued
+void integrate_run_steps(integrate_context *ctx, uint64_t n) {
+    uint64_t end = ctx->integrate_step + n;
+    while (ctx->integrate_step < end) {
+        uint64_t quiet_end = integrate_next_output(ctx);
+        if (quiet_end > end)
+            quiet_end = end;
+
+        PROFILER_PHASE_START("integrate_enqueue");
+        while (ctx->integrate_step < quiet_end) {
+            integrate_enqueue_step(ctx);
+            integrate_exchange_grids(ctx);
+            ctx->integrate_step += 1;
+            if (ctx->integrate_step % INTEGRATE_BATCH_SYNC == 0)
+                integrate_finish(ctx);
+        }
+        PROFILER_PHASE_END("integrate_enqueue");
+        ctx->time = ctx->time0 + ctx->integrate_step * ctx->params.dt;
+
+        if (ctx->integrate_step < end) {
+            integrate_step(ctx);
+            integrate_exchange_grids(ctx);
+        }
+    }
+}
+
+void integrate_print_info_header(FILE *f, uint64_t observables) {
+    fprintf(f, "time(s)");
+    if (observables & INFO_ENERGY)
+        fprintf(f, ",energy(J),exchange_energy(J),dm_energy(J),field_energy(J),anisotropy_energy(J),cubic_anisotropy_energy(J),dipolar_energy(J)");
+    if (observables & INFO_CHARGE)
+        fprintf(f, ",charge_finite,charge_lattice");
+    if (observables & INFO_AVG_M)
+        fprintf(f, ",avg_mx,avg_my,avg_mz");
+    if (observables & INFO_ELECTRIC_FIELD)
+        fprintf(f, ",electric_x(V/m),electric_y(V/m),electric_z(V/m)");
+    if (observables & INFO_MAGNETIC_FIELD) {
+        fprintf(f, ",magnetic_lattice_x(T),magnetic_lattice_y(T),magnetic_lattice_z(T)");
+        fprintf(f, ",magnetic_finite_x(T),magnetic_finite_y(T),magnetic_finite_z(T)");
+    }
+    if (observables & INFO_CHARGE_CENTER) {
+        fprintf(f, ",charge_center_x(m),charge_center_y(m)");
+        fprintf(f, ",abs_charge_center_x(m),abs_charge_center_y(m)");
+    }
+    if (observables & INFO_D_TENSOR)
+        fprintf(f, ",D_xx,D_yy,D_xy");
+    if (observables & INFO_DIPOLAR_ERROR)
+        fprintf(f, ",dipolar_cache_error");
+    fprintf(f, "\n");
+}
+
+void integrate_print_info(FILE *f, uint64_t observables, double time, information_packed info) {
+    fprintf(f, "%.15e", time);
+    if (observables & INFO_ENERGY)
+        fprintf(f, ",%.15e,%.15e,%.15e,%.15e,%.15e,%.15e,%.15e", info.energy, info.exchange_energy, info.dm_energy, info.field_energy, info.anisotropy_energy, info.cubic_energy, info.dipolar_energy);
+    if (observables & INFO_CHARGE)
+        fprintf(f, ",%.15e,%.15e", info.charge_finite, info.charge_lattice);
+    if (observables & INFO_AVG_M)
+        fprintf(f, ",%.15e,%.15e,%.15e", info.avg_m.x, info.avg_m.y, info.avg_m.z);
+    if (observables & INFO_ELECTRIC_FIELD)
+        fprintf(f, ",%.15e,%.15e,%.15e", info.electric_field.x, info.electric_field.y, info.electric_field.z);
+    if (observables & INFO_MAGNETIC_FIELD) {
+        fprintf(f, ",%.15e,%.15e,%.15e", info.magnetic_field_lattice.x, info.magnetic_field_lattice.y, info.magnetic_field_lattice.z);
+        fprintf(f, ",%.15e,%.15e,%.15e", info.magnetic_field_finite.x, info.magnetic_field_finite.y, info.magnetic_field_finite.z);
+    }
+    if (observables & INFO_CHARGE_CENTER) {
+        fprintf(f, ",%.15e,%.15e", info.charge_center_x / info.charge_finite, info.charge_center_y / info.charge_finite);
+        fprintf(f, ",%.15e,%.15e", info.abs_charge_center_x / info.abs_charge_finite, info.abs_charge_center_y / info.abs_charge_finite);
+    }
+    if (observables & INFO_D_TENSOR)
+        fprintf(f, ",%.15e,%.15e,%.15e", info.D_xx, info.D_yy, info.D_xy);
+    if (observables & INFO_DIPOLAR_ERROR)
+        fprintf(f, ",%.15e", info.dipolar_field_norm > 0.0? sqrt(info.dipolar_cache_error / info.dipolar_field_norm): 0.0);
+    fprintf(f, "\n");
+}
+
+uint64_t integrate_info_doubles(uint64_t observables) {
+    uint64_t n = 0;
+#define INFO_COUNT(bits, field) if (observables & (bits)) n++;
+    INFO_FIELDS(INFO_COUNT)
+#undef INFO_COUNT
+    return n;
+}
 
-    gpu_cl_read_gpu(ctx->gpu, sizeof(*ctx->info) * ctx->g->gi.rows * ctx->g->gi.cols, 0, ctx->info, ctx->info_gpu);
+//fields that are not packed stay 0
+information_packed integrate_unpack_info(const double *packed, uint64_t observables) {
+    information_packed ret = {0};
+    uint64_t n = 0;
+#define INFO_UNPACK(bits, field) if (observables & (bits)) ret.field = packed[n++];
+    INFO_FIELDS(INFO_UNPACK)
+#undef INFO_UNPACK
+    return ret;
+}
 
+//n packed entries. sites is the size of the whole lattice, avg_m of a part of it is then that part's share of the average
+information_packed integrate_sum_info(const double *packed, uint64_t n, uint64_t observables, uint64_t sites) {
     information_packed info_local = {0};
-    for (uint64_t i = 0; i < ctx->g->gi.rows * ctx->g->gi.cols; ++i) {
-        info_local.energy += ctx->info[i].energy;
-        info_local.dipolar_energy += ctx->info[i].dipolar_energy;
-        info_local.cubic_energy += ctx->info[i].cubic_energy;
-        info_local.anisotropy_energy += ctx->info[i].anisotropy_energy;
-        info_local.field_energy += ctx->info[i].field_energy;
-        info_local.dm_energy += ctx->info[i].dm_energy;
-        info_local.exchange_energy += ctx->info[i].exchange_energy;
-        info_local.charge_finite += ctx->info[i].charge_finite;
-        info_local.charge_lattice += ctx->info[i].charge_lattice;
-        info_local.abs_charge_finite += ctx->info[i].abs_charge_finite;
-        info_local.abs_charge_lattice += ctx->info[i].abs_charge_lattice;
-        info_local.avg_m = v3d_sum(info_local.avg_m, v3d_scalar(ctx->info[i].avg_m, 1.0 / (ctx->g->gi.rows * ctx->g->gi.cols)));
-        info_local.electric_field = v3d_sum(info_local.electric_field , ctx->info[i].electric_field);
-        info_local.magnetic_field_lattice = v3d_sum(info_local.magnetic_field_lattice, ctx->info[i].magnetic_field_lattice);
-        info_local.magnetic_field_finite = v3d_sum(info_local.magnetic_field_finite, ctx->info[i].magnetic_field_finite);
-        info_local.charge_center_x += ctx->info[i].charge_center_x;
-        info_local.charge_center_y += ctx->info[i].charge_center_y;
-        info_local.abs_charge_center_x += ctx->info[i].abs_charge_center_x;
-        info_local.abs_charge_center_y += ctx->info[i].abs_charge_center_y;
-        info_local.D_xx += ctx->info[i].D_xx;
-        info_local.D_yy += ctx->info[i].D_yy;
-        info_local.D_xy += ctx->info[i].D_xy;
+    uint64_t stride = integrate_info_doubles(observables);
+    for (uint64_t i = 0; i < n; ++i) {
+        information_packed info = integrate_unpack_info(packed + i * stride, observables);
+        info_local.energy += info.energy;
+        info_local.dipolar_energy += info.dipolar_energy;
+        info_local.cubic_energy += info.cubic_energy;
+        info_local.anisotropy_energy += info.anisotropy_energy;
+        info_local.field_energy += info.field_energy;
+        info_local.dm_energy += info.dm_energy;
+        info_local.exchange_energy += info.exchange_energy;
+        info_local.charge_finite += info.charge_finite;
+        info_local.charge_lattice += info.charge_lattice;
+        info_local.abs_charge_finite += info.abs_charge_finite;
+        info_local.abs_charge_lattice += info.abs_charge_lattice;
+        info_local.avg_m = v3d_sum(info_local.avg_m, v3d_scalar(info.avg_m, 1.0 / sites));
+        info_local.electric_field = v3d_sum(info_local.electric_field , info.electric_field);
+        info_local.magnetic_field_lattice = v3d_sum(info_local.magnetic_field_lattice, info.magnetic_field_lattice);
+        info_local.magnetic_field_finite = v3d_sum(info_local.magnetic_field_finite, info.magnetic_field_finite);
+        info_local.charge_center_x += info.charge_center_x;
+        info_local.charge_center_y += info.charge_center_y;
+        info_local.abs_charge_center_x += info.abs_charge_center_x;
+        info_local.abs_charge_center_y += info.abs_charge_center_y;
+        info_local.D_xx += info.D_xx;
+        info_local.D_yy += info.D_yy;
+        info_local.D_xy += info.D_xy;
+        info_local.dipolar_cache_error += info.dipolar_cache_error;
+        info_local.dipolar_field_norm += info.dipolar_field_norm;
     }
     return info_local;
 }
 
+char *integrate_compile_augment(integrate_params params) {
+    string_builder ret = {0};
+    if (params.compile_augment)
+        sb_cat_cstr(&ret, params.compile_augment);
+    sb_cat_fmt(&ret, " -DINFO_OBSERVABLES=%"PRIu64, params.observables);
+    return sb_as_cstr(&ret);
+}
+
+uint64_t integrate_kernel_observables(gpu_cl *gpu, uint64_t wanted) {
+    cl_ulong observables = 0;
+    uint64_t local = 1;
+    uint64_t global = 1;
+    cl_mem observables_gpu = gpu_cl_create_gpu(gpu, sizeof(observables), CL_MEM_READ_WRITE);
+    uint64_t id = gpu_cl_append_kernel(gpu, "info_observables");
+    gpu_cl_set_kernel_arg(gpu, id, 0, sizeof(cl_mem), &observables_gpu);
+    gpu_cl_enqueue_nd(gpu, id, 1, &local, &global, NULL);
+    gpu_cl_read_gpu(gpu, sizeof(observables), 0, &observables, observables_gpu);
+    gpu_cl_release_memory(observables_gpu);
+    if (observables != wanted)
+        logging_log(LOG_WARNING, "Program computes observables %"PRIu64" instead of %"PRIu64", build it with integrate_compile_augment", (uint64_t)observables, wanted);
+    return observables;
+}
+
+information_packed integrate_get_info(integrate_context *ctx) {
+    uint64_t sites = ctx->g->gi.rows * ctx->g->gi.cols;
+    if (ctx->n_slabs > 1)
+        integrate_slabs_info(ctx);
+    else {
+        gpu_cl_set_kernel_arg(ctx->gpu, ctx->info_id, 5, sizeof(double), &ctx->time);
+        gpu_cl_enqueue_tuned(ctx->gpu, ctx->info_id, ctx->g->gi.cols, ctx->g->gi.rows);
+        if (ctx->zero_copy) {
+            double *info = gpu_cl_map_gpu(ctx->gpu, sizeof(*info) * sites * ctx->info_doubles, 0, ctx->info_gpu, CL_MAP_READ, 0, NULL, NULL);
+            information_packed ret = integrate_sum_info(info, sites, ctx->params.observables, sites);
+            gpu_cl_unmap_gpu(ctx->gpu, ctx->info_gpu, info);
+            return ret;
+        }
+        gpu_cl_read_gpu(ctx->gpu, sizeof(*ctx->info) * sites * ctx->info_doubles, 0, ctx->info, ctx->info_gpu);
+    }
+
+    return integrate_sum_info(ctx->info, sites, ctx->params.observables, sites);
+}
+
 void integrate_exchange_grids(integrate_context *ctx) {
-    gpu_cl_enqueue_nd(ctx->gpu, ctx->exchange_id, 1, &ctx->local, &ctx->global, NULL);
+    if (ctx->n_slabs > 1)
+        integrate_slabs_advance(ctx);
+    else
+        gpu_cl_enqueue_nd(ctx->gpu, ctx->advance_id, 1, &ctx->local, &ctx->global, NULL);
 }
 
 void integrate_context_read_grid(integrate_context *ctx) {
-    v3d_from_gpu(ctx->g->m, ctx->g->m_gpu, ctx->g->gi.rows, ctx->g->gi.cols, *ctx->gpu);
+    if (ctx->n_slabs > 1)
+        integrate_slabs_gather(ctx, ctx->g->m, false);
+    else
+        v3d_from_gpu(ctx->g->m, ctx->g->m_gpu, ctx->g->gi.rows, ctx->g->gi.cols, *ctx->gpu);
+}
+
+//slab runs keep the lattice on the slabs, renderers and grid_from_gpu read the context buffers
+void integrate_context_sync_grid(integrate_context *ctx) {
+    if (ctx->n_slabs <= 1)
+        return;
+    uint64_t size = ctx->g->gi.rows * ctx->g->gi.cols;
+    v3d *swap = mmalloc(size * sizeof(*swap));
+    integrate_slabs_gather(ctx, ctx->g->m, false);
+    integrate_slabs_gather(ctx, swap, true);
+    gpu_cl_write_gpu(ctx->gpu, size * sizeof(*ctx->g->m), 0, ctx->g->m, ctx->g->m_gpu);
+    gpu_cl_write_gpu(ctx->gpu, size * sizeof(*swap), 0, swap, ctx->swap_gpu);
+    mfree(swap);
 }
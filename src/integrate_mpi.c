@@ -0,0 +1,445 @@
+#include "integrate_mpi.h"
+
+void integrate_mpi_split(uint64_t n_ranks, unsigned int rows, unsigned int cols, int *dims) {
+    double best = -1.0;
+    dims[0] = 1;
+    dims[1] = n_ranks;
+    for (uint64_t d = 1; d <= n_ranks; ++d) {
+        if (n_ranks % d || d > rows || n_ranks / d > cols)
+            continue;
+        //boundary length of one block, what every exchange moves
+        double boundary = (double)rows / d + (double)cols / (n_ranks / d);
+        if (best < 0.0 || boundary < best) {
+            best = boundary;
+            dims[0] = d;
+            dims[1] = n_ranks / d;
+        }
+    }
+}
+
+#ifdef USE_MPI
+
+#include "logging.h"
+#include "allocator.h"
+#include "string_builder.h"
+#include "gpu_tuner.h"
+
+#include <inttypes.h>
+#include <string.h>
+
+integrate_mpi_layout integrate_mpi_layout_init(unsigned int rows, unsigned int cols, pbc_rules pbc) {
+    int initialized;
+    MPI_Initialized(&initialized);
+    if (!initialized)
+        logging_log(LOG_FATAL, "MPI_Init has to be called before integrate_mpi_layout_init");
+
+    integrate_mpi_layout l = {0};
+    l.global = (grid_info){.rows = rows, .cols = cols, .pbc = pbc};
+    MPI_Comm_size(MPI_COMM_WORLD, &l.n_ranks);
+    integrate_mpi_split(l.n_ranks, rows, cols, l.dims);
+
+    int periods[2] = {pbc.pbc_y, pbc.pbc_x};
+    if (MPI_Cart_create(MPI_COMM_WORLD, 2, l.dims, periods, 1, &l.comm) != MPI_SUCCESS)
+        logging_log(LOG_FATAL, "Could not create the %dx%d rank grid", l.dims[0], l.dims[1]);
+    MPI_Comm_rank(l.comm, &l.rank);
+    MPI_Cart_coords(l.comm, l.rank, 2, l.coords);
+
+    l.row0 = (uint64_t)rows * l.coords[0] / l.dims[0];
+    l.rows = (uint64_t)rows * (l.coords[0] + 1) / l.dims[0] - l.row0;
+    l.col0 = (uint64_t)cols * l.coords[1] / l.dims[1];
+    l.cols = (uint64_t)cols * (l.coords[1] + 1) / l.dims[1] - l.col0;
+
+    MPI_Comm node;
+    MPI_Comm_split_type(l.comm, MPI_COMM_TYPE_SHARED, l.rank, MPI_INFO_NULL, &node);
+    MPI_Comm_rank(node, &l.local_rank);
+    MPI_Comm_free(&node);
+
+    logging_log(LOG_INFO, "Rank %d of %d holds rows %"PRIu64"-%"PRIu64" cols %"PRIu64"-%"PRIu64" (%dx%d ranks)", l.rank, l.n_ranks,
+                l.row0, l.row0 + l.rows - 1, l.col0, l.col0 + l.cols - 1, l.dims[0], l.dims[1]);
+    return l;
+}
+
+void integrate_mpi_layout_free(integrate_mpi_layout *layout) {
+    MPI_Comm_free(&layout->comm);
+}
+
+//sends send[side] to the neighbour on that side of dim and receives the neighbour's band into recv[side]
+static void integrate_mpi_swap(integrate_mpi_context *ctx, int dim, uint64_t bytes) {
+    uint64_t *halo = dim? ctx->halo_cols: ctx->halo_rows;
+    MPI_Request requests[4];
+    int n = 0;
+    for (int side = 0; side < 2; ++side) {
+        if (!halo[side])
+            continue;
+        //tags are the direction of travel, with two ranks along dim the neighbour is both low and high
+        int neighbour = ctx->neighbours[2 * dim + side];
+        MPI_Irecv(ctx->recv[side], bytes, MPI_BYTE, neighbour, !side, ctx->layout.comm, &requests[n++]);
+        MPI_Isend(ctx->send[side], bytes, MPI_BYTE, neighbour, side, ctx->layout.comm, &requests[n++]);
+    }
+    if (MPI_Waitall(n, requests, MPI_STATUSES_IGNORE) != MPI_SUCCESS)
+        logging_log(LOG_FATAL, "Could not exchange halos with rank neighbours along %s", dim? "cols": "rows");
+}
+
+static void integrate_mpi_copy_rect(char *buffer, uint64_t pitch, uint64_t x, uint64_t y, uint64_t width, uint64_t height, char *packed, bool pack) {
+    for (uint64_t r = 0; r < height; ++r) {
+        if (pack)
+            memcpy(packed + r * width, buffer + (y + r) * pitch + x, width);
+        else
+            memcpy(buffer + (y + r) * pitch + x, packed + r * width, width);
+    }
+}
+
+//cols first, the row bands then carry the corners the cols just received
+static void integrate_mpi_exchange_host(integrate_mpi_context *ctx, char *buffer, uint64_t elem) {
+    uint64_t h = ctx->halo;
+    uint64_t pitch = ctx->gi.cols * elem;
+    uint64_t band_x[2] = {ctx->halo_cols[0], ctx->halo_cols[0] + ctx->layout.cols - h};
+    uint64_t halo_x[2] = {0, ctx->halo_cols[0] + ctx->layout.cols};
+    for (int side = 0; side < 2; ++side)
+        if (ctx->halo_cols[side])
+            integrate_mpi_copy_rect(buffer, pitch, band_x[side] * elem, ctx->halo_rows[0], h * elem, ctx->layout.rows, ctx->send[side], true);
+    integrate_mpi_swap(ctx, 1, h * ctx->layout.rows * elem);
+    for (int side = 0; side < 2; ++side)
+        if (ctx->halo_cols[side])
+            integrate_mpi_copy_rect(buffer, pitch, halo_x[side] * elem, ctx->halo_rows[0], h * elem, ctx->layout.rows, ctx->recv[side], false);
+
+    uint64_t band_y[2] = {ctx->halo_rows[0], ctx->halo_rows[0] + ctx->layout.rows - h};
+    uint64_t halo_y[2] = {0, ctx->halo_rows[0] + ctx->layout.rows};
+    for (int side = 0; side < 2; ++side)
+        if (ctx->halo_rows[side])
+            memcpy(ctx->send[side], buffer + band_y[side] * pitch, h * pitch);
+    integrate_mpi_swap(ctx, 0, h * pitch);
+    for (int side = 0; side < 2; ++side)
+        if (ctx->halo_rows[side])
+            memcpy(buffer + halo_y[side] * pitch, ctx->recv[side], h * pitch);
+}
+
+//same as integrate_mpi_exchange_host on m, only the bands and halos cross the bus
+static void integrate_mpi_exchange_m(integrate_mpi_context *ctx) {
+    uint64_t h = ctx->halo;
+    uint64_t elem = sizeof(v3d);
+    uint64_t pitch = ctx->gi.cols * elem;
+    uint64_t band_x[2] = {ctx->halo_cols[0], ctx->halo_cols[0] + ctx->layout.cols - h};
+    uint64_t halo_x[2] = {0, ctx->halo_cols[0] + ctx->layout.cols};
+    for (int side = 0; side < 2; ++side)
+        if (ctx->halo_cols[side])
+            gpu_cl_read_gpu_rect(ctx->gpu, h * elem, ctx->layout.rows, band_x[side] * elem, ctx->halo_rows[0], pitch, ctx->send[side], ctx->m_gpu);
+    integrate_mpi_swap(ctx, 1, h * ctx->layout.rows * elem);
+    for (int side = 0; side < 2; ++side)
+        if (ctx->halo_cols[side])
+            gpu_cl_write_gpu_rect(ctx->gpu, h * elem, ctx->layout.rows, halo_x[side] * elem, ctx->halo_rows[0], pitch, ctx->recv[side], ctx->m_gpu);
+
+    uint64_t band_y[2] = {ctx->halo_rows[0], ctx->halo_rows[0] + ctx->layout.rows - h};
+    uint64_t halo_y[2] = {0, ctx->halo_rows[0] + ctx->layout.rows};
+    for (int side = 0; side < 2; ++side)
+        if (ctx->halo_rows[side])
+            gpu_cl_read_gpu(ctx->gpu, h * pitch, band_y[side] * pitch, ctx->send[side], ctx->m_gpu);
+    integrate_mpi_swap(ctx, 0, h * pitch);
+    for (int side = 0; side < 2; ++side)
+        if (ctx->halo_rows[side])
+            gpu_cl_write_gpu(ctx->gpu, h * pitch, halo_y[side] * pitch, ctx->recv[side], ctx->m_gpu);
+}
+
+static void integrate_mpi_types(integrate_mpi_layout *l, uint64_t elem, MPI_Datatype *site, MPI_Datatype *block) {
+    int sizes[2] = {l->global.rows, l->global.cols};
+    int subsizes[2] = {l->rows, l->cols};
+    int starts[2] = {l->row0, l->col0};
+    MPI_Type_contiguous(elem, MPI_BYTE, site);
+    MPI_Type_commit(site);
+    MPI_Type_create_subarray(2, sizes, subsizes, starts, MPI_ORDER_C, *site, block);
+    MPI_Type_commit(block);
+}
+
+//every rank writes its block of a rows x cols array of the global lattice at the current offset
+static void integrate_mpi_write_block(integrate_mpi_context *ctx, MPI_Datatype site, MPI_Datatype block, uint64_t elem, void *data) {
+    MPI_File_set_view(ctx->evolution, ctx->evolution_offset, site, block, "native", MPI_INFO_NULL);
+    if (MPI_File_write_all(ctx->evolution, data, ctx->layout.rows * ctx->layout.cols, site, MPI_STATUS_IGNORE) != MPI_SUCCESS)
+        logging_log(LOG_FATAL, "Could not write block of rank %d to the raw grid dump", ctx->layout.rank);
+    ctx->evolution_offset += (MPI_Offset)ctx->layout.global.rows * ctx->layout.global.cols * elem;
+}
+
+static void integrate_mpi_launch(integrate_mpi_context *ctx, uint64_t kernel, uint64_t col, uint64_t cols, uint64_t row, uint64_t rows) {
+    if (cols == 0 || rows == 0)
+        return;
+    kernel_t *k = &ctx->gpu->kernels[kernel];
+    uint64_t global[2] = {cols + (k->local[0] - cols % k->local[0]) % k->local[0], rows + (k->local[1] - rows % k->local[1]) % k->local[1]};
+    uint64_t offset[2] = {col, row};
+    gpu_cl_enqueue_nd(ctx->gpu, kernel, 2, k->local, global, offset);
+}
+
+integrate_mpi_context integrate_mpi_context_init(grid *g, gpu_cl *gpu, integrate_mpi_layout layout, integrate_params params) {
+    integrate_mpi_context ctx = {0};
+    ctx.g = g;
+    ctx.gpu = gpu;
+    ctx.layout = layout;
+    ctx.params = params;
+    if (g->gi.rows != layout.rows || g->gi.cols != layout.cols)
+        logging_log(LOG_FATAL, "Rank %d got a %ux%u grid for a %"PRIu64"x%"PRIu64" block", layout.rank, g->gi.rows, g->gi.cols, layout.rows, layout.cols);
+    if (params.compile_augment && strstr(params.compile_augment, "INCLUDE_DIPOLAR"))
+        logging_log(LOG_FATAL, "The dipolar field needs the whole lattice, MPI runs can not include it");
+
+    uint64_t device = layout.local_rank % gpu->n_devices;
+    if (gpu->devices[device] != gpu->queue_device) {
+        //a session keeps its queue for the next run, the one made here goes away with the context
+        if (gpu->session) {
+            ctx.session_queue = gpu->queue;
+            ctx.session_device = gpu->queue_device;
+        } else
+            gpu_cl_release_queue(gpu->queue);
+        gpu->queue_device = gpu->devices[device];
+        gpu->queue = gpu_cl_create_queue(gpu, gpu->queue_device);
+    }
+
+    ctx.halo = params.slab_halo? params.slab_halo: 1;
+    if (layout.rows < ctx.halo || layout.cols < ctx.halo)
+        logging_log(LOG_FATAL, "Block %"PRIu64"x%"PRIu64" of rank %d is smaller than the halo %"PRIu64, layout.rows, layout.cols, layout.rank, ctx.halo);
+    MPI_Cart_shift(layout.comm, 0, 1, &ctx.neighbours[0], &ctx.neighbours[1]);
+    MPI_Cart_shift(layout.comm, 1, 1, &ctx.neighbours[2], &ctx.neighbours[3]);
+    for (int side = 0; side < 2; ++side) {
+        ctx.halo_rows[side] = ctx.neighbours[side] != MPI_PROC_NULL? ctx.halo: 0;
+        ctx.halo_cols[side] = ctx.neighbours[2 + side] != MPI_PROC_NULL? ctx.halo: 0;
+    }
+    //the global edges are open or belong to a neighbour, apply_pbc only sees the open ones
+    ctx.gi = layout.global;
+    ctx.gi.rows = ctx.halo_rows[0] + layout.rows + ctx.halo_rows[1];
+    ctx.gi.cols = ctx.halo_cols[0] + layout.cols + ctx.halo_cols[1];
+    ctx.gi.pbc.pbc_x = 0;
+    ctx.gi.pbc.pbc_y = 0;
+
+    uint64_t elem = sizeof(grid_site_params) > sizeof(v3d)? sizeof(grid_site_params): sizeof(v3d);
+    uint64_t band = ctx.halo * (layout.rows > ctx.gi.cols? layout.rows: ctx.gi.cols) * elem;
+    for (int side = 0; side < 2; ++side) {
+        ctx.send[side] = mmalloc(band);
+        ctx.recv[side] = mmalloc(band);
+    }
+
+    //sites get global coordinates, the halos then come from the neighbours like every later exchange
+    uint64_t size = ctx.gi.rows * ctx.gi.cols;
+    grid_site_params *gp = mmalloc(size * sizeof(*gp));
+    v3d *m = mmalloc(size * sizeof(*m));
+    memset(gp, 0, size * sizeof(*gp));
+    memset(m, 0, size * sizeof(*m));
+    for (uint64_t r = 0; r < layout.rows; ++r) {
+        for (uint64_t c = 0; c < layout.cols; ++c) {
+            uint64_t b = (r + ctx.halo_rows[0]) * ctx.gi.cols + c + ctx.halo_cols[0];
+            gp[b] = g->gp[r * layout.cols + c];
+            gp[b].row += layout.row0;
+            gp[b].col += layout.col0;
+            m[b] = g->m[r * layout.cols + c];
+        }
+    }
+    integrate_mpi_exchange_host(&ctx, (char*)gp, sizeof(*gp));
+    integrate_mpi_exchange_host(&ctx, (char*)m, sizeof(*m));
+
+    cl_ulong step0 = 0;
+    ctx.gp_gpu = gpu_cl_create_gpu(gpu, size * sizeof(*gp), CL_MEM_READ_WRITE);
+    ctx.m_gpu = gpu_cl_create_gpu(gpu, size * sizeof(*m), CL_MEM_READ_WRITE);
+    ctx.swap_gpu = gpu_cl_create_gpu(gpu, size * sizeof(*m), CL_MEM_READ_WRITE);
+    ctx.step_gpu = gpu_cl_create_gpu(gpu, sizeof(step0), CL_MEM_READ_WRITE);
+    ctx.params.observables = integrate_kernel_observables(gpu, params.observables);
+    ctx.info_doubles = integrate_info_doubles(ctx.params.observables);
+    ctx.info_doubles = ctx.info_doubles? ctx.info_doubles: 1;
+    ctx.info_gpu = gpu_cl_create_gpu(gpu, size * ctx.info_doubles * sizeof(*ctx.info), CL_MEM_READ_WRITE);
+    ctx.placeholder_gpu = gpu_cl_create_gpu(gpu, sizeof(dipolar_tensor), CL_MEM_READ_WRITE);
+    gpu_cl_write_gpu(gpu, size * sizeof(*gp), 0, gp, ctx.gp_gpu);
+    gpu_cl_write_gpu(gpu, size * sizeof(*m), 0, m, ctx.m_gpu);
+    gpu_cl_write_gpu(gpu, sizeof(step0), 0, &step0, ctx.step_gpu);
+
+    ctx.local = gpu_optimal_wg;
+    ctx.global = size + (ctx.local - size % ctx.local);
+    ctx.step_id = gpu_cl_append_kernel(gpu, "gpu_step");
+    ctx.advance_id = gpu_cl_append_kernel(gpu, "advance_step");
+    ctx.info_id = gpu_cl_append_kernel(gpu, "extract_info");
+    int method = params.method;
+    int dipolar_cached = 0;
+    gpu_cl_fill_kernel_args(gpu, ctx.step_id, 0, 11, &ctx.gp_gpu, sizeof(cl_mem),
+                                                     &ctx.m_gpu, sizeof(cl_mem),
+                                                     &ctx.swap_gpu, sizeof(cl_mem),
+                                                     &ctx.params.dt, sizeof(double),
+                                                     &ctx.time0, sizeof(double),
+                                                     &ctx.gi, sizeof(grid_info),
+                                                     &method, sizeof(int),
+                                                     &ctx.placeholder_gpu, sizeof(cl_mem),
+                                                     &ctx.placeholder_gpu, sizeof(cl_mem),
+                                                     &dipolar_cached, sizeof(int),
+                                                     &ctx.step_gpu, sizeof(cl_mem));
+    gpu_cl_fill_kernel_args(gpu, ctx.advance_id, 0, 5, &ctx.m_gpu, sizeof(cl_mem), &ctx.swap_gpu, sizeof(cl_mem), &ctx.step_gpu, sizeof(cl_mem), &ctx.gi.rows, sizeof(ctx.gi.rows), &ctx.gi.cols, sizeof(ctx.gi.cols));
+    gpu_cl_fill_kernel_args(gpu, ctx.info_id, 0, 10, &ctx.gp_gpu, sizeof(cl_mem),
+                                                     &ctx.m_gpu, sizeof(cl_mem),
+                                                     &ctx.swap_gpu, sizeof(cl_mem),
+                                                     &ctx.info_gpu, sizeof(cl_mem),
+                                                     &ctx.params.dt, sizeof(double),
+                                                     &ctx.time, sizeof(double),
+                                                     &ctx.gi, sizeof(grid_info),
+                                                     &ctx.placeholder_gpu, sizeof(cl_mem),
+                                                     &ctx.placeholder_gpu, sizeof(cl_mem),
+                                                     &dipolar_cached, sizeof(int));
+    gpu_cl_tune_kernel(gpu, ctx.step_id, ctx.gi.cols, ctx.gi.rows);
+    gpu_cl_tune_kernel(gpu, ctx.info_id, ctx.gi.cols, ctx.gi.rows);
+
+    ctx.info = mmalloc(layout.rows * layout.cols * ctx.info_doubles * sizeof(*ctx.info));
+
+    uint64_t expected_steps = params.duration / params.dt + 1;
+    if (!ctx.params.observables)
+        ctx.params.interval_for_information = 0;
+    if (ctx.params.interval_for_information == 0)
+        ctx.params.interval_for_information = expected_steps + 1;
+    if (ctx.params.interval_for_raw_grid == 0)
+        ctx.params.interval_for_raw_grid = expected_steps + 1;
+    uint64_t number_raw = 3 + expected_steps / ctx.params.interval_for_raw_grid;
+
+    if (layout.rank == 0) {
+        if (params.interval_for_rgb_grid || params.do_cluster)
+            logging_log(LOG_WARNING, "MPI runs write no rgb frames nor clusters, read the raw grid dump instead");
+
+        string_builder output_info_path = {0};
+        sb_cat_cstr(&output_info_path, params.output_path);
+        sb_cat_cstr(&output_info_path, "/integrate_info.dat");
+        ctx.integrate_info = mfopen(sb_as_cstr(&output_info_path), "w");
+        massert(ctx.integrate_info);
+        sb_free(&output_info_path);
+        integrate_print_info_header(ctx.integrate_info, ctx.params.observables);
+    }
+
+    //same layout as integrate_evolution.dat of a single device run
+    string_builder output_grid_path = {0};
+    sb_cat_cstr(&output_grid_path, params.output_path);
+    sb_cat_cstr(&output_grid_path, "/integrate_evolution.dat");
+    if (MPI_File_open(layout.comm, sb_as_cstr(&output_grid_path), MPI_MODE_CREATE | MPI_MODE_WRONLY, MPI_INFO_NULL, &ctx.evolution) != MPI_SUCCESS)
+        logging_log(LOG_FATAL, "Could not open \"%s\" for the raw grid dump", sb_as_cstr(&output_grid_path));
+    sb_free(&output_grid_path);
+    MPI_File_set_size(ctx.evolution, 0);
+    if (layout.rank == 0) {
+        MPI_File_write_at(ctx.evolution, 0, &number_raw, sizeof(number_raw), MPI_BYTE, MPI_STATUS_IGNORE);
+        MPI_File_write_at(ctx.evolution, sizeof(number_raw), &layout.global, sizeof(layout.global), MPI_BYTE, MPI_STATUS_IGNORE);
+    }
+    ctx.evolution_offset = sizeof(number_raw) + sizeof(layout.global);
+
+    integrate_mpi_types(&ctx.layout, sizeof(*gp), &ctx.site_gp, &ctx.block_gp);
+    integrate_mpi_types(&ctx.layout, sizeof(*m), &ctx.site_v3d, &ctx.block_v3d);
+    for (uint64_t r = 0; r < layout.rows; ++r)
+        memmove(gp + r * layout.cols, gp + (r + ctx.halo_rows[0]) * ctx.gi.cols + ctx.halo_cols[0], layout.cols * sizeof(*gp));
+    integrate_mpi_write_block(&ctx, ctx.site_gp, ctx.block_gp, sizeof(*gp), gp);
+    integrate_mpi_write_block(&ctx, ctx.site_v3d, ctx.block_v3d, sizeof(*m), g->m);
+
+    mfree(gp);
+    mfree(m);
+    return ctx;
+}
+
+void integrate_mpi_context_close(integrate_mpi_context *ctx) {
+    integrate_mpi_read_grid(ctx);
+
+    MPI_File_close(&ctx->evolution);
+    MPI_Type_free(&ctx->block_v3d);
+    MPI_Type_free(&ctx->site_v3d);
+    MPI_Type_free(&ctx->block_gp);
+    MPI_Type_free(&ctx->site_gp);
+    if (ctx->integrate_info)
+        mfclose(ctx->integrate_info);
+
+    gpu_cl_release_memory(ctx->gp_gpu);
+    gpu_cl_release_memory(ctx->m_gpu);
+    gpu_cl_release_memory(ctx->swap_gpu);
+    gpu_cl_release_memory(ctx->step_gpu);
+    gpu_cl_release_memory(ctx->info_gpu);
+    gpu_cl_release_memory(ctx->placeholder_gpu);
+    for (int side = 0; side < 2; ++side) {
+        mfree(ctx->send[side]);
+        mfree(ctx->recv[side]);
+    }
+    mfree(ctx->info);
+
+    if (ctx->session_queue) {
+        gpu_cl_release_queue(ctx->gpu->queue);
+        ctx->gpu->queue = ctx->session_queue;
+        ctx->gpu->queue_device = ctx->session_device;
+    }
+}
+
+//the interior of the pending step, like integrate_get_info it runs between the step and the advance
+information_packed integrate_mpi_get_info(integrate_mpi_context *ctx) {
+    gpu_cl_set_kernel_arg(ctx->gpu, ctx->info_id, 5, sizeof(double), &ctx->time);
+    integrate_mpi_launch(ctx, ctx->info_id, ctx->halo_cols[0], ctx->layout.cols, ctx->halo_rows[0], ctx->layout.rows);
+    uint64_t site = ctx->info_doubles * sizeof(*ctx->info);
+    gpu_cl_read_gpu_rect(ctx->gpu, ctx->layout.cols * site, ctx->layout.rows, ctx->halo_cols[0] * site, ctx->halo_rows[0],
+                         ctx->gi.cols * site, ctx->info, ctx->info_gpu);
+
+    information_packed info = integrate_sum_info(ctx->info, ctx->layout.rows * ctx->layout.cols, ctx->params.observables, (uint64_t)ctx->layout.global.rows * ctx->layout.global.cols);
+    //every field is a double, so the sum over ranks is a plain MPI_SUM
+    if (MPI_Allreduce(MPI_IN_PLACE, &info, sizeof(info) / sizeof(double), MPI_DOUBLE, MPI_SUM, ctx->layout.comm) != MPI_SUCCESS)
+        logging_log(LOG_FATAL, "Could not reduce the information over the ranks");
+    return info;
+}
+
+void integrate_mpi_read_grid(integrate_mpi_context *ctx) {
+    gpu_cl_read_gpu_rect(ctx->gpu, ctx->layout.cols * sizeof(v3d), ctx->layout.rows, ctx->halo_cols[0] * sizeof(v3d), ctx->halo_rows[0],
+                         ctx->gi.cols * sizeof(v3d), ctx->g->m, ctx->m_gpu);
+}
+
+//each step trusts one row and col less next to every halo, until the halos are refilled
+static void integrate_mpi_enqueue_step(integrate_mpi_context *ctx) {
+    if (ctx->phase == ctx->halo) {
+        integrate_mpi_exchange_m(ctx);
+        ctx->phase = 0;
+    }
+    uint64_t k = ctx->phase;
+    uint64_t row = ctx->halo_rows[0]? k + 1: 0;
+    uint64_t col = ctx->halo_cols[0]? k + 1: 0;
+    uint64_t row_end = ctx->halo_rows[1]? ctx->gi.rows - k - 1: ctx->gi.rows;
+    uint64_t col_end = ctx->halo_cols[1]? ctx->gi.cols - k - 1: ctx->gi.cols;
+    integrate_mpi_launch(ctx, ctx->step_id, col, col_end - col, row, row_end - row);
+}
+
+void integrate_mpi_run_steps(integrate_mpi_context *ctx, uint64_t n) {
+    for (uint64_t i = 0; i < n; ++i) {
+        integrate_mpi_enqueue_step(ctx);
+
+        if (ctx->integrate_step % ctx->params.interval_for_information == 0) {
+            information_packed info = integrate_mpi_get_info(ctx);
+            if (ctx->integrate_info)
+                integrate_print_info(ctx->integrate_info, ctx->params.observables, ctx->time, info);
+        }
+
+        if (ctx->integrate_step % ctx->params.interval_for_raw_grid == 0) {
+            integrate_mpi_read_grid(ctx);
+            integrate_mpi_write_block(ctx, ctx->site_v3d, ctx->block_v3d, sizeof(v3d), ctx->g->m);
+        }
+
+        gpu_cl_enqueue_nd(ctx->gpu, ctx->advance_id, 1, &ctx->local, &ctx->global, NULL);
+        ctx->phase++;
+        ctx->integrate_step += 1;
+        ctx->time = ctx->time0 + ctx->integrate_step * ctx->params.dt;
+        if (ctx->integrate_step % INTEGRATE_BATCH_SYNC == 0)
+            gpu_cl_finish(ctx->gpu);
+    }
+}
+
+void integrate_mpi(grid *g, integrate_mpi_layout layout, integrate_params params) {
+    //halo sites run the same code as the owner's, so every rank compiles the terms of the whole lattice
+    uint64_t terms = grid_kernel_terms(g);
+    MPI_Allreduce(MPI_IN_PLACE, &terms, 1, MPI_UINT64_T, MPI_BOR, layout.comm);
+
+    char *compile = integrate_compile_augment(params);
+    gpu_cl gpu = gpu_session_borrow(params.session, params.current_func, params.field_func, params.temperature_func, NULL, compile, terms);
+    mfree(compile);
+    integrate_mpi_context ctx = integrate_mpi_context_init(g, &gpu, layout, params);
+
+    uint64_t expected_steps = params.duration / params.dt + 1;
+    if (layout.rank == 0)
+        logging_log(LOG_INFO, "Expected integrate steps: %"PRIu64, expected_steps);
+
+    uint64_t chunk = expected_steps / 100 + 1;
+    while (ctx.integrate_step < expected_steps) {
+        integrate_mpi_run_steps(&ctx, ctx.integrate_step + chunk > expected_steps? expected_steps - ctx.integrate_step: chunk);
+        if (layout.rank == 0)
+            logging_log(LOG_INFO, "%.3es - %.2f%%", ctx.time, ctx.time / params.duration * 100.0);
+    }
+
+    integrate_mpi_read_grid(&ctx);
+    integrate_mpi_write_block(&ctx, ctx.site_v3d, ctx.block_v3d, sizeof(v3d), g->m);
+    integrate_mpi_context_close(&ctx);
+    gpu_cl_close(&gpu);
+}
+
+#endif
@@ -4,9 +4,73 @@
 #include "string_builder.h"
 #include "logging.h"
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+static const char *skip_spaces(const char *s) {
+    while (*s && isspace((unsigned char)*s))
+        s++;
+    return s;
+}
+
+//Only "return <constant>;" is understood as a constant temperature, anything else is assumed to be active
+static bool temperature_is_zero(const char *temperature_augment) {
+    const char *ptr = skip_spaces(temperature_augment);
+    if (strncmp(ptr, "return", 6) != 0)
+        return false;
+    ptr += 6;
+
+    char *end = NULL;
+    double value = strtod(ptr, &end);
+    if (end == ptr)
+        return false;
+
+    ptr = skip_spaces(end);
+    if (*ptr != ';')
+        return false;
+
+    return *skip_spaces(ptr + 1) == '\0' && value == 0.0;
+}
 
-char *fill_functions_on_kernel(const char *current_augment, const char *field_augment, const char *temperature_augment, const char *kernel_augment) {
+uint64_t kernel_terms_from_functions(const char *current_augment, const char *temperature_augment) {
+    uint64_t terms = 0;
+    if (temperature_augment && !temperature_is_zero(temperature_augment))
+        terms |= KERNEL_TERM_TEMPERATURE;
+
+    if (current_augment) {
+        bool stt = strstr(current_augment, "CUR_STT") != NULL;
+        bool she = strstr(current_augment, "CUR_SHE") != NULL;
+        bool both = strstr(current_augment, "CUR_BOTH") != NULL;
+        bool none = strstr(current_augment, "CUR_NONE") != NULL;
+
+        if (stt || both)
+            terms |= KERNEL_TERM_STT;
+        if (she || both)
+            terms |= KERNEL_TERM_SHE;
+        //current type computed in some other way, can't tell what is used
+        if (!stt && !she && !both && !none)
+            terms |= KERNEL_TERM_STT | KERNEL_TERM_SHE;
+    }
+    return terms;
+}
+
+char *fill_functions_on_kernel(const char *current_augment, const char *field_augment, const char *temperature_augment, const char *kernel_augment, uint64_t grid_terms) {
     string_builder ret = {0};
+    uint64_t terms = kernel_terms_from_functions(current_augment, temperature_augment) | (grid_terms & KERNEL_TERM_CUBIC);
+
+    if (terms & KERNEL_TERM_TEMPERATURE)
+        sb_cat_cstr(&ret, "#define HAS_TEMPERATURE\n");
+    if (terms & KERNEL_TERM_STT)
+        sb_cat_cstr(&ret, "#define HAS_STT\n");
+    if (terms & KERNEL_TERM_SHE)
+        sb_cat_cstr(&ret, "#define HAS_SHE\n");
+    if (terms & KERNEL_TERM_CUBIC)
+        sb_cat_cstr(&ret, "#define HAS_CUBIC\n");
+
+    logging_log(LOG_INFO, "Kernel terms: temperature=%d stt=%d she=%d cubic=%d", (terms & KERNEL_TERM_TEMPERATURE) != 0, (terms & KERNEL_TERM_STT) != 0,
+                                                                                  (terms & KERNEL_TERM_SHE) != 0, (terms & KERNEL_TERM_CUBIC) != 0);
+
     sb_cat_cstr(&ret, complete_kernel);
 
     sb_cat_cstr(&ret, "\n\n\n\n");
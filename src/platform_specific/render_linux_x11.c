@@ -10,6 +10,14 @@
 
 #include <stdlib.h>
 #include <stdio.h>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 #include "render.h"
 #include "allocator.h"
@@ -182,6 +190,49 @@ void window_draw_from_bytes(RGBA32 *bytes, int x0, int y0, int width, int height
         memmove(&w->buffer[y * w->width + x0], &bytes[(y - y0) * b_w], width * sizeof(*bytes));
 }
 
+static unsigned char window_lerp(unsigned char a, unsigned char b, double t) {
+    return a + (b - a) * t + 0.5;
+}
+
+void window_draw_scaled(RGBA32 *bytes, int width, int height, bool linear) {
+    if (width == (int)w->width && height == (int)w->height) {
+        memcpy(w->buffer, bytes, width * height * sizeof(*bytes));
+        return;
+    }
+
+    for (unsigned int y = 0; y < w->height; ++y) {
+        RGBA32 *row = &w->buffer[y * w->width];
+        if (!linear) {
+            RGBA32 *src = &bytes[(uint64_t)y * height / w->height * width];
+            for (unsigned int x = 0; x < w->width; ++x)
+                row[x] = src[(uint64_t)x * width / w->width];
+            continue;
+        }
+
+        //pixel centres, clamped at the edges
+        double fy = (y + 0.5) * height / w->height - 0.5;
+        fy = fy < 0.0? 0.0: fy;
+        int y0 = fy;
+        int y1 = y0 + 1 < height? y0 + 1: y0;
+        double ty = fy - y0;
+        for (unsigned int x = 0; x < w->width; ++x) {
+            double fx = (x + 0.5) * width / w->width - 0.5;
+            fx = fx < 0.0? 0.0: fx;
+            int x0 = fx;
+            int x1 = x0 + 1 < width? x0 + 1: x0;
+            double tx = fx - x0;
+            RGBA32 c00 = bytes[y0 * width + x0], c01 = bytes[y0 * width + x1];
+            RGBA32 c10 = bytes[y1 * width + x0], c11 = bytes[y1 * width + x1];
+            row[x] = (RGBA32){
+                .r = window_lerp(window_lerp(c00.r, c01.r, tx), window_lerp(c10.r, c11.r, tx), ty),
+                .g = window_lerp(window_lerp(c00.g, c01.g, tx), window_lerp(c10.g, c11.g, tx), ty),
+                .b = window_lerp(window_lerp(c00.b, c01.b, tx), window_lerp(c10.b, c11.b, tx), ty),
+                .a = window_lerp(window_lerp(c00.a, c01.a, tx), window_lerp(c10.a, c11.a, tx), ty),
+            };
+        }
+    }
+}
+
 int window_width(void) {
     return w->width;
 }
@@ -189,3 +240,64 @@ int window_width(void) {
 int window_height(void) {
     return w->height;
 }
+
+struct render_thread {
+    pthread_t thread;
+};
+
+render_thread *render_thread_start(void *(*f)(void *), void *data) {
+    render_thread *t = mmalloc(sizeof(*t));
+    int err;
+    if ((err = pthread_create(&t->thread, NULL, f, data)) != 0)
+        logging_log(LOG_FATAL, "Could not start thread %d", err);
+    return t;
+}
+
+void render_thread_join(render_thread *t) {
+    int err;
+    if ((err = pthread_join(t->thread, NULL)) != 0)
+        logging_log(LOG_FATAL, "Could not join thread %d", err);
+    mfree(t);
+}
+
+void render_sleep(double seconds) {
+    struct timespec t = {.tv_sec = (time_t)seconds, .tv_nsec = (long)((seconds - (time_t)seconds) * 1e9)};
+    nanosleep(&t, NULL);
+}
+
+void render_lock_acquire(render_lock *l) {
+    for (unsigned int tries = 0; atomic_flag_test_and_set_explicit(l, memory_order_acquire); ++tries) {
+        if (tries < 64)
+            sched_yield();
+        else
+            render_sleep(1e-4);
+    }
+}
+
+void render_lock_release(render_lock *l) {
+    atomic_flag_clear_explicit(l, memory_order_release);
+}
+
+const void *render_map_file(const char *path, uint64_t *size) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        logging_log(LOG_ERROR, "Could not open file \"%s\": %s", path, strerror(errno));
+        return NULL;
+    }
+    struct stat st;
+    void *data = MAP_FAILED;
+    if (fstat(fd, &st) == 0 && st.st_size > 0)
+        data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    //the mapping keeps the file open
+    close(fd);
+    if (data == MAP_FAILED) {
+        logging_log(LOG_ERROR, "Could not map file \"%s\": %s", path, strerror(errno));
+        return NULL;
+    }
+    *size = st.st_size;
+    return data;
+}
+
+void render_unmap_file(const void *data, uint64_t size) {
+    munmap((void*)data, size);
+}
@@ -4,6 +4,7 @@
 
 #include "render.h"
 #include "allocator.h"
+#include "logging.h"
 
 struct render_window {
     unsigned int width;
@@ -139,6 +140,49 @@ void window_draw_from_bytes(RGBA32 *bytes, int x0, int y0, int width, int height
         memmove(&w->buffer[y * w->width + x0], &bytes[(y - y0) * b_w], width * sizeof(*bytes));
 }
 
+static unsigned char window_lerp(unsigned char a, unsigned char b, double t) {
+    return a + (b - a) * t + 0.5;
+}
+
+void window_draw_scaled(RGBA32 *bytes, int width, int height, bool linear) {
+    if (width == (int)w->width && height == (int)w->height) {
+        memcpy(w->buffer, bytes, width * height * sizeof(*bytes));
+        return;
+    }
+
+    for (unsigned int y = 0; y < w->height; ++y) {
+        RGBA32 *row = &w->buffer[y * w->width];
+        if (!linear) {
+            RGBA32 *src = &bytes[(uint64_t)y * height / w->height * width];
+            for (unsigned int x = 0; x < w->width; ++x)
+                row[x] = src[(uint64_t)x * width / w->width];
+            continue;
+        }
+
+        //pixel centres, clamped at the edges
+        double fy = (y + 0.5) * height / w->height - 0.5;
+        fy = fy < 0.0? 0.0: fy;
+        int y0 = fy;
+        int y1 = y0 + 1 < height? y0 + 1: y0;
+        double ty = fy - y0;
+        for (unsigned int x = 0; x < w->width; ++x) {
+            double fx = (x + 0.5) * width / w->width - 0.5;
+            fx = fx < 0.0? 0.0: fx;
+            int x0 = fx;
+            int x1 = x0 + 1 < width? x0 + 1: x0;
+            double tx = fx - x0;
+            RGBA32 c00 = bytes[y0 * width + x0], c01 = bytes[y0 * width + x1];
+            RGBA32 c10 = bytes[y1 * width + x0], c11 = bytes[y1 * width + x1];
+            row[x] = (RGBA32){
+                .r = window_lerp(window_lerp(c00.r, c01.r, tx), window_lerp(c10.r, c11.r, tx), ty),
+                .g = window_lerp(window_lerp(c00.g, c01.g, tx), window_lerp(c10.g, c11.g, tx), ty),
+                .b = window_lerp(window_lerp(c00.b, c01.b, tx), window_lerp(c10.b, c11.b, tx), ty),
+                .a = window_lerp(window_lerp(c00.a, c01.a, tx), window_lerp(c10.a, c11.a, tx), ty),
+            };
+        }
+    }
+}
+
 int window_width(void) {
     return w->width;
 }
@@ -146,3 +190,74 @@ int window_width(void) {
 int window_height(void) {
     return w->height;
 }
+
+struct render_thread {
+    HANDLE handle;
+    void *(*f)(void *);
+    void *data;
+};
+
+static DWORD WINAPI render_thread_main(LPVOID param) {
+    render_thread *t = param;
+    t->f(t->data);
+    return 0;
+}
+
+render_thread *render_thread_start(void *(*f)(void *), void *data) {
+    render_thread *t = mmalloc(sizeof(*t));
+    t->f = f;
+    t->data = data;
+    t->handle = CreateThread(NULL, 0, render_thread_main, t, 0, NULL);
+    if (!t->handle)
+        logging_log(LOG_FATAL, "Could not start thread %lu", GetLastError());
+    return t;
+}
+
+void render_thread_join(render_thread *t) {
+    WaitForSingleObject(t->handle, INFINITE);
+    CloseHandle(t->handle);
+    mfree(t);
+}
+
+void render_sleep(double seconds) {
+    Sleep((DWORD)(seconds * 1000.0));
+}
+
+void render_lock_acquire(render_lock *l) {
+    for (unsigned int tries = 0; atomic_flag_test_and_set_explicit(l, memory_order_acquire); ++tries) {
+        if (tries < 64)
+            SwitchToThread();
+        else
+            Sleep(1);
+    }
+}
+
+void render_lock_release(render_lock *l) {
+    atomic_flag_clear_explicit(l, memory_order_release);
+}
+
+const void *render_map_file(const char *path, uint64_t *size) {
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE) {
+        logging_log(LOG_ERROR, "Could not open file \"%s\" %lu", path, GetLastError());
+        return NULL;
+    }
+    LARGE_INTEGER file_size;
+    HANDLE mapping = NULL;
+    if (GetFileSizeEx(file, &file_size) && file_size.QuadPart > 0)
+        mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    const void *data = mapping? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0): NULL;
+    if (!data)
+        logging_log(LOG_ERROR, "Could not map file \"%s\" %lu", path, GetLastError());
+    //the view keeps the file open
+    if (mapping)
+        CloseHandle(mapping);
+    CloseHandle(file);
+    *size = data? file_size.QuadPart: 0;
+    return data;
+}
+
+void render_unmap_file(const void *data, uint64_t size) {
+    (void)size;
+    UnmapViewOfFile(data);
+}
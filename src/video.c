@@ -0,0 +1,222 @@
+#include "video.h"
+#include "render.h"
+#include "allocator.h"
+#include "logging.h"
+#include "string_builder.h"
+#include "stb_image_write.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+//a pushed frame and what it encodes to
+typedef struct {
+    video_writer *v;
+    RGBA32 *rgba;
+    uint64_t number;
+    unsigned char *out;
+    uint64_t len;
+    uint64_t cap;
+} video_frame;
+
+//params.threads frames per batch, one is filled by the caller while the other is encoded and written
+struct video_writer {
+    string_builder path;
+    FILE *f;
+    unsigned int width, height;
+    video_params params;
+
+    video_frame *batches[2];
+    uint64_t n_frames[2];
+    unsigned int filling;
+    //encoding batches[!filling], NULL when idle
+    render_thread *encoder;
+
+    uint64_t frames;
+    uint64_t bytes;
+};
+
+video_params video_params_init(void) {
+    video_params ret = {0};
+    ret.format = VIDEO_PNG_FRAMES;
+    ret.fps = 30;
+    ret.png_level = 8;
+    ret.threads = 4;
+    return ret;
+}
+
+const char *video_file_name(video_format format) {
+    switch (format) {
+        case VIDEO_PNG:
+            return "frames.png";
+        case VIDEO_Y4M:
+            return "frames.y4m";
+        case VIDEO_PNG_FRAMES:
+        default:
+            return "frame";
+    }
+}
+
+static void video_frame_append(void *context, void *data, int size) {
+    video_frame *f = context;
+    if (f->len + size > f->cap) {
+        f->cap = (f->len + size) * 2;
+        f->out = mrealloc(f->out, f->cap);
+    }
+    memcpy(f->out + f->len, data, size);
+    f->len += size;
+}
+
+//full range rgb to limited range BT.601, what players assume for y4m without a colour space tag
+static void video_encode_y4m(video_frame *f) {
+    uint64_t n = (uint64_t)f->v->width * f->v->height;
+    static const char header[] = "FRAME\n";
+    uint64_t size = sizeof(header) - 1 + 3 * n;
+    if (f->cap < size) {
+        f->cap = size;
+        f->out = mrealloc(f->out, f->cap);
+    }
+    memcpy(f->out, header, sizeof(header) - 1);
+    unsigned char *y = f->out + sizeof(header) - 1;
+    unsigned char *u = y + n;
+    unsigned char *v = u + n;
+    for (uint64_t i = 0; i < n; ++i) {
+        int r = f->rgba[i].r, g = f->rgba[i].g, b = f->rgba[i].b;
+        y[i] = ((66 * r + 129 * g + 25 * b + 128) >> 8) + 16;
+        u[i] = ((-38 * r - 74 * g + 112 * b + 128) >> 8) + 128;
+        v[i] = ((112 * r - 94 * g - 18 * b + 128) >> 8) + 128;
+    }
+    f->len = size;
+}
+
+//RGBA32 is bgra in memory, png wants rgb
+static void video_encode_png(video_frame *f) {
+    uint64_t n = (uint64_t)f->v->width * f->v->height;
+    unsigned char *rgb = mmalloc(3 * n);
+    for (uint64_t i = 0; i < n; ++i) {
+        rgb[3 * i + 0] = f->rgba[i].r;
+        rgb[3 * i + 1] = f->rgba[i].g;
+        rgb[3 * i + 2] = f->rgba[i].b;
+    }
+    f->len = 0;
+    if (!stbi_write_png_to_func(video_frame_append, f, f->v->width, f->v->height, 3, rgb, 3 * f->v->width))
+        logging_log(LOG_WARNING, "Could not encode frame %"PRIu64" of \"%s\"", f->number, sb_as_cstr(&f->v->path));
+    mfree(rgb);
+}
+
+static void *video_encode_frame(void *data) {
+    video_frame *f = data;
+    if (f->v->params.format == VIDEO_Y4M)
+        video_encode_y4m(f);
+    else
+        video_encode_png(f);
+    return NULL;
+}
+
+static void video_write_frame(video_writer *v, video_frame *f) {
+    FILE *out = v->f;
+    char name[1024];
+    if (v->params.format == VIDEO_PNG_FRAMES) {
+        snprintf(name, sizeof(name), "%s_%"PRIu64".png", sb_as_cstr(&v->path), f->number);
+        out = mfopen(name, "wb");
+        if (!out)
+            return;
+    }
+    if (fwrite(f->out, 1, f->len, out) != f->len)
+        logging_log(LOG_WARNING, "Could not write frame %"PRIu64" of \"%s\"", f->number, sb_as_cstr(&v->path));
+    if (out != v->f)
+        mfclose(out);
+    v->bytes += f->len;
+}
+
+//encodes the batch a frame per thread, this one included, then writes it in order
+static void *video_encode_batch(void *data) {
+    video_writer *v = data;
+    unsigned int batch = !v->filling;
+    video_frame *frames = v->batches[batch];
+    uint64_t n = v->n_frames[batch];
+
+    render_thread **workers = mmalloc(n * sizeof(*workers));
+    for (uint64_t i = 1; i < n; ++i)
+        workers[i] = render_thread_start(video_encode_frame, &frames[i]);
+    video_encode_frame(&frames[0]);
+    for (uint64_t i = 1; i < n; ++i)
+        render_thread_join(workers[i]);
+    mfree(workers);
+
+    for (uint64_t i = 0; i < n; ++i)
+        video_write_frame(v, &frames[i]);
+    v->n_frames[batch] = 0;
+    return NULL;
+}
+
+//the filled batch goes to the encoder once the previous one is written, the caller goes on with the other
+static void video_writer_swap(video_writer *v) {
+    if (v->encoder) {
+        render_thread_join(v->encoder);
+        v->encoder = NULL;
+    }
+    if (!v->n_frames[v->filling])
+        return;
+    v->filling = !v->filling;
+    v->encoder = render_thread_start(video_encode_batch, v);
+}
+
+video_writer *video_writer_open(const char *path, unsigned int width, unsigned int height, video_params params) {
+    video_writer *v = mmalloc(sizeof(*v));
+    *v = (video_writer){0};
+    sb_cat_cstr(&v->path, path);
+    //terminated here, the encoders only read it
+    sb_as_cstr(&v->path);
+    v->width = width;
+    v->height = height;
+    v->params = params;
+    if (v->params.threads == 0)
+        v->params.threads = 1;
+    if (v->params.format != VIDEO_PNG_FRAMES) {
+        v->f = mfopen(path, "wb");
+        massert(v->f);
+    }
+    if (v->params.format == VIDEO_Y4M)
+        fprintf(v->f, "YUV4MPEG2 W%u H%u F%u:1 Ip A1:1 C444\n", width, height, v->params.fps? v->params.fps: 30);
+    //a global of stb, the last writer opened sets it for every one
+    if (v->params.format != VIDEO_Y4M)
+        stbi_write_png_compression_level = v->params.png_level;
+
+    for (unsigned int b = 0; b < 2; ++b) {
+        v->batches[b] = mmalloc(v->params.threads * sizeof(*v->batches[b]));
+        for (unsigned int i = 0; i < v->params.threads; ++i) {
+            v->batches[b][i] = (video_frame){.v = v};
+            v->batches[b][i].rgba = mmalloc((uint64_t)width * height * sizeof(*v->batches[b][i].rgba));
+        }
+    }
+    logging_log(LOG_INFO, "Writing %ux%u frames to \"%s\", %u encoded at once", width, height, path, v->params.threads);
+    return v;
+}
+
+void video_writer_push(video_writer *v, const RGBA32 *rgba, uint64_t number) {
+    video_frame *f = &v->batches[v->filling][v->n_frames[v->filling]++];
+    memcpy(f->rgba, rgba, (uint64_t)v->width * v->height * sizeof(*rgba));
+    f->number = number;
+    v->frames++;
+    if (v->n_frames[v->filling] == v->params.threads)
+        video_writer_swap(v);
+}
+
+void video_writer_close(video_writer *v) {
+    video_writer_swap(v);
+    video_writer_swap(v);
+    if (v->f)
+        mfclose(v->f);
+    logging_log(LOG_INFO, "Wrote %"PRIu64" frames to \"%s\", %.3f MB", v->frames, sb_as_cstr(&v->path), v->bytes / 1.0e6);
+
+    for (unsigned int b = 0; b < 2; ++b) {
+        for (unsigned int i = 0; i < v->params.threads; ++i) {
+            mfree(v->batches[b][i].rgba);
+            mfree(v->batches[b][i].out);
+        }
+        mfree(v->batches[b]);
+    }
+    sb_free(&v->path);
+    mfree(v);
+}